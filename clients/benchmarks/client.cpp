@@ -7,6 +7,7 @@
 #include "hipblas.hpp"
 
 #include "argument_model.hpp"
+#include "hipblas_bench.hpp"
 #include "hipblas_datatype2string.hpp"
 #include "hipblas_parse_data.hpp"
 #include "type_dispatch.hpp"
@@ -14,13 +15,24 @@
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <cmath>
 #include <cstring>
+#include <exception>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
+
+#ifndef WIN32
+#include <unistd.h>
+#endif
 // aux
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
@@ -30,9 +42,11 @@
 #include "testing_asum.hpp"
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
+#include "testing_axpby.hpp"
 #include "testing_axpy.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_batched_ex.hpp"
+#include "testing_axpy_dot.hpp"
 #include "testing_axpy_ex.hpp"
 #include "testing_axpy_strided_batched.hpp"
 #include "testing_axpy_strided_batched_ex.hpp"
@@ -43,11 +57,14 @@
 #include "testing_dot_batched.hpp"
 #include "testing_dot_batched_ex.hpp"
 #include "testing_dot_ex.hpp"
+#include "testing_dot_multi.hpp"
 #include "testing_dot_strided_batched.hpp"
 #include "testing_dot_strided_batched_ex.hpp"
 #include "testing_iamax_iamin.hpp"
 #include "testing_iamax_iamin_batched.hpp"
 #include "testing_iamax_iamin_strided_batched.hpp"
+#include "testing_latency.hpp"
+#include "testing_normalize.hpp"
 #include "testing_nrm2.hpp"
 #include "testing_nrm2_batched.hpp"
 #include "testing_nrm2_batched_ex.hpp"
@@ -85,6 +102,7 @@
 #include "testing_gemv.hpp"
 #include "testing_gemv_batched.hpp"
 #include "testing_gemv_strided_batched.hpp"
+#include "testing_gemv_vbatched.hpp"
 #include "testing_ger.hpp"
 #include "testing_ger_batched.hpp"
 #include "testing_ger_strided_batched.hpp"
@@ -142,6 +160,10 @@
 #include "testing_tpsv.hpp"
 #include "testing_tpsv_batched.hpp"
 #include "testing_tpsv_strided_batched.hpp"
+#include "testing_tpttr.hpp"
+#include "testing_trttp.hpp"
+#include "testing_gbtge.hpp"
+#include "testing_getgb.hpp"
 #include "testing_trmv.hpp"
 #include "testing_trmv_batched.hpp"
 #include "testing_trmv_strided_batched.hpp"
@@ -154,6 +176,7 @@
 #include "testing_geam_batched.hpp"
 #include "testing_geam_strided_batched.hpp"
 #include "testing_gemm.hpp"
+#include "testing_gemm3m.hpp"
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
@@ -179,6 +202,7 @@
 #include "testing_syr2k_strided_batched.hpp"
 #include "testing_syrk.hpp"
 #include "testing_syrk_batched.hpp"
+#include "testing_syrk_ex.hpp"
 #include "testing_syrk_strided_batched.hpp"
 #include "testing_syrkx.hpp"
 #include "testing_syrkx_batched.hpp"
@@ -343,6 +367,60 @@ struct perf_gemm_strided_batched_ex<
     }
 };
 
+// Template to dispatch testing_syrk_ex for performance tests
+// C is float, double or complex, A is of the type of C or half or bfloat16 with float C
+template <typename Ta, typename Tc = Ta, typename = void>
+struct perf_syrk_ex : hipblas_test_invalid
+{
+};
+
+template <typename Ta, typename Tc>
+struct perf_syrk_ex<
+    Ta,
+    Tc,
+    std::enable_if_t<(std::is_same<Ta, Tc>{}
+                      && (std::is_same<Tc, float>{} || std::is_same<Tc, double>{}
+                          || std::is_same<Tc, hipblasComplex>{}
+                          || std::is_same<Tc, hipblasDoubleComplex>{}))
+                     || ((std::is_same<Ta, hipblasHalf>{} || std::is_same<Ta, hipblasBfloat16>{})
+                         && std::is_same<Tc, float>{})>> : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"syrk_ex", testing_syrk_ex_template<Ta, Tc>},
+            {"syrk_batched_ex", testing_syrk_batched_ex_template<Ta, Tc>},
+            {"syrk_strided_batched_ex", testing_syrk_strided_batched_ex_template<Ta, Tc>},
+        };
+        run_function(map, arg);
+    }
+};
+
+// Template to dispatch testing_syrk_ex of herk_ex for performance tests, C is complex
+template <typename Ta, typename Tc = Ta, typename = void>
+struct perf_herk_ex : hipblas_test_invalid
+{
+};
+
+template <typename Ta, typename Tc>
+struct perf_herk_ex<Ta,
+                    Tc,
+                    std::enable_if_t<std::is_same<Ta, Tc>{}
+                                     && (std::is_same<Tc, hipblasComplex>{}
+                                         || std::is_same<Tc, hipblasDoubleComplex>{})>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"herk_ex", testing_syrk_ex_template<Ta, Tc, true>},
+            {"herk_batched_ex", testing_syrk_batched_ex_template<Ta, Tc, true>},
+            {"herk_strided_batched_ex", testing_syrk_strided_batched_ex_template<Ta, Tc, true>},
+        };
+        run_function(map, arg);
+    }
+};
+
 template <typename T, typename U = T, typename = void>
 struct perf_blas : hipblas_test_invalid
 {
@@ -359,15 +437,23 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"asum", testing_asum<T>},
             {"asum_batched", testing_asum_batched<T>},
             {"asum_strided_batched", testing_asum_strided_batched<T>},
+            {"axpby", testing_axpby<T>},
+            {"axpby_batched", testing_axpby_batched<T>},
+            {"axpby_strided_batched", testing_axpby_strided_batched<T>},
             {"axpy", testing_axpy<T>},
             {"axpy_batched", testing_axpy_batched<T>},
             {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+            {"axpy_dot", testing_axpy_dot<T>},
+            {"axpy_dot_strided_batched", testing_axpy_dot_strided_batched<T>},
             {"copy", testing_copy<T>},
             {"copy_batched", testing_copy_batched<T>},
             {"copy_strided_batched", testing_copy_strided_batched<T>},
             {"dot", testing_dot<T>},
             {"dot_batched", testing_dot_batched<T>},
             {"dot_strided_batched", testing_dot_strided_batched<T>},
+            {"dot_multi", testing_dot_multi<T>},
+            {"dot_multi_batched", testing_dot_multi_batched<T>},
+            {"dot_multi_strided_batched", testing_dot_multi_strided_batched<T>},
             {"iamax", testing_amax<T>},
             {"iamax_batched", testing_amax_batched<T>},
             {"iamax_strided_batched", testing_amax_strided_batched<T>},
@@ -377,6 +463,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"nrm2", testing_nrm2<T>},
             {"nrm2_batched", testing_nrm2_batched<T>},
             {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+            {"normalize", testing_normalize<T, real_t<T>>},
+            {"normalize_batched", testing_normalize_batched<T, real_t<T>>},
+            {"normalize_strided_batched", testing_normalize_strided_batched<T, real_t<T>>},
             {"rotg", testing_rotg<T>},
             {"rotg_batched", testing_rotg_batched<T>},
             {"rotg_strided_batched", testing_rotg_strided_batched<T>},
@@ -400,6 +489,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemv", testing_gemv<T>},
             {"gemv_batched", testing_gemv_batched<T>},
             {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+            {"gemv_vbatched", testing_gemv_vbatched<T>},
             {"ger", testing_ger<T, false>},
             {"ger_batched", testing_ger_batched<T, false>},
             {"ger_strided_batched", testing_ger_strided_batched<T, false>},
@@ -436,6 +526,18 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"tpsv", testing_tpsv<T>},
             {"tpsv_batched", testing_tpsv_batched<T>},
             {"tpsv_strided_batched", testing_tpsv_strided_batched<T>},
+            {"tpttr", testing_tpttr<T>},
+            {"tpttr_batched", testing_tpttr_batched<T>},
+            {"tpttr_strided_batched", testing_tpttr_strided_batched<T>},
+            {"trttp", testing_trttp<T>},
+            {"trttp_batched", testing_trttp_batched<T>},
+            {"trttp_strided_batched", testing_trttp_strided_batched<T>},
+            {"gbtge", testing_gbtge<T>},
+            {"gbtge_batched", testing_gbtge_batched<T>},
+            {"gbtge_strided_batched", testing_gbtge_strided_batched<T>},
+            {"getgb", testing_getgb<T>},
+            {"getgb_batched", testing_getgb_batched<T>},
+            {"getgb_strided_batched", testing_getgb_strided_batched<T>},
             {"trmv", testing_trmv<T>},
             {"trmv_batched", testing_trmv_batched<T>},
             {"trmv_strided_batched", testing_trmv_strided_batched<T>},
@@ -495,6 +597,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
 #endif
 
+            // latency
+            {"latency", testing_latency<T>},
+
             // Aux
             {"set_get_vector", testing_set_get_vector<T>},
             {"set_get_vector_async", testing_set_get_vector_async<T>},
@@ -525,12 +630,18 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, hipblasHalf>{}>> : hipbl
     void operator()(const Arguments& arg)
     {
         static const func_map map = {
+            {"axpby", testing_axpby<T>},
+            {"axpby_batched", testing_axpby_batched<T>},
+            {"axpby_strided_batched", testing_axpby_strided_batched<T>},
             {"axpy", testing_axpy<T>},
             {"axpy_batched", testing_axpy_batched<T>},
             {"axpy_strided_batched", testing_axpy_strided_batched<T>},
             {"dot", testing_dot<T>},
             {"dot_batched", testing_dot_batched<T>},
             {"dot_strided_batched", testing_dot_strided_batched<T>},
+            {"dot_multi", testing_dot_multi<T>},
+            {"dot_multi_batched", testing_dot_multi_batched<T>},
+            {"dot_multi_strided_batched", testing_dot_multi_strided_batched<T>},
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
@@ -550,13 +661,21 @@ struct perf_blas<
     void operator()(const Arguments& arg)
     {
         static const func_map map = {
+            // latency
+            {"latency", testing_latency<T>},
+
             // L1
             {"asum", testing_asum<T>},
             {"asum_batched", testing_asum_batched<T>},
             {"asum_strided_batched", testing_asum_strided_batched<T>},
+            {"axpby", testing_axpby<T>},
+            {"axpby_batched", testing_axpby_batched<T>},
+            {"axpby_strided_batched", testing_axpby_strided_batched<T>},
             {"axpy", testing_axpy<T>},
             {"axpy_batched", testing_axpy_batched<T>},
             {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+            {"axpy_dot", testing_axpy_dot<T>},
+            {"axpy_dot_strided_batched", testing_axpy_dot_strided_batched<T>},
             {"copy", testing_copy<T>},
             {"copy_batched", testing_copy_batched<T>},
             {"copy_strided_batched", testing_copy_strided_batched<T>},
@@ -566,6 +685,9 @@ struct perf_blas<
             {"dotc", testing_dotc<T>},
             {"dotc_batched", testing_dotc_batched<T>},
             {"dotc_strided_batched", testing_dotc_strided_batched<T>},
+            {"dot_multi", testing_dot_multi<T>},
+            {"dot_multi_batched", testing_dot_multi_batched<T>},
+            {"dot_multi_strided_batched", testing_dot_multi_strided_batched<T>},
             {"iamax", testing_amax<T>},
             {"iamax_batched", testing_amax_batched<T>},
             {"iamax_strided_batched", testing_amax_strided_batched<T>},
@@ -575,6 +697,9 @@ struct perf_blas<
             {"nrm2", testing_nrm2<T>},
             {"nrm2_batched", testing_nrm2_batched<T>},
             {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+            {"normalize", testing_normalize<T, real_t<T>>},
+            {"normalize_batched", testing_normalize_batched<T, real_t<T>>},
+            {"normalize_strided_batched", testing_normalize_strided_batched<T, real_t<T>>},
             {"rotg", testing_rotg<T>},
             {"rotg_batched", testing_rotg_batched<T>},
             {"rotg_strided_batched", testing_rotg_strided_batched<T>},
@@ -589,6 +714,7 @@ struct perf_blas<
             {"gemv", testing_gemv<T>},
             {"gemv_batched", testing_gemv_batched<T>},
             {"gemv_strided_batched", testing_gemv_strided_batched<T>},
+            {"gemv_vbatched", testing_gemv_vbatched<T>},
             {"gbmv", testing_gbmv<T>},
             {"gbmv_batched", testing_gbmv_batched<T>},
             {"gbmv_strided_batched", testing_gbmv_strided_batched<T>},
@@ -643,6 +769,18 @@ struct perf_blas<
             {"tpsv", testing_tpsv<T>},
             {"tpsv_batched", testing_tpsv_batched<T>},
             {"tpsv_strided_batched", testing_tpsv_strided_batched<T>},
+            {"tpttr", testing_tpttr<T>},
+            {"tpttr_batched", testing_tpttr_batched<T>},
+            {"tpttr_strided_batched", testing_tpttr_strided_batched<T>},
+            {"trttp", testing_trttp<T>},
+            {"trttp_batched", testing_trttp_batched<T>},
+            {"trttp_strided_batched", testing_trttp_strided_batched<T>},
+            {"gbtge", testing_gbtge<T>},
+            {"gbtge_batched", testing_gbtge_batched<T>},
+            {"gbtge_strided_batched", testing_gbtge_strided_batched<T>},
+            {"getgb", testing_getgb<T>},
+            {"getgb_batched", testing_getgb_batched<T>},
+            {"getgb_strided_batched", testing_getgb_strided_batched<T>},
             {"trmv", testing_trmv<T>},
             {"trmv_batched", testing_trmv_batched<T>},
             {"trmv_strided_batched", testing_trmv_strided_batched<T>},
@@ -660,6 +798,9 @@ struct perf_blas<
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm3m", testing_gemm3m<T>},
+            {"gemm3m_batched", testing_gemm3m_batched<T>},
+            {"gemm3m_strided_batched", testing_gemm3m_strided_batched<T>},
             {"hemm", testing_hemm<T>},
             {"hemm_batched", testing_hemm_batched<T>},
             {"hemm_strided_batched", testing_hemm_strided_batched<T>},
@@ -985,7 +1126,8 @@ int run_bench_test(Arguments& arg)
     if(!strncmp(function, prefix, sizeof(prefix) - 1))
         function += sizeof(prefix) - 1;
 
-    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
+    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched") || !strcmp(function, "gemm3m")
+       || !strcmp(function, "gemm3m_batched"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
@@ -1008,7 +1150,8 @@ int run_bench_test(Arguments& arg)
             arg.ldc = min_ldc;
         }
     }
-    else if(!strcmp(function, "gemm_strided_batched"))
+    else if(!strcmp(function, "gemm_strided_batched")
+            || !strcmp(function, "gemm3m_strided_batched"))
     {
         // adjust dimension for GEMM routines
         hipblas_int min_lda = arg.transA_option == 'N' ? arg.M : arg.K;
@@ -1153,12 +1296,512 @@ int run_bench_test(Arguments& arg)
         else if(!strcmp(function, "rot_ex") || !strcmp(function, "rot_batched_ex")
                 || !strcmp(function, "rot_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
+        else if(!strcmp(function, "syrk_ex") || !strcmp(function, "syrk_batched_ex")
+                || !strcmp(function, "syrk_strided_batched_ex"))
+            hipblas_syrk_ex_dispatch<perf_syrk_ex>(arg);
+        else if(!strcmp(function, "herk_ex") || !strcmp(function, "herk_batched_ex")
+                || !strcmp(function, "herk_strided_batched_ex"))
+            hipblas_syrk_ex_dispatch<perf_herk_ex>(arg);
         else
             hipblas_simple_dispatch<perf_blas>(arg);
     }
     return 0;
 }
 
+/* ============================================================================================ */
+/*  memory footprint of a single case                                                          */
+
+static size_t hipblas_device_used_bytes()
+{
+    size_t free_bytes = 0, total_bytes = 0;
+    if(hipMemGetInfo(&free_bytes, &total_bytes) != hipSuccess)
+        return 0;
+    return total_bytes - free_bytes;
+}
+
+// Resident set size of the process, 0 where /proc is not available
+static size_t hipblas_host_resident_bytes()
+{
+#ifdef WIN32
+    return 0;
+#else
+    size_t pages = 0, resident = 0;
+    FILE*  statm = fopen("/proc/self/statm", "r");
+    if(!statm)
+        return 0;
+    if(fscanf(statm, "%zu %zu", &pages, &resident) != 2)
+        resident = 0;
+    fclose(statm);
+    return resident * size_t(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+// Run one case reporting operand bytes (tracked by d_vector), the peak device memory in use and
+// the workspace held by the backend (hipMemGetInfo deltas sampled at every get_time_us_sync),
+// and the growth of resident host memory. Cases above mem_limit_mib of device memory fail.
+// Without a limit or a report the case runs unsampled.
+int run_bench_measured(Arguments& arg, double mem_limit_mib, bool report)
+{
+    if(mem_limit_mib <= 0 && !report)
+        return run_bench_test(arg);
+
+    ArgumentLogging::memory_record mem;
+    hipblas_bench_thread_context&  ctx = hipblas_bench_context();
+    hipblas_device_cache&          ops = hipblas_device_cache::instance();
+
+    ops.reset_peak();
+    size_t device_base = hipblas_device_used_bytes();
+    size_t host_base   = hipblas_host_resident_bytes();
+
+    // device memory is not sampled during a call, but workspace obtained through
+    // hipblasDemandAlloc stays with the handle and is seen by the sample after the call
+    ctx.on_time_sample = [&] {
+        double device   = double(hipblas_device_used_bytes()) - device_base;
+        double operands = double(ops.live_bytes());
+        double host     = double(hipblas_host_resident_bytes()) - host_base;
+
+        mem.operand_bytes   = std::max(mem.operand_bytes, double(ops.peak_bytes()));
+        mem.device_bytes    = std::max(mem.device_bytes, device);
+        mem.workspace_bytes = std::max(mem.workspace_bytes, device - operands);
+        mem.host_bytes      = std::max(mem.host_bytes, host);
+    };
+    ArgumentLogging::memory_sink() = &mem;
+
+    int ret;
+    try
+    {
+        ret = run_bench_test(arg);
+    }
+    catch(...)
+    {
+        ArgumentLogging::memory_sink() = nullptr;
+        ctx.on_time_sample             = nullptr;
+        throw;
+    }
+    ArgumentLogging::memory_sink() = nullptr;
+    ctx.on_time_sample             = nullptr;
+
+    double device_mib = mem.device_bytes / (1024.0 * 1024.0);
+    if(mem_limit_mib > 0 && device_mib > mem_limit_mib)
+    {
+        std::cerr << "hipblas-bench ERROR: " << arg.function << " used " << device_mib
+                  << " MiB of device memory, above --mem_limit " << mem_limit_mib << " MiB"
+                  << std::endl;
+        return -1;
+    }
+    return ret;
+}
+
+/* ============================================================================================ */
+/*  concurrency mode: several host threads replay the same problem at the same time            */
+
+// Releases every thread once all of them have arrived
+class hipblas_start_latch
+{
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    int                     m_pending;
+
+public:
+    explicit hipblas_start_latch(int count)
+        : m_pending(count)
+    {
+    }
+
+    void arrive()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(--m_pending == 0)
+            m_cv.notify_all();
+    }
+
+    void arrive_and_wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(--m_pending == 0)
+            m_cv.notify_all();
+        else
+            m_cv.wait(lock, [this] { return m_pending == 0; });
+    }
+};
+
+struct hipblas_thread_result
+{
+    Arguments                    arg;
+    ArgumentLogging::perf_record rec;
+    double                       start_us = 0;
+    std::vector<double>          call_us;
+    std::exception_ptr           error;
+};
+
+static double hipblas_wall_us()
+{
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Run arg.function from n_threads threads. Set-up (allocation and initialization) is serialized
+// so the host random generators are not shared; the timed loops start together behind a latch.
+// An event is recorded on the stream before every timed call and once more before the final
+// synchronization, so consecutive events give the latency of each call.
+std::vector<hipblas_thread_result> run_bench_threads(const Arguments&                arg,
+                                                     int                             n_threads,
+                                                     hipblasHandle_t                 shared_handle,
+                                                     const std::vector<hipStream_t>& streams)
+{
+    std::vector<hipblas_thread_result> results(n_threads);
+    std::vector<std::thread>           workers;
+    std::mutex                         setup_mutex;
+    hipblas_start_latch                latch(n_threads);
+
+    for(int t = 0; t < n_threads; t++)
+    {
+        workers.emplace_back([&, t] {
+            hipblas_thread_result&        res = results[t];
+            hipblas_bench_thread_context& ctx = hipblas_bench_context();
+            std::unique_lock<std::mutex>  setup(setup_mutex);
+            bool                          arrived = false;
+            std::vector<hipEvent_t>       marks(std::max(arg.iters, 0) + 2);
+            size_t                        n_marks = 0;
+
+            for(auto& event : marks)
+                CHECK_HIP_ERROR(hipEventCreate(&event));
+
+            ctx.handle          = shared_handle;
+            ctx.stream          = streams.empty() ? nullptr : streams[t % streams.size()];
+            ctx.on_timing_start = [&] {
+                setup.unlock();
+                latch.arrive_and_wait();
+                arrived      = true;
+                res.start_us = hipblas_wall_us();
+            };
+            ctx.on_call_mark = [&](hipStream_t stream) {
+                if(arrived && n_marks < marks.size())
+                    CHECK_HIP_ERROR(hipEventRecord(marks[n_marks++], stream));
+            };
+            ArgumentLogging::perf_sink() = &res.rec;
+
+            res.arg = arg;
+            try
+            {
+                run_bench_test(res.arg);
+            }
+            catch(...)
+            {
+                res.error = std::current_exception();
+            }
+
+            ArgumentLogging::perf_sink() = nullptr;
+            ctx                          = hipblas_bench_thread_context{};
+            if(setup.owns_lock())
+                setup.unlock();
+            if(!arrived)
+                latch.arrive();
+
+            // the last mark is the final synchronization, the first hot_calls intervals are calls
+            size_t n_calls = res.rec.valid ? size_t(res.rec.hot_calls) : 0;
+            if(n_marks > 0)
+                CHECK_HIP_ERROR(hipEventSynchronize(marks[n_marks - 1]));
+            for(size_t i = 0; i + 1 < n_marks && i < n_calls; i++)
+            {
+                float ms = 0;
+                CHECK_HIP_ERROR(hipEventElapsedTime(&ms, marks[i], marks[i + 1]));
+                res.call_us.push_back(ms * 1e3);
+            }
+            for(auto event : marks)
+                CHECK_HIP_ERROR(hipEventDestroy(event));
+        });
+    }
+
+    for(auto& w : workers)
+        w.join();
+
+    for(auto& res : results)
+        if(res.error)
+            std::rethrow_exception(res.error);
+
+    return results;
+}
+
+int run_bench_concurrent(Arguments& arg, const hipblas_concurrency_options& opt)
+{
+    if(opt.handles != "per-thread" && opt.handles != "shared")
+        throw std::invalid_argument("Invalid value for --handles " + opt.handles);
+    if(opt.handles == "shared" && opt.streams > 1)
+        throw std::invalid_argument(
+            "--streams > 1 requires --handles per-thread, a shared handle has a single stream");
+
+    if(arg.norm_check)
+    {
+        std::cout << "hipblas-bench INFO: verification is disabled with --threads" << std::endl;
+        arg.norm_check = 0;
+    }
+
+    hipblasHandle_t shared_handle = nullptr;
+    if(opt.handles == "shared")
+        CHECK_HIPBLAS_ERROR(hipblasCreate(&shared_handle));
+
+    std::vector<hipStream_t> streams;
+    if(opt.streams > 1)
+    {
+        streams.resize(opt.streams);
+        for(auto& stream : streams)
+            CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    }
+
+    // single thread on a single stream is the reference for scaling efficiency
+    auto baseline = run_bench_threads(arg, 1, shared_handle, {});
+    auto results  = run_bench_threads(baseline[0].arg, opt.threads, shared_handle, streams);
+
+    for(auto stream : streams)
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    if(shared_handle)
+        CHECK_HIPBLAS_ERROR(hipblasDestroy(shared_handle));
+
+    const ArgumentLogging::perf_record& base = baseline[0].rec;
+    if(!base.valid)
+    {
+        std::cout << "hipblas-bench INFO: " << arg.function
+                  << " reported no timing, nothing to aggregate" << std::endl;
+        return 0;
+    }
+
+    // percentiles are over every timed call of every thread; a thread whose tester records no
+    // per-call marks contributes its mean latency for each of its calls
+    std::vector<double> latency_us;
+    size_t              n_threads   = 0;
+    double              first_start = 0, last_end = 0, calls = 0, gflop = 0, gbyte = 0;
+    for(const auto& res : results)
+    {
+        if(!res.rec.valid)
+            continue;
+        double n   = double(res.rec.hot_calls) * res.rec.batch_count;
+        double end = res.start_us + res.rec.gpu_us;
+
+        first_start = n_threads == 0 ? res.start_us : std::min(first_start, res.start_us);
+        last_end    = n_threads == 0 ? end : std::max(last_end, end);
+        if(!res.call_us.empty())
+            latency_us.insert(latency_us.end(), res.call_us.begin(), res.call_us.end());
+        else
+            latency_us.insert(
+                latency_us.end(), res.rec.hot_calls, res.rec.gpu_us / res.rec.hot_calls);
+        calls += res.rec.hot_calls;
+        gflop += res.rec.gflops * n;
+        gbyte += res.rec.gbytes * n;
+        n_threads++;
+    }
+    if(n_threads == 0)
+        return 0;
+
+    std::sort(latency_us.begin(), latency_us.end());
+    auto percentile = [&](double p) {
+        size_t i = size_t(p * (latency_us.size() - 1) + 0.5);
+        return latency_us[std::min(i, latency_us.size() - 1)];
+    };
+
+    double wall_us     = std::max(last_end - first_start, 1.0);
+    double base_us     = base.gpu_us / base.hot_calls;
+    double base_gflops = base.gflops * base.batch_count / base_us * 1e6;
+    double agg_gflops  = gflop / wall_us * 1e6;
+    double agg_GBps    = gbyte / wall_us * 1e6;
+    double agg_calls   = calls / wall_us * 1e6;
+    double base_calls  = 1e6 / base_us;
+    double efficiency  = agg_calls / (base_calls * n_threads);
+
+    std::cout << "threads,streams,handles,calls/s,hipblas-Gflops,hipblas-GB/s,"
+                 "us-p50,us-p90,us-p99,us-max,1-thread-us,1-thread-calls/s,1-thread-Gflops,"
+                 "scaling-efficiency\n"
+              << n_threads << ", " << (streams.empty() ? 1 : streams.size()) << ", "
+              << opt.handles << ", " << agg_calls << ", " << agg_gflops << ", " << agg_GBps
+              << ", " << percentile(0.5) << ", " << percentile(0.9) << ", " << percentile(0.99)
+              << ", " << latency_us.back() << ", " << base_us << ", " << base_calls << ", "
+              << base_gflops << ", " << efficiency << std::endl;
+
+    return 0;
+}
+
+/* ============================================================================================ */
+/*  sweep mode: one process walks a range of sizes and reports the throughput curve            */
+
+struct hipblas_sweep_point
+{
+    hipblas_int                  size;
+    Arguments                    arg;
+    ArgumentLogging::perf_record rec[2];
+};
+
+// Run one case and capture its timing instead of printing it
+ArgumentLogging::perf_record run_bench_record(const Arguments& arg)
+{
+    ArgumentLogging::perf_record rec;
+    Arguments                    a = arg;
+
+    ArgumentLogging::perf_sink() = &rec;
+    try
+    {
+        run_bench_test(a);
+    }
+    catch(...)
+    {
+        ArgumentLogging::perf_sink() = nullptr;
+        throw;
+    }
+    ArgumentLogging::perf_sink() = nullptr;
+    return rec;
+}
+
+// Problems (batch elements) completed per second, comparable between batched and looped calls
+static double hipblas_problems_per_sec(const ArgumentLogging::perf_record& rec)
+{
+    return rec.valid && rec.gpu_us > 0 ? rec.batch_count * rec.hot_calls / rec.gpu_us * 1e6 : 0;
+}
+
+static double hipblas_gflops(const ArgumentLogging::perf_record& rec)
+{
+    return hipblas_problems_per_sec(rec) * rec.gflops;
+}
+
+int run_bench_sweep(Arguments& arg, const hipblas_sweep_options& opt)
+{
+    bool sweep_m = false, sweep_n = false, sweep_k = false;
+    for(size_t pos = 0; pos <= opt.dims.size();)
+    {
+        size_t      comma = std::min(opt.dims.find(',', pos), opt.dims.size());
+        std::string dim   = opt.dims.substr(pos, comma - pos);
+        if(dim == "m" || dim == "M")
+            sweep_m = true;
+        else if(dim == "n" || dim == "N")
+            sweep_n = true;
+        else if(dim == "k" || dim == "K")
+            sweep_k = true;
+        else
+            throw std::invalid_argument("Invalid value for --sweep " + opt.dims);
+        pos = comma + 1;
+    }
+
+    bool geometric = opt.mode == "geometric";
+    if(!geometric && opt.mode != "linear")
+        throw std::invalid_argument("Invalid value for --sweep_mode " + opt.mode);
+    if(arg.start < (geometric ? 1 : 0) || arg.end < arg.start)
+        throw std::invalid_argument("Invalid range --start " + std::to_string(arg.start)
+                                    + " --end " + std::to_string(arg.end));
+    if(arg.step < (geometric ? 2 : 1))
+        throw std::invalid_argument("Invalid value for --step " + std::to_string(arg.step));
+
+    if(arg.norm_check)
+    {
+        std::cout << "hipblas-bench INFO: verification is disabled with --sweep" << std::endl;
+        arg.norm_check = 0;
+    }
+
+    std::vector<hipblas_sweep_point> points;
+    for(int64_t size = arg.start; size <= arg.end;
+        size         = geometric ? size * arg.step : size + arg.step)
+    {
+        hipblas_sweep_point p;
+        p.size = hipblas_int(size);
+        p.arg  = arg;
+        if(sweep_m)
+            p.arg.M = p.size;
+        if(sweep_n)
+            p.arg.N = p.size;
+        if(sweep_k)
+            p.arg.K = p.size;
+
+        // leading dimensions and strides follow the problem so every point is a packed case
+        hipblas_int ld = std::max({p.arg.M, p.arg.N, p.arg.K, 1});
+        p.arg.lda = p.arg.ldb = p.arg.ldc = p.arg.ldd = ld;
+        p.arg.stride_a = p.arg.stride_b = p.arg.stride_c = p.arg.stride_d = hipblasStride(ld) * ld;
+        p.arg.stride_x = hipblasStride(ld) * std::max(std::abs(arg.incx), 1);
+        p.arg.stride_y = hipblasStride(ld) * std::max(std::abs(arg.incy), 1);
+        points.push_back(p);
+    }
+
+    // Largest size first: the device buffers it allocates are cached and reused by the rest
+    hipblas_device_cache::instance().enable(true);
+    for(auto p = points.rbegin(); p != points.rend(); ++p)
+    {
+        p->rec[0] = run_bench_record(p->arg);
+        if(!opt.compare.empty())
+        {
+            Arguments cmp = p->arg;
+            snprintf(cmp.function, sizeof(cmp.function), "%s", opt.compare.c_str());
+            p->rec[1] = run_bench_record(cmp);
+        }
+    }
+    hipblas_device_cache::instance().enable(false);
+
+    const char* fn  = arg.function;
+    const char* cmp = opt.compare.c_str();
+    std::cout << "size,M,N,K,batch_count," << fn << "-Gflops," << fn << "-problems/s," << fn
+              << "-us";
+    if(*cmp)
+        std::cout << "," << cmp << "-Gflops," << cmp << "-problems/s," << cmp << "-us,"
+                  << cmp << "/" << fn;
+    std::cout << "\n";
+
+    for(const auto& p : points)
+    {
+        std::cout << p.size << ", " << p.arg.M << ", " << p.arg.N << ", " << p.arg.K << ", "
+                  << p.arg.batch_count;
+        for(int i = 0; i < (*cmp ? 2 : 1); i++)
+        {
+            const auto& rec = p.rec[i];
+            double      us  = rec.valid ? rec.gpu_us / rec.hot_calls : ArgumentLogging::NA_value;
+            std::cout << ", " << hipblas_gflops(rec) << ", " << hipblas_problems_per_sec(rec)
+                      << ", " << us;
+        }
+        if(*cmp)
+        {
+            double base = hipblas_problems_per_sec(p.rec[0]);
+            std::cout << ", "
+                      << (base > 0 ? hipblas_problems_per_sec(p.rec[1]) / base
+                                   : ArgumentLogging::NA_value);
+        }
+        std::cout << "\n";
+    }
+
+    // A crossover is a sign change of log(rate_cmp / rate_fn) between neighbouring sizes,
+    // located by linear interpolation in size (in log size for geometric sweeps)
+    if(*cmp)
+    {
+        int    crossovers = 0;
+        double prev_size  = 0, prev_ratio = 0;
+        bool   have_prev  = false;
+        for(const auto& p : points)
+        {
+            double a = hipblas_problems_per_sec(p.rec[0]);
+            double b = hipblas_problems_per_sec(p.rec[1]);
+            if(a <= 0 || b <= 0)
+            {
+                have_prev = false;
+                continue;
+            }
+
+            double ratio = std::log(b / a);
+            double size  = geometric ? std::log(double(p.size)) : double(p.size);
+            if(have_prev && (prev_ratio < 0) != (ratio < 0) && prev_ratio != ratio)
+            {
+                double x = prev_size + (size - prev_size) * (0 - prev_ratio) / (ratio - prev_ratio);
+                std::cout << "crossover: " << (ratio > 0 ? cmp : fn) << " overtakes "
+                          << (ratio > 0 ? fn : cmp) << " at size ~"
+                          << int64_t(geometric ? std::exp(x) : x) << std::endl;
+                crossovers++;
+            }
+            prev_size  = size;
+            prev_ratio = ratio;
+            have_prev  = true;
+        }
+        if(!crossovers)
+            std::cout << "crossover: none in [" << arg.start << ", " << arg.end << "]"
+                      << std::endl;
+    }
+    std::cout << std::flush;
+
+    return 0;
+}
+
 int hipblas_bench_datafile()
 {
     int ret = 0;
@@ -1184,11 +1827,8 @@ void fix_batch(int argc, char* argv[])
         }
 }
 
-int main(int argc, char* argv[])
-try
+bool hipblas_bench_parse(int argc, char* argv[], Arguments& arg, hipblas_bench_options& opt)
 {
-    fix_batch(argc, argv);
-    Arguments   arg;
     std::string function;
     std::string precision;
     std::string a_type;
@@ -1197,10 +1837,8 @@ try
     std::string d_type;
     std::string compute_type;
     std::string initialization;
-    hipblas_int device_id;
+    std::string sizes_file;
 
-    // TODO: currently hipblas_parse_data not implemented
-    bool datafile            = hipblas_parse_data(argc, argv);
     bool atomics_not_allowed = false;
 
     options_description desc("hipblas-bench command line options");
@@ -1356,6 +1994,12 @@ try
          value<hipblas_int>(&arg.batch_count)->default_value(1),
          "Number of matrices. Only applicable to batched and strided_batched routines")
 
+        ("sizes",
+         value<std::string>(&sizes_file),
+         "File of the sizes of the instances of variable size batched routines (vbatched), one "
+         "'m n [count]' line per shape; # starts a comment line. Overrides -m, -n, --lda and "
+         "--batch_count")
+
         ("verify,v",
          value<hipblas_int>(&arg.norm_check)->default_value(0),
          "Validate GPU results with CPU? 0 = No, 1 = Yes (default: No)")
@@ -1385,7 +2029,7 @@ try
          "Atomic operations with non-determinism in results are not allowed")
 
         ("device",
-         value<hipblas_int>(&device_id)->default_value(0),
+         value<hipblas_int>(&opt.device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
 
         // ("c_noalias_d",
@@ -1396,6 +2040,56 @@ try
          bool_switch(&arg.fortran)->default_value(false),
          "Run using Fortran interface")
 
+        ("mem_limit",
+         value<double>(&opt.mem_limit)->default_value(0),
+         "Device memory budget in MiB. A case whose peak device memory (operands and backend "
+         "workspace) exceeds it fails. 0 = no limit")
+
+        ("mem_report",
+         bool_switch(&opt.mem_report)->default_value(false),
+         "Report the operand, device peak, workspace and host memory of the case. Memory is "
+         "sampled at every timestamp, outside of the timed intervals")
+
+        ("threads",
+         value<hipblas_int>(&opt.concurrency.threads)->default_value(1),
+         "Number of host threads replaying the problem concurrently. With more than one thread "
+         "aggregate throughput, per-call latency percentiles and scaling efficiency against "
+         "a single thread are reported")
+
+        ("streams",
+         value<hipblas_int>(&opt.concurrency.streams)->default_value(1),
+         "Number of streams shared round-robin by the threads. Only applicable with --threads")
+
+        ("sweep",
+         value<std::string>(&opt.sweep.dims),
+         "Run a size sweep in a single process. Comma separated list of the dimensions set to "
+         "the swept size, e.g. m,n,k. Leading dimensions and strides follow the size")
+
+        ("start",
+         value<int>(&arg.start)->default_value(1024),
+         "First size of --sweep")
+
+        ("end",
+         value<int>(&arg.end)->default_value(10240),
+         "Last size of --sweep (inclusive)")
+
+        ("step",
+         value<int>(&arg.step)->default_value(1000),
+         "Increment of --sweep, or the multiplier with --sweep_mode geometric")
+
+        ("sweep_mode",
+         value<std::string>(&opt.sweep.mode)->default_value("linear"),
+         "linear = start, start + step, ..., geometric = start, start * step, ...")
+
+        ("sweep_compare",
+         value<std::string>(&opt.sweep.compare),
+         "Second function run at every size of --sweep; crossovers in problems/s are reported")
+
+        ("handles",
+         value<std::string>(&opt.concurrency.handles)->default_value("per-thread"),
+         "per-thread = each thread creates its own handle, shared = all threads use one handle. "
+         "Only applicable with --threads")
+
         ("help,h", "produces this help message");
 
         //("version", "Prints the version number");
@@ -1408,10 +2102,10 @@ try
     store(parse_command_line(argc, argv, desc), vm);
     notify(vm);
 
-    if((argc <= 1 && !datafile) || vm.count("help"))
+    if((argc <= 1 && !opt.datafile) || vm.count("help"))
     {
         std::cout << desc << std::endl;
-        return 0;
+        return false;
     }
 
     // if(vm.find("version") != vm.end())
@@ -1422,16 +2116,8 @@ try
     //     return 0;
     // }
 
-    // Device Query
-    hipblas_int device_count = query_device_property();
-
-    std::cout << std::endl;
-    if(device_count <= device_id)
-        throw std::invalid_argument("Invalid Device ID");
-    set_device(device_id);
-
-    if(datafile)
-        return hipblas_bench_datafile();
+    if(opt.datafile)
+        return true;
 
     std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
     auto prec = string2hipblas_datatype(precision);
@@ -1469,14 +2155,67 @@ try
     if(arg.K < 0)
         throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
 
+    if(opt.concurrency.threads < 1)
+        throw std::invalid_argument("Invalid value for --threads "
+                                    + std::to_string(opt.concurrency.threads));
+    if(opt.concurrency.streams < 1)
+        throw std::invalid_argument("Invalid value for --streams "
+                                    + std::to_string(opt.concurrency.streams));
+
     int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
-    return run_bench_test(arg);
+    copied = snprintf(arg.sizes_file, sizeof(arg.sizes_file), "%s", sizes_file.c_str());
+    if(copied < 0 || copied >= sizeof(arg.sizes_file))
+        throw std::invalid_argument("Invalid value for --sizes");
+
+    if(opt.sweep.compare.size() >= sizeof(arg.function))
+        throw std::invalid_argument("Invalid value for --sweep_compare");
+    if(!opt.sweep.dims.empty() && opt.concurrency.threads > 1)
+        throw std::invalid_argument("--sweep can not be combined with --threads");
+
+    return true;
+}
+
+#ifndef HIPBLAS_REPLAY
+
+int main(int argc, char* argv[])
+try
+{
+    fix_batch(argc, argv);
+    Arguments             arg;
+    hipblas_bench_options opt;
+
+    // TODO: currently hipblas_parse_data not implemented
+    opt.datafile = hipblas_parse_data(argc, argv);
+
+    if(!hipblas_bench_parse(argc, argv, arg, opt))
+        return 0;
+
+    // Device Query
+    hipblas_int device_count = query_device_property();
+
+    std::cout << std::endl;
+    if(device_count <= opt.device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(opt.device_id);
+
+    if(opt.datafile)
+        return hipblas_bench_datafile();
+
+    if(!opt.sweep.dims.empty())
+        return run_bench_sweep(arg, opt.sweep);
+
+    if(opt.concurrency.threads > 1)
+        return run_bench_concurrent(arg, opt.concurrency);
+
+    return run_bench_measured(arg, opt.mem_limit, opt.mem_report);
 }
 catch(const std::invalid_argument& exp)
 {
     std::cerr << exp.what() << std::endl;
     return -1;
 }
+
+#endif // HIPBLAS_REPLAY
@@ -0,0 +1,48 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifndef _HIPBLAS_BENCH_HPP_
+#define _HIPBLAS_BENCH_HPP_
+
+#include "argument_model.hpp"
+#include "hipblas_arguments.hpp"
+#include <string>
+
+// Concurrency mode: several host threads replay the same problem at the same time
+struct hipblas_concurrency_options
+{
+    int         threads = 1;
+    int         streams = 1;
+    std::string handles = "per-thread"; // per-thread or shared
+};
+
+// Sweep mode: one process walks a range of sizes and reports the throughput curve
+struct hipblas_sweep_options
+{
+    std::string dims; // comma separated subset of m,n,k following the swept size
+    std::string mode = "linear"; // linear or geometric
+    std::string compare; // optional second function run at every size
+};
+
+// Command line options of hipblas-bench which are not part of Arguments
+struct hipblas_bench_options
+{
+    bool                        datafile   = false;
+    int                         device_id  = 0;
+    double                      mem_limit  = 0; // MiB of device memory, 0 = no limit
+    bool                        mem_report = false; // report the memory footprint of the case
+    hipblas_concurrency_options concurrency;
+    hipblas_sweep_options       sweep;
+};
+
+// Parse a hipblas-bench command line. Returns false when only the help message was requested.
+bool hipblas_bench_parse(int argc, char* argv[], Arguments& arg, hipblas_bench_options& opt);
+
+// Run the case described by arg, printing its results
+int run_bench_test(Arguments& arg);
+
+// Run the case described by arg and return its timing instead of printing it
+ArgumentLogging::perf_record run_bench_record(const Arguments& arg);
+
+#endif
@@ -0,0 +1,442 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+// hipblas-replay: replays a call log, one hipblas-bench argument line per call, in order on a
+// single stream. Every distinct argument line (shape) goes once through the hipblas-bench
+// dispatch on its own thread, which allocates and initializes the operands and then issues one
+// call each time the sequencer hands it the next turn, so only the calls themselves are timed.
+
+#include "program_options.hpp"
+
+#include "hipblas.hpp"
+
+#include "hipblas_bench.hpp"
+#include "utility.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+using namespace std::literals; // For std::string literals of form "str"s
+
+struct replay_call
+{
+    int         line;
+    std::string signature; // the argument line with normalized white space
+    Arguments   arg;
+    size_t      shape = 0; // index of the distinct signature
+};
+
+struct replay_total
+{
+    size_t calls  = 0;
+    double gpu_us = 0;
+};
+
+// Split an argument line on white space, keeping quoted strings together
+static std::vector<std::string> replay_tokenize(const std::string& line)
+{
+    std::vector<std::string> tokens;
+    std::string              token;
+    char                     quote  = 0;
+    bool                     in_tok = false;
+
+    for(char c : line)
+    {
+        if(quote)
+        {
+            if(c == quote)
+                quote = 0;
+            else
+                token += c;
+        }
+        else if(c == '"' || c == '\'')
+        {
+            quote  = c;
+            in_tok = true;
+        }
+        else if(isspace(static_cast<unsigned char>(c)))
+        {
+            if(in_tok)
+                tokens.push_back(token);
+            token.clear();
+            in_tok = false;
+        }
+        else
+        {
+            token += c;
+            in_tok = true;
+        }
+    }
+    if(quote)
+        throw std::invalid_argument("unterminated quote");
+    if(in_tok)
+        tokens.push_back(token);
+    return tokens;
+}
+
+static std::vector<replay_call> replay_read_log(const std::string& file)
+{
+    std::ifstream log(file);
+    if(!log)
+        throw std::invalid_argument("Unable to open call log " + file);
+
+    std::vector<replay_call> calls;
+    std::string              line;
+    for(int line_no = 1; std::getline(log, line); line_no++)
+    {
+        auto tokens = replay_tokenize(line);
+        if(tokens.empty() || tokens[0][0] == '#')
+            continue;
+
+        // the log may keep the program name of the captured command line
+        if(tokens[0][0] != '-')
+            tokens.erase(tokens.begin());
+
+        std::string              signature;
+        std::vector<std::string> args{"hipblas-bench"};
+        for(auto& tok : tokens)
+        {
+            signature += (signature.empty() ? "" : " ") + tok;
+            args.push_back(tok);
+        }
+
+        std::vector<char*> argv;
+        for(auto& a : args)
+            argv.push_back(&a[0]);
+        argv.push_back(nullptr);
+
+        replay_call           call{line_no, signature, Arguments{}};
+        hipblas_bench_options opt;
+        if(tokens.empty() || !hipblas_bench_parse(int(args.size()), argv.data(), call.arg, opt))
+            throw std::invalid_argument(file + ":" + std::to_string(line_no)
+                                        + ": not a hipblas-bench argument line");
+        if(opt.concurrency.threads > 1 || !opt.sweep.dims.empty())
+            std::cerr << "hipblas-replay warning: " << file << ":" << line_no
+                      << ": --threads and --sweep are ignored" << std::endl;
+
+        // each line is one call
+        call.arg.cold_iters = 0;
+        call.arg.iters      = 1;
+        call.arg.norm_check = 0;
+        calls.push_back(call);
+    }
+    return calls;
+}
+
+// One tester per shape runs on its own thread with iters set to every use of the shape. The
+// thread stops at each timed call (hipblas_bench_mark_call) until the sequencer grants it the
+// turn, so the calls of all shapes reach the stream in log order.
+class replay_sequencer
+{
+    static constexpr size_t none = size_t(-1);
+
+    struct shape_state
+    {
+        size_t remaining = 0; // calls still to issue
+        bool   ready     = false; // set-up done, or the tester returned
+        bool   finished  = false; // the tester returned
+    };
+
+    std::mutex               m_mutex;
+    std::condition_variable  m_cv;
+    std::vector<shape_state> m_shapes;
+    size_t                   m_granted = none; // shape allowed to issue one call
+    bool                     m_issuing = false; // the granted shape is issuing its call
+
+public:
+    explicit replay_sequencer(const std::vector<size_t>& uses)
+        : m_shapes(uses.size())
+    {
+        for(size_t s = 0; s < uses.size(); s++)
+            m_shapes[s].remaining = uses[s];
+    }
+
+    // worker side: the timed loop of shape s has been reached
+    void arrive(size_t s)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shapes[s].ready = true;
+        m_cv.notify_all();
+    }
+
+    // worker side: the previous call of shape s, if any, is on the stream; wait for the next turn
+    void mark(size_t s)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(m_granted == s && m_issuing)
+        {
+            m_granted = none;
+            m_issuing = false;
+            m_cv.notify_all();
+        }
+        if(m_shapes[s].remaining == 0)
+            return;
+        m_cv.wait(lock, [&] { return m_granted == s; });
+        m_issuing = true;
+        m_shapes[s].remaining--;
+    }
+
+    // worker side: the tester of shape s returned, normally or not
+    void finish(size_t s)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shapes[s].ready    = true;
+        m_shapes[s].finished = true;
+        if(m_granted == s)
+        {
+            m_granted = none;
+            m_issuing = false;
+        }
+        m_cv.notify_all();
+    }
+
+    void wait_ready(size_t s)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [&] { return m_shapes[s].ready; });
+    }
+
+    // sequencer side: let shape s issue one call and wait until it is on the stream; false when
+    // the tester of s has returned and issues no more calls
+    bool issue(size_t s)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(m_shapes[s].finished)
+            return false;
+        m_granted = s;
+        m_cv.notify_all();
+        m_cv.wait(lock, [&] { return m_granted == none; });
+        return true;
+    }
+};
+
+template <typename Key>
+static void replay_print_totals(const char*                               title,
+                                std::vector<std::pair<Key, replay_total>> totals,
+                                double                                    gpu_us,
+                                size_t                                    top)
+{
+    std::sort(totals.begin(), totals.end(), [](const auto& a, const auto& b) {
+        return a.second.gpu_us > b.second.gpu_us;
+    });
+    if(totals.size() > top)
+        totals.resize(top);
+
+    std::cout << "\n" << title << ",calls,hipblas-us,avg-us,share-%\n";
+    for(const auto& t : totals)
+        std::cout << t.first << ", " << t.second.calls << ", " << t.second.gpu_us << ", "
+                  << t.second.gpu_us / t.second.calls << ", "
+                  << (gpu_us > 0 ? 100 * t.second.gpu_us / gpu_us : 0) << "\n";
+}
+
+int main(int argc, char* argv[])
+try
+{
+    std::string log_file;
+    int         top;
+    int         warmup;
+    int         device_id;
+
+    options_description desc("hipblas-replay command line options");
+
+    // clang-format off
+    desc.add_options()
+
+        ("log",
+         value<std::string>(&log_file),
+         "Call log to replay: one hipblas-bench argument line per call, # starts a comment")
+
+        ("top",
+         value<int>(&top)->default_value(10),
+         "Number of most expensive call signatures to report")
+
+        ("warmup",
+         value<int>(&warmup)->default_value(1),
+         "Unmeasured passes over the log before the measured one. The operands of every distinct "
+         "argument line stay allocated for the whole replay")
+
+        ("device",
+         value<int>(&device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs")
+
+        ("help,h", "produces this help message");
+
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(argc <= 1 || vm.count("help") || log_file.empty())
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+    if(top < 0 || warmup < 0)
+        throw std::invalid_argument("Invalid value for --top or --warmup");
+
+    auto calls = replay_read_log(log_file);
+
+    // Device Query
+    int device_count = query_device_property();
+
+    std::cout << std::endl;
+    if(device_count <= device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(device_id);
+
+    // Every shape is set up once: its operands are allocated and initialized before the
+    // sequence starts, and each call of the log is one timed call of the shape's tester
+    std::map<std::string, size_t> shape_of;
+    std::vector<Arguments>        shapes;
+    std::vector<size_t>           uses;
+    for(auto& call : calls)
+    {
+        auto it = shape_of.emplace(call.signature, shapes.size()).first;
+        if(it->second == shapes.size())
+        {
+            shapes.push_back(call.arg);
+            uses.push_back(0);
+        }
+        call.shape = it->second;
+        uses[call.shape] += warmup + 1;
+    }
+
+    // One stream for the whole sequence; each tester binds its own handle to it, so the handle
+    // state set up by one shape (pointer mode and the like) does not leak into another
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    replay_sequencer                sequencer(uses);
+    std::vector<std::thread>        workers;
+    std::vector<std::exception_ptr> errors(shapes.size());
+
+    // the host random generators are not shared, set-up runs one shape at a time
+    for(size_t s = 0; s < shapes.size(); s++)
+    {
+        workers.emplace_back([&, s] {
+            hipblas_bench_thread_context& ctx     = hipblas_bench_context();
+            bool                          arrived = false;
+
+            ctx.stream          = stream;
+            ctx.on_timing_start = [&] {
+                arrived = true;
+                sequencer.arrive(s);
+            };
+            ctx.on_call_mark = [&](hipStream_t) {
+                if(arrived)
+                    sequencer.mark(s);
+            };
+
+            Arguments arg  = shapes[s];
+            arg.cold_iters = 0;
+            arg.iters      = int(uses[s]);
+            try
+            {
+                run_bench_record(arg);
+            }
+            catch(...)
+            {
+                errors[s] = std::current_exception();
+            }
+            ctx = hipblas_bench_thread_context{};
+            sequencer.finish(s);
+        });
+        sequencer.wait_ready(s);
+    }
+
+    // events on the stream between consecutive calls of the measured pass time each call
+    std::vector<hipEvent_t> marks(calls.size() + 1);
+    for(auto& event : marks)
+        CHECK_HIP_ERROR(hipEventCreate(&event));
+
+    for(int pass = 0; pass < warmup; pass++)
+        for(const auto& call : calls)
+            sequencer.issue(call.shape);
+
+    std::vector<bool> issued(calls.size());
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    auto start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < calls.size(); i++)
+    {
+        CHECK_HIP_ERROR(hipEventRecord(marks[i], stream));
+        issued[i] = sequencer.issue(calls[i].shape);
+    }
+    CHECK_HIP_ERROR(hipEventRecord(marks.back(), stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    double wall_us
+        = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start)
+              .count();
+
+    for(auto& w : workers)
+        w.join();
+    for(auto& error : errors)
+        if(error)
+            std::rethrow_exception(error);
+
+    std::map<std::string, replay_total> routines, signatures;
+    double                              gpu_us = 0;
+
+    for(size_t i = 0; i < calls.size(); i++)
+    {
+        if(!issued[i])
+            continue;
+
+        float ms = 0;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, marks[i], marks[i + 1]));
+        double call_us = ms * 1e3;
+
+        const char* function = calls[i].arg.function;
+        if(!strncmp(function, "testing_", 8))
+            function += 8;
+
+        for(auto* total : {&routines[function], &signatures[calls[i].signature]})
+        {
+            total->calls++;
+            total->gpu_us += call_us;
+        }
+        gpu_us += call_us;
+    }
+
+    for(auto event : marks)
+        CHECK_HIP_ERROR(hipEventDestroy(event));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    std::cout << "calls,routines,signatures,hipblas-us,wall-us\n"
+              << calls.size() << ", " << routines.size() << ", " << signatures.size() << ", "
+              << gpu_us << ", " << wall_us << std::endl;
+
+    replay_print_totals("routine",
+                        std::vector<std::pair<std::string, replay_total>>(routines.begin(),
+                                                                          routines.end()),
+                        gpu_us,
+                        routines.size());
+    replay_print_totals("signature",
+                        std::vector<std::pair<std::string, replay_total>>(signatures.begin(),
+                                                                          signatures.end()),
+                        gpu_us,
+                        size_t(top));
+    std::cout << std::flush;
+
+    return 0;
+}
+catch(const std::invalid_argument& exp)
+{
+    std::cerr << exp.what() << std::endl;
+    return -1;
+}
@@ -6,10 +6,14 @@
 #include "cblas_interface.h"
 #include "cblas.h"
 #include "hipblas.h"
+#include "hipblas_thread_pool.hpp"
+#include "syrkx_reference.hpp"
 #include "utility.h"
+#include <algorithm>
 #include <cmath>
 #include <memory>
 #include <typeinfo>
+#include <vector>
 
 /*!\file
  * \brief provide template functions interfaces to CBLAS C89 interfaces, it is only used for testing
@@ -89,6 +93,26 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void stpttr_(char* uplo, int* n, const float* AP, float* A, int* lda, int* info);
+void dtpttr_(char* uplo, int* n, const double* AP, double* A, int* lda, int* info);
+void ctpttr_(char* uplo, int* n, const hipblasComplex* AP, hipblasComplex* A, int* lda, int* info);
+void ztpttr_(char*                       uplo,
+             int*                        n,
+             const hipblasDoubleComplex* AP,
+             hipblasDoubleComplex*       A,
+             int*                        lda,
+             int*                        info);
+
+void strttp_(char* uplo, int* n, const float* A, int* lda, float* AP, int* info);
+void dtrttp_(char* uplo, int* n, const double* A, int* lda, double* AP, int* info);
+void ctrttp_(char* uplo, int* n, const hipblasComplex* A, int* lda, hipblasComplex* AP, int* info);
+void ztrttp_(char*                       uplo,
+             int*                        n,
+             const hipblasDoubleComplex* A,
+             int*                        lda,
+             hipblasDoubleComplex*       AP,
+             int*                        info);
+
 void cspr_(
     char* uplo, int* n, hipblasComplex* alpha, hipblasComplex* x, int* incx, hipblasComplex* A);
 
@@ -142,55 +166,372 @@ void zsymv_(char*                 uplo,
 
 /*
  * ===========================================================================
- *    level 1 BLAS
+ *    half and bfloat16 support
+ *
+ *    cblas has no half or bfloat16 routines, so these are evaluated in float. The operands are
+ *    converted in fixed-size panels (8 wide with F16C, 16 wide with AVX-512 when the host has
+ *    it) instead of being copied to full-size float arrays.
  * ===========================================================================
  */
 
-// axpy
-template <>
-void cblas_axpy<hipblasHalf, hipblasHalf>(
-    int n, const hipblasHalf alpha, const hipblasHalf* x, int incx, hipblasHalf* y, int incy)
+namespace
 {
-    size_t             abs_incx = incx >= 0 ? incx : -incx;
-    size_t             abs_incy = incy >= 0 ? incy : -incy;
-    std::vector<float> x_float(n * abs_incx);
-    std::vector<float> y_float(n * abs_incy);
+#if defined(__GNUC__) && defined(__x86_64__)
+#define HIPBLAS_CBLAS_CPU_DISPATCH
+    bool host_has_avx512()
+    {
+        static const bool avx512 = __builtin_cpu_supports("avx512f");
+        return avx512;
+    }
 
-    for(size_t i = 0; i < n; i++)
+    // The AVX-512 loops return the number of elements converted; the caller does the remainder
+    __attribute__((target("avx512f"))) size_t
+        half_to_float_avx512(const hipblasHalf* src, float* dst, size_t n)
     {
-        x_float[i * abs_incx] = half_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = half_to_float(y[i * abs_incy]);
+        size_t i = 0;
+        for(; i + 16 <= n; i += 16)
+            _mm512_storeu_ps(dst + i,
+                             _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)(src + i))));
+        return i;
     }
 
-    cblas_saxpy(n, half_to_float(alpha), x_float.data(), incx, y_float.data(), incy);
+    __attribute__((target("avx512f"))) size_t
+        float_to_half_avx512(const float* src, hipblasHalf* dst, size_t n)
+    {
+        size_t i = 0;
+        for(; i + 16 <= n; i += 16)
+            _mm256_storeu_si256((__m256i*)(dst + i), _mm512_cvtps_ph(_mm512_loadu_ps(src + i), 0));
+        return i;
+    }
 
-    for(size_t i = 0; i < n; i++)
+    __attribute__((target("avx512f"))) size_t
+        bfloat16_to_float_avx512(const hipblasBfloat16* src, float* dst, size_t n)
     {
-        y[i * abs_incy] = float_to_half(y_float[i * abs_incy]);
+        size_t i = 0;
+        for(; i + 16 <= n; i += 16)
+        {
+            __m512i v = _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)(src + i)));
+            _mm512_storeu_ps(dst + i, _mm512_castsi512_ps(_mm512_slli_epi32(v, 16)));
+        }
+        return i;
     }
-}
+#endif
 
-template <>
-void cblas_axpy<float, hipblasHalf>(
-    int n, const float alpha, const hipblasHalf* x, int incx, hipblasHalf* y, int incy)
-{
-    size_t             abs_incx = incx >= 0 ? incx : -incx;
-    size_t             abs_incy = incy >= 0 ? incy : -incy;
-    std::vector<float> x_float(n * abs_incx);
-    std::vector<float> y_float(n * abs_incy);
+    inline float to_float(hipblasHalf x)
+    {
+        return half_to_float(x);
+    }
+
+    inline float to_float(hipblasBfloat16 x)
+    {
+        return bfloat16_to_float(x);
+    }
+
+    inline void from_float(float x, hipblasHalf& y)
+    {
+        y = float_to_half(x);
+    }
+
+    inline void from_float(float x, hipblasBfloat16& y)
+    {
+        y = float_to_bfloat16(x);
+    }
+
+    // Convert n contiguous elements
+    void to_float_n(const hipblasHalf* src, float* dst, size_t n)
+    {
+        size_t i = 0;
+#ifdef HIPBLAS_CBLAS_CPU_DISPATCH
+        if(host_has_avx512())
+            i = half_to_float_avx512(src, dst, n);
+#endif
+#ifdef __F16C__
+        for(; i + 8 <= n; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+#endif
+        for(; i < n; i++)
+            dst[i] = half_to_float(src[i]);
+    }
+
+    void to_float_n(const hipblasBfloat16* src, float* dst, size_t n)
+    {
+        size_t i = 0;
+#ifdef HIPBLAS_CBLAS_CPU_DISPATCH
+        if(host_has_avx512())
+            i = bfloat16_to_float_avx512(src, dst, n);
+#endif
+        // a bfloat16 is the upper half of a float: interleave with zero low halves
+        const __m128i zero = _mm_setzero_si128();
+        for(; i + 8 <= n; i += 8)
+        {
+            __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+            _mm_storeu_ps(dst + i, _mm_castsi128_ps(_mm_unpacklo_epi16(zero, v)));
+            _mm_storeu_ps(dst + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(zero, v)));
+        }
+        for(; i < n; i++)
+            dst[i] = bfloat16_to_float(src[i]);
+    }
+
+    void from_float_n(const float* src, hipblasHalf* dst, size_t n)
+    {
+        size_t i = 0;
+#ifdef HIPBLAS_CBLAS_CPU_DISPATCH
+        if(host_has_avx512())
+            i = float_to_half_avx512(src, dst, n);
+#endif
+#ifdef __F16C__
+        for(; i + 8 <= n; i += 8)
+            _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), 0));
+#endif
+        for(; i < n; i++)
+            dst[i] = float_to_half(src[i]);
+    }
 
-    for(size_t i = 0; i < n; i++)
+    void from_float_n(const float* src, hipblasBfloat16* dst, size_t n)
     {
-        x_float[i * abs_incx] = half_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = half_to_float(y[i * abs_incy]);
+        for(size_t i = 0; i < n; i++)
+            dst[i] = float_to_bfloat16(src[i]);
     }
 
-    cblas_saxpy(n, alpha, x_float.data(), incx, y_float.data(), incy);
+    /* ============================================================================================
+       Level 1: vectors are processed in panels of cvt_panel elements. Element i of a vector of
+       length n with increment inc follows the BLAS convention, so negative increments walk the
+       vector backwards. A vector with increment 0 occupies a single panel entry, which keeps its
+       float value from one panel to the next.
+    */
+    constexpr size_t cvt_panel = 1024;
 
-    for(size_t i = 0; i < n; i++)
+    inline size_t blas_index(size_t i, size_t n, int inc)
     {
-        y[i * abs_incy] = float_to_half(y_float[i * abs_incy]);
+        return inc >= 0 ? i * inc : (n - 1 - i) * size_t(-inc);
     }
+
+    // Load elements [first, first + len) of x into panel, returns the increment to use on panel
+    template <typename T>
+    int load_panel(const T* x, size_t n, int inc, size_t first, size_t len, float* panel)
+    {
+        if(inc == 0)
+        {
+            if(first == 0)
+                panel[0] = to_float(x[0]);
+        }
+        else if(inc == 1)
+            to_float_n(x + first, panel, len);
+        else
+            for(size_t i = 0; i < len; i++)
+                panel[i] = to_float(x[blas_index(first + i, n, inc)]);
+        return inc == 0 ? 0 : 1;
+    }
+
+    template <typename T>
+    void store_panel(const float* panel, T* x, size_t n, int inc, size_t first, size_t len)
+    {
+        if(inc == 0)
+            from_float(panel[0], x[0]);
+        else if(inc == 1)
+            from_float_n(panel, x + first, len);
+        else
+            for(size_t i = 0; i < len; i++)
+                from_float(panel[i], x[blas_index(first + i, n, inc)]);
+    }
+
+    template <typename T>
+    void panel_axpy(int n, float alpha, const T* x, int incx, T* y, int incy)
+    {
+        float x_panel[cvt_panel], y_panel[cvt_panel];
+        for(size_t first = 0; first < size_t(std::max(n, 0)); first += cvt_panel)
+        {
+            size_t len = std::min(cvt_panel, n - first);
+            int    px  = load_panel(x, n, incx, first, len, x_panel);
+            int    py  = load_panel(y, n, incy, first, len, y_panel);
+            cblas_saxpy(len, alpha, x_panel, px, y_panel, py);
+            store_panel(y_panel, y, n, incy, first, len);
+        }
+    }
+
+    template <typename T>
+    void panel_scal(int n, float alpha, T* x, int incx)
+    {
+        float x_panel[cvt_panel];
+        for(size_t first = 0; first < size_t(std::max(n, 0)); first += cvt_panel)
+        {
+            size_t len = std::min(cvt_panel, n - first);
+            int    px  = load_panel(x, n, incx, first, len, x_panel);
+            cblas_sscal(len, alpha, x_panel, px);
+            store_panel(x_panel, x, n, incx, first, len);
+        }
+    }
+
+    template <typename T>
+    float panel_dot(int n, const T* x, int incx, const T* y, int incy)
+    {
+        float x_panel[cvt_panel], y_panel[cvt_panel];
+        float sum = 0;
+        for(size_t first = 0; first < size_t(std::max(n, 0)); first += cvt_panel)
+        {
+            size_t len = std::min(cvt_panel, n - first);
+            int    px  = load_panel(x, n, incx, first, len, x_panel);
+            int    py  = load_panel(y, n, incy, first, len, y_panel);
+            sum += cblas_sdot(len, x_panel, px, y_panel, py);
+        }
+        return sum;
+    }
+
+    template <typename T>
+    float panel_nrm2(int n, const T* x, int incx)
+    {
+        float x_panel[cvt_panel];
+        float norm = 0;
+        for(size_t first = 0; first < size_t(std::max(n, 0)); first += cvt_panel)
+        {
+            size_t len = std::min(cvt_panel, n - first);
+            int    px  = load_panel(x, n, incx, first, len, x_panel);
+            norm       = std::hypot(norm, cblas_snrm2(len, x_panel, px));
+        }
+        return norm;
+    }
+
+    template <typename T>
+    void panel_rot(int n, T* x, int incx, T* y, int incy, float c, float s)
+    {
+        float x_panel[cvt_panel], y_panel[cvt_panel];
+        for(size_t first = 0; first < size_t(std::max(n, 0)); first += cvt_panel)
+        {
+            size_t len = std::min(cvt_panel, n - first);
+            int    px  = load_panel(x, n, incx, first, len, x_panel);
+            int    py  = load_panel(y, n, incy, first, len, y_panel);
+            cblas_srot(len, x_panel, px, y_panel, py, c, s);
+            store_panel(x_panel, x, n, incx, first, len);
+            store_panel(y_panel, y, n, incy, first, len);
+        }
+    }
+
+    /* ============================================================================================
+       gemm: blocked over gemm_mc x gemm_nc blocks of C, which stay in float across the k loop.
+       The matching blocks of A and B are converted into float panels, in their stored layout so
+       that every panel column is one contiguous conversion, and multiplied by cblas_sgemm.
+    */
+    constexpr size_t gemm_mc = 256;
+    constexpr size_t gemm_nc = 512;
+    constexpr size_t gemm_kc = 256;
+
+    // Convert rows [r0, r0 + rows) of columns [c0, c0 + cols) of A into panel, leading dim rows
+    template <typename T>
+    void gemm_panel(
+        const T* A, size_t lda, size_t r0, size_t c0, size_t rows, size_t cols, float* panel)
+    {
+        for(size_t j = 0; j < cols; j++)
+            to_float_n(A + r0 + (c0 + j) * lda, panel + j * rows, rows);
+    }
+
+    template <typename T>
+    void gemm_float_accumulate(hipblasOperation_t transA,
+                               hipblasOperation_t transB,
+                               int                m,
+                               int                n,
+                               int                k,
+                               float              alpha,
+                               const T*           A,
+                               size_t             lda,
+                               const T*           B,
+                               size_t             ldb,
+                               float              beta,
+                               T*                 C,
+                               size_t             ldc)
+    {
+        if(m <= 0 || n <= 0)
+            return;
+
+        // reused by every call on this thread
+        thread_local std::vector<float> Ap, Bp, Cp;
+        size_t mc_max = std::min(gemm_mc, size_t(m));
+        size_t nc_max = std::min(gemm_nc, size_t(n));
+        size_t kc_max = std::min(gemm_kc, size_t(std::max(k, 0)));
+        if(Ap.size() < mc_max * kc_max)
+            Ap.resize(mc_max * kc_max);
+        if(Bp.size() < kc_max * nc_max)
+            Bp.resize(kc_max * nc_max);
+        if(Cp.size() < mc_max * nc_max)
+            Cp.resize(mc_max * nc_max);
+
+        bool notransA = transA == HIPBLAS_OP_N;
+        bool notransB = transB == HIPBLAS_OP_N;
+
+        for(size_t jc = 0; jc < size_t(n); jc += gemm_nc)
+        {
+            size_t nc = std::min(gemm_nc, n - jc);
+            for(size_t ic = 0; ic < size_t(m); ic += gemm_mc)
+            {
+                size_t mc = std::min(gemm_mc, m - ic);
+
+                for(size_t j = 0; j < nc; j++)
+                {
+                    float* c = Cp.data() + j * mc;
+                    if(beta == 0)
+                        std::fill(c, c + mc, 0.0f);
+                    else
+                    {
+                        to_float_n(C + ic + (jc + j) * ldc, c, mc);
+                        if(beta != 1)
+                            for(size_t i = 0; i < mc; i++)
+                                c[i] *= beta;
+                    }
+                }
+
+                for(size_t pc = 0; alpha != 0 && pc < size_t(k); pc += gemm_kc)
+                {
+                    size_t kc = std::min(gemm_kc, k - pc);
+                    if(notransA)
+                        gemm_panel(A, lda, ic, pc, mc, kc, Ap.data());
+                    else
+                        gemm_panel(A, lda, pc, ic, kc, mc, Ap.data());
+                    if(notransB)
+                        gemm_panel(B, ldb, pc, jc, kc, nc, Bp.data());
+                    else
+                        gemm_panel(B, ldb, jc, pc, nc, kc, Bp.data());
+
+                    cblas_sgemm(CblasColMajor,
+                                (CBLAS_TRANSPOSE)transA,
+                                (CBLAS_TRANSPOSE)transB,
+                                mc,
+                                nc,
+                                kc,
+                                alpha,
+                                Ap.data(),
+                                notransA ? mc : kc,
+                                Bp.data(),
+                                notransB ? kc : nc,
+                                1.0f,
+                                Cp.data(),
+                                mc);
+                }
+
+                for(size_t j = 0; j < nc; j++)
+                    from_float_n(Cp.data() + j * mc, C + ic + (jc + j) * ldc, mc);
+            }
+        }
+    }
+}
+
+/*
+ * ===========================================================================
+ *    level 1 BLAS
+ * ===========================================================================
+ */
+
+// axpy
+template <>
+void cblas_axpy<hipblasHalf, hipblasHalf>(
+    int n, const hipblasHalf alpha, const hipblasHalf* x, int incx, hipblasHalf* y, int incy)
+{
+    panel_axpy(n, half_to_float(alpha), x, incx, y, incy);
+}
+
+template <>
+void cblas_axpy<float, hipblasHalf>(
+    int n, const float alpha, const hipblasHalf* x, int incx, hipblasHalf* y, int incy)
+{
+    panel_axpy(n, alpha, x, incx, y, incy);
 }
 
 template <>
@@ -236,15 +577,7 @@ void cblas_scal<hipblasHalf>(int n, const hipblasHalf alpha, hipblasHalf* x, int
     if(n <= 0 || incx <= 0)
         return;
 
-    std::vector<float> x_float(n * incx);
-
-    for(size_t i = 0; i < n; i++)
-        x_float[i * incx] = half_to_float(x[i * incx]);
-
-    cblas_sscal(n, half_to_float(alpha), x_float.data(), incx);
-
-    for(size_t i = 0; i < n; i++)
-        x[i * incx] = float_to_half(x_float[i * incx]);
+    panel_scal(n, half_to_float(alpha), x, incx);
 }
 
 template <>
@@ -253,15 +586,7 @@ void cblas_scal<hipblasHalf, float>(int n, const float alpha, hipblasHalf* x, in
     if(n <= 0 || incx <= 0)
         return;
 
-    std::vector<float> x_float(n * incx);
-
-    for(size_t i = 0; i < n; i++)
-        x_float[i * incx] = half_to_float(x[i * incx]);
-
-    cblas_sscal(n, alpha, x_float.data(), incx);
-
-    for(size_t i = 0; i < n; i++)
-        x[i * incx] = float_to_half(x_float[i * incx]);
+    panel_scal(n, alpha, x, incx);
 }
 
 template <>
@@ -363,17 +688,7 @@ template <>
 void cblas_dot<hipblasHalf>(
     int n, const hipblasHalf* x, int incx, const hipblasHalf* y, int incy, hipblasHalf* result)
 {
-    size_t             abs_incx = incx >= 0 ? incx : -incx;
-    size_t             abs_incy = incy >= 0 ? incy : -incy;
-    std::vector<float> x_float(n * abs_incx);
-    std::vector<float> y_float(n * abs_incy);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = half_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = half_to_float(y[i * abs_incy]);
-    }
-    *result = float_to_half(cblas_sdot(n, x_float.data(), incx, y_float.data(), incy));
+    *result = float_to_half(panel_dot(n, x, incx, y, incy));
 }
 
 template <>
@@ -384,17 +699,7 @@ void cblas_dot<hipblasBfloat16>(int                    n,
                                 int                    incy,
                                 hipblasBfloat16*       result)
 {
-    size_t             abs_incx = incx >= 0 ? incx : -incx;
-    size_t             abs_incy = incy >= 0 ? incy : -incy;
-    std::vector<float> x_float(n * abs_incx);
-    std::vector<float> y_float(n * abs_incy);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = bfloat16_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = bfloat16_to_float(y[i * abs_incy]);
-    }
-    *result = float_to_bfloat16(cblas_sdot(n, x_float.data(), incx, y_float.data(), incy));
+    *result = float_to_bfloat16(panel_dot(n, x, incx, y, incy));
 }
 
 template <>
@@ -497,12 +802,7 @@ void cblas_nrm2<hipblasHalf, hipblasHalf>(int                n,
     if(n <= 0 || incx <= 0)
         return;
 
-    std::vector<float> x_float(n * incx);
-
-    for(size_t i = 0; i < n; i++)
-        x_float[i * incx] = half_to_float(x[i * incx]);
-
-    *result = float_to_half(cblas_snrm2(n, x_float.data(), incx));
+    *result = float_to_half(panel_nrm2(n, x, incx));
 }
 
 template <>
@@ -575,33 +875,7 @@ template <>
 void cblas_rot<hipblasHalf>(
     int n, hipblasHalf* x, int incx, hipblasHalf* y, int incy, hipblasHalf c, hipblasHalf s)
 {
-    size_t abs_incx = incx >= 0 ? incx : -incx;
-    size_t abs_incy = incy >= 0 ? incy : -incy;
-    size_t size_x   = n * abs_incx;
-    size_t size_y   = n * abs_incy;
-    if(!size_x)
-        size_x = 1;
-    if(!size_y)
-        size_y = 1;
-    std::vector<float> x_float(size_x);
-    std::vector<float> y_float(size_y);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = half_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = half_to_float(y[i * abs_incy]);
-    }
-
-    const float c_float = half_to_float(c);
-    const float s_float = half_to_float(s);
-
-    cblas_srot(n, x_float.data(), incx, y_float.data(), incy, c_float, s_float);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x[i * abs_incx] = float_to_half(x_float[i * abs_incx]);
-        y[i * abs_incy] = float_to_half(y_float[i * abs_incy]);
-    }
+    panel_rot(n, x, incx, y, incy, half_to_float(c), half_to_float(s));
 }
 
 template <>
@@ -613,33 +887,7 @@ void cblas_rot<hipblasBfloat16>(int              n,
                                 hipblasBfloat16  c,
                                 hipblasBfloat16  s)
 {
-    size_t abs_incx = incx >= 0 ? incx : -incx;
-    size_t abs_incy = incy >= 0 ? incy : -incy;
-    size_t size_x   = n * abs_incx;
-    size_t size_y   = n * abs_incy;
-    if(!size_x)
-        size_x = 1;
-    if(!size_y)
-        size_y = 1;
-    std::vector<float> x_float(size_x);
-    std::vector<float> y_float(size_y);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = bfloat16_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = bfloat16_to_float(y[i * abs_incy]);
-    }
-
-    const float c_float = bfloat16_to_float(c);
-    const float s_float = bfloat16_to_float(s);
-
-    cblas_srot(n, x_float.data(), incx, y_float.data(), incy, c_float, s_float);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x[i * abs_incx] = float_to_bfloat16(x_float[i * abs_incx]);
-        y[i * abs_incy] = float_to_bfloat16(y_float[i * abs_incy]);
-    }
+    panel_rot(n, x, incx, y, incy, bfloat16_to_float(c), bfloat16_to_float(s));
 }
 
 template <>
@@ -888,6 +1136,117 @@ void cblas_iamin<hipblasDoubleComplex>(int n, const hipblasDoubleComplex* x, int
     *result = (int)cblas_iamin_helper(n, x, incx);
 }
 
+// axpby, axpy_dot, dot_multi and normalize are fused in hipBLAS; the references compose them from
+// the unfused routines
+template <typename T>
+void cblas_axpby(int n, T alpha, const T* x, int incx, T beta, T* y, int incy)
+{
+    // negative increments walk a vector from its last element
+    for(int i = 0; i < n; i++)
+    {
+        const T& xi = x[incx >= 0 ? size_t(i) * incx : size_t(n - 1 - i) * -incx];
+        T&       yi = y[incy >= 0 ? size_t(i) * incy : size_t(n - 1 - i) * -incy];
+        yi          = beta == T(0) ? alpha * xi : alpha * xi + beta * yi;
+    }
+}
+
+template <>
+void cblas_axpby<hipblasHalf>(int                n,
+                              hipblasHalf        alpha,
+                              const hipblasHalf* x,
+                              int                incx,
+                              hipblasHalf        beta,
+                              hipblasHalf*       y,
+                              int                incy)
+{
+    // cblas does not support hipblasHalf, so compute in float
+    const float a = to_float(alpha), b = to_float(beta);
+    for(int i = 0; i < n; i++)
+    {
+        const float  xi = to_float(x[incx >= 0 ? size_t(i) * incx : size_t(n - 1 - i) * -incx]);
+        hipblasHalf& yi = y[incy >= 0 ? size_t(i) * incy : size_t(n - 1 - i) * -incy];
+        from_float(b == 0 ? a * xi : a * xi + b * to_float(yi), yi);
+    }
+}
+
+template <typename T>
+void cblas_axpy_dot(
+    int n, T alpha, const T* x, int incx, T* y, int incy, const T* z, int incz, T* result)
+{
+    cblas_axpy<T>(n, alpha, x, incx, y, incy);
+    cblas_dotc<T>(n, y, incy, z, incz, result);
+}
+
+template <typename T>
+void cblas_dot_multi(int n, int k, const T* x, int incx, const T* Y, int ldy, T* result)
+{
+    for(int j = 0; j < k; j++)
+        cblas_dotc<T>(n, Y + size_t(j) * ldy, 1, x, incx, result + j);
+}
+
+template <typename T1, typename T2>
+void cblas_normalize(int n, T1* x, int incx, T2* result)
+{
+    cblas_nrm2<T1, T2>(n, x, incx, result);
+    if(n > 0 && incx > 0 && *result != 0)
+        cblas_scal<T1, T2>(n, T2(1) / *result, x, incx);
+}
+
+template void cblas_axpby<float>(int, float, const float*, int, float, float*, int);
+template void cblas_axpby<double>(int, double, const double*, int, double, double*, int);
+template void cblas_axpby<hipblasComplex>(
+    int, hipblasComplex, const hipblasComplex*, int, hipblasComplex, hipblasComplex*, int);
+template void cblas_axpby<hipblasDoubleComplex>(int,
+                                                hipblasDoubleComplex,
+                                                const hipblasDoubleComplex*,
+                                                int,
+                                                hipblasDoubleComplex,
+                                                hipblasDoubleComplex*,
+                                                int);
+
+template void cblas_axpy_dot<float>(
+    int, float, const float*, int, float*, int, const float*, int, float*);
+template void cblas_axpy_dot<double>(
+    int, double, const double*, int, double*, int, const double*, int, double*);
+template void cblas_axpy_dot<hipblasComplex>(int,
+                                             hipblasComplex,
+                                             const hipblasComplex*,
+                                             int,
+                                             hipblasComplex*,
+                                             int,
+                                             const hipblasComplex*,
+                                             int,
+                                             hipblasComplex*);
+template void cblas_axpy_dot<hipblasDoubleComplex>(int,
+                                                   hipblasDoubleComplex,
+                                                   const hipblasDoubleComplex*,
+                                                   int,
+                                                   hipblasDoubleComplex*,
+                                                   int,
+                                                   const hipblasDoubleComplex*,
+                                                   int,
+                                                   hipblasDoubleComplex*);
+
+template void cblas_dot_multi<hipblasHalf>(
+    int, int, const hipblasHalf*, int, const hipblasHalf*, int, hipblasHalf*);
+template void cblas_dot_multi<float>(int, int, const float*, int, const float*, int, float*);
+template void cblas_dot_multi<double>(int, int, const double*, int, const double*, int, double*);
+template void cblas_dot_multi<hipblasComplex>(
+    int, int, const hipblasComplex*, int, const hipblasComplex*, int, hipblasComplex*);
+template void cblas_dot_multi<hipblasDoubleComplex>(int,
+                                                    int,
+                                                    const hipblasDoubleComplex*,
+                                                    int,
+                                                    const hipblasDoubleComplex*,
+                                                    int,
+                                                    hipblasDoubleComplex*);
+
+template void cblas_normalize<float, float>(int, float*, int, float*);
+template void cblas_normalize<double, double>(int, double*, int, double*);
+template void cblas_normalize<hipblasComplex, float>(int, hipblasComplex*, int, float*);
+template void cblas_normalize<hipblasDoubleComplex, double>(
+    int, hipblasDoubleComplex*, int, double*);
+
 /*
  * ===========================================================================
  *    level 2 BLAS
@@ -1987,6 +2346,108 @@ void cblas_tpsv(hipblasFillMode_t           uplo,
         CblasColMajor, CBLAS_UPLO(uplo), CBLAS_TRANSPOSE(transA), CBLAS_DIAG(diag), n, AP, x, incx);
 }
 
+// tpttr
+template <>
+void cblas_tpttr<float>(hipblasFillMode_t uplo, int n, const float* AP, float* A, int lda)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    stpttr_(&uplo_c, &n, AP, A, &lda, &info);
+}
+
+template <>
+void cblas_tpttr<double>(hipblasFillMode_t uplo, int n, const double* AP, double* A, int lda)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    dtpttr_(&uplo_c, &n, AP, A, &lda, &info);
+}
+
+template <>
+void cblas_tpttr<hipblasComplex>(
+    hipblasFillMode_t uplo, int n, const hipblasComplex* AP, hipblasComplex* A, int lda)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    ctpttr_(&uplo_c, &n, AP, A, &lda, &info);
+}
+
+template <>
+void cblas_tpttr<hipblasDoubleComplex>(
+    hipblasFillMode_t uplo, int n, const hipblasDoubleComplex* AP, hipblasDoubleComplex* A, int lda)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    ztpttr_(&uplo_c, &n, AP, A, &lda, &info);
+}
+
+// trttp
+template <>
+void cblas_trttp<float>(hipblasFillMode_t uplo, int n, const float* A, int lda, float* AP)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    strttp_(&uplo_c, &n, A, &lda, AP, &info);
+}
+
+template <>
+void cblas_trttp<double>(hipblasFillMode_t uplo, int n, const double* A, int lda, double* AP)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    dtrttp_(&uplo_c, &n, A, &lda, AP, &info);
+}
+
+template <>
+void cblas_trttp<hipblasComplex>(
+    hipblasFillMode_t uplo, int n, const hipblasComplex* A, int lda, hipblasComplex* AP)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    ctrttp_(&uplo_c, &n, A, &lda, AP, &info);
+}
+
+template <>
+void cblas_trttp<hipblasDoubleComplex>(
+    hipblasFillMode_t uplo, int n, const hipblasDoubleComplex* A, int lda, hipblasDoubleComplex* AP)
+{
+    char uplo_c = hipblas2char_fill(uplo);
+    int  info;
+    ztrttp_(&uplo_c, &n, A, &lda, AP, &info);
+}
+
+// gbtge
+template <typename T>
+void cblas_gbtge(int m, int n, int kl, int ku, const T* AB, int ldab, T* A, int lda)
+{
+    for(int j = 0; j < n; j++)
+        for(int i = std::max(0, j - ku); i <= std::min(m - 1, j + kl); i++)
+            A[i + size_t(j) * lda] = AB[ku + i - j + size_t(j) * ldab];
+}
+
+// getgb
+template <typename T>
+void cblas_getgb(int m, int n, int kl, int ku, const T* A, int lda, T* AB, int ldab)
+{
+    for(int j = 0; j < n; j++)
+        for(int i = std::max(0, j - ku); i <= std::min(m - 1, j + kl); i++)
+            AB[ku + i - j + size_t(j) * ldab] = A[i + size_t(j) * lda];
+}
+
+template void cblas_gbtge<float>(int, int, int, int, const float*, int, float*, int);
+template void cblas_gbtge<double>(int, int, int, int, const double*, int, double*, int);
+template void cblas_gbtge<hipblasComplex>(
+    int, int, int, int, const hipblasComplex*, int, hipblasComplex*, int);
+template void cblas_gbtge<hipblasDoubleComplex>(
+    int, int, int, int, const hipblasDoubleComplex*, int, hipblasDoubleComplex*, int);
+
+template void cblas_getgb<float>(int, int, int, int, const float*, int, float*, int);
+template void cblas_getgb<double>(int, int, int, int, const double*, int, double*, int);
+template void cblas_getgb<hipblasComplex>(
+    int, int, int, int, const hipblasComplex*, int, hipblasComplex*, int);
+template void cblas_getgb<hipblasDoubleComplex>(
+    int, int, int, int, const hipblasDoubleComplex*, int, hipblasDoubleComplex*, int);
+
 // trmv
 template <>
 void cblas_trmv<float>(hipblasFillMode_t  uplo,
@@ -2286,53 +2747,10 @@ void cblas_gemm<hipblasHalf>(hipblasOperation_t transA,
                              hipblasHalf*       C,
                              int                ldc)
 {
-    // cblas does not support hipblasHalf, so convert to higher precision float
+    // cblas does not support hipblasHalf, so accumulate in higher precision float
     // This will give more precise result which is acceptable for testing
-    float alpha_float = half_to_float(alpha);
-    float beta_float  = half_to_float(beta);
-
-    int sizeA = transA == HIPBLAS_OP_N ? k * lda : m * lda;
-    int sizeB = transB == HIPBLAS_OP_N ? n * ldb : k * ldb;
-    int sizeC = n * ldc;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-    std::unique_ptr<float[]> C_float(new float[sizeC]());
-
-    for(int i = 0; i < sizeA; i++)
-    {
-        A_float[i] = half_to_float(A[i]);
-    }
-    for(int i = 0; i < sizeB; i++)
-    {
-        B_float[i] = half_to_float(B[i]);
-    }
-    for(int i = 0; i < sizeC; i++)
-    {
-        C_float[i] = half_to_float(C[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha_float,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta_float,
-                static_cast<float*>(C_float.get()),
-                ldc);
-
-    for(int i = 0; i < sizeC; i++)
-    {
-        C[i] = float_to_half(C_float[i]);
-    }
+    gemm_float_accumulate(
+        transA, transB, m, n, k, half_to_float(alpha), A, lda, B, ldb, half_to_float(beta), C, ldc);
 }
 
 template <>
@@ -2350,51 +2768,9 @@ void cblas_gemm<hipblasHalf, hipblasHalf, float>(hipblasOperation_t transA,
                                                  hipblasHalf*       C,
                                                  int                ldc)
 {
-    // cblas does not support hipblasHalf, so convert to higher precision float
+    // cblas does not support hipblasHalf, so accumulate in higher precision float
     // This will give more precise result which is acceptable for testing
-
-    int sizeA = transA == HIPBLAS_OP_N ? k * lda : m * lda;
-    int sizeB = transB == HIPBLAS_OP_N ? n * ldb : k * ldb;
-    int sizeC = n * ldc;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-    std::unique_ptr<float[]> C_float(new float[sizeC]());
-
-    for(int i = 0; i < sizeA; i++)
-    {
-        A_float[i] = half_to_float(A[i]);
-    }
-    for(int i = 0; i < sizeB; i++)
-    {
-        B_float[i] = half_to_float(B[i]);
-    }
-    for(int i = 0; i < sizeC; i++)
-    {
-        C_float[i] = half_to_float(C[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha_float,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta_float,
-                static_cast<float*>(C_float.get()),
-                ldc);
-
-    for(int i = 0; i < sizeC; i++)
-    {
-        C[i] = float_to_half(C_float[i]);
-    }
+    gemm_float_accumulate(transA, transB, m, n, k, alpha_float, A, lda, B, ldb, beta_float, C, ldc);
 }
 
 template <>
@@ -2412,51 +2788,9 @@ void cblas_gemm<hipblasBfloat16, hipblasBfloat16, float>(hipblasOperation_t tran
                                                          hipblasBfloat16*   C,
                                                          int                ldc)
 {
-    // cblas does not support hipblasBfloat16, so convert to higher precision float
+    // cblas does not support hipblasBfloat16, so accumulate in higher precision float
     // This will give more precise result which is acceptable for testing
-
-    int sizeA = transA == HIPBLAS_OP_N ? k * lda : m * lda;
-    int sizeB = transB == HIPBLAS_OP_N ? n * ldb : k * ldb;
-    int sizeC = n * ldc;
-
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-    std::unique_ptr<float[]> C_float(new float[sizeC]());
-
-    for(int i = 0; i < sizeA; i++)
-    {
-        A_float[i] = bfloat16_to_float(A[i]);
-    }
-    for(int i = 0; i < sizeB; i++)
-    {
-        B_float[i] = bfloat16_to_float(B[i]);
-    }
-    for(int i = 0; i < sizeC; i++)
-    {
-        C_float[i] = bfloat16_to_float(C[i]);
-    }
-
-    // just directly cast, since transA, transB are integers in the enum
-    // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
-    cblas_sgemm(CblasColMajor,
-                (CBLAS_TRANSPOSE)transA,
-                (CBLAS_TRANSPOSE)transB,
-                m,
-                n,
-                k,
-                alpha_float,
-                const_cast<const float*>(A_float.get()),
-                lda,
-                const_cast<const float*>(B_float.get()),
-                ldb,
-                beta_float,
-                static_cast<float*>(C_float.get()),
-                ldc);
-
-    for(int i = 0; i < sizeC; i++)
-    {
-        C[i] = float_to_bfloat16(C_float[i]);
-    }
+    gemm_float_accumulate(transA, transB, m, n, k, alpha_float, A, lda, B, ldb, beta_float, C, ldc);
 }
 
 template <>
@@ -2586,6 +2920,200 @@ void cblas_gemm<hipblasDoubleComplex>(hipblasOperation_t    transA,
                 ldc);
 }
 
+/*
+ * ===========================================================================
+ *    int8 gemm
+ *
+ *    Exact integer reference. Rows of op(A) and columns of op(B) are packed into contiguous
+ *    int8 runs of k, zero padded to a multiple of int8_kstep, and every element of C is an int8
+ *    dot product. The arithmetic is modulo 2^32, which is what int32 accumulation on the device
+ *    gives, overflow included.
+ * ===========================================================================
+ */
+
+namespace
+{
+    constexpr size_t int8_kstep = 64; // k per kernel step
+    constexpr size_t int8_mr    = 4; // micro tile of C
+    constexpr size_t int8_nr    = 4;
+    constexpr size_t int8_tile  = 64; // rows and columns of C per parallel task
+
+    // Copy the k elements of stored row r (by_row) or stored column r, for r in [0, count), to
+    // dst + r * kp, zero padded to kp
+    void int8_pack_runs(const int8_t* A,
+                        size_t        ld,
+                        bool          by_row,
+                        size_t        count,
+                        size_t        k,
+                        size_t        kp,
+                        int8_t*       dst)
+    {
+        for(size_t r = 0; r < count; r++, dst += kp)
+        {
+            if(!by_row)
+                std::copy(A + r * ld, A + r * ld + k, dst);
+            else
+                for(size_t l = 0; l < k; l++)
+                    dst[l] = A[r + l * ld];
+            std::fill(dst + k, dst + kp, 0);
+        }
+    }
+
+    // acc[i][j] = dot(a + i * kp, b + j * kp) modulo 2^32 for the int8_mr x int8_nr micro tile.
+    // b_sum[j] is the sum of run j of b, used by the VNNI kernel.
+    using int8_tile_kernel = void (*)(const int8_t*  a,
+                                      const int8_t*  b,
+                                      const int32_t* b_sum,
+                                      size_t         kp,
+                                      uint32_t (*acc)[int8_nr]);
+
+    void int8_tile_portable(
+        const int8_t* a, const int8_t* b, const int32_t*, size_t kp, uint32_t (*acc)[int8_nr])
+    {
+        for(size_t i = 0; i < int8_mr; i++)
+            for(size_t j = 0; j < int8_nr; j++)
+            {
+                int64_t sum = 0;
+                for(size_t l = 0; l < kp; l++)
+                    sum += int32_t(a[i * kp + l]) * b[j * kp + l];
+                acc[i][j] = uint32_t(sum);
+            }
+    }
+
+#ifdef HIPBLAS_CBLAS_CPU_DISPATCH
+    // Sign extend 16 elements to int16 and multiply-add adjacent pairs into int32: exact, since
+    // a pair of int8 products is at most 2 * 128 * 128
+    __attribute__((target("avx2"))) void int8_tile_avx2(
+        const int8_t* a, const int8_t* b, const int32_t*, size_t kp, uint32_t (*acc)[int8_nr])
+    {
+        for(size_t i0 = 0; i0 < int8_mr; i0 += 2)
+        {
+            __m256i sum[2][int8_nr] = {};
+            for(size_t l = 0; l < kp; l += 16)
+            {
+                __m256i a0
+                    = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i*)(a + i0 * kp + l)));
+                __m256i a1 = _mm256_cvtepi8_epi16(
+                    _mm_loadu_si128((const __m128i*)(a + (i0 + 1) * kp + l)));
+                for(size_t j = 0; j < int8_nr; j++)
+                {
+                    __m256i bj = _mm256_cvtepi8_epi16(
+                        _mm_loadu_si128((const __m128i*)(b + j * kp + l)));
+                    sum[0][j] = _mm256_add_epi32(sum[0][j], _mm256_madd_epi16(a0, bj));
+                    sum[1][j] = _mm256_add_epi32(sum[1][j], _mm256_madd_epi16(a1, bj));
+                }
+            }
+            for(size_t i = 0; i < 2; i++)
+                for(size_t j = 0; j < int8_nr; j++)
+                {
+                    alignas(32) uint32_t lanes[8];
+                    _mm256_store_si256((__m256i*)lanes, sum[i][j]);
+                    uint32_t total = 0;
+                    for(uint32_t lane : lanes)
+                        total += lane;
+                    acc[i0 + i][j] = total;
+                }
+        }
+    }
+
+    // vpdpbusd multiplies unsigned by signed bytes: with a' = a + 128,
+    // dot(a, b) = dot(a', b) - 128 * sum(b)
+    __attribute__((target("avx512f,avx512bw,avx512vnni"))) void int8_tile_vnni(
+        const int8_t* a, const int8_t* b, const int32_t* b_sum, size_t kp, uint32_t (*acc)[int8_nr])
+    {
+        const __m512i bias = _mm512_set1_epi8(char(0x80));
+        __m512i       sum[int8_mr][int8_nr] = {};
+        for(size_t l = 0; l < kp; l += 64)
+        {
+            __m512i ai[int8_mr];
+            for(size_t i = 0; i < int8_mr; i++)
+                ai[i] = _mm512_xor_si512(_mm512_loadu_si512(a + i * kp + l), bias);
+            for(size_t j = 0; j < int8_nr; j++)
+            {
+                __m512i bj = _mm512_loadu_si512(b + j * kp + l);
+                for(size_t i = 0; i < int8_mr; i++)
+                    sum[i][j] = _mm512_dpbusd_epi32(sum[i][j], ai[i], bj);
+            }
+        }
+        for(size_t i = 0; i < int8_mr; i++)
+            for(size_t j = 0; j < int8_nr; j++)
+                acc[i][j] = uint32_t(_mm512_reduce_add_epi32(sum[i][j]))
+                            - 128u * uint32_t(b_sum[j]);
+    }
+#endif
+
+    int8_tile_kernel int8_select_kernel()
+    {
+#ifdef HIPBLAS_CBLAS_CPU_DISPATCH
+        if(__builtin_cpu_supports("avx512vnni") && __builtin_cpu_supports("avx512bw"))
+            return int8_tile_vnni;
+        if(__builtin_cpu_supports("avx2"))
+            return int8_tile_avx2;
+#endif
+        return int8_tile_portable;
+    }
+}
+
+void cblas_gemm_int8(hipblasOperation_t transA,
+                     hipblasOperation_t transB,
+                     int                m,
+                     int                n,
+                     int                k,
+                     int32_t            alpha,
+                     const int8_t*      A,
+                     int                lda,
+                     const int8_t*      B,
+                     int                ldb,
+                     int32_t            beta,
+                     int32_t*           C,
+                     int                ldc)
+{
+    if(m <= 0 || n <= 0)
+        return;
+
+    static const int8_tile_kernel kernel = int8_select_kernel();
+
+    // Rows of op(A) are stored rows of A when transA == N, columns of op(B) are stored rows of
+    // B when transB != N
+    size_t kk    = alpha != 0 ? size_t(std::max(k, 0)) : 0;
+    size_t kp    = (kk + int8_kstep - 1) / int8_kstep * int8_kstep;
+    size_t m_pad = (m + int8_mr - 1) / int8_mr * int8_mr;
+    size_t n_pad = (n + int8_nr - 1) / int8_nr * int8_nr;
+
+    std::vector<int8_t>  Ap(m_pad * kp, 0), Bp(n_pad * kp, 0);
+    std::vector<int32_t> B_sum(n_pad, 0);
+    int8_pack_runs(A, lda, transA == HIPBLAS_OP_N, kk ? m : 0, kk, kp, Ap.data());
+    int8_pack_runs(B, ldb, transB != HIPBLAS_OP_N, kk ? n : 0, kk, kp, Bp.data());
+    for(size_t j = 0; j < n_pad; j++)
+        for(size_t l = 0; l < kp; l++)
+            B_sum[j] += Bp[j * kp + l];
+
+    size_t m_tiles = (m + int8_tile - 1) / int8_tile;
+    size_t n_tiles = (n + int8_tile - 1) / int8_tile;
+
+    hipblas_parallel_for(m_tiles * n_tiles, [&](size_t t) {
+        size_t i_end = std::min(size_t(m), (t % m_tiles + 1) * int8_tile);
+        size_t j_end = std::min(size_t(n), (t / m_tiles + 1) * int8_tile);
+        for(size_t j0 = t / m_tiles * int8_tile; j0 < j_end; j0 += int8_nr)
+            for(size_t i0 = t % m_tiles * int8_tile; i0 < i_end; i0 += int8_mr)
+            {
+                uint32_t acc[int8_mr][int8_nr] = {};
+                if(kp)
+                    kernel(Ap.data() + i0 * kp, Bp.data() + j0 * kp, B_sum.data() + j0, kp, acc);
+
+                for(size_t j = 0; j < std::min(int8_nr, j_end - j0); j++)
+                    for(size_t i = 0; i < std::min(int8_mr, i_end - i0); i++)
+                    {
+                        int32_t& c = C[(i0 + i) + (j0 + j) * size_t(ldc)];
+                        uint32_t r = uint32_t(alpha) * acc[i][j];
+                        if(beta != 0)
+                            r += uint32_t(beta) * uint32_t(c);
+                        c = int32_t(r);
+                    }
+            }
+    });
+}
+
 template <>
 void cblas_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
                                           hipblasOperation_t transB,
@@ -2601,47 +3129,7 @@ void cblas_gemm<int8_t, int32_t, int32_t>(hipblasOperation_t transA,
                                           int32_t*           C,
                                           int                ldc)
 {
-    double alpha_double = static_cast<double>(alpha);
-    double beta_double  = static_cast<double>(beta);
-
-    size_t const sizeA = ((transA == HIPBLAS_OP_N) ? k : m) * size_t(lda);
-    size_t const sizeB = ((transB == HIPBLAS_OP_N) ? n : k) * size_t(ldb);
-    size_t const sizeC = n * size_t(ldc);
-
-    std::unique_ptr<double[]> A_double(new double[sizeA]());
-    std::unique_ptr<double[]> B_double(new double[sizeB]());
-    std::unique_ptr<double[]> C_double(new double[sizeC]());
-
-    for(int i = 0; i < sizeA; i++)
-    {
-        A_double[i] = static_cast<double>(A[i]);
-    }
-    for(int i = 0; i < sizeB; i++)
-    {
-        B_double[i] = static_cast<double>(B[i]);
-    }
-    for(int i = 0; i < sizeC; i++)
-    {
-        C_double[i] = static_cast<double>(C[i]);
-    }
-
-    cblas_dgemm(CblasColMajor,
-                static_cast<CBLAS_TRANSPOSE>(transA),
-                static_cast<CBLAS_TRANSPOSE>(transB),
-                m,
-                n,
-                k,
-                alpha_double,
-                const_cast<const double*>(A_double.get()),
-                lda,
-                const_cast<const double*>(B_double.get()),
-                ldb,
-                beta_double,
-                static_cast<double*>(C_double.get()),
-                ldc);
-
-    for(size_t i = 0; i < sizeC; i++)
-        C[i] = static_cast<int32_t>(C_double[i]);
+    cblas_gemm_int8(transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 // hemm
@@ -2773,66 +3261,10 @@ void cblas_herkx_local(hipblasFillMode_t  uplo,
     if(n <= 0 || (beta == 1 && (k == 0 || alpha == T(0))))
         return;
 
-    if(transA == HIPBLAS_OP_N)
-    {
-        if(uplo == HIPBLAS_FILL_MODE_UPPER)
-        {
-            for(int j = 0; j < n; ++j)
-            {
-                for(int i = 0; i <= j; i++)
-                    C[i + j * ldc] *= T(beta);
-
-                for(int l = 0; l < k; l++)
-                {
-                    T temp = alpha * std::conj(B[j + l * ldb]);
-                    for(int i = 0; i <= j; ++i)
-                        C[i + j * ldc] += temp * A[i + l * lda];
-                }
-            }
-        }
-        else // lower
-        {
-            for(int j = 0; j < n; ++j)
-            {
-                for(int i = j; i < n; i++)
-                    C[i + j * ldc] *= T(beta);
-
-                for(int l = 0; l < k; l++)
-                {
-                    T temp = alpha * std::conj(B[j + l * ldb]);
-                    for(int i = j; i < n; ++i)
-                        C[i + j * ldc] += temp * A[i + l * lda];
-                }
-            }
-        }
-    }
-    else // conjugate transpose
-    {
-        if(uplo == HIPBLAS_FILL_MODE_UPPER)
-        {
-            for(int j = 0; j < n; ++j)
-                for(int i = 0; i <= j; i++)
-                {
-                    C[i + j * ldc] *= T(beta);
-                    T temp(0);
-                    for(int l = 0; l < k; l++)
-                        temp += std::conj(A[l + i * lda]) * B[l + j * ldb];
-                    C[i + j * ldc] += alpha * temp;
-                }
-        }
-        else // lower
-        {
-            for(int j = 0; j < n; ++j)
-                for(int i = j; i < n; i++)
-                {
-                    C[i + j * ldc] *= T(beta);
-                    T temp(0);
-                    for(int l = 0; l < k; l++)
-                        temp += std::conj(A[l + i * lda]) * B[l + j * ldb];
-                    C[i + j * ldc] += alpha * temp;
-                }
-        }
-    }
+    // op(A) * op(B)**H: conjugate B for the normal case and A for the conjugate transpose
+    bool by_row = transA != HIPBLAS_OP_N;
+    syrkx_herkx_blocked<T>(
+        uplo, by_row, by_row, !by_row, n, k, alpha, A, lda, B, ldb, T(beta), C, ldc);
 
     for(int i = 0; i < n; i++)
         C[i + i * ldc].imag(0);
@@ -0,0 +1,256 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_ref_cache.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <process.h>
+#define getpid _getpid
+#endif
+
+namespace
+{
+    constexpr char     ref_magic[8] = {'H', 'B', 'R', 'E', 'F', '0', '1', '\n'};
+    constexpr uint64_t ref_prime    = 0x9E3779B97F4A7C15ull;
+
+    // Layout of a cache file: the header, then the outputs back to back
+    struct ref_header
+    {
+        char     magic[8];
+        uint64_t key;
+        uint64_t bytes;
+        uint64_t checksum;
+    };
+
+    uint64_t mix(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // Fields of Arguments which do not change the result of a reference: how the test runs,
+    // its names, and the tuning of the GPU solution. The strides are left out too since the
+    // gtests do not set them for every routine; the input contents cover the layout
+    bool ref_ignored_field(const char* name)
+    {
+        static const char* const ignored[] = {"stride_a",
+                                              "stride_b",
+                                              "stride_c",
+                                              "stride_d",
+                                              "stride_x",
+                                              "stride_y",
+                                              "norm_check",
+                                              "unit_check",
+                                              "timing",
+                                              "iters",
+                                              "cold_iters",
+                                              "algo",
+                                              "solution_index",
+                                              "flags",
+                                              "function",
+                                              "name",
+                                              "category",
+                                              "atomics_mode"};
+        for(const char* field : ignored)
+            if(!strcmp(field, name))
+                return true;
+        return false;
+    }
+
+    std::string ref_path(uint64_t key)
+    {
+        char name[32];
+        snprintf(name, sizeof(name), "/%016llx.ref", (unsigned long long)key);
+        return hipblas_ref_cache_dir() + std::string(name);
+    }
+
+    uint64_t ref_checksum(std::initializer_list<hipblas_ref_output> outputs)
+    {
+        uint64_t h = 0;
+        for(auto& out : outputs)
+            h = hipblas_ref_hash(out.data, out.bytes, h);
+        return h;
+    }
+
+    // Copy the payload of a cache file into the outputs after checking the header and checksum
+    bool ref_unpack(const char*                               file,
+                    size_t                                    file_bytes,
+                    uint64_t                                  key,
+                    std::initializer_list<hipblas_ref_output> outputs)
+    {
+        size_t bytes = 0;
+        for(auto& out : outputs)
+            bytes += out.bytes;
+
+        ref_header header;
+        if(file_bytes != sizeof(header) + bytes)
+            return false;
+        memcpy(&header, file, sizeof(header));
+        if(memcmp(header.magic, ref_magic, sizeof(ref_magic)) || header.key != key
+           || header.bytes != bytes)
+            return false;
+
+        uint64_t    checksum = 0;
+        const char* payload  = file + sizeof(header);
+        for(auto& out : outputs)
+        {
+            checksum = hipblas_ref_hash(payload, out.bytes, checksum);
+            payload += out.bytes;
+        }
+        if(checksum != header.checksum)
+        {
+            fprintf(stderr, "hipBLAS reference cache: stale entry %s\n", ref_path(key).c_str());
+            return false;
+        }
+
+        payload = file + sizeof(header);
+        for(auto& out : outputs)
+        {
+            memcpy(out.data, payload, out.bytes);
+            payload += out.bytes;
+        }
+        return true;
+    }
+}
+
+const char* hipblas_ref_cache_dir()
+{
+    static const char* dir = [] {
+        const char* env = getenv("HIPBLAS_REF_CACHE");
+        return env && *env ? env : nullptr;
+    }();
+    return dir;
+}
+
+uint64_t hipblas_ref_hash(const void* data, size_t bytes, uint64_t seed)
+{
+    // four independent lanes over 8 byte words, so the multiplications overlap
+    const char* p    = static_cast<const char*>(data);
+    uint64_t    h[4] = {seed ^ bytes, seed + ref_prime, seed - ref_prime, ~seed};
+
+    size_t blocks = bytes / 32;
+    for(size_t b = 0; b < blocks; b++, p += 32)
+    {
+        uint64_t w[4];
+        memcpy(w, p, sizeof(w));
+        for(int l = 0; l < 4; l++)
+        {
+            h[l] = (h[l] ^ w[l]) * ref_prime;
+            h[l] ^= h[l] >> 29;
+        }
+    }
+
+    uint64_t tail[4] = {};
+    if(bytes % 32)
+        memcpy(tail, p, bytes % 32);
+    for(int l = 0; l < 4; l++)
+        h[l] = (h[l] ^ tail[l]) * ref_prime;
+
+    return mix(h[0] ^ mix(h[1] ^ mix(h[2] ^ mix(h[3]))));
+}
+
+uint64_t hipblas_ref_cache_key(const Arguments&                         arg,
+                               const char*                              routine,
+                               const char*                              type,
+                               std::initializer_list<hipblas_ref_data>   inputs,
+                               std::initializer_list<hipblas_ref_output> outputs)
+{
+    uint64_t h = hipblas_ref_hash(routine, strlen(routine));
+    h          = hipblas_ref_hash(type, strlen(type), h);
+
+#define HASH_FIELD(NAME)                                      \
+    if(!ref_ignored_field(#NAME))                             \
+    {                                                         \
+        h = hipblas_ref_hash(#NAME, strlen(#NAME), h);        \
+        h = hipblas_ref_hash(&arg.NAME, sizeof(arg.NAME), h); \
+    }
+    FOR_EACH_ARGUMENT(HASH_FIELD, ;);
+#undef HASH_FIELD
+
+    for(auto& in : inputs)
+        h = hipblas_ref_hash(in.data, in.bytes, h);
+    for(auto& out : outputs)
+        h = hipblas_ref_hash(out.data, out.bytes, h);
+    return h;
+}
+
+bool hipblas_ref_cache_load(uint64_t key, std::initializer_list<hipblas_ref_output> outputs)
+{
+    std::string path = ref_path(key);
+#ifndef WIN32
+    int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+        return false;
+
+    bool        hit = false;
+    struct stat st;
+    if(!fstat(fd, &st) && st.st_size > 0)
+    {
+        void* file = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(file != MAP_FAILED)
+        {
+            hit = ref_unpack(static_cast<const char*>(file), st.st_size, key, outputs);
+            munmap(file, st.st_size);
+        }
+    }
+    close(fd);
+    return hit;
+#else
+    FILE* f = fopen(path.c_str(), "rb");
+    if(!f)
+        return false;
+
+    std::vector<char> file;
+    char              buffer[65536];
+    size_t            read;
+    while((read = fread(buffer, 1, sizeof(buffer), f)) > 0)
+        file.insert(file.end(), buffer, buffer + read);
+    fclose(f);
+    return ref_unpack(file.data(), file.size(), key, outputs);
+#endif
+}
+
+void hipblas_ref_cache_store(uint64_t key, std::initializer_list<hipblas_ref_output> outputs)
+{
+    ref_header header;
+    memcpy(header.magic, ref_magic, sizeof(ref_magic));
+    header.key      = key;
+    header.bytes    = 0;
+    header.checksum = ref_checksum(outputs);
+    for(auto& out : outputs)
+        header.bytes += out.bytes;
+
+    // Written under a temporary name and renamed, so concurrent test processes never see a
+    // partial entry
+    std::string path = ref_path(key);
+    std::string tmp  = path + ".tmp" + std::to_string(getpid());
+    FILE*       f    = fopen(tmp.c_str(), "wb");
+    if(!f)
+    {
+        fprintf(stderr, "hipBLAS reference cache: cannot write %s\n", tmp.c_str());
+        return;
+    }
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1;
+    for(auto& out : outputs)
+        ok = ok && (!out.bytes || fwrite(out.data, out.bytes, 1, f) == 1);
+    ok = !fclose(f) && ok;
+
+    if(!ok || rename(tmp.c_str(), path.c_str()))
+        remove(tmp.c_str());
+}
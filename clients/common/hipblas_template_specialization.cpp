@@ -227,2824 +227,2764 @@ hipblasStatus_t hipblasAxpyStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, n, alpha, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
-// scal
+// axpby
 template <>
-hipblasStatus_t
-    hipblasScal<float>(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
+hipblasStatus_t hipblasAxpby<hipblasHalf>(hipblasHandle_t    handle,
+                                          int                n,
+                                          const hipblasHalf* alpha,
+                                          const hipblasHalf* x,
+                                          int                incx,
+                                          const hipblasHalf* beta,
+                                          hipblasHalf*       y,
+                                          int                incy)
 {
-    return hipblasSscal(handle, n, alpha, x, incx);
+    return hipblasHaxpby(handle, n, alpha, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t
-    hipblasScal<double>(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
+hipblasStatus_t hipblasAxpby<float>(hipblasHandle_t handle,
+                                    int             n,
+                                    const float*    alpha,
+                                    const float*    x,
+                                    int             incx,
+                                    const float*    beta,
+                                    float*          y,
+                                    int             incy)
 {
-    return hipblasDscal(handle, n, alpha, x, incx);
+    return hipblasSaxpby(handle, n, alpha, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasScal<hipblasComplex>(
-    hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
+hipblasStatus_t hipblasAxpby<double>(hipblasHandle_t handle,
+                                     int             n,
+                                     const double*   alpha,
+                                     const double*   x,
+                                     int             incx,
+                                     const double*   beta,
+                                     double*         y,
+                                     int             incy)
 {
-    return hipblasCscal(handle, n, alpha, x, incx);
+    return hipblasDaxpby(handle, n, alpha, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasScal<hipblasComplex, float>(
-    hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
+hipblasStatus_t hipblasAxpby<hipblasComplex>(hipblasHandle_t       handle,
+                                             int                   n,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* x,
+                                             int                   incx,
+                                             const hipblasComplex* beta,
+                                             hipblasComplex*       y,
+                                             int                   incy)
 {
-    return hipblasCsscal(handle, n, alpha, x, incx);
+    return hipblasCaxpby(handle, n, alpha, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasScal<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  int                         n,
-                                                  const hipblasDoubleComplex* alpha,
-                                                  hipblasDoubleComplex*       x,
-                                                  int                         incx)
+hipblasStatus_t hipblasAxpby<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   int                         n,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* x,
+                                                   int                         incx,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       y,
+                                                   int                         incy)
 {
-    return hipblasZscal(handle, n, alpha, x, incx);
+    return hipblasZaxpby(handle, n, alpha, x, incx, beta, y, incy);
 }
 
+// axpby_batched
 template <>
-hipblasStatus_t hipblasScal<hipblasDoubleComplex, double>(
-    hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
+hipblasStatus_t hipblasAxpbyBatched<hipblasHalf>(hipblasHandle_t          handle,
+                                                 int                      n,
+                                                 const hipblasHalf*       alpha,
+                                                 const hipblasHalf* const x[],
+                                                 int                      incx,
+                                                 const hipblasHalf*       beta,
+                                                 hipblasHalf* const       y[],
+                                                 int                      incy,
+                                                 int                      batch_count)
 {
-    return hipblasZdscal(handle, n, alpha, x, incx);
+    return hipblasHaxpbyBatched(handle, n, alpha, x, incx, beta, y, incy, batch_count);
 }
 
-// scal_batched
 template <>
-hipblasStatus_t hipblasScalBatched<float>(
-    hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batch_count)
+hipblasStatus_t hipblasAxpbyBatched<float>(hipblasHandle_t    handle,
+                                           int                n,
+                                           const float*       alpha,
+                                           const float* const x[],
+                                           int                incx,
+                                           const float*       beta,
+                                           float* const       y[],
+                                           int                incy,
+                                           int                batch_count)
 {
-    return hipblasSscalBatched(handle, n, alpha, x, incx, batch_count);
+    return hipblasSaxpbyBatched(handle, n, alpha, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasScalBatched<double>(hipblasHandle_t handle,
-                                           int             n,
-                                           const double*   alpha,
-                                           double* const   x[],
-                                           int             incx,
-                                           int             batch_count)
+hipblasStatus_t hipblasAxpbyBatched<double>(hipblasHandle_t     handle,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const x[],
+                                            int                 incx,
+                                            const double*       beta,
+                                            double* const       y[],
+                                            int                 incy,
+                                            int                 batch_count)
 {
-    return hipblasDscalBatched(handle, n, alpha, x, incx, batch_count);
+    return hipblasDaxpbyBatched(handle, n, alpha, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasScalBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                   int                   n,
-                                                   const hipblasComplex* alpha,
-                                                   hipblasComplex* const x[],
-                                                   int                   incx,
-                                                   int                   batch_count)
+hipblasStatus_t hipblasAxpbyBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       y[],
+                                                    int                         incy,
+                                                    int                         batch_count)
 {
-    return hipblasCscalBatched(handle, n, alpha, x, incx, batch_count);
+    return hipblasCaxpbyBatched(handle, n, alpha, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasScalBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                         int                         n,
-                                                         const hipblasDoubleComplex* alpha,
-                                                         hipblasDoubleComplex* const x[],
-                                                         int                         incx,
-                                                         int                         batch_count)
+hipblasStatus_t
+    hipblasAxpbyBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                              int                               n,
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const x[],
+                                              int                               incx,
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              int                               incy,
+                                              int                               batch_count)
 {
-    return hipblasZscalBatched(handle, n, alpha, x, incx, batch_count);
+    return hipblasZaxpbyBatched(handle, n, alpha, x, incx, beta, y, incy, batch_count);
 }
 
+// axpby_strided_batched
 template <>
-hipblasStatus_t hipblasScalBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                          int                   n,
-                                                          const float*          alpha,
-                                                          hipblasComplex* const x[],
-                                                          int                   incx,
-                                                          int                   batch_count)
+hipblasStatus_t hipblasAxpbyStridedBatched<hipblasHalf>(hipblasHandle_t    handle,
+                                                        int                n,
+                                                        const hipblasHalf* alpha,
+                                                        const hipblasHalf* x,
+                                                        int                incx,
+                                                        hipblasStride      stridex,
+                                                        const hipblasHalf* beta,
+                                                        hipblasHalf*       y,
+                                                        int                incy,
+                                                        hipblasStride      stridey,
+                                                        int                batch_count)
 {
-    return hipblasCsscalBatched(handle, n, alpha, x, incx, batch_count);
+    return hipblasHaxpbyStridedBatched(
+        handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasScalBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                                 int                         n,
-                                                                 const double*               alpha,
-                                                                 hipblasDoubleComplex* const x[],
-                                                                 int                         incx,
-                                                                 int batch_count)
+hipblasStatus_t hipblasAxpbyStridedBatched<float>(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const float*    alpha,
+                                                  const float*    x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  const float*    beta,
+                                                  float*          y,
+                                                  int             incy,
+                                                  hipblasStride   stridey,
+                                                  int             batch_count)
 {
-    return hipblasZdscalBatched(handle, n, alpha, x, incx, batch_count);
+    return hipblasSaxpbyStridedBatched(
+        handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
 }
 
-// scal_strided_batched
 template <>
-hipblasStatus_t hipblasScalStridedBatched<float>(hipblasHandle_t handle,
-                                                 int             n,
-                                                 const float*    alpha,
-                                                 float*          x,
-                                                 int             incx,
-                                                 hipblasStride   stridex,
-                                                 int             batch_count)
+hipblasStatus_t hipblasAxpbyStridedBatched<double>(hipblasHandle_t handle,
+                                                   int             n,
+                                                   const double*   alpha,
+                                                   const double*   x,
+                                                   int             incx,
+                                                   hipblasStride   stridex,
+                                                   const double*   beta,
+                                                   double*         y,
+                                                   int             incy,
+                                                   hipblasStride   stridey,
+                                                   int             batch_count)
 {
-    return hipblasSscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasDaxpbyStridedBatched(
+        handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasScalStridedBatched<double>(hipblasHandle_t handle,
-                                                  int             n,
-                                                  const double*   alpha,
-                                                  double*         x,
-                                                  int             incx,
-                                                  hipblasStride   stridex,
-                                                  int             batch_count)
+hipblasStatus_t hipblasAxpbyStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           const hipblasComplex* alpha,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           hipblasStride         stridex,
+                                                           const hipblasComplex* beta,
+                                                           hipblasComplex*       y,
+                                                           int                   incy,
+                                                           hipblasStride         stridey,
+                                                           int                   batch_count)
 {
-    return hipblasDscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasCaxpbyStridedBatched(
+        handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasScalStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          hipblasComplex*       x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          int                   batch_count)
+hipblasStatus_t
+    hipblasAxpbyStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     hipblasStride               stridex,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int                         incy,
+                                                     hipblasStride               stridey,
+                                                     int                         batch_count)
 {
-    return hipblasCscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasZaxpbyStridedBatched(
+        handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
+}
+
+// axpy_dot
+template <>
+hipblasStatus_t hipblasAxpyDot<float>(hipblasHandle_t handle,
+                                      int             n,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int             incx,
+                                      float*          y,
+                                      int             incy,
+                                      const float*    z,
+                                      int             incz,
+                                      float*          result)
+{
+    return hipblasSaxpyDot(handle, n, alpha, x, incx, y, incy, z, incz, result);
 }
 
 template <>
-hipblasStatus_t hipblasScalStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                int                         n,
-                                                                const hipblasDoubleComplex* alpha,
-                                                                hipblasDoubleComplex*       x,
-                                                                int                         incx,
-                                                                hipblasStride               stridex,
-                                                                int batch_count)
+hipblasStatus_t hipblasAxpyDot<double>(hipblasHandle_t handle,
+                                       int             n,
+                                       const double*   alpha,
+                                       const double*   x,
+                                       int             incx,
+                                       double*         y,
+                                       int             incy,
+                                       const double*   z,
+                                       int             incz,
+                                       double*         result)
 {
-    return hipblasZscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasDaxpyDot(handle, n, alpha, x, incx, y, incy, z, incz, result);
 }
 
 template <>
-hipblasStatus_t hipblasScalStridedBatched<hipblasComplex, float>(hipblasHandle_t handle,
-                                                                 int             n,
-                                                                 const float*    alpha,
-                                                                 hipblasComplex* x,
-                                                                 int             incx,
-                                                                 hipblasStride   stridex,
-                                                                 int             batch_count)
+hipblasStatus_t hipblasAxpyDot<hipblasComplex>(hipblasHandle_t       handle,
+                                               int                   n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int                   incx,
+                                               hipblasComplex*       y,
+                                               int                   incy,
+                                               const hipblasComplex* z,
+                                               int                   incz,
+                                               hipblasComplex*       result)
 {
-    return hipblasCsscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasCaxpyDot(handle, n, alpha, x, incx, y, incy, z, incz, result);
 }
 
 template <>
-hipblasStatus_t hipblasScalStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t handle,
-                                                                        int             n,
-                                                                        const double*   alpha,
-                                                                        hipblasDoubleComplex* x,
-                                                                        int                   incx,
-                                                                        hipblasStride stridex,
-                                                                        int           batch_count)
+hipblasStatus_t hipblasAxpyDot<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     hipblasDoubleComplex*       y,
+                                                     int                         incy,
+                                                     const hipblasDoubleComplex* z,
+                                                     int                         incz,
+                                                     hipblasDoubleComplex*       result)
 {
-    return hipblasZdscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
+    return hipblasZaxpyDot(handle, n, alpha, x, incx, y, incy, z, incz, result);
 }
 
-//swap
+// axpy_dot_batched
 template <>
-hipblasStatus_t
-    hipblasSwap<float>(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
+hipblasStatus_t hipblasAxpyDotBatched<float>(hipblasHandle_t    handle,
+                                             int                n,
+                                             const float*       alpha,
+                                             const float* const x[],
+                                             int                incx,
+                                             float* const       y[],
+                                             int                incy,
+                                             const float* const z[],
+                                             int                incz,
+                                             int                batch_count,
+                                             float*             result)
 {
-    return hipblasSswap(handle, n, x, incx, y, incy);
+    return hipblasSaxpyDotBatched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
 }
 
 template <>
-hipblasStatus_t
-    hipblasSwap<double>(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
+hipblasStatus_t hipblasAxpyDotBatched<double>(hipblasHandle_t     handle,
+                                              int                 n,
+                                              const double*       alpha,
+                                              const double* const x[],
+                                              int                 incx,
+                                              double* const       y[],
+                                              int                 incy,
+                                              const double* const z[],
+                                              int                 incz,
+                                              int                 batch_count,
+                                              double*             result)
 {
-    return hipblasDswap(handle, n, x, incx, y, incy);
+    return hipblasDaxpyDotBatched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasSwap<hipblasComplex>(
-    hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+hipblasStatus_t hipblasAxpyDotBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                      int                         n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int                         incx,
+                                                      hipblasComplex* const       y[],
+                                                      int                         incy,
+                                                      const hipblasComplex* const z[],
+                                                      int                         incz,
+                                                      int                         batch_count,
+                                                      hipblasComplex*             result)
 {
-    return hipblasCswap(handle, n, x, incx, y, incy);
+    return hipblasCaxpyDotBatched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasSwap<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                  int                   n,
-                                                  hipblasDoubleComplex* x,
-                                                  int                   incx,
-                                                  hipblasDoubleComplex* y,
-                                                  int                   incy)
-{
-    return hipblasZswap(handle, n, x, incx, y, incy);
+hipblasStatus_t
+    hipblasAxpyDotBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                int                               n,
+                                                const hipblasDoubleComplex*       alpha,
+                                                const hipblasDoubleComplex* const x[],
+                                                int                               incx,
+                                                hipblasDoubleComplex* const       y[],
+                                                int                               incy,
+                                                const hipblasDoubleComplex* const z[],
+                                                int                               incz,
+                                                int                               batch_count,
+                                                hipblasDoubleComplex*             result)
+{
+    return hipblasZaxpyDotBatched(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
+}
+
+// axpy_dot_strided_batched
+template <>
+hipblasStatus_t hipblasAxpyDotStridedBatched<float>(hipblasHandle_t handle,
+                                                    int             n,
+                                                    const float*    alpha,
+                                                    const float*    x,
+                                                    int             incx,
+                                                    hipblasStride   stridex,
+                                                    float*          y,
+                                                    int             incy,
+                                                    hipblasStride   stridey,
+                                                    const float*    z,
+                                                    int             incz,
+                                                    hipblasStride   stridez,
+                                                    int             batch_count,
+                                                    float*          result)
+{
+    return hipblasSaxpyDotStridedBatched(handle,
+                                         n,
+                                         alpha,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         z,
+                                         incz,
+                                         stridez,
+                                         batch_count,
+                                         result);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyDotStridedBatched<double>(hipblasHandle_t handle,
+                                                     int             n,
+                                                     const double*   alpha,
+                                                     const double*   x,
+                                                     int             incx,
+                                                     hipblasStride   stridex,
+                                                     double*         y,
+                                                     int             incy,
+                                                     hipblasStride   stridey,
+                                                     const double*   z,
+                                                     int             incz,
+                                                     hipblasStride   stridez,
+                                                     int             batch_count,
+                                                     double*         result)
+{
+    return hipblasDaxpyDotStridedBatched(handle,
+                                         n,
+                                         alpha,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         z,
+                                         incz,
+                                         stridez,
+                                         batch_count,
+                                         result);
+}
+
+template <>
+hipblasStatus_t hipblasAxpyDotStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                             int                   n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int                   incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int                   incy,
+                                                             hipblasStride         stridey,
+                                                             const hipblasComplex* z,
+                                                             int                   incz,
+                                                             hipblasStride         stridez,
+                                                             int                   batch_count,
+                                                             hipblasComplex*       result)
+{
+    return hipblasCaxpyDotStridedBatched(handle,
+                                         n,
+                                         alpha,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         z,
+                                         incz,
+                                         stridez,
+                                         batch_count,
+                                         result);
 }
 
-// swap_batched
 template <>
-hipblasStatus_t hipblasSwapBatched<float>(
-    hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batch_count)
+hipblasStatus_t
+    hipblasAxpyDotStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* alpha,
+                                                       const hipblasDoubleComplex* x,
+                                                       int                         incx,
+                                                       hipblasStride               stridex,
+                                                       hipblasDoubleComplex*       y,
+                                                       int                         incy,
+                                                       hipblasStride               stridey,
+                                                       const hipblasDoubleComplex* z,
+                                                       int                         incz,
+                                                       hipblasStride               stridez,
+                                                       int                         batch_count,
+                                                       hipblasDoubleComplex*       result)
 {
-    return hipblasSswapBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasZaxpyDotStridedBatched(handle,
+                                         n,
+                                         alpha,
+                                         x,
+                                         incx,
+                                         stridex,
+                                         y,
+                                         incy,
+                                         stridey,
+                                         z,
+                                         incz,
+                                         stridez,
+                                         batch_count,
+                                         result);
 }
 
+// dot_multi
 template <>
-hipblasStatus_t hipblasSwapBatched<double>(
-    hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batch_count)
+hipblasStatus_t hipblasDotMulti<hipblasHalf>(hipblasHandle_t    handle,
+                                             int                n,
+                                             int                k,
+                                             const hipblasHalf* x,
+                                             int                incx,
+                                             const hipblasHalf* Y,
+                                             int                ldy,
+                                             hipblasHalf*       result)
 {
-    return hipblasDswapBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasHdotMulti(handle, n, k, x, incx, Y, ldy, result);
 }
 
 template <>
-hipblasStatus_t hipblasSwapBatched<hipblasComplex>(hipblasHandle_t handle,
-                                                   int             n,
-                                                   hipblasComplex* x[],
-                                                   int             incx,
-                                                   hipblasComplex* y[],
-                                                   int             incy,
-                                                   int             batch_count)
+hipblasStatus_t hipblasDotMulti<float>(hipblasHandle_t handle,
+                                       int             n,
+                                       int             k,
+                                       const float*    x,
+                                       int             incx,
+                                       const float*    Y,
+                                       int             ldy,
+                                       float*          result)
 {
-    return hipblasCswapBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasSdotMulti(handle, n, k, x, incx, Y, ldy, result);
 }
 
 template <>
-hipblasStatus_t hipblasSwapBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                         int                   n,
-                                                         hipblasDoubleComplex* x[],
-                                                         int                   incx,
-                                                         hipblasDoubleComplex* y[],
-                                                         int                   incy,
-                                                         int                   batch_count)
+hipblasStatus_t hipblasDotMulti<double>(hipblasHandle_t handle,
+                                        int             n,
+                                        int             k,
+                                        const double*   x,
+                                        int             incx,
+                                        const double*   Y,
+                                        int             ldy,
+                                        double*         result)
 {
-    return hipblasZswapBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasDdotMulti(handle, n, k, x, incx, Y, ldy, result);
 }
 
-// swap_strided_batched
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<float>(hipblasHandle_t handle,
-                                                 int             n,
-                                                 float*          x,
-                                                 int             incx,
-                                                 hipblasStride   stridex,
-                                                 float*          y,
-                                                 int             incy,
-                                                 hipblasStride   stridey,
-                                                 int             batch_count)
+hipblasStatus_t hipblasDotMulti<hipblasComplex>(hipblasHandle_t       handle,
+                                                int                   n,
+                                                int                   k,
+                                                const hipblasComplex* x,
+                                                int                   incx,
+                                                const hipblasComplex* Y,
+                                                int                   ldy,
+                                                hipblasComplex*       result)
 {
-    return hipblasSswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasCdotMulti(handle, n, k, x, incx, Y, ldy, result);
 }
 
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<double>(hipblasHandle_t handle,
-                                                  int             n,
-                                                  double*         x,
-                                                  int             incx,
-                                                  hipblasStride   stridex,
-                                                  double*         y,
-                                                  int             incy,
-                                                  hipblasStride   stridey,
-                                                  int             batch_count)
+hipblasStatus_t hipblasDotMulti<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasDoubleComplex* x,
+                                                      int                         incx,
+                                                      const hipblasDoubleComplex* Y,
+                                                      int                         ldy,
+                                                      hipblasDoubleComplex*       result)
 {
-    return hipblasDswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasZdotMulti(handle, n, k, x, incx, Y, ldy, result);
 }
 
+// dot_multi_batched
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<hipblasComplex>(hipblasHandle_t handle,
-                                                          int             n,
-                                                          hipblasComplex* x,
-                                                          int             incx,
-                                                          hipblasStride   stridex,
-                                                          hipblasComplex* y,
-                                                          int             incy,
-                                                          hipblasStride   stridey,
-                                                          int             batch_count)
+hipblasStatus_t hipblasDotMultiBatched<hipblasHalf>(hipblasHandle_t          handle,
+                                                    int                      n,
+                                                    int                      k,
+                                                    const hipblasHalf* const x[],
+                                                    int                      incx,
+                                                    const hipblasHalf* const Y[],
+                                                    int                      ldy,
+                                                    int                      batch_count,
+                                                    hipblasHalf*             result)
 {
-    return hipblasCswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasHdotMultiBatched(handle, n, k, x, incx, Y, ldy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasSwapStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                                int                   n,
-                                                                hipblasDoubleComplex* x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                hipblasDoubleComplex* y,
-                                                                int                   incy,
-                                                                hipblasStride         stridey,
-                                                                int                   batch_count)
+hipblasStatus_t hipblasDotMultiBatched<float>(hipblasHandle_t    handle,
+                                              int                n,
+                                              int                k,
+                                              const float* const x[],
+                                              int                incx,
+                                              const float* const Y[],
+                                              int                ldy,
+                                              int                batch_count,
+                                              float*             result)
 {
-    return hipblasZswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasSdotMultiBatched(handle, n, k, x, incx, Y, ldy, batch_count, result);
 }
 
-// copy
 template <>
-hipblasStatus_t
-    hipblasCopy<float>(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
+hipblasStatus_t hipblasDotMultiBatched<double>(hipblasHandle_t     handle,
+                                               int                 n,
+                                               int                 k,
+                                               const double* const x[],
+                                               int                 incx,
+                                               const double* const Y[],
+                                               int                 ldy,
+                                               int                 batch_count,
+                                               double*             result)
 {
-    return hipblasScopy(handle, n, x, incx, y, incy);
+    return hipblasDdotMultiBatched(handle, n, k, x, incx, Y, ldy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopy<double>(
-    hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
+hipblasStatus_t hipblasDotMultiBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                       int                         n,
+                                                       int                         k,
+                                                       const hipblasComplex* const x[],
+                                                       int                         incx,
+                                                       const hipblasComplex* const Y[],
+                                                       int                         ldy,
+                                                       int                         batch_count,
+                                                       hipblasComplex*             result)
 {
-    return hipblasDcopy(handle, n, x, incx, y, incy);
+    return hipblasCdotMultiBatched(handle, n, k, x, incx, Y, ldy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopy<hipblasComplex>(
-    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
+hipblasStatus_t
+    hipblasDotMultiBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                 int                               n,
+                                                 int                               k,
+                                                 const hipblasDoubleComplex* const x[],
+                                                 int                               incx,
+                                                 const hipblasDoubleComplex* const Y[],
+                                                 int                               ldy,
+                                                 int                               batch_count,
+                                                 hipblasDoubleComplex*             result)
 {
-    return hipblasCcopy(handle, n, x, incx, y, incy);
+    return hipblasZdotMultiBatched(handle, n, k, x, incx, Y, ldy, batch_count, result);
 }
 
+// dot_multi_strided_batched
 template <>
-hipblasStatus_t hipblasCopy<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  int                         n,
-                                                  const hipblasDoubleComplex* x,
-                                                  int                         incx,
-                                                  hipblasDoubleComplex*       y,
-                                                  int                         incy)
+hipblasStatus_t hipblasDotMultiStridedBatched<hipblasHalf>(hipblasHandle_t    handle,
+                                                           int                n,
+                                                           int                k,
+                                                           const hipblasHalf* x,
+                                                           int                incx,
+                                                           hipblasStride      stridex,
+                                                           const hipblasHalf* Y,
+                                                           int                ldy,
+                                                           hipblasStride      strideY,
+                                                           int                batch_count,
+                                                           hipblasHalf*       result)
 {
-    return hipblasZcopy(handle, n, x, incx, y, incy);
+    return hipblasHdotMultiStridedBatched(
+        handle, n, k, x, incx, stridex, Y, ldy, strideY, batch_count, result);
 }
 
-// copy_batched
 template <>
-hipblasStatus_t hipblasCopyBatched<float>(hipblasHandle_t    handle,
-                                          int                n,
-                                          const float* const x[],
-                                          int                incx,
-                                          float* const       y[],
-                                          int                incy,
-                                          int                batch_count)
+hipblasStatus_t hipblasDotMultiStridedBatched<float>(hipblasHandle_t handle,
+                                                     int             n,
+                                                     int             k,
+                                                     const float*    x,
+                                                     int             incx,
+                                                     hipblasStride   stridex,
+                                                     const float*    Y,
+                                                     int             ldy,
+                                                     hipblasStride   strideY,
+                                                     int             batch_count,
+                                                     float*          result)
 {
-    return hipblasScopyBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasSdotMultiStridedBatched(
+        handle, n, k, x, incx, stridex, Y, ldy, strideY, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopyBatched<double>(hipblasHandle_t     handle,
-                                           int                 n,
-                                           const double* const x[],
-                                           int                 incx,
-                                           double* const       y[],
-                                           int                 incy,
-                                           int                 batch_count)
+hipblasStatus_t hipblasDotMultiStridedBatched<double>(hipblasHandle_t handle,
+                                                      int             n,
+                                                      int             k,
+                                                      const double*   x,
+                                                      int             incx,
+                                                      hipblasStride   stridex,
+                                                      const double*   Y,
+                                                      int             ldy,
+                                                      hipblasStride   strideY,
+                                                      int             batch_count,
+                                                      double*         result)
 {
-    return hipblasDcopyBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasDdotMultiStridedBatched(
+        handle, n, k, x, incx, stridex, Y, ldy, strideY, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopyBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   int                         n,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   hipblasComplex* const       y[],
-                                                   int                         incy,
-                                                   int                         batch_count)
+hipblasStatus_t hipblasDotMultiStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                              int                   n,
+                                                              int                   k,
+                                                              const hipblasComplex* x,
+                                                              int                   incx,
+                                                              hipblasStride         stridex,
+                                                              const hipblasComplex* Y,
+                                                              int                   ldy,
+                                                              hipblasStride         strideY,
+                                                              int                   batch_count,
+                                                              hipblasComplex*       result)
 {
-    return hipblasCcopyBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasCdotMultiStridedBatched(
+        handle, n, k, x, incx, stridex, Y, ldy, strideY, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopyBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         int                               n,
-                                                         const hipblasDoubleComplex* const x[],
-                                                         int                               incx,
-                                                         hipblasDoubleComplex* const       y[],
-                                                         int                               incy,
-                                                         int batch_count)
+hipblasStatus_t
+    hipblasDotMultiStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                        int                         n,
+                                                        int                         k,
+                                                        const hipblasDoubleComplex* x,
+                                                        int                         incx,
+                                                        hipblasStride               stridex,
+                                                        const hipblasDoubleComplex* Y,
+                                                        int                         ldy,
+                                                        hipblasStride               strideY,
+                                                        int                         batch_count,
+                                                        hipblasDoubleComplex*       result)
 {
-    return hipblasZcopyBatched(handle, n, x, incx, y, incy, batch_count);
+    return hipblasZdotMultiStridedBatched(
+        handle, n, k, x, incx, stridex, Y, ldy, strideY, batch_count, result);
 }
 
-// copy_strided_batched
+// normalize
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<float>(hipblasHandle_t handle,
-                                                 int             n,
-                                                 const float*    x,
-                                                 int             incx,
-                                                 hipblasStride   stridex,
-                                                 float*          y,
-                                                 int             incy,
-                                                 hipblasStride   stridey,
-                                                 int             batch_count)
+hipblasStatus_t hipblasNormalize<float, float>(hipblasHandle_t handle,
+                                               int             n,
+                                               float*          x,
+                                               int             incx,
+                                               float*          result)
 {
-    return hipblasScopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasSnormalize(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<double>(hipblasHandle_t handle,
-                                                  int             n,
-                                                  const double*   x,
-                                                  int             incx,
-                                                  hipblasStride   stridex,
-                                                  double*         y,
-                                                  int             incy,
-                                                  hipblasStride   stridey,
-                                                  int             batch_count)
+hipblasStatus_t hipblasNormalize<double, double>(hipblasHandle_t handle,
+                                                 int             n,
+                                                 double*         x,
+                                                 int             incx,
+                                                 double*         result)
 {
-    return hipblasDcopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasDnormalize(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          int                   n,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batch_count)
+hipblasStatus_t hipblasNormalize<hipblasComplex, float>(hipblasHandle_t handle,
+                                                        int             n,
+                                                        hipblasComplex* x,
+                                                        int             incx,
+                                                        float*          result)
 {
-    return hipblasCcopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasCnormalize(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasCopyStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                int                         n,
-                                                                const hipblasDoubleComplex* x,
-                                                                int                         incx,
-                                                                hipblasStride               stridex,
-                                                                hipblasDoubleComplex*       y,
-                                                                int                         incy,
-                                                                hipblasStride               stridey,
-                                                                int batch_count)
+hipblasStatus_t hipblasNormalize<hipblasDoubleComplex, double>(hipblasHandle_t       handle,
+                                                               int                   n,
+                                                               hipblasDoubleComplex* x,
+                                                               int                   incx,
+                                                               double*               result)
 {
-    return hipblasZcopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    return hipblasZnormalize(handle, n, x, incx, result);
 }
 
-// dot
+// normalize_batched
 template <>
-hipblasStatus_t hipblasDot<hipblasHalf>(hipblasHandle_t    handle,
-                                        int                n,
-                                        const hipblasHalf* x,
-                                        int                incx,
-                                        const hipblasHalf* y,
-                                        int                incy,
-                                        hipblasHalf*       result)
+hipblasStatus_t hipblasNormalizeBatched<float, float>(hipblasHandle_t handle,
+                                                      int             n,
+                                                      float* const    x[],
+                                                      int             incx,
+                                                      int             batch_count,
+                                                      float*          result)
 {
-    return hipblasHdot(handle, n, x, incx, y, incy, result);
+    return hipblasSnormalizeBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasDot<hipblasBfloat16>(hipblasHandle_t        handle,
-                                            int                    n,
-                                            const hipblasBfloat16* x,
-                                            int                    incx,
-                                            const hipblasBfloat16* y,
-                                            int                    incy,
-                                            hipblasBfloat16*       result)
+hipblasStatus_t hipblasNormalizeBatched<double, double>(hipblasHandle_t handle,
+                                                        int             n,
+                                                        double* const   x[],
+                                                        int             incx,
+                                                        int             batch_count,
+                                                        double*         result)
 {
-    return hipblasBfdot(handle, n, x, incx, y, incy, result);
+    return hipblasDnormalizeBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasDot<float>(hipblasHandle_t handle,
-                                  int             n,
-                                  const float*    x,
-                                  int             incx,
-                                  const float*    y,
-                                  int             incy,
-                                  float*          result)
+hipblasStatus_t hipblasNormalizeBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                               int                   n,
+                                                               hipblasComplex* const x[],
+                                                               int                   incx,
+                                                               int                   batch_count,
+                                                               float*                result)
 {
-    return hipblasSdot(handle, n, x, incx, y, incy, result);
+    return hipblasCnormalizeBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasDot<double>(hipblasHandle_t handle,
-                                   int             n,
-                                   const double*   x,
-                                   int             incx,
-                                   const double*   y,
-                                   int             incy,
-                                   double*         result)
+hipblasStatus_t
+    hipblasNormalizeBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                          int                         n,
+                                                          hipblasDoubleComplex* const x[],
+                                                          int                         incx,
+                                                          int                         batch_count,
+                                                          double*                     result)
 {
-    return hipblasDdot(handle, n, x, incx, y, incy, result);
+    return hipblasZnormalizeBatched(handle, n, x, incx, batch_count, result);
 }
 
+// normalize_strided_batched
 template <>
-hipblasStatus_t hipblasDot<hipblasComplex>(hipblasHandle_t       handle,
-                                           int                   n,
-                                           const hipblasComplex* x,
-                                           int                   incx,
-                                           const hipblasComplex* y,
-                                           int                   incy,
-                                           hipblasComplex*       result)
+hipblasStatus_t hipblasNormalizeStridedBatched<float, float>(hipblasHandle_t handle,
+                                                             int             n,
+                                                             float*          x,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             int             batch_count,
+                                                             float*          result)
 {
-    return hipblasCdotu(handle, n, x, incx, y, incy, result);
+    return hipblasSnormalizeStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasDot<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                 int                         n,
-                                                 const hipblasDoubleComplex* x,
-                                                 int                         incx,
-                                                 const hipblasDoubleComplex* y,
-                                                 int                         incy,
-                                                 hipblasDoubleComplex*       result)
+hipblasStatus_t hipblasNormalizeStridedBatched<double, double>(hipblasHandle_t handle,
+                                                               int             n,
+                                                               double*         x,
+                                                               int             incx,
+                                                               hipblasStride   stridex,
+                                                               int             batch_count,
+                                                               double*         result)
 {
-    return hipblasZdotu(handle, n, x, incx, y, incy, result);
+    return hipblasDnormalizeStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasDotc<hipblasComplex>(hipblasHandle_t       handle,
-                                            int                   n,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* y,
-                                            int                   incy,
-                                            hipblasComplex*       result)
+hipblasStatus_t hipblasNormalizeStridedBatched<hipblasComplex, float>(hipblasHandle_t handle,
+                                                                      int             n,
+                                                                      hipblasComplex* x,
+                                                                      int             incx,
+                                                                      hipblasStride   stridex,
+                                                                      int             batch_count,
+                                                                      float*          result)
 {
-    return hipblasCdotc(handle, n, x, incx, y, incy, result);
+    return hipblasCnormalizeStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasDotc<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  int                         n,
-                                                  const hipblasDoubleComplex* x,
-                                                  int                         incx,
-                                                  const hipblasDoubleComplex* y,
-                                                  int                         incy,
-                                                  hipblasDoubleComplex*       result)
+hipblasStatus_t
+    hipblasNormalizeStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t       handle,
+                                                                 int                   n,
+                                                                 hipblasDoubleComplex* x,
+                                                                 int                   incx,
+                                                                 hipblasStride         stridex,
+                                                                 int                   batch_count,
+                                                                 double*               result)
 {
-    return hipblasZdotc(handle, n, x, incx, y, incy, result);
+    return hipblasZnormalizeStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
-// dot_batched
+// scal
 template <>
-hipblasStatus_t hipblasDotBatched<hipblasHalf>(hipblasHandle_t          handle,
-                                               int                      n,
-                                               const hipblasHalf* const x[],
-                                               int                      incx,
-                                               const hipblasHalf* const y[],
-                                               int                      incy,
-                                               int                      batch_count,
-                                               hipblasHalf*             result)
+hipblasStatus_t
+    hipblasScal<float>(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx)
 {
-    return hipblasHdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasSscal(handle, n, alpha, x, incx);
 }
 
 template <>
-hipblasStatus_t hipblasDotBatched<hipblasBfloat16>(hipblasHandle_t              handle,
-                                                   int                          n,
-                                                   const hipblasBfloat16* const x[],
-                                                   int                          incx,
-                                                   const hipblasBfloat16* const y[],
-                                                   int                          incy,
-                                                   int                          batch_count,
-                                                   hipblasBfloat16*             result)
+hipblasStatus_t
+    hipblasScal<double>(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx)
 {
-    return hipblasBfdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasDscal(handle, n, alpha, x, incx);
 }
 
 template <>
-hipblasStatus_t hipblasDotBatched<float>(hipblasHandle_t    handle,
-                                         int                n,
-                                         const float* const x[],
-                                         int                incx,
-                                         const float* const y[],
-                                         int                incy,
-                                         int                batch_count,
-                                         float*             result)
+hipblasStatus_t hipblasScal<hipblasComplex>(
+    hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx)
 {
-    return hipblasSdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasCscal(handle, n, alpha, x, incx);
 }
 
 template <>
-hipblasStatus_t hipblasDotBatched<double>(hipblasHandle_t     handle,
-                                          int                 n,
-                                          const double* const x[],
-                                          int                 incx,
-                                          const double* const y[],
-                                          int                 incy,
-                                          int                 batch_count,
-                                          double*             result)
+hipblasStatus_t hipblasScal<hipblasComplex, float>(
+    hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx)
 {
-    return hipblasDdotBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasCsscal(handle, n, alpha, x, incx);
 }
 
 template <>
-hipblasStatus_t hipblasDotBatched<hipblasComplex>(hipblasHandle_t             handle,
+hipblasStatus_t hipblasScal<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                   int                         n,
-                                                  const hipblasComplex* const x[],
-                                                  int                         incx,
-                                                  const hipblasComplex* const y[],
-                                                  int                         incy,
-                                                  int                         batch_count,
-                                                  hipblasComplex*             result)
+                                                  const hipblasDoubleComplex* alpha,
+                                                  hipblasDoubleComplex*       x,
+                                                  int                         incx)
 {
-    return hipblasCdotuBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasZscal(handle, n, alpha, x, incx);
 }
 
 template <>
-hipblasStatus_t hipblasDotcBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   int                         n,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex* const y[],
-                                                   int                         incy,
-                                                   int                         batch_count,
-                                                   hipblasComplex*             result)
+hipblasStatus_t hipblasScal<hipblasDoubleComplex, double>(
+    hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
 {
-    return hipblasCdotcBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasZdscal(handle, n, alpha, x, incx);
 }
 
+// scal_batched
 template <>
-hipblasStatus_t hipblasDotBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                        int                               n,
-                                                        const hipblasDoubleComplex* const x[],
-                                                        int                               incx,
-                                                        const hipblasDoubleComplex* const y[],
-                                                        int                               incy,
-                                                        int                   batch_count,
-                                                        hipblasDoubleComplex* result)
+hipblasStatus_t hipblasScalBatched<float>(
+    hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batch_count)
 {
-    return hipblasZdotuBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasSscalBatched(handle, n, alpha, x, incx, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasDotcBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         int                               n,
-                                                         const hipblasDoubleComplex* const x[],
-                                                         int                               incx,
-                                                         const hipblasDoubleComplex* const y[],
-                                                         int                               incy,
-                                                         int                   batch_count,
-                                                         hipblasDoubleComplex* result)
+hipblasStatus_t hipblasScalBatched<double>(hipblasHandle_t handle,
+                                           int             n,
+                                           const double*   alpha,
+                                           double* const   x[],
+                                           int             incx,
+                                           int             batch_count)
 {
-    return hipblasZdotcBatched(handle, n, x, incx, y, incy, batch_count, result);
+    return hipblasDscalBatched(handle, n, alpha, x, incx, batch_count);
 }
 
-// dot_strided_batched
 template <>
-hipblasStatus_t hipblasDotStridedBatched<hipblasHalf>(hipblasHandle_t    handle,
-                                                      int                n,
-                                                      const hipblasHalf* x,
-                                                      int                incx,
-                                                      hipblasStride      stridex,
-                                                      const hipblasHalf* y,
-                                                      int                incy,
-                                                      hipblasStride      stridey,
-                                                      int                batch_count,
-                                                      hipblasHalf*       result)
+hipblasStatus_t hipblasScalBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                   int                   n,
+                                                   const hipblasComplex* alpha,
+                                                   hipblasComplex* const x[],
+                                                   int                   incx,
+                                                   int                   batch_count)
 {
-    return hipblasHdotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    return hipblasCscalBatched(handle, n, alpha, x, incx, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasDotStridedBatched<hipblasBfloat16>(hipblasHandle_t        handle,
-                                                          int                    n,
-                                                          const hipblasBfloat16* x,
-                                                          int                    incx,
-                                                          hipblasStride          stridex,
-                                                          const hipblasBfloat16* y,
-                                                          int                    incy,
-                                                          hipblasStride          stridey,
-                                                          int                    batch_count,
-                                                          hipblasBfloat16*       result)
+hipblasStatus_t hipblasScalBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         int                         n,
+                                                         const hipblasDoubleComplex* alpha,
+                                                         hipblasDoubleComplex* const x[],
+                                                         int                         incx,
+                                                         int                         batch_count)
 {
-    return hipblasBfdotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    return hipblasZscalBatched(handle, n, alpha, x, incx, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasDotStridedBatched<float>(hipblasHandle_t handle,
-                                                int             n,
-                                                const float*    x,
-                                                int             incx,
-                                                hipblasStride   stridex,
-                                                const float*    y,
-                                                int             incy,
-                                                hipblasStride   stridey,
-                                                int             batch_count,
-                                                float*          result)
+hipblasStatus_t hipblasScalBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                          int                   n,
+                                                          const float*          alpha,
+                                                          hipblasComplex* const x[],
+                                                          int                   incx,
+                                                          int                   batch_count)
 {
-    return hipblasSdotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    return hipblasCsscalBatched(handle, n, alpha, x, incx, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasDotStridedBatched<double>(hipblasHandle_t handle,
+hipblasStatus_t hipblasScalBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                                 int                         n,
+                                                                 const double*               alpha,
+                                                                 hipblasDoubleComplex* const x[],
+                                                                 int                         incx,
+                                                                 int batch_count)
+{
+    return hipblasZdscalBatched(handle, n, alpha, x, incx, batch_count);
+}
+
+// scal_strided_batched
+template <>
+hipblasStatus_t hipblasScalStridedBatched<float>(hipblasHandle_t handle,
                                                  int             n,
-                                                 const double*   x,
+                                                 const float*    alpha,
+                                                 float*          x,
                                                  int             incx,
                                                  hipblasStride   stridex,
-                                                 const double*   y,
-                                                 int             incy,
-                                                 hipblasStride   stridey,
-                                                 int             batch_count,
-                                                 double*         result)
+                                                 int             batch_count)
 {
-    return hipblasDdotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    return hipblasSscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasDotStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                         int                   n,
-                                                         const hipblasComplex* x,
-                                                         int                   incx,
-                                                         hipblasStride         stridex,
-                                                         const hipblasComplex* y,
-                                                         int                   incy,
-                                                         hipblasStride         stridey,
-                                                         int                   batch_count,
-                                                         hipblasComplex*       result)
+hipblasStatus_t hipblasScalStridedBatched<double>(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const double*   alpha,
+                                                  double*         x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  int             batch_count)
 {
-    return hipblasCdotuStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    return hipblasDscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasDotcStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+hipblasStatus_t hipblasScalStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
                                                           int                   n,
-                                                          const hipblasComplex* x,
+                                                          const hipblasComplex* alpha,
+                                                          hipblasComplex*       x,
                                                           int                   incx,
                                                           hipblasStride         stridex,
-                                                          const hipblasComplex* y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batch_count,
-                                                          hipblasComplex*       result)
-{
-    return hipblasCdotcStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
-}
-
-template <>
-hipblasStatus_t hipblasDotStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                               int                         n,
-                                                               const hipblasDoubleComplex* x,
-                                                               int                         incx,
-                                                               hipblasStride               stridex,
-                                                               const hipblasDoubleComplex* y,
-                                                               int                         incy,
-                                                               hipblasStride               stridey,
-                                                               int                   batch_count,
-                                                               hipblasDoubleComplex* result)
+                                                          int                   batch_count)
 {
-    return hipblasZdotuStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    return hipblasCscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasDotcStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+hipblasStatus_t hipblasScalStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                                 int                         n,
-                                                                const hipblasDoubleComplex* x,
+                                                                const hipblasDoubleComplex* alpha,
+                                                                hipblasDoubleComplex*       x,
                                                                 int                         incx,
                                                                 hipblasStride               stridex,
-                                                                const hipblasDoubleComplex* y,
-                                                                int                         incy,
-                                                                hipblasStride               stridey,
-                                                                int                   batch_count,
-                                                                hipblasDoubleComplex* result)
+                                                                int batch_count)
 {
-    return hipblasZdotcStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+    return hipblasZscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
 }
 
-// asum
 template <>
-hipblasStatus_t hipblasAsum<float, float>(
-    hipblasHandle_t handle, int n, const float* x, int incx, float* result)
+hipblasStatus_t hipblasScalStridedBatched<hipblasComplex, float>(hipblasHandle_t handle,
+                                                                 int             n,
+                                                                 const float*    alpha,
+                                                                 hipblasComplex* x,
+                                                                 int             incx,
+                                                                 hipblasStride   stridex,
+                                                                 int             batch_count)
 {
-
-    return hipblasSasum(handle, n, x, incx, result);
+    return hipblasCsscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasAsum<double, double>(
-    hipblasHandle_t handle, int n, const double* x, int incx, double* result)
+hipblasStatus_t hipblasScalStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t handle,
+                                                                        int             n,
+                                                                        const double*   alpha,
+                                                                        hipblasDoubleComplex* x,
+                                                                        int                   incx,
+                                                                        hipblasStride stridex,
+                                                                        int           batch_count)
 {
-
-    return hipblasDasum(handle, n, x, incx, result);
+    return hipblasZdscalStridedBatched(handle, n, alpha, x, incx, stridex, batch_count);
 }
 
+//swap
 template <>
-hipblasStatus_t hipblasAsum<hipblasComplex, float>(
-    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
+hipblasStatus_t
+    hipblasSwap<float>(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy)
 {
-
-    return hipblasScasum(handle, n, x, incx, result);
+    return hipblasSswap(handle, n, x, incx, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasAsum<hipblasDoubleComplex, double>(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
+hipblasStatus_t
+    hipblasSwap<double>(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy)
 {
-
-    return hipblasDzasum(handle, n, x, incx, result);
+    return hipblasDswap(handle, n, x, incx, y, incy);
 }
 
-// asum_batched
 template <>
-hipblasStatus_t hipblasAsumBatched<float, float>(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, float* result)
+hipblasStatus_t hipblasSwap<hipblasComplex>(
+    hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 {
+    return hipblasCswap(handle, n, x, incx, y, incy);
+}
 
-    return hipblasSasumBatched(handle, n, x, incx, batch_count, result);
+template <>
+hipblasStatus_t hipblasSwap<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                  int                   n,
+                                                  hipblasDoubleComplex* x,
+                                                  int                   incx,
+                                                  hipblasDoubleComplex* y,
+                                                  int                   incy)
+{
+    return hipblasZswap(handle, n, x, incx, y, incy);
 }
 
+// swap_batched
 template <>
-hipblasStatus_t hipblasAsumBatched<double, double>(hipblasHandle_t     handle,
-                                                   int                 n,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   int                 batch_count,
-                                                   double*             result)
+hipblasStatus_t hipblasSwapBatched<float>(
+    hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batch_count)
 {
-
-    return hipblasDasumBatched(handle, n, x, incx, batch_count, result);
+    return hipblasSswapBatched(handle, n, x, incx, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasAsumBatched<hipblasComplex, float>(hipblasHandle_t             handle,
-                                                          int                         n,
-                                                          const hipblasComplex* const x[],
-                                                          int                         incx,
-                                                          int                         batch_count,
-                                                          float*                      result)
+hipblasStatus_t hipblasSwapBatched<double>(
+    hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batch_count)
 {
-
-    return hipblasScasumBatched(handle, n, x, incx, batch_count, result);
+    return hipblasDswapBatched(handle, n, x, incx, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t
-    hipblasAsumBatched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
-                                                     int                               n,
-                                                     const hipblasDoubleComplex* const x[],
-                                                     int                               incx,
-                                                     int                               batch_count,
-                                                     double*                           result)
+hipblasStatus_t hipblasSwapBatched<hipblasComplex>(hipblasHandle_t handle,
+                                                   int             n,
+                                                   hipblasComplex* x[],
+                                                   int             incx,
+                                                   hipblasComplex* y[],
+                                                   int             incy,
+                                                   int             batch_count)
 {
+    return hipblasCswapBatched(handle, n, x, incx, y, incy, batch_count);
+}
 
-    return hipblasDzasumBatched(handle, n, x, incx, batch_count, result);
+template <>
+hipblasStatus_t hipblasSwapBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                         int                   n,
+                                                         hipblasDoubleComplex* x[],
+                                                         int                   incx,
+                                                         hipblasDoubleComplex* y[],
+                                                         int                   incy,
+                                                         int                   batch_count)
+{
+    return hipblasZswapBatched(handle, n, x, incx, y, incy, batch_count);
 }
 
-// asum_strided_batched
+// swap_strided_batched
 template <>
-hipblasStatus_t hipblasAsumStridedBatched<float, float>(hipblasHandle_t handle,
-                                                        int             n,
-                                                        const float*    x,
-                                                        int             incx,
-                                                        hipblasStride   stridex,
-                                                        int             batch_count,
-                                                        float*          result)
+hipblasStatus_t hipblasSwapStridedBatched<float>(hipblasHandle_t handle,
+                                                 int             n,
+                                                 float*          x,
+                                                 int             incx,
+                                                 hipblasStride   stridex,
+                                                 float*          y,
+                                                 int             incy,
+                                                 hipblasStride   stridey,
+                                                 int             batch_count)
 {
+    return hipblasSswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+}
 
-    return hipblasSasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+template <>
+hipblasStatus_t hipblasSwapStridedBatched<double>(hipblasHandle_t handle,
+                                                  int             n,
+                                                  double*         x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  double*         y,
+                                                  int             incy,
+                                                  hipblasStride   stridey,
+                                                  int             batch_count)
+{
+    return hipblasDswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasAsumStridedBatched<double, double>(hipblasHandle_t handle,
+hipblasStatus_t hipblasSwapStridedBatched<hipblasComplex>(hipblasHandle_t handle,
                                                           int             n,
-                                                          const double*   x,
+                                                          hipblasComplex* x,
                                                           int             incx,
                                                           hipblasStride   stridex,
-                                                          int             batch_count,
-                                                          double*         result)
+                                                          hipblasComplex* y,
+                                                          int             incy,
+                                                          hipblasStride   stridey,
+                                                          int             batch_count)
 {
-
-    return hipblasDasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasCswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasAsumStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                                 int                   n,
-                                                                 const hipblasComplex* x,
-                                                                 int                   incx,
-                                                                 hipblasStride         stridex,
-                                                                 int                   batch_count,
-                                                                 float*                result)
+hipblasStatus_t hipblasSwapStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                int                   n,
+                                                                hipblasDoubleComplex* x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                hipblasDoubleComplex* y,
+                                                                int                   incy,
+                                                                hipblasStride         stridey,
+                                                                int                   batch_count)
 {
-
-    return hipblasScasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasZswapStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
+// copy
 template <>
 hipblasStatus_t
-    hipblasAsumStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                            int                         n,
-                                                            const hipblasDoubleComplex* x,
-                                                            int                         incx,
-                                                            hipblasStride               stridex,
-                                                            int                         batch_count,
-                                                            double*                     result)
+    hipblasCopy<float>(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy)
 {
-
-    return hipblasDzasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasScopy(handle, n, x, incx, y, incy);
 }
 
-// nrm2
 template <>
-hipblasStatus_t hipblasNrm2<float, float>(
-    hipblasHandle_t handle, int n, const float* x, int incx, float* result)
+hipblasStatus_t hipblasCopy<double>(
+    hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy)
 {
-
-    return hipblasSnrm2(handle, n, x, incx, result);
+    return hipblasDcopy(handle, n, x, incx, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasNrm2<double, double>(
-    hipblasHandle_t handle, int n, const double* x, int incx, double* result)
+hipblasStatus_t hipblasCopy<hipblasComplex>(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy)
 {
-
-    return hipblasDnrm2(handle, n, x, incx, result);
+    return hipblasCcopy(handle, n, x, incx, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasNrm2<hipblasComplex, float>(
-    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
+hipblasStatus_t hipblasCopy<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  hipblasDoubleComplex*       y,
+                                                  int                         incy)
 {
-
-    return hipblasScnrm2(handle, n, x, incx, result);
+    return hipblasZcopy(handle, n, x, incx, y, incy);
 }
 
+// copy_batched
 template <>
-hipblasStatus_t hipblasNrm2<hipblasDoubleComplex, double>(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
+hipblasStatus_t hipblasCopyBatched<float>(hipblasHandle_t    handle,
+                                          int                n,
+                                          const float* const x[],
+                                          int                incx,
+                                          float* const       y[],
+                                          int                incy,
+                                          int                batch_count)
 {
-
-    return hipblasDznrm2(handle, n, x, incx, result);
+    return hipblasScopyBatched(handle, n, x, incx, y, incy, batch_count);
 }
 
-// nrm2_batched
 template <>
-hipblasStatus_t hipblasNrm2Batched<float, float>(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, float* result)
+hipblasStatus_t hipblasCopyBatched<double>(hipblasHandle_t     handle,
+                                           int                 n,
+                                           const double* const x[],
+                                           int                 incx,
+                                           double* const       y[],
+                                           int                 incy,
+                                           int                 batch_count)
 {
-
-    return hipblasSnrm2Batched(handle, n, x, incx, batch_count, result);
+    return hipblasDcopyBatched(handle, n, x, incx, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasNrm2Batched<double, double>(hipblasHandle_t     handle,
-                                                   int                 n,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   int                 batch_count,
-                                                   double*             result)
+hipblasStatus_t hipblasCopyBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   int                         n,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   hipblasComplex* const       y[],
+                                                   int                         incy,
+                                                   int                         batch_count)
 {
-
-    return hipblasDnrm2Batched(handle, n, x, incx, batch_count, result);
+    return hipblasCcopyBatched(handle, n, x, incx, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasNrm2Batched<hipblasComplex, float>(hipblasHandle_t             handle,
-                                                          int                         n,
-                                                          const hipblasComplex* const x[],
-                                                          int                         incx,
-                                                          int                         batch_count,
-                                                          float*                      result)
+hipblasStatus_t hipblasCopyBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         int                               n,
+                                                         const hipblasDoubleComplex* const x[],
+                                                         int                               incx,
+                                                         hipblasDoubleComplex* const       y[],
+                                                         int                               incy,
+                                                         int batch_count)
 {
-
-    return hipblasScnrm2Batched(handle, n, x, incx, batch_count, result);
+    return hipblasZcopyBatched(handle, n, x, incx, y, incy, batch_count);
 }
 
+// copy_strided_batched
 template <>
-hipblasStatus_t
-    hipblasNrm2Batched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
-                                                     int                               n,
-                                                     const hipblasDoubleComplex* const x[],
-                                                     int                               incx,
-                                                     int                               batch_count,
-                                                     double*                           result)
+hipblasStatus_t hipblasCopyStridedBatched<float>(hipblasHandle_t handle,
+                                                 int             n,
+                                                 const float*    x,
+                                                 int             incx,
+                                                 hipblasStride   stridex,
+                                                 float*          y,
+                                                 int             incy,
+                                                 hipblasStride   stridey,
+                                                 int             batch_count)
 {
-
-    return hipblasDznrm2Batched(handle, n, x, incx, batch_count, result);
+    return hipblasScopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
-// nrm2_strided_batched
 template <>
-hipblasStatus_t hipblasNrm2StridedBatched<float, float>(hipblasHandle_t handle,
-                                                        int             n,
-                                                        const float*    x,
-                                                        int             incx,
-                                                        hipblasStride   stridex,
-                                                        int             batch_count,
-                                                        float*          result)
+hipblasStatus_t hipblasCopyStridedBatched<double>(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const double*   x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  double*         y,
+                                                  int             incy,
+                                                  hipblasStride   stridey,
+                                                  int             batch_count)
 {
-
-    return hipblasSnrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasDcopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasNrm2StridedBatched<double, double>(hipblasHandle_t handle,
-                                                          int             n,
-                                                          const double*   x,
-                                                          int             incx,
-                                                          hipblasStride   stridex,
-                                                          int             batch_count,
-                                                          double*         result)
+hipblasStatus_t hipblasCopyStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          int                   n,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batch_count)
 {
-
-    return hipblasDnrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasCcopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasNrm2StridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                                 int                   n,
-                                                                 const hipblasComplex* x,
-                                                                 int                   incx,
-                                                                 hipblasStride         stridex,
-                                                                 int                   batch_count,
-                                                                 float*                result)
+hipblasStatus_t hipblasCopyStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                int                         n,
+                                                                const hipblasDoubleComplex* x,
+                                                                int                         incx,
+                                                                hipblasStride               stridex,
+                                                                hipblasDoubleComplex*       y,
+                                                                int                         incy,
+                                                                hipblasStride               stridey,
+                                                                int batch_count)
 {
-
-    return hipblasScnrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasZcopyStridedBatched(handle, n, x, incx, stridex, y, incy, stridey, batch_count);
 }
 
+// dot
 template <>
-hipblasStatus_t
-    hipblasNrm2StridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                            int                         n,
-                                                            const hipblasDoubleComplex* x,
-                                                            int                         incx,
-                                                            hipblasStride               stridex,
-                                                            int                         batch_count,
-                                                            double*                     result)
+hipblasStatus_t hipblasDot<hipblasHalf>(hipblasHandle_t    handle,
+                                        int                n,
+                                        const hipblasHalf* x,
+                                        int                incx,
+                                        const hipblasHalf* y,
+                                        int                incy,
+                                        hipblasHalf*       result)
 {
+    return hipblasHdot(handle, n, x, incx, y, incy, result);
+}
 
-    return hipblasDznrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
+template <>
+hipblasStatus_t hipblasDot<hipblasBfloat16>(hipblasHandle_t        handle,
+                                            int                    n,
+                                            const hipblasBfloat16* x,
+                                            int                    incx,
+                                            const hipblasBfloat16* y,
+                                            int                    incy,
+                                            hipblasBfloat16*       result)
+{
+    return hipblasBfdot(handle, n, x, incx, y, incy, result);
 }
 
-// rot
 template <>
-hipblasStatus_t hipblasRot<float>(hipblasHandle_t handle,
+hipblasStatus_t hipblasDot<float>(hipblasHandle_t handle,
                                   int             n,
-                                  float*          x,
+                                  const float*    x,
                                   int             incx,
-                                  float*          y,
+                                  const float*    y,
                                   int             incy,
-                                  const float*    c,
-                                  const float*    s)
+                                  float*          result)
 {
-    return hipblasSrot(handle, n, x, incx, y, incy, c, s);
+    return hipblasSdot(handle, n, x, incx, y, incy, result);
 }
 
 template <>
-hipblasStatus_t hipblasRot<double>(hipblasHandle_t handle,
+hipblasStatus_t hipblasDot<double>(hipblasHandle_t handle,
                                    int             n,
-                                   double*         x,
+                                   const double*   x,
                                    int             incx,
-                                   double*         y,
+                                   const double*   y,
                                    int             incy,
-                                   const double*   c,
-                                   const double*   s)
+                                   double*         result)
 {
-    return hipblasDrot(handle, n, x, incx, y, incy, c, s);
+    return hipblasDdot(handle, n, x, incx, y, incy, result);
 }
 
 template <>
-hipblasStatus_t hipblasRot<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                  int                   n,
-                                                  hipblasComplex*       x,
-                                                  int                   incx,
-                                                  hipblasComplex*       y,
-                                                  int                   incy,
-                                                  const float*          c,
-                                                  const hipblasComplex* s)
+hipblasStatus_t hipblasDot<hipblasComplex>(hipblasHandle_t       handle,
+                                           int                   n,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           const hipblasComplex* y,
+                                           int                   incy,
+                                           hipblasComplex*       result)
 {
-    return hipblasCrot(handle, n, x, incx, y, incy, c, s);
+    return hipblasCdotu(handle, n, x, incx, y, incy, result);
 }
 
 template <>
-hipblasStatus_t hipblasRot<hipblasComplex, float, float>(hipblasHandle_t handle,
-                                                         int             n,
-                                                         hipblasComplex* x,
-                                                         int             incx,
-                                                         hipblasComplex* y,
-                                                         int             incy,
-                                                         const float*    c,
-                                                         const float*    s)
+hipblasStatus_t hipblasDot<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                 int                         n,
+                                                 const hipblasDoubleComplex* x,
+                                                 int                         incx,
+                                                 const hipblasDoubleComplex* y,
+                                                 int                         incy,
+                                                 hipblasDoubleComplex*       result)
 {
-    return hipblasCsrot(handle, n, x, incx, y, incy, c, s);
+    return hipblasZdotu(handle, n, x, incx, y, incy, result);
 }
 
 template <>
-hipblasStatus_t hipblasRot<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                         int                         n,
-                                                         hipblasDoubleComplex*       x,
-                                                         int                         incx,
-                                                         hipblasDoubleComplex*       y,
-                                                         int                         incy,
-                                                         const double*               c,
-                                                         const hipblasDoubleComplex* s)
+hipblasStatus_t hipblasDotc<hipblasComplex>(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* y,
+                                            int                   incy,
+                                            hipblasComplex*       result)
 {
-    return hipblasZrot(handle, n, x, incx, y, incy, c, s);
+    return hipblasCdotc(handle, n, x, incx, y, incy, result);
 }
 
 template <>
-hipblasStatus_t hipblasRot<hipblasDoubleComplex, double, double>(hipblasHandle_t       handle,
-                                                                 int                   n,
-                                                                 hipblasDoubleComplex* x,
-                                                                 int                   incx,
-                                                                 hipblasDoubleComplex* y,
-                                                                 int                   incy,
-                                                                 const double*         c,
-                                                                 const double*         s)
+hipblasStatus_t hipblasDotc<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  const hipblasDoubleComplex* y,
+                                                  int                         incy,
+                                                  hipblasDoubleComplex*       result)
 {
-    return hipblasZdrot(handle, n, x, incx, y, incy, c, s);
+    return hipblasZdotc(handle, n, x, incx, y, incy, result);
 }
 
-// rot_batched
+// dot_batched
 template <>
-hipblasStatus_t hipblasRotBatched<float>(hipblasHandle_t handle,
-                                         int             n,
-                                         float* const    x[],
-                                         int             incx,
-                                         float* const    y[],
-                                         int             incy,
-                                         const float*    c,
-                                         const float*    s,
-                                         int             batch_count)
+hipblasStatus_t hipblasDotBatched<hipblasHalf>(hipblasHandle_t          handle,
+                                               int                      n,
+                                               const hipblasHalf* const x[],
+                                               int                      incx,
+                                               const hipblasHalf* const y[],
+                                               int                      incy,
+                                               int                      batch_count,
+                                               hipblasHalf*             result)
 {
-    return hipblasSrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
+    return hipblasHdotBatched(handle, n, x, incx, y, incy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotBatched<double>(hipblasHandle_t handle,
-                                          int             n,
-                                          double* const   x[],
-                                          int             incx,
-                                          double* const   y[],
-                                          int             incy,
-                                          const double*   c,
-                                          const double*   s,
-                                          int             batch_count)
+hipblasStatus_t hipblasDotBatched<hipblasBfloat16>(hipblasHandle_t              handle,
+                                                   int                          n,
+                                                   const hipblasBfloat16* const x[],
+                                                   int                          incx,
+                                                   const hipblasBfloat16* const y[],
+                                                   int                          incy,
+                                                   int                          batch_count,
+                                                   hipblasBfloat16*             result)
 {
-    return hipblasDrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
+    return hipblasBfdotBatched(handle, n, x, incx, y, incy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                         int                   n,
-                                                         hipblasComplex* const x[],
-                                                         int                   incx,
-                                                         hipblasComplex* const y[],
-                                                         int                   incy,
-                                                         const float*          c,
-                                                         const hipblasComplex* s,
-                                                         int                   batch_count)
+hipblasStatus_t hipblasDotBatched<float>(hipblasHandle_t    handle,
+                                         int                n,
+                                         const float* const x[],
+                                         int                incx,
+                                         const float* const y[],
+                                         int                incy,
+                                         int                batch_count,
+                                         float*             result)
 {
-    return hipblasCrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
+    return hipblasSdotBatched(handle, n, x, incx, y, incy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotBatched<hipblasComplex, float, float>(hipblasHandle_t       handle,
-                                                                int                   n,
-                                                                hipblasComplex* const x[],
-                                                                int                   incx,
-                                                                hipblasComplex* const y[],
-                                                                int                   incy,
-                                                                const float*          c,
-                                                                const float*          s,
-                                                                int                   batch_count)
+hipblasStatus_t hipblasDotBatched<double>(hipblasHandle_t     handle,
+                                          int                 n,
+                                          const double* const x[],
+                                          int                 incx,
+                                          const double* const y[],
+                                          int                 incy,
+                                          int                 batch_count,
+                                          double*             result)
 {
-    return hipblasCsrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
+    return hipblasDdotBatched(handle, n, x, incx, y, incy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                                int                         n,
-                                                                hipblasDoubleComplex* const x[],
-                                                                int                         incx,
-                                                                hipblasDoubleComplex* const y[],
-                                                                int                         incy,
-                                                                const double*               c,
-                                                                const hipblasDoubleComplex* s,
-                                                                int batch_count)
+hipblasStatus_t hipblasDotBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                  int                         n,
+                                                  const hipblasComplex* const x[],
+                                                  int                         incx,
+                                                  const hipblasComplex* const y[],
+                                                  int                         incy,
+                                                  int                         batch_count,
+                                                  hipblasComplex*             result)
 {
-    return hipblasZrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
+    return hipblasCdotuBatched(handle, n, x, incx, y, incy, batch_count, result);
 }
 
 template <>
-hipblasStatus_t
-    hipblasRotBatched<hipblasDoubleComplex, double, double>(hipblasHandle_t             handle,
-                                                            int                         n,
-                                                            hipblasDoubleComplex* const x[],
-                                                            int                         incx,
-                                                            hipblasDoubleComplex* const y[],
-                                                            int                         incy,
-                                                            const double*               c,
-                                                            const double*               s,
-                                                            int                         batch_count)
+hipblasStatus_t hipblasDotcBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   int                         n,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex* const y[],
+                                                   int                         incy,
+                                                   int                         batch_count,
+                                                   hipblasComplex*             result)
 {
-    return hipblasZdrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
+    return hipblasCdotcBatched(handle, n, x, incx, y, incy, batch_count, result);
 }
 
-// rot_strided_batched
 template <>
-hipblasStatus_t hipblasRotStridedBatched<float>(hipblasHandle_t handle,
+hipblasStatus_t hipblasDotBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                        int                               n,
+                                                        const hipblasDoubleComplex* const x[],
+                                                        int                               incx,
+                                                        const hipblasDoubleComplex* const y[],
+                                                        int                               incy,
+                                                        int                   batch_count,
+                                                        hipblasDoubleComplex* result)
+{
+    return hipblasZdotuBatched(handle, n, x, incx, y, incy, batch_count, result);
+}
+
+template <>
+hipblasStatus_t hipblasDotcBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         int                               n,
+                                                         const hipblasDoubleComplex* const x[],
+                                                         int                               incx,
+                                                         const hipblasDoubleComplex* const y[],
+                                                         int                               incy,
+                                                         int                   batch_count,
+                                                         hipblasDoubleComplex* result)
+{
+    return hipblasZdotcBatched(handle, n, x, incx, y, incy, batch_count, result);
+}
+
+// dot_strided_batched
+template <>
+hipblasStatus_t hipblasDotStridedBatched<hipblasHalf>(hipblasHandle_t    handle,
+                                                      int                n,
+                                                      const hipblasHalf* x,
+                                                      int                incx,
+                                                      hipblasStride      stridex,
+                                                      const hipblasHalf* y,
+                                                      int                incy,
+                                                      hipblasStride      stridey,
+                                                      int                batch_count,
+                                                      hipblasHalf*       result)
+{
+    return hipblasHdotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+}
+
+template <>
+hipblasStatus_t hipblasDotStridedBatched<hipblasBfloat16>(hipblasHandle_t        handle,
+                                                          int                    n,
+                                                          const hipblasBfloat16* x,
+                                                          int                    incx,
+                                                          hipblasStride          stridex,
+                                                          const hipblasBfloat16* y,
+                                                          int                    incy,
+                                                          hipblasStride          stridey,
+                                                          int                    batch_count,
+                                                          hipblasBfloat16*       result)
+{
+    return hipblasBfdotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
+}
+
+template <>
+hipblasStatus_t hipblasDotStridedBatched<float>(hipblasHandle_t handle,
                                                 int             n,
-                                                float*          x,
+                                                const float*    x,
                                                 int             incx,
                                                 hipblasStride   stridex,
-                                                float*          y,
+                                                const float*    y,
                                                 int             incy,
                                                 hipblasStride   stridey,
-                                                const float*    c,
-                                                const float*    s,
-                                                int             batch_count)
+                                                int             batch_count,
+                                                float*          result)
 {
-    return hipblasSrotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
+    return hipblasSdotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotStridedBatched<double>(hipblasHandle_t handle,
+hipblasStatus_t hipblasDotStridedBatched<double>(hipblasHandle_t handle,
                                                  int             n,
-                                                 double*         x,
+                                                 const double*   x,
                                                  int             incx,
                                                  hipblasStride   stridex,
-                                                 double*         y,
+                                                 const double*   y,
                                                  int             incy,
                                                  hipblasStride   stridey,
-                                                 const double*   c,
-                                                 const double*   s,
-                                                 int             batch_count)
+                                                 int             batch_count,
+                                                 double*         result)
 {
-    return hipblasDrotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
+    return hipblasDdotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                                int                   n,
-                                                                hipblasComplex*       x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                hipblasComplex*       y,
-                                                                int                   incy,
-                                                                hipblasStride         stridey,
-                                                                const float*          c,
-                                                                const hipblasComplex* s,
-                                                                int                   batch_count)
+hipblasStatus_t hipblasDotStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                         int                   n,
+                                                         const hipblasComplex* x,
+                                                         int                   incx,
+                                                         hipblasStride         stridex,
+                                                         const hipblasComplex* y,
+                                                         int                   incy,
+                                                         hipblasStride         stridey,
+                                                         int                   batch_count,
+                                                         hipblasComplex*       result)
 {
-    return hipblasCrotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
+    return hipblasCdotuStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotStridedBatched<hipblasComplex, float, float>(hipblasHandle_t handle,
-                                                                       int             n,
-                                                                       hipblasComplex* x,
-                                                                       int             incx,
-                                                                       hipblasStride   stridex,
-                                                                       hipblasComplex* y,
-                                                                       int             incy,
-                                                                       hipblasStride   stridey,
-                                                                       const float*    c,
-                                                                       const float*    s,
-                                                                       int             batch_count)
+hipblasStatus_t hipblasDotcStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          int                   n,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batch_count,
+                                                          hipblasComplex*       result)
 {
-    return hipblasCsrotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
+    return hipblasCdotcStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
 }
 
 template <>
-hipblasStatus_t
-    hipblasRotStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                           int                         n,
-                                                           hipblasDoubleComplex*       x,
-                                                           int                         incx,
-                                                           hipblasStride               stridex,
-                                                           hipblasDoubleComplex*       y,
-                                                           int                         incy,
-                                                           hipblasStride               stridey,
-                                                           const double*               c,
-                                                           const hipblasDoubleComplex* s,
-                                                           int                         batch_count)
+hipblasStatus_t hipblasDotStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                               int                         n,
+                                                               const hipblasDoubleComplex* x,
+                                                               int                         incx,
+                                                               hipblasStride               stridex,
+                                                               const hipblasDoubleComplex* y,
+                                                               int                         incy,
+                                                               hipblasStride               stridey,
+                                                               int                   batch_count,
+                                                               hipblasDoubleComplex* result)
 {
-    return hipblasZrotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
+    return hipblasZdotuStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
 }
 
 template <>
-hipblasStatus_t
-    hipblasRotStridedBatched<hipblasDoubleComplex, double, double>(hipblasHandle_t       handle,
-                                                                   int                   n,
-                                                                   hipblasDoubleComplex* x,
-                                                                   int                   incx,
-                                                                   hipblasStride         stridex,
-                                                                   hipblasDoubleComplex* y,
-                                                                   int                   incy,
-                                                                   hipblasStride         stridey,
-                                                                   const double*         c,
-                                                                   const double*         s,
-                                                                   int batch_count)
+hipblasStatus_t hipblasDotcStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                int                         n,
+                                                                const hipblasDoubleComplex* x,
+                                                                int                         incx,
+                                                                hipblasStride               stridex,
+                                                                const hipblasDoubleComplex* y,
+                                                                int                         incy,
+                                                                hipblasStride               stridey,
+                                                                int                   batch_count,
+                                                                hipblasDoubleComplex* result)
 {
-    return hipblasZdrotStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
+    return hipblasZdotcStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, batch_count, result);
 }
 
-// rotg
+// asum
 template <>
-hipblasStatus_t hipblasRotg<float>(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
+hipblasStatus_t hipblasAsum<float, float>(
+    hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 {
-    return hipblasSrotg(handle, a, b, c, s);
+
+    return hipblasSasum(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t
-    hipblasRotg<double>(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
+hipblasStatus_t hipblasAsum<double, double>(
+    hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 {
-    return hipblasDrotg(handle, a, b, c, s);
+
+    return hipblasDasum(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotg<hipblasComplex, float>(
-    hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
+hipblasStatus_t hipblasAsum<hipblasComplex, float>(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 {
-    return hipblasCrotg(handle, a, b, c, s);
+
+    return hipblasScasum(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotg<hipblasDoubleComplex, double>(hipblasHandle_t       handle,
-                                                          hipblasDoubleComplex* a,
-                                                          hipblasDoubleComplex* b,
-                                                          double*               c,
-                                                          hipblasDoubleComplex* s)
+hipblasStatus_t hipblasAsum<hipblasDoubleComplex, double>(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 {
-    return hipblasZrotg(handle, a, b, c, s);
+
+    return hipblasDzasum(handle, n, x, incx, result);
 }
 
-// rotg_batched
+// asum_batched
 template <>
-hipblasStatus_t hipblasRotgBatched<float>(hipblasHandle_t handle,
-                                          float* const    a[],
-                                          float* const    b[],
-                                          float* const    c[],
-                                          float* const    s[],
-                                          int             batch_count)
+hipblasStatus_t hipblasAsumBatched<float, float>(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, float* result)
 {
-    return hipblasSrotgBatched(handle, a, b, c, s, batch_count);
+
+    return hipblasSasumBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotgBatched<double>(hipblasHandle_t handle,
-                                           double* const   a[],
-                                           double* const   b[],
-                                           double* const   c[],
-                                           double* const   s[],
-                                           int             batch_count)
+hipblasStatus_t hipblasAsumBatched<double, double>(hipblasHandle_t     handle,
+                                                   int                 n,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   int                 batch_count,
+                                                   double*             result)
 {
-    return hipblasDrotgBatched(handle, a, b, c, s, batch_count);
+
+    return hipblasDasumBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotgBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                          hipblasComplex* const a[],
-                                                          hipblasComplex* const b[],
-                                                          float* const          c[],
-                                                          hipblasComplex* const s[],
-                                                          int                   batch_count)
+hipblasStatus_t hipblasAsumBatched<hipblasComplex, float>(hipblasHandle_t             handle,
+                                                          int                         n,
+                                                          const hipblasComplex* const x[],
+                                                          int                         incx,
+                                                          int                         batch_count,
+                                                          float*                      result)
 {
-    return hipblasCrotgBatched(handle, a, b, c, s, batch_count);
+
+    return hipblasScasumBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotgBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                                 hipblasDoubleComplex* const a[],
-                                                                 hipblasDoubleComplex* const b[],
-                                                                 double* const               c[],
-                                                                 hipblasDoubleComplex* const s[],
-                                                                 int batch_count)
+hipblasStatus_t
+    hipblasAsumBatched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
+                                                     int                               n,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int                               incx,
+                                                     int                               batch_count,
+                                                     double*                           result)
 {
-    return hipblasZrotgBatched(handle, a, b, c, s, batch_count);
+
+    return hipblasDzasumBatched(handle, n, x, incx, batch_count, result);
 }
 
-// rotg_strided_batched
+// asum_strided_batched
 template <>
-hipblasStatus_t hipblasRotgStridedBatched<float>(hipblasHandle_t handle,
-                                                 float*          a,
-                                                 hipblasStride   stridea,
-                                                 float*          b,
-                                                 hipblasStride   strideb,
-                                                 float*          c,
-                                                 hipblasStride   stridec,
-                                                 float*          s,
-                                                 hipblasStride   strides,
-                                                 int             batch_count)
+hipblasStatus_t hipblasAsumStridedBatched<float, float>(hipblasHandle_t handle,
+                                                        int             n,
+                                                        const float*    x,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        int             batch_count,
+                                                        float*          result)
 {
-    return hipblasSrotgStridedBatched(
-        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
+
+    return hipblasSasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotgStridedBatched<double>(hipblasHandle_t handle,
-                                                  double*         a,
-                                                  hipblasStride   stridea,
-                                                  double*         b,
-                                                  hipblasStride   strideb,
-                                                  double*         c,
-                                                  hipblasStride   stridec,
-                                                  double*         s,
-                                                  hipblasStride   strides,
-                                                  int             batch_count)
+hipblasStatus_t hipblasAsumStridedBatched<double, double>(hipblasHandle_t handle,
+                                                          int             n,
+                                                          const double*   x,
+                                                          int             incx,
+                                                          hipblasStride   stridex,
+                                                          int             batch_count,
+                                                          double*         result)
 {
-    return hipblasDrotgStridedBatched(
-        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
+
+    return hipblasDasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotgStridedBatched<hipblasComplex, float>(hipblasHandle_t handle,
-                                                                 hipblasComplex* a,
-                                                                 hipblasStride   stridea,
-                                                                 hipblasComplex* b,
-                                                                 hipblasStride   strideb,
-                                                                 float*          c,
-                                                                 hipblasStride   stridec,
-                                                                 hipblasComplex* s,
-                                                                 hipblasStride   strides,
-                                                                 int             batch_count)
+hipblasStatus_t hipblasAsumStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                                 int                   n,
+                                                                 const hipblasComplex* x,
+                                                                 int                   incx,
+                                                                 hipblasStride         stridex,
+                                                                 int                   batch_count,
+                                                                 float*                result)
 {
-    return hipblasCrotgStridedBatched(
-        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
+
+    return hipblasScasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotgStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t handle,
-                                                                        hipblasDoubleComplex* a,
-                                                                        hipblasStride stridea,
-                                                                        hipblasDoubleComplex* b,
-                                                                        hipblasStride strideb,
-                                                                        double*       c,
-                                                                        hipblasStride stridec,
-                                                                        hipblasDoubleComplex* s,
-                                                                        hipblasStride strides,
-                                                                        int           batch_count)
+hipblasStatus_t
+    hipblasAsumStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                            int                         n,
+                                                            const hipblasDoubleComplex* x,
+                                                            int                         incx,
+                                                            hipblasStride               stridex,
+                                                            int                         batch_count,
+                                                            double*                     result)
 {
-    return hipblasZrotgStridedBatched(
-        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
+
+    return hipblasDzasumStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
-// rotm
+// nrm2
 template <>
-hipblasStatus_t hipblasRotm<float>(
-    hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
+hipblasStatus_t hipblasNrm2<float, float>(
+    hipblasHandle_t handle, int n, const float* x, int incx, float* result)
 {
-    return hipblasSrotm(handle, n, x, incx, y, incy, param);
+
+    return hipblasSnrm2(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotm<double>(
-    hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
+hipblasStatus_t hipblasNrm2<double, double>(
+    hipblasHandle_t handle, int n, const double* x, int incx, double* result)
 {
-    return hipblasDrotm(handle, n, x, incx, y, incy, param);
+
+    return hipblasDnrm2(handle, n, x, incx, result);
 }
 
-// rotm_batched
 template <>
-hipblasStatus_t hipblasRotmBatched<float>(hipblasHandle_t    handle,
-                                          int                n,
-                                          float* const       x[],
-                                          int                incx,
-                                          float* const       y[],
-                                          int                incy,
-                                          const float* const param[],
-                                          int                batch_count)
+hipblasStatus_t hipblasNrm2<hipblasComplex, float>(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result)
 {
-    return hipblasSrotmBatched(handle, n, x, incx, y, incy, param, batch_count);
+
+    return hipblasScnrm2(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotmBatched<double>(hipblasHandle_t     handle,
-                                           int                 n,
-                                           double* const       x[],
-                                           int                 incx,
-                                           double* const       y[],
-                                           int                 incy,
-                                           const double* const param[],
-                                           int                 batch_count)
+hipblasStatus_t hipblasNrm2<hipblasDoubleComplex, double>(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result)
 {
-    return hipblasDrotmBatched(handle, n, x, incx, y, incy, param, batch_count);
+
+    return hipblasDznrm2(handle, n, x, incx, result);
 }
 
-// rotm_strided_batched
+// nrm2_batched
 template <>
-hipblasStatus_t hipblasRotmStridedBatched<float>(hipblasHandle_t handle,
-                                                 int             n,
-                                                 float*          x,
-                                                 int             incx,
-                                                 hipblasStride   stridex,
-                                                 float*          y,
-                                                 int             incy,
-                                                 hipblasStride   stridey,
-                                                 const float*    param,
-                                                 hipblasStride   strideparam,
-                                                 int             batch_count)
+hipblasStatus_t hipblasNrm2Batched<float, float>(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, float* result)
 {
-    return hipblasSrotmStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, param, strideparam, batch_count);
+
+    return hipblasSnrm2Batched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotmStridedBatched<double>(hipblasHandle_t handle,
-                                                  int             n,
-                                                  double*         x,
-                                                  int             incx,
-                                                  hipblasStride   stridex,
-                                                  double*         y,
-                                                  int             incy,
-                                                  hipblasStride   stridey,
-                                                  const double*   param,
-                                                  hipblasStride   strideparam,
-                                                  int             batch_count)
+hipblasStatus_t hipblasNrm2Batched<double, double>(hipblasHandle_t     handle,
+                                                   int                 n,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   int                 batch_count,
+                                                   double*             result)
 {
-    return hipblasDrotmStridedBatched(
-        handle, n, x, incx, stridex, y, incy, stridey, param, strideparam, batch_count);
+
+    return hipblasDnrm2Batched(handle, n, x, incx, batch_count, result);
 }
 
-// rotmg
 template <>
-hipblasStatus_t hipblasRotmg<float>(
-    hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
+hipblasStatus_t hipblasNrm2Batched<hipblasComplex, float>(hipblasHandle_t             handle,
+                                                          int                         n,
+                                                          const hipblasComplex* const x[],
+                                                          int                         incx,
+                                                          int                         batch_count,
+                                                          float*                      result)
 {
-    return hipblasSrotmg(handle, d1, d2, x1, y1, param);
+
+    return hipblasScnrm2Batched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotmg<double>(
-    hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
+hipblasStatus_t
+    hipblasNrm2Batched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
+                                                     int                               n,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int                               incx,
+                                                     int                               batch_count,
+                                                     double*                           result)
 {
-    return hipblasDrotmg(handle, d1, d2, x1, y1, param);
+
+    return hipblasDznrm2Batched(handle, n, x, incx, batch_count, result);
 }
 
-// rotmg_batched
+// nrm2_strided_batched
 template <>
-hipblasStatus_t hipblasRotmgBatched<float>(hipblasHandle_t    handle,
-                                           float* const       d1[],
-                                           float* const       d2[],
-                                           float* const       x1[],
-                                           const float* const y1[],
-                                           float* const       param[],
-                                           int                batch_count)
+hipblasStatus_t hipblasNrm2StridedBatched<float, float>(hipblasHandle_t handle,
+                                                        int             n,
+                                                        const float*    x,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        int             batch_count,
+                                                        float*          result)
 {
-    return hipblasSrotmgBatched(handle, d1, d2, x1, y1, param, batch_count);
+
+    return hipblasSnrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotmgBatched<double>(hipblasHandle_t     handle,
-                                            double* const       d1[],
-                                            double* const       d2[],
-                                            double* const       x1[],
-                                            const double* const y1[],
-                                            double* const       param[],
-                                            int                 batch_count)
+hipblasStatus_t hipblasNrm2StridedBatched<double, double>(hipblasHandle_t handle,
+                                                          int             n,
+                                                          const double*   x,
+                                                          int             incx,
+                                                          hipblasStride   stridex,
+                                                          int             batch_count,
+                                                          double*         result)
 {
-    return hipblasDrotmgBatched(handle, d1, d2, x1, y1, param, batch_count);
-}
 
-// rotmg_strided_batched
-template <>
-hipblasStatus_t hipblasRotmgStridedBatched<float>(hipblasHandle_t handle,
-                                                  float*          d1,
-                                                  hipblasStride   stride_d1,
-                                                  float*          d2,
-                                                  hipblasStride   stride_d2,
-                                                  float*          x1,
-                                                  hipblasStride   stride_x1,
-                                                  const float*    y1,
-                                                  hipblasStride   stride_y1,
-                                                  float*          param,
-                                                  hipblasStride   strideparam,
-                                                  int             batch_count)
-{
-    return hipblasSrotmgStridedBatched(handle,
-                                       d1,
-                                       stride_d1,
-                                       d2,
-                                       stride_d2,
-                                       x1,
-                                       stride_x1,
-                                       y1,
-                                       stride_y1,
-                                       param,
-                                       strideparam,
-                                       batch_count);
+    return hipblasDnrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasRotmgStridedBatched<double>(hipblasHandle_t handle,
-                                                   double*         d1,
-                                                   hipblasStride   stride_d1,
-                                                   double*         d2,
-                                                   hipblasStride   stride_d2,
-                                                   double*         x1,
-                                                   hipblasStride   stride_x1,
-                                                   const double*   y1,
-                                                   hipblasStride   stride_y1,
-                                                   double*         param,
-                                                   hipblasStride   strideparam,
-                                                   int             batch_count)
+hipblasStatus_t hipblasNrm2StridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                                 int                   n,
+                                                                 const hipblasComplex* x,
+                                                                 int                   incx,
+                                                                 hipblasStride         stridex,
+                                                                 int                   batch_count,
+                                                                 float*                result)
 {
-    return hipblasDrotmgStridedBatched(handle,
-                                       d1,
-                                       stride_d1,
-                                       d2,
-                                       stride_d2,
-                                       x1,
-                                       stride_x1,
-                                       y1,
-                                       stride_y1,
-                                       param,
-                                       strideparam,
-                                       batch_count);
+
+    return hipblasScnrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
-// amax
 template <>
 hipblasStatus_t
-    hipblasIamax<float>(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+    hipblasNrm2StridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                            int                         n,
+                                                            const hipblasDoubleComplex* x,
+                                                            int                         incx,
+                                                            hipblasStride               stridex,
+                                                            int                         batch_count,
+                                                            double*                     result)
 {
-    return hipblasIsamax(handle, n, x, incx, result);
+
+    return hipblasDznrm2StridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
+// rot
 template <>
-hipblasStatus_t
-    hipblasIamax<double>(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+hipblasStatus_t hipblasRot<float>(hipblasHandle_t handle,
+                                  int             n,
+                                  float*          x,
+                                  int             incx,
+                                  float*          y,
+                                  int             incy,
+                                  const float*    c,
+                                  const float*    s)
 {
-    return hipblasIdamax(handle, n, x, incx, result);
+    return hipblasSrot(handle, n, x, incx, y, incy, c, s);
 }
 
 template <>
-hipblasStatus_t hipblasIamax<hipblasComplex>(
-    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+hipblasStatus_t hipblasRot<double>(hipblasHandle_t handle,
+                                   int             n,
+                                   double*         x,
+                                   int             incx,
+                                   double*         y,
+                                   int             incy,
+                                   const double*   c,
+                                   const double*   s)
 {
-    return hipblasIcamax(handle, n, x, incx, result);
+    return hipblasDrot(handle, n, x, incx, y, incy, c, s);
 }
 
 template <>
-hipblasStatus_t hipblasIamax<hipblasDoubleComplex>(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+hipblasStatus_t hipblasRot<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                  int                   n,
+                                                  hipblasComplex*       x,
+                                                  int                   incx,
+                                                  hipblasComplex*       y,
+                                                  int                   incy,
+                                                  const float*          c,
+                                                  const hipblasComplex* s)
 {
-    return hipblasIzamax(handle, n, x, incx, result);
+    return hipblasCrot(handle, n, x, incx, y, incy, c, s);
 }
 
-// amax_batched
 template <>
-hipblasStatus_t hipblasIamaxBatched<float>(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, int* result)
+hipblasStatus_t hipblasRot<hipblasComplex, float, float>(hipblasHandle_t handle,
+                                                         int             n,
+                                                         hipblasComplex* x,
+                                                         int             incx,
+                                                         hipblasComplex* y,
+                                                         int             incy,
+                                                         const float*    c,
+                                                         const float*    s)
 {
-    return hipblasIsamaxBatched(handle, n, x, incx, batch_count, result);
+    return hipblasCsrot(handle, n, x, incx, y, incy, c, s);
 }
 
 template <>
-hipblasStatus_t hipblasIamaxBatched<double>(
-    hipblasHandle_t handle, int n, const double* const x[], int incx, int batch_count, int* result)
+hipblasStatus_t hipblasRot<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                         int                         n,
+                                                         hipblasDoubleComplex*       x,
+                                                         int                         incx,
+                                                         hipblasDoubleComplex*       y,
+                                                         int                         incy,
+                                                         const double*               c,
+                                                         const hipblasDoubleComplex* s)
 {
-    return hipblasIdamaxBatched(handle, n, x, incx, batch_count, result);
+    return hipblasZrot(handle, n, x, incx, y, incy, c, s);
 }
 
 template <>
-hipblasStatus_t hipblasIamaxBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                    int                         n,
-                                                    const hipblasComplex* const x[],
-                                                    int                         incx,
-                                                    int                         batch_count,
-                                                    int*                        result)
+hipblasStatus_t hipblasRot<hipblasDoubleComplex, double, double>(hipblasHandle_t       handle,
+                                                                 int                   n,
+                                                                 hipblasDoubleComplex* x,
+                                                                 int                   incx,
+                                                                 hipblasDoubleComplex* y,
+                                                                 int                   incy,
+                                                                 const double*         c,
+                                                                 const double*         s)
 {
-    return hipblasIcamaxBatched(handle, n, x, incx, batch_count, result);
+    return hipblasZdrot(handle, n, x, incx, y, incy, c, s);
 }
 
+// rot_batched
 template <>
-hipblasStatus_t hipblasIamaxBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                          int                               n,
-                                                          const hipblasDoubleComplex* const x[],
-                                                          int                               incx,
-                                                          int  batch_count,
-                                                          int* result)
+hipblasStatus_t hipblasRotBatched<float>(hipblasHandle_t handle,
+                                         int             n,
+                                         float* const    x[],
+                                         int             incx,
+                                         float* const    y[],
+                                         int             incy,
+                                         const float*    c,
+                                         const float*    s,
+                                         int             batch_count)
 {
-    return hipblasIzamaxBatched(handle, n, x, incx, batch_count, result);
+    return hipblasSrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
 }
 
-// amax_strided_batched
 template <>
-hipblasStatus_t hipblasIamaxStridedBatched<float>(hipblasHandle_t handle,
-                                                  int             n,
-                                                  const float*    x,
-                                                  int             incx,
-                                                  hipblasStride   stridex,
-                                                  int             batch_count,
-                                                  int*            result)
+hipblasStatus_t hipblasRotBatched<double>(hipblasHandle_t handle,
+                                          int             n,
+                                          double* const   x[],
+                                          int             incx,
+                                          double* const   y[],
+                                          int             incy,
+                                          const double*   c,
+                                          const double*   s,
+                                          int             batch_count)
 {
-    return hipblasIsamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasDrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasIamaxStridedBatched<double>(hipblasHandle_t handle,
-                                                   int             n,
-                                                   const double*   x,
-                                                   int             incx,
-                                                   hipblasStride   stridex,
-                                                   int             batch_count,
-                                                   int*            result)
+hipblasStatus_t hipblasRotBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                         int                   n,
+                                                         hipblasComplex* const x[],
+                                                         int                   incx,
+                                                         hipblasComplex* const y[],
+                                                         int                   incy,
+                                                         const float*          c,
+                                                         const hipblasComplex* s,
+                                                         int                   batch_count)
 {
-    return hipblasIdamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasCrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasIamaxStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                           int                   n,
-                                                           const hipblasComplex* x,
-                                                           int                   incx,
-                                                           hipblasStride         stridex,
-                                                           int                   batch_count,
-                                                           int*                  result)
+hipblasStatus_t hipblasRotBatched<hipblasComplex, float, float>(hipblasHandle_t       handle,
+                                                                int                   n,
+                                                                hipblasComplex* const x[],
+                                                                int                   incx,
+                                                                hipblasComplex* const y[],
+                                                                int                   incy,
+                                                                const float*          c,
+                                                                const float*          s,
+                                                                int                   batch_count)
 {
-    return hipblasIcamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasCsrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasIamaxStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                 int                         n,
-                                                                 const hipblasDoubleComplex* x,
-                                                                 int                         incx,
-                                                                 hipblasStride stridex,
-                                                                 int           batch_count,
-                                                                 int*          result)
+hipblasStatus_t hipblasRotBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                                int                         n,
+                                                                hipblasDoubleComplex* const x[],
+                                                                int                         incx,
+                                                                hipblasDoubleComplex* const y[],
+                                                                int                         incy,
+                                                                const double*               c,
+                                                                const hipblasDoubleComplex* s,
+                                                                int batch_count)
 {
-    return hipblasIzamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasZrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
 }
 
-// amin
 template <>
 hipblasStatus_t
-    hipblasIamin<float>(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+    hipblasRotBatched<hipblasDoubleComplex, double, double>(hipblasHandle_t             handle,
+                                                            int                         n,
+                                                            hipblasDoubleComplex* const x[],
+                                                            int                         incx,
+                                                            hipblasDoubleComplex* const y[],
+                                                            int                         incy,
+                                                            const double*               c,
+                                                            const double*               s,
+                                                            int                         batch_count)
 {
-    return hipblasIsamin(handle, n, x, incx, result);
+    return hipblasZdrotBatched(handle, n, x, incx, y, incy, c, s, batch_count);
 }
 
+// rot_strided_batched
 template <>
-hipblasStatus_t
-    hipblasIamin<double>(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+hipblasStatus_t hipblasRotStridedBatched<float>(hipblasHandle_t handle,
+                                                int             n,
+                                                float*          x,
+                                                int             incx,
+                                                hipblasStride   stridex,
+                                                float*          y,
+                                                int             incy,
+                                                hipblasStride   stridey,
+                                                const float*    c,
+                                                const float*    s,
+                                                int             batch_count)
 {
-    return hipblasIdamin(handle, n, x, incx, result);
+    return hipblasSrotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasIamin<hipblasComplex>(
-    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+hipblasStatus_t hipblasRotStridedBatched<double>(hipblasHandle_t handle,
+                                                 int             n,
+                                                 double*         x,
+                                                 int             incx,
+                                                 hipblasStride   stridex,
+                                                 double*         y,
+                                                 int             incy,
+                                                 hipblasStride   stridey,
+                                                 const double*   c,
+                                                 const double*   s,
+                                                 int             batch_count)
 {
-    return hipblasIcamin(handle, n, x, incx, result);
+    return hipblasDrotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasIamin<hipblasDoubleComplex>(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+hipblasStatus_t hipblasRotStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                                int                   n,
+                                                                hipblasComplex*       x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                hipblasComplex*       y,
+                                                                int                   incy,
+                                                                hipblasStride         stridey,
+                                                                const float*          c,
+                                                                const hipblasComplex* s,
+                                                                int                   batch_count)
 {
-    return hipblasIzamin(handle, n, x, incx, result);
+    return hipblasCrotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
 }
 
-// amin_batched
 template <>
-hipblasStatus_t hipblasIaminBatched<float>(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, int* result)
+hipblasStatus_t hipblasRotStridedBatched<hipblasComplex, float, float>(hipblasHandle_t handle,
+                                                                       int             n,
+                                                                       hipblasComplex* x,
+                                                                       int             incx,
+                                                                       hipblasStride   stridex,
+                                                                       hipblasComplex* y,
+                                                                       int             incy,
+                                                                       hipblasStride   stridey,
+                                                                       const float*    c,
+                                                                       const float*    s,
+                                                                       int             batch_count)
 {
-    return hipblasIsaminBatched(handle, n, x, incx, batch_count, result);
+    return hipblasCsrotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasIaminBatched<double>(
-    hipblasHandle_t handle, int n, const double* const x[], int incx, int batch_count, int* result)
+hipblasStatus_t
+    hipblasRotStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                           int                         n,
+                                                           hipblasDoubleComplex*       x,
+                                                           int                         incx,
+                                                           hipblasStride               stridex,
+                                                           hipblasDoubleComplex*       y,
+                                                           int                         incy,
+                                                           hipblasStride               stridey,
+                                                           const double*               c,
+                                                           const hipblasDoubleComplex* s,
+                                                           int                         batch_count)
 {
-    return hipblasIdaminBatched(handle, n, x, incx, batch_count, result);
+    return hipblasZrotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasIaminBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                    int                         n,
-                                                    const hipblasComplex* const x[],
-                                                    int                         incx,
-                                                    int                         batch_count,
-                                                    int*                        result)
+hipblasStatus_t
+    hipblasRotStridedBatched<hipblasDoubleComplex, double, double>(hipblasHandle_t       handle,
+                                                                   int                   n,
+                                                                   hipblasDoubleComplex* x,
+                                                                   int                   incx,
+                                                                   hipblasStride         stridex,
+                                                                   hipblasDoubleComplex* y,
+                                                                   int                   incy,
+                                                                   hipblasStride         stridey,
+                                                                   const double*         c,
+                                                                   const double*         s,
+                                                                   int batch_count)
 {
-    return hipblasIcaminBatched(handle, n, x, incx, batch_count, result);
+    return hipblasZdrotStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, c, s, batch_count);
 }
 
+// rotg
 template <>
-hipblasStatus_t hipblasIaminBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                          int                               n,
-                                                          const hipblasDoubleComplex* const x[],
-                                                          int                               incx,
-                                                          int  batch_count,
-                                                          int* result)
+hipblasStatus_t hipblasRotg<float>(hipblasHandle_t handle, float* a, float* b, float* c, float* s)
 {
-    return hipblasIzaminBatched(handle, n, x, incx, batch_count, result);
+    return hipblasSrotg(handle, a, b, c, s);
 }
 
-// amin_strided_batched
 template <>
-hipblasStatus_t hipblasIaminStridedBatched<float>(hipblasHandle_t handle,
-                                                  int             n,
-                                                  const float*    x,
-                                                  int             incx,
-                                                  hipblasStride   stridex,
-                                                  int             batch_count,
-                                                  int*            result)
+hipblasStatus_t
+    hipblasRotg<double>(hipblasHandle_t handle, double* a, double* b, double* c, double* s)
 {
-    return hipblasIsaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasDrotg(handle, a, b, c, s);
 }
 
 template <>
-hipblasStatus_t hipblasIaminStridedBatched<double>(hipblasHandle_t handle,
-                                                   int             n,
-                                                   const double*   x,
-                                                   int             incx,
-                                                   hipblasStride   stridex,
-                                                   int             batch_count,
-                                                   int*            result)
+hipblasStatus_t hipblasRotg<hipblasComplex, float>(
+    hipblasHandle_t handle, hipblasComplex* a, hipblasComplex* b, float* c, hipblasComplex* s)
 {
-    return hipblasIdaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasCrotg(handle, a, b, c, s);
 }
 
 template <>
-hipblasStatus_t hipblasIaminStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                           int                   n,
-                                                           const hipblasComplex* x,
-                                                           int                   incx,
-                                                           hipblasStride         stridex,
-                                                           int                   batch_count,
-                                                           int*                  result)
+hipblasStatus_t hipblasRotg<hipblasDoubleComplex, double>(hipblasHandle_t       handle,
+                                                          hipblasDoubleComplex* a,
+                                                          hipblasDoubleComplex* b,
+                                                          double*               c,
+                                                          hipblasDoubleComplex* s)
 {
-    return hipblasIcaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasZrotg(handle, a, b, c, s);
 }
 
+// rotg_batched
 template <>
-hipblasStatus_t hipblasIaminStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                 int                         n,
-                                                                 const hipblasDoubleComplex* x,
-                                                                 int                         incx,
-                                                                 hipblasStride stridex,
-                                                                 int           batch_count,
-                                                                 int*          result)
+hipblasStatus_t hipblasRotgBatched<float>(hipblasHandle_t handle,
+                                          float* const    a[],
+                                          float* const    b[],
+                                          float* const    c[],
+                                          float* const    s[],
+                                          int             batch_count)
 {
-    return hipblasIzaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
+    return hipblasSrotgBatched(handle, a, b, c, s, batch_count);
 }
 
-/*
- * ===========================================================================
- *    level 2 BLAS
- * ===========================================================================
- */
-
-// gbmv
 template <>
-hipblasStatus_t hipblasGbmv<float>(hipblasHandle_t    handle,
-                                   hipblasOperation_t transA,
-                                   int                m,
-                                   int                n,
-                                   int                kl,
-                                   int                ku,
-                                   const float*       alpha,
-                                   const float*       A,
-                                   int                lda,
-                                   const float*       x,
-                                   int                incx,
-                                   const float*       beta,
-                                   float*             y,
-                                   int                incy)
+hipblasStatus_t hipblasRotgBatched<double>(hipblasHandle_t handle,
+                                           double* const   a[],
+                                           double* const   b[],
+                                           double* const   c[],
+                                           double* const   s[],
+                                           int             batch_count)
 {
-    return hipblasSgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasDrotgBatched(handle, a, b, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasGbmv<double>(hipblasHandle_t    handle,
-                                    hipblasOperation_t transA,
-                                    int                m,
-                                    int                n,
-                                    int                kl,
-                                    int                ku,
-                                    const double*      alpha,
-                                    const double*      A,
-                                    int                lda,
-                                    const double*      x,
-                                    int                incx,
-                                    const double*      beta,
-                                    double*            y,
-                                    int                incy)
+hipblasStatus_t hipblasRotgBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                          hipblasComplex* const a[],
+                                                          hipblasComplex* const b[],
+                                                          float* const          c[],
+                                                          hipblasComplex* const s[],
+                                                          int                   batch_count)
 {
-    return hipblasDgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasCrotgBatched(handle, a, b, c, s, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasGbmv<hipblasComplex>(hipblasHandle_t       handle,
-                                            hipblasOperation_t    transA,
-                                            int                   m,
-                                            int                   n,
-                                            int                   kl,
-                                            int                   ku,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       y,
-                                            int                   incy)
+hipblasStatus_t hipblasRotgBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                                 hipblasDoubleComplex* const a[],
+                                                                 hipblasDoubleComplex* const b[],
+                                                                 double* const               c[],
+                                                                 hipblasDoubleComplex* const s[],
+                                                                 int batch_count)
 {
-    return hipblasCgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasZrotgBatched(handle, a, b, c, s, batch_count);
 }
 
+// rotg_strided_batched
 template <>
-hipblasStatus_t hipblasGbmv<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  hipblasOperation_t          transA,
-                                                  int                         m,
-                                                  int                         n,
-                                                  int                         kl,
-                                                  int                         ku,
-                                                  const hipblasDoubleComplex* alpha,
-                                                  const hipblasDoubleComplex* A,
-                                                  int                         lda,
-                                                  const hipblasDoubleComplex* x,
-                                                  int                         incx,
-                                                  const hipblasDoubleComplex* beta,
-                                                  hipblasDoubleComplex*       y,
-                                                  int                         incy)
+hipblasStatus_t hipblasRotgStridedBatched<float>(hipblasHandle_t handle,
+                                                 float*          a,
+                                                 hipblasStride   stridea,
+                                                 float*          b,
+                                                 hipblasStride   strideb,
+                                                 float*          c,
+                                                 hipblasStride   stridec,
+                                                 float*          s,
+                                                 hipblasStride   strides,
+                                                 int             batch_count)
 {
-    return hipblasZgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasSrotgStridedBatched(
+        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
 }
 
-// gbmv_batched
 template <>
-hipblasStatus_t hipblasGbmvBatched<float>(hipblasHandle_t    handle,
-                                          hipblasOperation_t transA,
-                                          int                m,
+hipblasStatus_t hipblasRotgStridedBatched<double>(hipblasHandle_t handle,
+                                                  double*         a,
+                                                  hipblasStride   stridea,
+                                                  double*         b,
+                                                  hipblasStride   strideb,
+                                                  double*         c,
+                                                  hipblasStride   stridec,
+                                                  double*         s,
+                                                  hipblasStride   strides,
+                                                  int             batch_count)
+{
+    return hipblasDrotgStridedBatched(
+        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasRotgStridedBatched<hipblasComplex, float>(hipblasHandle_t handle,
+                                                                 hipblasComplex* a,
+                                                                 hipblasStride   stridea,
+                                                                 hipblasComplex* b,
+                                                                 hipblasStride   strideb,
+                                                                 float*          c,
+                                                                 hipblasStride   stridec,
+                                                                 hipblasComplex* s,
+                                                                 hipblasStride   strides,
+                                                                 int             batch_count)
+{
+    return hipblasCrotgStridedBatched(
+        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasRotgStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t handle,
+                                                                        hipblasDoubleComplex* a,
+                                                                        hipblasStride stridea,
+                                                                        hipblasDoubleComplex* b,
+                                                                        hipblasStride strideb,
+                                                                        double*       c,
+                                                                        hipblasStride stridec,
+                                                                        hipblasDoubleComplex* s,
+                                                                        hipblasStride strides,
+                                                                        int           batch_count)
+{
+    return hipblasZrotgStridedBatched(
+        handle, a, stridea, b, strideb, c, stridec, s, strides, batch_count);
+}
+
+// rotm
+template <>
+hipblasStatus_t hipblasRotm<float>(
+    hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param)
+{
+    return hipblasSrotm(handle, n, x, incx, y, incy, param);
+}
+
+template <>
+hipblasStatus_t hipblasRotm<double>(
+    hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param)
+{
+    return hipblasDrotm(handle, n, x, incx, y, incy, param);
+}
+
+// rotm_batched
+template <>
+hipblasStatus_t hipblasRotmBatched<float>(hipblasHandle_t    handle,
                                           int                n,
-                                          int                kl,
-                                          int                ku,
-                                          const float*       alpha,
-                                          const float* const A[],
-                                          int                lda,
-                                          const float* const x[],
+                                          float* const       x[],
                                           int                incx,
-                                          const float*       beta,
                                           float* const       y[],
                                           int                incy,
+                                          const float* const param[],
                                           int                batch_count)
 {
-    return hipblasSgbmvBatched(
-        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblasSrotmBatched(handle, n, x, incx, y, incy, param, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasGbmvBatched<double>(hipblasHandle_t     handle,
-                                           hipblasOperation_t  transA,
-                                           int                 m,
+hipblasStatus_t hipblasRotmBatched<double>(hipblasHandle_t     handle,
                                            int                 n,
-                                           int                 kl,
-                                           int                 ku,
-                                           const double*       alpha,
-                                           const double* const A[],
-                                           int                 lda,
-                                           const double* const x[],
+                                           double* const       x[],
                                            int                 incx,
-                                           const double*       beta,
                                            double* const       y[],
                                            int                 incy,
+                                           const double* const param[],
                                            int                 batch_count)
 {
-    return hipblasDgbmvBatched(
-        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblasDrotmBatched(handle, n, x, incx, y, incy, param, batch_count);
 }
 
+// rotm_strided_batched
 template <>
-hipblasStatus_t hipblasGbmvBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          transA,
-                                                   int                         m,
-                                                   int                         n,
-                                                   int                         kl,
-                                                   int                         ku,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex* const       y[],
-                                                   int                         incy,
-                                                   int                         batch_count)
+hipblasStatus_t hipblasRotmStridedBatched<float>(hipblasHandle_t handle,
+                                                 int             n,
+                                                 float*          x,
+                                                 int             incx,
+                                                 hipblasStride   stridex,
+                                                 float*          y,
+                                                 int             incy,
+                                                 hipblasStride   stridey,
+                                                 const float*    param,
+                                                 hipblasStride   strideparam,
+                                                 int             batch_count)
 {
-    return hipblasCgbmvBatched(
-        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblasSrotmStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, param, strideparam, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasGbmvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         hipblasOperation_t                transA,
-                                                         int                               m,
-                                                         int                               n,
-                                                         int                               kl,
-                                                         int                               ku,
-                                                         const hipblasDoubleComplex*       alpha,
-                                                         const hipblasDoubleComplex* const A[],
-                                                         int                               lda,
-                                                         const hipblasDoubleComplex* const x[],
-                                                         int                               incx,
-                                                         const hipblasDoubleComplex*       beta,
-                                                         hipblasDoubleComplex* const       y[],
-                                                         int                               incy,
-                                                         int batch_count)
+hipblasStatus_t hipblasRotmStridedBatched<double>(hipblasHandle_t handle,
+                                                  int             n,
+                                                  double*         x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  double*         y,
+                                                  int             incy,
+                                                  hipblasStride   stridey,
+                                                  const double*   param,
+                                                  hipblasStride   strideparam,
+                                                  int             batch_count)
 {
-    return hipblasZgbmvBatched(
-        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblasDrotmStridedBatched(
+        handle, n, x, incx, stridex, y, incy, stridey, param, strideparam, batch_count);
 }
 
-// gbmv_strided_batched
+// rotmg
 template <>
-hipblasStatus_t hipblasGbmvStridedBatched<float>(hipblasHandle_t    handle,
-                                                 hipblasOperation_t transA,
-                                                 int                m,
-                                                 int                n,
-                                                 int                kl,
-                                                 int                ku,
-                                                 const float*       alpha,
-                                                 const float*       A,
-                                                 int                lda,
-                                                 hipblasStride      stride_a,
-                                                 const float*       x,
-                                                 int                incx,
-                                                 hipblasStride      stride_x,
-                                                 const float*       beta,
-                                                 float*             y,
-                                                 int                incy,
-                                                 hipblasStride      stride_y,
-                                                 int                batch_count)
+hipblasStatus_t hipblasRotmg<float>(
+    hipblasHandle_t handle, float* d1, float* d2, float* x1, const float* y1, float* param)
 {
-    return hipblasSgbmvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      kl,
-                                      ku,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      stride_a,
-                                      x,
-                                      incx,
-                                      stride_x,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stride_y,
-                                      batch_count);
+    return hipblasSrotmg(handle, d1, d2, x1, y1, param);
 }
 
 template <>
-hipblasStatus_t hipblasGbmvStridedBatched<double>(hipblasHandle_t    handle,
-                                                  hipblasOperation_t transA,
-                                                  int                m,
-                                                  int                n,
-                                                  int                kl,
-                                                  int                ku,
-                                                  const double*      alpha,
-                                                  const double*      A,
-                                                  int                lda,
-                                                  hipblasStride      stride_a,
-                                                  const double*      x,
-                                                  int                incx,
-                                                  hipblasStride      stride_x,
-                                                  const double*      beta,
-                                                  double*            y,
-                                                  int                incy,
-                                                  hipblasStride      stride_y,
-                                                  int                batch_count)
+hipblasStatus_t hipblasRotmg<double>(
+    hipblasHandle_t handle, double* d1, double* d2, double* x1, const double* y1, double* param)
 {
-    return hipblasDgbmvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      kl,
-                                      ku,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      stride_a,
-                                      x,
-                                      incx,
-                                      stride_x,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stride_y,
-                                      batch_count);
+    return hipblasDrotmg(handle, d1, d2, x1, y1, param);
 }
 
+// rotmg_batched
 template <>
-hipblasStatus_t hipblasGbmvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    transA,
-                                                          int                   m,
-                                                          int                   n,
-                                                          int                   kl,
-                                                          int                   ku,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         stride_a,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stride_x,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stride_y,
-                                                          int                   batch_count)
+hipblasStatus_t hipblasRotmgBatched<float>(hipblasHandle_t    handle,
+                                           float* const       d1[],
+                                           float* const       d2[],
+                                           float* const       x1[],
+                                           const float* const y1[],
+                                           float* const       param[],
+                                           int                batch_count)
 {
-    return hipblasCgbmvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      kl,
-                                      ku,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      stride_a,
-                                      x,
-                                      incx,
-                                      stride_x,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stride_y,
-                                      batch_count);
+    return hipblasSrotmgBatched(handle, d1, d2, x1, y1, param, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasGbmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                hipblasOperation_t          transA,
-                                                                int                         m,
-                                                                int                         n,
-                                                                int                         kl,
-                                                                int                         ku,
-                                                                const hipblasDoubleComplex* alpha,
-                                                                const hipblasDoubleComplex* A,
-                                                                int                         lda,
-                                                                hipblasStride stride_a,
-                                                                const hipblasDoubleComplex* x,
-                                                                int                         incx,
-                                                                hipblasStride stride_x,
-                                                                const hipblasDoubleComplex* beta,
-                                                                hipblasDoubleComplex*       y,
-                                                                int                         incy,
-                                                                hipblasStride stride_y,
-                                                                int           batch_count)
+hipblasStatus_t hipblasRotmgBatched<double>(hipblasHandle_t     handle,
+                                            double* const       d1[],
+                                            double* const       d2[],
+                                            double* const       x1[],
+                                            const double* const y1[],
+                                            double* const       param[],
+                                            int                 batch_count)
 {
-    return hipblasZgbmvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      kl,
-                                      ku,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      stride_a,
-                                      x,
-                                      incx,
-                                      stride_x,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stride_y,
-                                      batch_count);
+    return hipblasDrotmgBatched(handle, d1, d2, x1, y1, param, batch_count);
 }
 
-// gemv
+// rotmg_strided_batched
 template <>
-hipblasStatus_t hipblasGemv<float>(hipblasHandle_t    handle,
-                                   hipblasOperation_t transA,
-                                   int                m,
-                                   int                n,
-                                   const float*       alpha,
-                                   const float*       A,
-                                   int                lda,
-                                   const float*       x,
-                                   int                incx,
-                                   const float*       beta,
-                                   float*             y,
-                                   int                incy)
+hipblasStatus_t hipblasRotmgStridedBatched<float>(hipblasHandle_t handle,
+                                                  float*          d1,
+                                                  hipblasStride   stride_d1,
+                                                  float*          d2,
+                                                  hipblasStride   stride_d2,
+                                                  float*          x1,
+                                                  hipblasStride   stride_x1,
+                                                  const float*    y1,
+                                                  hipblasStride   stride_y1,
+                                                  float*          param,
+                                                  hipblasStride   strideparam,
+                                                  int             batch_count)
 {
-    return hipblasSgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasSrotmgStridedBatched(handle,
+                                       d1,
+                                       stride_d1,
+                                       d2,
+                                       stride_d2,
+                                       x1,
+                                       stride_x1,
+                                       y1,
+                                       stride_y1,
+                                       param,
+                                       strideparam,
+                                       batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasGemv<double>(hipblasHandle_t    handle,
-                                    hipblasOperation_t transA,
-                                    int                m,
-                                    int                n,
-                                    const double*      alpha,
-                                    const double*      A,
-                                    int                lda,
-                                    const double*      x,
-                                    int                incx,
-                                    const double*      beta,
-                                    double*            y,
-                                    int                incy)
+hipblasStatus_t hipblasRotmgStridedBatched<double>(hipblasHandle_t handle,
+                                                   double*         d1,
+                                                   hipblasStride   stride_d1,
+                                                   double*         d2,
+                                                   hipblasStride   stride_d2,
+                                                   double*         x1,
+                                                   hipblasStride   stride_x1,
+                                                   const double*   y1,
+                                                   hipblasStride   stride_y1,
+                                                   double*         param,
+                                                   hipblasStride   strideparam,
+                                                   int             batch_count)
 {
-    return hipblasDgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasDrotmgStridedBatched(handle,
+                                       d1,
+                                       stride_d1,
+                                       d2,
+                                       stride_d2,
+                                       x1,
+                                       stride_x1,
+                                       y1,
+                                       stride_y1,
+                                       param,
+                                       strideparam,
+                                       batch_count);
 }
 
+// amax
 template <>
-hipblasStatus_t hipblasGemv<hipblasComplex>(hipblasHandle_t       handle,
-                                            hipblasOperation_t    transA,
-                                            int                   m,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       y,
-                                            int                   incy)
+hipblasStatus_t
+    hipblasIamax<float>(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 {
-    return hipblasCgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasIsamax(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasGemv<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  hipblasOperation_t          transA,
-                                                  int                         m,
-                                                  int                         n,
-                                                  const hipblasDoubleComplex* alpha,
-                                                  const hipblasDoubleComplex* A,
-                                                  int                         lda,
-                                                  const hipblasDoubleComplex* x,
-                                                  int                         incx,
-                                                  const hipblasDoubleComplex* beta,
-                                                  hipblasDoubleComplex*       y,
-                                                  int                         incy)
+hipblasStatus_t
+    hipblasIamax<double>(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 {
-    return hipblasZgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasIdamax(handle, n, x, incx, result);
 }
 
-// gemv_batched
 template <>
-hipblasStatus_t hipblasGemvBatched<float>(hipblasHandle_t    handle,
-                                          hipblasOperation_t transA,
-                                          int                m,
-                                          int                n,
-                                          const float*       alpha,
-                                          const float* const A[],
-                                          int                lda,
-                                          const float* const x[],
-                                          int                incx,
-                                          const float*       beta,
-                                          float* const       y[],
-                                          int                incy,
-                                          int                batch_count)
+hipblasStatus_t hipblasIamax<hipblasComplex>(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 {
-    return hipblasSgemvBatched(
-        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblasIcamax(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasGemvBatched<double>(hipblasHandle_t     handle,
-                                           hipblasOperation_t  transA,
-                                           int                 m,
-                                           int                 n,
-                                           const double*       alpha,
-                                           const double* const A[],
-                                           int                 lda,
-                                           const double* const x[],
-                                           int                 incx,
-                                           const double*       beta,
-                                           double* const       y[],
-                                           int                 incy,
-                                           int                 batch_count)
+hipblasStatus_t hipblasIamax<hipblasDoubleComplex>(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 {
-    return hipblasDgemvBatched(
-        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblasIzamax(handle, n, x, incx, result);
 }
 
+// amax_batched
 template <>
-hipblasStatus_t hipblasGemvBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          transA,
-                                                   int                         m,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex* const       y[],
-                                                   int                         incy,
-                                                   int                         batch_count)
-{
-    return hipblasCgemvBatched(
-        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+hipblasStatus_t hipblasIamaxBatched<float>(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, int* result)
+{
+    return hipblasIsamaxBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGemvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         hipblasOperation_t                transA,
-                                                         int                               m,
-                                                         int                               n,
-                                                         const hipblasDoubleComplex*       alpha,
-                                                         const hipblasDoubleComplex* const A[],
-                                                         int                               lda,
-                                                         const hipblasDoubleComplex* const x[],
-                                                         int                               incx,
-                                                         const hipblasDoubleComplex*       beta,
-                                                         hipblasDoubleComplex* const       y[],
-                                                         int                               incy,
-                                                         int batch_count)
+hipblasStatus_t hipblasIamaxBatched<double>(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batch_count, int* result)
 {
-    return hipblasZgemvBatched(
-        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    return hipblasIdamaxBatched(handle, n, x, incx, batch_count, result);
 }
 
-// gemv_strided_batched
 template <>
-hipblasStatus_t hipblasGemvStridedBatched<float>(hipblasHandle_t    handle,
-                                                 hipblasOperation_t transA,
-                                                 int                m,
-                                                 int                n,
-                                                 const float*       alpha,
-                                                 const float*       A,
-                                                 int                lda,
-                                                 hipblasStride      strideA,
-                                                 const float*       x,
-                                                 int                incx,
-                                                 hipblasStride      stridex,
-                                                 const float*       beta,
-                                                 float*             y,
-                                                 int                incy,
-                                                 hipblasStride      stridey,
-                                                 int                batch_count)
+hipblasStatus_t hipblasIamaxBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    int                         batch_count,
+                                                    int*                        result)
 {
-    return hipblasSgemvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batch_count);
+    return hipblasIcamaxBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGemvStridedBatched<double>(hipblasHandle_t    handle,
-                                                  hipblasOperation_t transA,
-                                                  int                m,
-                                                  int                n,
-                                                  const double*      alpha,
-                                                  const double*      A,
-                                                  int                lda,
-                                                  hipblasStride      strideA,
-                                                  const double*      x,
-                                                  int                incx,
-                                                  hipblasStride      stridex,
-                                                  const double*      beta,
-                                                  double*            y,
-                                                  int                incy,
-                                                  hipblasStride      stridey,
-                                                  int                batch_count)
+hipblasStatus_t hipblasIamaxBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                          int                               n,
+                                                          const hipblasDoubleComplex* const x[],
+                                                          int                               incx,
+                                                          int  batch_count,
+                                                          int* result)
 {
-    return hipblasDgemvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batch_count);
+    return hipblasIzamaxBatched(handle, n, x, incx, batch_count, result);
 }
 
+// amax_strided_batched
 template <>
-hipblasStatus_t hipblasGemvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    transA,
-                                                          int                   m,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batch_count)
+hipblasStatus_t hipblasIamaxStridedBatched<float>(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const float*    x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  int             batch_count,
+                                                  int*            result)
 {
-    return hipblasCgemvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batch_count);
+    return hipblasIsamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGemvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                hipblasOperation_t          transA,
-                                                                int                         m,
-                                                                int                         n,
-                                                                const hipblasDoubleComplex* alpha,
-                                                                const hipblasDoubleComplex* A,
-                                                                int                         lda,
-                                                                hipblasStride               strideA,
-                                                                const hipblasDoubleComplex* x,
-                                                                int                         incx,
-                                                                hipblasStride               stridex,
-                                                                const hipblasDoubleComplex* beta,
-                                                                hipblasDoubleComplex*       y,
-                                                                int                         incy,
-                                                                hipblasStride               stridey,
-                                                                int batch_count)
+hipblasStatus_t hipblasIamaxStridedBatched<double>(hipblasHandle_t handle,
+                                                   int             n,
+                                                   const double*   x,
+                                                   int             incx,
+                                                   hipblasStride   stridex,
+                                                   int             batch_count,
+                                                   int*            result)
 {
-    return hipblasZgemvStridedBatched(handle,
-                                      transA,
-                                      m,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batch_count);
+    return hipblasIdamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
-// ger
 template <>
-hipblasStatus_t hipblasGer<float, false>(hipblasHandle_t handle,
-                                         int             m,
-                                         int             n,
-                                         const float*    alpha,
-                                         const float*    x,
-                                         int             incx,
-                                         const float*    y,
-                                         int             incy,
-                                         float*          A,
-                                         int             lda)
+hipblasStatus_t hipblasIamaxStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           hipblasStride         stridex,
+                                                           int                   batch_count,
+                                                           int*                  result)
 {
-
-    return hipblasSger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasIcamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGer<double, false>(hipblasHandle_t handle,
-                                          int             m,
-                                          int             n,
-                                          const double*   alpha,
-                                          const double*   x,
-                                          int             incx,
-                                          const double*   y,
-                                          int             incy,
-                                          double*         A,
-                                          int             lda)
+hipblasStatus_t hipblasIamaxStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                 int                         n,
+                                                                 const hipblasDoubleComplex* x,
+                                                                 int                         incx,
+                                                                 hipblasStride stridex,
+                                                                 int           batch_count,
+                                                                 int*          result)
 {
-
-    return hipblasDger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasIzamaxStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
+// amin
 template <>
-hipblasStatus_t hipblasGer<hipblasComplex, false>(hipblasHandle_t       handle,
-                                                  int                   m,
-                                                  int                   n,
-                                                  const hipblasComplex* alpha,
-                                                  const hipblasComplex* x,
-                                                  int                   incx,
-                                                  const hipblasComplex* y,
-                                                  int                   incy,
-                                                  hipblasComplex*       A,
-                                                  int                   lda)
+hipblasStatus_t
+    hipblasIamin<float>(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 {
-
-    return hipblasCgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasIsamin(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasGer<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                 int                   m,
-                                                 int                   n,
-                                                 const hipblasComplex* alpha,
-                                                 const hipblasComplex* x,
-                                                 int                   incx,
-                                                 const hipblasComplex* y,
-                                                 int                   incy,
-                                                 hipblasComplex*       A,
-                                                 int                   lda)
+hipblasStatus_t
+    hipblasIamin<double>(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
 {
-
-    return hipblasCgerc(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasIdamin(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasGer<hipblasDoubleComplex, false>(hipblasHandle_t             handle,
-                                                        int                         m,
-                                                        int                         n,
-                                                        const hipblasDoubleComplex* alpha,
-                                                        const hipblasDoubleComplex* x,
-                                                        int                         incx,
-                                                        const hipblasDoubleComplex* y,
-                                                        int                         incy,
-                                                        hipblasDoubleComplex*       A,
-                                                        int                         lda)
+hipblasStatus_t hipblasIamin<hipblasComplex>(
+    hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
 {
-
-    return hipblasZgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasIcamin(handle, n, x, incx, result);
 }
 
 template <>
-hipblasStatus_t hipblasGer<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                       int                         m,
-                                                       int                         n,
-                                                       const hipblasDoubleComplex* alpha,
-                                                       const hipblasDoubleComplex* x,
-                                                       int                         incx,
-                                                       const hipblasDoubleComplex* y,
-                                                       int                         incy,
-                                                       hipblasDoubleComplex*       A,
-                                                       int                         lda)
+hipblasStatus_t hipblasIamin<hipblasDoubleComplex>(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
 {
-
-    return hipblasZgerc(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasIzamin(handle, n, x, incx, result);
 }
 
-// ger_batched
+// amin_batched
 template <>
-hipblasStatus_t hipblasGerBatched<float, false>(hipblasHandle_t    handle,
-                                                int                m,
-                                                int                n,
-                                                const float*       alpha,
-                                                const float* const x[],
-                                                int                incx,
-                                                const float* const y[],
-                                                int                incy,
-                                                float* const       A[],
-                                                int                lda,
-                                                int                batch_count)
+hipblasStatus_t hipblasIaminBatched<float>(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, int* result)
 {
-
-    return hipblasSgerBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+    return hipblasIsaminBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGerBatched<double, false>(hipblasHandle_t     handle,
-                                                 int                 m,
-                                                 int                 n,
-                                                 const double*       alpha,
-                                                 const double* const x[],
-                                                 int                 incx,
-                                                 const double* const y[],
-                                                 int                 incy,
-                                                 double* const       A[],
-                                                 int                 lda,
-                                                 int                 batch_count)
+hipblasStatus_t hipblasIaminBatched<double>(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batch_count, int* result)
 {
-
-    return hipblasDgerBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+    return hipblasIdaminBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGerBatched<hipblasComplex, false>(hipblasHandle_t             handle,
-                                                         int                         m,
-                                                         int                         n,
-                                                         const hipblasComplex*       alpha,
-                                                         const hipblasComplex* const x[],
-                                                         int                         incx,
-                                                         const hipblasComplex* const y[],
-                                                         int                         incy,
-                                                         hipblasComplex* const       A[],
-                                                         int                         lda,
-                                                         int                         batch_count)
+hipblasStatus_t hipblasIaminBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    int                         batch_count,
+                                                    int*                        result)
 {
-
-    return hipblasCgeruBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+    return hipblasIcaminBatched(handle, n, x, incx, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGerBatched<hipblasComplex, true>(hipblasHandle_t             handle,
-                                                        int                         m,
-                                                        int                         n,
-                                                        const hipblasComplex*       alpha,
-                                                        const hipblasComplex* const x[],
-                                                        int                         incx,
-                                                        const hipblasComplex* const y[],
-                                                        int                         incy,
-                                                        hipblasComplex* const       A[],
-                                                        int                         lda,
-                                                        int                         batch_count)
+hipblasStatus_t hipblasIaminBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                          int                               n,
+                                                          const hipblasDoubleComplex* const x[],
+                                                          int                               incx,
+                                                          int  batch_count,
+                                                          int* result)
 {
-
-    return hipblasCgercBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+    return hipblasIzaminBatched(handle, n, x, incx, batch_count, result);
 }
 
+// amin_strided_batched
 template <>
-hipblasStatus_t
-    hipblasGerBatched<hipblasDoubleComplex, false>(hipblasHandle_t                   handle,
-                                                   int                               m,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex* const y[],
-                                                   int                               incy,
-                                                   hipblasDoubleComplex* const       A[],
-                                                   int                               lda,
-                                                   int                               batch_count)
+hipblasStatus_t hipblasIaminStridedBatched<float>(hipblasHandle_t handle,
+                                                  int             n,
+                                                  const float*    x,
+                                                  int             incx,
+                                                  hipblasStride   stridex,
+                                                  int             batch_count,
+                                                  int*            result)
 {
-
-    return hipblasZgeruBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+    return hipblasIsaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGerBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                              int                         m,
-                                                              int                         n,
-                                                              const hipblasDoubleComplex* alpha,
-                                                              const hipblasDoubleComplex* const x[],
-                                                              int incx,
-                                                              const hipblasDoubleComplex* const y[],
-                                                              int                         incy,
-                                                              hipblasDoubleComplex* const A[],
-                                                              int                         lda,
-                                                              int batch_count)
+hipblasStatus_t hipblasIaminStridedBatched<double>(hipblasHandle_t handle,
+                                                   int             n,
+                                                   const double*   x,
+                                                   int             incx,
+                                                   hipblasStride   stridex,
+                                                   int             batch_count,
+                                                   int*            result)
 {
-
-    return hipblasZgercBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+    return hipblasIdaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
-// ger_strided_batched
 template <>
-hipblasStatus_t hipblasGerStridedBatched<float, false>(hipblasHandle_t handle,
-                                                       int             m,
-                                                       int             n,
-                                                       const float*    alpha,
-                                                       const float*    x,
-                                                       int             incx,
-                                                       hipblasStride   stridex,
-                                                       const float*    y,
-                                                       int             incy,
-                                                       hipblasStride   stridey,
-                                                       float*          A,
-                                                       int             lda,
-                                                       hipblasStride   strideA,
-                                                       int             batch_count)
+hipblasStatus_t hipblasIaminStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           hipblasStride         stridex,
+                                                           int                   batch_count,
+                                                           int*                  result)
 {
-
-    return hipblasSgerStridedBatched(
-        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+    return hipblasIcaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
 template <>
-hipblasStatus_t hipblasGerStridedBatched<double, false>(hipblasHandle_t handle,
-                                                        int             m,
-                                                        int             n,
-                                                        const double*   alpha,
-                                                        const double*   x,
-                                                        int             incx,
-                                                        hipblasStride   stridex,
-                                                        const double*   y,
-                                                        int             incy,
-                                                        hipblasStride   stridey,
-                                                        double*         A,
-                                                        int             lda,
-                                                        hipblasStride   strideA,
-                                                        int             batch_count)
+hipblasStatus_t hipblasIaminStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                 int                         n,
+                                                                 const hipblasDoubleComplex* x,
+                                                                 int                         incx,
+                                                                 hipblasStride stridex,
+                                                                 int           batch_count,
+                                                                 int*          result)
 {
-
-    return hipblasDgerStridedBatched(
-        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+    return hipblasIzaminStridedBatched(handle, n, x, incx, stridex, batch_count, result);
 }
 
+/*
+ * ===========================================================================
+ *    level 2 BLAS
+ * ===========================================================================
+ */
+
+// gbmv
 template <>
-hipblasStatus_t hipblasGerStridedBatched<hipblasComplex, false>(hipblasHandle_t       handle,
-                                                                int                   m,
-                                                                int                   n,
-                                                                const hipblasComplex* alpha,
-                                                                const hipblasComplex* x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                const hipblasComplex* y,
-                                                                int                   incy,
-                                                                hipblasStride         stridey,
-                                                                hipblasComplex*       A,
-                                                                int                   lda,
-                                                                hipblasStride         strideA,
-                                                                int                   batch_count)
+hipblasStatus_t hipblasGbmv<float>(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   int                m,
+                                   int                n,
+                                   int                kl,
+                                   int                ku,
+                                   const float*       alpha,
+                                   const float*       A,
+                                   int                lda,
+                                   const float*       x,
+                                   int                incx,
+                                   const float*       beta,
+                                   float*             y,
+                                   int                incy)
 {
+    return hipblasSgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
+}
 
-    return hipblasCgeruStridedBatched(
-        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+template <>
+hipblasStatus_t hipblasGbmv<double>(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    int                m,
+                                    int                n,
+                                    int                kl,
+                                    int                ku,
+                                    const double*      alpha,
+                                    const double*      A,
+                                    int                lda,
+                                    const double*      x,
+                                    int                incx,
+                                    const double*      beta,
+                                    double*            y,
+                                    int                incy)
+{
+    return hipblasDgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasGerStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                               int                   m,
-                                                               int                   n,
-                                                               const hipblasComplex* alpha,
-                                                               const hipblasComplex* x,
-                                                               int                   incx,
-                                                               hipblasStride         stridex,
-                                                               const hipblasComplex* y,
-                                                               int                   incy,
-                                                               hipblasStride         stridey,
-                                                               hipblasComplex*       A,
-                                                               int                   lda,
-                                                               hipblasStride         strideA,
-                                                               int                   batch_count)
-{
-
-    return hipblasCgercStridedBatched(
-        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
-}
-
-template <>
-hipblasStatus_t
-    hipblasGerStridedBatched<hipblasDoubleComplex, false>(hipblasHandle_t             handle,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          hipblasDoubleComplex*       A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          int                         batch_count)
-{
-
-    return hipblasZgeruStridedBatched(
-        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
-}
-
-template <>
-hipblasStatus_t
-    hipblasGerStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                         int                         m,
-                                                         int                         n,
-                                                         const hipblasDoubleComplex* alpha,
-                                                         const hipblasDoubleComplex* x,
-                                                         int                         incx,
-                                                         hipblasStride               stridex,
-                                                         const hipblasDoubleComplex* y,
-                                                         int                         incy,
-                                                         hipblasStride               stridey,
-                                                         hipblasDoubleComplex*       A,
-                                                         int                         lda,
-                                                         hipblasStride               strideA,
-                                                         int                         batch_count)
-{
-
-    return hipblasZgercStridedBatched(
-        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
-}
-
-// hbmv
-template <>
-hipblasStatus_t hipblasHbmv<hipblasComplex>(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
+hipblasStatus_t hipblasGbmv<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasOperation_t    transA,
+                                            int                   m,
                                             int                   n,
-                                            int                   k,
+                                            int                   kl,
+                                            int                   ku,
                                             const hipblasComplex* alpha,
                                             const hipblasComplex* A,
                                             int                   lda,
@@ -3054,14 +2994,16 @@ hipblasStatus_t hipblasHbmv<hipblasComplex>(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy)
 {
-    return hipblasChbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasCgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasHbmv<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
+hipblasStatus_t hipblasGbmv<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  int                         m,
                                                   int                         n,
-                                                  int                         k,
+                                                  int                         kl,
+                                                  int                         ku,
                                                   const hipblasDoubleComplex* alpha,
                                                   const hipblasDoubleComplex* A,
                                                   int                         lda,
@@ -3071,15 +3013,59 @@ hipblasStatus_t hipblasHbmv<hipblasDoubleComplex>(hipblasHandle_t             ha
                                                   hipblasDoubleComplex*       y,
                                                   int                         incy)
 {
-    return hipblasZhbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasZgbmv(handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy);
 }
 
-// hbmv_batched
+// gbmv_batched
 template <>
-hipblasStatus_t hipblasHbmvBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
+hipblasStatus_t hipblasGbmvBatched<float>(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          int                m,
+                                          int                n,
+                                          int                kl,
+                                          int                ku,
+                                          const float*       alpha,
+                                          const float* const A[],
+                                          int                lda,
+                                          const float* const x[],
+                                          int                incx,
+                                          const float*       beta,
+                                          float* const       y[],
+                                          int                incy,
+                                          int                batch_count)
+{
+    return hipblasSgbmvBatched(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGbmvBatched<double>(hipblasHandle_t     handle,
+                                           hipblasOperation_t  transA,
+                                           int                 m,
+                                           int                 n,
+                                           int                 kl,
+                                           int                 ku,
+                                           const double*       alpha,
+                                           const double* const A[],
+                                           int                 lda,
+                                           const double* const x[],
+                                           int                 incx,
+                                           const double*       beta,
+                                           double* const       y[],
+                                           int                 incy,
+                                           int                 batch_count)
+{
+    return hipblasDgbmvBatched(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGbmvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transA,
+                                                   int                         m,
                                                    int                         n,
-                                                   int                         k,
+                                                   int                         kl,
+                                                   int                         ku,
                                                    const hipblasComplex*       alpha,
                                                    const hipblasComplex* const A[],
                                                    int                         lda,
@@ -3088,17 +3074,19 @@ hipblasStatus_t hipblasHbmvBatched<hipblasComplex>(hipblasHandle_t             h
                                                    const hipblasComplex*       beta,
                                                    hipblasComplex* const       y[],
                                                    int                         incy,
-                                                   int                         batchCount)
+                                                   int                         batch_count)
 {
-    return hipblasChbmvBatched(
-        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasCgbmvBatched(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasHbmvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         hipblasFillMode_t                 uplo,
+hipblasStatus_t hipblasGbmvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasOperation_t                transA,
+                                                         int                               m,
                                                          int                               n,
-                                                         int                               k,
+                                                         int                               kl,
+                                                         int                               ku,
                                                          const hipblasDoubleComplex*       alpha,
                                                          const hipblasDoubleComplex* const A[],
                                                          int                               lda,
@@ -3107,158 +3095,100 @@ hipblasStatus_t hipblasHbmvBatched<hipblasDoubleComplex>(hipblasHandle_t
                                                          const hipblasDoubleComplex*       beta,
                                                          hipblasDoubleComplex* const       y[],
                                                          int                               incy,
-                                                         int batchCount)
+                                                         int batch_count)
 {
-    return hipblasZhbmvBatched(
-        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasZgbmvBatched(
+        handle, transA, m, n, kl, ku, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
-// hbmv_strided_batched
+// gbmv_strided_batched
 template <>
-hipblasStatus_t hipblasHbmvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          int                   n,
-                                                          int                   k,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batchCount)
+hipblasStatus_t hipblasGbmvStridedBatched<float>(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 int                m,
+                                                 int                n,
+                                                 int                kl,
+                                                 int                ku,
+                                                 const float*       alpha,
+                                                 const float*       A,
+                                                 int                lda,
+                                                 hipblasStride      stride_a,
+                                                 const float*       x,
+                                                 int                incx,
+                                                 hipblasStride      stride_x,
+                                                 const float*       beta,
+                                                 float*             y,
+                                                 int                incy,
+                                                 hipblasStride      stride_y,
+                                                 int                batch_count)
 {
-    return hipblasChbmvStridedBatched(handle,
-                                      uplo,
+    return hipblasSgbmvStridedBatched(handle,
+                                      transA,
+                                      m,
                                       n,
-                                      k,
+                                      kl,
+                                      ku,
                                       alpha,
                                       A,
                                       lda,
-                                      strideA,
+                                      stride_a,
                                       x,
                                       incx,
-                                      stridex,
+                                      stride_x,
                                       beta,
                                       y,
                                       incy,
-                                      stridey,
-                                      batchCount);
+                                      stride_y,
+                                      batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasHbmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                hipblasFillMode_t           uplo,
-                                                                int                         n,
-                                                                int                         k,
-                                                                const hipblasDoubleComplex* alpha,
-                                                                const hipblasDoubleComplex* A,
-                                                                int                         lda,
-                                                                hipblasStride               strideA,
-                                                                const hipblasDoubleComplex* x,
-                                                                int                         incx,
-                                                                hipblasStride               stridex,
-                                                                const hipblasDoubleComplex* beta,
-                                                                hipblasDoubleComplex*       y,
-                                                                int                         incy,
-                                                                hipblasStride               stridey,
-                                                                int batchCount)
+hipblasStatus_t hipblasGbmvStridedBatched<double>(hipblasHandle_t    handle,
+                                                  hipblasOperation_t transA,
+                                                  int                m,
+                                                  int                n,
+                                                  int                kl,
+                                                  int                ku,
+                                                  const double*      alpha,
+                                                  const double*      A,
+                                                  int                lda,
+                                                  hipblasStride      stride_a,
+                                                  const double*      x,
+                                                  int                incx,
+                                                  hipblasStride      stride_x,
+                                                  const double*      beta,
+                                                  double*            y,
+                                                  int                incy,
+                                                  hipblasStride      stride_y,
+                                                  int                batch_count)
 {
-    return hipblasZhbmvStridedBatched(handle,
-                                      uplo,
+    return hipblasDgbmvStridedBatched(handle,
+                                      transA,
+                                      m,
                                       n,
-                                      k,
+                                      kl,
+                                      ku,
                                       alpha,
                                       A,
                                       lda,
-                                      strideA,
+                                      stride_a,
                                       x,
                                       incx,
-                                      stridex,
+                                      stride_x,
                                       beta,
                                       y,
                                       incy,
-                                      stridey,
-                                      batchCount);
-}
-
-// hemv
-template <>
-hipblasStatus_t hipblasHemv<hipblasComplex>(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       y,
-                                            int                   incy)
-{
-    return hipblasChemv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
-}
-
-template <>
-hipblasStatus_t hipblasHemv<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
-                                                  int                         n,
-                                                  const hipblasDoubleComplex* alpha,
-                                                  const hipblasDoubleComplex* A,
-                                                  int                         lda,
-                                                  const hipblasDoubleComplex* x,
-                                                  int                         incx,
-                                                  const hipblasDoubleComplex* beta,
-                                                  hipblasDoubleComplex*       y,
-                                                  int                         incy)
-{
-    return hipblasZhemv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
-}
-
-// hemv_batched
-template <>
-hipblasStatus_t hipblasHemvBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex* const       y[],
-                                                   int                         incy,
-                                                   int                         batch_count)
-{
-    return hipblasChemvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
-}
-
-template <>
-hipblasStatus_t hipblasHemvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         hipblasFillMode_t                 uplo,
-                                                         int                               n,
-                                                         const hipblasDoubleComplex*       alpha,
-                                                         const hipblasDoubleComplex* const A[],
-                                                         int                               lda,
-                                                         const hipblasDoubleComplex* const x[],
-                                                         int                               incx,
-                                                         const hipblasDoubleComplex*       beta,
-                                                         hipblasDoubleComplex* const       y[],
-                                                         int                               incy,
-                                                         int batch_count)
-{
-    return hipblasZhemvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+                                      stride_y,
+                                      batch_count);
 }
 
-// hemv_strided_batched
 template <>
-hipblasStatus_t hipblasHemvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
+hipblasStatus_t hipblasGbmvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    transA,
+                                                          int                   m,
                                                           int                   n,
+                                                          int                   kl,
+                                                          int                   ku,
                                                           const hipblasComplex* alpha,
                                                           const hipblasComplex* A,
                                                           int                   lda,
@@ -3272,9 +3202,12 @@ hipblasStatus_t hipblasHemvStridedBatched<hipblasComplex>(hipblasHandle_t
                                                           hipblasStride         stride_y,
                                                           int                   batch_count)
 {
-    return hipblasChemvStridedBatched(handle,
-                                      uplo,
+    return hipblasCgbmvStridedBatched(handle,
+                                      transA,
+                                      m,
                                       n,
+                                      kl,
+                                      ku,
                                       alpha,
                                       A,
                                       lda,
@@ -3290,9 +3223,12 @@ hipblasStatus_t hipblasHemvStridedBatched<hipblasComplex>(hipblasHandle_t
 }
 
 template <>
-hipblasStatus_t hipblasHemvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                hipblasFillMode_t           uplo,
+hipblasStatus_t hipblasGbmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasOperation_t          transA,
+                                                                int                         m,
                                                                 int                         n,
+                                                                int                         kl,
+                                                                int                         ku,
                                                                 const hipblasDoubleComplex* alpha,
                                                                 const hipblasDoubleComplex* A,
                                                                 int                         lda,
@@ -3306,9 +3242,12 @@ hipblasStatus_t hipblasHemvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
                                                                 hipblasStride stride_y,
                                                                 int           batch_count)
 {
-    return hipblasZhemvStridedBatched(handle,
-                                      uplo,
+    return hipblasZgbmvStridedBatched(handle,
+                                      transA,
+                                      m,
                                       n,
+                                      kl,
+                                      ku,
                                       alpha,
                                       A,
                                       lda,
@@ -3323,592 +3262,2299 @@ hipblasStatus_t hipblasHemvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
                                       batch_count);
 }
 
-// her
-template <>
-hipblasStatus_t hipblasHer<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                  hipblasFillMode_t     uplo,
-                                                  int                   n,
-                                                  const float*          alpha,
-                                                  const hipblasComplex* x,
-                                                  int                   incx,
-                                                  hipblasComplex*       A,
-                                                  int                   lda)
-{
-    return hipblasCher(handle, uplo, n, alpha, x, incx, A, lda);
-}
-
-template <>
-hipblasStatus_t hipblasHer<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const double*               alpha,
-                                                         const hipblasDoubleComplex* x,
-                                                         int                         incx,
-                                                         hipblasDoubleComplex*       A,
-                                                         int                         lda)
-{
-    return hipblasZher(handle, uplo, n, alpha, x, incx, A, lda);
-}
-
-// her_batched
-template <>
-hipblasStatus_t hipblasHerBatched<hipblasComplex, float>(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const float*                alpha,
-                                                         const hipblasComplex* const x[],
-                                                         int                         incx,
-                                                         hipblasComplex* const       A[],
-                                                         int                         lda,
-                                                         int                         batchCount)
-{
-    return hipblasCherBatched(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
-}
-
-template <>
-hipblasStatus_t
-    hipblasHerBatched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
-                                                    hipblasFillMode_t                 uplo,
-                                                    int                               n,
-                                                    const double*                     alpha,
-                                                    const hipblasDoubleComplex* const x[],
-                                                    int                               incx,
-                                                    hipblasDoubleComplex* const       A[],
-                                                    int                               lda,
-                                                    int                               batchCount)
-{
-    return hipblasZherBatched(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
-}
-
-// her_strided_batched
+// gemv
 template <>
-hipblasStatus_t hipblasHerStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                                hipblasFillMode_t     uplo,
-                                                                int                   n,
-                                                                const float*          alpha,
-                                                                const hipblasComplex* x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                hipblasComplex*       A,
-                                                                int                   lda,
-                                                                hipblasStride         strideA,
-                                                                int                   batchCount)
+hipblasStatus_t hipblasGemv<float>(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   int                m,
+                                   int                n,
+                                   const float*       alpha,
+                                   const float*       A,
+                                   int                lda,
+                                   const float*       x,
+                                   int                incx,
+                                   const float*       beta,
+                                   float*             y,
+                                   int                incy)
 {
-    return hipblasCherStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblasSgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t
-    hipblasHerStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                           hipblasFillMode_t           uplo,
-                                                           int                         n,
-                                                           const double*               alpha,
-                                                           const hipblasDoubleComplex* x,
-                                                           int                         incx,
-                                                           hipblasStride               stridex,
-                                                           hipblasDoubleComplex*       A,
-                                                           int                         lda,
-                                                           hipblasStride               strideA,
-                                                           int                         batchCount)
+hipblasStatus_t hipblasGemv<double>(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    int                m,
+                                    int                n,
+                                    const double*      alpha,
+                                    const double*      A,
+                                    int                lda,
+                                    const double*      x,
+                                    int                incx,
+                                    const double*      beta,
+                                    double*            y,
+                                    int                incy)
 {
-    return hipblasZherStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+    return hipblasDgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
-// her2
 template <>
-hipblasStatus_t hipblasHer2<hipblasComplex>(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
+hipblasStatus_t hipblasGemv<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasOperation_t    transA,
+                                            int                   m,
                                             int                   n,
                                             const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
                                             const hipblasComplex* x,
                                             int                   incx,
-                                            const hipblasComplex* y,
-                                            int                   incy,
-                                            hipblasComplex*       A,
-                                            int                   lda)
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy)
 {
-    return hipblasCher2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasCgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasHer2<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
+hipblasStatus_t hipblasGemv<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  int                         m,
                                                   int                         n,
                                                   const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int                         lda,
                                                   const hipblasDoubleComplex* x,
                                                   int                         incx,
-                                                  const hipblasDoubleComplex* y,
-                                                  int                         incy,
-                                                  hipblasDoubleComplex*       A,
-                                                  int                         lda)
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int                         incy)
 {
-    return hipblasZher2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasZgemv(handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
-// her2_batched
+// gemv_batched
 template <>
-hipblasStatus_t hipblasHer2Batched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex* const y[],
-                                                   int                         incy,
-                                                   hipblasComplex* const       A[],
-                                                   int                         lda,
-                                                   int                         batchCount)
-{
-    return hipblasCher2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasHer2Batched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         hipblasFillMode_t                 uplo,
-                                                         int                               n,
-                                                         const hipblasDoubleComplex*       alpha,
-                                                         const hipblasDoubleComplex* const x[],
-                                                         int                               incx,
-                                                         const hipblasDoubleComplex* const y[],
-                                                         int                               incy,
-                                                         hipblasDoubleComplex* const       A[],
-                                                         int                               lda,
-                                                         int batchCount)
-{
-    return hipblasZher2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
-}
-
-// her2_strided_batched
-template <>
-hipblasStatus_t hipblasHer2StridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          hipblasComplex*       A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          int                   batchCount)
-{
-    return hipblasCher2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasHer2StridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                hipblasFillMode_t           uplo,
-                                                                int                         n,
-                                                                const hipblasDoubleComplex* alpha,
-                                                                const hipblasDoubleComplex* x,
-                                                                int                         incx,
-                                                                hipblasStride               stridex,
-                                                                const hipblasDoubleComplex* y,
-                                                                int                         incy,
-                                                                hipblasStride               stridey,
-                                                                hipblasDoubleComplex*       A,
-                                                                int                         lda,
-                                                                hipblasStride               strideA,
-                                                                int batchCount)
-{
-    return hipblasZher2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
-}
-
-// hpmv
-template <>
-hipblasStatus_t hipblasHpmv<hipblasComplex>(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* AP,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       y,
-                                            int                   incy)
+hipblasStatus_t hipblasGemvBatched<float>(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          int                m,
+                                          int                n,
+                                          const float*       alpha,
+                                          const float* const A[],
+                                          int                lda,
+                                          const float* const x[],
+                                          int                incx,
+                                          const float*       beta,
+                                          float* const       y[],
+                                          int                incy,
+                                          int                batch_count)
 {
-    return hipblasChpmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+    return hipblasSgemvBatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasHpmv<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
-                                                  int                         n,
-                                                  const hipblasDoubleComplex* alpha,
-                                                  const hipblasDoubleComplex* AP,
-                                                  const hipblasDoubleComplex* x,
-                                                  int                         incx,
-                                                  const hipblasDoubleComplex* beta,
-                                                  hipblasDoubleComplex*       y,
-                                                  int                         incy)
+hipblasStatus_t hipblasGemvBatched<double>(hipblasHandle_t     handle,
+                                           hipblasOperation_t  transA,
+                                           int                 m,
+                                           int                 n,
+                                           const double*       alpha,
+                                           const double* const A[],
+                                           int                 lda,
+                                           const double* const x[],
+                                           int                 incx,
+                                           const double*       beta,
+                                           double* const       y[],
+                                           int                 incy,
+                                           int                 batch_count)
 {
-    return hipblasZhpmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+    return hipblasDgemvBatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
-// hpmv_batched
 template <>
-hipblasStatus_t hipblasHpmvBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
+hipblasStatus_t hipblasGemvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transA,
+                                                   int                         m,
                                                    int                         n,
                                                    const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const AP[],
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
                                                    const hipblasComplex* const x[],
                                                    int                         incx,
                                                    const hipblasComplex*       beta,
                                                    hipblasComplex* const       y[],
                                                    int                         incy,
-                                                   int                         batchCount)
+                                                   int                         batch_count)
 {
-    return hipblasChpmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblasCgemvBatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasHpmvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         hipblasFillMode_t                 uplo,
+hipblasStatus_t hipblasGemvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasOperation_t                transA,
+                                                         int                               m,
                                                          int                               n,
                                                          const hipblasDoubleComplex*       alpha,
-                                                         const hipblasDoubleComplex* const AP[],
+                                                         const hipblasDoubleComplex* const A[],
+                                                         int                               lda,
                                                          const hipblasDoubleComplex* const x[],
                                                          int                               incx,
                                                          const hipblasDoubleComplex*       beta,
                                                          hipblasDoubleComplex* const       y[],
                                                          int                               incy,
-                                                         int batchCount)
+                                                         int batch_count)
 {
-    return hipblasZhpmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblasZgemvBatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
-// hpmv_strided_batched
+// gemv_batched_host_ptrs
 template <>
-hipblasStatus_t hipblasHpmvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* AP,
-                                                          hipblasStride         strideAP,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batchCount)
+hipblasStatus_t hipblasGemvBatchedHostPtrs<float>(hipblasHandle_t    handle,
+                                                  hipblasOperation_t transA,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float* const A[],
+                                                  int                lda,
+                                                  const float* const x[],
+                                                  int                incx,
+                                                  const float*       beta,
+                                                  float* const       y[],
+                                                  int                incy,
+                                                  int                batch_count)
 {
-    return hipblasChpmvStridedBatched(
-        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+    return hipblasSgemvBatchedHostPtrs(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasHpmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                hipblasFillMode_t           uplo,
-                                                                int                         n,
-                                                                const hipblasDoubleComplex* alpha,
-                                                                const hipblasDoubleComplex* AP,
-                                                                hipblasStride strideAP,
-                                                                const hipblasDoubleComplex* x,
-                                                                int                         incx,
-                                                                hipblasStride               stridex,
-                                                                const hipblasDoubleComplex* beta,
-                                                                hipblasDoubleComplex*       y,
-                                                                int                         incy,
-                                                                hipblasStride               stridey,
-                                                                int batchCount)
+hipblasStatus_t hipblasGemvBatchedHostPtrs<double>(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transA,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double*       beta,
+                                                   double* const       y[],
+                                                   int                 incy,
+                                                   int                 batch_count)
 {
-    return hipblasZhpmvStridedBatched(
-        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+    return hipblasDgemvBatchedHostPtrs(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
-// hpr
 template <>
-hipblasStatus_t hipblasHpr<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                  hipblasFillMode_t     uplo,
-                                                  int                   n,
-                                                  const float*          alpha,
-                                                  const hipblasComplex* x,
-                                                  int                   incx,
-                                                  hipblasComplex*       AP)
+hipblasStatus_t hipblasGemvBatchedHostPtrs<hipblasComplex>(hipblasHandle_t             handle,
+                                                           hipblasOperation_t          transA,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex* const x[],
+                                                           int                         incx,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       y[],
+                                                           int                         incy,
+                                                           int                         batch_count)
 {
-    return hipblasChpr(handle, uplo, n, alpha, x, incx, AP);
+    return hipblasCgemvBatchedHostPtrs(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasHpr<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const double*               alpha,
-                                                         const hipblasDoubleComplex* x,
-                                                         int                         incx,
-                                                         hipblasDoubleComplex*       AP)
+hipblasStatus_t
+    hipblasGemvBatchedHostPtrs<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                     hipblasOperation_t                transA,
+                                                     int                               m,
+                                                     int                               n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     int                               lda,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int                               incx,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     hipblasDoubleComplex* const       y[],
+                                                     int                               incy,
+                                                     int                               batch_count)
 {
-    return hipblasZhpr(handle, uplo, n, alpha, x, incx, AP);
+    return hipblasZgemvBatchedHostPtrs(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
-// hpr_batched
+// gemv_vbatched
 template <>
-hipblasStatus_t hipblasHprBatched<hipblasComplex, float>(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const float*                alpha,
-                                                         const hipblasComplex* const x[],
-                                                         int                         incx,
-                                                         hipblasComplex* const       AP[],
-                                                         int                         batchCount)
+hipblasStatus_t hipblasGemvVbatched<float>(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           const int          m[],
+                                           const int          n[],
+                                           const float*       alpha,
+                                           const float* const A[],
+                                           const int          lda[],
+                                           const float* const x[],
+                                           const int          incx[],
+                                           const float*       beta,
+                                           float* const       y[],
+                                           const int          incy[],
+                                           int                batch_count)
 {
-    return hipblasChprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblasSgemvVbatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
 template <>
-hipblasStatus_t
-    hipblasHprBatched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
-                                                    hipblasFillMode_t                 uplo,
-                                                    int                               n,
-                                                    const double*                     alpha,
-                                                    const hipblasDoubleComplex* const x[],
-                                                    int                               incx,
-                                                    hipblasDoubleComplex* const       AP[],
-                                                    int                               batchCount)
+hipblasStatus_t hipblasGemvVbatched<double>(hipblasHandle_t     handle,
+                                            hipblasOperation_t  transA,
+                                            const int           m[],
+                                            const int           n[],
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            const int           lda[],
+                                            const double* const x[],
+                                            const int           incx[],
+                                            const double*       beta,
+                                            double* const       y[],
+                                            const int           incy[],
+                                            int                 batch_count)
 {
-    return hipblasZhprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblasDgemvVbatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
 }
 
-// hpr_strided_batched
 template <>
-hipblasStatus_t hipblasHprStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
-                                                                hipblasFillMode_t     uplo,
-                                                                int                   n,
-                                                                const float*          alpha,
-                                                                const hipblasComplex* x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                hipblasComplex*       AP,
-                                                                hipblasStride         strideAP,
-                                                                int                   batchCount)
+hipblasStatus_t hipblasGemvVbatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    const int                   m[],
+                                                    const int                   n[],
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    const hipblasComplex* const x[],
+                                                    const int                   incx[],
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       y[],
+                                                    const int                   incy[],
+                                                    int                         batch_count)
+{
+    return hipblasCgemvVbatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGemvVbatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                              hipblasOperation_t                transA,
+                                              const int                         m[],
+                                              const int                         n[],
+                                              const hipblasDoubleComplex*       alpha,
+                                              const hipblasDoubleComplex* const A[],
+                                              const int                         lda[],
+                                              const hipblasDoubleComplex* const x[],
+                                              const int                         incx[],
+                                              const hipblasDoubleComplex*       beta,
+                                              hipblasDoubleComplex* const       y[],
+                                              const int                         incy[],
+                                              int                               batch_count)
+{
+    return hipblasZgemvVbatched(
+        handle, transA, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+// gemv_strided_batched
+template <>
+hipblasStatus_t hipblasGemvStridedBatched<float>(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 int                m,
+                                                 int                n,
+                                                 const float*       alpha,
+                                                 const float*       A,
+                                                 int                lda,
+                                                 hipblasStride      strideA,
+                                                 const float*       x,
+                                                 int                incx,
+                                                 hipblasStride      stridex,
+                                                 const float*       beta,
+                                                 float*             y,
+                                                 int                incy,
+                                                 hipblasStride      stridey,
+                                                 int                batch_count)
+{
+    return hipblasSgemvStridedBatched(handle,
+                                      transA,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemvStridedBatched<double>(hipblasHandle_t    handle,
+                                                  hipblasOperation_t transA,
+                                                  int                m,
+                                                  int                n,
+                                                  const double*      alpha,
+                                                  const double*      A,
+                                                  int                lda,
+                                                  hipblasStride      strideA,
+                                                  const double*      x,
+                                                  int                incx,
+                                                  hipblasStride      stridex,
+                                                  const double*      beta,
+                                                  double*            y,
+                                                  int                incy,
+                                                  hipblasStride      stridey,
+                                                  int                batch_count)
+{
+    return hipblasDgemvStridedBatched(handle,
+                                      transA,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    transA,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batch_count)
+{
+    return hipblasCgemvStridedBatched(handle,
+                                      transA,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasOperation_t          transA,
+                                                                int                         m,
+                                                                int                         n,
+                                                                const hipblasDoubleComplex* alpha,
+                                                                const hipblasDoubleComplex* A,
+                                                                int                         lda,
+                                                                hipblasStride               strideA,
+                                                                const hipblasDoubleComplex* x,
+                                                                int                         incx,
+                                                                hipblasStride               stridex,
+                                                                const hipblasDoubleComplex* beta,
+                                                                hipblasDoubleComplex*       y,
+                                                                int                         incy,
+                                                                hipblasStride               stridey,
+                                                                int batch_count)
+{
+    return hipblasZgemvStridedBatched(handle,
+                                      transA,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batch_count);
+}
+
+// ger
+template <>
+hipblasStatus_t hipblasGer<float, false>(hipblasHandle_t handle,
+                                         int             m,
+                                         int             n,
+                                         const float*    alpha,
+                                         const float*    x,
+                                         int             incx,
+                                         const float*    y,
+                                         int             incy,
+                                         float*          A,
+                                         int             lda)
+{
+
+    return hipblasSger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer<double, false>(hipblasHandle_t handle,
+                                          int             m,
+                                          int             n,
+                                          const double*   alpha,
+                                          const double*   x,
+                                          int             incx,
+                                          const double*   y,
+                                          int             incy,
+                                          double*         A,
+                                          int             lda)
+{
+
+    return hipblasDger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer<hipblasComplex, false>(hipblasHandle_t       handle,
+                                                  int                   m,
+                                                  int                   n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  const hipblasComplex* y,
+                                                  int                   incy,
+                                                  hipblasComplex*       A,
+                                                  int                   lda)
+{
+
+    return hipblasCgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                 int                   m,
+                                                 int                   n,
+                                                 const hipblasComplex* alpha,
+                                                 const hipblasComplex* x,
+                                                 int                   incx,
+                                                 const hipblasComplex* y,
+                                                 int                   incy,
+                                                 hipblasComplex*       A,
+                                                 int                   lda)
+{
+
+    return hipblasCgerc(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer<hipblasDoubleComplex, false>(hipblasHandle_t             handle,
+                                                        int                         m,
+                                                        int                         n,
+                                                        const hipblasDoubleComplex* alpha,
+                                                        const hipblasDoubleComplex* x,
+                                                        int                         incx,
+                                                        const hipblasDoubleComplex* y,
+                                                        int                         incy,
+                                                        hipblasDoubleComplex*       A,
+                                                        int                         lda)
+{
+
+    return hipblasZgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGer<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                       int                         m,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* alpha,
+                                                       const hipblasDoubleComplex* x,
+                                                       int                         incx,
+                                                       const hipblasDoubleComplex* y,
+                                                       int                         incy,
+                                                       hipblasDoubleComplex*       A,
+                                                       int                         lda)
+{
+
+    return hipblasZgerc(handle, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+// ger_batched
+template <>
+hipblasStatus_t hipblasGerBatched<float, false>(hipblasHandle_t    handle,
+                                                int                m,
+                                                int                n,
+                                                const float*       alpha,
+                                                const float* const x[],
+                                                int                incx,
+                                                const float* const y[],
+                                                int                incy,
+                                                float* const       A[],
+                                                int                lda,
+                                                int                batch_count)
+{
+
+    return hipblasSgerBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGerBatched<double, false>(hipblasHandle_t     handle,
+                                                 int                 m,
+                                                 int                 n,
+                                                 const double*       alpha,
+                                                 const double* const x[],
+                                                 int                 incx,
+                                                 const double* const y[],
+                                                 int                 incy,
+                                                 double* const       A[],
+                                                 int                 lda,
+                                                 int                 batch_count)
+{
+
+    return hipblasDgerBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGerBatched<hipblasComplex, false>(hipblasHandle_t             handle,
+                                                         int                         m,
+                                                         int                         n,
+                                                         const hipblasComplex*       alpha,
+                                                         const hipblasComplex* const x[],
+                                                         int                         incx,
+                                                         const hipblasComplex* const y[],
+                                                         int                         incy,
+                                                         hipblasComplex* const       A[],
+                                                         int                         lda,
+                                                         int                         batch_count)
+{
+
+    return hipblasCgeruBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGerBatched<hipblasComplex, true>(hipblasHandle_t             handle,
+                                                        int                         m,
+                                                        int                         n,
+                                                        const hipblasComplex*       alpha,
+                                                        const hipblasComplex* const x[],
+                                                        int                         incx,
+                                                        const hipblasComplex* const y[],
+                                                        int                         incy,
+                                                        hipblasComplex* const       A[],
+                                                        int                         lda,
+                                                        int                         batch_count)
+{
+
+    return hipblasCgercBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGerBatched<hipblasDoubleComplex, false>(hipblasHandle_t                   handle,
+                                                   int                               m,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex* const y[],
+                                                   int                               incy,
+                                                   hipblasDoubleComplex* const       A[],
+                                                   int                               lda,
+                                                   int                               batch_count)
+{
+
+    return hipblasZgeruBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGerBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                              int                         m,
+                                                              int                         n,
+                                                              const hipblasDoubleComplex* alpha,
+                                                              const hipblasDoubleComplex* const x[],
+                                                              int incx,
+                                                              const hipblasDoubleComplex* const y[],
+                                                              int                         incy,
+                                                              hipblasDoubleComplex* const A[],
+                                                              int                         lda,
+                                                              int batch_count)
+{
+
+    return hipblasZgercBatched(handle, m, n, alpha, x, incx, y, incy, A, lda, batch_count);
+}
+
+// ger_strided_batched
+template <>
+hipblasStatus_t hipblasGerStridedBatched<float, false>(hipblasHandle_t handle,
+                                                       int             m,
+                                                       int             n,
+                                                       const float*    alpha,
+                                                       const float*    x,
+                                                       int             incx,
+                                                       hipblasStride   stridex,
+                                                       const float*    y,
+                                                       int             incy,
+                                                       hipblasStride   stridey,
+                                                       float*          A,
+                                                       int             lda,
+                                                       hipblasStride   strideA,
+                                                       int             batch_count)
+{
+
+    return hipblasSgerStridedBatched(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGerStridedBatched<double, false>(hipblasHandle_t handle,
+                                                        int             m,
+                                                        int             n,
+                                                        const double*   alpha,
+                                                        const double*   x,
+                                                        int             incx,
+                                                        hipblasStride   stridex,
+                                                        const double*   y,
+                                                        int             incy,
+                                                        hipblasStride   stridey,
+                                                        double*         A,
+                                                        int             lda,
+                                                        hipblasStride   strideA,
+                                                        int             batch_count)
+{
+
+    return hipblasDgerStridedBatched(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGerStridedBatched<hipblasComplex, false>(hipblasHandle_t       handle,
+                                                                int                   m,
+                                                                int                   n,
+                                                                const hipblasComplex* alpha,
+                                                                const hipblasComplex* x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                const hipblasComplex* y,
+                                                                int                   incy,
+                                                                hipblasStride         stridey,
+                                                                hipblasComplex*       A,
+                                                                int                   lda,
+                                                                hipblasStride         strideA,
+                                                                int                   batch_count)
+{
+
+    return hipblasCgeruStridedBatched(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGerStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                               int                   m,
+                                                               int                   n,
+                                                               const hipblasComplex* alpha,
+                                                               const hipblasComplex* x,
+                                                               int                   incx,
+                                                               hipblasStride         stridex,
+                                                               const hipblasComplex* y,
+                                                               int                   incy,
+                                                               hipblasStride         stridey,
+                                                               hipblasComplex*       A,
+                                                               int                   lda,
+                                                               hipblasStride         strideA,
+                                                               int                   batch_count)
+{
+
+    return hipblasCgercStridedBatched(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGerStridedBatched<hipblasDoubleComplex, false>(hipblasHandle_t             handle,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          hipblasDoubleComplex*       A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          int                         batch_count)
+{
+
+    return hipblasZgeruStridedBatched(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGerStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                         int                         m,
+                                                         int                         n,
+                                                         const hipblasDoubleComplex* alpha,
+                                                         const hipblasDoubleComplex* x,
+                                                         int                         incx,
+                                                         hipblasStride               stridex,
+                                                         const hipblasDoubleComplex* y,
+                                                         int                         incy,
+                                                         hipblasStride               stridey,
+                                                         hipblasDoubleComplex*       A,
+                                                         int                         lda,
+                                                         hipblasStride               strideA,
+                                                         int                         batch_count)
+{
+
+    return hipblasZgercStridedBatched(
+        handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
+}
+
+// hbmv
+template <>
+hipblasStatus_t hipblasHbmv<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy)
+{
+    return hipblasChbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasHbmv<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  int                         k,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int                         lda,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int                         incy)
+{
+    return hipblasZhbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+// hbmv_batched
+template <>
+hipblasStatus_t hipblasHbmvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       y[],
+                                                   int                         incy,
+                                                   int                         batchCount)
+{
+    return hipblasChbmvBatched(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHbmvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasFillMode_t                 uplo,
+                                                         int                               n,
+                                                         int                               k,
+                                                         const hipblasDoubleComplex*       alpha,
+                                                         const hipblasDoubleComplex* const A[],
+                                                         int                               lda,
+                                                         const hipblasDoubleComplex* const x[],
+                                                         int                               incx,
+                                                         const hipblasDoubleComplex*       beta,
+                                                         hipblasDoubleComplex* const       y[],
+                                                         int                               incy,
+                                                         int batchCount)
+{
+    return hipblasZhbmvBatched(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+// hbmv_strided_batched
+template <>
+hipblasStatus_t hipblasHbmvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batchCount)
+{
+    return hipblasChbmvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHbmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasFillMode_t           uplo,
+                                                                int                         n,
+                                                                int                         k,
+                                                                const hipblasDoubleComplex* alpha,
+                                                                const hipblasDoubleComplex* A,
+                                                                int                         lda,
+                                                                hipblasStride               strideA,
+                                                                const hipblasDoubleComplex* x,
+                                                                int                         incx,
+                                                                hipblasStride               stridex,
+                                                                const hipblasDoubleComplex* beta,
+                                                                hipblasDoubleComplex*       y,
+                                                                int                         incy,
+                                                                hipblasStride               stridey,
+                                                                int batchCount)
+{
+    return hipblasZhbmvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+
+// hemv
+template <>
+hipblasStatus_t hipblasHemv<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy)
+{
+    return hipblasChemv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasHemv<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int                         lda,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int                         incy)
+{
+    return hipblasZhemv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+// hemv_batched
+template <>
+hipblasStatus_t hipblasHemvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       y[],
+                                                   int                         incy,
+                                                   int                         batch_count)
+{
+    return hipblasChemvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasHemvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasFillMode_t                 uplo,
+                                                         int                               n,
+                                                         const hipblasDoubleComplex*       alpha,
+                                                         const hipblasDoubleComplex* const A[],
+                                                         int                               lda,
+                                                         const hipblasDoubleComplex* const x[],
+                                                         int                               incx,
+                                                         const hipblasDoubleComplex*       beta,
+                                                         hipblasDoubleComplex* const       y[],
+                                                         int                               incy,
+                                                         int batch_count)
+{
+    return hipblasZhemvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+// hemv_strided_batched
+template <>
+hipblasStatus_t hipblasHemvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         stride_a,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stride_x,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stride_y,
+                                                          int                   batch_count)
+{
+    return hipblasChemvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      stride_a,
+                                      x,
+                                      incx,
+                                      stride_x,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stride_y,
+                                      batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasHemvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasFillMode_t           uplo,
+                                                                int                         n,
+                                                                const hipblasDoubleComplex* alpha,
+                                                                const hipblasDoubleComplex* A,
+                                                                int                         lda,
+                                                                hipblasStride stride_a,
+                                                                const hipblasDoubleComplex* x,
+                                                                int                         incx,
+                                                                hipblasStride stride_x,
+                                                                const hipblasDoubleComplex* beta,
+                                                                hipblasDoubleComplex*       y,
+                                                                int                         incy,
+                                                                hipblasStride stride_y,
+                                                                int           batch_count)
+{
+    return hipblasZhemvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      stride_a,
+                                      x,
+                                      incx,
+                                      stride_x,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stride_y,
+                                      batch_count);
+}
+
+// her
+template <>
+hipblasStatus_t hipblasHer<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int                   n,
+                                                  const float*          alpha,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  hipblasComplex*       A,
+                                                  int                   lda)
+{
+    return hipblasCher(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasHer<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const double*               alpha,
+                                                         const hipblasDoubleComplex* x,
+                                                         int                         incx,
+                                                         hipblasDoubleComplex*       A,
+                                                         int                         lda)
+{
+    return hipblasZher(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+// her_batched
+template <>
+hipblasStatus_t hipblasHerBatched<hipblasComplex, float>(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const float*                alpha,
+                                                         const hipblasComplex* const x[],
+                                                         int                         incx,
+                                                         hipblasComplex* const       A[],
+                                                         int                         lda,
+                                                         int                         batchCount)
+{
+    return hipblasCherBatched(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasHerBatched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    int                               n,
+                                                    const double*                     alpha,
+                                                    const hipblasDoubleComplex* const x[],
+                                                    int                               incx,
+                                                    hipblasDoubleComplex* const       A[],
+                                                    int                               lda,
+                                                    int                               batchCount)
+{
+    return hipblasZherBatched(handle, uplo, n, alpha, x, incx, A, lda, batchCount);
+}
+
+// her_strided_batched
+template <>
+hipblasStatus_t hipblasHerStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                                hipblasFillMode_t     uplo,
+                                                                int                   n,
+                                                                const float*          alpha,
+                                                                const hipblasComplex* x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                hipblasComplex*       A,
+                                                                int                   lda,
+                                                                hipblasStride         strideA,
+                                                                int                   batchCount)
+{
+    return hipblasCherStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasHerStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         n,
+                                                           const double*               alpha,
+                                                           const hipblasDoubleComplex* x,
+                                                           int                         incx,
+                                                           hipblasStride               stridex,
+                                                           hipblasDoubleComplex*       A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           int                         batchCount)
+{
+    return hipblasZherStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batchCount);
+}
+
+// her2
+template <>
+hipblasStatus_t hipblasHer2<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* y,
+                                            int                   incy,
+                                            hipblasComplex*       A,
+                                            int                   lda)
+{
+    return hipblasCher2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasHer2<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  const hipblasDoubleComplex* y,
+                                                  int                         incy,
+                                                  hipblasDoubleComplex*       A,
+                                                  int                         lda)
+{
+    return hipblasZher2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+// her2_batched
+template <>
+hipblasStatus_t hipblasHer2Batched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex* const y[],
+                                                   int                         incy,
+                                                   hipblasComplex* const       A[],
+                                                   int                         lda,
+                                                   int                         batchCount)
+{
+    return hipblasCher2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHer2Batched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasFillMode_t                 uplo,
+                                                         int                               n,
+                                                         const hipblasDoubleComplex*       alpha,
+                                                         const hipblasDoubleComplex* const x[],
+                                                         int                               incx,
+                                                         const hipblasDoubleComplex* const y[],
+                                                         int                               incy,
+                                                         hipblasDoubleComplex* const       A[],
+                                                         int                               lda,
+                                                         int batchCount)
+{
+    return hipblasZher2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+}
+
+// her2_strided_batched
+template <>
+hipblasStatus_t hipblasHer2StridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          hipblasComplex*       A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          int                   batchCount)
+{
+    return hipblasCher2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHer2StridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasFillMode_t           uplo,
+                                                                int                         n,
+                                                                const hipblasDoubleComplex* alpha,
+                                                                const hipblasDoubleComplex* x,
+                                                                int                         incx,
+                                                                hipblasStride               stridex,
+                                                                const hipblasDoubleComplex* y,
+                                                                int                         incy,
+                                                                hipblasStride               stridey,
+                                                                hipblasDoubleComplex*       A,
+                                                                int                         lda,
+                                                                hipblasStride               strideA,
+                                                                int batchCount)
+{
+    return hipblasZher2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+}
+
+// hpmv
+template <>
+hipblasStatus_t hipblasHpmv<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* AP,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy)
+{
+    return hipblasChpmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasHpmv<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* AP,
+                                                  const hipblasDoubleComplex* x,
+                                                  int                         incx,
+                                                  const hipblasDoubleComplex* beta,
+                                                  hipblasDoubleComplex*       y,
+                                                  int                         incy)
+{
+    return hipblasZhpmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+// hpmv_batched
+template <>
+hipblasStatus_t hipblasHpmvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const AP[],
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       y[],
+                                                   int                         incy,
+                                                   int                         batchCount)
+{
+    return hipblasChpmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHpmvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasFillMode_t                 uplo,
+                                                         int                               n,
+                                                         const hipblasDoubleComplex*       alpha,
+                                                         const hipblasDoubleComplex* const AP[],
+                                                         const hipblasDoubleComplex* const x[],
+                                                         int                               incx,
+                                                         const hipblasDoubleComplex*       beta,
+                                                         hipblasDoubleComplex* const       y[],
+                                                         int                               incy,
+                                                         int batchCount)
+{
+    return hipblasZhpmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+}
+
+// hpmv_strided_batched
+template <>
+hipblasStatus_t hipblasHpmvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* AP,
+                                                          hipblasStride         strideAP,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batchCount)
+{
+    return hipblasChpmvStridedBatched(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHpmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasFillMode_t           uplo,
+                                                                int                         n,
+                                                                const hipblasDoubleComplex* alpha,
+                                                                const hipblasDoubleComplex* AP,
+                                                                hipblasStride strideAP,
+                                                                const hipblasDoubleComplex* x,
+                                                                int                         incx,
+                                                                hipblasStride               stridex,
+                                                                const hipblasDoubleComplex* beta,
+                                                                hipblasDoubleComplex*       y,
+                                                                int                         incy,
+                                                                hipblasStride               stridey,
+                                                                int batchCount)
+{
+    return hipblasZhpmvStridedBatched(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+}
+
+// hpr
+template <>
+hipblasStatus_t hipblasHpr<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int                   n,
+                                                  const float*          alpha,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  hipblasComplex*       AP)
+{
+    return hipblasChpr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+hipblasStatus_t hipblasHpr<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const double*               alpha,
+                                                         const hipblasDoubleComplex* x,
+                                                         int                         incx,
+                                                         hipblasDoubleComplex*       AP)
+{
+    return hipblasZhpr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+// hpr_batched
+template <>
+hipblasStatus_t hipblasHprBatched<hipblasComplex, float>(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const float*                alpha,
+                                                         const hipblasComplex* const x[],
+                                                         int                         incx,
+                                                         hipblasComplex* const       AP[],
+                                                         int                         batchCount)
+{
+    return hipblasChprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasHprBatched<hipblasDoubleComplex, double>(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    int                               n,
+                                                    const double*                     alpha,
+                                                    const hipblasDoubleComplex* const x[],
+                                                    int                               incx,
+                                                    hipblasDoubleComplex* const       AP[],
+                                                    int                               batchCount)
+{
+    return hipblasZhprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+}
+
+// hpr_strided_batched
+template <>
+hipblasStatus_t hipblasHprStridedBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                                hipblasFillMode_t     uplo,
+                                                                int                   n,
+                                                                const float*          alpha,
+                                                                const hipblasComplex* x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                hipblasComplex*       AP,
+                                                                hipblasStride         strideAP,
+                                                                int                   batchCount)
+{
+    return hipblasChprStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasHprStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         n,
+                                                           const double*               alpha,
+                                                           const hipblasDoubleComplex* x,
+                                                           int                         incx,
+                                                           hipblasStride               stridex,
+                                                           hipblasDoubleComplex*       AP,
+                                                           hipblasStride               strideAP,
+                                                           int                         batchCount)
+{
+    return hipblasZhprStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+}
+
+// hpr2
+template <>
+hipblasStatus_t hipblasHpr2(hipblasHandle_t       handle,
+                            hipblasFillMode_t     uplo,
+                            int                   n,
+                            const hipblasComplex* alpha,
+                            const hipblasComplex* x,
+                            int                   incx,
+                            const hipblasComplex* y,
+                            int                   incy,
+                            hipblasComplex*       AP)
+{
+    return hipblasChpr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+template <>
+hipblasStatus_t hipblasHpr2(hipblasHandle_t             handle,
+                            hipblasFillMode_t           uplo,
+                            int                         n,
+                            const hipblasDoubleComplex* alpha,
+                            const hipblasDoubleComplex* x,
+                            int                         incx,
+                            const hipblasDoubleComplex* y,
+                            int                         incy,
+                            hipblasDoubleComplex*       AP)
+{
+    return hipblasZhpr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+}
+
+// hpr2_batched
+template <>
+hipblasStatus_t hipblasHpr2Batched(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int                         n,
+                                   const hipblasComplex*       alpha,
+                                   const hipblasComplex* const x[],
+                                   int                         incx,
+                                   const hipblasComplex* const y[],
+                                   int                         incy,
+                                   hipblasComplex* const       AP[],
+                                   int                         batchCount)
+{
+    return hipblasChpr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHpr2Batched(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   int                               n,
+                                   const hipblasDoubleComplex*       alpha,
+                                   const hipblasDoubleComplex* const x[],
+                                   int                               incx,
+                                   const hipblasDoubleComplex* const y[],
+                                   int                               incy,
+                                   hipblasDoubleComplex* const       AP[],
+                                   int                               batchCount)
+{
+    return hipblasZhpr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+}
+
+// hpr2_strided_batched
+template <>
+hipblasStatus_t hipblasHpr2StridedBatched(hipblasHandle_t       handle,
+                                          hipblasFillMode_t     uplo,
+                                          int                   n,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* x,
+                                          int                   incx,
+                                          hipblasStride         stridex,
+                                          const hipblasComplex* y,
+                                          int                   incy,
+                                          hipblasStride         stridey,
+                                          hipblasComplex*       AP,
+                                          hipblasStride         strideAP,
+                                          int                   batchCount)
+{
+    return hipblasChpr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHpr2StridedBatched(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int                         n,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* x,
+                                          int                         incx,
+                                          hipblasStride               stridex,
+                                          const hipblasDoubleComplex* y,
+                                          int                         incy,
+                                          hipblasStride               stridey,
+                                          hipblasDoubleComplex*       AP,
+                                          hipblasStride               strideAP,
+                                          int                         batchCount)
+{
+    return hipblasZhpr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+}
+
+// sbmv
+template <>
+hipblasStatus_t hipblasSbmv(hipblasHandle_t   handle,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            int               k,
+                            const float*      alpha,
+                            const float*      A,
+                            int               lda,
+                            const float*      x,
+                            int               incx,
+                            const float*      beta,
+                            float*            y,
+                            int               incy)
+{
+    return hipblasSsbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasSbmv(hipblasHandle_t   handle,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            int               k,
+                            const double*     alpha,
+                            const double*     A,
+                            int               lda,
+                            const double*     x,
+                            int               incx,
+                            const double*     beta,
+                            double*           y,
+                            int               incy)
+{
+    return hipblasDsbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+// sbmv_batched
+template <>
+hipblasStatus_t hipblasSbmvBatched(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   int                n,
+                                   int                k,
+                                   const float*       alpha,
+                                   const float* const A[],
+                                   int                lda,
+                                   const float* const x[],
+                                   int                incx,
+                                   const float*       beta,
+                                   float*             y[],
+                                   int                incy,
+                                   int                batchCount)
+{
+    return hipblasSsbmvBatched(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSbmvBatched(hipblasHandle_t     handle,
+                                   hipblasFillMode_t   uplo,
+                                   int                 n,
+                                   int                 k,
+                                   const double*       alpha,
+                                   const double* const A[],
+                                   int                 lda,
+                                   const double* const x[],
+                                   int                 incx,
+                                   const double*       beta,
+                                   double*             y[],
+                                   int                 incy,
+                                   int                 batchCount)
+{
+    return hipblasDsbmvBatched(
+        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+}
+
+// sbmv_strided_batched
+template <>
+hipblasStatus_t hipblasSbmvStridedBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          int               k,
+                                          const float*      alpha,
+                                          const float*      A,
+                                          int               lda,
+                                          hipblasStride     strideA,
+                                          const float*      x,
+                                          int               incx,
+                                          hipblasStride     stridex,
+                                          const float*      beta,
+                                          float*            y,
+                                          int               incy,
+                                          hipblasStride     stridey,
+                                          int               batchCount)
+{
+    return hipblasSsbmvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSbmvStridedBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          int               k,
+                                          const double*     alpha,
+                                          const double*     A,
+                                          int               lda,
+                                          hipblasStride     strideA,
+                                          const double*     x,
+                                          int               incx,
+                                          hipblasStride     stridex,
+                                          const double*     beta,
+                                          double*           y,
+                                          int               incy,
+                                          hipblasStride     stridey,
+                                          int               batchCount)
+{
+    return hipblasDsbmvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      k,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
+}
+
+// spmv
+template <>
+hipblasStatus_t hipblasSpmv(hipblasHandle_t   handle,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            const float*      alpha,
+                            const float*      AP,
+                            const float*      x,
+                            int               incx,
+                            const float*      beta,
+                            float*            y,
+                            int               incy)
+{
+    return hipblasSspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasSpmv(hipblasHandle_t   handle,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            const double*     alpha,
+                            const double*     AP,
+                            const double*     x,
+                            int               incx,
+                            const double*     beta,
+                            double*           y,
+                            int               incy)
+{
+    return hipblasDspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+}
+
+// spmv_batched
+template <>
+hipblasStatus_t hipblasSpmvBatched(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   int                n,
+                                   const float*       alpha,
+                                   const float* const AP[],
+                                   const float* const x[],
+                                   int                incx,
+                                   const float*       beta,
+                                   float*             y[],
+                                   int                incy,
+                                   int                batchCount)
+{
+    return hipblasSspmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSpmvBatched(hipblasHandle_t     handle,
+                                   hipblasFillMode_t   uplo,
+                                   int                 n,
+                                   const double*       alpha,
+                                   const double* const AP[],
+                                   const double* const x[],
+                                   int                 incx,
+                                   const double*       beta,
+                                   double*             y[],
+                                   int                 incy,
+                                   int                 batchCount)
+{
+    return hipblasDspmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+}
+
+// spmv_strided_batched
+template <>
+hipblasStatus_t hipblasSpmvStridedBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          const float*      alpha,
+                                          const float*      AP,
+                                          hipblasStride     strideAP,
+                                          const float*      x,
+                                          int               incx,
+                                          hipblasStride     stridex,
+                                          const float*      beta,
+                                          float*            y,
+                                          int               incy,
+                                          hipblasStride     stridey,
+                                          int               batchCount)
+{
+    return hipblasSspmvStridedBatched(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSpmvStridedBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          const double*     alpha,
+                                          const double*     AP,
+                                          hipblasStride     strideAP,
+                                          const double*     x,
+                                          int               incx,
+                                          hipblasStride     stridex,
+                                          const double*     beta,
+                                          double*           y,
+                                          int               incy,
+                                          hipblasStride     stridey,
+                                          int               batchCount)
+{
+    return hipblasDspmvStridedBatched(
+        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+}
+
+// spr
+template <>
+hipblasStatus_t hipblasSpr<float, true>(hipblasHandle_t   handle,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        const float*      alpha,
+                                        const float*      x,
+                                        int               incx,
+                                        float*            AP)
+{
+    return hipblasSspr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+hipblasStatus_t hipblasSpr<double, true>(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         const double*     alpha,
+                                         const double*     x,
+                                         int               incx,
+                                         double*           AP)
+{
+    return hipblasDspr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+hipblasStatus_t hipblasSpr<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int                   n,
+                                                 const hipblasComplex* alpha,
+                                                 const hipblasComplex* x,
+                                                 int                   incx,
+                                                 hipblasComplex*       AP)
+{
+    return hipblasCspr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+template <>
+hipblasStatus_t hipblasSpr<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                       hipblasFillMode_t           uplo,
+                                                       int                         n,
+                                                       const hipblasDoubleComplex* alpha,
+                                                       const hipblasDoubleComplex* x,
+                                                       int                         incx,
+                                                       hipblasDoubleComplex*       AP)
+{
+    return hipblasZspr(handle, uplo, n, alpha, x, incx, AP);
+}
+
+// spr_batched
+template <>
+hipblasStatus_t hipblasSprBatched<float, true>(hipblasHandle_t    handle,
+                                               hipblasFillMode_t  uplo,
+                                               int                n,
+                                               const float*       alpha,
+                                               const float* const x[],
+                                               int                incx,
+                                               float* const       AP[],
+                                               int                batchCount)
+{
+    return hipblasSsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSprBatched<double, true>(hipblasHandle_t     handle,
+                                                hipblasFillMode_t   uplo,
+                                                int                 n,
+                                                const double*       alpha,
+                                                const double* const x[],
+                                                int                 incx,
+                                                double* const       AP[],
+                                                int                 batchCount)
+{
+    return hipblasDsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSprBatched<hipblasComplex, true>(hipblasHandle_t             handle,
+                                                        hipblasFillMode_t           uplo,
+                                                        int                         n,
+                                                        const hipblasComplex*       alpha,
+                                                        const hipblasComplex* const x[],
+                                                        int                         incx,
+                                                        hipblasComplex* const       AP[],
+                                                        int                         batchCount)
 {
-    return hipblasChprStridedBatched(
+    return hipblasCsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSprBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                              hipblasFillMode_t           uplo,
+                                                              int                         n,
+                                                              const hipblasDoubleComplex* alpha,
+                                                              const hipblasDoubleComplex* const x[],
+                                                              int                         incx,
+                                                              hipblasDoubleComplex* const AP[],
+                                                              int batchCount)
+{
+    return hipblasZsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+}
+
+// spr_strided_batched
+template <>
+hipblasStatus_t hipblasSprStridedBatched<float, true>(hipblasHandle_t   handle,
+                                                      hipblasFillMode_t uplo,
+                                                      int               n,
+                                                      const float*      alpha,
+                                                      const float*      x,
+                                                      int               incx,
+                                                      hipblasStride     stridex,
+                                                      float*            AP,
+                                                      hipblasStride     strideAP,
+                                                      int               batchCount)
+{
+    return hipblasSsprStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSprStridedBatched<double, true>(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       const double*     alpha,
+                                                       const double*     x,
+                                                       int               incx,
+                                                       hipblasStride     stridex,
+                                                       double*           AP,
+                                                       hipblasStride     strideAP,
+                                                       int               batchCount)
+{
+    return hipblasDsprStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSprStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                               hipblasFillMode_t     uplo,
+                                                               int                   n,
+                                                               const hipblasComplex* alpha,
+                                                               const hipblasComplex* x,
+                                                               int                   incx,
+                                                               hipblasStride         stridex,
+                                                               hipblasComplex*       AP,
+                                                               hipblasStride         strideAP,
+                                                               int                   batchCount)
+{
+    return hipblasCsprStridedBatched(
         handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
 }
 
 template <>
 hipblasStatus_t
-    hipblasHprStridedBatched<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
-                                                           hipblasFillMode_t           uplo,
-                                                           int                         n,
-                                                           const double*               alpha,
-                                                           const hipblasDoubleComplex* x,
-                                                           int                         incx,
-                                                           hipblasStride               stridex,
-                                                           hipblasDoubleComplex*       AP,
-                                                           hipblasStride               strideAP,
-                                                           int                         batchCount)
+    hipblasSprStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const hipblasDoubleComplex* alpha,
+                                                         const hipblasDoubleComplex* x,
+                                                         int                         incx,
+                                                         hipblasStride               stridex,
+                                                         hipblasDoubleComplex*       AP,
+                                                         hipblasStride               strideAP,
+                                                         int                         batchCount)
 {
-    return hipblasZhprStridedBatched(
+    return hipblasZsprStridedBatched(
         handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
 }
 
-// hpr2
+// spr2
 template <>
-hipblasStatus_t hipblasHpr2(hipblasHandle_t       handle,
-                            hipblasFillMode_t     uplo,
-                            int                   n,
-                            const hipblasComplex* alpha,
-                            const hipblasComplex* x,
-                            int                   incx,
-                            const hipblasComplex* y,
-                            int                   incy,
-                            hipblasComplex*       AP)
+hipblasStatus_t hipblasSpr2(hipblasHandle_t   handle,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            const float*      alpha,
+                            const float*      x,
+                            int               incx,
+                            const float*      y,
+                            int               incy,
+                            float*            AP)
 {
-    return hipblasChpr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+    return hipblasSspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
 }
 
 template <>
-hipblasStatus_t hipblasHpr2(hipblasHandle_t             handle,
-                            hipblasFillMode_t           uplo,
-                            int                         n,
-                            const hipblasDoubleComplex* alpha,
-                            const hipblasDoubleComplex* x,
-                            int                         incx,
-                            const hipblasDoubleComplex* y,
-                            int                         incy,
-                            hipblasDoubleComplex*       AP)
+hipblasStatus_t hipblasSpr2(hipblasHandle_t   handle,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            const double*     alpha,
+                            const double*     x,
+                            int               incx,
+                            const double*     y,
+                            int               incy,
+                            double*           AP)
 {
-    return hipblasZhpr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+    return hipblasDspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
 }
 
-// hpr2_batched
+// spr2_batched
 template <>
-hipblasStatus_t hipblasHpr2Batched(hipblasHandle_t             handle,
-                                   hipblasFillMode_t           uplo,
-                                   int                         n,
-                                   const hipblasComplex*       alpha,
-                                   const hipblasComplex* const x[],
-                                   int                         incx,
-                                   const hipblasComplex* const y[],
-                                   int                         incy,
-                                   hipblasComplex* const       AP[],
-                                   int                         batchCount)
+hipblasStatus_t hipblasSpr2Batched(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   int                n,
+                                   const float*       alpha,
+                                   const float* const x[],
+                                   int                incx,
+                                   const float* const y[],
+                                   int                incy,
+                                   float* const       AP[],
+                                   int                batchCount)
+{
+    return hipblasSspr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSpr2Batched(hipblasHandle_t     handle,
+                                   hipblasFillMode_t   uplo,
+                                   int                 n,
+                                   const double*       alpha,
+                                   const double* const x[],
+                                   int                 incx,
+                                   const double* const y[],
+                                   int                 incy,
+                                   double* const       AP[],
+                                   int                 batchCount)
+{
+    return hipblasDspr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+}
+
+// spr2_strided_batched
+template <>
+hipblasStatus_t hipblasSpr2StridedBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          const float*      alpha,
+                                          const float*      x,
+                                          int               incx,
+                                          hipblasStride     stridex,
+                                          const float*      y,
+                                          int               incy,
+                                          hipblasStride     stridey,
+                                          float*            AP,
+                                          hipblasStride     strideAP,
+                                          int               batchCount)
+{
+    return hipblasSspr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSpr2StridedBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          const double*     alpha,
+                                          const double*     x,
+                                          int               incx,
+                                          hipblasStride     stridex,
+                                          const double*     y,
+                                          int               incy,
+                                          hipblasStride     stridey,
+                                          double*           AP,
+                                          hipblasStride     strideAP,
+                                          int               batchCount)
+{
+    return hipblasDspr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+}
+
+// symv
+template <>
+hipblasStatus_t hipblasSymv<float, true>(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         const float*      alpha,
+                                         const float*      A,
+                                         int               lda,
+                                         const float*      x,
+                                         int               incx,
+                                         const float*      beta,
+                                         float*            y,
+                                         int               incy)
+{
+    return hipblasSsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasSymv<double, true>(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          const double*     alpha,
+                                          const double*     A,
+                                          int               lda,
+                                          const double*     x,
+                                          int               incx,
+                                          const double*     beta,
+                                          double*           y,
+                                          int               incy)
+{
+    return hipblasDsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasSymv<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int                   n,
+                                                  const hipblasComplex* alpha,
+                                                  const hipblasComplex* A,
+                                                  int                   lda,
+                                                  const hipblasComplex* x,
+                                                  int                   incx,
+                                                  const hipblasComplex* beta,
+                                                  hipblasComplex*       y,
+                                                  int                   incy)
 {
-    return hipblasChpr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+    return hipblasCsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
 template <>
-hipblasStatus_t hipblasHpr2Batched(hipblasHandle_t                   handle,
-                                   hipblasFillMode_t                 uplo,
-                                   int                               n,
-                                   const hipblasDoubleComplex*       alpha,
-                                   const hipblasDoubleComplex* const x[],
-                                   int                               incx,
-                                   const hipblasDoubleComplex* const y[],
-                                   int                               incy,
-                                   hipblasDoubleComplex* const       AP[],
-                                   int                               batchCount)
+hipblasStatus_t hipblasSymv<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                        hipblasFillMode_t           uplo,
+                                                        int                         n,
+                                                        const hipblasDoubleComplex* alpha,
+                                                        const hipblasDoubleComplex* A,
+                                                        int                         lda,
+                                                        const hipblasDoubleComplex* x,
+                                                        int                         incx,
+                                                        const hipblasDoubleComplex* beta,
+                                                        hipblasDoubleComplex*       y,
+                                                        int                         incy)
 {
-    return hipblasZhpr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+    return hipblasZsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
 }
 
-// hpr2_strided_batched
+// symv_batched
 template <>
-hipblasStatus_t hipblasHpr2StridedBatched(hipblasHandle_t       handle,
-                                          hipblasFillMode_t     uplo,
-                                          int                   n,
-                                          const hipblasComplex* alpha,
-                                          const hipblasComplex* x,
-                                          int                   incx,
-                                          hipblasStride         stridex,
-                                          const hipblasComplex* y,
-                                          int                   incy,
-                                          hipblasStride         stridey,
-                                          hipblasComplex*       AP,
-                                          hipblasStride         strideAP,
-                                          int                   batchCount)
+hipblasStatus_t hipblasSymvBatched<float, true>(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                int                n,
+                                                const float*       alpha,
+                                                const float* const A[],
+                                                int                lda,
+                                                const float* const x[],
+                                                int                incx,
+                                                const float*       beta,
+                                                float*             y[],
+                                                int                incy,
+                                                int                batchCount)
 {
-    return hipblasChpr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblasSsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasHpr2StridedBatched(hipblasHandle_t             handle,
-                                          hipblasFillMode_t           uplo,
-                                          int                         n,
-                                          const hipblasDoubleComplex* alpha,
-                                          const hipblasDoubleComplex* x,
-                                          int                         incx,
-                                          hipblasStride               stridex,
-                                          const hipblasDoubleComplex* y,
-                                          int                         incy,
-                                          hipblasStride               stridey,
-                                          hipblasDoubleComplex*       AP,
-                                          hipblasStride               strideAP,
-                                          int                         batchCount)
+hipblasStatus_t hipblasSymvBatched<double, true>(hipblasHandle_t     handle,
+                                                 hipblasFillMode_t   uplo,
+                                                 int                 n,
+                                                 const double*       alpha,
+                                                 const double* const A[],
+                                                 int                 lda,
+                                                 const double* const x[],
+                                                 int                 incx,
+                                                 const double*       beta,
+                                                 double*             y[],
+                                                 int                 incy,
+                                                 int                 batchCount)
 {
-    return hipblasZhpr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblasDsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
 }
 
-// sbmv
 template <>
-hipblasStatus_t hipblasSbmv(hipblasHandle_t   handle,
-                            hipblasFillMode_t uplo,
-                            int               n,
-                            int               k,
-                            const float*      alpha,
-                            const float*      A,
-                            int               lda,
-                            const float*      x,
-                            int               incx,
-                            const float*      beta,
-                            float*            y,
-                            int               incy)
+hipblasStatus_t hipblasSymvBatched<hipblasComplex, true>(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const hipblasComplex*       alpha,
+                                                         const hipblasComplex* const A[],
+                                                         int                         lda,
+                                                         const hipblasComplex* const x[],
+                                                         int                         incx,
+                                                         const hipblasComplex*       beta,
+                                                         hipblasComplex*             y[],
+                                                         int                         incy,
+                                                         int                         batchCount)
 {
-    return hipblasSsbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasCsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSbmv(hipblasHandle_t   handle,
-                            hipblasFillMode_t uplo,
-                            int               n,
-                            int               k,
-                            const double*     alpha,
-                            const double*     A,
-                            int               lda,
-                            const double*     x,
-                            int               incx,
-                            const double*     beta,
-                            double*           y,
-                            int               incy)
+hipblasStatus_t
+    hipblasSymvBatched<hipblasDoubleComplex, true>(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex*             y[],
+                                                   int                               incy,
+                                                   int                               batchCount)
 {
-    return hipblasDsbmv(handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasZsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
 }
 
-// sbmv_batched
+// symv_strided_batched
 template <>
-hipblasStatus_t hipblasSbmvBatched(hipblasHandle_t    handle,
-                                   hipblasFillMode_t  uplo,
-                                   int                n,
-                                   int                k,
-                                   const float*       alpha,
-                                   const float* const A[],
-                                   int                lda,
-                                   const float* const x[],
-                                   int                incx,
-                                   const float*       beta,
-                                   float*             y[],
-                                   int                incy,
-                                   int                batchCount)
+hipblasStatus_t hipblasSymvStridedBatched<float, true>(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       const float*      alpha,
+                                                       const float*      A,
+                                                       int               lda,
+                                                       hipblasStride     strideA,
+                                                       const float*      x,
+                                                       int               incx,
+                                                       hipblasStride     stridex,
+                                                       const float*      beta,
+                                                       float*            y,
+                                                       int               incy,
+                                                       hipblasStride     stridey,
+                                                       int               batchCount)
 {
-    return hipblasSsbmvBatched(
-        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasSsymvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSbmvBatched(hipblasHandle_t     handle,
-                                   hipblasFillMode_t   uplo,
-                                   int                 n,
-                                   int                 k,
-                                   const double*       alpha,
-                                   const double* const A[],
-                                   int                 lda,
-                                   const double* const x[],
-                                   int                 incx,
-                                   const double*       beta,
-                                   double*             y[],
-                                   int                 incy,
-                                   int                 batchCount)
+hipblasStatus_t hipblasSymvStridedBatched<double, true>(hipblasHandle_t   handle,
+                                                        hipblasFillMode_t uplo,
+                                                        int               n,
+                                                        const double*     alpha,
+                                                        const double*     A,
+                                                        int               lda,
+                                                        hipblasStride     strideA,
+                                                        const double*     x,
+                                                        int               incx,
+                                                        hipblasStride     stridex,
+                                                        const double*     beta,
+                                                        double*           y,
+                                                        int               incy,
+                                                        hipblasStride     stridey,
+                                                        int               batchCount)
 {
-    return hipblasDsbmvBatched(
-        handle, uplo, n, k, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasDsymvStridedBatched(handle,
+                                      uplo,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      x,
+                                      incx,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      incy,
+                                      stridey,
+                                      batchCount);
 }
 
-// sbmv_strided_batched
 template <>
-hipblasStatus_t hipblasSbmvStridedBatched(hipblasHandle_t   handle,
-                                          hipblasFillMode_t uplo,
-                                          int               n,
-                                          int               k,
-                                          const float*      alpha,
-                                          const float*      A,
-                                          int               lda,
-                                          hipblasStride     strideA,
-                                          const float*      x,
-                                          int               incx,
-                                          hipblasStride     stridex,
-                                          const float*      beta,
-                                          float*            y,
-                                          int               incy,
-                                          hipblasStride     stridey,
-                                          int               batchCount)
+hipblasStatus_t hipblasSymvStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
+                                                                hipblasFillMode_t     uplo,
+                                                                int                   n,
+                                                                const hipblasComplex* alpha,
+                                                                const hipblasComplex* A,
+                                                                int                   lda,
+                                                                hipblasStride         strideA,
+                                                                const hipblasComplex* x,
+                                                                int                   incx,
+                                                                hipblasStride         stridex,
+                                                                const hipblasComplex* beta,
+                                                                hipblasComplex*       y,
+                                                                int                   incy,
+                                                                hipblasStride         stridey,
+                                                                int                   batchCount)
 {
-    return hipblasSsbmvStridedBatched(handle,
+    return hipblasCsymvStridedBatched(handle,
                                       uplo,
                                       n,
-                                      k,
                                       alpha,
                                       A,
                                       lda,
@@ -3924,27 +5570,26 @@ hipblasStatus_t hipblasSbmvStridedBatched(hipblasHandle_t   handle,
 }
 
 template <>
-hipblasStatus_t hipblasSbmvStridedBatched(hipblasHandle_t   handle,
-                                          hipblasFillMode_t uplo,
-                                          int               n,
-                                          int               k,
-                                          const double*     alpha,
-                                          const double*     A,
-                                          int               lda,
-                                          hipblasStride     strideA,
-                                          const double*     x,
-                                          int               incx,
-                                          hipblasStride     stridex,
-                                          const double*     beta,
-                                          double*           y,
-                                          int               incy,
-                                          hipblasStride     stridey,
-                                          int               batchCount)
+hipblasStatus_t
+    hipblasSymvStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          int                         batchCount)
 {
-    return hipblasDsbmvStridedBatched(handle,
+    return hipblasZsymvStridedBatched(handle,
                                       uplo,
                                       n,
-                                      k,
                                       alpha,
                                       A,
                                       lda,
@@ -3959,1226 +5604,1265 @@ hipblasStatus_t hipblasSbmvStridedBatched(hipblasHandle_t   handle,
                                       batchCount);
 }
 
-// spmv
+// syr
 template <>
-hipblasStatus_t hipblasSpmv(hipblasHandle_t   handle,
+hipblasStatus_t hipblasSyr<float>(hipblasHandle_t   handle,
+                                  hipblasFillMode_t uplo,
+                                  int               n,
+                                  const float*      alpha,
+                                  const float*      x,
+                                  int               incx,
+                                  float*            A,
+                                  int               lda)
+{
+    return hipblasSsyr(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSyr<double>(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   const double*     alpha,
+                                   const double*     x,
+                                   int               incx,
+                                   double*           A,
+                                   int               lda)
+{
+    return hipblasDsyr(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSyr<hipblasComplex>(hipblasHandle_t       handle,
+                                           hipblasFillMode_t     uplo,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasComplex*       A,
+                                           int                   lda)
+{
+    return hipblasCsyr(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSyr<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                 hipblasFillMode_t           uplo,
+                                                 int                         n,
+                                                 const hipblasDoubleComplex* alpha,
+                                                 const hipblasDoubleComplex* x,
+                                                 int                         incx,
+                                                 hipblasDoubleComplex*       A,
+                                                 int                         lda)
+{
+    return hipblasZsyr(handle, uplo, n, alpha, x, incx, A, lda);
+}
+
+// syr_batched
+template <>
+hipblasStatus_t hipblasSyrBatched<float>(hipblasHandle_t    handle,
+                                         hipblasFillMode_t  uplo,
+                                         int                n,
+                                         const float*       alpha,
+                                         const float* const x[],
+                                         int                incx,
+                                         float* const       A[],
+                                         int                lda,
+                                         int                batch_count)
+{
+    return hipblasSsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSyrBatched<double>(hipblasHandle_t     handle,
+                                          hipblasFillMode_t   uplo,
+                                          int                 n,
+                                          const double*       alpha,
+                                          const double* const x[],
+                                          int                 incx,
+                                          double* const       A[],
+                                          int                 lda,
+                                          int                 batch_count)
+{
+    return hipblasDsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSyrBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  const hipblasComplex*       alpha,
+                                                  const hipblasComplex* const x[],
+                                                  int                         incx,
+                                                  hipblasComplex* const       A[],
+                                                  int                         lda,
+                                                  int                         batch_count)
+{
+    return hipblasCsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSyrBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                        hipblasFillMode_t                 uplo,
+                                                        int                               n,
+                                                        const hipblasDoubleComplex*       alpha,
+                                                        const hipblasDoubleComplex* const x[],
+                                                        int                               incx,
+                                                        hipblasDoubleComplex* const       A[],
+                                                        int                               lda,
+                                                        int batch_count)
+{
+    return hipblasZsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+}
+
+// syr_strided_batched
+template <>
+hipblasStatus_t hipblasSyrStridedBatched<float>(hipblasHandle_t   handle,
+                                                hipblasFillMode_t uplo,
+                                                int               n,
+                                                const float*      alpha,
+                                                const float*      x,
+                                                int               incx,
+                                                hipblasStride     stridex,
+                                                float*            A,
+                                                int               lda,
+                                                hipblasStride     strideA,
+                                                int               batch_count)
+{
+    return hipblasSsyrStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSyrStridedBatched<double>(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 const double*     alpha,
+                                                 const double*     x,
+                                                 int               incx,
+                                                 hipblasStride     stridex,
+                                                 double*           A,
+                                                 int               lda,
+                                                 hipblasStride     strideA,
+                                                 int               batch_count)
+{
+    return hipblasDsyrStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSyrStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                         hipblasFillMode_t     uplo,
+                                                         int                   n,
+                                                         const hipblasComplex* alpha,
+                                                         const hipblasComplex* x,
+                                                         int                   incx,
+                                                         hipblasStride         stridex,
+                                                         hipblasComplex*       A,
+                                                         int                   lda,
+                                                         hipblasStride         strideA,
+                                                         int                   batch_count)
+{
+    return hipblasCsyrStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSyrStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                               hipblasFillMode_t           uplo,
+                                                               int                         n,
+                                                               const hipblasDoubleComplex* alpha,
+                                                               const hipblasDoubleComplex* x,
+                                                               int                         incx,
+                                                               hipblasStride               stridex,
+                                                               hipblasDoubleComplex*       A,
+                                                               int                         lda,
+                                                               hipblasStride               strideA,
+                                                               int batch_count)
+{
+    return hipblasZsyrStridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+}
+
+// syr2
+template <>
+hipblasStatus_t hipblasSyr2(hipblasHandle_t   handle,
                             hipblasFillMode_t uplo,
                             int               n,
                             const float*      alpha,
-                            const float*      AP,
                             const float*      x,
                             int               incx,
-                            const float*      beta,
-                            float*            y,
-                            int               incy)
+                            const float*      y,
+                            int               incy,
+                            float*            A,
+                            int               lda)
+{
+    return hipblasSsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSyr2(hipblasHandle_t   handle,
+                            hipblasFillMode_t uplo,
+                            int               n,
+                            const double*     alpha,
+                            const double*     x,
+                            int               incx,
+                            const double*     y,
+                            int               incy,
+                            double*           A,
+                            int               lda)
+{
+    return hipblasDsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSyr2(hipblasHandle_t       handle,
+                            hipblasFillMode_t     uplo,
+                            int                   n,
+                            const hipblasComplex* alpha,
+                            const hipblasComplex* x,
+                            int                   incx,
+                            const hipblasComplex* y,
+                            int                   incy,
+                            hipblasComplex*       A,
+                            int                   lda)
 {
-    return hipblasSspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+    return hipblasCsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
 }
 
 template <>
-hipblasStatus_t hipblasSpmv(hipblasHandle_t   handle,
-                            hipblasFillMode_t uplo,
-                            int               n,
-                            const double*     alpha,
-                            const double*     AP,
-                            const double*     x,
-                            int               incx,
-                            const double*     beta,
-                            double*           y,
-                            int               incy)
+hipblasStatus_t hipblasSyr2(hipblasHandle_t             handle,
+                            hipblasFillMode_t           uplo,
+                            int                         n,
+                            const hipblasDoubleComplex* alpha,
+                            const hipblasDoubleComplex* x,
+                            int                         incx,
+                            const hipblasDoubleComplex* y,
+                            int                         incy,
+                            hipblasDoubleComplex*       A,
+                            int                         lda)
 {
-    return hipblasDspmv(handle, uplo, n, alpha, AP, x, incx, beta, y, incy);
+    return hipblasZsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
 }
 
-// spmv_batched
+// syr2_batched
 template <>
-hipblasStatus_t hipblasSpmvBatched(hipblasHandle_t    handle,
+hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t    handle,
                                    hipblasFillMode_t  uplo,
                                    int                n,
                                    const float*       alpha,
-                                   const float* const AP[],
                                    const float* const x[],
                                    int                incx,
-                                   const float*       beta,
-                                   float*             y[],
+                                   const float* const y[],
                                    int                incy,
+                                   float* const       A[],
+                                   int                lda,
                                    int                batchCount)
 {
-    return hipblasSspmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblasSsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSpmvBatched(hipblasHandle_t     handle,
+hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t     handle,
                                    hipblasFillMode_t   uplo,
                                    int                 n,
                                    const double*       alpha,
-                                   const double* const AP[],
                                    const double* const x[],
                                    int                 incx,
-                                   const double*       beta,
-                                   double*             y[],
+                                   const double* const y[],
                                    int                 incy,
+                                   double* const       A[],
+                                   int                 lda,
                                    int                 batchCount)
 {
-    return hipblasDspmvBatched(handle, uplo, n, alpha, AP, x, incx, beta, y, incy, batchCount);
+    return hipblasDsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
 }
 
-// spmv_strided_batched
 template <>
-hipblasStatus_t hipblasSpmvStridedBatched(hipblasHandle_t   handle,
+hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   int                         n,
+                                   const hipblasComplex*       alpha,
+                                   const hipblasComplex* const x[],
+                                   int                         incx,
+                                   const hipblasComplex* const y[],
+                                   int                         incy,
+                                   hipblasComplex* const       A[],
+                                   int                         lda,
+                                   int                         batchCount)
+{
+    return hipblasCsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   int                               n,
+                                   const hipblasDoubleComplex*       alpha,
+                                   const hipblasDoubleComplex* const x[],
+                                   int                               incx,
+                                   const hipblasDoubleComplex* const y[],
+                                   int                               incy,
+                                   hipblasDoubleComplex* const       A[],
+                                   int                               lda,
+                                   int                               batchCount)
+{
+    return hipblasZsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+}
+
+// syr2_strided_batched
+template <>
+hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t   handle,
                                           hipblasFillMode_t uplo,
                                           int               n,
                                           const float*      alpha,
-                                          const float*      AP,
-                                          hipblasStride     strideAP,
                                           const float*      x,
                                           int               incx,
                                           hipblasStride     stridex,
-                                          const float*      beta,
-                                          float*            y,
+                                          const float*      y,
                                           int               incy,
                                           hipblasStride     stridey,
+                                          float*            A,
+                                          int               lda,
+                                          hipblasStride     strideA,
                                           int               batchCount)
 {
-    return hipblasSspmvStridedBatched(
-        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
+    return hipblasSsyr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSpmvStridedBatched(hipblasHandle_t   handle,
+hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t   handle,
                                           hipblasFillMode_t uplo,
                                           int               n,
                                           const double*     alpha,
-                                          const double*     AP,
-                                          hipblasStride     strideAP,
                                           const double*     x,
                                           int               incx,
                                           hipblasStride     stridex,
-                                          const double*     beta,
-                                          double*           y,
+                                          const double*     y,
                                           int               incy,
                                           hipblasStride     stridey,
+                                          double*           A,
+                                          int               lda,
+                                          hipblasStride     strideA,
                                           int               batchCount)
 {
-    return hipblasDspmvStridedBatched(
-        handle, uplo, n, alpha, AP, strideAP, x, incx, stridex, beta, y, incy, stridey, batchCount);
-}
-
-// spr
-template <>
-hipblasStatus_t hipblasSpr<float, true>(hipblasHandle_t   handle,
-                                        hipblasFillMode_t uplo,
-                                        int               n,
-                                        const float*      alpha,
-                                        const float*      x,
-                                        int               incx,
-                                        float*            AP)
-{
-    return hipblasSspr(handle, uplo, n, alpha, x, incx, AP);
-}
-
-template <>
-hipblasStatus_t hipblasSpr<double, true>(hipblasHandle_t   handle,
-                                         hipblasFillMode_t uplo,
-                                         int               n,
-                                         const double*     alpha,
-                                         const double*     x,
-                                         int               incx,
-                                         double*           AP)
-{
-    return hipblasDspr(handle, uplo, n, alpha, x, incx, AP);
-}
-
-template <>
-hipblasStatus_t hipblasSpr<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                 hipblasFillMode_t     uplo,
-                                                 int                   n,
-                                                 const hipblasComplex* alpha,
-                                                 const hipblasComplex* x,
-                                                 int                   incx,
-                                                 hipblasComplex*       AP)
-{
-    return hipblasCspr(handle, uplo, n, alpha, x, incx, AP);
-}
-
-template <>
-hipblasStatus_t hipblasSpr<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                       hipblasFillMode_t           uplo,
-                                                       int                         n,
-                                                       const hipblasDoubleComplex* alpha,
-                                                       const hipblasDoubleComplex* x,
-                                                       int                         incx,
-                                                       hipblasDoubleComplex*       AP)
-{
-    return hipblasZspr(handle, uplo, n, alpha, x, incx, AP);
-}
-
-// spr_batched
-template <>
-hipblasStatus_t hipblasSprBatched<float, true>(hipblasHandle_t    handle,
-                                               hipblasFillMode_t  uplo,
-                                               int                n,
-                                               const float*       alpha,
-                                               const float* const x[],
-                                               int                incx,
-                                               float* const       AP[],
-                                               int                batchCount)
-{
-    return hipblasSsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasSprBatched<double, true>(hipblasHandle_t     handle,
-                                                hipblasFillMode_t   uplo,
-                                                int                 n,
-                                                const double*       alpha,
-                                                const double* const x[],
-                                                int                 incx,
-                                                double* const       AP[],
-                                                int                 batchCount)
-{
-    return hipblasDsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasSprBatched<hipblasComplex, true>(hipblasHandle_t             handle,
-                                                        hipblasFillMode_t           uplo,
-                                                        int                         n,
-                                                        const hipblasComplex*       alpha,
-                                                        const hipblasComplex* const x[],
-                                                        int                         incx,
-                                                        hipblasComplex* const       AP[],
-                                                        int                         batchCount)
-{
-    return hipblasCsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblasDsyr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSprBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                              hipblasFillMode_t           uplo,
-                                                              int                         n,
-                                                              const hipblasDoubleComplex* alpha,
-                                                              const hipblasDoubleComplex* const x[],
-                                                              int                         incx,
-                                                              hipblasDoubleComplex* const AP[],
-                                                              int batchCount)
+hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t       handle,
+                                          hipblasFillMode_t     uplo,
+                                          int                   n,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* x,
+                                          int                   incx,
+                                          hipblasStride         stridex,
+                                          const hipblasComplex* y,
+                                          int                   incy,
+                                          hipblasStride         stridey,
+                                          hipblasComplex*       A,
+                                          int                   lda,
+                                          hipblasStride         strideA,
+                                          int                   batchCount)
 {
-    return hipblasZsprBatched(handle, uplo, n, alpha, x, incx, AP, batchCount);
+    return hipblasCsyr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
 }
 
-// spr_strided_batched
 template <>
-hipblasStatus_t hipblasSprStridedBatched<float, true>(hipblasHandle_t   handle,
-                                                      hipblasFillMode_t uplo,
-                                                      int               n,
-                                                      const float*      alpha,
-                                                      const float*      x,
-                                                      int               incx,
-                                                      hipblasStride     stridex,
-                                                      float*            AP,
-                                                      hipblasStride     strideAP,
-                                                      int               batchCount)
+hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int                         n,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* x,
+                                          int                         incx,
+                                          hipblasStride               stridex,
+                                          const hipblasDoubleComplex* y,
+                                          int                         incy,
+                                          hipblasStride               stridey,
+                                          hipblasDoubleComplex*       A,
+                                          int                         lda,
+                                          hipblasStride               strideA,
+                                          int                         batchCount)
 {
-    return hipblasSsprStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblasZsyr2StridedBatched(
+        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
 }
 
+// trsv
 template <>
-hipblasStatus_t hipblasSprStridedBatched<double, true>(hipblasHandle_t   handle,
-                                                       hipblasFillMode_t uplo,
-                                                       int               n,
-                                                       const double*     alpha,
-                                                       const double*     x,
-                                                       int               incx,
-                                                       hipblasStride     stridex,
-                                                       double*           AP,
-                                                       hipblasStride     strideAP,
-                                                       int               batchCount)
+hipblasStatus_t hipblasTrsv<float>(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int                m,
+                                   const float*       A,
+                                   int                lda,
+                                   float*             x,
+                                   int                incx)
 {
-    return hipblasDsprStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblasStrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
 }
 
 template <>
-hipblasStatus_t hipblasSprStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                               hipblasFillMode_t     uplo,
-                                                               int                   n,
-                                                               const hipblasComplex* alpha,
-                                                               const hipblasComplex* x,
-                                                               int                   incx,
-                                                               hipblasStride         stridex,
-                                                               hipblasComplex*       AP,
-                                                               hipblasStride         strideAP,
-                                                               int                   batchCount)
+hipblasStatus_t hipblasTrsv<double>(hipblasHandle_t    handle,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    int                m,
+                                    const double*      A,
+                                    int                lda,
+                                    double*            x,
+                                    int                incx)
 {
-    return hipblasCsprStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblasDtrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
 }
 
 template <>
-hipblasStatus_t
-    hipblasSprStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const hipblasDoubleComplex* alpha,
-                                                         const hipblasDoubleComplex* x,
-                                                         int                         incx,
-                                                         hipblasStride               stridex,
-                                                         hipblasDoubleComplex*       AP,
-                                                         hipblasStride               strideAP,
-                                                         int                         batchCount)
+hipblasStatus_t hipblasTrsv<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasComplex*       x,
+                                            int                   incx)
 {
-    return hipblasZsprStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, AP, strideAP, batchCount);
+    return hipblasCtrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
 }
 
-// spr2
 template <>
-hipblasStatus_t hipblasSpr2(hipblasHandle_t   handle,
-                            hipblasFillMode_t uplo,
-                            int               n,
-                            const float*      alpha,
-                            const float*      x,
-                            int               incx,
-                            const float*      y,
-                            int               incy,
-                            float*            AP)
+hipblasStatus_t hipblasTrsv<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int                         m,
+                                                  const hipblasDoubleComplex* A,
+                                                  int                         lda,
+                                                  hipblasDoubleComplex*       x,
+                                                  int                         incx)
 {
-    return hipblasSspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+    return hipblasZtrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
 }
 
+// trsv_batched
 template <>
-hipblasStatus_t hipblasSpr2(hipblasHandle_t   handle,
-                            hipblasFillMode_t uplo,
-                            int               n,
-                            const double*     alpha,
-                            const double*     x,
-                            int               incx,
-                            const double*     y,
-                            int               incy,
-                            double*           AP)
+hipblasStatus_t hipblasTrsvBatched<float>(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          int                m,
+                                          const float* const A[],
+                                          int                lda,
+                                          float* const       x[],
+                                          int                incx,
+                                          int                batch_count)
 {
-    return hipblasDspr2(handle, uplo, n, alpha, x, incx, y, incy, AP);
+    return hipblasStrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
 }
 
-// spr2_batched
 template <>
-hipblasStatus_t hipblasSpr2Batched(hipblasHandle_t    handle,
-                                   hipblasFillMode_t  uplo,
-                                   int                n,
-                                   const float*       alpha,
-                                   const float* const x[],
-                                   int                incx,
-                                   const float* const y[],
-                                   int                incy,
-                                   float* const       AP[],
-                                   int                batchCount)
+hipblasStatus_t hipblasTrsvBatched<double>(hipblasHandle_t     handle,
+                                           hipblasFillMode_t   uplo,
+                                           hipblasOperation_t  transA,
+                                           hipblasDiagType_t   diag,
+                                           int                 m,
+                                           const double* const A[],
+                                           int                 lda,
+                                           double* const       x[],
+                                           int                 incx,
+                                           int                 batch_count)
 {
-    return hipblasSspr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+    return hipblasDtrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasSpr2Batched(hipblasHandle_t     handle,
-                                   hipblasFillMode_t   uplo,
-                                   int                 n,
-                                   const double*       alpha,
-                                   const double* const x[],
-                                   int                 incx,
-                                   const double* const y[],
-                                   int                 incy,
-                                   double* const       AP[],
-                                   int                 batchCount)
+hipblasStatus_t hipblasTrsvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         m,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   hipblasComplex* const       x[],
+                                                   int                         incx,
+                                                   int                         batch_count)
 {
-    return hipblasDspr2Batched(handle, uplo, n, alpha, x, incx, y, incy, AP, batchCount);
+    return hipblasCtrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
 }
 
-// spr2_strided_batched
 template <>
-hipblasStatus_t hipblasSpr2StridedBatched(hipblasHandle_t   handle,
-                                          hipblasFillMode_t uplo,
-                                          int               n,
-                                          const float*      alpha,
-                                          const float*      x,
-                                          int               incx,
-                                          hipblasStride     stridex,
-                                          const float*      y,
-                                          int               incy,
-                                          hipblasStride     stridey,
-                                          float*            AP,
-                                          hipblasStride     strideAP,
-                                          int               batchCount)
+hipblasStatus_t hipblasTrsvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasFillMode_t                 uplo,
+                                                         hipblasOperation_t                transA,
+                                                         hipblasDiagType_t                 diag,
+                                                         int                               m,
+                                                         const hipblasDoubleComplex* const A[],
+                                                         int                               lda,
+                                                         hipblasDoubleComplex* const       x[],
+                                                         int                               incx,
+                                                         int batch_count)
 {
-    return hipblasSspr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblasZtrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
 }
 
+// trsv_strided_batched
 template <>
-hipblasStatus_t hipblasSpr2StridedBatched(hipblasHandle_t   handle,
-                                          hipblasFillMode_t uplo,
-                                          int               n,
-                                          const double*     alpha,
-                                          const double*     x,
-                                          int               incx,
-                                          hipblasStride     stridex,
-                                          const double*     y,
-                                          int               incy,
-                                          hipblasStride     stridey,
-                                          double*           AP,
-                                          hipblasStride     strideAP,
-                                          int               batchCount)
+hipblasStatus_t hipblasTrsvStridedBatched<float>(hipblasHandle_t    handle,
+                                                 hipblasFillMode_t  uplo,
+                                                 hipblasOperation_t transA,
+                                                 hipblasDiagType_t  diag,
+                                                 int                m,
+                                                 const float*       A,
+                                                 int                lda,
+                                                 hipblasStride      strideA,
+                                                 float*             x,
+                                                 int                incx,
+                                                 hipblasStride      stridex,
+                                                 int                batch_count)
 {
-    return hipblasDspr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, AP, strideAP, batchCount);
+    return hipblasStrsvStridedBatched(
+        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
 }
 
-// symv
 template <>
-hipblasStatus_t hipblasSymv<float, true>(hipblasHandle_t   handle,
-                                         hipblasFillMode_t uplo,
-                                         int               n,
-                                         const float*      alpha,
-                                         const float*      A,
-                                         int               lda,
-                                         const float*      x,
-                                         int               incx,
-                                         const float*      beta,
-                                         float*            y,
-                                         int               incy)
+hipblasStatus_t hipblasTrsvStridedBatched<double>(hipblasHandle_t    handle,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  const double*      A,
+                                                  int                lda,
+                                                  hipblasStride      strideA,
+                                                  double*            x,
+                                                  int                incx,
+                                                  hipblasStride      stridex,
+                                                  int                batch_count)
 {
-    return hipblasSsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
-}
-
-template <>
-hipblasStatus_t hipblasSymv<double, true>(hipblasHandle_t   handle,
-                                          hipblasFillMode_t uplo,
-                                          int               n,
-                                          const double*     alpha,
-                                          const double*     A,
-                                          int               lda,
-                                          const double*     x,
-                                          int               incx,
-                                          const double*     beta,
-                                          double*           y,
-                                          int               incy)
+    return hipblasDtrsvStridedBatched(
+        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTrsvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   m,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          hipblasComplex*       x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          int                   batch_count)
 {
-    return hipblasDsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasCtrsvStridedBatched(
+        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
 }
 
 template <>
-hipblasStatus_t hipblasSymv<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                  hipblasFillMode_t     uplo,
-                                                  int                   n,
-                                                  const hipblasComplex* alpha,
-                                                  const hipblasComplex* A,
-                                                  int                   lda,
-                                                  const hipblasComplex* x,
-                                                  int                   incx,
-                                                  const hipblasComplex* beta,
-                                                  hipblasComplex*       y,
-                                                  int                   incy)
+hipblasStatus_t hipblasTrsvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasFillMode_t           uplo,
+                                                                hipblasOperation_t          transA,
+                                                                hipblasDiagType_t           diag,
+                                                                int                         m,
+                                                                const hipblasDoubleComplex* A,
+                                                                int                         lda,
+                                                                hipblasStride               strideA,
+                                                                hipblasDoubleComplex*       x,
+                                                                int                         incx,
+                                                                hipblasStride               stridex,
+                                                                int batch_count)
 {
-    return hipblasCsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasZtrsvStridedBatched(
+        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
 }
 
+// tpttr
 template <>
-hipblasStatus_t hipblasSymv<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                        hipblasFillMode_t           uplo,
-                                                        int                         n,
-                                                        const hipblasDoubleComplex* alpha,
-                                                        const hipblasDoubleComplex* A,
-                                                        int                         lda,
-                                                        const hipblasDoubleComplex* x,
-                                                        int                         incx,
-                                                        const hipblasDoubleComplex* beta,
-                                                        hipblasDoubleComplex*       y,
-                                                        int                         incy)
+hipblasStatus_t hipblasTpttr<float>(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const float*      AP,
+                                    float*            A,
+                                    int               lda)
 {
-    return hipblasZsymv(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+    return hipblasStpttr(handle, uplo, n, AP, A, lda);
 }
 
-// symv_batched
 template <>
-hipblasStatus_t hipblasSymvBatched<float, true>(hipblasHandle_t    handle,
-                                                hipblasFillMode_t  uplo,
-                                                int                n,
-                                                const float*       alpha,
-                                                const float* const A[],
-                                                int                lda,
-                                                const float* const x[],
-                                                int                incx,
-                                                const float*       beta,
-                                                float*             y[],
-                                                int                incy,
-                                                int                batchCount)
+hipblasStatus_t hipblasTpttr<double>(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     int               n,
+                                     const double*     AP,
+                                     double*           A,
+                                     int               lda)
 {
-    return hipblasSsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasDtpttr(handle, uplo, n, AP, A, lda);
 }
 
 template <>
-hipblasStatus_t hipblasSymvBatched<double, true>(hipblasHandle_t     handle,
-                                                 hipblasFillMode_t   uplo,
-                                                 int                 n,
-                                                 const double*       alpha,
-                                                 const double* const A[],
-                                                 int                 lda,
-                                                 const double* const x[],
-                                                 int                 incx,
-                                                 const double*       beta,
-                                                 double*             y[],
-                                                 int                 incy,
-                                                 int                 batchCount)
+hipblasStatus_t hipblasTpttr<hipblasComplex>(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int                   n,
+                                             const hipblasComplex* AP,
+                                             hipblasComplex*       A,
+                                             int                   lda)
 {
-    return hipblasDsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasCtpttr(handle, uplo, n, AP, A, lda);
 }
 
 template <>
-hipblasStatus_t hipblasSymvBatched<hipblasComplex, true>(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const hipblasComplex*       alpha,
-                                                         const hipblasComplex* const A[],
-                                                         int                         lda,
-                                                         const hipblasComplex* const x[],
-                                                         int                         incx,
-                                                         const hipblasComplex*       beta,
-                                                         hipblasComplex*             y[],
-                                                         int                         incy,
-                                                         int                         batchCount)
+hipblasStatus_t hipblasTpttr<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasDoubleComplex* AP,
+                                                   hipblasDoubleComplex*       A,
+                                                   int                         lda)
 {
-    return hipblasCsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasZtpttr(handle, uplo, n, AP, A, lda);
 }
 
+// tpttr_batched
 template <>
-hipblasStatus_t
-    hipblasSymvBatched<hipblasDoubleComplex, true>(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const A[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex*       beta,
-                                                   hipblasDoubleComplex*             y[],
-                                                   int                               incy,
-                                                   int                               batchCount)
+hipblasStatus_t hipblasTpttrBatched<float>(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           int                n,
+                                           const float* const AP[],
+                                           float* const       A[],
+                                           int                lda,
+                                           int                batchCount)
 {
-    return hipblasZsymvBatched(handle, uplo, n, alpha, A, lda, x, incx, beta, y, incy, batchCount);
+    return hipblasStpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
 }
 
-// symv_strided_batched
 template <>
-hipblasStatus_t hipblasSymvStridedBatched<float, true>(hipblasHandle_t   handle,
-                                                       hipblasFillMode_t uplo,
-                                                       int               n,
-                                                       const float*      alpha,
-                                                       const float*      A,
-                                                       int               lda,
-                                                       hipblasStride     strideA,
-                                                       const float*      x,
-                                                       int               incx,
-                                                       hipblasStride     stridex,
-                                                       const float*      beta,
-                                                       float*            y,
-                                                       int               incy,
-                                                       hipblasStride     stridey,
-                                                       int               batchCount)
+hipblasStatus_t hipblasTpttrBatched<double>(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            int                 n,
+                                            const double* const AP[],
+                                            double* const       A[],
+                                            int                 lda,
+                                            int                 batchCount)
 {
-    return hipblasSsymvStridedBatched(handle,
-                                      uplo,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batchCount);
+    return hipblasDtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSymvStridedBatched<double, true>(hipblasHandle_t   handle,
-                                                        hipblasFillMode_t uplo,
-                                                        int               n,
-                                                        const double*     alpha,
-                                                        const double*     A,
-                                                        int               lda,
-                                                        hipblasStride     strideA,
-                                                        const double*     x,
-                                                        int               incx,
-                                                        hipblasStride     stridex,
-                                                        const double*     beta,
-                                                        double*           y,
-                                                        int               incy,
-                                                        hipblasStride     stridey,
-                                                        int               batchCount)
+hipblasStatus_t hipblasTpttrBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const AP[],
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount)
 {
-    return hipblasDsymvStridedBatched(handle,
-                                      uplo,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batchCount);
+    return hipblasCtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSymvStridedBatched<hipblasComplex, true>(hipblasHandle_t       handle,
-                                                                hipblasFillMode_t     uplo,
-                                                                int                   n,
-                                                                const hipblasComplex* alpha,
-                                                                const hipblasComplex* A,
-                                                                int                   lda,
-                                                                hipblasStride         strideA,
-                                                                const hipblasComplex* x,
-                                                                int                   incx,
-                                                                hipblasStride         stridex,
-                                                                const hipblasComplex* beta,
-                                                                hipblasComplex*       y,
-                                                                int                   incy,
-                                                                hipblasStride         stridey,
-                                                                int                   batchCount)
+hipblasStatus_t hipblasTpttrBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                          hipblasFillMode_t                 uplo,
+                                                          int                               n,
+                                                          const hipblasDoubleComplex* const AP[],
+                                                          hipblasDoubleComplex* const       A[],
+                                                          int                               lda,
+                                                          int batchCount)
 {
-    return hipblasCsymvStridedBatched(handle,
-                                      uplo,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batchCount);
+    return hipblasZtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
 }
 
+// tpttr_strided_batched
 template <>
-hipblasStatus_t
-    hipblasSymvStridedBatched<hipblasDoubleComplex, true>(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* beta,
-                                                          hipblasDoubleComplex*       y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          int                         batchCount)
+hipblasStatus_t hipblasTpttrStridedBatched<float>(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  const float*      AP,
+                                                  hipblasStride     strideAP,
+                                                  float*            A,
+                                                  int               lda,
+                                                  hipblasStride     strideA,
+                                                  int               batchCount)
 {
-    return hipblasZsymvStridedBatched(handle,
-                                      uplo,
-                                      n,
-                                      alpha,
-                                      A,
-                                      lda,
-                                      strideA,
-                                      x,
-                                      incx,
-                                      stridex,
-                                      beta,
-                                      y,
-                                      incy,
-                                      stridey,
-                                      batchCount);
+    return hipblasStpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
 }
 
-// syr
 template <>
-hipblasStatus_t hipblasSyr<float>(hipblasHandle_t   handle,
-                                  hipblasFillMode_t uplo,
-                                  int               n,
-                                  const float*      alpha,
-                                  const float*      x,
-                                  int               incx,
-                                  float*            A,
-                                  int               lda)
+hipblasStatus_t hipblasTpttrStridedBatched<double>(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int               n,
+                                                   const double*     AP,
+                                                   hipblasStride     strideAP,
+                                                   double*           A,
+                                                   int               lda,
+                                                   hipblasStride     strideA,
+                                                   int               batchCount)
 {
-    return hipblasSsyr(handle, uplo, n, alpha, x, incx, A, lda);
+    return hipblasDtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyr<double>(hipblasHandle_t   handle,
-                                   hipblasFillMode_t uplo,
-                                   int               n,
-                                   const double*     alpha,
-                                   const double*     x,
-                                   int               incx,
-                                   double*           A,
-                                   int               lda)
+hipblasStatus_t hipblasTpttrStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* AP,
+                                                           hipblasStride         strideAP,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount)
 {
-    return hipblasDsyr(handle, uplo, n, alpha, x, incx, A, lda);
+    return hipblasCtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyr<hipblasComplex>(hipblasHandle_t       handle,
-                                           hipblasFillMode_t     uplo,
-                                           int                   n,
-                                           const hipblasComplex* alpha,
-                                           const hipblasComplex* x,
-                                           int                   incx,
-                                           hipblasComplex*       A,
-                                           int                   lda)
+hipblasStatus_t hipblasTpttrStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                 hipblasFillMode_t           uplo,
+                                                                 int                         n,
+                                                                 const hipblasDoubleComplex* AP,
+                                                                 hipblasStride strideAP,
+                                                                 hipblasDoubleComplex*       A,
+                                                                 int                         lda,
+                                                                 hipblasStride strideA,
+                                                                 int batchCount)
 {
-    return hipblasCsyr(handle, uplo, n, alpha, x, incx, A, lda);
+    return hipblasZtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
 }
 
+// trttp
 template <>
-hipblasStatus_t hipblasSyr<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                 hipblasFillMode_t           uplo,
-                                                 int                         n,
-                                                 const hipblasDoubleComplex* alpha,
-                                                 const hipblasDoubleComplex* x,
-                                                 int                         incx,
-                                                 hipblasDoubleComplex*       A,
-                                                 int                         lda)
+hipblasStatus_t hipblasTrttp<float>(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const float*      A,
+                                    int               lda,
+                                    float*            AP)
 {
-    return hipblasZsyr(handle, uplo, n, alpha, x, incx, A, lda);
+    return hipblasStrttp(handle, uplo, n, A, lda, AP);
 }
 
-// syr_batched
 template <>
-hipblasStatus_t hipblasSyrBatched<float>(hipblasHandle_t    handle,
-                                         hipblasFillMode_t  uplo,
-                                         int                n,
-                                         const float*       alpha,
-                                         const float* const x[],
-                                         int                incx,
-                                         float* const       A[],
-                                         int                lda,
-                                         int                batch_count)
+hipblasStatus_t hipblasTrttp<double>(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     int               n,
+                                     const double*     A,
+                                     int               lda,
+                                     double*           AP)
 {
-    return hipblasSsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+    return hipblasDtrttp(handle, uplo, n, A, lda, AP);
 }
 
 template <>
-hipblasStatus_t hipblasSyrBatched<double>(hipblasHandle_t     handle,
-                                          hipblasFillMode_t   uplo,
-                                          int                 n,
-                                          const double*       alpha,
-                                          const double* const x[],
-                                          int                 incx,
-                                          double* const       A[],
-                                          int                 lda,
-                                          int                 batch_count)
+hipblasStatus_t hipblasTrttp<hipblasComplex>(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int                   n,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       AP)
 {
-    return hipblasDsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+    return hipblasCtrttp(handle, uplo, n, A, lda, AP);
 }
 
 template <>
-hipblasStatus_t hipblasSyrBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
-                                                  int                         n,
-                                                  const hipblasComplex*       alpha,
-                                                  const hipblasComplex* const x[],
-                                                  int                         incx,
-                                                  hipblasComplex* const       A[],
-                                                  int                         lda,
-                                                  int                         batch_count)
+hipblasStatus_t hipblasTrttp<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasDoubleComplex* A,
+                                                   int                         lda,
+                                                   hipblasDoubleComplex*       AP)
 {
-    return hipblasCsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+    return hipblasZtrttp(handle, uplo, n, A, lda, AP);
 }
 
+// trttp_batched
 template <>
-hipblasStatus_t hipblasSyrBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                        hipblasFillMode_t                 uplo,
-                                                        int                               n,
-                                                        const hipblasDoubleComplex*       alpha,
-                                                        const hipblasDoubleComplex* const x[],
-                                                        int                               incx,
-                                                        hipblasDoubleComplex* const       A[],
-                                                        int                               lda,
-                                                        int batch_count)
+hipblasStatus_t hipblasTrttpBatched<float>(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           int                n,
+                                           const float* const A[],
+                                           int                lda,
+                                           float* const       AP[],
+                                           int                batchCount)
 {
-    return hipblasZsyrBatched(handle, uplo, n, alpha, x, incx, A, lda, batch_count);
+    return hipblasStrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
 }
 
-// syr_strided_batched
 template <>
-hipblasStatus_t hipblasSyrStridedBatched<float>(hipblasHandle_t   handle,
-                                                hipblasFillMode_t uplo,
-                                                int               n,
-                                                const float*      alpha,
-                                                const float*      x,
-                                                int               incx,
-                                                hipblasStride     stridex,
-                                                float*            A,
-                                                int               lda,
-                                                hipblasStride     strideA,
-                                                int               batch_count)
+hipblasStatus_t hipblasTrttpBatched<double>(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            int                 n,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       AP[],
+                                            int                 batchCount)
 {
-    return hipblasSsyrStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+    return hipblasDtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrStridedBatched<double>(hipblasHandle_t   handle,
-                                                 hipblasFillMode_t uplo,
-                                                 int               n,
-                                                 const double*     alpha,
-                                                 const double*     x,
-                                                 int               incx,
-                                                 hipblasStride     stridex,
-                                                 double*           A,
-                                                 int               lda,
-                                                 hipblasStride     strideA,
-                                                 int               batch_count)
+hipblasStatus_t hipblasTrttpBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AP[],
+                                                    int                         batchCount)
 {
-    return hipblasDsyrStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+    return hipblasCtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                         hipblasFillMode_t     uplo,
-                                                         int                   n,
-                                                         const hipblasComplex* alpha,
-                                                         const hipblasComplex* x,
-                                                         int                   incx,
-                                                         hipblasStride         stridex,
-                                                         hipblasComplex*       A,
-                                                         int                   lda,
-                                                         hipblasStride         strideA,
-                                                         int                   batch_count)
+hipblasStatus_t hipblasTrttpBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                          hipblasFillMode_t                 uplo,
+                                                          int                               n,
+                                                          const hipblasDoubleComplex* const A[],
+                                                          int                               lda,
+                                                          hipblasDoubleComplex* const       AP[],
+                                                          int batchCount)
 {
-    return hipblasCsyrStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+    return hipblasZtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
 }
 
+// trttp_strided_batched
 template <>
-hipblasStatus_t hipblasSyrStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                               hipblasFillMode_t           uplo,
-                                                               int                         n,
-                                                               const hipblasDoubleComplex* alpha,
-                                                               const hipblasDoubleComplex* x,
-                                                               int                         incx,
-                                                               hipblasStride               stridex,
-                                                               hipblasDoubleComplex*       A,
-                                                               int                         lda,
-                                                               hipblasStride               strideA,
-                                                               int batch_count)
+hipblasStatus_t hipblasTrttpStridedBatched<float>(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  const float*      A,
+                                                  int               lda,
+                                                  hipblasStride     strideA,
+                                                  float*            AP,
+                                                  hipblasStride     strideAP,
+                                                  int               batchCount)
 {
-    return hipblasZsyrStridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, A, lda, strideA, batch_count);
+    return hipblasStrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
 }
 
-// syr2
 template <>
-hipblasStatus_t hipblasSyr2(hipblasHandle_t   handle,
-                            hipblasFillMode_t uplo,
-                            int               n,
-                            const float*      alpha,
-                            const float*      x,
-                            int               incx,
-                            const float*      y,
-                            int               incy,
-                            float*            A,
-                            int               lda)
+hipblasStatus_t hipblasTrttpStridedBatched<double>(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int               n,
+                                                   const double*     A,
+                                                   int               lda,
+                                                   hipblasStride     strideA,
+                                                   double*           AP,
+                                                   hipblasStride     strideAP,
+                                                   int               batchCount)
 {
-    return hipblasSsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasDtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2(hipblasHandle_t   handle,
-                            hipblasFillMode_t uplo,
-                            int               n,
-                            const double*     alpha,
-                            const double*     x,
-                            int               incx,
-                            const double*     y,
-                            int               incy,
-                            double*           A,
-                            int               lda)
+hipblasStatus_t hipblasTrttpStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AP,
+                                                           hipblasStride         strideAP,
+                                                           int                   batchCount)
 {
-    return hipblasDsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasCtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2(hipblasHandle_t       handle,
-                            hipblasFillMode_t     uplo,
-                            int                   n,
-                            const hipblasComplex* alpha,
-                            const hipblasComplex* x,
-                            int                   incx,
-                            const hipblasComplex* y,
-                            int                   incy,
-                            hipblasComplex*       A,
-                            int                   lda)
+hipblasStatus_t hipblasTrttpStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                 hipblasFillMode_t           uplo,
+                                                                 int                         n,
+                                                                 const hipblasDoubleComplex* A,
+                                                                 int                         lda,
+                                                                 hipblasStride strideA,
+                                                                 hipblasDoubleComplex*       AP,
+                                                                 hipblasStride strideAP,
+                                                                 int batchCount)
 {
-    return hipblasCsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasZtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
 }
 
+// gbtge
 template <>
-hipblasStatus_t hipblasSyr2(hipblasHandle_t             handle,
-                            hipblasFillMode_t           uplo,
-                            int                         n,
-                            const hipblasDoubleComplex* alpha,
-                            const hipblasDoubleComplex* x,
-                            int                         incx,
-                            const hipblasDoubleComplex* y,
-                            int                         incy,
-                            hipblasDoubleComplex*       A,
-                            int                         lda)
+hipblasStatus_t hipblasGbtge<float>(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    int             kl,
+                                    int             ku,
+                                    const float*    AB,
+                                    int             ldab,
+                                    float*          A,
+                                    int             lda)
 {
-    return hipblasZsyr2(handle, uplo, n, alpha, x, incx, y, incy, A, lda);
+    return hipblasSgbtge(handle, m, n, kl, ku, AB, ldab, A, lda);
 }
 
-// syr2_batched
 template <>
-hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t    handle,
-                                   hipblasFillMode_t  uplo,
-                                   int                n,
-                                   const float*       alpha,
-                                   const float* const x[],
-                                   int                incx,
-                                   const float* const y[],
-                                   int                incy,
-                                   float* const       A[],
-                                   int                lda,
-                                   int                batchCount)
+hipblasStatus_t hipblasGbtge<double>(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     int             kl,
+                                     int             ku,
+                                     const double*   AB,
+                                     int             ldab,
+                                     double*         A,
+                                     int             lda)
 {
-    return hipblasSsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblasDgbtge(handle, m, n, kl, ku, AB, ldab, A, lda);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t     handle,
-                                   hipblasFillMode_t   uplo,
-                                   int                 n,
-                                   const double*       alpha,
-                                   const double* const x[],
-                                   int                 incx,
-                                   const double* const y[],
-                                   int                 incy,
-                                   double* const       A[],
-                                   int                 lda,
-                                   int                 batchCount)
+hipblasStatus_t hipblasGbtge<hipblasComplex>(hipblasHandle_t       handle,
+                                             int                   m,
+                                             int                   n,
+                                             int                   kl,
+                                             int                   ku,
+                                             const hipblasComplex* AB,
+                                             int                   ldab,
+                                             hipblasComplex*       A,
+                                             int                   lda)
 {
-    return hipblasDsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblasCgbtge(handle, m, n, kl, ku, AB, ldab, A, lda);
 }
 
-template <>
-hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t             handle,
-                                   hipblasFillMode_t           uplo,
-                                   int                         n,
-                                   const hipblasComplex*       alpha,
-                                   const hipblasComplex* const x[],
-                                   int                         incx,
-                                   const hipblasComplex* const y[],
-                                   int                         incy,
-                                   hipblasComplex* const       A[],
-                                   int                         lda,
-                                   int                         batchCount)
+template <>
+hipblasStatus_t hipblasGbtge<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   int                         m,
+                                                   int                         n,
+                                                   int                         kl,
+                                                   int                         ku,
+                                                   const hipblasDoubleComplex* AB,
+                                                   int                         ldab,
+                                                   hipblasDoubleComplex*       A,
+                                                   int                         lda)
 {
-    return hipblasCsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblasZgbtge(handle, m, n, kl, ku, AB, ldab, A, lda);
 }
 
+// gbtge_batched
 template <>
-hipblasStatus_t hipblasSyr2Batched(hipblasHandle_t                   handle,
-                                   hipblasFillMode_t                 uplo,
-                                   int                               n,
-                                   const hipblasDoubleComplex*       alpha,
-                                   const hipblasDoubleComplex* const x[],
-                                   int                               incx,
-                                   const hipblasDoubleComplex* const y[],
-                                   int                               incy,
-                                   hipblasDoubleComplex* const       A[],
-                                   int                               lda,
-                                   int                               batchCount)
+hipblasStatus_t hipblasGbtgeBatched<float>(hipblasHandle_t    handle,
+                                           int                m,
+                                           int                n,
+                                           int                kl,
+                                           int                ku,
+                                           const float* const AB[],
+                                           int                ldab,
+                                           float* const       A[],
+                                           int                lda,
+                                           int                batchCount)
 {
-    return hipblasZsyr2Batched(handle, uplo, n, alpha, x, incx, y, incy, A, lda, batchCount);
+    return hipblasSgbtgeBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
 }
 
-// syr2_strided_batched
 template <>
-hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t   handle,
-                                          hipblasFillMode_t uplo,
-                                          int               n,
-                                          const float*      alpha,
-                                          const float*      x,
-                                          int               incx,
-                                          hipblasStride     stridex,
-                                          const float*      y,
-                                          int               incy,
-                                          hipblasStride     stridey,
-                                          float*            A,
-                                          int               lda,
-                                          hipblasStride     strideA,
-                                          int               batchCount)
+hipblasStatus_t hipblasGbtgeBatched<double>(hipblasHandle_t     handle,
+                                            int                 m,
+                                            int                 n,
+                                            int                 kl,
+                                            int                 ku,
+                                            const double* const AB[],
+                                            int                 ldab,
+                                            double* const       A[],
+                                            int                 lda,
+                                            int                 batchCount)
 {
-    return hipblasSsyr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblasDgbtgeBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t   handle,
-                                          hipblasFillMode_t uplo,
-                                          int               n,
-                                          const double*     alpha,
-                                          const double*     x,
-                                          int               incx,
-                                          hipblasStride     stridex,
-                                          const double*     y,
-                                          int               incy,
-                                          hipblasStride     stridey,
-                                          double*           A,
-                                          int               lda,
-                                          hipblasStride     strideA,
-                                          int               batchCount)
+hipblasStatus_t hipblasGbtgeBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const AB[],
+                                                    int                         ldab,
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount)
 {
-    return hipblasDsyr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblasCgbtgeBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t       handle,
-                                          hipblasFillMode_t     uplo,
-                                          int                   n,
-                                          const hipblasComplex* alpha,
-                                          const hipblasComplex* x,
-                                          int                   incx,
-                                          hipblasStride         stridex,
-                                          const hipblasComplex* y,
-                                          int                   incy,
-                                          hipblasStride         stridey,
-                                          hipblasComplex*       A,
-                                          int                   lda,
-                                          hipblasStride         strideA,
-                                          int                   batchCount)
+hipblasStatus_t hipblasGbtgeBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                          int                               m,
+                                                          int                               n,
+                                                          int                               kl,
+                                                          int                               ku,
+                                                          const hipblasDoubleComplex* const AB[],
+                                                          int                               ldab,
+                                                          hipblasDoubleComplex* const       A[],
+                                                          int                               lda,
+                                                          int batchCount)
 {
-    return hipblasCsyr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblasZgbtgeBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
 }
 
+// gbtge_strided_batched
 template <>
-hipblasStatus_t hipblasSyr2StridedBatched(hipblasHandle_t             handle,
-                                          hipblasFillMode_t           uplo,
-                                          int                         n,
-                                          const hipblasDoubleComplex* alpha,
-                                          const hipblasDoubleComplex* x,
-                                          int                         incx,
-                                          hipblasStride               stridex,
-                                          const hipblasDoubleComplex* y,
-                                          int                         incy,
-                                          hipblasStride               stridey,
-                                          hipblasDoubleComplex*       A,
-                                          int                         lda,
-                                          hipblasStride               strideA,
-                                          int                         batchCount)
+hipblasStatus_t hipblasGbtgeStridedBatched<float>(hipblasHandle_t handle,
+                                                  int             m,
+                                                  int             n,
+                                                  int             kl,
+                                                  int             ku,
+                                                  const float*    AB,
+                                                  int             ldab,
+                                                  hipblasStride   strideAB,
+                                                  float*          A,
+                                                  int             lda,
+                                                  hipblasStride   strideA,
+                                                  int             batchCount)
 {
-    return hipblasZsyr2StridedBatched(
-        handle, uplo, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batchCount);
+    return hipblasSgbtgeStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
 }
 
-// trsv
 template <>
-hipblasStatus_t hipblasTrsv<float>(hipblasHandle_t    handle,
-                                   hipblasFillMode_t  uplo,
-                                   hipblasOperation_t transA,
-                                   hipblasDiagType_t  diag,
-                                   int                m,
-                                   const float*       A,
-                                   int                lda,
-                                   float*             x,
-                                   int                incx)
+hipblasStatus_t hipblasGbtgeStridedBatched<double>(hipblasHandle_t handle,
+                                                   int             m,
+                                                   int             n,
+                                                   int             kl,
+                                                   int             ku,
+                                                   const double*   AB,
+                                                   int             ldab,
+                                                   hipblasStride   strideAB,
+                                                   double*         A,
+                                                   int             lda,
+                                                   hipblasStride   strideA,
+                                                   int             batchCount)
 {
-    return hipblasStrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+    return hipblasDgbtgeStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasTrsv<double>(hipblasHandle_t    handle,
-                                    hipblasFillMode_t  uplo,
-                                    hipblasOperation_t transA,
-                                    hipblasDiagType_t  diag,
-                                    int                m,
-                                    const double*      A,
-                                    int                lda,
-                                    double*            x,
-                                    int                incx)
+hipblasStatus_t hipblasGbtgeStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount)
 {
-    return hipblasDtrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+    return hipblasCgbtgeStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasTrsv<hipblasComplex>(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
-                                            hipblasDiagType_t     diag,
-                                            int                   m,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            hipblasComplex*       x,
-                                            int                   incx)
+hipblasStatus_t hipblasGbtgeStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                 int                         m,
+                                                                 int                         n,
+                                                                 int                         kl,
+                                                                 int                         ku,
+                                                                 const hipblasDoubleComplex* AB,
+                                                                 int                         ldab,
+                                                                 hipblasStride strideAB,
+                                                                 hipblasDoubleComplex*       A,
+                                                                 int                         lda,
+                                                                 hipblasStride strideA,
+                                                                 int batchCount)
 {
-    return hipblasCtrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+    return hipblasZgbtgeStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
 }
 
+// getgb
 template <>
-hipblasStatus_t hipblasTrsv<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
-                                                  hipblasOperation_t          transA,
-                                                  hipblasDiagType_t           diag,
-                                                  int                         m,
-                                                  const hipblasDoubleComplex* A,
-                                                  int                         lda,
-                                                  hipblasDoubleComplex*       x,
-                                                  int                         incx)
+hipblasStatus_t hipblasGetgb<float>(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    int             kl,
+                                    int             ku,
+                                    const float*    A,
+                                    int             lda,
+                                    float*          AB,
+                                    int             ldab)
 {
-    return hipblasZtrsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+    return hipblasSgetgb(handle, m, n, kl, ku, A, lda, AB, ldab);
 }
 
-// trsv_batched
 template <>
-hipblasStatus_t hipblasTrsvBatched<float>(hipblasHandle_t    handle,
-                                          hipblasFillMode_t  uplo,
-                                          hipblasOperation_t transA,
-                                          hipblasDiagType_t  diag,
-                                          int                m,
-                                          const float* const A[],
-                                          int                lda,
-                                          float* const       x[],
-                                          int                incx,
-                                          int                batch_count)
+hipblasStatus_t hipblasGetgb<double>(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     int             kl,
+                                     int             ku,
+                                     const double*   A,
+                                     int             lda,
+                                     double*         AB,
+                                     int             ldab)
 {
-    return hipblasStrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblasDgetgb(handle, m, n, kl, ku, A, lda, AB, ldab);
 }
 
 template <>
-hipblasStatus_t hipblasTrsvBatched<double>(hipblasHandle_t     handle,
-                                           hipblasFillMode_t   uplo,
-                                           hipblasOperation_t  transA,
-                                           hipblasDiagType_t   diag,
-                                           int                 m,
-                                           const double* const A[],
-                                           int                 lda,
-                                           double* const       x[],
-                                           int                 incx,
-                                           int                 batch_count)
+hipblasStatus_t hipblasGetgb<hipblasComplex>(hipblasHandle_t       handle,
+                                             int                   m,
+                                             int                   n,
+                                             int                   kl,
+                                             int                   ku,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       AB,
+                                             int                   ldab)
 {
-    return hipblasDtrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblasCgetgb(handle, m, n, kl, ku, A, lda, AB, ldab);
 }
 
 template <>
-hipblasStatus_t hipblasTrsvBatched<hipblasComplex>(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
-                                                   hipblasDiagType_t           diag,
+hipblasStatus_t hipblasGetgb<hipblasDoubleComplex>(hipblasHandle_t             handle,
                                                    int                         m,
-                                                   const hipblasComplex* const A[],
+                                                   int                         n,
+                                                   int                         kl,
+                                                   int                         ku,
+                                                   const hipblasDoubleComplex* A,
                                                    int                         lda,
-                                                   hipblasComplex* const       x[],
-                                                   int                         incx,
-                                                   int                         batch_count)
+                                                   hipblasDoubleComplex*       AB,
+                                                   int                         ldab)
 {
-    return hipblasCtrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblasZgetgb(handle, m, n, kl, ku, A, lda, AB, ldab);
 }
 
+// getgb_batched
 template <>
-hipblasStatus_t hipblasTrsvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
-                                                         hipblasFillMode_t                 uplo,
-                                                         hipblasOperation_t                transA,
-                                                         hipblasDiagType_t                 diag,
-                                                         int                               m,
-                                                         const hipblasDoubleComplex* const A[],
-                                                         int                               lda,
-                                                         hipblasDoubleComplex* const       x[],
-                                                         int                               incx,
-                                                         int batch_count)
+hipblasStatus_t hipblasGetgbBatched<float>(hipblasHandle_t    handle,
+                                           int                m,
+                                           int                n,
+                                           int                kl,
+                                           int                ku,
+                                           const float* const A[],
+                                           int                lda,
+                                           float* const       AB[],
+                                           int                ldab,
+                                           int                batchCount)
 {
-    return hipblasZtrsvBatched(handle, uplo, transA, diag, m, A, lda, x, incx, batch_count);
+    return hipblasSgetgbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
-// trsv_strided_batched
 template <>
-hipblasStatus_t hipblasTrsvStridedBatched<float>(hipblasHandle_t    handle,
-                                                 hipblasFillMode_t  uplo,
-                                                 hipblasOperation_t transA,
-                                                 hipblasDiagType_t  diag,
-                                                 int                m,
-                                                 const float*       A,
-                                                 int                lda,
-                                                 hipblasStride      strideA,
-                                                 float*             x,
-                                                 int                incx,
-                                                 hipblasStride      stridex,
-                                                 int                batch_count)
+hipblasStatus_t hipblasGetgbBatched<double>(hipblasHandle_t     handle,
+                                            int                 m,
+                                            int                 n,
+                                            int                 kl,
+                                            int                 ku,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       AB[],
+                                            int                 ldab,
+                                            int                 batchCount)
 {
-    return hipblasStrsvStridedBatched(
-        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblasDgetgbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasTrsvStridedBatched<double>(hipblasHandle_t    handle,
-                                                  hipblasFillMode_t  uplo,
-                                                  hipblasOperation_t transA,
-                                                  hipblasDiagType_t  diag,
-                                                  int                m,
-                                                  const double*      A,
-                                                  int                lda,
-                                                  hipblasStride      strideA,
-                                                  double*            x,
-                                                  int                incx,
-                                                  hipblasStride      stridex,
-                                                  int                batch_count)
+hipblasStatus_t hipblasGetgbBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AB[],
+                                                    int                         ldab,
+                                                    int                         batchCount)
 {
-    return hipblasDtrsvStridedBatched(
-        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblasCgetgbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasTrsvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          hipblasOperation_t    transA,
-                                                          hipblasDiagType_t     diag,
-                                                          int                   m,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          hipblasComplex*       x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          int                   batch_count)
+hipblasStatus_t hipblasGetgbBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                          int                               m,
+                                                          int                               n,
+                                                          int                               kl,
+                                                          int                               ku,
+                                                          const hipblasDoubleComplex* const A[],
+                                                          int                               lda,
+                                                          hipblasDoubleComplex* const       AB[],
+                                                          int                               ldab,
+                                                          int batchCount)
 {
-    return hipblasCtrsvStridedBatched(
-        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblasZgetgbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
 }
 
+// getgb_strided_batched
 template <>
-hipblasStatus_t hipblasTrsvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                                hipblasFillMode_t           uplo,
-                                                                hipblasOperation_t          transA,
-                                                                hipblasDiagType_t           diag,
-                                                                int                         m,
-                                                                const hipblasDoubleComplex* A,
-                                                                int                         lda,
-                                                                hipblasStride               strideA,
-                                                                hipblasDoubleComplex*       x,
-                                                                int                         incx,
-                                                                hipblasStride               stridex,
-                                                                int batch_count)
+hipblasStatus_t hipblasGetgbStridedBatched<float>(hipblasHandle_t handle,
+                                                  int             m,
+                                                  int             n,
+                                                  int             kl,
+                                                  int             ku,
+                                                  const float*    A,
+                                                  int             lda,
+                                                  hipblasStride   strideA,
+                                                  float*          AB,
+                                                  int             ldab,
+                                                  hipblasStride   strideAB,
+                                                  int             batchCount)
+{
+    return hipblasSgetgbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetgbStridedBatched<double>(hipblasHandle_t handle,
+                                                   int             m,
+                                                   int             n,
+                                                   int             kl,
+                                                   int             ku,
+                                                   const double*   A,
+                                                   int             lda,
+                                                   hipblasStride   strideA,
+                                                   double*         AB,
+                                                   int             ldab,
+                                                   hipblasStride   strideAB,
+                                                   int             batchCount)
+{
+    return hipblasDgetgbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetgbStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           int                   batchCount)
 {
-    return hipblasZtrsvStridedBatched(
-        handle, uplo, transA, diag, m, A, lda, strideA, x, incx, stridex, batch_count);
+    return hipblasCgetgbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetgbStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                 int                         m,
+                                                                 int                         n,
+                                                                 int                         kl,
+                                                                 int                         ku,
+                                                                 const hipblasDoubleComplex* A,
+                                                                 int                         lda,
+                                                                 hipblasStride strideA,
+                                                                 hipblasDoubleComplex*       AB,
+                                                                 int                         ldab,
+                                                                 hipblasStride strideAB,
+                                                                 int batchCount)
+{
+    return hipblasZgetgbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
 }
 
 /*
@@ -5775,6 +7459,276 @@ hipblasStatus_t hipblasGemmBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
 }
 
+// gemm_batched_host_ptrs
+template <>
+hipblasStatus_t hipblasGemmBatchedHostPtrs<hipblasHalf>(hipblasHandle_t          handle,
+                                                        hipblasOperation_t       transA,
+                                                        hipblasOperation_t       transB,
+                                                        int                      m,
+                                                        int                      n,
+                                                        int                      k,
+                                                        const hipblasHalf*       alpha,
+                                                        const hipblasHalf* const A[],
+                                                        int                      lda,
+                                                        const hipblasHalf* const B[],
+                                                        int                      ldb,
+                                                        const hipblasHalf*       beta,
+                                                        hipblasHalf* const       C[],
+                                                        int                      ldc,
+                                                        int                      batch_count)
+{
+    return hipblasHgemmBatchedHostPtrs(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmBatchedHostPtrs<float>(hipblasHandle_t    handle,
+                                                  hipblasOperation_t transA,
+                                                  hipblasOperation_t transB,
+                                                  int                m,
+                                                  int                n,
+                                                  int                k,
+                                                  const float*       alpha,
+                                                  const float* const A[],
+                                                  int                lda,
+                                                  const float* const B[],
+                                                  int                ldb,
+                                                  const float*       beta,
+                                                  float* const       C[],
+                                                  int                ldc,
+                                                  int                batch_count)
+{
+    return hipblasSgemmBatchedHostPtrs(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmBatchedHostPtrs<double>(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasOperation_t  transB,
+                                                   int                 m,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const B[],
+                                                   int                 ldb,
+                                                   const double*       beta,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batch_count)
+{
+    return hipblasDgemmBatchedHostPtrs(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmBatchedHostPtrs<hipblasComplex>(hipblasHandle_t             handle,
+                                                           hipblasOperation_t          transA,
+                                                           hipblasOperation_t          transB,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex* const B[],
+                                                           int                         ldb,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batch_count)
+{
+    return hipblasCgemmBatchedHostPtrs(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGemmBatchedHostPtrs<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                     hipblasOperation_t                transA,
+                                                     hipblasOperation_t                transB,
+                                                     int                               m,
+                                                     int                               n,
+                                                     int                               k,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     int                               lda,
+                                                     const hipblasDoubleComplex* const B[],
+                                                     int                               ldb,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     hipblasDoubleComplex* const       C[],
+                                                     int                               ldc,
+                                                     int                               batch_count)
+{
+    return hipblasZgemmBatchedHostPtrs(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+// gemm3m
+template <>
+hipblasStatus_t hipblasGemm3m<hipblasComplex>(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc)
+{
+    return hipblasCgemm3m(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm3m<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int                         lda,
+                                                    const hipblasDoubleComplex* B,
+                                                    int                         ldb,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int                         ldc)
+{
+    return hipblasZgemm3m(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm3mBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasOperation_t          transB,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const A[],
+                                                     int                         lda,
+                                                     const hipblasComplex* const B[],
+                                                     int                         ldb,
+                                                     const hipblasComplex*       beta,
+                                                     hipblasComplex* const       C[],
+                                                     int                         ldc,
+                                                     int                         batch_count)
+{
+    return hipblasCgemm3mBatched(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGemm3mBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                               hipblasOperation_t                transA,
+                                               hipblasOperation_t                transB,
+                                               int                               m,
+                                               int                               n,
+                                               int                               k,
+                                               const hipblasDoubleComplex*       alpha,
+                                               const hipblasDoubleComplex* const A[],
+                                               int                               lda,
+                                               const hipblasDoubleComplex* const B[],
+                                               int                               ldb,
+                                               const hipblasDoubleComplex*       beta,
+                                               hipblasDoubleComplex* const       C[],
+                                               int                               ldc,
+                                               int                               batch_count)
+{
+    return hipblasZgemm3mBatched(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemm3mStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                            hipblasOperation_t    transA,
+                                                            hipblasOperation_t    transB,
+                                                            int                   m,
+                                                            int                   n,
+                                                            int                   k,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* A,
+                                                            int                   lda,
+                                                            hipblasStride         strideA,
+                                                            const hipblasComplex* B,
+                                                            int                   ldb,
+                                                            hipblasStride         strideB,
+                                                            const hipblasComplex* beta,
+                                                            hipblasComplex*       C,
+                                                            int                   ldc,
+                                                            hipblasStride         strideC,
+                                                            int                   batch_count)
+{
+    return hipblasCgemm3mStridedBatched(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        B,
+                                        ldb,
+                                        strideB,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        strideC,
+                                        batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGemm3mStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int                         m,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* A,
+                                                      int                         lda,
+                                                      hipblasStride               strideA,
+                                                      const hipblasDoubleComplex* B,
+                                                      int                         ldb,
+                                                      hipblasStride               strideB,
+                                                      const hipblasDoubleComplex* beta,
+                                                      hipblasDoubleComplex*       C,
+                                                      int                         ldc,
+                                                      hipblasStride               strideC,
+                                                      int                         batch_count)
+{
+    return hipblasZgemm3mStridedBatched(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        B,
+                                        ldb,
+                                        strideB,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        strideC,
+                                        batch_count);
+}
+
 // gemm_strided_batched
 template <>
 hipblasStatus_t hipblasGemmStridedBatched<hipblasHalf>(hipblasHandle_t    handle,
@@ -6049,6 +8003,43 @@ hipblasStatus_t hipblasHerkBatched(hipblasHandle_t                   handle,
     return hipblasZherkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
 }
 
+// herk_batched_host_ptrs
+template <>
+hipblasStatus_t hipblasHerkBatchedHostPtrs(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           int                         n,
+                                           int                         k,
+                                           const float*                alpha,
+                                           const hipblasComplex* const A[],
+                                           int                         lda,
+                                           const float*                beta,
+                                           hipblasComplex* const       C[],
+                                           int                         ldc,
+                                           int                         batchCount)
+{
+    return hipblasCherkBatchedHostPtrs(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHerkBatchedHostPtrs(hipblasHandle_t                   handle,
+                                           hipblasFillMode_t                 uplo,
+                                           hipblasOperation_t                transA,
+                                           int                               n,
+                                           int                               k,
+                                           const double*                     alpha,
+                                           const hipblasDoubleComplex* const A[],
+                                           int                               lda,
+                                           const double*                     beta,
+                                           hipblasDoubleComplex* const       C[],
+                                           int                               ldc,
+                                           int                               batchCount)
+{
+    return hipblasZherkBatchedHostPtrs(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
 // herk_strided_batched
 template <>
 hipblasStatus_t hipblasHerkStridedBatched(hipblasHandle_t       handle,
@@ -6554,6 +8545,88 @@ hipblasStatus_t hipblasSymmBatched(hipblasHandle_t                   handle,
         handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
 }
 
+// symm_batched_host_ptrs
+template <>
+hipblasStatus_t hipblasSymmBatchedHostPtrs<float>(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float* const A[],
+                                                  int                lda,
+                                                  const float* const B[],
+                                                  int                ldb,
+                                                  const float*       beta,
+                                                  float* const       C[],
+                                                  int                ldc,
+                                                  int                batchCount)
+{
+    return hipblasSsymmBatchedHostPtrs(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSymmBatchedHostPtrs<double>(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasFillMode_t   uplo,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const B[],
+                                                   int                 ldb,
+                                                   const double*       beta,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batchCount)
+{
+    return hipblasDsymmBatchedHostPtrs(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSymmBatchedHostPtrs<hipblasComplex>(hipblasHandle_t             handle,
+                                                           hipblasSideMode_t           side,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex* const B[],
+                                                           int                         ldb,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount)
+{
+    return hipblasCsymmBatchedHostPtrs(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasSymmBatchedHostPtrs<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                     hipblasSideMode_t                 side,
+                                                     hipblasFillMode_t                 uplo,
+                                                     int                               m,
+                                                     int                               n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     int                               lda,
+                                                     const hipblasDoubleComplex* const B[],
+                                                     int                               ldb,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     hipblasDoubleComplex* const       C[],
+                                                     int                               ldc,
+                                                     int                               batchCount)
+{
+    return hipblasZsymmBatchedHostPtrs(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
 // symm_strided_batched
 template <>
 hipblasStatus_t hipblasSymmStridedBatched(hipblasHandle_t   handle,
@@ -6841,6 +8914,80 @@ hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t                   handle,
     return hipblasZsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
 }
 
+// syrk_batched_host_ptrs
+template <>
+hipblasStatus_t hipblasSyrkBatchedHostPtrs<float>(hipblasHandle_t    handle,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  int                n,
+                                                  int                k,
+                                                  const float*       alpha,
+                                                  const float* const A[],
+                                                  int                lda,
+                                                  const float*       beta,
+                                                  float* const       C[],
+                                                  int                ldc,
+                                                  int                batchCount)
+{
+    return hipblasSsyrkBatchedHostPtrs(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkBatchedHostPtrs<double>(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double*       beta,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batchCount)
+{
+    return hipblasDsyrkBatchedHostPtrs(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkBatchedHostPtrs<hipblasComplex>(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasOperation_t          transA,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount)
+{
+    return hipblasCsyrkBatchedHostPtrs(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasSyrkBatchedHostPtrs<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                     hipblasFillMode_t                 uplo,
+                                                     hipblasOperation_t                transA,
+                                                     int                               n,
+                                                     int                               k,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     int                               lda,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     hipblasDoubleComplex* const       C[],
+                                                     int                               ldc,
+                                                     int                               batchCount)
+{
+    return hipblasZsyrkBatchedHostPtrs(
+        handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
 // syrk_strided_batched
 template <>
 hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t    handle,
@@ -7837,6 +9984,84 @@ hipblasStatus_t hipblasTrmmBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
 }
 
+// trmm_batched_host_ptrs
+template <>
+hipblasStatus_t hipblasTrmmBatchedHostPtrs<float>(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float* const A[],
+                                                  int                lda,
+                                                  float* const       B[],
+                                                  int                ldb,
+                                                  int                batchCount)
+{
+    return hipblasStrmmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrmmBatchedHostPtrs<double>(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasDiagType_t   diag,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   double* const       B[],
+                                                   int                 ldb,
+                                                   int                 batchCount)
+{
+    return hipblasDtrmmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrmmBatchedHostPtrs<hipblasComplex>(hipblasHandle_t             handle,
+                                                           hipblasSideMode_t           side,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasOperation_t          transA,
+                                                           hipblasDiagType_t           diag,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           hipblasComplex* const       B[],
+                                                           int                         ldb,
+                                                           int                         batchCount)
+{
+    return hipblasCtrmmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTrmmBatchedHostPtrs<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                     hipblasSideMode_t                 side,
+                                                     hipblasFillMode_t                 uplo,
+                                                     hipblasOperation_t                transA,
+                                                     hipblasDiagType_t                 diag,
+                                                     int                               m,
+                                                     int                               n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     int                               lda,
+                                                     hipblasDoubleComplex* const       B[],
+                                                     int                               ldb,
+                                                     int                               batchCount)
+{
+    return hipblasZtrmmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batchCount);
+}
+
 // trmm_strided_batched
 template <>
 hipblasStatus_t hipblasTrmmStridedBatched<float>(hipblasHandle_t    handle,
@@ -9075,6 +11300,84 @@ hipblasStatus_t hipblasTrsmBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
 }
 
+// trsm_batched_host_ptrs
+template <>
+hipblasStatus_t hipblasTrsmBatchedHostPtrs<float>(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  float* const       A[],
+                                                  int                lda,
+                                                  float*             B[],
+                                                  int                ldb,
+                                                  int                batch_count)
+{
+    return hipblasStrsmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmBatchedHostPtrs<double>(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                m,
+                                                   int                n,
+                                                   const double*      alpha,
+                                                   double* const      A[],
+                                                   int                lda,
+                                                   double*            B[],
+                                                   int                ldb,
+                                                   int                batch_count)
+{
+    return hipblasDtrsmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmBatchedHostPtrs<hipblasComplex>(hipblasHandle_t       handle,
+                                                           hipblasSideMode_t     side,
+                                                           hipblasFillMode_t     uplo,
+                                                           hipblasOperation_t    transA,
+                                                           hipblasDiagType_t     diag,
+                                                           int                   m,
+                                                           int                   n,
+                                                           const hipblasComplex* alpha,
+                                                           hipblasComplex* const A[],
+                                                           int                   lda,
+                                                           hipblasComplex*       B[],
+                                                           int                   ldb,
+                                                           int                   batch_count)
+{
+    return hipblasCtrsmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTrsmBatchedHostPtrs<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     hipblasDoubleComplex* const A[],
+                                                     int                         lda,
+                                                     hipblasDoubleComplex*       B[],
+                                                     int                         ldb,
+                                                     int                         batch_count)
+{
+    return hipblasZtrsmBatchedHostPtrs(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
 // trsm_strided_batched
 template <>
 hipblasStatus_t hipblasTrsmStridedBatched<float>(hipblasHandle_t    handle,
@@ -9366,6 +11669,88 @@ hipblasStatus_t hipblasGeamBatched(hipblasHandle_t                   handle,
         handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
 }
 
+// geam_batched_host_ptrs
+template <>
+hipblasStatus_t hipblasGeamBatchedHostPtrs<float>(hipblasHandle_t    handle,
+                                                  hipblasOperation_t transa,
+                                                  hipblasOperation_t transb,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float* const A[],
+                                                  int                lda,
+                                                  const float*       beta,
+                                                  const float* const B[],
+                                                  int                ldb,
+                                                  float* const       C[],
+                                                  int                ldc,
+                                                  int                batchCount)
+{
+    return hipblasSgeamBatchedHostPtrs(
+        handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamBatchedHostPtrs<double>(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transa,
+                                                   hipblasOperation_t  transb,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double*       beta,
+                                                   const double* const B[],
+                                                   int                 ldb,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batchCount)
+{
+    return hipblasDgeamBatchedHostPtrs(
+        handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamBatchedHostPtrs<hipblasComplex>(hipblasHandle_t             handle,
+                                                           hipblasOperation_t          transa,
+                                                           hipblasOperation_t          transb,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex*       beta,
+                                                           const hipblasComplex* const B[],
+                                                           int                         ldb,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount)
+{
+    return hipblasCgeamBatchedHostPtrs(
+        handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGeamBatchedHostPtrs<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                     hipblasOperation_t                transa,
+                                                     hipblasOperation_t                transb,
+                                                     int                               m,
+                                                     int                               n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     int                               lda,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     const hipblasDoubleComplex* const B[],
+                                                     int                               ldb,
+                                                     hipblasDoubleComplex* const       C[],
+                                                     int                               ldc,
+                                                     int                               batchCount)
+{
+    return hipblasZgeamBatchedHostPtrs(
+        handle, transa, transb, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
 // geam_strided_batched
 template <>
 hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t    handle,
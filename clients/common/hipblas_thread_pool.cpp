@@ -0,0 +1,299 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_thread_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* ============================================================================================ */
+/*  Thread control of the host BLAS. The symbols are weak, so whichever of OpenBLAS, BLIS or the
+    OpenMP runtime is linked in is used and the others are skipped.  */
+
+#ifndef WIN32
+extern "C" {
+void openblas_set_num_threads(int) __attribute__((weak));
+int  openblas_get_num_threads() __attribute__((weak));
+void bli_thread_set_num_threads(long) __attribute__((weak));
+long bli_thread_get_num_threads() __attribute__((weak));
+void omp_set_num_threads(int) __attribute__((weak));
+int  omp_get_max_threads() __attribute__((weak));
+}
+#endif
+
+namespace
+{
+    // Limits the host BLAS to a single thread for the lifetime of the object
+    class single_threaded_blas
+    {
+        int  m_openblas = 0;
+        long m_blis     = 0;
+        int  m_omp      = 0;
+
+    public:
+        single_threaded_blas()
+        {
+#ifndef WIN32
+            if(openblas_set_num_threads && openblas_get_num_threads)
+            {
+                m_openblas = openblas_get_num_threads();
+                openblas_set_num_threads(1);
+            }
+            if(bli_thread_set_num_threads && bli_thread_get_num_threads)
+            {
+                m_blis = bli_thread_get_num_threads();
+                bli_thread_set_num_threads(1);
+            }
+            if(omp_set_num_threads && omp_get_max_threads)
+            {
+                m_omp = omp_get_max_threads();
+                omp_set_num_threads(1);
+            }
+#endif
+        }
+
+        ~single_threaded_blas()
+        {
+#ifndef WIN32
+            if(m_openblas > 0)
+                openblas_set_num_threads(m_openblas);
+            if(m_blis > 0)
+                bli_thread_set_num_threads(m_blis);
+            if(m_omp > 0)
+                omp_set_num_threads(m_omp);
+#endif
+        }
+    };
+
+    // Part of the iteration space owned by one participant
+    struct work_range
+    {
+        std::mutex mutex;
+        size_t     begin = 0;
+        size_t     end   = 0;
+    };
+
+    thread_local bool t_in_parallel_loop = false;
+
+    class thread_pool
+    {
+        std::vector<std::thread> m_workers;
+        std::mutex               m_busy; // one parallel loop at a time
+        std::mutex               m_mutex;
+        std::condition_variable  m_wake;
+        std::condition_variable  m_done;
+        size_t                   m_generation = 0;
+        size_t                   m_finished   = 0; // workers done with the current loop
+        bool                     m_stop       = false;
+
+        // current loop
+        const std::function<void(size_t)>* m_body  = nullptr;
+        size_t                             m_grain = 1;
+        std::unique_ptr<work_range[]>      m_ranges;
+        size_t                             m_participants = 0;
+        std::exception_ptr                 m_error;
+        std::atomic<bool>                  m_failed{false};
+
+        // Take the next chunk of participant p, stealing from the others when its range is empty
+        bool next_chunk(size_t p, size_t& begin, size_t& end)
+        {
+            work_range& own = m_ranges[p];
+            {
+                std::lock_guard<std::mutex> lock(own.mutex);
+                if(own.begin < own.end)
+                {
+                    begin     = own.begin;
+                    end       = std::min(own.end, own.begin + m_grain);
+                    own.begin = end;
+                    return true;
+                }
+            }
+
+            while(true)
+            {
+                // victim: the participant with the most work left
+                size_t victim = m_participants, most = 0;
+                for(size_t v = 0; v < m_participants; v++)
+                {
+                    if(v == p)
+                        continue;
+                    std::lock_guard<std::mutex> lock(m_ranges[v].mutex);
+                    size_t                      left = m_ranges[v].end - m_ranges[v].begin;
+                    if(left > most)
+                    {
+                        most   = left;
+                        victim = v;
+                    }
+                }
+                if(victim == m_participants)
+                    return false;
+
+                size_t steal_begin, steal_end;
+                {
+                    work_range&                 from = m_ranges[victim];
+                    std::lock_guard<std::mutex> lock(from.mutex);
+                    size_t                      left = from.end - from.begin;
+                    if(!left)
+                        continue; // drained in the meantime, look again
+                    steal_end   = from.end;
+                    steal_begin = from.end - std::max(left / 2, std::min(left, m_grain));
+                    from.end    = steal_begin;
+                }
+
+                std::lock_guard<std::mutex> lock(own.mutex);
+                begin     = steal_begin;
+                end       = std::min(steal_end, steal_begin + m_grain);
+                own.begin = end;
+                own.end   = steal_end;
+                return true;
+            }
+        }
+
+        void run(size_t p)
+        {
+            size_t begin, end;
+            while(next_chunk(p, begin, end))
+            {
+                if(m_failed.load(std::memory_order_relaxed))
+                    continue; // drain the remaining indices without running them
+                try
+                {
+                    for(size_t i = begin; i < end; i++)
+                        (*m_body)(i);
+                }
+                catch(...)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if(!m_error)
+                        m_error = std::current_exception();
+                    m_failed = true;
+                }
+            }
+        }
+
+        void worker(size_t p)
+        {
+            t_in_parallel_loop = true;
+#ifndef WIN32
+            if(omp_set_num_threads)
+                omp_set_num_threads(1);
+#endif
+            size_t seen = 0;
+            while(true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+                    if(m_stop)
+                        return;
+                    seen = m_generation;
+                    if(p >= m_participants)
+                        continue;
+                }
+
+                run(p);
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(++m_finished == m_participants - 1)
+                    m_done.notify_all();
+            }
+        }
+
+    public:
+        thread_pool()
+        {
+            size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+            if(const char* env = getenv("HIPBLAS_CLIENT_THREADS"))
+                threads = std::max(atoi(env), 1);
+
+            // participant 0 is the calling thread
+            for(size_t p = 1; p < threads; p++)
+                m_workers.emplace_back([this, p] { worker(p); });
+        }
+
+        ~thread_pool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for(auto& w : m_workers)
+                w.join();
+        }
+
+        size_t size() const
+        {
+            return m_workers.size() + 1;
+        }
+
+        void parallel_for(size_t n, const std::function<void(size_t)>& body, size_t grain)
+        {
+            grain = std::max(grain, size_t(1));
+
+            std::unique_lock<std::mutex> busy(m_busy, std::try_to_lock);
+            if(n < 2 || size() < 2 || t_in_parallel_loop || !busy.owns_lock())
+            {
+                for(size_t i = 0; i < n; i++)
+                    body(i);
+                return;
+            }
+
+            single_threaded_blas blas_guard;
+
+            size_t participants = std::min(size(), (n + grain - 1) / grain);
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_body         = &body;
+                m_grain        = grain;
+                m_participants = participants;
+                m_finished     = 0;
+                m_error        = nullptr;
+                m_failed       = false;
+                m_ranges.reset(new work_range[participants]);
+                for(size_t p = 0; p < participants; p++)
+                {
+                    m_ranges[p].begin = n * p / participants;
+                    m_ranges[p].end   = n * (p + 1) / participants;
+                }
+                m_generation++;
+            }
+            m_wake.notify_all();
+
+            t_in_parallel_loop = true;
+            run(0);
+            t_in_parallel_loop = false;
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_done.wait(lock, [&] { return m_finished == participants - 1; });
+            m_body = nullptr;
+            if(m_error)
+                std::rethrow_exception(m_error);
+        }
+    };
+
+    thread_pool& pool()
+    {
+        static thread_pool p;
+        return p;
+    }
+}
+
+void hipblas_parallel_for(size_t n, const std::function<void(size_t)>& body, size_t grain)
+{
+    pool().parallel_for(n, body, grain);
+}
+
+size_t hipblas_thread_pool_size()
+{
+    return pool().size();
+}
@@ -6,47 +6,35 @@
 #include "norm.h"
 #include "cblas.h"
 #include "hipblas.h"
+#include "hipblas_compare.hpp"
 #include <stdio.h>
 
 /* =====================================================================
      README: Norm check: norm(A-B)/norm(A), evaluate relative error
              Numerically, it is recommended by lapack.
 
-    Call lapack fortran routines that do not exsit in cblas library.
+    The general norms are computed in double by hipblas_compare, which reads both matrices once
+    and modifies neither, so a norm check may be followed by any other check of the same data.
+
+    The symmetric norms call lapack fortran routines that do not exsit in cblas library.
     No special header is required. But need to declare
     function prototype
 
     All the functions are fortran and should append underscore (_) while declaring prototype and
    calling.
-    xlange and xaxpy prototype are like following
+    xlansy prototype is like following
     =================================================================== */
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-float  slange_(char* norm_type, int* m, int* n, float* A, int* lda, float* work);
-double dlange_(char* norm_type, int* m, int* n, double* A, int* lda, double* work);
-float  clange_(char* norm_type, int* m, int* n, hipblasComplex* A, int* lda, float* work);
-double zlange_(char* norm_type, int* m, int* n, hipblasDoubleComplex* A, int* lda, double* work);
-
 float  slansy_(char* norm_type, char* uplo, int* n, float* A, int* lda, float* work);
 double dlansy_(char* norm_type, char* uplo, int* n, double* A, int* lda, double* work);
 //  float  clanhe_(char* norm_type, char* uplo, int* n, hipblasComplex* A, int* lda, float* work);
 //  double zlanhe_(char* norm_type, char* uplo, int* n, hipblasDoubleComplex* A, int* lda, double*
 //  work);
 
-void saxpy_(int* n, float* alpha, float* x, int* incx, float* y, int* incy);
-void daxpy_(int* n, double* alpha, double* x, int* incx, double* y, int* incy);
-void caxpy_(
-    int* n, hipblasComplex* alpha, hipblasComplex* x, int* incx, hipblasComplex* y, int* incy);
-void zaxpy_(int*                  n,
-            hipblasDoubleComplex* alpha,
-            hipblasDoubleComplex* x,
-            int*                  incx,
-            hipblasDoubleComplex* y,
-            int*                  incy);
-
 #ifdef __cplusplus
 }
 #endif
@@ -54,142 +42,120 @@ void zaxpy_(int*                  n,
 /* ============================Norm Check for General Matrix: float/double/complex template
  * speciliazation ======================================= */
 
-/*! \brief compare the norm error of two matrices hCPU & hGPU */
-template <>
-double norm_check_general<float>(char norm_type, int M, int N, int lda, float* hCPU, float* hGPU)
+namespace
 {
-    // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
+    // 'O' (max column sum) and 'I' (max row sum) of ref and of ref - test, in double
+    template <typename T>
+    double norm_one_inf_error(char norm_type, int M, int N, int lda, const T* hCPU, const T* hGPU)
+    {
+        using traits = hipblas_compare_traits<T>;
 
-    float work;
-    int   incx  = 1;
-    float alpha = -1.0f;
-    int   size  = lda * N;
+        auto abs_of = [](double re, double im) { return std::hypot(re, im); };
+        auto part   = [](const T& x, int p) { return p < traits::parts ? traits::part(x, p) : 0; };
 
-    float cpu_norm = slange_(&norm_type, &M, &N, hCPU, &lda, &work);
-    saxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
+        bool                one = norm_type == 'O' || norm_type == 'o' || norm_type == '1';
+        std::vector<double> ref_sum(one ? 1 : M), diff_sum(one ? 1 : M);
+        double              ref_norm = 0, diff_norm = 0;
 
-    float error = slange_(&norm_type, &M, &N, hGPU, &lda, &work) / cpu_norm;
+        for(int j = 0; j < N; j++)
+        {
+            if(one)
+                ref_sum[0] = diff_sum[0] = 0;
+            for(int i = 0; i < M; i++)
+            {
+                const T& a = hCPU[i + size_t(j) * lda];
+                const T& b = hGPU[i + size_t(j) * lda];
+                ref_sum[one ? 0 : i] += abs_of(part(a, 0), part(a, 1));
+                diff_sum[one ? 0 : i] += abs_of(part(a, 0) - part(b, 0), part(a, 1) - part(b, 1));
+            }
+            if(one)
+            {
+                ref_norm  = std::max(ref_norm, ref_sum[0]);
+                diff_norm = std::max(diff_norm, diff_sum[0]);
+            }
+        }
+        if(!one)
+            for(int i = 0; i < M; i++)
+            {
+                ref_norm  = std::max(ref_norm, ref_sum[i]);
+                diff_norm = std::max(diff_norm, diff_sum[i]);
+            }
+
+        return diff_norm / ref_norm;
+    }
 
-    return (double)error;
+    template <typename T>
+    double norm_error(char norm_type, int M, int N, int lda, const T* hCPU, const T* hGPU)
+    {
+        // norm type can be 'M', 'O', 'I', 'F': 'F' (Frobenius norm) is used mostly
+        switch(norm_type)
+        {
+        case 'F':
+        case 'f':
+        case 'E':
+        case 'e':
+        {
+            auto r = hipblas_compare(M, N, lda, hCPU, hGPU);
+            return r.diff_frobenius / r.ref_frobenius;
+        }
+        case 'M':
+        case 'm':
+        {
+            auto r = hipblas_compare(M, N, lda, hCPU, hGPU);
+            return r.diff_max_abs / r.ref_max_abs;
+        }
+        default:
+            return norm_one_inf_error(norm_type, M, N, lda, hCPU, hGPU);
+        }
+    }
 }
 
+/*! \brief compare the norm error of two matrices hCPU & hGPU */
 template <>
-double norm_check_general<double>(char norm_type, int M, int N, int lda, double* hCPU, double* hGPU)
+double norm_check_general<float>(char norm_type, int M, int N, int lda, float* hCPU, float* hGPU)
 {
-    // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    double work[1];
-    int    incx  = 1;
-    double alpha = -1.0;
-    int    size  = lda * N;
-
-    double cpu_norm = dlange_(&norm_type, &M, &N, hCPU, &lda, work);
-    daxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    double error = dlange_(&norm_type, &M, &N, hGPU, &lda, work) / cpu_norm;
+    return norm_error(norm_type, M, N, lda, hCPU, hGPU);
+}
 
-    return error;
+template <>
+double norm_check_general<double>(char norm_type, int M, int N, int lda, double* hCPU, double* hGPU)
+{
+    return norm_error(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_general<hipblasComplex>(
     char norm_type, int M, int N, int lda, hipblasComplex* hCPU, hipblasComplex* hGPU)
 {
-    //norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    float          work[1];
-    int            incx  = 1;
-    hipblasComplex alpha = -1.0f;
-    int            size  = lda * N;
-
-    float cpu_norm = clange_(&norm_type, &M, &N, hCPU, &lda, work);
-    caxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    float error = clange_(&norm_type, &M, &N, hGPU, &lda, work) / cpu_norm;
-
-    return (double)error;
+    return norm_error(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_general<hipblasDoubleComplex>(
     char norm_type, int M, int N, int lda, hipblasDoubleComplex* hCPU, hipblasDoubleComplex* hGPU)
 {
-    //norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    double               work[1];
-    int                  incx  = 1;
-    hipblasDoubleComplex alpha = -1.0;
-    int                  size  = lda * N;
-
-    double cpu_norm = zlange_(&norm_type, &M, &N, hCPU, &lda, work);
-    zaxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    double error = zlange_(&norm_type, &M, &N, hGPU, &lda, work) / cpu_norm;
-
-    return error;
+    return norm_error(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_general<hipblasHalf>(
     char norm_type, int M, int N, int lda, hipblasHalf* hCPU, hipblasHalf* hGPU)
 {
-    // norm type can be 'M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    host_vector<double> hCPU_double(N * lda);
-    host_vector<double> hGPU_double(N * lda);
-
-    for(int i = 0; i < M; i++)
-    {
-        for(int j = 0; j < N; j++)
-        {
-            hCPU_double[i + j * lda] = hCPU[i + j * lda];
-            hGPU_double[i + j * lda] = hGPU[i + j * lda];
-        }
-    }
-
-    return norm_check_general<double>(norm_type, M, N, lda, hCPU_double, hGPU_double);
+    return norm_error(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_general<hipblasBfloat16>(
     char norm_type, int M, int N, int lda, hipblasBfloat16* hCPU, hipblasBfloat16* hGPU)
 {
-    // norm type can be 'M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    host_vector<float> hCPU_double(N * lda);
-    host_vector<float> hGPU_double(N * lda);
-
-    for(int i = 0; i < M; i++)
-    {
-        for(int j = 0; j < N; j++)
-        {
-            hCPU_double[i + j * lda] = bfloat16_to_float(hCPU[i + j * lda]);
-            hGPU_double[i + j * lda] = bfloat16_to_float(hGPU[i + j * lda]);
-        }
-    }
-
-    return norm_check_general<float>(norm_type, M, N, lda, hCPU_double, hGPU_double);
+    return norm_error(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double
     norm_check_general<int32_t>(char norm_type, int M, int N, int lda, int32_t* hCPU, int32_t* hGPU)
 {
-    // norm type can be 'M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    host_vector<float> hCPU_float(N * lda);
-    host_vector<float> hGPU_float(N * lda);
-
-    for(int i = 0; i < M; i++)
-    {
-        for(int j = 0; j < N; j++)
-        {
-            hCPU_float[i + j * lda] = (hCPU[i + j * lda]);
-            hGPU_float[i + j * lda] = (hGPU[i + j * lda]);
-        }
-    }
-
-    return norm_check_general<float>(norm_type, M, N, lda, hCPU_float, hGPU_float);
+    return norm_error(norm_type, M, N, lda, hCPU, hGPU);
 }
 
 /* ============================Norm Check for Symmetric Matrix: float/double/complex template
@@ -204,14 +170,14 @@ double
     // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
 
     float work[1];
-    int   incx  = 1;
-    float alpha = -1.0f;
-    int   size  = lda * N;
 
-    float cpu_norm = slansy_(&norm_type, &uplo, &N, hCPU, &lda, work);
-    saxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
+    // the difference goes to a copy, so hGPU is left as it is
+    host_vector<float> diff(size_t(lda) * N);
+    for(size_t i = 0; i < diff.size(); i++)
+        diff[i] = hGPU[i] - hCPU[i];
 
-    float error = slansy_(&norm_type, &uplo, &N, hGPU, &lda, work) / cpu_norm;
+    float cpu_norm = slansy_(&norm_type, &uplo, &N, hCPU, &lda, work);
+    float error    = slansy_(&norm_type, &uplo, &N, diff, &lda, work) / cpu_norm;
 
     return (double)error;
 }
@@ -223,14 +189,13 @@ double norm_check_symmetric<double>(
     // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
 
     double work[1];
-    int    incx  = 1;
-    double alpha = -1.0;
-    int    size  = lda * N;
 
-    double cpu_norm = dlansy_(&norm_type, &uplo, &N, hCPU, &lda, work);
-    daxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
+    host_vector<double> diff(size_t(lda) * N);
+    for(size_t i = 0; i < diff.size(); i++)
+        diff[i] = hGPU[i] - hCPU[i];
 
-    double error = dlansy_(&norm_type, &uplo, &N, hGPU, &lda, work) / cpu_norm;
+    double cpu_norm = dlansy_(&norm_type, &uplo, &N, hCPU, &lda, work);
+    double error    = dlansy_(&norm_type, &uplo, &N, diff, &lda, work) / cpu_norm;
 
     return error;
 }
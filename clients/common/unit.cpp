@@ -1,10 +1,11 @@
 /* ************************************************************************
- * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ * Copyright 2016-2021 Advanced Micro Devices, Inc.
  *
  * ************************************************************************ */
 
 #include "unit.h"
 #include "hipblas.h"
+#include "hipblas_compare.hpp"
 #include "hipblas_vector.hpp"
 #include "utility.h"
 
@@ -21,37 +22,43 @@
 
 #else // GOOGLE_TEST
 
-#define UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, UNIT_ASSERT_EQ)      \
-    do                                                                               \
-    {                                                                                \
-        for(size_t k = 0; k < batch_count; k++)                                      \
-            for(size_t j = 0; j < N; j++)                                            \
-                for(size_t i = 0; i < M; i++)                                        \
-                    if(hipblas_isnan(hCPU[i + j * lda + k * strideA]))               \
-                    {                                                                \
-                        ASSERT_TRUE(hipblas_isnan(hGPU[i + j * lda + k * strideA])); \
-                    }                                                                \
-                    else                                                             \
-                    {                                                                \
-                        UNIT_ASSERT_EQ(hCPU[i + j * lda + k * strideA],              \
-                                       hGPU[i + j * lda + k * strideA]);             \
-                    }                                                                \
+// The matrices are compared in one parallel pass by hipblas_compare; on a mismatch the assertion
+// is repeated on the first mismatching element, so the failure reads as before, with the
+// statistics of the whole comparison attached.
+#define UNIT_CHECK_FIRST(result, cpu, gpu, UNIT_ASSERT_EQ)                 \
+    do                                                                     \
+    {                                                                      \
+        if(!(result).equal())                                              \
+        {                                                                  \
+            SCOPED_TRACE((result).str());                                  \
+            if(hipblas_isnan(cpu))                                         \
+            {                                                              \
+                ASSERT_TRUE(hipblas_isnan(gpu));                           \
+            }                                                              \
+            else                                                           \
+            {                                                              \
+                UNIT_ASSERT_EQ(cpu, gpu);                                  \
+            }                                                              \
+            FAIL() << "elements differ by " << (result).max_ulp << " ulp"; \
+        }                                                                  \
     } while(0)
 
-#define UNIT_CHECK_B(M, N, batch_count, lda, hCPU, hGPU, UNIT_ASSERT_EQ)            \
-    do                                                                              \
-    {                                                                               \
-        for(size_t k = 0; k < batch_count; k++)                                     \
-            for(size_t j = 0; j < N; j++)                                           \
-                for(size_t i = 0; i < M; i++)                                       \
-                    if(hipblas_isnan(hCPU[k][i + j * lda]))                         \
-                    {                                                               \
-                        ASSERT_TRUE(hipblas_isnan(hGPU[k][i + j * lda]));           \
-                    }                                                               \
-                    else                                                            \
-                    {                                                               \
-                        UNIT_ASSERT_EQ(hCPU[k][i + j * lda], hGPU[k][i + j * lda]); \
-                    }                                                               \
+#define UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, UNIT_ASSERT_EQ)                  \
+    do                                                                                           \
+    {                                                                                            \
+        auto result                                                                              \
+            = hipblas_compare_strided_batched(M, N, lda, strideA, hCPU, hGPU, batch_count);      \
+        size_t first = result.first_row + result.first_col * lda + result.first_batch * strideA; \
+        UNIT_CHECK_FIRST(result, hCPU[first], hGPU[first], UNIT_ASSERT_EQ);                      \
+    } while(0)
+
+#define UNIT_CHECK_B(M, N, batch_count, lda, hCPU, hGPU, UNIT_ASSERT_EQ)                  \
+    do                                                                                    \
+    {                                                                                     \
+        auto   result = hipblas_compare_batched(M, N, lda, hCPU, hGPU, batch_count);      \
+        auto   batch  = result.first_batch;                                               \
+        size_t first  = result.first_row + result.first_col * lda;                        \
+        UNIT_CHECK_FIRST(result, hCPU[batch][first], hGPU[batch][first], UNIT_ASSERT_EQ); \
     } while(0)
 
 #endif // GOOGLE_TEST
@@ -100,28 +107,14 @@ void unit_check_general(int M, int N, int lda, double* hCPU, double* hGPU)
 template <>
 void unit_check_general(int M, int N, int lda, hipblasComplex* hCPU, hipblasComplex* hGPU)
 {
-#ifdef GOOGLE_TEST
-    for(int j = 0; j < N; j++)
-        for(int i = 0; i < M; i++)
-        {
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].real(), hGPU[i + j * lda].real());
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].imag(), hGPU[i + j * lda].imag());
-        }
-#endif
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_FLOAT_COMPLEX_EQ);
 }
 
 template <>
 void unit_check_general(
     int M, int N, int lda, hipblasDoubleComplex* hCPU, hipblasDoubleComplex* hGPU)
 {
-#ifdef GOOGLE_TEST
-    for(int j = 0; j < N; j++)
-        for(int i = 0; i < M; i++)
-        {
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].real(), hGPU[i + j * lda].real());
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].imag(), hGPU[i + j * lda].imag());
-        }
-#endif
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_DOUBLE_COMPLEX_EQ);
 }
 
 template <>
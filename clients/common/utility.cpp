@@ -125,8 +125,28 @@ hipblasLocalHandle::hipblasLocalHandle()
 }
 
 hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
-    : hipblasLocalHandle()
 {
+    // hipblas-bench concurrency mode may hand every thread the same handle
+    const hipblas_bench_thread_context& ctx = hipblas_bench_context();
+    if(ctx.handle)
+    {
+        m_handle = ctx.handle;
+        m_owned  = false;
+    }
+    else
+    {
+        auto status = hipblasCreate(&m_handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
+    }
+
+    if(ctx.stream)
+    {
+        auto status = hipblasSetStream(m_handle, ctx.stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error(hipblasStatusToString(status));
+    }
+
     // for future customization of handle based on arguments, example from rocblas below
 
     /*
@@ -152,7 +172,14 @@ hipblasLocalHandle::~hipblasLocalHandle()
 {
     if(m_memory)
         (hipFree)(m_memory);
-    hipblasDestroy(m_handle);
+    if(m_owned)
+        hipblasDestroy(m_handle);
+}
+
+hipblas_bench_thread_context& hipblas_bench_context()
+{
+    static thread_local hipblas_bench_thread_context ctx;
+    return ctx;
 }
 
 #ifdef __cplusplus
@@ -178,16 +205,45 @@ double get_time_us(void)
 /*! \brief  CPU Timer(in microsecond): synchronize with given queue/stream and return wall time */
 double get_time_us_sync(hipStream_t stream)
 {
+    auto& ctx = hipblas_bench_context();
+    if(ctx.on_call_mark)
+        ctx.on_call_mark(stream);
+
     hipStreamSynchronize(stream);
 
+    if(ctx.on_timing_start)
+    {
+        auto hook           = std::move(ctx.on_timing_start);
+        ctx.on_timing_start = nullptr;
+        hook();
+    }
+
     auto now = std::chrono::steady_clock::now();
     // now.time_since_epoch() is the dureation since epogh
     // which is converted to microseconds
     auto duration
         = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
-    return (static_cast<double>(duration));
+    double time_us = static_cast<double>(duration) - ctx.sample_us;
+
+    // The sample runs after the timestamp; its duration is taken out of the later timestamps,
+    // so it is not counted in an interval starting here either
+    if(ctx.on_time_sample)
+    {
+        ctx.on_time_sample();
+        ctx.sample_us += std::chrono::duration<double, std::micro>(
+                             std::chrono::steady_clock::now() - now)
+                             .count();
+    }
+    return time_us;
 };
 
+void hipblas_bench_mark_call(hipStream_t stream)
+{
+    auto& ctx = hipblas_bench_context();
+    if(ctx.on_call_mark)
+        ctx.on_call_mark(stream);
+}
+
 /* ============================================================================================ */
 /*  device query and print out their ID and name; return number of compute-capable devices. */
 int query_device_property()
@@ -29,4 +29,64 @@ namespace
         EXPECT_EQ(testing_handle(), HIPBLAS_STATUS_SUCCESS);
     }
 
+    // Independent axpys rotated over the lanes of a handle, joined back onto its stream
+    TEST(hipblas_auxiliary, streamPool)
+    {
+        const int n = 64, lanes = 3, calls = 8;
+        float     alpha = 2.0f;
+
+        hipblasLocalHandle   handle;
+        hipStream_t          user_stream, stream;
+        int                  size;
+        host_vector<float>   hx(n), hy(n * calls), hy_gold(n * calls);
+        device_vector<float> dx(n), dy(n * calls);
+
+        for(int i = 0; i < n; i++)
+            hx[i] = float(i);
+        for(int i = 0; i < n * calls; i++)
+        {
+            hy[i]      = float(i % 7);
+            hy_gold[i] = hy[i] + alpha * hx[i % n];
+        }
+        ASSERT_EQ(hipSuccess, hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+        ASSERT_EQ(hipSuccess,
+                  hipMemcpy(dy, hy.data(), sizeof(float) * n * calls, hipMemcpyHostToDevice));
+
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetStream(handle, &user_stream));
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetStreamPool(handle, &size));
+        EXPECT_EQ(0, size);
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, hipblasSetStreamLane(handle, 0));
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetStreamPool(handle, lanes));
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetStreamPool(handle, &size));
+        EXPECT_EQ(lanes, size);
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, hipblasSetStreamLane(handle, lanes));
+
+        for(int c = 0; c < calls; c++)
+        {
+            ASSERT_EQ(HIPBLAS_STATUS_SUCCESS,
+                      hipblasSetStreamLane(handle, HIPBLAS_STREAM_LANE_NEXT));
+            ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetStream(handle, &stream));
+            EXPECT_NE(user_stream, stream);
+            ASSERT_EQ(HIPBLAS_STATUS_SUCCESS,
+                      hipblasSaxpy(handle, n, &alpha, dx, 1, dy + c * n, 1));
+        }
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasJoinStreams(handle));
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetStream(handle, &stream));
+        EXPECT_EQ(user_stream, stream);
+
+        // the copy on the user stream follows the axpys of every lane
+        ASSERT_EQ(hipSuccess,
+                  hipMemcpyAsync(hy.data(),
+                                 dy,
+                                 sizeof(float) * n * calls,
+                                 hipMemcpyDeviceToHost,
+                                 user_stream));
+        ASSERT_EQ(hipSuccess, hipStreamSynchronize(user_stream));
+        unit_check_general<float>(1, n * calls, 1, hy_gold.data(), hy.data());
+
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetStreamPool(handle, 0));
+        ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetStreamPool(handle, &size));
+        EXPECT_EQ(0, size);
+    }
+
 } // namespace
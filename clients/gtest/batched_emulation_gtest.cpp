@@ -0,0 +1,419 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "batched_emulation.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+/* =====================================================================
+     The stream and memory bookkeeping of the batched emulation, run against a host stand-in
+     for the GPU runtime: "device" memory is host memory and the work queued on any stream runs
+     in the order it was queued, which respects every event, when a stream is synchronized.
+=================================================================== */
+
+struct hipblas_host_backend
+{
+    using stream_t = int;
+    using event_t  = int;
+
+    static std::vector<std::function<void()>> work; // queued, not yet run
+    static std::vector<std::string>           log; // records and waits of events
+    static std::map<hipblasHandle_t, int>     handle_streams;
+    static int                                streams, events, host_buffers; // alive
+    static int                                last_id; // of streams and events, from 1
+
+    static void run_queued()
+    {
+        for(size_t w = 0; w < work.size(); w++)
+            work[w]();
+        work.clear();
+    }
+
+    static hipblasStatus_t get_stream(hipblasHandle_t handle, stream_t* stream)
+    {
+        *stream = handle_streams[handle];
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t set_stream(hipblasHandle_t handle, stream_t stream)
+    {
+        handle_streams[handle] = stream;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t create_stream(stream_t* stream)
+    {
+        *stream = ++last_id;
+        streams++;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t destroy_stream(stream_t)
+    {
+        streams--;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t create_event(event_t* event)
+    {
+        *event = ++last_id;
+        events++;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t destroy_event(event_t)
+    {
+        events--;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t record_event(event_t event, stream_t stream)
+    {
+        log.push_back("record " + std::to_string(event) + " on " + std::to_string(stream));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t wait_event(stream_t stream, event_t event)
+    {
+        log.push_back("wait " + std::to_string(stream) + " for " + std::to_string(event));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t synchronize(stream_t)
+    {
+        run_queued();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t device_malloc(void** ptr, size_t bytes)
+    {
+        *ptr = malloc(bytes);
+        return *ptr ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    static hipblasStatus_t device_free(void* ptr)
+    {
+        free(ptr);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t copy_to_host(void* dst, const void* src, size_t bytes, stream_t)
+    {
+        run_queued();
+        memcpy(dst, src, bytes);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t copy_to_device(void* dst, const void* src, size_t bytes, stream_t)
+    {
+        std::vector<char> source((const char*)src, (const char*)src + bytes);
+        work.push_back([=] { memcpy(dst, source.data(), bytes); });
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t host_malloc(void** ptr, size_t bytes)
+    {
+        *ptr = malloc(bytes);
+        host_buffers++;
+        return *ptr ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    static hipblasStatus_t host_free(void* ptr)
+    {
+        free(ptr);
+        host_buffers--;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t copy_to_host_async(void* dst, const void* src, size_t bytes, stream_t)
+    {
+        work.push_back([=] { memcpy(dst, src, bytes); });
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    static hipblasStatus_t launch_host_func(stream_t, void (*fn)(void*), void* data)
+    {
+        work.push_back([=] { fn(data); });
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+};
+
+std::vector<std::function<void()>> hipblas_host_backend::work;
+std::vector<std::string>           hipblas_host_backend::log;
+std::map<hipblasHandle_t, int>     hipblas_host_backend::handle_streams;
+int                                hipblas_host_backend::streams      = 0;
+int                                hipblas_host_backend::events       = 0;
+int                                hipblas_host_backend::host_buffers = 0;
+int                                hipblas_host_backend::last_id      = 0;
+
+using host_emulation = hipblas_batched_emulation<hipblas_host_backend>;
+
+// A batched solver writing values to the device array info, in stream order
+static hipblasStatus_t host_solve(hipblasHandle_t handle, int* info, std::vector<int> values)
+{
+    return host_emulation::summarized(handle, info, int(values.size()), [=] {
+        hipblas_host_backend::work.push_back(
+            [=] { std::copy(values.begin(), values.end(), info); });
+        return HIPBLAS_STATUS_SUCCESS;
+    });
+}
+
+// The summary counts the nonzero entries of every call in stream order, from copies of the info
+// arrays taken before the next solver writes them, and only once the streams run
+TEST(hipblas_batched_emulation, info_summary)
+{
+    int                         handle_id = 0;
+    hipblasHandle_t             handle    = &handle_id;
+    std::vector<int>            info(8, -1);
+    hipblasBatchedInfoSummary_t summary{7, 7, 7, 7, 7};
+
+    EXPECT_EQ(HIPBLAS_BATCHED_INFO_NONE, host_emulation::batched_info_mode(handle));
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_solve(handle, info.data(), {1, 1}));
+    EXPECT_EQ(0, hipblas_host_backend::host_buffers);
+    hipblas_host_backend::run_queued();
+
+    host_emulation::set_batched_info_mode(handle, HIPBLAS_BATCHED_INFO_SUMMARY);
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_solve(handle, info.data(), {0, 2, 0, 1, 0}));
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_solve(handle, info.data(), {0, 0, 0, 0, 0}));
+    host_emulation::read_summary_async(handle, &summary, true);
+
+    // nothing ran on the host yet
+    EXPECT_EQ(1, hipblas_host_backend::host_buffers);
+    EXPECT_EQ(7, summary.calls);
+
+    hipblas_host_backend::run_queued();
+    EXPECT_EQ(2, summary.calls);
+    EXPECT_EQ(2, summary.failures);
+    EXPECT_EQ(0, summary.first_call);
+    EXPECT_EQ(1, summary.first_index);
+    EXPECT_EQ(2, summary.first_info);
+
+    // the reset emptied the summary; a larger batch replaces the staging buffer once the scans
+    // queued before ran
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_solve(handle, info.data(), {0, 0, 0}));
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_solve(handle, info.data(), {0, 0, 0, 0, 0, 0, 0, 3}));
+    EXPECT_EQ(2u, hipblas_host_backend::work.size());
+    host_emulation::read_summary_async(handle, &summary, false);
+    hipblas_host_backend::run_queued();
+    EXPECT_EQ(2, summary.calls);
+    EXPECT_EQ(1, summary.failures);
+    EXPECT_EQ(1, summary.first_call);
+    EXPECT_EQ(7, summary.first_index);
+    EXPECT_EQ(3, summary.first_info);
+    EXPECT_EQ(1, hipblas_host_backend::host_buffers);
+
+    // the queued jobs cannot be replayed from a graph
+    host_emulation::set_capture_mode(handle, HIPBLAS_CAPTURE_MODE_SAFE);
+    EXPECT_THROW(host_solve(handle, info.data(), {0}), hipblasStatus_t);
+    EXPECT_THROW(host_emulation::read_summary_async(handle, &summary, false), hipblasStatus_t);
+    host_emulation::set_capture_mode(handle, HIPBLAS_CAPTURE_MODE_DEFAULT);
+    EXPECT_THROW(host_emulation::read_summary_async(handle, nullptr, false), hipblasStatus_t);
+
+    // the release waits for the jobs still queued, then frees the channel
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_solve(handle, info.data(), {4}));
+    host_emulation::read_summary_async(handle, &summary, false);
+    host_emulation::release(handle);
+    EXPECT_TRUE(hipblas_host_backend::work.empty());
+    EXPECT_EQ(3, summary.calls);
+    EXPECT_EQ(0, hipblas_host_backend::host_buffers);
+    EXPECT_EQ(0, hipblas_host_backend::streams);
+    EXPECT_EQ(0, hipblas_host_backend::events);
+}
+
+static int host_stream(hipblasHandle_t handle)
+{
+    int stream;
+    hipblas_host_backend::get_stream(handle, &stream);
+    return stream;
+}
+
+// A lane selected first since the last join waits for the user stream, the join makes the user
+// stream wait for every lane selected, and the handle issues on the user stream again after a
+// join, a new pool or its release
+TEST(hipblas_batched_emulation, stream_lanes)
+{
+    using log_t = std::vector<std::string>;
+
+    int             handle_id = 0;
+    hipblasHandle_t handle    = &handle_id;
+    log_t&          log       = hipblas_host_backend::log;
+
+    hipblas_host_backend::set_stream(handle, 100);
+    hipblas_host_backend::last_id = 0;
+    EXPECT_EQ(0, host_emulation::stream_pool_size(handle));
+    EXPECT_THROW(host_emulation::select_lane(handle, 0), hipblasStatus_t);
+    EXPECT_THROW(host_emulation::set_stream_pool(handle, -1), hipblasStatus_t);
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_emulation::join_lanes(handle));
+
+    // lanes 1 and 2, fork event 3, join events 4 and 5
+    host_emulation::set_stream_pool(handle, 2);
+    EXPECT_EQ(2, host_emulation::stream_pool_size(handle));
+    EXPECT_EQ(2, hipblas_host_backend::streams);
+    EXPECT_EQ(3, hipblas_host_backend::events);
+    EXPECT_THROW(host_emulation::select_lane(handle, 2), hipblasStatus_t);
+
+    log.clear();
+    host_emulation::select_lane(handle, HIPBLAS_STREAM_LANE_NEXT);
+    EXPECT_EQ(1, host_stream(handle));
+    host_emulation::select_lane(handle, HIPBLAS_STREAM_LANE_NEXT);
+    EXPECT_EQ(2, host_stream(handle));
+    host_emulation::select_lane(handle, 0);
+    EXPECT_EQ(1, host_stream(handle));
+    host_emulation::select_lane(handle, HIPBLAS_STREAM_LANE_NEXT);
+    EXPECT_EQ(2, host_stream(handle));
+    EXPECT_EQ((log_t{"record 3 on 100", "wait 1 for 3", "record 3 on 100", "wait 2 for 3"}), log);
+
+    log.clear();
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_emulation::join_lanes(handle));
+    EXPECT_EQ(100, host_stream(handle));
+    EXPECT_EQ((log_t{"record 4 on 1", "wait 100 for 4", "record 5 on 2", "wait 100 for 5"}), log);
+
+    // nothing to join; the rotation starts again at lane 0
+    log.clear();
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_emulation::join_lanes(handle));
+    EXPECT_TRUE(log.empty());
+    host_emulation::select_lane(handle, HIPBLAS_STREAM_LANE_NEXT);
+    EXPECT_EQ(1, host_stream(handle));
+
+    // a new pool joins the lanes of the old one first
+    log.clear();
+    host_emulation::set_stream_pool(handle, 1);
+    EXPECT_EQ(100, host_stream(handle));
+    EXPECT_EQ((log_t{"record 4 on 1", "wait 100 for 4"}), log);
+    EXPECT_EQ(1, hipblas_host_backend::streams);
+    EXPECT_EQ(2, hipblas_host_backend::events);
+
+    // and so does the release, before the streams are destroyed
+    host_emulation::select_lane(handle, 0);
+    EXPECT_EQ(6, host_stream(handle));
+    log.clear();
+    host_emulation::release(handle);
+    EXPECT_EQ(100, host_stream(handle));
+    EXPECT_EQ((log_t{"record 8 on 6", "wait 100 for 8"}), log);
+    EXPECT_EQ(0, hipblas_host_backend::streams);
+    EXPECT_EQ(0, hipblas_host_backend::events);
+}
+
+// The instances of a batch go round-robin to the pool streams, which wait for the user stream,
+// and the user stream waits for every pool stream used; a failing instance stops the batch, and
+// the handle is back on the user stream in any case
+TEST(hipblas_batched_emulation, run)
+{
+    using log_t = std::vector<std::string>;
+
+    int              handle_id = 0;
+    hipblasHandle_t  handle    = &handle_id;
+    log_t&           log       = hipblas_host_backend::log;
+    std::vector<int> issued; // stream of each call, in the order of the calls
+    std::vector<int> instances;
+
+    auto call = [&](int failing) {
+        return [&, failing](int b) {
+            issued.push_back(host_stream(handle));
+            instances.push_back(b);
+            return b == failing ? HIPBLAS_STATUS_EXECUTION_FAILED : HIPBLAS_STATUS_SUCCESS;
+        };
+    };
+
+    // pool streams 1 to 3, fork event 4, join events 5 to 7; the size is read at the first run()
+#ifdef _WIN32
+    _putenv_s("HIPBLAS_BATCHED_STREAMS", "3");
+#else
+    setenv("HIPBLAS_BATCHED_STREAMS", "3", 1);
+#endif
+    hipblas_host_backend::set_stream(handle, 100);
+    hipblas_host_backend::last_id = 0;
+    log.clear();
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_emulation::run(handle, 7, call(-1)));
+    EXPECT_EQ((std::vector<int>{0, 3, 6, 1, 4, 2, 5}), instances);
+    EXPECT_EQ((std::vector<int>{1, 1, 1, 2, 2, 3, 3}), issued);
+    EXPECT_EQ((log_t{"record 4 on 100",
+                     "wait 1 for 4",
+                     "wait 2 for 4",
+                     "wait 3 for 4",
+                     "record 5 on 1",
+                     "wait 100 for 5",
+                     "record 6 on 2",
+                     "wait 100 for 6",
+                     "record 7 on 3",
+                     "wait 100 for 7"}),
+              log);
+    EXPECT_EQ(100, host_stream(handle));
+
+    // only the pool streams used are forked and joined
+    log.clear();
+    issued.clear();
+    instances.clear();
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_emulation::run(handle, 2, call(-1)));
+    EXPECT_EQ((std::vector<int>{1, 2}), issued);
+    EXPECT_EQ((log_t{"record 4 on 100",
+                     "wait 1 for 4",
+                     "wait 2 for 4",
+                     "record 5 on 1",
+                     "wait 100 for 5",
+                     "record 6 on 2",
+                     "wait 100 for 6"}),
+              log);
+
+    // instance 4 fails on the second pool stream: the third one is not forked
+    log.clear();
+    issued.clear();
+    instances.clear();
+    EXPECT_EQ(HIPBLAS_STATUS_EXECUTION_FAILED, host_emulation::run(handle, 7, call(4)));
+    EXPECT_EQ((std::vector<int>{0, 3, 6, 1, 4}), instances);
+    EXPECT_EQ((log_t{"record 4 on 100",
+                     "wait 1 for 4",
+                     "wait 2 for 4",
+                     "record 5 on 1",
+                     "wait 100 for 5",
+                     "record 6 on 2",
+                     "wait 100 for 6"}),
+              log);
+    EXPECT_EQ(100, host_stream(handle));
+
+    // no instance, or one, runs on the user stream without events
+    log.clear();
+    issued.clear();
+    instances.clear();
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_emulation::run(handle, 0, call(-1)));
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, host_emulation::run(handle, 1, call(-1)));
+    EXPECT_EQ(HIPBLAS_STATUS_EXECUTION_FAILED, host_emulation::run(handle, 1, call(0)));
+    EXPECT_EQ((std::vector<int>{0, 0}), instances);
+    EXPECT_EQ((std::vector<int>{100, 100}), issued);
+    EXPECT_TRUE(log.empty());
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, host_emulation::run(handle, -1, call(-1)));
+
+    host_emulation::release(handle);
+    EXPECT_EQ(0, hipblas_host_backend::streams);
+    EXPECT_EQ(0, hipblas_host_backend::events);
+}
+
+static hipblasStatus_t thrown_status(const std::function<void()>& f)
+{
+    try
+    {
+        f();
+    }
+    catch(hipblasStatus_t status)
+    {
+        return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The device array of pointers is read after the work queued before, except in
+// HIPBLAS_CAPTURE_MODE_SAFE
+TEST(hipblas_batched_emulation, pointers)
+{
+    int                 handle_id = 0;
+    hipblasHandle_t     handle    = &handle_id;
+    float               x[3];
+    std::vector<float*> device(3, nullptr);
+
+    hipblas_host_backend::work.push_back([&] { device = {x + 2, x, x + 1}; });
+    std::vector<float*> host;
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+              thrown_status([&] { host = host_emulation::pointers(handle, device.data(), 3); }));
+    EXPECT_EQ(device, host);
+
+    EXPECT_TRUE(host_emulation::pointers<float>(handle, nullptr, 0).empty());
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE,
+              thrown_status([&] { host_emulation::pointers<float>(handle, nullptr, 2); }));
+
+    host_emulation::set_capture_mode(handle, HIPBLAS_CAPTURE_MODE_SAFE);
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED,
+              thrown_status([&] { host_emulation::pointers(handle, device.data(), 3); }));
+
+    host_emulation::release(handle);
+}
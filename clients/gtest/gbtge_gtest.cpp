@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gbtge.hpp"
+#include "testing_getgb.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, double, int> gbtge_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of the conversions between the band
+        and the full storage of a general band matrix, gbtge and getgb, with google test.
+        The whole of the output is compared, so the elements the conversions must not write are
+        checked as well.
+     =================================================================== */
+
+// vector of vector, each vector is a {M, N, KL, KU, lda, ldab};
+// add/delete as a group. The shapes cover bands cut by the top and the bottom of A, bands wider
+// than A and matrices with no column in which the whole band lies
+const vector<vector<int>> matrix_size_range = {{-1, 1, 0, 0, 1, 1},
+                                               {10, 10, 2, 1, 10, 3},
+                                               {0, 4, 1, 1, 1, 3},
+                                               {1, 1, 0, 0, 1, 1},
+                                               {20, 15, 3, 2, 25, 6},
+                                               {15, 20, 2, 4, 15, 7},
+                                               {8, 8, 9, 9, 8, 19},
+                                               {65, 40, 0, 5, 70, 6},
+                                               {40, 65, 7, 0, 40, 9}};
+
+// add/delete single values, like {2.0}
+const vector<double> stride_scale_range = {1.0, 2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 5};
+
+/* ===============Google Unit Test==================================================== */
+
+Arguments setup_gbtge_arguments(gbtge_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    double      stride_scale = std::get<1>(tup);
+    int         batch_count  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.KL  = matrix_size[2];
+    arg.KU  = matrix_size[3];
+    arg.lda = matrix_size[4];
+    arg.ldb = matrix_size[5];
+
+    arg.timing = 0;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class storage_gbtge_gtest : public ::TestWithParam<gbtge_tuple>
+{
+protected:
+    storage_gbtge_gtest() {}
+    virtual ~storage_gbtge_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// if not success, then the input argument is problematic, so detect the error message
+static void expect_gbtge_status(const Arguments& arg, hipblasStatus_t status, bool batched)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.ldb < arg.KL + arg.KU + 1
+           || arg.lda < std::max(arg.M, 1) || (batched && arg.batch_count < 0))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(storage_gbtge_gtest, gbtge_float)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_gbtge<float>(arg), false);
+}
+
+TEST_P(storage_gbtge_gtest, gbtge_double_complex)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_gbtge<hipblasDoubleComplex>(arg), false);
+}
+
+TEST_P(storage_gbtge_gtest, gbtge_batched_float)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_gbtge_batched<float>(arg), true);
+}
+
+TEST_P(storage_gbtge_gtest, gbtge_strided_batched_float)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_gbtge_strided_batched<float>(arg), true);
+}
+
+TEST_P(storage_gbtge_gtest, getgb_float)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_getgb<float>(arg), false);
+}
+
+TEST_P(storage_gbtge_gtest, getgb_double_complex)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_getgb<hipblasDoubleComplex>(arg), false);
+}
+
+TEST_P(storage_gbtge_gtest, getgb_batched_float)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_getgb_batched<float>(arg), true);
+}
+
+TEST_P(storage_gbtge_gtest, getgb_strided_batched_float)
+{
+    Arguments arg = setup_gbtge_arguments(GetParam());
+    expect_gbtge_status(arg, testing_getgb_strided_batched<float>(arg), true);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasgbtge,
+                         storage_gbtge_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
@@ -237,6 +237,60 @@ TEST_P(getrf_batched_gtest, getrf_npvt_batched_gtest_double_complex)
     }
 }
 
+// The summary of the info arrays counts the singular instances of every call, in stream order
+TEST(hipblas_solver, getrf_batched_info_summary)
+{
+    const int n = 3, batch_count = 5;
+
+    hipblasLocalHandle          handle;
+    hipblasBatchedInfoMode_t    mode;
+    hipblasBatchedInfoSummary_t summary;
+    hipStream_t                 stream;
+    host_batch_vector<float>    hA(n * n, 1, batch_count);
+    device_batch_vector<float>  dA(n * n, 1, batch_count);
+    device_vector<int>          dIpiv(n * batch_count);
+    device_vector<int>          dInfo(batch_count);
+
+    ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetBatchedInfoMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_BATCHED_INFO_NONE, mode);
+    ASSERT_EQ(HIPBLAS_STATUS_SUCCESS,
+              hipblasSetBatchedInfoMode(handle, HIPBLAS_BATCHED_INFO_SUMMARY));
+    ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetBatchedInfoMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_BATCHED_INFO_SUMMARY, mode);
+    ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetStream(handle, &stream));
+
+    // identities, except instances 1 and 3 whose first column is zero
+    for(int b = 0; b < batch_count; b++)
+        for(int i = 0; i < n * n; i++)
+            hA[b][i] = (i % (n + 1) == 0 && !(b % 2 == 1 && i == 0)) ? 1.0f : 0.0f;
+    ASSERT_EQ(hipSuccess, dA.transfer_from(hA));
+
+    ASSERT_EQ(HIPBLAS_STATUS_SUCCESS,
+              hipblasSgetrfBatched(handle, n, dA.ptr_on_device(), n, dIpiv, dInfo, batch_count));
+    ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetBatchedInfoSummaryAsync(handle, &summary, 1));
+    ASSERT_EQ(hipSuccess, hipStreamSynchronize(stream));
+
+    EXPECT_EQ(1, summary.calls);
+    EXPECT_EQ(2, summary.failures);
+    EXPECT_EQ(0, summary.first_call);
+    EXPECT_EQ(1, summary.first_index);
+    EXPECT_EQ(1, summary.first_info);
+
+    // the reset readback emptied the summary
+    ASSERT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGetBatchedInfoSummaryAsync(handle, &summary, 0));
+    ASSERT_EQ(hipSuccess, hipStreamSynchronize(stream));
+
+    EXPECT_EQ(0, summary.calls);
+    EXPECT_EQ(0, summary.failures);
+    EXPECT_EQ(-1, summary.first_call);
+    EXPECT_EQ(-1, summary.first_index);
+    EXPECT_EQ(0, summary.first_info);
+
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, hipblasGetBatchedInfoSummaryAsync(handle, nullptr, 0));
+    EXPECT_EQ(HIPBLAS_STATUS_INVALID_ENUM,
+              hipblasSetBatchedInfoMode(handle, hipblasBatchedInfoMode_t(2)));
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a vector,
 // ValuesIn takes each element (a vector), combines them, and feeds them to test_p
@@ -6,6 +6,10 @@
 #ifdef GOOGLE_TEST
 #include <gtest/gtest.h>
 #endif
+#include "hipblas_vector.hpp"
+#include "utility.h"
+#include <cstdlib>
+#include <cstring>
 #include <stdexcept>
 
 /* =====================================================================
@@ -16,5 +20,19 @@ int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
 
-    return RUN_ALL_TESTS();
+    // Test operands come from a pool of size classes unless HIPBLAS_TEST_POOL=0;
+    // HIPBLAS_TEST_POISON=1 fills the blocks returned to the pool with 0xFF bytes
+    const char* pool   = getenv("HIPBLAS_TEST_POOL");
+    const char* poison = getenv("HIPBLAS_TEST_POISON");
+    bool        pooled = !pool || strcmp(pool, "0");
+    if(pooled)
+        hipblas_device_cache::instance().enable_pool(poison && strcmp(poison, "0"));
+
+    int ret = RUN_ALL_TESTS();
+
+    hipblas_device_cache::instance().report(stdout);
+    if(pooled)
+        hipblas_device_cache::instance().enable(false);
+
+    return ret;
 }
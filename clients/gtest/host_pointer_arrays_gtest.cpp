@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "host_pointer_arrays.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+/* =====================================================================
+     The detection of evenly spaced host arrays of pointers, which lets the HostPtrs forms of
+     the batched routines call the strided batched routines. Only the addresses are compared,
+     so the pointers are taken into a host buffer.
+=================================================================== */
+
+TEST(hipblas_host_pointer_arrays, uniform_stride)
+{
+    std::vector<double>  buffer(64);
+    double*              x      = buffer.data();
+    hipblasStride        stride = -1;
+    std::vector<double*> array{x, x + 5, x + 10, x + 15};
+
+    // evenly spaced
+    EXPECT_TRUE(hipblas_uniform_stride(array.data(), 4, &stride));
+    EXPECT_EQ(5, stride);
+
+    // a single instance, and equal pointers, have stride 0
+    stride = -1;
+    EXPECT_TRUE(hipblas_uniform_stride(array.data(), 1, &stride));
+    EXPECT_EQ(0, stride);
+    std::vector<double*> same(3, x + 7);
+    stride = -1;
+    EXPECT_TRUE(hipblas_uniform_stride(same.data(), 3, &stride));
+    EXPECT_EQ(0, stride);
+
+    // decreasing addresses are rejected, as the strided routines take a stride >= 0
+    std::vector<double*> decreasing{x + 10, x + 5, x};
+    stride = -1;
+    EXPECT_FALSE(hipblas_uniform_stride(decreasing.data(), 3, &stride));
+    EXPECT_EQ(-1, stride);
+
+    // a step of bytes which is not a whole number of elements
+    char*                bytes = reinterpret_cast<char*>(x);
+    std::vector<double*> unaligned{reinterpret_cast<double*>(bytes),
+                                   reinterpret_cast<double*>(bytes + 12),
+                                   reinterpret_cast<double*>(bytes + 24)};
+    EXPECT_FALSE(hipblas_uniform_stride(unaligned.data(), 3, &stride));
+
+    // an outlier after the first step
+    std::vector<double*> outlier{x, x + 5, x + 10, x + 16};
+    EXPECT_FALSE(hipblas_uniform_stride(outlier.data(), 4, &stride));
+    outlier = {x, x + 5, x + 11, x + 15};
+    EXPECT_FALSE(hipblas_uniform_stride(outlier.data(), 4, &stride));
+    EXPECT_TRUE(hipblas_uniform_stride(outlier.data(), 2, &stride));
+    EXPECT_EQ(5, stride);
+
+    // a missing or empty array
+    stride = -1;
+    EXPECT_FALSE(hipblas_uniform_stride<double>(nullptr, 3, &stride));
+    EXPECT_FALSE(hipblas_uniform_stride(array.data(), 0, &stride));
+    EXPECT_FALSE(hipblas_uniform_stride(array.data(), -1, &stride));
+    EXPECT_EQ(-1, stride);
+
+    // const element types are counted in elements too
+    std::vector<const float*> floats{reinterpret_cast<const float*>(x),
+                                     reinterpret_cast<const float*>(x + 1),
+                                     reinterpret_cast<const float*>(x + 2)};
+    EXPECT_TRUE(hipblas_uniform_stride(floats.data(), 3, &stride));
+    EXPECT_EQ(2, stride);
+}
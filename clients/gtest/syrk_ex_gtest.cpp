@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_syrk_ex.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<double>, char, char, double, int> syrk_ex_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of the rank k updates of mixed
+        precision, syrk_ex and herk_ex, with google test.
+        The whole of C is compared, so the triangle the updates must not write is checked as well.
+     =================================================================== */
+
+// vector of vector, each vector is a {N, K, lda, ldc};
+// add/delete as a group. The sizes above 64 cover the blocking of the diagonal of C in blocks of
+// 64 columns, with and without a partial last block
+const vector<vector<int>> matrix_size_range = {{-1, -1, -1, -1},
+                                               {11, 6, 11, 11},
+                                               {0, 4, 4, 1},
+                                               {16, 0, 16, 16},
+                                               {65, 4, 65, 65},
+                                               {128, 20, 130, 128},
+                                               {200, 33, 200, 210}};
+
+// vector, each entry is  {alpha, alphai, beta, betai};
+// add/delete single values, like {2.0}
+const vector<vector<double>> alpha_beta_range
+    = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 0.0, 0.0}, {0.0, 0.0, 1.0, 0.0}};
+
+const vector<char> uplo_range = {'L', 'U'};
+
+// 'T' is run as 'C' for herk_ex
+const vector<char> transA_range = {'N', 'T'};
+
+const vector<double> stride_scale_range = {1.0, 2.5};
+const vector<int>    batch_count_range  = {-1, 0, 1, 3};
+
+/* ===============Google Unit Test==================================================== */
+
+Arguments setup_syrk_ex_arguments(syrk_ex_tuple tup)
+{
+    vector<int>    matrix_size  = std::get<0>(tup);
+    vector<double> alpha_beta   = std::get<1>(tup);
+    char           uplo         = std::get<2>(tup);
+    char           transA       = std::get<3>(tup);
+    double         stride_scale = std::get<4>(tup);
+    int            batch_count  = std::get<5>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldc = matrix_size[3];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.uplo_option   = uplo;
+    arg.transA_option = transA;
+
+    arg.timing = 0;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+// The types of A, of C and of the computation
+static void set_syrk_ex_types(Arguments& arg, hipblasDatatype_t a_type, hipblasDatatype_t c_type)
+{
+    arg.a_type       = a_type;
+    arg.c_type       = c_type;
+    arg.compute_type = c_type;
+}
+
+class blas3_syrk_ex_gtest : public ::TestWithParam<syrk_ex_tuple>
+{
+protected:
+    blas3_syrk_ex_gtest() {}
+    virtual ~blas3_syrk_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// if not success, then the input argument is problematic, so detect the error message
+static void expect_syrk_ex_status(const Arguments& arg, hipblasStatus_t status, bool batched)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N
+           || arg.lda < (arg.transA_option == 'N' ? arg.N : arg.K)
+           || (batched && arg.batch_count < 0))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas3_syrk_ex_gtest, syrk_ex_half_float)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_R_16F, HIPBLAS_R_32F);
+    expect_syrk_ex_status(arg, testing_syrk_ex_template<hipblasHalf, float>(arg), false);
+}
+
+TEST_P(blas3_syrk_ex_gtest, syrk_ex_bfloat16_float)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_R_16B, HIPBLAS_R_32F);
+    expect_syrk_ex_status(arg, testing_syrk_ex_template<hipblasBfloat16, float>(arg), false);
+}
+
+TEST_P(blas3_syrk_ex_gtest, syrk_ex_double_complex)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_C_64F, HIPBLAS_C_64F);
+    expect_syrk_ex_status(arg, testing_syrk_ex_template<hipblasDoubleComplex>(arg), false);
+}
+
+TEST_P(blas3_syrk_ex_gtest, syrk_batched_ex_half_float)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_R_16F, HIPBLAS_R_32F);
+    expect_syrk_ex_status(arg, testing_syrk_batched_ex_template<hipblasHalf, float>(arg), true);
+}
+
+TEST_P(blas3_syrk_ex_gtest, syrk_strided_batched_ex_half_float)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_R_16F, HIPBLAS_R_32F);
+    expect_syrk_ex_status(
+        arg, testing_syrk_strided_batched_ex_template<hipblasHalf, float>(arg), true);
+}
+
+TEST_P(blas3_syrk_ex_gtest, herk_ex_float_complex)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_C_32F, HIPBLAS_C_32F);
+    arg.transA_option = arg.transA_option == 'N' ? 'N' : 'C';
+    expect_syrk_ex_status(
+        arg, testing_syrk_ex_template<hipblasComplex, hipblasComplex, true>(arg), false);
+}
+
+TEST_P(blas3_syrk_ex_gtest, herk_batched_ex_float_complex)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_C_32F, HIPBLAS_C_32F);
+    arg.transA_option = arg.transA_option == 'N' ? 'N' : 'C';
+    expect_syrk_ex_status(
+        arg, testing_syrk_batched_ex_template<hipblasComplex, hipblasComplex, true>(arg), true);
+}
+
+TEST_P(blas3_syrk_ex_gtest, herk_strided_batched_ex_float_complex)
+{
+    Arguments arg = setup_syrk_ex_arguments(GetParam());
+    set_syrk_ex_types(arg, HIPBLAS_C_32F, HIPBLAS_C_32F);
+    arg.transA_option = arg.transA_option == 'N' ? 'N' : 'C';
+    expect_syrk_ex_status(
+        arg,
+        testing_syrk_strided_batched_ex_template<hipblasComplex, hipblasComplex, true>(arg),
+        true);
+}
+
+// The rank k updates only support C in the type of the computation
+TEST(hipblas_blas3, syrk_ex_not_supported)
+{
+    hipblasLocalHandle handle;
+    float              alpha = 1, beta = 0;
+
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED,
+              hipblasSyrkEx(handle,
+                            HIPBLAS_FILL_MODE_LOWER,
+                            HIPBLAS_OP_N,
+                            4,
+                            4,
+                            &alpha,
+                            nullptr,
+                            HIPBLAS_R_16F,
+                            4,
+                            &beta,
+                            nullptr,
+                            HIPBLAS_R_16F,
+                            4,
+                            HIPBLAS_R_32F));
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED,
+              hipblasHerkEx(handle,
+                            HIPBLAS_FILL_MODE_LOWER,
+                            HIPBLAS_OP_N,
+                            4,
+                            4,
+                            &alpha,
+                            nullptr,
+                            HIPBLAS_R_32F,
+                            4,
+                            &beta,
+                            nullptr,
+                            HIPBLAS_R_32F,
+                            4,
+                            HIPBLAS_R_32F));
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblasSyrkEx,
+                         blas3_syrk_ex_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(alpha_beta_range),
+                                 ValuesIn(uplo_range),
+                                 ValuesIn(transA_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
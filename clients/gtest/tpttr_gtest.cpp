@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_tpttr.hpp"
+#include "testing_trttp.hpp"
+#include "utility.h"
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char, double, int> tpttr_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of the conversions between the packed
+        and the full storage of a triangular matrix, tpttr and trttp, with google test.
+        The whole of the output is compared, so the elements the conversions must not write are
+        checked as well.
+     =================================================================== */
+
+// vector of vector, each vector is a {N, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {
+    {-1, 1}, {10, 5}, {0, 1}, {1, 1}, {11, 11}, {16, 20}, {65, 70}};
+
+const vector<char> uplo_range = {'U', 'L'};
+
+// add/delete single values, like {2.0}
+const vector<double> stride_scale_range = {1.0, 2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 5};
+
+/* ===============Google Unit Test==================================================== */
+
+Arguments setup_tpttr_arguments(tpttr_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    char        uplo         = std::get<1>(tup);
+    double      stride_scale = std::get<2>(tup);
+    int         batch_count  = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.uplo_option = uplo;
+
+    arg.timing = 0;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class storage_tpttr_gtest : public ::TestWithParam<tpttr_tuple>
+{
+protected:
+    storage_tpttr_gtest() {}
+    virtual ~storage_tpttr_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// if not success, then the input argument is problematic, so detect the error message
+static void expect_tpttr_status(const Arguments& arg, hipblasStatus_t status, bool batched)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < std::max(arg.N, 1) || (batched && arg.batch_count < 0))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(storage_tpttr_gtest, tpttr_float)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_tpttr<float>(arg), false);
+}
+
+TEST_P(storage_tpttr_gtest, tpttr_double_complex)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_tpttr<hipblasDoubleComplex>(arg), false);
+}
+
+TEST_P(storage_tpttr_gtest, tpttr_batched_float)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_tpttr_batched<float>(arg), true);
+}
+
+TEST_P(storage_tpttr_gtest, tpttr_strided_batched_float)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_tpttr_strided_batched<float>(arg), true);
+}
+
+TEST_P(storage_tpttr_gtest, trttp_float)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_trttp<float>(arg), false);
+}
+
+TEST_P(storage_tpttr_gtest, trttp_double_complex)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_trttp<hipblasDoubleComplex>(arg), false);
+}
+
+TEST_P(storage_tpttr_gtest, trttp_batched_float)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_trttp_batched<float>(arg), true);
+}
+
+TEST_P(storage_tpttr_gtest, trttp_strided_batched_float)
+{
+    Arguments arg = setup_tpttr_arguments(GetParam());
+    expect_tpttr_status(arg, testing_trttp_strided_batched<float>(arg), true);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblastpttr,
+                         storage_tpttr_gtest,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(uplo_range),
+                                 ValuesIn(stride_scale_range),
+                                 ValuesIn(batch_count_range)));
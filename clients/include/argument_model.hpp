@@ -12,6 +12,39 @@
 namespace ArgumentLogging
 {
     const double NA_value = -1.0; // invalid for time, GFlop, GB
+
+    // Timing results of one tester call, captured instead of printed when a sink is installed
+    struct perf_record
+    {
+        bool   valid       = false;
+        double gpu_us      = 0; // total time of the hot calls
+        double gflops      = 0; // GFlop of a single call of a single batch
+        double gbytes      = 0; // GB moved by a single call of a single batch
+        int    batch_count = 1;
+        int    hot_calls   = 1;
+    };
+
+    // Per-thread sink used by hipblas-bench to aggregate concurrent runs
+    inline perf_record*& perf_sink()
+    {
+        static thread_local perf_record* sink = nullptr;
+        return sink;
+    }
+
+    // Memory footprint of one case, appended to the performance fields when installed
+    struct memory_record
+    {
+        double operand_bytes   = 0; // peak bytes of the device operands
+        double device_bytes    = 0; // peak device memory in use above the level before the case
+        double workspace_bytes = 0; // device memory beyond the operands, allocated by the backend
+        double host_bytes      = 0; // peak growth of resident host memory, mostly reference data
+    };
+
+    inline memory_record*& memory_sink()
+    {
+        static thread_local memory_record* sink = nullptr;
+        return sink;
+    }
 }
 
 // ArgumentModel template has a variadic list of argument enums
@@ -58,6 +91,14 @@ public:
             val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
 
+        if(const ArgumentLogging::memory_record* mem = ArgumentLogging::memory_sink())
+        {
+            constexpr double MiB = 1024.0 * 1024.0;
+            name_line << "operand-MiB,device-peak-MiB,workspace-MiB,host-MiB,";
+            val_line << mem->operand_bytes / MiB << ", " << mem->device_bytes / MiB << ", "
+                     << mem->workspace_bytes / MiB << ", " << mem->host_bytes / MiB << ", ";
+        }
+
         if(arg.unit_check || arg.norm_check)
         {
             if(arg.norm_check)
@@ -77,6 +118,19 @@ public:
                   double           norm1     = 0,
                   double           norm2     = 0)
     {
+        if(arg.timing && ArgumentLogging::perf_sink())
+        {
+            ArgumentLogging::perf_record& rec = *ArgumentLogging::perf_sink();
+
+            rec.valid       = true;
+            rec.gpu_us      = gpu_us;
+            rec.gflops      = gflops;
+            rec.gbytes      = gpu_bytes;
+            rec.batch_count = has(e_batch_count, Args...) ? arg.batch_count : 1;
+            rec.hot_calls   = arg.iters < 1 ? 1 : arg.iters;
+            return;
+        }
+
         std::stringstream name_list;
         std::stringstream value_list;
 
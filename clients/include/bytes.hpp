@@ -306,6 +306,25 @@ constexpr double trsv_gbyte_count(int n)
     return (sizeof(T) * (tri_count(n) + n)) / 1e9;
 }
 
+/* \brief byte counts of TPTTR and TRTTP */
+template <typename T>
+inline double tpttr_gbyte_count(int n)
+{
+    // read the triangle, write it
+    return (sizeof(T) * 2.0 * tri_count(n)) / 1e9;
+}
+
+/* \brief byte counts of GBTGE and GETGB */
+template <typename T>
+inline double gbtge_gbyte_count(int m, int n, int kl, int ku)
+{
+    // read the band, write it
+    double num_els = 0;
+    for(int j = 0; j < n && j < m + ku; j++)
+        num_els += (j + kl < m - 1 ? j + kl : m - 1) - (j > ku ? j - ku : 0) + 1;
+    return (sizeof(T) * 2.0 * num_els) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    level 3 BLAS
@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************/
+
+#pragma once
+#ifndef _CBLAS_BATCHED_INTERFACE_
+#define _CBLAS_BATCHED_INTERFACE_
+
+#include "cblas_interface.h"
+#include "hipblas_thread_pool.hpp"
+#include "utility.h"
+#include <algorithm>
+#include <vector>
+
+/*!\file
+ * \brief batched and strided batched CPU references built on the cblas_* templates. The batch
+ * elements are spread over the client thread pool (see hipblas_parallel_for), with the host BLAS
+ * limited to one thread per worker. Only used for testing, not part of the GPU library.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Call ref(b) for every batch element b. ref must only touch data of element b. */
+template <typename F>
+inline void cblas_batched(int batch_count, F&& ref)
+{
+    if(batch_count > 0)
+        hipblas_parallel_for(batch_count, [&](size_t b) { ref(int(b)); });
+}
+
+/*
+ * ===========================================================================
+ *    level 3 BLAS
+ * ===========================================================================
+ */
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void cblas_gemm_batched(hipblasOperation_t transA,
+                        hipblasOperation_t transB,
+                        int                m,
+                        int                n,
+                        int                k,
+                        Tc                 alpha,
+                        Ti* const          A[],
+                        int                lda,
+                        Ti* const          B[],
+                        int                ldb,
+                        Tc                 beta,
+                        To* const          C[],
+                        int                ldc,
+                        int                batch_count)
+{
+    cblas_batched(batch_count, [&](int b) {
+        cblas_gemm<Ti, To, Tc>(
+            transA, transB, m, n, k, alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+    });
+}
+
+template <typename Ti, typename To = Ti, typename Tc = To>
+void cblas_gemm_strided_batched(hipblasOperation_t transA,
+                                hipblasOperation_t transB,
+                                int                m,
+                                int                n,
+                                int                k,
+                                Tc                 alpha,
+                                Ti*                A,
+                                int                lda,
+                                hipblasStride      stride_a,
+                                Ti*                B,
+                                int                ldb,
+                                hipblasStride      stride_b,
+                                Tc                 beta,
+                                To*                C,
+                                int                ldc,
+                                hipblasStride      stride_c,
+                                int                batch_count)
+{
+    cblas_batched(batch_count, [&](int b) {
+        cblas_gemm<Ti, To, Tc>(transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A + b * stride_a,
+                               lda,
+                               B + b * stride_b,
+                               ldb,
+                               beta,
+                               C + b * stride_c,
+                               ldc);
+    });
+}
+
+/*
+ * ===========================================================================
+ *    LAPACK
+ * ===========================================================================
+ */
+
+// Each batch element queries and owns its workspace, so elements can run concurrently
+template <typename T>
+void cblas_geqrf_batched(int m, int n, T* const A[], int lda, T* const tau[], int batch_count)
+{
+    cblas_batched(batch_count, [&](int b) {
+        T query;
+        cblas_geqrf<T>(m, n, A[b], lda, tau[b], &query, -1);
+        std::vector<T> work(std::max(type2int(query), 1));
+        cblas_geqrf<T>(m, n, A[b], lda, tau[b], work.data(), int(work.size()));
+    });
+}
+
+template <typename T>
+void cblas_geqrf_strided_batched(int           m,
+                                 int           n,
+                                 T*            A,
+                                 int           lda,
+                                 hipblasStride stride_a,
+                                 T*            tau,
+                                 hipblasStride stride_t,
+                                 int           batch_count)
+{
+    cblas_batched(batch_count, [&](int b) {
+        T  query;
+        T* Ab   = A + b * stride_a;
+        T* taub = tau + b * stride_t;
+        cblas_geqrf<T>(m, n, Ab, lda, taub, &query, -1);
+        std::vector<T> work(std::max(type2int(query), 1));
+        cblas_geqrf<T>(m, n, Ab, lda, taub, work.data(), int(work.size()));
+    });
+}
+
+#endif /* _CBLAS_BATCHED_INTERFACE_ */
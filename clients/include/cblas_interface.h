@@ -59,6 +59,19 @@ void cblas_iamax(int n, const T* x, int incx, int* result);
 template <typename T>
 void cblas_iamin(int n, const T* x, int incx, int* result);
 
+template <typename T>
+void cblas_axpby(int n, T alpha, const T* x, int incx, T beta, T* y, int incy);
+
+template <typename T>
+void cblas_axpy_dot(
+    int n, T alpha, const T* x, int incx, T* y, int incy, const T* z, int incz, T* result);
+
+template <typename T>
+void cblas_dot_multi(int n, int k, const T* x, int incx, const T* Y, int ldy, T* result);
+
+template <typename T1, typename T2>
+void cblas_normalize(int n, T1* x, int incx, T2* result);
+
 template <typename T>
 void cblas_gbmv(hipblasOperation_t transA,
                 int                m,
@@ -248,6 +261,22 @@ void cblas_trsv(hipblasHandle_t    handle,
                 T*                 x,
                 int                incx);
 
+// tpttr
+template <typename T>
+void cblas_tpttr(hipblasFillMode_t uplo, int n, const T* AP, T* A, int lda);
+
+// trttp
+template <typename T>
+void cblas_trttp(hipblasFillMode_t uplo, int n, const T* A, int lda, T* AP);
+
+// gbtge
+template <typename T>
+void cblas_gbtge(int m, int n, int kl, int ku, const T* AB, int ldab, T* A, int lda);
+
+// getgb
+template <typename T>
+void cblas_getgb(int m, int n, int kl, int ku, const T* A, int lda, T* AB, int ldab);
+
 // hemv
 template <typename T>
 void cblas_hemv(
@@ -327,6 +356,21 @@ void cblas_gemm(hipblasOperation_t transA,
                 To*                C,
                 int                ldc);
 
+// Exact int8 gemm, modulo 2^32 like int32 accumulation
+void cblas_gemm_int8(hipblasOperation_t transA,
+                     hipblasOperation_t transB,
+                     int                m,
+                     int                n,
+                     int                k,
+                     int32_t            alpha,
+                     const int8_t*      A,
+                     int                lda,
+                     const int8_t*      B,
+                     int                ldb,
+                     int32_t            beta,
+                     int32_t*           C,
+                     int                ldc);
+
 // hemm
 template <typename T>
 void cblas_hemm(hipblasSideMode_t side,
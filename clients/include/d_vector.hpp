@@ -5,9 +5,192 @@
 #pragma once
 
 #include "hipblas.h"
+#include <algorithm>
 #include <cinttypes>
 #include <clocale>
 #include <cstdio>
+#include <map>
+#include <mutex>
+#include <vector>
+
+/* ============================================================================================ */
+/*! \brief  allocator of all test and benchmark operands. It keeps count of the live and peak
+            operand bytes, and optionally caches freed blocks: hipblas-bench enables the cache for
+            size sweeps so the buffers allocated for the largest problem are reused by all
+            smaller ones, and hipblas-test runs as a pool of size classes (see enable_pool)  */
+class hipblas_device_cache
+{
+    struct block
+    {
+        size_t capacity, bytes;
+    };
+
+    std::mutex                   m_mutex;
+    std::multimap<size_t, void*> m_free; // capacity -> block
+    std::map<void*, block>       m_used;
+    size_t                       m_live    = 0;
+    size_t                       m_peak    = 0;
+    bool                         m_enabled = false;
+    bool                         m_classes = false;
+    bool                         m_poison  = false;
+
+    // statistics, see report()
+    size_t m_allocations        = 0;
+    size_t m_reused             = 0;
+    size_t m_device_allocations = 0;
+    size_t m_cached             = 0;
+    size_t m_peak_cached        = 0;
+
+    void release_free_blocks()
+    {
+        for(auto& free_block : m_free)
+            (hipFree)(free_block.second);
+        m_free.clear();
+        m_cached = 0;
+    }
+
+    // 256 byte steps up to 4 KB, then four classes per power of two (at most 25% waste)
+    static size_t size_class(size_t bytes)
+    {
+        if(bytes <= 4096)
+            return std::max(size_t(256), (bytes + 255) / 256 * 256);
+
+        size_t step = 1024;
+        while(step * 8 < bytes)
+            step *= 2;
+        return (bytes + step - 1) / step * step;
+    }
+
+public:
+    static hipblas_device_cache& instance()
+    {
+        static hipblas_device_cache cache;
+        return cache;
+    }
+
+    ~hipblas_device_cache()
+    {
+        release_free_blocks();
+    }
+
+    // Disabling the cache releases every block which is not in use
+    void enable(bool enabled)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_enabled = enabled;
+        m_classes = false;
+        m_poison  = false;
+        if(!enabled)
+            release_free_blocks();
+    }
+
+    // Cache for a process which allocates the same small sizes over and over: requests are
+    // rounded up to a size class and only blocks of the same class are reused, so a large block
+    // is never held by a small operand. With poison, freed blocks are filled with 0xFF bytes
+    // (NaN for the floating point types) so reads of stale or uninitialized operands show up
+    void enable_pool(bool poison)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_enabled = true;
+        m_classes = true;
+        m_poison  = poison;
+    }
+
+    // Operand bytes currently allocated, and the maximum since the last reset_peak()
+    size_t live_bytes()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_live;
+    }
+
+    size_t peak_bytes()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_peak;
+    }
+
+    void reset_peak()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_peak = m_live;
+    }
+
+    // Allocation statistics since the start of the process
+    void report(FILE* out)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        fprintf(out,
+                "hipBLAS device memory: %zu allocations, %zu reused from the cache (%.1f%%), %zu "
+                "hipMalloc; peak %.1f MB of operands, %.1f MB cached\n",
+                m_allocations,
+                m_reused,
+                m_allocations ? 100.0 * m_reused / m_allocations : 0.0,
+                m_device_allocations,
+                m_peak / 1048576.0,
+                m_peak_cached / 1048576.0);
+    }
+
+    // Best fit: the smallest cached block which holds bytes, otherwise a new allocation
+    hipError_t allocate(void** ptr, size_t bytes)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        size_t capacity = m_classes ? size_class(bytes) : bytes;
+        auto   fit      = m_enabled ? m_free.lower_bound(capacity) : m_free.end();
+        if(fit != m_free.end() && (!m_classes || fit->first == capacity))
+        {
+            capacity = fit->first;
+            *ptr     = fit->second;
+            m_cached -= capacity;
+            m_free.erase(fit);
+            m_reused++;
+        }
+        else
+        {
+            hipError_t err = (hipMalloc)(ptr, capacity);
+            if(err != hipSuccess && !m_free.empty())
+            {
+                // retry once without the blocks held for reuse
+                release_free_blocks();
+                err = (hipMalloc)(ptr, capacity);
+            }
+            if(err != hipSuccess)
+                return err;
+            m_device_allocations++;
+        }
+
+        m_used[*ptr] = {capacity, bytes};
+        m_live += bytes;
+        m_peak = std::max(m_peak, m_live);
+        m_allocations++;
+        return hipSuccess;
+    }
+
+    hipError_t free(void* ptr)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto                        used = m_used.find(ptr);
+        if(used == m_used.end())
+            return (hipFree)(ptr);
+
+        m_live -= used->second.bytes;
+        if(!m_enabled)
+        {
+            m_used.erase(used);
+            return (hipFree)(ptr);
+        }
+
+        hipError_t err = hipSuccess;
+        if(m_poison)
+            err = hipMemset(ptr, 0xFF, used->second.capacity);
+
+        m_cached += used->second.capacity;
+        m_peak_cached = std::max(m_peak_cached, m_cached);
+        m_free.emplace(used->second.capacity, ptr);
+        m_used.erase(used);
+        return err;
+    }
+};
 
 /* ============================================================================================ */
 /*! \brief  base-class to allocate/deallocate device memory */
@@ -45,9 +228,9 @@ protected:
     T* device_vector_setup()
     {
         T* d;
-        if((hipMalloc)(&d, bytes) != hipSuccess)
+        if(hipblas_device_cache::instance().allocate((void**)&d, bytes) != hipSuccess)
         {
-            static char* lc = setlocale(LC_NUMERIC, "");
+            setlocale(LC_NUMERIC, "");
             fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", bytes, bytes >> 30);
             d = nullptr;
         }
@@ -70,6 +253,83 @@ protected:
         return d;
     }
 
+    // Distance in elements between the vectors of a slab. Each vector starts on a 256 byte
+    // boundary and, in the tests, is enclosed by its own guards
+    size_t slab_pitch() const
+    {
+        size_t align = std::max(size_t(1), 256 / sizeof(T));
+#ifdef GOOGLE_TEST
+        size_t pitch = size + PAD * 2;
+#else
+        size_t pitch = std::max(size, size_t(1));
+#endif
+        return (pitch + align - 1) / align * align;
+    }
+
+    // One allocation for count vectors; vector b starts at the returned pointer + b * slab_pitch()
+    T* device_slab_setup(size_t count)
+    {
+        T*     d;
+        size_t pitch = slab_pitch();
+        size_t bytes = std::max(count, size_t(1)) * pitch * sizeof(T);
+        if(hipblas_device_cache::instance().allocate((void**)&d, bytes) != hipSuccess)
+        {
+            setlocale(LC_NUMERIC, "");
+            fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", bytes, bytes >> 30);
+            return nullptr;
+        }
+#ifdef GOOGLE_TEST
+        if(PAD > 0 && count > 0)
+        {
+            // Guards of the first vector, then double the initialized vectors until all have them
+            hipMemcpy(d, guard, sizeof(guard), hipMemcpyHostToDevice);
+            hipMemcpy(d + PAD + size, guard, sizeof(guard), hipMemcpyHostToDevice);
+            for(size_t done = 1; done < count; done *= 2)
+                hipMemcpy(d + done * pitch,
+                          d,
+                          std::min(done, count - done) * pitch * sizeof(T),
+                          hipMemcpyDeviceToDevice);
+        }
+        d += PAD;
+#endif
+        return d;
+    }
+
+    void device_slab_teardown(T* d, size_t count)
+    {
+        if(d == nullptr)
+            return;
+#ifdef GOOGLE_TEST
+        d -= PAD;
+        if(PAD > 0 && count > 0)
+        {
+            // Read the guards back a few MB at a time and make sure no corruption has occurred
+            size_t         pitch = slab_pitch();
+            size_t         rows  = std::max(size_t(1), (size_t(16) << 20) / sizeof(guard));
+            std::vector<U> host(std::min(rows, count) * PAD);
+            size_t         corrupt = 0;
+            for(size_t b = 0; b < count; b += rows)
+            {
+                size_t n = std::min(rows, count - b);
+                for(size_t offset : {size_t(0), PAD + size})
+                {
+                    hipMemcpy2D(host.data(),
+                                sizeof(guard),
+                                d + b * pitch + offset,
+                                pitch * sizeof(T),
+                                sizeof(guard),
+                                n,
+                                hipMemcpyDeviceToHost);
+                    for(size_t r = 0; r < n; r++)
+                        corrupt += memcmp(&host[r * PAD], guard, sizeof(guard)) != 0;
+                }
+            }
+            EXPECT_EQ(corrupt, 0u) << "corrupted guards around the vectors of a batch";
+        }
+#endif
+        CHECK_HIP_ERROR(hipblas_device_cache::instance().free(d));
+    }
+
     void device_vector_teardown(T* d)
     {
         if(d != nullptr)
@@ -96,7 +356,7 @@ protected:
             }
 #endif
             // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            CHECK_HIP_ERROR(hipblas_device_cache::instance().free(d));
         }
     }
 };
@@ -16,6 +16,7 @@ class host_batch_vector;
 //! @brief  pseudo-vector subclass which uses a batch of device memory pointers and
 //!  - an array of pointers in host memory
 //!  - an array of pointers in device memory
+//!  The vectors are carved out of a single device allocation, pitch() elements apart.
 //!
 template <typename T, size_t PAD = 4096, typename U = T>
 class device_batch_vector : private d_vector<T, PAD, U>
@@ -186,29 +187,41 @@ public:
         return nullptr != this->m_data;
     }
 
+    //!
+    //! @brief Returns the distance in elements between consecutive vectors of the batch.
+    //!
+    size_t pitch() const
+    {
+        return this->slab_pitch();
+    }
+
     //!
     //! @brief Copy from a host batched vector.
     //! @param that The host_batch_vector to copy.
     //!
     hipError_t transfer_from(const host_batch_vector<T>& that)
     {
-        hipError_t hip_err;
         //
-        // Copy each vector.
+        // Copy all vectors at once, the device vectors may be padded.
         //
-        for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-        {
-            if(hipSuccess
-               != (hip_err = hipMemcpy((*this)[batch_index],
-                                       that[batch_index],
-                                       sizeof(T) * this->nmemb(),
-                                       hipMemcpyHostToDevice)))
-            {
-                return hip_err;
-            }
-        }
+        size_t nmemb = this->nmemb();
+        if(!this->m_batch_count || !nmemb)
+            return hipSuccess;
 
-        return hipSuccess;
+        if(this->pitch() == that.pitch())
+            return hipMemcpy((*this)[0],
+                             that[0],
+                             sizeof(T) * this->pitch() * (this->m_batch_count - 1)
+                                 + sizeof(T) * nmemb,
+                             hipMemcpyHostToDevice);
+
+        return hipMemcpy2D((*this)[0],
+                           sizeof(T) * this->pitch(),
+                           that[0],
+                           sizeof(T) * that.pitch(),
+                           sizeof(T) * nmemb,
+                           this->m_batch_count,
+                           hipMemcpyHostToDevice);
     }
 
     //!
@@ -227,6 +240,7 @@ private:
     int m_n{};
     int m_inc{};
     int m_batch_count{};
+    T*  m_slab{};
     T** m_data{};
     T** m_device_data{};
 
@@ -238,25 +252,25 @@ private:
     {
         bool success = false;
 
-        success
-            = (hipSuccess == (hipMalloc)(&this->m_device_data, this->m_batch_count * sizeof(T*)));
+        success = (hipSuccess
+                   == hipblas_device_cache::instance().allocate((void**)&this->m_device_data,
+                                                                this->m_batch_count * sizeof(T*)));
         if(success)
         {
             success = (nullptr != (this->m_data = (T**)calloc(this->m_batch_count, sizeof(T*))));
             if(success)
             {
-                for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+                //
+                // One slab for all the vectors, the pointers are offsets into it.
+                //
+                success = (nullptr != (this->m_slab = this->device_slab_setup(this->m_batch_count)));
+                if(success)
                 {
-                    success
-                        = (nullptr != (this->m_data[batch_index] = this->device_vector_setup()));
-                    if(!success)
+                    for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
                     {
-                        break;
+                        this->m_data[batch_index] = this->m_slab + batch_index * this->pitch();
                     }
-                }
 
-                if(success)
-                {
                     success = (hipSuccess
                                == hipMemcpy(this->m_device_data,
                                             this->m_data,
@@ -273,17 +287,14 @@ private:
     //!
     void free_memory()
     {
-        if(nullptr != this->m_data)
+        if(nullptr != this->m_slab)
         {
-            for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-            {
-                if(nullptr != this->m_data[batch_index])
-                {
-                    this->device_vector_teardown(this->m_data[batch_index]);
-                    this->m_data[batch_index] = nullptr;
-                }
-            }
+            this->device_slab_teardown(this->m_slab, this->m_batch_count);
+            this->m_slab = nullptr;
+        }
 
+        if(nullptr != this->m_data)
+        {
             free(this->m_data);
             this->m_data = nullptr;
         }
@@ -292,7 +303,7 @@ private:
         {
             auto tmp_device_data = this->m_device_data;
             this->m_device_data  = nullptr;
-            CHECK_HIP_ERROR((hipFree)(tmp_device_data));
+            CHECK_HIP_ERROR(hipblas_device_cache::instance().free(tmp_device_data));
         }
     }
 };
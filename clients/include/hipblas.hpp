@@ -327,6 +327,132 @@ hipblasStatus_t hipblasAxpyStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   stridey,
                                           int             batch_count);
 
+// fused level 1
+template <typename T>
+hipblasStatus_t hipblasAxpby(hipblasHandle_t handle,
+                             int             n,
+                             const T*        alpha,
+                             const T*        x,
+                             int             incx,
+                             const T*        beta,
+                             T*              y,
+                             int             incy);
+
+template <typename T>
+hipblasStatus_t hipblasAxpbyBatched(hipblasHandle_t handle,
+                                    int             n,
+                                    const T*        alpha,
+                                    const T* const  x[],
+                                    int             incx,
+                                    const T*        beta,
+                                    T* const        y[],
+                                    int             incy,
+                                    int             batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasAxpbyStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           const T*        alpha,
+                                           const T*        x,
+                                           int             incx,
+                                           hipblasStride   stridex,
+                                           const T*        beta,
+                                           T*              y,
+                                           int             incy,
+                                           hipblasStride   stridey,
+                                           int             batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasAxpyDot(hipblasHandle_t handle,
+                               int             n,
+                               const T*        alpha,
+                               const T*        x,
+                               int             incx,
+                               T*              y,
+                               int             incy,
+                               const T*        z,
+                               int             incz,
+                               T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasAxpyDotBatched(hipblasHandle_t handle,
+                                      int             n,
+                                      const T*        alpha,
+                                      const T* const  x[],
+                                      int             incx,
+                                      T* const        y[],
+                                      int             incy,
+                                      const T* const  z[],
+                                      int             incz,
+                                      int             batch_count,
+                                      T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasAxpyDotStridedBatched(hipblasHandle_t handle,
+                                             int             n,
+                                             const T*        alpha,
+                                             const T*        x,
+                                             int             incx,
+                                             hipblasStride   stridex,
+                                             T*              y,
+                                             int             incy,
+                                             hipblasStride   stridey,
+                                             const T*        z,
+                                             int             incz,
+                                             hipblasStride   stridez,
+                                             int             batch_count,
+                                             T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasDotMulti(hipblasHandle_t handle,
+                                int             n,
+                                int             k,
+                                const T*        x,
+                                int             incx,
+                                const T*        Y,
+                                int             ldy,
+                                T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasDotMultiBatched(hipblasHandle_t handle,
+                                       int             n,
+                                       int             k,
+                                       const T* const  x[],
+                                       int             incx,
+                                       const T* const  Y[],
+                                       int             ldy,
+                                       int             batch_count,
+                                       T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasDotMultiStridedBatched(hipblasHandle_t handle,
+                                              int             n,
+                                              int             k,
+                                              const T*        x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              const T*        Y,
+                                              int             ldy,
+                                              hipblasStride   strideY,
+                                              int             batch_count,
+                                              T*              result);
+
+template <typename T1, typename T2>
+hipblasStatus_t hipblasNormalize(hipblasHandle_t handle, int n, T1* x, int incx, T2* result);
+
+template <typename T1, typename T2>
+hipblasStatus_t hipblasNormalizeBatched(
+    hipblasHandle_t handle, int n, T1* const x[], int incx, int batch_count, T2* result);
+
+template <typename T1, typename T2>
+hipblasStatus_t hipblasNormalizeStridedBatched(hipblasHandle_t handle,
+                                               int             n,
+                                               T1*             x,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               int             batch_count,
+                                               T2*             result);
+
 // ger
 template <typename T, bool CONJ, bool FORTRAN = false>
 hipblasStatus_t hipblasGer(hipblasHandle_t handle,
@@ -1164,6 +1290,140 @@ hipblasStatus_t hipblasTrsvStridedBatched(hipblasHandle_t    handle,
                                           hipblasStride      stridex,
                                           int                batch_count);
 
+// tpttr
+template <typename T>
+hipblasStatus_t hipblasTpttr(hipblasHandle_t   handle,
+                             hipblasFillMode_t uplo,
+                             int               n,
+                             const T*          AP,
+                             T*                A,
+                             int               lda);
+
+template <typename T>
+hipblasStatus_t hipblasTpttrBatched(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const T* const    AP[],
+                                    T* const          A[],
+                                    int               lda,
+                                    int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTpttrStridedBatched(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const T*          AP,
+                                           hipblasStride     strideAP,
+                                           T*                A,
+                                           int               lda,
+                                           hipblasStride     strideA,
+                                           int               batchCount);
+
+// trttp
+template <typename T>
+hipblasStatus_t hipblasTrttp(hipblasHandle_t   handle,
+                             hipblasFillMode_t uplo,
+                             int               n,
+                             const T*          A,
+                             int               lda,
+                             T*                AP);
+
+template <typename T>
+hipblasStatus_t hipblasTrttpBatched(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               n,
+                                    const T* const    A[],
+                                    int               lda,
+                                    T* const          AP[],
+                                    int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTrttpStridedBatched(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const T*          A,
+                                           int               lda,
+                                           hipblasStride     strideA,
+                                           T*                AP,
+                                           hipblasStride     strideAP,
+                                           int               batchCount);
+
+// gbtge
+template <typename T>
+hipblasStatus_t hipblasGbtge(hipblasHandle_t handle,
+                             int             m,
+                             int             n,
+                             int             kl,
+                             int             ku,
+                             const T*        AB,
+                             int             ldab,
+                             T*              A,
+                             int             lda);
+
+template <typename T>
+hipblasStatus_t hipblasGbtgeBatched(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    int             kl,
+                                    int             ku,
+                                    const T* const  AB[],
+                                    int             ldab,
+                                    T* const        A[],
+                                    int             lda,
+                                    int             batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGbtgeStridedBatched(hipblasHandle_t handle,
+                                           int             m,
+                                           int             n,
+                                           int             kl,
+                                           int             ku,
+                                           const T*        AB,
+                                           int             ldab,
+                                           hipblasStride   strideAB,
+                                           T*              A,
+                                           int             lda,
+                                           hipblasStride   strideA,
+                                           int             batchCount);
+
+// getgb
+template <typename T>
+hipblasStatus_t hipblasGetgb(hipblasHandle_t handle,
+                             int             m,
+                             int             n,
+                             int             kl,
+                             int             ku,
+                             const T*        A,
+                             int             lda,
+                             T*              AB,
+                             int             ldab);
+
+template <typename T>
+hipblasStatus_t hipblasGetgbBatched(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    int             kl,
+                                    int             ku,
+                                    const T* const  A[],
+                                    int             lda,
+                                    T* const        AB[],
+                                    int             ldab,
+                                    int             batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetgbStridedBatched(hipblasHandle_t handle,
+                                           int             m,
+                                           int             n,
+                                           int             kl,
+                                           int             ku,
+                                           const T*        A,
+                                           int             lda,
+                                           hipblasStride   strideA,
+                                           T*              AB,
+                                           int             ldab,
+                                           hipblasStride   strideAB,
+                                           int             batchCount);
+
 // gbmv
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGbmv(hipblasHandle_t    handle,
@@ -1248,6 +1508,36 @@ hipblasStatus_t hipblasGemvBatched(hipblasHandle_t    handle,
                                    int                incy,
                                    int                batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasGemvBatchedHostPtrs(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           int                m,
+                                           int                n,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           int                lda,
+                                           const T* const     x[],
+                                           int                incx,
+                                           const T*           beta,
+                                           T* const           y[],
+                                           int                incy,
+                                           int                batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasGemvVbatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    const int          m[],
+                                    const int          n[],
+                                    const T*           alpha,
+                                    const T* const     A[],
+                                    const int          lda[],
+                                    const T* const     x[],
+                                    const int          incx[],
+                                    const T*           beta,
+                                    T* const           y[],
+                                    const int          incy[],
+                                    int                batch_count);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGemvStridedBatched(hipblasHandle_t    handle,
                                           hipblasOperation_t transA,
@@ -1319,6 +1609,77 @@ hipblasStatus_t hipblasGemmBatched(hipblasHandle_t    handle,
                                    int                ldc,
                                    int                batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasGemmBatchedHostPtrs(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           int                lda,
+                                           const T* const     B[],
+                                           int                ldb,
+                                           const T*           beta,
+                                           T* const           C[],
+                                           int                ldc,
+                                           int                batch_count);
+
+// gemm3m
+template <typename T>
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t    handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const T*           alpha,
+                              const T*           A,
+                              int                lda,
+                              const T*           B,
+                              int                ldb,
+                              const T*           beta,
+                              T*                 C,
+                              int                ldc);
+
+template <typename T>
+hipblasStatus_t hipblasGemm3mStridedBatched(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const T*           alpha,
+                                            const T*           A,
+                                            int                lda,
+                                            hipblasStride      strideA,
+                                            const T*           B,
+                                            int                ldb,
+                                            hipblasStride      strideB,
+                                            const T*           beta,
+                                            T*                 C,
+                                            int                ldc,
+                                            hipblasStride      strideC,
+                                            int                batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasGemm3mBatched(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const T*           alpha,
+                                     const T* const     A[],
+                                     int                lda,
+                                     const T* const     B[],
+                                     int                ldb,
+                                     const T*           beta,
+                                     T* const           C[],
+                                     int                ldc,
+                                     int                batch_count);
+
 // herk
 template <typename T, typename U, bool FORTRAN = false>
 hipblasStatus_t hipblasHerk(hipblasHandle_t    handle,
@@ -1347,6 +1708,20 @@ hipblasStatus_t hipblasHerkBatched(hipblasHandle_t    handle,
                                    int                ldc,
                                    int                batchCount);
 
+template <typename T, typename U>
+hipblasStatus_t hipblasHerkBatchedHostPtrs(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           int                n,
+                                           int                k,
+                                           const U*           alpha,
+                                           const T* const     A[],
+                                           int                lda,
+                                           const U*           beta,
+                                           T* const           C[],
+                                           int                ldc,
+                                           int                batchCount);
+
 template <typename T, typename U, bool FORTRAN = false>
 hipblasStatus_t hipblasHerkStridedBatched(hipblasHandle_t    handle,
                                           hipblasFillMode_t  uplo,
@@ -1497,6 +1872,22 @@ hipblasStatus_t hipblasSymmBatched(hipblasHandle_t   handle,
                                    int               ldc,
                                    int               batchCount);
 
+template <typename T>
+hipblasStatus_t hipblasSymmBatchedHostPtrs(hipblasHandle_t   handle,
+                                           hipblasSideMode_t side,
+                                           hipblasFillMode_t uplo,
+                                           int               m,
+                                           int               n,
+                                           const T*          alpha,
+                                           const T* const    A[],
+                                           int               lda,
+                                           const T* const    B[],
+                                           int               ldb,
+                                           const T*          beta,
+                                           T* const          C[],
+                                           int               ldc,
+                                           int               batchCount);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasSymmStridedBatched(hipblasHandle_t   handle,
                                           hipblasSideMode_t side,
@@ -1544,6 +1935,20 @@ hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t    handle,
                                    int                ldc,
                                    int                batchCount);
 
+template <typename T>
+hipblasStatus_t hipblasSyrkBatchedHostPtrs(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           int                n,
+                                           int                k,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           int                lda,
+                                           const T*           beta,
+                                           T* const           C[],
+                                           int                ldc,
+                                           int                batchCount);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t    handle,
                                           hipblasFillMode_t  uplo,
@@ -1694,6 +2099,22 @@ hipblasStatus_t hipblasGeamBatched(hipblasHandle_t    handle,
                                    int                ldc,
                                    int                batchCount);
 
+template <typename T>
+hipblasStatus_t hipblasGeamBatchedHostPtrs(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           int                m,
+                                           int                n,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           int                lda,
+                                           const T*           beta,
+                                           const T* const     B[],
+                                           int                ldb,
+                                           T* const           C[],
+                                           int                ldc,
+                                           int                batchCount);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t    handle,
                                           hipblasOperation_t transA,
@@ -1794,6 +2215,21 @@ hipblasStatus_t hipblasTrmmBatched(hipblasHandle_t    handle,
                                    int                ldb,
                                    int                batchCount);
 
+template <typename T>
+hipblasStatus_t hipblasTrmmBatchedHostPtrs(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           int                m,
+                                           int                n,
+                                           const T*           alpha,
+                                           const T* const     A[],
+                                           int                lda,
+                                           T* const           B[],
+                                           int                ldb,
+                                           int                batchCount);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasTrmmStridedBatched(hipblasHandle_t    handle,
                                           hipblasSideMode_t  side,
@@ -1841,6 +2277,21 @@ hipblasStatus_t hipblasTrsmBatched(hipblasHandle_t    handle,
                                    int                ldb,
                                    int                batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasTrsmBatchedHostPtrs(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           int                m,
+                                           int                n,
+                                           const T*           alpha,
+                                           T* const           A[],
+                                           int                lda,
+                                           T*                 B[],
+                                           int                ldb,
+                                           int                batch_count);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasTrsmStridedBatched(hipblasHandle_t    handle,
                                           hipblasSideMode_t  side,
@@ -93,7 +93,10 @@ struct Arguments
 
     int atomics_mode;
 
-    hipblas_initialization initialization;
+    hipblas_initialization initialization = hipblas_initialization::rand_int;
+
+    // file of the sizes of the instances of the variable size batched functions (Vbatched)
+    char sizes_file[256] = "";
 
     // clang-format off
 
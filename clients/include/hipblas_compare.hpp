@@ -0,0 +1,489 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _HIPBLAS_COMPARE_HPP_
+#define _HIPBLAS_COMPARE_HPP_
+
+#include "hipblas.h"
+#include "hipblas_thread_pool.hpp"
+#include "hipblas_vector.hpp"
+#include "utility.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief single pass comparison of a reference (usually CPU) and a result (usually GPU) matrix.
+ * Neither buffer is modified. The norm, unit and near checks are built on it.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Result of comparing M x N matrices; errors are ref - test */
+struct hipblas_compare_result
+{
+    double   ref_frobenius  = 0; // Frobenius norm of ref
+    double   diff_frobenius = 0; // Frobenius norm of ref - test
+    double   ref_max_abs    = 0; // max |ref|
+    double   diff_max_abs   = 0; // max |ref - test|, NaN when a difference is NaN
+    uint64_t max_ulp        = 0; // largest distance in units in the last place of a real part
+    size_t   mismatches     = 0; // elements outside the tolerance of the comparison
+    int64_t  first_batch    = -1; // first mismatch in (batch, column, row) order, -1 when none
+    int64_t  first_row      = -1;
+    int64_t  first_col      = -1;
+
+    bool equal() const
+    {
+        return mismatches == 0;
+    }
+
+    // Fold in the result of a later part of the same comparison
+    void merge(const hipblas_compare_result& r)
+    {
+        ref_frobenius  = std::hypot(ref_frobenius, r.ref_frobenius);
+        diff_frobenius = std::hypot(diff_frobenius, r.diff_frobenius);
+        ref_max_abs    = std::max(ref_max_abs, r.ref_max_abs);
+        diff_max_abs   = std::isnan(r.diff_max_abs) ? r.diff_max_abs
+                                                    : std::max(diff_max_abs, r.diff_max_abs);
+        max_ulp        = std::max(max_ulp, r.max_ulp);
+        if(!mismatches && r.mismatches)
+        {
+            first_batch = r.first_batch;
+            first_row   = r.first_row;
+            first_col   = r.first_col;
+        }
+        mismatches += r.mismatches;
+    }
+
+    std::string str() const
+    {
+        std::ostringstream s;
+        s << mismatches << " mismatch(es)";
+        if(mismatches)
+            s << ", first at batch " << first_batch << " row " << first_row << " col "
+              << first_col;
+        s << "; max ulp " << max_ulp << ", max |ref - test| " << diff_max_abs
+          << ", ||ref - test||_F / ||ref||_F " << diff_frobenius / ref_frobenius;
+        return s.str();
+    }
+};
+
+/* ============================================================================================ */
+/*  Per type access to the real parts of an element, and the distance in ULP of two of them.
+    unit_ulp is the distance above which unit_check_general fails: gtest's ASSERT_FLOAT_EQ and
+    ASSERT_DOUBLE_EQ allow 4 ULP, the other types are compared exactly.  */
+
+template <typename Tbits>
+inline uint64_t hipblas_ulp_distance(Tbits a, Tbits b)
+{
+    // sign and magnitude to biased, so that +0 and -0 coincide and the order is monotonic
+    constexpr Tbits sign = Tbits(1) << (sizeof(Tbits) * 8 - 1);
+
+    Tbits ba = a & sign ? Tbits(~a + 1) : Tbits(a | sign);
+    Tbits bb = b & sign ? Tbits(~b + 1) : Tbits(b | sign);
+    return ba > bb ? uint64_t(ba - bb) : uint64_t(bb - ba);
+}
+
+template <typename T>
+struct hipblas_compare_traits;
+
+template <>
+struct hipblas_compare_traits<float>
+{
+    static constexpr int      parts    = 1;
+    static constexpr uint64_t unit_ulp = 4;
+
+    static double part(float x, int)
+    {
+        return x;
+    }
+    static uint64_t ulp(float a, float b, int)
+    {
+        uint32_t ua, ub;
+        memcpy(&ua, &a, sizeof(ua));
+        memcpy(&ub, &b, sizeof(ub));
+        return hipblas_ulp_distance(ua, ub);
+    }
+};
+
+template <>
+struct hipblas_compare_traits<double>
+{
+    static constexpr int      parts    = 1;
+    static constexpr uint64_t unit_ulp = 4;
+
+    static double part(double x, int)
+    {
+        return x;
+    }
+    static uint64_t ulp(double a, double b, int)
+    {
+        uint64_t ua, ub;
+        memcpy(&ua, &a, sizeof(ua));
+        memcpy(&ub, &b, sizeof(ub));
+        return hipblas_ulp_distance(ua, ub);
+    }
+};
+
+template <>
+struct hipblas_compare_traits<hipblasHalf>
+{
+    static constexpr int      parts    = 1;
+    static constexpr uint64_t unit_ulp = 0;
+
+    static double part(hipblasHalf x, int)
+    {
+        return half_to_float(x);
+    }
+    static uint64_t ulp(hipblasHalf a, hipblasHalf b, int)
+    {
+        return hipblas_ulp_distance<uint16_t>(a, b);
+    }
+};
+
+template <>
+struct hipblas_compare_traits<hipblasBfloat16>
+{
+    static constexpr int      parts    = 1;
+    static constexpr uint64_t unit_ulp = 0;
+
+    static double part(hipblasBfloat16 x, int)
+    {
+        return bfloat16_to_float(x);
+    }
+    static uint64_t ulp(hipblasBfloat16 a, hipblasBfloat16 b, int)
+    {
+        return hipblas_ulp_distance<uint16_t>(a.data, b.data);
+    }
+};
+
+template <>
+struct hipblas_compare_traits<int32_t>
+{
+    static constexpr int      parts    = 1;
+    static constexpr uint64_t unit_ulp = 0;
+
+    static double part(int32_t x, int)
+    {
+        return x;
+    }
+    static uint64_t ulp(int32_t a, int32_t b, int)
+    {
+        return uint64_t(std::abs(int64_t(a) - int64_t(b)));
+    }
+};
+
+template <typename T, typename Tr>
+struct hipblas_compare_complex_traits
+{
+    static constexpr int      parts    = 2;
+    static constexpr uint64_t unit_ulp = 4;
+
+    static double part(const T& x, int p)
+    {
+        return p ? x.imag() : x.real();
+    }
+    static uint64_t ulp(const T& a, const T& b, int p)
+    {
+        return hipblas_compare_traits<Tr>::ulp(p ? a.imag() : a.real(), p ? b.imag() : b.real(), 0);
+    }
+};
+
+template <>
+struct hipblas_compare_traits<hipblasComplex>
+    : hipblas_compare_complex_traits<hipblasComplex, float>
+{
+};
+
+template <>
+struct hipblas_compare_traits<hipblasDoubleComplex>
+    : hipblas_compare_complex_traits<hipblasDoubleComplex, double>
+{
+};
+
+/* ============================================================================================ */
+/*  One column, rows [0, M). The norms come from a branch free loop over four independent
+    accumulators, which the compiler unrolls and vectorizes; a column whose sum of squares
+    overflows or underflows is summed again, scaled by its largest part as LAPACK's xlange does. The ULP and
+    mismatch scan is a second loop over the same, now cached, column.
+
+    A NaN in ref must be matched by a NaN in test. Otherwise an element is a mismatch when the
+    ULP distance of a part exceeds tolerance or, when abs_tolerance >= 0, when the absolute
+    difference of a part exceeds abs_tolerance.  */
+
+template <typename T>
+void hipblas_compare_column(int                     M,
+                            const T*                ref,
+                            const T*                test,
+                            uint64_t                tolerance,
+                            double                  abs_tolerance,
+                            int64_t                 batch,
+                            int64_t                 col,
+                            hipblas_compare_result& r)
+{
+    using traits = hipblas_compare_traits<T>;
+
+    // sum of squares, largest square and largest part magnitude of one element
+    auto accumulate = [](double x_re, double x_im, double& sq, double& mx2, double& mx) {
+        double x2 = x_re * x_re + x_im * x_im;
+        sq += x2;
+        mx2 = mx2 < x2 ? x2 : mx2;
+        mx  = std::max(mx, std::max(std::abs(x_re), std::abs(x_im)));
+    };
+    auto part = [](const T& x, int p) { return p < traits::parts ? traits::part(x, p) : 0.0; };
+
+    double ref_sq[4] = {}, ref_mx2[4] = {}, ref_mx[4] = {};
+    double diff_sq[4] = {}, diff_mx2[4] = {}, diff_mx[4] = {};
+
+    auto row = [&](int k, int u) {
+        double a_re = part(ref[k], 0), a_im = part(ref[k], 1);
+        double d_re = a_re - part(test[k], 0), d_im = a_im - part(test[k], 1);
+        accumulate(a_re, a_im, ref_sq[u], ref_mx2[u], ref_mx[u]);
+        accumulate(d_re, d_im, diff_sq[u], diff_mx2[u], diff_mx[u]);
+    };
+
+    int i = 0;
+    for(; i + 4 <= M; i += 4)
+        for(int u = 0; u < 4; u++)
+            row(i + u, u);
+    for(; i < M; i++)
+        row(i, 0);
+
+    auto sum4 = [](const double (&x)[4]) { return (x[0] + x[1]) + (x[2] + x[3]); };
+    auto max4 = [](const double (&x)[4]) {
+        return std::max(std::max(x[0], x[1]), std::max(x[2], x[3]));
+    };
+
+    // Frobenius norm and largest modulus of part_of, with the parts divided by scale so that
+    // their squares stay in range
+    auto scaled_norms = [&](double scale, auto&& part_of, double& frobenius, double& max_abs) {
+        double sq = 0, mx2 = 0;
+        for(int k = 0; k < M; k++)
+        {
+            double x2 = 0;
+            for(int p = 0; p < traits::parts; p++)
+            {
+                double x = part_of(k, p) / scale;
+                x2 += x * x;
+            }
+            sq += x2;
+            mx2 = std::max(mx2, x2);
+        }
+        frobenius = scale * std::sqrt(sq);
+        max_abs   = scale * std::sqrt(mx2);
+    };
+
+    hipblas_compare_result c;
+
+    double ref_sum = sum4(ref_sq), ref_scale = max4(ref_mx);
+    c.ref_frobenius = std::sqrt(ref_sum);
+    c.ref_max_abs   = std::sqrt(max4(ref_mx2));
+    if(std::isinf(ref_sum) || (ref_sum < DBL_MIN && ref_scale > 0))
+        scaled_norms(
+            ref_scale,
+            [&](int k, int p) { return traits::part(ref[k], p); },
+            c.ref_frobenius,
+            c.ref_max_abs);
+
+    double diff_sum = sum4(diff_sq), diff_scale = max4(diff_mx);
+    c.diff_frobenius = std::sqrt(diff_sum);
+    c.diff_max_abs   = std::isnan(diff_sum) ? diff_sum : std::sqrt(max4(diff_mx2));
+    if(std::isinf(diff_sum) || (diff_sum < DBL_MIN && diff_scale > 0))
+        scaled_norms(
+            diff_scale,
+            [&](int k, int p) { return traits::part(ref[k], p) - traits::part(test[k], p); },
+            c.diff_frobenius,
+            c.diff_max_abs);
+
+    for(int k = 0; k < M; k++)
+        for(int p = 0; p < traits::parts; p++)
+        {
+            double a = traits::part(ref[k], p), b = traits::part(test[k], p);
+            bool   mismatch;
+            if(std::isnan(a) || std::isnan(b))
+                mismatch = !std::isnan(a) || !std::isnan(b);
+            else
+            {
+                uint64_t ulp = traits::ulp(ref[k], test[k], p);
+                c.max_ulp    = std::max(c.max_ulp, ulp);
+                mismatch = abs_tolerance < 0 ? ulp > tolerance : std::abs(a - b) > abs_tolerance;
+            }
+
+            if(mismatch && !c.mismatches++)
+            {
+                c.first_batch = batch;
+                c.first_row   = k;
+                c.first_col   = col;
+            }
+        }
+
+    r.merge(c);
+}
+
+/* ============================================================================================ */
+/*! \brief  Compare batch_count M x N matrices; batch b starts at ref(b) and test(b).
+
+    The columns of every batch are cut into chunks of about hipblas_compare_chunk elements,
+    which are spread over the client thread pool and merged in order afterwards. The chunks only
+    depend on the sizes, so the result does not depend on the number of threads.
+
+    Returns one result per batch.  */
+
+constexpr size_t hipblas_compare_chunk = 16384;
+
+template <typename T, typename Ref, typename Test>
+std::vector<hipblas_compare_result> hipblas_compare_batches(int      M,
+                                                            int      N,
+                                                            int      lda,
+                                                            Ref&&    ref,
+                                                            Test&&   test,
+                                                            int      batch_count,
+                                                            uint64_t tolerance,
+                                                            double   abs_tolerance = -1)
+{
+    std::vector<hipblas_compare_result> batches(std::max(batch_count, 0));
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return batches;
+
+    size_t cols_per_chunk = std::max(size_t(1), hipblas_compare_chunk / size_t(M));
+    size_t chunks_per_b   = (N + cols_per_chunk - 1) / cols_per_chunk;
+
+    std::vector<hipblas_compare_result> chunks(chunks_per_b * batch_count);
+    hipblas_parallel_for(chunks.size(), [&](size_t c) {
+        size_t   b      = c / chunks_per_b;
+        size_t   j_end  = std::min(size_t(N), (c % chunks_per_b + 1) * cols_per_chunk);
+        const T* ref_b  = ref(b);
+        const T* test_b = test(b);
+        for(size_t j = c % chunks_per_b * cols_per_chunk; j < j_end; j++)
+            hipblas_compare_column<T>(M,
+                                      ref_b + j * lda,
+                                      test_b + j * lda,
+                                      tolerance,
+                                      abs_tolerance,
+                                      b,
+                                      j,
+                                      chunks[c]);
+    });
+
+    for(size_t c = 0; c < chunks.size(); c++)
+        batches[c / chunks_per_b].merge(chunks[c]);
+    return batches;
+}
+
+/*! \brief  As hipblas_compare_batches, with the batches merged into one result */
+template <typename T, typename Ref, typename Test>
+hipblas_compare_result hipblas_compare_all(int      M,
+                                           int      N,
+                                           int      lda,
+                                           Ref&&    ref,
+                                           Test&&   test,
+                                           int      batch_count,
+                                           uint64_t tolerance,
+                                           double   abs_tolerance = -1)
+{
+    hipblas_compare_result all;
+    for(auto& r :
+        hipblas_compare_batches<T>(M, N, lda, ref, test, batch_count, tolerance, abs_tolerance))
+        all.merge(r);
+    return all;
+}
+
+/* ============================================================================================ */
+/*  The layouts of the testers. The default tolerance is that of unit_check_general.  */
+
+template <typename T>
+hipblas_compare_result hipblas_compare(int      M,
+                                       int      N,
+                                       int      lda,
+                                       const T* ref,
+                                       const T* test,
+                                       uint64_t tolerance     = hipblas_compare_traits<T>::unit_ulp,
+                                       double   abs_tolerance = -1)
+{
+    return hipblas_compare_all<T>(
+        M,
+        N,
+        lda,
+        [=](size_t) { return ref; },
+        [=](size_t) { return test; },
+        1,
+        tolerance,
+        abs_tolerance);
+}
+
+template <typename T>
+hipblas_compare_result
+    hipblas_compare_strided_batched(int           M,
+                                    int           N,
+                                    int           lda,
+                                    hipblasStride stride,
+                                    const T*      ref,
+                                    const T*      test,
+                                    int           batch_count,
+                                    uint64_t      tolerance = hipblas_compare_traits<T>::unit_ulp,
+                                    double        abs_tolerance = -1)
+{
+    return hipblas_compare_all<T>(
+        M,
+        N,
+        lda,
+        [=](size_t b) { return ref + b * stride; },
+        [=](size_t b) { return test + b * stride; },
+        batch_count,
+        tolerance,
+        abs_tolerance);
+}
+
+template <typename T>
+hipblas_compare_result
+    hipblas_compare_batched(int            M,
+                            int            N,
+                            int            lda,
+                            const T* const ref[],
+                            const T* const test[],
+                            int            batch_count,
+                            uint64_t       tolerance     = hipblas_compare_traits<T>::unit_ulp,
+                            double         abs_tolerance = -1)
+{
+    return hipblas_compare_all<T>(
+        M,
+        N,
+        lda,
+        [=](size_t b) { return ref[b]; },
+        [=](size_t b) { return test[b]; },
+        batch_count,
+        tolerance,
+        abs_tolerance);
+}
+
+template <typename T>
+hipblas_compare_result
+    hipblas_compare_batched(int                  M,
+                            int                  N,
+                            int                  lda,
+                            const host_vector<T> ref[],
+                            const host_vector<T> test[],
+                            int                  batch_count,
+                            uint64_t             tolerance     = hipblas_compare_traits<T>::unit_ulp,
+                            double               abs_tolerance = -1)
+{
+    return hipblas_compare_all<T>(
+        M,
+        N,
+        lda,
+        [=](size_t b) { return ref[b].data(); },
+        [=](size_t b) { return test[b].data(); },
+        batch_count,
+        tolerance,
+        abs_tolerance);
+}
+
+#endif
@@ -159,6 +159,30 @@ module hipblas_interface
         res = hipblasGetAtomicsMode(handle, atomics_mode)
     end function hipblasGetAtomicsModeFortran
 
+    function hipblasSetCaptureModeFortran(handle, mode) &
+            result(res) &
+            bind(c, name = 'hipblasSetCaptureModeFortran')
+        use iso_c_binding
+        use hipblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        integer(kind(HIPBLAS_CAPTURE_MODE_SAFE)), value :: mode
+        integer(c_int) :: res
+        res = hipblasSetCaptureMode(handle, mode)
+    end function hipblasSetCaptureModeFortran
+
+    function hipblasGetCaptureModeFortran(handle, mode) &
+            result(res) &
+            bind(c, name = 'hipblasGetCaptureModeFortran')
+        use iso_c_binding
+        use hipblas_enums
+        implicit none
+        type(c_ptr), value :: handle
+        type(c_ptr), value :: mode
+        integer(c_int) :: res
+        res = hipblasGetCaptureMode(handle, mode)
+    end function hipblasGetCaptureModeFortran
+
     !--------!
     ! blas 1 !
     !--------!
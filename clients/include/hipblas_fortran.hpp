@@ -45,6 +45,10 @@ hipblasStatus_t hipblasSetAtomicsModeFortran(hipblasHandle_t      handle,
 hipblasStatus_t hipblasGetAtomicsModeFortran(hipblasHandle_t       handle,
                                              hipblasAtomicsMode_t* atomics_mode);
 
+hipblasStatus_t hipblasSetCaptureModeFortran(hipblasHandle_t handle, hipblasCaptureMode_t mode);
+
+hipblasStatus_t hipblasGetCaptureModeFortran(hipblasHandle_t handle, hipblasCaptureMode_t* mode);
+
 /* ==========
  *    L1
  * ========== */
@@ -24,6 +24,8 @@
 #define hipblasGetMatrixAsyncFortran hipblasGetMatrixAsync
 #define hipblasSetAtomicsModeFortran hipblasSetAtomicsMode
 #define hipblasGetAtomicsModeFortran hipblasGetAtomicsMode
+#define hipblasSetCaptureModeFortran hipblasSetCaptureMode
+#define hipblasGetCaptureModeFortran hipblasGetCaptureMode
 
 /* ==========
  *    L1
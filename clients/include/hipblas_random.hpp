@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _HIPBLAS_RANDOM_HPP_
+#define _HIPBLAS_RANDOM_HPP_
+
+#include "hipblas_thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+/*!\file
+ * \brief counter based random numbers for the initialization of test and benchmark data.
+ *
+ * Element (batch, row, col) of a fill with a given seed is the Philox4x32-10 block of the counter
+ * (row, col, batch, 0) under the key (seed, 0) (Salmon et al., "Parallel random numbers: as easy
+ * as 1, 2, 3", SC11). Elements are independent of each other and of the fill order, so matrices
+ * are filled in parallel and the data does not depend on the number of threads.
+ */
+
+/* ============================================================================================ */
+/*! \brief  The random words of one element */
+struct hipblas_random_bits
+{
+    uint32_t w[2];
+};
+
+constexpr uint32_t hipblas_philox_m0 = 0xD2511F53;
+constexpr uint32_t hipblas_philox_m1 = 0xCD9E8D57;
+constexpr uint32_t hipblas_philox_w0 = 0x9E3779B9;
+constexpr uint32_t hipblas_philox_w1 = 0xBB67AE85;
+
+/* ============================================================================================ */
+/*! \brief  Random bits of hipblas_random_run consecutive elements, along a column (rows
+            row .. row + run - 1 of col) or, for vectors stored as 1 x N, along a row. The
+            counters only differ in one word, so the rounds run on all of them at once in SIMD
+            registers.  */
+constexpr int hipblas_random_run = 16;
+
+inline void hipblas_random_block(uint32_t            seed,
+                                 uint32_t            batch,
+                                 uint32_t            row,
+                                 uint32_t            col,
+                                 bool                along_row,
+                                 hipblas_random_bits bits[hipblas_random_run])
+{
+    uint32_t c0[hipblas_random_run], c1[hipblas_random_run], c2[hipblas_random_run],
+        c3[hipblas_random_run];
+    for(int r = 0; r < hipblas_random_run; r++)
+    {
+        c0[r] = along_row ? row : row + r;
+        c1[r] = along_row ? col + r : col;
+        c2[r] = batch;
+        c3[r] = 0;
+    }
+
+    uint32_t k0 = seed, k1 = 0;
+    for(int round = 0; round < 10; round++)
+    {
+        for(int r = 0; r < hipblas_random_run; r++)
+        {
+            uint64_t p0 = uint64_t(hipblas_philox_m0) * c0[r];
+            uint64_t p1 = uint64_t(hipblas_philox_m1) * c2[r];
+
+            c0[r] = uint32_t(p1 >> 32) ^ c1[r] ^ k0;
+            c1[r] = uint32_t(p1);
+            c2[r] = uint32_t(p0 >> 32) ^ c3[r] ^ k1;
+            c3[r] = uint32_t(p0);
+        }
+        k0 += hipblas_philox_w0;
+        k1 += hipblas_philox_w1;
+    }
+
+    for(int r = 0; r < hipblas_random_run; r++)
+        bits[r] = {{c0[r], c1[r]}};
+}
+
+/*! \brief  Seed of the next fill. It is drawn from rand(), so a tester which calls srand(1)
+            keeps getting the same data, and consecutive fills differ.  */
+inline uint32_t hipblas_random_seed()
+{
+    return uint32_t(rand());
+}
+
+/* ============================================================================================ */
+/*! \brief  Set columns [j_begin, j_end) of an M x N matrix of batch b to value(b, i, j, bits),
+            where bits are the random bits of element (b, i, j). A points at column j_begin and
+            ld may be negative, for vectors with negative increments.  */
+template <typename T, typename Value>
+void hipblas_fill_columns(T*        A,
+                          ptrdiff_t ld,
+                          int       M,
+                          int       j_begin,
+                          int       j_end,
+                          size_t    b,
+                          uint32_t  seed,
+                          Value&&   value)
+{
+    hipblas_random_bits bits[hipblas_random_run];
+
+    // vectors (M == 1) are generated along the row, matrices along the columns
+    if(M == 1)
+    {
+        for(int j0 = j_begin; j0 < j_end; j0 += hipblas_random_run)
+        {
+            hipblas_random_block(seed, uint32_t(b), 0, j0, true, bits);
+            for(int r = 0; r < std::min(hipblas_random_run, j_end - j0); r++)
+                A[(j0 + r - j_begin) * ld] = value(b, 0, j0 + r, bits[r]);
+        }
+        return;
+    }
+
+    for(int j = j_begin; j < j_end; j++)
+    {
+        T* col = A + (j - j_begin) * ld;
+        for(int i0 = 0; i0 < M; i0 += hipblas_random_run)
+        {
+            hipblas_random_block(seed, uint32_t(b), i0, j, false, bits);
+            for(int r = 0; r < std::min(hipblas_random_run, M - i0); r++)
+                col[i0 + r] = value(b, i0 + r, j, bits[r]);
+        }
+    }
+}
+
+/*! \brief  Columns per unit of work of the parallel fills, about 16K elements */
+inline int hipblas_fill_chunk_columns(int M)
+{
+    return std::max(1, 16384 / std::max(M, 1));
+}
+
+/*! \brief  Set element (i, j) of every M x N matrix b, stored from ptr(b) with leading dimension
+            ld, to value(b, i, j, bits).
+
+    Chunks of columns of all batches are spread over the client thread pool. Batches which share
+    memory, and matrices whose columns overlap, are filled in order so that the last write wins
+    as it would in a serial loop.  */
+template <typename T, typename Ptr, typename Value>
+void hipblas_fill(int       M,
+                  int       N,
+                  ptrdiff_t ld,
+                  Ptr&&     ptr,
+                  int       batch_count,
+                  bool      batches_overlap,
+                  uint32_t  seed,
+                  Value&&   value)
+{
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return;
+
+    int    cols_per_chunk = hipblas_fill_chunk_columns(M);
+    size_t chunks_per_b   = (N + cols_per_chunk - 1) / cols_per_chunk;
+
+    auto fill_chunk = [&](size_t b, size_t chunk) {
+        int j_begin = int(chunk * cols_per_chunk);
+        int j_end   = std::min(N, j_begin + cols_per_chunk);
+        hipblas_fill_columns(ptr(b) + j_begin * ld, ld, M, j_begin, j_end, b, seed, value);
+    };
+
+    if(std::abs(ld) < M)
+    {
+        for(size_t b = 0; b < size_t(batch_count); b++)
+            for(size_t c = 0; c < chunks_per_b; c++)
+                fill_chunk(b, c);
+    }
+    else if(batches_overlap)
+    {
+        for(size_t b = 0; b < size_t(batch_count); b++)
+            hipblas_parallel_for(chunks_per_b, [&](size_t c) { fill_chunk(b, c); });
+    }
+    else
+    {
+        hipblas_parallel_for(chunks_per_b * batch_count, [&](size_t c) {
+            fill_chunk(c / chunks_per_b, c % chunks_per_b);
+        });
+    }
+}
+
+/*! \brief  Whether strided batches of M x N matrices with leading dimension ld share memory */
+inline bool hipblas_batches_overlap(int M, int N, ptrdiff_t ld, ptrdiff_t stride, int batch_count)
+{
+    if(batch_count <= 1 || M <= 0 || N <= 0)
+        return false;
+    ptrdiff_t extent = (M - 1) + (N - 1) * std::abs(ld) + 1;
+    return std::abs(stride) < extent;
+}
+
+#endif
@@ -0,0 +1,111 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _HIPBLAS_REF_CACHE_HPP_
+#define _HIPBLAS_REF_CACHE_HPP_
+
+#include "hipblas_arguments.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <typeinfo>
+#include <vector>
+
+/*!\file
+ * \brief opt-in on-disk cache of CPU reference results. When HIPBLAS_REF_CACHE names a directory,
+ * the outputs of a reference computation are stored there, one file per key, and later runs map
+ * the file instead of recomputing. The key hashes the problem fields of Arguments (those listed
+ * by FOR_EACH_ARGUMENT, less the ones which only control how a test runs), the routine, the data
+ * type and the contents of every input, so any change of the data or of its initialization gives
+ * a new key. Each file carries a checksum of its payload; entries which fail it are recomputed.
+ */
+
+/* ============================================================================================ */
+/*! \brief  An input of a reference computation */
+struct hipblas_ref_data
+{
+    const void* data;
+    size_t      bytes;
+
+    hipblas_ref_data(const void* data, size_t bytes)
+        : data(data)
+        , bytes(bytes)
+    {
+    }
+
+    template <typename T>
+    hipblas_ref_data(const std::vector<T>& v)
+        : data(v.data())
+        , bytes(v.size() * sizeof(T))
+    {
+    }
+};
+
+/*! \brief  An output of a reference computation. Its contents before the computation are an input
+            too, for routines which update their output in place */
+struct hipblas_ref_output
+{
+    void*  data;
+    size_t bytes;
+
+    hipblas_ref_output(void* data, size_t bytes)
+        : data(data)
+        , bytes(bytes)
+    {
+    }
+
+    template <typename T>
+    hipblas_ref_output(std::vector<T>& v)
+        : data(v.data())
+        , bytes(v.size() * sizeof(T))
+    {
+    }
+};
+
+/*! \brief  Directory of the reference cache, nullptr when HIPBLAS_REF_CACHE is not set */
+const char* hipblas_ref_cache_dir();
+
+/*! \brief  64-bit hash of bytes of data, continuing from seed */
+uint64_t hipblas_ref_hash(const void* data, size_t bytes, uint64_t seed = 0);
+
+/*! \brief  Key of the reference computation routine<type>(arg) on the given data */
+uint64_t hipblas_ref_cache_key(const Arguments&                         arg,
+                               const char*                              routine,
+                               const char*                              type,
+                               std::initializer_list<hipblas_ref_data>   inputs,
+                               std::initializer_list<hipblas_ref_output> outputs);
+
+/*! \brief  Fill the outputs from the cache entry of key; false when there is no valid entry */
+bool hipblas_ref_cache_load(uint64_t key, std::initializer_list<hipblas_ref_output> outputs);
+
+/*! \brief  Store the outputs as the cache entry of key */
+void hipblas_ref_cache_store(uint64_t key, std::initializer_list<hipblas_ref_output> outputs);
+
+/* ============================================================================================ */
+/*! \brief  Run the reference computation ref(), which reads the inputs and writes the outputs,
+            unless the cache holds its result. Without HIPBLAS_REF_CACHE this is just ref().  */
+template <typename T, typename F>
+void hipblas_ref_cached(const Arguments&                         arg,
+                        const char*                              routine,
+                        std::initializer_list<hipblas_ref_data>   inputs,
+                        std::initializer_list<hipblas_ref_output> outputs,
+                        F&&                                      ref)
+{
+    if(!hipblas_ref_cache_dir())
+    {
+        ref();
+        return;
+    }
+
+    uint64_t key = hipblas_ref_cache_key(arg, routine, typeid(T).name(), inputs, outputs);
+    if(hipblas_ref_cache_load(key, outputs))
+        return;
+
+    ref();
+    hipblas_ref_cache_store(key, outputs);
+}
+
+#endif
@@ -0,0 +1,37 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _HIPBLAS_THREAD_POOL_HPP_
+#define _HIPBLAS_THREAD_POOL_HPP_
+
+#include <cstddef>
+#include <functional>
+
+/*!\file
+ * \brief host thread pool for the CPU side of the clients (reference results, comparisons and
+ * initialization). Not part of the GPU library.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Run body(i) for every i in [0, n), spread over the client thread pool.
+
+    Each participating thread owns a contiguous part of the range which it works through
+    front to back in chunks of grain; a thread which runs out of work steals the back half of
+    the largest remaining part. The calling thread takes part, and the call returns once every
+    index has been processed. The first exception thrown by body is rethrown to the caller.
+
+    While a loop runs in parallel the host BLAS/LAPACK is limited to one thread per worker, so
+    that multi-threaded OpenBLAS, BLIS or OpenMP builds do not oversubscribe the host.
+
+    The loop runs serially on the calling thread when n < 2, when called from inside another
+    parallel loop, or while another thread is using the pool.
+
+    The pool size is the number of hardware threads, or HIPBLAS_CLIENT_THREADS when set.  */
+void hipblas_parallel_for(size_t n, const std::function<void(size_t)>& body, size_t grain = 1);
+
+/*! \brief  Number of threads taking part in hipblas_parallel_for, the caller included */
+size_t hipblas_thread_pool_size();
+
+#endif
@@ -80,26 +80,36 @@ struct host_vector : std::vector<T>
 //!
 //! @brief Template for initializing a host (non_batched|batched|strided_batched)vector.
 //! @param that That vector.
-//! @param rand_gen The random number generator
+//! @param alternating_sign Odd elements positive and even elements negative if true.
 //! @param seedReset Reset the seed if true, do not reset the seed otherwise.
 //!
-template <typename U, typename T>
-void hipblas_init_template(U& that, T rand_gen(), bool seedReset)
+template <typename U>
+void hipblas_init_template(U& that, bool alternating_sign, bool seedReset)
 {
+    using T = std::remove_pointer_t<decltype(that[0])>;
+
     if(seedReset)
         hipblas_seedrand();
 
-    for(int batch_index = 0; batch_index < that.batch_count(); ++batch_index)
-    {
-        auto*     batched_data = that[batch_index];
-        ptrdiff_t inc          = that.inc();
-        auto      n            = that.n();
-        if(inc < 0)
-            batched_data -= (n - 1) * inc;
-
-        for(int i = 0; i < n; ++i)
-            batched_data[i * inc] = rand_gen();
-    }
+    ptrdiff_t inc = that.inc();
+    int       n   = that.n();
+
+    // element i of a batch is element (0, i) of a 1 x n matrix with leading dimension inc
+    hipblas_fill<T>(
+        1,
+        n,
+        inc,
+        [&](size_t b) {
+            T* batched_data = that[int(b)];
+            return inc < 0 ? batched_data - (n - 1) * inc : batched_data;
+        },
+        that.batch_count(),
+        false,
+        hipblas_random_seed(),
+        [=](size_t, int, int i, const hipblas_random_bits& r) {
+            return alternating_sign && !(i % 2) ? random_generator_negative<T>(r)
+                                                : random_generator<T>(r);
+        });
 }
 
 //!
@@ -110,45 +120,111 @@ void hipblas_init_template(U& that, T rand_gen(), bool seedReset)
 template <typename T>
 inline void hipblas_init(host_batch_vector<T>& that, bool seedReset = false)
 {
-    hipblas_init_template(that, random_generator<T>, seedReset);
+    hipblas_init_template(that, false, seedReset);
+}
+
+template <typename T>
+void hipblas_init_alternating_sign(host_batch_vector<T>& that, bool seedReset = false)
+{
+    hipblas_init_template(that, true, seedReset);
 }
 
 //!
-//! @brief Template for initializing a host (non_batched|batched|strided_batched)vector.
-//! @param that That vector.
-//! @param rand_gen The random number generator for odd elements
-//! @param rand_gen_alt The random number generator for even elements
-//! @param seedReset Reset the seed if true, do not reset the seed otherwise.
+//! @brief Initialize device matrices with the values hipblas_init would give host matrices of the
+//!        same layout, without a host copy of them. Columns are generated in parallel into two
+//!        pinned staging buffers, each one copied to the device while the other is being filled.
+//!        Rows past M and the gaps between batches are zeroed, as in a new host_vector, so the
+//!        device data is the same as that of a host fill followed by a copy.
+//! @param dA The device matrices, of (batch_count - 1) * stride + lda * N elements.
+//! @param init The initialization, rand_int, trig_float or hpl.
+//! @param stream The stream the copies run on.
 //!
-template <typename U, typename T>
-void hipblas_init_alternating_template(U& that, T rand_gen(), T rand_gen_alt(), bool seedReset)
+template <typename T>
+hipError_t hipblas_init_device(T*                     dA,
+                               int                    M,
+                               int                    N,
+                               int                    lda,
+                               hipblasStride          stride      = 0,
+                               int                    batch_count = 1,
+                               hipblas_initialization init = hipblas_initialization::rand_int,
+                               hipStream_t            stream = 0)
 {
-    if(seedReset)
-        hipblas_seedrand();
+    // drawn first, so that rand() advances as in hipblas_init
+    uint32_t seed = hipblas_random_seed();
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return hipSuccess;
 
-    for(int b = 0; b < that.batch_count(); ++b)
+    size_t     extent = (batch_count - 1) * size_t(stride) + size_t(lda) * N;
+    hipError_t status = hipMemsetAsync(dA, 0, extent * sizeof(T), stream);
+
+    // columns per staging buffer: at least one and about 32 MB
+    constexpr size_t staging_bytes = size_t(32) << 20;
+
+    size_t cols  = std::min(size_t(N), std::max(size_t(1), staging_bytes / (lda * sizeof(T))));
+    size_t elems = size_t(lda) * cols;
+
+    T*         staging[2] = {};
+    hipEvent_t copied[2]  = {};
+    for(int s = 0; s < 2 && status == hipSuccess; s++)
     {
-        auto*     batched_data = that[b];
-        ptrdiff_t inc          = that.inc();
-        auto      n            = that.n();
-        if(inc < 0)
-            batched_data -= (n - 1) * inc;
+        status = hipHostMalloc((void**)&staging[s], elems * sizeof(T), hipHostMallocDefault);
+        if(status == hipSuccess)
+            status = hipEventCreateWithFlags(&copied[s], hipEventDisableTiming);
+    }
 
-        for(int i = 0; i < n; ++i)
+    int chunk = hipblas_fill_chunk_columns(M);
+    int s     = 0;
+    for(int b = 0; b < batch_count && status == hipSuccess; b++)
+        for(int j0 = 0; j0 < N && status == hipSuccess; j0 += cols, s ^= 1)
         {
-            if(i % 2)
-                batched_data[i * inc] = rand_gen();
-            else
-                batched_data[i * inc] = rand_gen_alt();
+            int j1 = int(std::min(size_t(N), j0 + cols));
+
+            // wait for the previous copy out of this buffer
+            status = hipEventSynchronize(copied[s]);
+            if(status != hipSuccess)
+                break;
+
+            hipblas_parallel_for((j1 - j0 + chunk - 1) / chunk, [&](size_t c) {
+                int j_begin = j0 + int(c) * chunk;
+                hipblas_fill_columns(staging[s] + size_t(j_begin - j0) * lda,
+                                     lda,
+                                     M,
+                                     j_begin,
+                                     std::min(j1, j_begin + chunk),
+                                     b,
+                                     seed,
+                                     [=](size_t b, int i, int j, const hipblas_random_bits& r) {
+                                         return hipblas_init_value<T>(
+                                             init, r, i + j * size_t(lda) + b * stride);
+                                     });
+            });
+
+            // rows [0, M) only, which keeps the zeros and, when batches overlap, the order of a
+            // host fill
+            status = hipMemcpy2DAsync(dA + b * stride + size_t(j0) * lda,
+                                      lda * sizeof(T),
+                                      staging[s],
+                                      lda * sizeof(T),
+                                      M * sizeof(T),
+                                      j1 - j0,
+                                      hipMemcpyHostToDevice,
+                                      stream);
+            if(status == hipSuccess)
+                status = hipEventRecord(copied[s], stream);
         }
-    }
-}
 
-template <typename T>
-void hipblas_init_alternating_sign(host_batch_vector<T>& that, bool seedReset = false)
-{
-    hipblas_init_alternating_template(
-        that, random_generator<T>, random_generator_negative<T>, seedReset);
+    for(int s = 0; s < 2; s++)
+    {
+        if(copied[s])
+        {
+            hipError_t sync = hipEventSynchronize(copied[s]);
+            status          = status == hipSuccess ? sync : status;
+            hipEventDestroy(copied[s]);
+        }
+        if(staging[s])
+            hipHostFree(staging[s]);
+    }
+    return status;
 }
 
 #endif
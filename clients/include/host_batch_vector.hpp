@@ -13,6 +13,7 @@ class device_batch_vector;
 
 //!
 //! @brief Implementation of the batch vector on host.
+//!  The vectors are stored back to back in a single allocation.
 //!
 template <typename T>
 class host_batch_vector
@@ -137,6 +138,14 @@ public:
         return this->m_data;
     }
 
+    //!
+    //! @brief Returns the distance in elements between consecutive vectors of the batch.
+    //!
+    size_t pitch() const
+    {
+        return size_t(this->m_n) * std::abs(this->m_inc);
+    }
+
     //!
     //! @brief Copy from a host batched vector.
     //! @param that the vector the data is copied from.
@@ -147,10 +156,9 @@ public:
         if((this->batch_count() == that.batch_count()) && (this->n() == that.n())
            && (this->inc() == that.inc()))
         {
-            size_t num_bytes = this->n() * std::abs(this->inc()) * sizeof(T);
-            for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+            if(this->m_batch_count > 0)
             {
-                memcpy((*this)[batch_index], that[batch_index], num_bytes);
+                memcpy(this->m_slab, that.m_slab, this->pitch() * this->m_batch_count * sizeof(T));
             }
             return true;
         }
@@ -167,18 +175,26 @@ public:
     //!
     hipError_t transfer_from(const device_batch_vector<T>& that)
     {
-        hipError_t hip_err;
-        size_t     num_bytes = size_t(this->m_n) * std::abs(this->m_inc) * sizeof(T);
-        for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-        {
-            if(hipSuccess
-               != (hip_err = hipMemcpy(
-                       (*this)[batch_index], that[batch_index], num_bytes, hipMemcpyDeviceToHost)))
-            {
-                return hip_err;
-            }
-        }
-        return hipSuccess;
+        //
+        // Copy all vectors at once, the device vectors may be padded.
+        //
+        size_t nmemb = this->pitch();
+        if(!this->m_batch_count || !nmemb)
+            return hipSuccess;
+
+        if(that.pitch() == nmemb)
+            return hipMemcpy(this->m_slab,
+                             that[0],
+                             sizeof(T) * nmemb * this->m_batch_count,
+                             hipMemcpyDeviceToHost);
+
+        return hipMemcpy2D(this->m_slab,
+                           sizeof(T) * nmemb,
+                           that[0],
+                           sizeof(T) * that.pitch(),
+                           sizeof(T) * nmemb,
+                           this->m_batch_count,
+                           hipMemcpyDeviceToHost);
     }
 
     //!
@@ -194,6 +210,7 @@ private:
     int m_n{};
     int m_inc{};
     int m_batch_count{};
+    T*  m_slab{};
     T** m_data{};
 
     bool try_initialize_memory()
@@ -201,13 +218,15 @@ private:
         bool success = (nullptr != (this->m_data = (T**)calloc(this->m_batch_count, sizeof(T*))));
         if(success)
         {
-            size_t nmemb = size_t(this->m_n) * std::abs(this->m_inc);
-            for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
+            size_t nmemb = this->pitch();
+            success      = (nullptr
+                       != (this->m_slab = (T*)calloc(
+                               std::max(nmemb * this->m_batch_count, size_t(1)), sizeof(T))));
+            if(success)
             {
-                success = (nullptr != (this->m_data[batch_index] = (T*)calloc(nmemb, sizeof(T))));
-                if(false == success)
+                for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
                 {
-                    break;
+                    this->m_data[batch_index] = this->m_slab + batch_index * nmemb;
                 }
             }
         }
@@ -216,19 +235,10 @@ private:
 
     void free_memory()
     {
-        if(nullptr != this->m_data)
-        {
-            for(int batch_index = 0; batch_index < this->m_batch_count; ++batch_index)
-            {
-                if(nullptr != this->m_data[batch_index])
-                {
-                    free(this->m_data[batch_index]);
-                    this->m_data[batch_index] = nullptr;
-                }
-            }
+        free(this->m_slab);
+        this->m_slab = nullptr;
 
-            free(this->m_data);
-            this->m_data = nullptr;
-        }
+        free(this->m_data);
+        this->m_data = nullptr;
     }
 };
@@ -8,6 +8,7 @@
 #define _NORM_H
 
 #include "hipblas.h"
+#include "hipblas_compare.hpp"
 #include "hipblas_vector.hpp"
 
 /* =====================================================================
@@ -15,7 +16,8 @@
     =================================================================== */
 
 /*!\file
- * \brief compares two results (usually, CPU and GPU results); provides Norm check
+ * \brief compares two results (usually, CPU and GPU results); provides Norm check. The
+ * checks only read the two results.
  */
 
 /* ========================================Norm Check
@@ -34,37 +36,42 @@ double norm_check_general(char norm_type, int M, int N, int lda, T* hCPU, T* hGP
 template <typename T>
 double norm_check_symmetric(char norm_type, char uplo, int N, int lda, T* hCPU, T* hGPU);
 
-template <typename T>
-double norm_check_general(char           norm_type,
-                          int            M,
-                          int            N,
-                          int            lda,
-                          host_vector<T> hCPU[],
-                          host_vector<T> hGPU[],
-                          int            batch_count)
+/* ============== Norm Check for batched and strided_batched cases ============= */
+
+// norm type can be O', 'I', 'F', 'M', 'o', 'i', 'f', 'm' for one, infinity, Frobenius or max norm
+// one norm is max column sum
+// infinity norm is max row sum
+// Frobenius is l2 norm of matrix entries
+//
+// use triangle inequality ||a+b|| <= ||a|| + ||b|| to calculate upper limit for Frobenius norm
+// of batched matrices; the other norms take the largest error of the batch.
+//
+// The Frobenius and max norms of all batches come from a single parallel pass of
+// hipblas_compare_batches; batch b of the reference and the result start at ref(b) and test(b).
+template <typename T, typename Ref, typename Test>
+double norm_check_batches(
+    char norm_type, int M, int N, int lda, Ref&& ref, Test&& test, int batch_count)
 {
-    // norm type can be O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
-    // one norm is max column sum
-    // infinity norm is max row sum
-    // Frobenius is l2 norm of matrix entries
-    //
-    // use triangle inequality ||a+b|| <= ||a|| + ||b|| to calculate upper limit for Frobenius norm
-    // of strided batched matrix
-
     double cumulative_error = 0.0;
 
-    for(int i = 0; i < batch_count; i++)
+    bool frobenius = norm_type == 'F' || norm_type == 'f';
+    if(frobenius || norm_type == 'M' || norm_type == 'm')
     {
-        auto index = i;
-
-        auto error = norm_check_general<T>(norm_type, M, N, lda, hCPU[index], hGPU[index]);
-
-        if(norm_type == 'F' || norm_type == 'f')
+        for(auto& r : hipblas_compare_batches<T>(
+                M, N, lda, ref, test, batch_count, hipblas_compare_traits<T>::unit_ulp))
         {
-            cumulative_error += error;
+            if(frobenius)
+                cumulative_error += r.diff_frobenius / r.ref_frobenius;
+            else
+                cumulative_error = std::max(cumulative_error, r.diff_max_abs / r.ref_max_abs);
         }
-        else if(norm_type == 'O' || norm_type == 'o' || norm_type == 'I' || norm_type == 'i')
+    }
+    else if(norm_type == 'O' || norm_type == 'o' || norm_type == 'I' || norm_type == 'i')
+    {
+        for(int b = 0; b < batch_count; b++)
         {
+            auto error = norm_check_general<T>(
+                norm_type, M, N, lda, const_cast<T*>(ref(b)), const_cast<T*>(test(b)));
             cumulative_error = cumulative_error > error ? cumulative_error : error;
         }
     }
@@ -72,38 +79,37 @@ double norm_check_general(char           norm_type,
     return cumulative_error;
 }
 
-/* ============== Norm Check for strided_batched case ============= */
+template <typename T>
+double norm_check_general(char           norm_type,
+                          int            M,
+                          int            N,
+                          int            lda,
+                          host_vector<T> hCPU[],
+                          host_vector<T> hGPU[],
+                          int            batch_count)
+{
+    return norm_check_batches<T>(
+        norm_type,
+        M,
+        N,
+        lda,
+        [=](size_t b) { return (const T*)hCPU[b]; },
+        [=](size_t b) { return (const T*)hGPU[b]; },
+        batch_count);
+}
+
 template <typename T>
 double norm_check_general(
     char norm_type, int M, int N, int lda, ptrdiff_t stride_a, T* hCPU, T* hGPU, int batch_count)
 {
-    // norm type can be O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
-    // one norm is max column sum
-    // infinity norm is max row sum
-    // Frobenius is l2 norm of matrix entries
-    //
-    // use triangle inequality ||a+b|| <= ||a|| + ||b|| to calculate upper limit for Frobenius norm
-    // of strided batched matrix
-
-    double cumulative_error = 0.0;
-
-    for(size_t i = 0; i < batch_count; i++)
-    {
-        auto index = i * stride_a;
-
-        auto error = norm_check_general(norm_type, M, N, lda, hCPU + index, hGPU + index);
-
-        if(norm_type == 'F' || norm_type == 'f')
-        {
-            cumulative_error += error;
-        }
-        else if(norm_type == 'O' || norm_type == 'o' || norm_type == 'I' || norm_type == 'i')
-        {
-            cumulative_error = cumulative_error > error ? cumulative_error : error;
-        }
-    }
-
-    return cumulative_error;
+    return norm_check_batches<T>(
+        norm_type,
+        M,
+        N,
+        lda,
+        [=](size_t b) { return (const T*)hCPU + b * stride_a; },
+        [=](size_t b) { return (const T*)hGPU + b * stride_a; },
+        batch_count);
 }
 
 template <typename T, typename T_hpa>
@@ -115,33 +121,14 @@ double norm_check_general(char                      norm_type,
                           host_batch_vector<T>&     hGPU,
                           int                       batch_count)
 {
-    // norm type can be O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
-    // one norm is max column sum
-    // infinity norm is max row sum
-    // Frobenius is l2 norm of matrix entries
-    //
-    // use triangle inequality ||a+b|| <= ||a|| + ||b|| to calculate upper limit for Frobenius norm
-    // of strided batched matrix
-
-    double cumulative_error = 0.0;
-
-    for(int i = 0; i < batch_count; i++)
-    {
-        auto index = i;
-
-        auto error = norm_check_general<T>(norm_type, M, N, lda, hCPU[index], hGPU[index]);
-
-        if(norm_type == 'F' || norm_type == 'f')
-        {
-            cumulative_error += error;
-        }
-        else if(norm_type == 'O' || norm_type == 'o' || norm_type == 'I' || norm_type == 'i')
-        {
-            cumulative_error = cumulative_error > error ? cumulative_error : error;
-        }
-    }
-
-    return cumulative_error;
+    return norm_check_batches<T>(
+        norm_type,
+        M,
+        N,
+        lda,
+        [&](size_t b) { return static_cast<const T*>(hCPU[b]); },
+        [&](size_t b) { return static_cast<const T*>(hGPU[b]); },
+        batch_count);
 }
 
 template <typename T>
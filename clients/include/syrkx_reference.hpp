@@ -3,14 +3,222 @@
  *
  * ************************************************************************ */
 
-#include <fstream>
+#pragma once
+#ifndef _SYRKX_REFERENCE_HPP_
+#define _SYRKX_REFERENCE_HPP_
+
+#include "complex.hpp"
+#include "hipblas.h"
+#include "hipblas_thread_pool.hpp"
+#include <algorithm>
 #include <iostream>
-#include <stdlib.h>
+#include <utility>
 #include <vector>
 
-#include "testing_common.hpp"
+/*!\file
+ * \brief CPU reference of syrkx and herkx, C := alpha * op(A) * op(B)**T (or **H) + beta * C on
+ * the triangle of C selected by uplo. Only used for testing, not part of the GPU library.
+ *
+ * C is split into square tiles and only the tiles which meet the triangle are computed, in
+ * parallel over the client thread pool. For each tile, panels of op(A) and op(B) are packed with
+ * real and imaginary parts in separate planes, so that the micro-kernel works on contiguous real
+ * vectors for both real and complex types.
+ */
+
+/* ============================================================================================ */
+/*! \brief  Real type and number of real parts of T */
+template <typename T>
+struct syrkx_parts
+{
+    using real_t               = T;
+    static constexpr int parts = 1;
+
+    static T make(real_t r, real_t)
+    {
+        return T(r);
+    }
+};
+
+template <>
+struct syrkx_parts<hipblasComplex>
+{
+    using real_t               = float;
+    static constexpr int parts = 2;
+
+    static hipblasComplex make(float r, float i)
+    {
+        return hipblasComplex(r, i);
+    }
+};
+
+template <>
+struct syrkx_parts<hipblasDoubleComplex>
+{
+    using real_t               = double;
+    static constexpr int parts = 2;
+
+    static hipblasDoubleComplex make(double r, double i)
+    {
+        return hipblasDoubleComplex(r, i);
+    }
+};
+
+constexpr int syrkx_tile  = 64; // rows and columns of a tile of C
+constexpr int syrkx_panel = 256; // columns of op(A) and op(B) packed at a time
+
+// Bytes of a SIMD register of the host; the micro-kernel keeps 8 registers of accumulators
+#if defined(__AVX__)
+constexpr int syrkx_simd_bytes = 32;
+#else
+constexpr int syrkx_simd_bytes = 16;
+#endif
+
+/*! \brief  acc[MR x NR] += ap * bp**T over kc packed columns. ap and bp hold PARTS planes of
+            syrkx_tile reals per column; acc has PARTS planes of syrkx_tile reals per column.
+            The MR x NR block of accumulators is kept in registers.  */
+template <typename R, int PARTS, int MR, int NR>
+inline void syrkx_micro_kernel(int kc, const R* ap, const R* bp, R* acc)
+{
+    R re[NR][MR] = {}, im[NR][MR] = {};
+
+    for(int l = 0; l < kc; l++)
+    {
+        const R* a = ap + l * PARTS * syrkx_tile;
+        const R* b = bp + l * PARTS * syrkx_tile;
+        for(int r = 0; r < NR; r++)
+        {
+            R b_re = b[r];
+            for(int i = 0; i < MR; i++)
+                re[r][i] += a[i] * b_re;
+            if(PARTS == 2)
+            {
+                R b_im = b[syrkx_tile + r];
+                for(int i = 0; i < MR; i++)
+                {
+                    re[r][i] -= a[syrkx_tile + i] * b_im;
+                    im[r][i] += a[i] * b_im + a[syrkx_tile + i] * b_re;
+                }
+            }
+        }
+    }
+
+    for(int r = 0; r < NR; r++)
+    {
+        R* col = acc + r * PARTS * syrkx_tile;
+        for(int i = 0; i < MR; i++)
+            col[i] += re[r][i];
+        if(PARTS == 2)
+            for(int i = 0; i < MR; i++)
+                col[syrkx_tile + i] += im[r][i];
+    }
+}
+
+/*! \brief  Pack rows [i0, i0 + rows) of columns [l0, l0 + kc) of op(X) (X by rows when
+            x_by_row, optionally conjugated) into kc columns of PARTS planes, padded with zeros
+            to syrkx_tile rows  */
+template <typename T>
+void syrkx_pack(const T*                         x,
+                int                              ldx,
+                bool                             x_by_row,
+                bool                             conj_x,
+                int                              i0,
+                int                              rows,
+                int                              l0,
+                int                              kc,
+                typename syrkx_parts<T>::real_t* panel)
+{
+    constexpr int parts = syrkx_parts<T>::parts;
+    for(int l = 0; l < kc; l++)
+    {
+        auto* re = panel + l * parts * syrkx_tile;
+        for(int i = 0; i < rows; i++)
+        {
+            const T& v = x_by_row ? x[(l0 + l) + size_t(i0 + i) * ldx]
+                                  : x[(i0 + i) + size_t(l0 + l) * ldx];
+            re[i]      = std::real(v);
+            if(parts == 2)
+                re[syrkx_tile + i] = conj_x ? -std::imag(v) : std::imag(v);
+        }
+        for(int i = rows; i < syrkx_tile; i++)
+        {
+            re[i] = 0;
+            if(parts == 2)
+                re[syrkx_tile + i] = 0;
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*! \brief  C := beta * C + alpha * op(A) * op(B)**T on the uplo triangle of the n x n matrix C.
+            op(A)(i, l) is A(i, l), or A(l, i) when by_row; op(B) likewise. conj_a and conj_b
+            conjugate the elements of op(A) and op(B), giving the **H forms of herkx.  */
+template <typename T>
+void syrkx_herkx_blocked(hipblasFillMode_t uplo,
+                         bool              by_row,
+                         bool              conj_a,
+                         bool              conj_b,
+                         int               n,
+                         int               k,
+                         T                 alpha,
+                         const T*          a,
+                         int               lda,
+                         const T*          b,
+                         int               ldb,
+                         T                 beta,
+                         T*                c,
+                         int               ldc)
+{
+    using R                = typename syrkx_parts<T>::real_t;
+    constexpr int parts    = syrkx_parts<T>::parts;
+    constexpr int mr       = syrkx_simd_bytes * 2 / parts / sizeof(R);
+    constexpr int nr       = 4;
+    bool          lower    = uplo == HIPBLAS_FILL_MODE_LOWER;
+    int           n_tiles  = (n + syrkx_tile - 1) / syrkx_tile;
+    size_t        tile_len = size_t(parts) * syrkx_tile;
+
+    // tiles (row, column) of C which meet the triangle
+    std::vector<std::pair<int, int>> tiles;
+    for(int jt = 0; jt < n_tiles; jt++)
+        for(int it = lower ? jt : 0; it < (lower ? n_tiles : jt + 1); it++)
+            tiles.emplace_back(it, jt);
 
-using namespace std;
+    hipblas_parallel_for(tiles.size(), [&](size_t t) {
+        int i0   = tiles[t].first * syrkx_tile;
+        int j0   = tiles[t].second * syrkx_tile;
+        int rows = std::min(syrkx_tile, n - i0);
+        int cols = std::min(syrkx_tile, n - j0);
+
+        std::vector<R> ap(tile_len * std::min(syrkx_panel, std::max(k, 1)));
+        std::vector<R> bp(ap.size());
+        std::vector<R> acc(tile_len * syrkx_tile);
+
+        for(int l0 = 0; l0 < k; l0 += syrkx_panel)
+        {
+            int kc = std::min(syrkx_panel, k - l0);
+            syrkx_pack(a, lda, by_row, conj_a, i0, rows, l0, kc, ap.data());
+            syrkx_pack(b, ldb, by_row, conj_b, j0, cols, l0, kc, bp.data());
+
+            for(int jr = 0; jr < cols; jr += nr)
+                for(int ir = 0; ir < rows; ir += mr)
+                    syrkx_micro_kernel<R, parts, mr, nr>(
+                        kc, ap.data() + ir, bp.data() + jr, acc.data() + jr * tile_len + ir);
+        }
+
+        for(int j = 0; j < cols; j++)
+        {
+            const R* col = acc.data() + j * tile_len;
+            for(int i = 0; i < rows; i++)
+            {
+                int gi = i0 + i, gj = j0 + j;
+                if(lower ? gi < gj : gi > gj)
+                    continue;
+                T& cij = c[gi + size_t(gj) * ldc];
+                T  sum = syrkx_parts<T>::make(col[i], parts == 2 ? col[syrkx_tile + i] : R(0));
+                cij    = beta * cij + alpha * sum;
+            }
+        }
+    });
+}
 
 // reference implementation of syrkx. This function is not part of legacy BLAS.
 template <typename T>
@@ -27,13 +235,6 @@ void syrkx_reference(hipblasFillMode_t  uplo,
                      T*                 c,
                      int                ldc)
 {
-    int a_s1 = HIPBLAS_OP_N == trans ? 1 : lda;
-    int a_s2 = HIPBLAS_OP_N == trans ? lda : 1;
-    int b_s1 = HIPBLAS_OP_N == trans ? 1 : ldb;
-    int b_s2 = HIPBLAS_OP_N == trans ? ldb : 1;
-    int c_s1 = 1;
-    int c_s2 = ldc;
-
     // argument error
     int nrow = trans == HIPBLAS_OP_N ? n : k;
     if(n < 0)
@@ -67,30 +268,25 @@ void syrkx_reference(hipblasFillMode_t  uplo,
         return;
 
     // rank kx update with special cases for alpha == 0, beta == 0
-    for(int i1 = 0; i1 < n; i1++)
+    if(alpha == 0)
     {
-        int i2_start = HIPBLAS_FILL_MODE_LOWER == uplo ? 0 : i1;
-        int i2_end   = HIPBLAS_FILL_MODE_LOWER == uplo ? i1 + 1 : n;
-        for(int i2 = i2_start; i2 < i2_end; i2++)
+        for(int j = 0; j < n; j++)
         {
-            if(alpha == 0 && beta == 0)
+            int i_start = HIPBLAS_FILL_MODE_LOWER == uplo ? j : 0;
+            int i_end   = HIPBLAS_FILL_MODE_LOWER == uplo ? n : j + 1;
+            for(int i = i_start; i < i_end; i++)
             {
-                c[i1 * c_s1 + i2 * c_s2] = 0.0;
-            }
-            else if(alpha == 0)
-            {
-                c[i1 * c_s1 + i2 * c_s2] *= beta;
-            }
-            else
-            {
-                T t = 0;
-                for(int i3 = 0; i3 < k; i3++)
-                {
-                    t += a[i1 * a_s1 + i3 * a_s2] * b[i2 * b_s1 + i3 * b_s2];
-                }
-                c[i1 * c_s1 + i2 * c_s2] = beta * c[i1 * c_s1 + i2 * c_s2] + alpha * t;
+                if(beta == 0)
+                    c[i + size_t(j) * ldc] = 0.0;
+                else
+                    c[i + size_t(j) * ldc] *= beta;
             }
         }
+        return;
     }
-    return;
+
+    syrkx_herkx_blocked<T>(
+        uplo, trans != HIPBLAS_OP_N, false, false, n, k, alpha, a, lda, b, ldb, beta, c, ldc);
 }
+
+#endif
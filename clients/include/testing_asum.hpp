@@ -110,6 +110,7 @@ hipblasStatus_t testing_asum(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasAsumFn(handle, N, dx, incx, d_hipblas_result));
         }
@@ -96,10 +96,9 @@ hipblasStatus_t testing_asum_strided_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_asum<T, Tr>(N, hx.data() + b * stridex, incx, &cpu_result[b]);
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -127,6 +126,7 @@ hipblasStatus_t testing_asum_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasAsumStridedBatchedFn(
                 handle, N, dx, incx, stridex, batch_count, d_hipblas_result));
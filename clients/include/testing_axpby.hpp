@@ -0,0 +1,472 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_axpby(const Arguments& argus)
+{
+    int N        = argus.N;
+    int incx     = argus.incx;
+    int incy     = argus.incy;
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    hipblasLocalHandle handle(argus);
+
+    // y is updated through incy, so a zero increment is rejected before anything is read
+    EXPECT_HIPBLAS_STATUS(hipblasAxpby<T>(handle, N, nullptr, nullptr, incx, nullptr, nullptr, 0),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(
+            hipblasAxpby<T>(handle, N, nullptr, nullptr, incx, nullptr, nullptr, incy));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t sizeX = size_t(N) * abs_incx;
+    size_t sizeY = size_t(N) * abs_incy;
+    T      alpha = argus.get_alpha<T>();
+    T      beta  = argus.get_beta<T>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy_host(sizeY);
+    host_vector<T> hy_device(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy_host(sizeY);
+    device_vector<T> dy_device(sizeY);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU; for beta = 0, y must not be read, so it starts as NaN
+    srand(1);
+    hipblas_init<T>(hx, 1, N, abs_incx);
+    if(beta == T(0))
+        hipblas_init_nan(hy_host.data(), sizeY);
+    else
+        hipblas_init<T>(hy_host, 1, N, abs_incy);
+    hy_device = hy_host;
+    hy_cpu    = hy_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_host, hy_host.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_device, hy_device.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(
+            hipblasAxpby<T>(handle, N, d_alpha, dx, incx, d_beta, dy_device, incy));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasAxpby<T>(handle, N, &alpha, dx, incx, &beta, dy_host, incy));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_host.data(), dy_host, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy_device, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_axpby<T>(N, alpha, hx.data(), incx, beta, hy_cpu.data(), incy);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_host.data());
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_device.data());
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu.data(), hy_host.data());
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu.data(), hy_device.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(
+                hipblasAxpby<T>(handle, N, d_alpha, dx, incx, d_beta, dy_device, incy));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            axpy_gflop_count<T>(N) + scal_gflop_count<T, T>(N),
+            axpy_gbyte_count<T>(N),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_axpby_batched(const Arguments& argus)
+{
+    int N           = argus.N;
+    int incx        = argus.incx;
+    int incy        = argus.incy;
+    int batch_count = argus.batch_count;
+    int abs_incy    = incy < 0 ? -incy : incy;
+
+    hipblasLocalHandle handle(argus);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasAxpbyBatched<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, nullptr, 0, std::max(batch_count, 1)),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasAxpbyBatched<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, nullptr, incy, batch_count));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_batch_vector<T> hx(N, incx, batch_count);
+    host_batch_vector<T> hy_host(N, incy, batch_count);
+    host_batch_vector<T> hy_device(N, incy, batch_count);
+    host_batch_vector<T> hy_cpu(N, incy, batch_count);
+
+    device_batch_vector<T> dx(N, incx, batch_count);
+    device_batch_vector<T> dy_host(N, incy, batch_count);
+    device_batch_vector<T> dy_device(N, incy, batch_count);
+    device_vector<T>       d_alpha(1);
+    device_vector<T>       d_beta(1);
+    CHECK_HIP_ERROR(dx.memcheck());
+    CHECK_HIP_ERROR(dy_host.memcheck());
+    CHECK_HIP_ERROR(dy_device.memcheck());
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    hipblas_init(hx, true);
+    if(beta == T(0))
+        for(int b = 0; b < batch_count; b++)
+            hipblas_init_nan(hy_host[b], size_t(N) * abs_incy);
+    else
+        hipblas_init(hy_host, false);
+    hy_device.copy_from(hy_host);
+    hy_cpu.copy_from(hy_host);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy_host.transfer_from(hy_host));
+    CHECK_HIP_ERROR(dy_device.transfer_from(hy_device));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpbyBatched<T>(handle,
+                                                   N,
+                                                   d_alpha,
+                                                   dx.ptr_on_device(),
+                                                   incx,
+                                                   d_beta,
+                                                   dy_device.ptr_on_device(),
+                                                   incy,
+                                                   batch_count));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasAxpbyBatched<T>(handle,
+                                                   N,
+                                                   &alpha,
+                                                   dx.ptr_on_device(),
+                                                   incx,
+                                                   &beta,
+                                                   dy_host.ptr_on_device(),
+                                                   incy,
+                                                   batch_count));
+
+        CHECK_HIP_ERROR(hy_host.transfer_from(dy_host));
+        CHECK_HIP_ERROR(hy_device.transfer_from(dy_device));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_axpby<T>(N, alpha, hx[b], incx, beta, hy_cpu[b], incy);
+        });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, N, batch_count, abs_incy, hy_cpu, hy_host);
+            unit_check_general<T>(1, N, batch_count, abs_incy, hy_cpu, hy_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu, hy_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, N, abs_incy, hy_cpu, hy_device, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasAxpbyBatched<T>(handle,
+                                                       N,
+                                                       d_alpha,
+                                                       dx.ptr_on_device(),
+                                                       incx,
+                                                       d_beta,
+                                                       dy_device.ptr_on_device(),
+                                                       incy,
+                                                       batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_beta, e_incy, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            axpy_gflop_count<T>(N) + scal_gflop_count<T, T>(N),
+            axpy_gbyte_count<T>(N),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_axpby_strided_batched(const Arguments& argus)
+{
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    int    incy         = argus.incy;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    hipblasStride stridex = size_t(N) * abs_incx * stride_scale;
+    hipblasStride stridey = size_t(N) * abs_incy * stride_scale;
+    size_t        sizeX   = stridex * batch_count;
+    size_t        sizeY   = stridey * batch_count;
+
+    hipblasLocalHandle handle(argus);
+
+    EXPECT_HIPBLAS_STATUS(hipblasAxpbyStridedBatched<T>(handle,
+                                                        N,
+                                                        nullptr,
+                                                        nullptr,
+                                                        incx,
+                                                        stridex,
+                                                        nullptr,
+                                                        nullptr,
+                                                        0,
+                                                        stridey,
+                                                        std::max(batch_count, 1)),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasAxpbyStridedBatched<T>(handle,
+                                                          N,
+                                                          nullptr,
+                                                          nullptr,
+                                                          incx,
+                                                          stridex,
+                                                          nullptr,
+                                                          nullptr,
+                                                          incy,
+                                                          stridey,
+                                                          batch_count));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy_host(sizeY);
+    host_vector<T> hy_device(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy_host(sizeY);
+    device_vector<T> dy_device(sizeY);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU; for beta = 0, y must not be read, so it starts as NaN
+    srand(1);
+    hipblas_init<T>(hx, 1, N, abs_incx, stridex, batch_count);
+    if(beta == T(0))
+        hipblas_init_nan(hy_host.data(), sizeY);
+    else
+        hipblas_init<T>(hy_host, 1, N, abs_incy, stridey, batch_count);
+    hy_device = hy_host;
+    hy_cpu    = hy_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_host, hy_host.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_device, hy_device.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpbyStridedBatched<T>(handle,
+                                                          N,
+                                                          d_alpha,
+                                                          dx,
+                                                          incx,
+                                                          stridex,
+                                                          d_beta,
+                                                          dy_device,
+                                                          incy,
+                                                          stridey,
+                                                          batch_count));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasAxpbyStridedBatched<T>(
+            handle, N, &alpha, dx, incx, stridex, &beta, dy_host, incy, stridey, batch_count));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_host.data(), dy_host, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy_device, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_axpby<T>(
+                N, alpha, hx.data() + b * stridex, incx, beta, hy_cpu.data() + b * stridey, incy);
+        });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(
+                1, N, batch_count, abs_incy, stridey, hy_cpu.data(), hy_host.data());
+            unit_check_general<T>(
+                1, N, batch_count, abs_incy, stridey, hy_cpu.data(), hy_device.data());
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', 1, N, abs_incy, stridey, hy_cpu.data(), hy_host.data(), batch_count);
+            hipblas_error_device = norm_check_general<T>(
+                'F', 1, N, abs_incy, stridey, hy_cpu.data(), hy_device.data(), batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasAxpbyStridedBatched<T>(handle,
+                                                              N,
+                                                              d_alpha,
+                                                              dx,
+                                                              incx,
+                                                              stridex,
+                                                              d_beta,
+                                                              dy_device,
+                                                              incy,
+                                                              stridey,
+                                                              batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N,
+                      e_alpha,
+                      e_incx,
+                      e_stride_x,
+                      e_beta,
+                      e_incy,
+                      e_stride_y,
+                      e_batch_count>{}
+            .log_args<T>(std::cout,
+                         argus,
+                         gpu_time_used,
+                         axpy_gflop_count<T>(N) + scal_gflop_count<T, T>(N),
+                         axpy_gbyte_count<T>(N),
+                         hipblas_error_host,
+                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -123,6 +123,7 @@ hipblasStatus_t testing_axpy(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasAxpyFn(handle, N, d_alpha, dx, incx, dy_device, incy));
         }
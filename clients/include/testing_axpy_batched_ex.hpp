@@ -121,12 +121,12 @@ hipblasStatus_t testing_axpy_batched_ex_template(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_axpy(N, h_alpha, hx[b], incx, hy_cpu[b], incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -154,6 +154,7 @@ hipblasStatus_t testing_axpy_batched_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasAxpyBatchedExFn(handle,
                                                        N,
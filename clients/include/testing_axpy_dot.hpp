@@ -0,0 +1,361 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_axpy_dot(const Arguments& argus)
+{
+    int N        = argus.N;
+    int incx     = argus.incx;
+    int incy     = argus.incy;
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0)
+    {
+        device_vector<T> d_hipblas_result_0(1);
+        host_vector<T>   h_hipblas_result_0(1);
+        hipblas_init_nan(h_hipblas_result_0.data(), 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_hipblas_result_0, h_hipblas_result_0, sizeof(T), hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDot<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, nullptr, incy, d_hipblas_result_0));
+
+        host_vector<T> cpu_0(1);
+        host_vector<T> gpu_0(1);
+
+        CHECK_HIP_ERROR(hipMemcpy(gpu_0, d_hipblas_result_0, sizeof(T), hipMemcpyDeviceToHost));
+        unit_check_general<T>(1, 1, 1, cpu_0, gpu_0);
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // z uses the increment of x
+    size_t sizeX = size_t(N) * abs_incx;
+    size_t sizeY = size_t(N) * abs_incy;
+    T      alpha = argus.get_alpha<T>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hz(sizeX);
+    host_vector<T> hy_host(sizeY);
+    host_vector<T> hy_device(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+
+    T                cpu_result, h_hipblas_result_host, h_hipblas_result_device;
+    device_vector<T> dx(sizeX);
+    device_vector<T> dz(sizeX);
+    device_vector<T> dy_host(sizeY);
+    device_vector<T> dy_device(sizeY);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_hipblas_result(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hx, 1, N, abs_incx);
+    hipblas_init_alternating_sign<T>(hz, 1, N, abs_incx);
+    hipblas_init<T>(hy_host, 1, N, abs_incy);
+    hy_device = hy_host;
+    hy_cpu    = hy_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dz, hz.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_host, hy_host.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_device, hy_device.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDot<T>(
+            handle, N, d_alpha, dx, incx, dy_device, incy, dz, incx, d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDot<T>(
+            handle, N, &alpha, dx, incx, dy_host, incy, dz, incx, &h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &h_hipblas_result_device, d_hipblas_result, sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_host.data(), dy_host, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy_device, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_axpy_dot<T>(
+            N, alpha, hx.data(), incx, hy_cpu.data(), incy, hz.data(), incx, &cpu_result);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_host.data());
+            unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy_device.data());
+            unit_check_general<T>(1, 1, 1, &cpu_result, &h_hipblas_result_host);
+            unit_check_general<T>(1, 1, 1, &cpu_result, &h_hipblas_result_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, 1, 1, &cpu_result, &h_hipblas_result_host);
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, 1, 1, &cpu_result, &h_hipblas_result_device);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasAxpyDot<T>(
+                handle, N, d_alpha, dx, incx, dy_device, incy, dz, incx, d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // two passes, so the bytes of axpy and of dot are both counted
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            axpy_gflop_count<T>(N) + dot_gflop_count<true, T>(N),
+            axpy_gbyte_count<T>(N) + dot_gbyte_count<T>(N),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_axpy_dot_strided_batched(const Arguments& argus)
+{
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    int    incy         = argus.incy;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    // z uses the increment and stride of x
+    hipblasStride stridex = size_t(N) * abs_incx * stride_scale;
+    hipblasStride stridey = size_t(N) * abs_incy * stride_scale;
+    size_t        sizeX   = stridex * batch_count;
+    size_t        sizeY   = stridey * batch_count;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || batch_count <= 0)
+    {
+        device_vector<T> d_hipblas_result_0(std::max(batch_count, 1));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDotStridedBatched<T>(handle,
+                                                            N,
+                                                            nullptr,
+                                                            nullptr,
+                                                            incx,
+                                                            stridex,
+                                                            nullptr,
+                                                            incy,
+                                                            stridey,
+                                                            nullptr,
+                                                            incx,
+                                                            stridex,
+                                                            batch_count,
+                                                            d_hipblas_result_0));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    T alpha = argus.get_alpha<T>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hz(sizeX);
+    host_vector<T> hy_host(sizeY);
+    host_vector<T> hy_device(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+    host_vector<T> h_cpu_result(batch_count);
+    host_vector<T> h_hipblas_result_host(batch_count);
+    host_vector<T> h_hipblas_result_device(batch_count);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dz(sizeX);
+    device_vector<T> dy_host(sizeY);
+    device_vector<T> dy_device(sizeY);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_hipblas_result(batch_count);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hx, 1, N, abs_incx, stridex, batch_count);
+    hipblas_init_alternating_sign<T>(hz, 1, N, abs_incx, stridex, batch_count);
+    hipblas_init<T>(hy_host, 1, N, abs_incy, stridey, batch_count);
+    hy_device = hy_host;
+    hy_cpu    = hy_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dz, hz.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_host, hy_host.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_device, hy_device.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDotStridedBatched<T>(handle,
+                                                            N,
+                                                            d_alpha,
+                                                            dx,
+                                                            incx,
+                                                            stridex,
+                                                            dy_device,
+                                                            incy,
+                                                            stridey,
+                                                            dz,
+                                                            incx,
+                                                            stridex,
+                                                            batch_count,
+                                                            d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasAxpyDotStridedBatched<T>(handle,
+                                                            N,
+                                                            &alpha,
+                                                            dx,
+                                                            incx,
+                                                            stridex,
+                                                            dy_host,
+                                                            incy,
+                                                            stridey,
+                                                            dz,
+                                                            incx,
+                                                            stridex,
+                                                            batch_count,
+                                                            h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
+                                  d_hipblas_result,
+                                  sizeof(T) * batch_count,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_host.data(), dy_host, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy_device, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_axpy_dot<T>(N,
+                              alpha,
+                              hx.data() + b * stridex,
+                              incx,
+                              hy_cpu.data() + b * stridey,
+                              incy,
+                              hz.data() + b * stridex,
+                              incx,
+                              &h_cpu_result[b]);
+        });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(
+                1, N, batch_count, abs_incy, stridey, hy_cpu.data(), hy_host.data());
+            unit_check_general<T>(
+                1, N, batch_count, abs_incy, stridey, hy_cpu.data(), hy_device.data());
+            unit_check_general<T>(1, batch_count, 1, h_cpu_result, h_hipblas_result_host);
+            unit_check_general<T>(1, batch_count, 1, h_cpu_result, h_hipblas_result_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', 1, batch_count, 1, h_cpu_result, h_hipblas_result_host);
+            hipblas_error_device = norm_check_general<T>(
+                'F', 1, batch_count, 1, h_cpu_result, h_hipblas_result_device);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasAxpyDotStridedBatched<T>(handle,
+                                                                N,
+                                                                d_alpha,
+                                                                dx,
+                                                                incx,
+                                                                stridex,
+                                                                dy_device,
+                                                                incy,
+                                                                stridey,
+                                                                dz,
+                                                                incx,
+                                                                stridex,
+                                                                batch_count,
+                                                                d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_stride_x, e_incy, e_stride_y, e_batch_count>{}
+            .log_args<T>(std::cout,
+                         argus,
+                         gpu_time_used,
+                         axpy_gflop_count<T>(N) + dot_gflop_count<true, T>(N),
+                         axpy_gbyte_count<T>(N) + dot_gbyte_count<T>(N),
+                         hipblas_error_host,
+                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -108,6 +108,7 @@ hipblasStatus_t testing_axpy_ex_template(const Arguments& argus)
         cblas_axpy(N, h_alpha, hx.data(), incx, hy_cpu.data(), incy);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -133,6 +134,7 @@ hipblasStatus_t testing_axpy_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasAxpyExFn(
                 handle, N, d_alpha, alphaType, dx, xType, incx, dy, yType, incy, executionType));
@@ -102,13 +102,13 @@ hipblasStatus_t testing_axpy_strided_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_axpy<T>(
                 N, alpha, hx_cpu.data() + b * stridex, incx, hy_cpu.data() + b * stridey, incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -137,6 +137,7 @@ hipblasStatus_t testing_axpy_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasAxpyStridedBatchedFn(
                 handle, N, d_alpha, dx, incx, stridex, dy_device, incy, stridey, batch_count));
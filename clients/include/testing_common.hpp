@@ -10,6 +10,7 @@
 // do not add special case includes here, keep those in the testing_ file
 #include "argument_model.hpp"
 #include "bytes.hpp"
+#include "cblas_batched_interface.h"
 #include "cblas_interface.h"
 #include "flops.hpp"
 #include "hipblas.hpp"
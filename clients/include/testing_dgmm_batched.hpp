@@ -126,6 +126,7 @@ hipblasStatus_t testing_dgmm_batched(const Arguments& argus)
         }
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -148,6 +149,7 @@ hipblasStatus_t testing_dgmm_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasDgmmBatchedFn(handle,
                                                      side,
@@ -112,10 +112,9 @@ hipblasStatus_t testing_dot_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             (CONJ ? cblas_dotc<T> : cblas_dot<T>)(N, hx[b], incx, hy[b], incy, &(h_cpu_result[b]));
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -143,6 +142,7 @@ hipblasStatus_t testing_dot_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR((hipblasDotBatchedFn)(handle,
                                                       N,
@@ -0,0 +1,444 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_dot_multi(const Arguments& argus)
+{
+    int N        = argus.N;
+    int K        = argus.K;
+    int incx     = argus.incx;
+    int ldy      = std::max(N, 1);
+    int abs_incx = incx < 0 ? -incx : incx;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || K <= 0)
+    {
+        device_vector<T> d_hipblas_result_0(std::max(K, 1));
+        host_vector<T>   h_hipblas_result_0(std::max(K, 1));
+        hipblas_init_nan(h_hipblas_result_0.data(), std::max(K, 1));
+        CHECK_HIP_ERROR(hipMemcpy(d_hipblas_result_0,
+                                  h_hipblas_result_0,
+                                  sizeof(T) * std::max(K, 1),
+                                  hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(
+            hipblasDotMulti<T>(handle, N, K, nullptr, incx, nullptr, ldy, d_hipblas_result_0));
+
+        if(K > 0)
+        {
+            host_vector<T> cpu_0(K);
+            host_vector<T> gpu_0(K);
+            CHECK_HIP_ERROR(
+                hipMemcpy(gpu_0, d_hipblas_result_0, sizeof(T) * K, hipMemcpyDeviceToHost));
+            unit_check_general<T>(1, K, 1, cpu_0, gpu_0);
+        }
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t sizeX = size_t(N) * abs_incx;
+    size_t sizeY = size_t(ldy) * K;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hY(sizeY);
+    host_vector<T> h_cpu_result(K);
+    host_vector<T> h_hipblas_result_host(K);
+    host_vector<T> h_hipblas_result_device(K);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dY(sizeY);
+    device_vector<T> d_hipblas_result(K);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init_alternating_sign<T>(hx, 1, N, abs_incx);
+    hipblas_init<T>(hY, N, K, ldy);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dY, hY.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        // the device pointer mode is the single gemv, the host pointer mode the K dot products
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasDotMulti<T>(handle, N, K, dx, incx, dY, ldy, d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(
+            hipblasDotMulti<T>(handle, N, K, dx, incx, dY, ldy, h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            h_hipblas_result_device, d_hipblas_result, sizeof(T) * K, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_dot_multi<T>(N, K, hx.data(), incx, hY.data(), ldy, h_cpu_result);
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, K, 1, h_cpu_result, h_hipblas_result_host);
+            unit_check_general<T>(1, K, 1, h_cpu_result, h_hipblas_result_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, K, 1, h_cpu_result, h_hipblas_result_host);
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, K, 1, h_cpu_result, h_hipblas_result_device);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(
+                hipblasDotMulti<T>(handle, N, K, dx, incx, dY, ldy, d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_K, e_incx>{}.log_args<T>(std::cout,
+                                                       argus,
+                                                       gpu_time_used,
+                                                       gemv_gflop_count<T>(HIPBLAS_OP_C, N, K),
+                                                       gemv_gbyte_count<T>(HIPBLAS_OP_C, N, K),
+                                                       hipblas_error_host,
+                                                       hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_dot_multi_batched(const Arguments& argus)
+{
+    int N           = argus.N;
+    int K           = argus.K;
+    int incx        = argus.incx;
+    int ldy         = std::max(N, 1);
+    int batch_count = argus.batch_count;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || K <= 0 || batch_count <= 0)
+    {
+        device_vector<T> d_hipblas_result_0(std::max(size_t(K) * batch_count, size_t(1)));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasDotMultiBatched<T>(
+            handle, N, K, nullptr, incx, nullptr, ldy, batch_count, d_hipblas_result_0));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t results = size_t(K) * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_batch_vector<T> hx(N, incx, batch_count);
+    host_batch_vector<T> hY(ldy * K, 1, batch_count);
+    host_vector<T>       h_cpu_result(results);
+    host_vector<T>       h_hipblas_result_host(results);
+    host_vector<T>       h_hipblas_result_device(results);
+
+    device_batch_vector<T> dx(N, incx, batch_count);
+    device_batch_vector<T> dY(ldy * K, 1, batch_count);
+    device_vector<T>       d_hipblas_result(results);
+    CHECK_HIP_ERROR(dx.memcheck());
+    CHECK_HIP_ERROR(dY.memcheck());
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init_alternating_sign(hx, true);
+    hipblas_init(hY, false);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dY.transfer_from(hY));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasDotMultiBatched<T>(handle,
+                                                      N,
+                                                      K,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dY.ptr_on_device(),
+                                                      ldy,
+                                                      batch_count,
+                                                      d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasDotMultiBatched<T>(handle,
+                                                      N,
+                                                      K,
+                                                      dx.ptr_on_device(),
+                                                      incx,
+                                                      dY.ptr_on_device(),
+                                                      ldy,
+                                                      batch_count,
+                                                      h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
+                                  d_hipblas_result,
+                                  sizeof(T) * results,
+                                  hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_dot_multi<T>(N, K, hx[b], incx, hY[b], ldy, h_cpu_result.data() + size_t(b) * K);
+        });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, K, batch_count, 1, K, h_cpu_result, h_hipblas_result_host);
+            unit_check_general<T>(1, K, batch_count, 1, K, h_cpu_result, h_hipblas_result_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', 1, K, 1, K, h_cpu_result, h_hipblas_result_host, batch_count);
+            hipblas_error_device = norm_check_general<T>(
+                'F', 1, K, 1, K, h_cpu_result, h_hipblas_result_device, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasDotMultiBatched<T>(handle,
+                                                          N,
+                                                          K,
+                                                          dx.ptr_on_device(),
+                                                          incx,
+                                                          dY.ptr_on_device(),
+                                                          ldy,
+                                                          batch_count,
+                                                          d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_K, e_incx, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            gemv_gflop_count<T>(HIPBLAS_OP_C, N, K),
+            gemv_gbyte_count<T>(HIPBLAS_OP_C, N, K),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_dot_multi_strided_batched(const Arguments& argus)
+{
+    int    N            = argus.N;
+    int    K            = argus.K;
+    int    incx         = argus.incx;
+    int    ldy          = std::max(N, 1);
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+    int    abs_incx     = incx < 0 ? -incx : incx;
+
+    hipblasStride stridex = size_t(N) * abs_incx * stride_scale;
+    hipblasStride strideY = size_t(ldy) * K * stride_scale;
+    size_t        sizeX   = stridex * batch_count;
+    size_t        sizeY   = strideY * batch_count;
+    size_t        results = size_t(K) * batch_count;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || K <= 0 || batch_count <= 0)
+    {
+        device_vector<T> d_hipblas_result_0(std::max(results, size_t(1)));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasDotMultiStridedBatched<T>(handle,
+                                                             N,
+                                                             K,
+                                                             nullptr,
+                                                             incx,
+                                                             stridex,
+                                                             nullptr,
+                                                             ldy,
+                                                             strideY,
+                                                             batch_count,
+                                                             d_hipblas_result_0));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hY(sizeY);
+    host_vector<T> h_cpu_result(results);
+    host_vector<T> h_hipblas_result_host(results);
+    host_vector<T> h_hipblas_result_device(results);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dY(sizeY);
+    device_vector<T> d_hipblas_result(results);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init_alternating_sign<T>(hx, 1, N, abs_incx, stridex, batch_count);
+    hipblas_init<T>(hY, N, K, ldy, strideY, batch_count);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dY, hY.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasDotMultiStridedBatched<T>(handle,
+                                                             N,
+                                                             K,
+                                                             dx,
+                                                             incx,
+                                                             stridex,
+                                                             dY,
+                                                             ldy,
+                                                             strideY,
+                                                             batch_count,
+                                                             d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasDotMultiStridedBatched<T>(handle,
+                                                             N,
+                                                             K,
+                                                             dx,
+                                                             incx,
+                                                             stridex,
+                                                             dY,
+                                                             ldy,
+                                                             strideY,
+                                                             batch_count,
+                                                             h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
+                                  d_hipblas_result,
+                                  sizeof(T) * results,
+                                  hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_dot_multi<T>(N,
+                               K,
+                               hx.data() + b * stridex,
+                               incx,
+                               hY.data() + b * strideY,
+                               ldy,
+                               h_cpu_result.data() + size_t(b) * K);
+        });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, K, batch_count, 1, K, h_cpu_result, h_hipblas_result_host);
+            unit_check_general<T>(1, K, batch_count, 1, K, h_cpu_result, h_hipblas_result_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', 1, K, 1, K, h_cpu_result, h_hipblas_result_host, batch_count);
+            hipblas_error_device = norm_check_general<T>(
+                'F', 1, K, 1, K, h_cpu_result, h_hipblas_result_device, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasDotMultiStridedBatched<T>(handle,
+                                                                 N,
+                                                                 K,
+                                                                 dx,
+                                                                 incx,
+                                                                 stridex,
+                                                                 dY,
+                                                                 ldy,
+                                                                 strideY,
+                                                                 batch_count,
+                                                                 d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_K, e_incx, e_stride_x, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            gemv_gflop_count<T>(HIPBLAS_OP_C, N, K),
+            gemv_gbyte_count<T>(HIPBLAS_OP_C, N, K),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
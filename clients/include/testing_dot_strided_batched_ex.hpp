@@ -151,15 +151,14 @@ hipblasStatus_t testing_dot_strided_batched_ex_template(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             (CONJ ? cblas_dotc<Tx> : cblas_dot<Tx>)(N,
                                                     hx.data() + b * stridex,
                                                     incx,
                                                     hy.data() + b * stridey,
                                                     incy,
                                                     &h_cpu_result[b]);
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -187,6 +186,7 @@ hipblasStatus_t testing_dot_strided_batched_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasDotStridedBatchedExFn(handle,
                                                              N,
@@ -0,0 +1,355 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The band storage AB has leading dimension ldab = argus.ldb, the full storage A has argus.lda
+template <typename T>
+hipblasStatus_t testing_gbtge(const Arguments& argus)
+{
+    int M    = argus.M;
+    int N    = argus.N;
+    int KL   = argus.KL;
+    int KU   = argus.KU;
+    int lda  = argus.lda;
+    int ldab = argus.ldb;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size
+        = M < 0 || N < 0 || KL < 0 || KU < 0 || ldab < KL + KU + 1 || lda < std::max(M, 1);
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual
+            = hipblasGbtge<T>(handle, M, N, KL, KU, nullptr, ldab, nullptr, lda);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t AB_size = size_t(ldab) * N;
+    size_t A_size  = size_t(lda) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hAB(AB_size);
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_cpu(A_size);
+
+    device_vector<T> dAB(AB_size);
+    device_vector<T> dA(A_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hAB, ldab, N, ldab);
+    hipblas_init<T>(hA, lda, N, lda);
+    hA_cpu = hA;
+
+    CHECK_HIP_ERROR(hipMemcpy(dAB, hAB.data(), sizeof(T) * AB_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGbtge<T>(handle, M, N, KL, KU, dAB, ldab, dA, lda));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_gbtge<T>(M, N, KL, KU, hAB.data(), ldab, hA_cpu.data(), lda);
+
+        // the whole of A is compared, so the elements outside the band are checked to be left
+        // unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(lda, N, lda, hA_cpu, hA);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', lda, N, lda, hA_cpu, hA);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGbtge<T>(handle, M, N, KL, KU, dAB, ldab, dA, lda));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_KL, e_KU, e_lda, e_ldb>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbtge_gbyte_count<T>(M, N, KL, KU),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_gbtge_batched(const Arguments& argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int KL          = argus.KL;
+    int KU          = argus.KU;
+    int lda         = argus.lda;
+    int ldab        = argus.ldb;
+    int batch_count = argus.batch_count;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || KL < 0 || KU < 0 || ldab < KL + KU + 1
+                        || lda < std::max(M, 1) || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGbtgeBatched<T>(
+            handle, M, N, KL, KU, nullptr, ldab, nullptr, lda, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t AB_size = size_t(ldab) * N;
+    size_t A_size  = size_t(lda) * N;
+
+    double gpu_time_used, hipblas_error;
+
+    // arrays of pointers-to-host on host
+    host_batch_vector<T> hAB(AB_size, 1, batch_count);
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hA_cpu(A_size, 1, batch_count);
+
+    device_batch_vector<T> dAB(AB_size, 1, batch_count);
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+
+    CHECK_HIP_ERROR(dAB.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init(hAB, true);
+    hipblas_init(hA);
+    hA_cpu.copy_from(hA);
+
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGbtgeBatched<T>(handle,
+                                                   M,
+                                                   N,
+                                                   KL,
+                                                   KU,
+                                                   dAB.ptr_on_device(),
+                                                   ldab,
+                                                   dA.ptr_on_device(),
+                                                   lda,
+                                                   batch_count));
+
+        CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_gbtge<T>(M, N, KL, KU, hAB[b], ldab, hA_cpu[b], lda);
+        });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(lda, N, batch_count, lda, hA_cpu, hA);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', lda, N, lda, hA_cpu, hA, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGbtgeBatched<T>(handle,
+                                                       M,
+                                                       N,
+                                                       KL,
+                                                       KU,
+                                                       dAB.ptr_on_device(),
+                                                       ldab,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_KL, e_KU, e_lda, e_ldb, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbtge_gbyte_count<T>(M, N, KL, KU),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_gbtge_strided_batched(const Arguments& argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    KL           = argus.KL;
+    int    KU           = argus.KU;
+    int    lda          = argus.lda;
+    int    ldab         = argus.ldb;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasStride stride_AB = size_t(ldab) * N * stride_scale;
+    hipblasStride stride_A  = size_t(lda) * N * stride_scale;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || KL < 0 || KU < 0 || ldab < KL + KU + 1
+                        || lda < std::max(M, 1) || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGbtgeStridedBatched<T>(
+            handle, M, N, KL, KU, nullptr, ldab, stride_AB, nullptr, lda, stride_A, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t AB_size = stride_AB * batch_count;
+    size_t A_size  = stride_A * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hAB(AB_size);
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_cpu(A_size);
+
+    device_vector<T> dAB(AB_size);
+    device_vector<T> dA(A_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU, the gaps between the instances included
+    srand(1);
+    hipblas_init<T>(hAB, 1, AB_size, 1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hA_cpu = hA;
+
+    CHECK_HIP_ERROR(hipMemcpy(dAB, hAB.data(), sizeof(T) * AB_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGbtgeStridedBatched<T>(
+            handle, M, N, KL, KU, dAB, ldab, stride_AB, dA, lda, stride_A, batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_gbtge<T>(M,
+                           N,
+                           KL,
+                           KU,
+                           hAB.data() + b * stride_AB,
+                           ldab,
+                           hA_cpu.data() + b * stride_A,
+                           lda);
+        });
+
+        // the whole allocation is compared, so the gaps between the instances are checked to be
+        // left unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, A_size, 1, hA_cpu, hA);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', 1, A_size, 1, hA_cpu, hA);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGbtgeStridedBatched<T>(
+                handle, M, N, KL, KU, dAB, ldab, stride_AB, dA, lda, stride_A, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_KL, e_KU, e_lda, e_ldb, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbtge_gbyte_count<T>(M, N, KL, KU),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
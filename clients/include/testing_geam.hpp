@@ -132,6 +132,7 @@ hipblasStatus_t testing_geam(const Arguments& argus)
             transA, transB, M, N, &h_alpha, (T*)hA, lda, &h_beta, (T*)hB, ldb, (T*)hC_copy, ldc);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -158,6 +159,7 @@ hipblasStatus_t testing_geam(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGeamFn(
                 handle, transA, transB, M, N, d_alpha, dA, lda, d_beta, dB, ldb, dC, ldc));
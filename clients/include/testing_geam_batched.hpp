@@ -94,12 +94,14 @@ hipblasStatus_t testing_geam_batched(const Arguments& argus)
     host_batch_vector<T> hB(B_size, 1, batch_count);
     host_batch_vector<T> hC1(C_size, 1, batch_count);
     host_batch_vector<T> hC2(C_size, 1, batch_count);
+    host_batch_vector<T> hC_host_ptrs(C_size, 1, batch_count);
     host_batch_vector<T> hC_copy(C_size, 1, batch_count);
 
     hipblas_init(hA, true);
     hipblas_init(hB);
     hipblas_init(hC1);
     hC2.copy_from(hC1);
+    hC_host_ptrs.copy_from(hC1);
     hC_copy.copy_from(hC1);
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
@@ -155,13 +157,42 @@ hipblasStatus_t testing_geam_batched(const Arguments& argus)
 
             CHECK_HIP_ERROR(hC2.transfer_from(dC));
         }
+        {
+            // the arrays of pointers on host, in reverse order so that they are uploaded
+            std::vector<const T*> hA_ptrs(batch_count), hB_ptrs(batch_count);
+            std::vector<T*>       hC_ptrs(batch_count);
+            for(int b = 0; b < batch_count; b++)
+            {
+                hA_ptrs[b] = dA[batch_count - 1 - b];
+                hB_ptrs[b] = dB[batch_count - 1 - b];
+                hC_ptrs[b] = dC[batch_count - 1 - b];
+            }
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC_host_ptrs));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGeamBatchedHostPtrs<T>(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              &h_alpha,
+                                                              hA_ptrs.data(),
+                                                              lda,
+                                                              &h_beta,
+                                                              hB_ptrs.data(),
+                                                              ldb,
+                                                              hC_ptrs.data(),
+                                                              ldc,
+                                                              batch_count));
+
+            CHECK_HIP_ERROR(hC_host_ptrs.transfer_from(dC));
+        }
 
         /* =====================================================================
                 CPU BLAS
         =================================================================== */
         // reference calculation
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_geam(transA,
                        transB,
                        M,
@@ -174,14 +205,16 @@ hipblasStatus_t testing_geam_batched(const Arguments& argus)
                        ldb,
                        (T*)hC_copy[b],
                        ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
             unit_check_general<T>(M, N, batch_count, ldc, hC_copy, hC1);
             unit_check_general<T>(M, N, batch_count, ldc, hC_copy, hC2);
+            unit_check_general<T>(M, N, batch_count, ldc, hC_copy, hC_host_ptrs);
         }
 
         if(argus.norm_check)
@@ -202,6 +235,7 @@ hipblasStatus_t testing_geam_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGeamBatchedFn(handle,
                                                      transA,
@@ -172,8 +172,7 @@ hipblasStatus_t testing_geam_strided_batched(const Arguments& argus)
                 CPU BLAS
         =================================================================== */
         // reference calculation
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_geam(transA,
                        transB,
                        M,
@@ -186,9 +185,10 @@ hipblasStatus_t testing_geam_strided_batched(const Arguments& argus)
                        ldb,
                        (T*)hC_copy + b * stride_C,
                        ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -216,6 +216,7 @@ hipblasStatus_t testing_geam_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGeamStridedBatchedFn(handle,
                                                             transA,
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <vector>
 
+#include "hipblas_ref_cache.hpp"
 #include "testing_common.hpp"
 #include <typeinfo>
 
@@ -72,12 +73,15 @@ hipblasStatus_t testing_gemm(const Arguments& argus)
     double             gpu_time_used, hipblas_error_host, hipblas_error_device;
     hipblasLocalHandle handle(argus);
 
+    // Host copies are only needed to check the results; timing runs initialize the device directly
+    bool check = argus.unit_check || argus.norm_check;
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
-    host_vector<T> hA(A_size);
-    host_vector<T> hB(B_size);
-    host_vector<T> hC_host(C_size);
-    host_vector<T> hC_device(C_size);
-    host_vector<T> hC_copy(C_size);
+    host_vector<T> hA(check ? A_size : 0);
+    host_vector<T> hB(check ? B_size : 0);
+    host_vector<T> hC_host(check ? C_size : 0);
+    host_vector<T> hC_device(check ? C_size : 0);
+    host_vector<T> hC_copy(check ? C_size : 0);
 
     device_vector<T> dA(A_size);
     device_vector<T> dB(B_size);
@@ -87,18 +91,28 @@ hipblasStatus_t testing_gemm(const Arguments& argus)
 
     // Initial Data on CPU
     srand(1);
-    hipblas_init<T>(hA, A_row, A_col, lda);
-    hipblas_init<T>(hB, B_row, B_col, ldb);
-    hipblas_init<T>(hC_host, M, N, ldc);
-
-    // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
-    hC_copy   = hC_host;
-    hC_device = hC_host;
-
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * lda * A_col, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * ldb * B_col, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+    if(check)
+    {
+        hipblas_init<T>(hA, A_row, A_col, lda, 0, 1, argus.initialization);
+        hipblas_init<T>(hB, B_row, B_col, ldb, 0, 1, argus.initialization);
+        hipblas_init<T>(hC_host, M, N, ldc, 0, 1, argus.initialization);
+
+        // save a copy in hC_copy which will be output of CPU BLAS
+        hC_copy   = hC_host;
+        hC_device = hC_host;
+
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * lda * A_col, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * ldb * B_col, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        // the same data as the host initialization above
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dA, A_row, A_col, lda, 0, 1, argus.initialization));
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dB, B_row, B_col, ldb, 0, 1, argus.initialization));
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dC, M, N, ldc, 0, 1, argus.initialization));
+    }
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -125,21 +139,24 @@ hipblasStatus_t testing_gemm(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        cblas_gemm<T>(transA,
-                      transB,
-                      M,
-                      N,
-                      K,
-                      h_alpha,
-                      hA.data(),
-                      lda,
-                      hB.data(),
-                      ldb,
-                      h_beta,
-                      hC_copy.data(),
-                      ldc);
+        hipblas_ref_cached<T>(argus, "gemm", {hA, hB}, {hC_copy}, [&] {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA.data(),
+                          lda,
+                          hB.data(),
+                          ldb,
+                          h_beta,
+                          hC_copy.data(),
+                          ldc);
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -169,6 +186,7 @@ hipblasStatus_t testing_gemm(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmFn(
                 handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
@@ -113,6 +113,7 @@ hipblasStatus_t testing_gemm_batched(const Arguments& argus)
     host_batch_vector<T> hC_host(C_size, 1, batch_count);
     host_batch_vector<T> hC_device(C_size, 1, batch_count);
     host_batch_vector<T> hC_copy(C_size, 1, batch_count);
+    host_batch_vector<T> hC_host_ptrs(C_size, 1, batch_count);
 
     // device arrays
     device_batch_vector<T> dA(A_size, 1, batch_count);
@@ -131,6 +132,7 @@ hipblasStatus_t testing_gemm_batched(const Arguments& argus)
 
     hC_device.copy_from(hC_host);
     hC_copy.copy_from(hC_host);
+    hC_host_ptrs.copy_from(hC_host);
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dB.transfer_from(hB));
@@ -141,22 +143,20 @@ hipblasStatus_t testing_gemm_batched(const Arguments& argus)
     if(argus.unit_check || argus.norm_check)
     {
         // calculate "golden" result on CPU
-        for(int i = 0; i < batch_count; i++)
-        {
-            cblas_gemm<T>(transA,
-                          transB,
-                          M,
-                          N,
-                          K,
-                          h_alpha,
-                          (T*)hA[i],
-                          lda,
-                          (T*)hB[i],
-                          ldb,
-                          h_beta,
-                          (T*)hC_copy[i],
-                          ldc);
-        }
+        cblas_gemm_batched<T, T, T>(transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     h_alpha,
+                                     hA,
+                                     lda,
+                                     hB,
+                                     ldb,
+                                     h_beta,
+                                     hC_copy,
+                                     ldc,
+                                     batch_count);
 
         // test hipBLAS batched gemm with alpha and beta pointers on device
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
@@ -199,10 +199,41 @@ hipblasStatus_t testing_gemm_batched(const Arguments& argus)
 
         CHECK_HIP_ERROR(hC_host.transfer_from(dC));
 
+        // test hipBLAS batched gemm with the arrays of pointers on host, in reverse order so that
+        // they are not evenly spaced and are uploaded
+        std::vector<const T*> hA_ptrs(batch_count), hB_ptrs(batch_count);
+        std::vector<T*>       hC_ptrs(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hA_ptrs[b] = dA[batch_count - 1 - b];
+            hB_ptrs[b] = dB[batch_count - 1 - b];
+            hC_ptrs[b] = dC[batch_count - 1 - b];
+        }
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host_ptrs));
+        CHECK_HIPBLAS_ERROR(hipblasGemmBatchedHostPtrs<T>(handle,
+                                                          transA,
+                                                          transB,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          &h_alpha,
+                                                          hA_ptrs.data(),
+                                                          lda,
+                                                          hB_ptrs.data(),
+                                                          ldb,
+                                                          &h_beta,
+                                                          hC_ptrs.data(),
+                                                          ldc,
+                                                          batch_count));
+
+        CHECK_HIP_ERROR(hC_host_ptrs.transfer_from(dC));
+
         if(argus.unit_check)
         {
             unit_check_general<T>(M, N, batch_count, ldc, hC_copy, hC_host);
             unit_check_general<T>(M, N, batch_count, ldc, hC_copy, hC_device);
+            unit_check_general<T>(M, N, batch_count, ldc, hC_copy, hC_host_ptrs);
         }
 
         if(argus.norm_check)
@@ -228,6 +259,7 @@ hipblasStatus_t testing_gemm_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
                                                      transA,
@@ -185,8 +185,7 @@ hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& argus)
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
         // CPU BLAS
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_gemm<Ta, Tc, Tex>(transA,
                                     transB,
                                     M,
@@ -200,7 +199,7 @@ hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& argus)
                                     h_beta_Tc,
                                     hC_gold[b],
                                     ldc);
-        }
+        });
 
         if(unit_check)
         {
@@ -228,6 +227,7 @@ hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExFn(handle,
                                                        transA,
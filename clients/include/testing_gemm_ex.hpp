@@ -211,6 +211,7 @@ hipblasStatus_t testing_gemm_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
                                                 transA,
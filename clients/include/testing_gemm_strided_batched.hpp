@@ -9,6 +9,7 @@
 #include <typeinfo>
 #include <vector>
 
+#include "hipblas_ref_cache.hpp"
 #include "hipblas_unique_ptr.hpp"
 #include "testing_common.hpp"
 
@@ -76,12 +77,15 @@ hipblasStatus_t testing_gemm_strided_batched(const Arguments& argus)
     size_t        B_size   = stride_B * batch_count;
     size_t        C_size   = stride_C * batch_count;
 
+    // Host copies are only needed to check the results; timing runs initialize the device directly
+    bool check = argus.unit_check || argus.norm_check;
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
-    host_vector<T> hA(A_size);
-    host_vector<T> hB(B_size);
-    host_vector<T> hC_host(C_size);
-    host_vector<T> hC_device(C_size);
-    host_vector<T> hC_copy(C_size);
+    host_vector<T> hA(check ? A_size : 0);
+    host_vector<T> hB(check ? B_size : 0);
+    host_vector<T> hC_host(check ? C_size : 0);
+    host_vector<T> hC_device(check ? C_size : 0);
+    host_vector<T> hC_copy(check ? C_size : 0);
 
     device_vector<T> dA(A_size);
     device_vector<T> dB(B_size);
@@ -91,18 +95,31 @@ hipblasStatus_t testing_gemm_strided_batched(const Arguments& argus)
 
     // Initial Data on CPU
     srand(1);
-    hipblas_init<T>(hA, A_row, A_col * batch_count, lda);
-    hipblas_init<T>(hB, B_row, B_col * batch_count, ldb);
-    hipblas_init<T>(hC_host, M, N * batch_count, ldc);
-
-    // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
-    hC_copy   = hC_host;
-    hC_device = hC_host;
-
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    if(check)
+    {
+        hipblas_init<T>(hA, A_row, A_col * batch_count, lda, 0, 1, argus.initialization);
+        hipblas_init<T>(hB, B_row, B_col * batch_count, ldb, 0, 1, argus.initialization);
+        hipblas_init<T>(hC_host, M, N * batch_count, ldc, 0, 1, argus.initialization);
+
+        // save a copy in hC_copy which will be output of CPU BLAS
+        hC_copy   = hC_host;
+        hC_device = hC_host;
+
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(T) * C_size, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        // the same data as the host initialization above
+        CHECK_HIP_ERROR(hipblas_init_device<T>(
+            dA, A_row, A_col * batch_count, lda, 0, 1, argus.initialization));
+        CHECK_HIP_ERROR(hipblas_init_device<T>(
+            dB, B_row, B_col * batch_count, ldb, 0, 1, argus.initialization));
+        CHECK_HIP_ERROR(
+            hipblas_init_device<T>(dC, M, N * batch_count, ldc, 0, 1, argus.initialization));
+    }
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
 
@@ -166,24 +183,28 @@ hipblasStatus_t testing_gemm_strided_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int i = 0; i < batch_count; i++)
-        {
-            cblas_gemm<T>(transA,
-                          transB,
-                          M,
-                          N,
-                          K,
-                          h_alpha,
-                          hA.data() + stride_A * i,
-                          lda,
-                          hB.data() + stride_B * i,
-                          ldb,
-                          h_beta,
-                          hC_copy.data() + stride_C * i,
-                          ldc);
-        }
+        hipblas_ref_cached<T>(argus, "gemm_strided_batched", {hA, hB}, {hC_copy}, [&] {
+            cblas_gemm_strided_batched<T, T, T>(transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 h_alpha,
+                                                 hA.data(),
+                                                 lda,
+                                                 stride_A,
+                                                 hB.data(),
+                                                 ldb,
+                                                 stride_B,
+                                                 h_beta,
+                                                 hC_copy.data(),
+                                                 ldc,
+                                                 stride_C,
+                                                 batch_count);
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -213,6 +234,7 @@ hipblasStatus_t testing_gemm_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
                                                             transA,
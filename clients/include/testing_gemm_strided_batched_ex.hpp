@@ -192,8 +192,7 @@ hipblasStatus_t testing_gemm_strided_batched_ex_template(const Arguments& argus)
         CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(Tc) * size_C, hipMemcpyDeviceToHost));
 
         // CPU BLAS
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_gemm<Ta, Tc, Tex>(transA,
                                     transB,
                                     M,
@@ -207,7 +206,7 @@ hipblasStatus_t testing_gemm_strided_batched_ex_template(const Arguments& argus)
                                     h_beta_Tc,
                                     hC_gold.data() + b * stride_C,
                                     ldc);
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -234,6 +233,7 @@ hipblasStatus_t testing_gemm_strided_batched_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedExFn(handle,
                                                               transA,
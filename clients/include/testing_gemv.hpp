@@ -128,6 +128,7 @@ hipblasStatus_t testing_gemv(const Arguments& argus)
             transA, M, N, h_alpha, hA.data(), lda, hx.data(), incx, h_beta, hy_cpu.data(), incy);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -156,6 +157,7 @@ hipblasStatus_t testing_gemv(const Arguments& argus)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasGemvFn(handle, transA, M, N, d_alpha, dA, lda, dx, incx, d_beta, dy, incy));
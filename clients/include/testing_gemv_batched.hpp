@@ -85,6 +85,7 @@ hipblasStatus_t testing_gemv_batched(const Arguments& argus)
     host_batch_vector<T> hy_cpu(dim_y, incy, batch_count);
     host_batch_vector<T> hy_host(dim_y, incy, batch_count);
     host_batch_vector<T> hy_device(dim_y, incy, batch_count);
+    host_batch_vector<T> hy_host_ptrs(dim_y, incy, batch_count);
 
     // device pointers
     device_batch_vector<T> dA(A_size, 1, batch_count);
@@ -149,21 +150,50 @@ hipblasStatus_t testing_gemv_batched(const Arguments& argus)
 
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
+        // the arrays of pointers on host, in reverse order so that they are uploaded
+        std::vector<const T*> hA_ptrs(batch_count), hx_ptrs(batch_count);
+        std::vector<T*>       hy_ptrs(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hA_ptrs[b] = dA[batch_count - 1 - b];
+            hx_ptrs[b] = dx[batch_count - 1 - b];
+            hy_ptrs[b] = dy[batch_count - 1 - b];
+        }
+
+        CHECK_HIP_ERROR(dy.transfer_from(hy));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemvBatchedHostPtrs<T>(handle,
+                                                          transA,
+                                                          M,
+                                                          N,
+                                                          &h_alpha,
+                                                          hA_ptrs.data(),
+                                                          lda,
+                                                          hx_ptrs.data(),
+                                                          incx,
+                                                          &h_beta,
+                                                          hy_ptrs.data(),
+                                                          incy,
+                                                          batch_count));
+
+        CHECK_HIP_ERROR(hy_host_ptrs.transfer_from(dy));
+
         /* =====================================================================
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_gemv<T>(transA, M, N, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
             unit_check_general<T>(1, dim_y, batch_count, abs_incy, hy_cpu, hy_host);
             unit_check_general<T>(1, dim_y, batch_count, abs_incy, hy_cpu, hy_device);
+            unit_check_general<T>(1, dim_y, batch_count, abs_incy, hy_cpu, hy_host_ptrs);
         }
         if(argus.norm_check)
         {
@@ -188,6 +218,7 @@ hipblasStatus_t testing_gemv_batched(const Arguments& argus)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            hipblas_bench_mark_call(stream);
             CHECK_HIPBLAS_ERROR(hipblasGemvBatchedFn(handle,
                                                      transA,
                                                      M,
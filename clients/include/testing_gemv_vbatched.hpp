@@ -0,0 +1,265 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// Sizes {m, n, lda} of the instances of a variable size batch. With argus.sizes_file they are
+// read from the file, one "m n [count]" line per shape repeated count times with lda = m, and
+// lines starting with # ignored. Otherwise instance b of batch_count is M >> (b % 3) by
+// N >> (b / 3 % 3), padded by lda - M, so that shapes repeat and the groups of several instances
+// are exercised along with single ones.
+inline std::vector<std::vector<int>> gemv_vbatched_sizes(const Arguments& argus)
+{
+    std::vector<std::vector<int>> sizes;
+    if(argus.sizes_file[0])
+    {
+        std::ifstream file(argus.sizes_file);
+        if(!file)
+            throw std::invalid_argument(std::string("Can not open --sizes ") + argus.sizes_file);
+
+        std::string line;
+        while(std::getline(file, line))
+        {
+            std::istringstream words(line);
+            int                m, n, count = 1;
+            if(line.empty() || line[0] == '#' || !(words >> m >> n))
+                continue;
+            words >> count;
+            sizes.insert(sizes.end(), std::max(count, 0), {m, n, std::max(m, 1)});
+        }
+        return sizes;
+    }
+
+    for(int b = 0; b < argus.batch_count; b++)
+    {
+        int m = argus.M < 0 ? argus.M : argus.M >> (b % 3);
+        int n = argus.N < 0 ? argus.N : argus.N >> (b / 3 % 3);
+        sizes.push_back({m, n, m + argus.lda - argus.M});
+    }
+    return sizes;
+}
+
+template <typename T>
+hipblasStatus_t testing_gemv_vbatched(const Arguments& argus)
+{
+    int incx = argus.incx;
+    int incy = argus.incy;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    std::vector<std::vector<int>> sizes = gemv_vbatched_sizes(argus);
+
+    int batch_count = argus.sizes_file[0] ? int(sizes.size()) : argus.batch_count;
+
+    std::vector<int> hm(std::max(batch_count, 0)), hn(hm.size()), hlda(hm.size());
+    std::vector<int> hincx(hm.size(), incx), hincy(hm.size(), incy);
+    for(size_t b = 0; b < hm.size(); b++)
+    {
+        hm[b]   = sizes[b][0];
+        hn[b]   = sizes[b][1];
+        hlda[b] = sizes[b][2];
+    }
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = !incx || !incy || batch_count < 0;
+    for(int b = 0; b < batch_count; b++)
+        invalid_size = invalid_size || hm[b] < 0 || hn[b] < 0 || hlda[b] < std::max(hm[b], 1);
+    if(invalid_size || !batch_count)
+    {
+        std::vector<const T*> null_A(hm.size()), null_x(hm.size());
+        std::vector<T*>       null_y(hm.size());
+        hipblasStatus_t       actual = hipblasGemvVbatched<T>(handle,
+                                                        transA,
+                                                        hm.data(),
+                                                        hn.data(),
+                                                        nullptr,
+                                                        null_A.data(),
+                                                        hlda.data(),
+                                                        null_x.data(),
+                                                        hincx.data(),
+                                                        nullptr,
+                                                        null_y.data(),
+                                                        hincy.data(),
+                                                        batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    int abs_incx = incx >= 0 ? incx : -incx;
+    int abs_incy = incy >= 0 ? incy : -incy;
+
+    // The instances follow each other in one allocation per operand, so that the arrays of
+    // pointers are not evenly spaced
+    std::vector<size_t> offset_A(batch_count + 1), offset_x(batch_count + 1),
+        offset_y(batch_count + 1);
+    double gflops = 0, gbytes = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        size_t dim_x = transA == HIPBLAS_OP_N ? hn[b] : hm[b];
+        size_t dim_y = transA == HIPBLAS_OP_N ? hm[b] : hn[b];
+
+        offset_A[b + 1] = offset_A[b] + size_t(hlda[b]) * hn[b];
+        offset_x[b + 1] = offset_x[b] + (dim_x ? 1 + (dim_x - 1) * abs_incx : 0);
+        offset_y[b + 1] = offset_y[b] + (dim_y ? 1 + (dim_y - 1) * abs_incy : 0);
+
+        gflops += gemv_gflop_count<T>(transA, hm[b], hn[b]);
+        gbytes += gemv_gbyte_count<T>(transA, hm[b], hn[b]);
+    }
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    T h_alpha = argus.get_alpha<T>();
+    T h_beta  = argus.get_beta<T>();
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(std::max(offset_A[batch_count], size_t(1)));
+    host_vector<T> hx(std::max(offset_x[batch_count], size_t(1)));
+    host_vector<T> hy(std::max(offset_y[batch_count], size_t(1)));
+    host_vector<T> hy_cpu(hy.size());
+    host_vector<T> hy_host(hy.size());
+    host_vector<T> hy_device(hy.size());
+
+    device_vector<T> dA(hA.size());
+    device_vector<T> dx(hx.size());
+    device_vector<T> dy(hy.size());
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    std::vector<const T*> dA_ptrs(batch_count), dx_ptrs(batch_count);
+    std::vector<T*>       dy_ptrs(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        dA_ptrs[b] = dA + offset_A[b];
+        dx_ptrs[b] = dx + offset_x[b];
+        dy_ptrs[b] = dy + offset_y[b];
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, hA.size(), 1);
+    hipblas_init<T>(hx, 1, hx.size(), 1);
+    hipblas_init<T>(hy, 1, hy.size(), 1);
+    hy_cpu = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * hy.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto call = [&](const T* alpha, const T* beta) {
+        return hipblasGemvVbatched<T>(handle,
+                                      transA,
+                                      hm.data(),
+                                      hn.data(),
+                                      alpha,
+                                      dA_ptrs.data(),
+                                      hlda.data(),
+                                      dx_ptrs.data(),
+                                      hincx.data(),
+                                      beta,
+                                      dy_ptrs.data(),
+                                      hincy.data(),
+                                      batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    if(argus.unit_check || argus.norm_check)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(call(&h_alpha, &h_beta));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_host.data(), dy, sizeof(T) * hy.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * hy.size(), hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(call(d_alpha, d_beta));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy, sizeof(T) * hy.size(), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            if(hm[b] && hn[b])
+                cblas_gemv<T>(transA,
+                              hm[b],
+                              hn[b],
+                              h_alpha,
+                              hA.data() + offset_A[b],
+                              hlda[b],
+                              hx.data() + offset_x[b],
+                              incx,
+                              h_beta,
+                              hy_cpu.data() + offset_y[b],
+                              incy);
+        });
+
+        // the whole allocation is compared, so the elements between those of y are checked to
+        // be left unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, hy.size(), 1, hy_cpu, hy_host);
+            unit_check_general<T>(1, hy.size(), 1, hy_cpu, hy_device);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host   = norm_check_general<T>('F', 1, hy.size(), 1, hy_cpu, hy_host);
+            hipblas_error_device = norm_check_general<T>('F', 1, hy.size(), 1, hy_cpu, hy_device);
+        }
+    }
+
+    if(argus.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * hy.size(), hipMemcpyHostToDevice));
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+            {
+                gpu_time_used = get_time_us_sync(stream);
+            }
+            hipblas_bench_mark_call(stream);
+            CHECK_HIPBLAS_ERROR(call(d_alpha, d_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // the batch_count column is the number of instances read from --sizes
+        Arguments arg   = argus;
+        arg.batch_count = batch_count;
+        ArgumentModel<e_transA_option, e_alpha, e_incx, e_beta, e_incy, e_batch_count>{}
+            .log_args<T>(std::cout,
+                         arg,
+                         gpu_time_used,
+                         gflops,
+                         gbytes,
+                         hipblas_error_host,
+                         hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -88,17 +88,7 @@ hipblasStatus_t testing_geqrf_batched(const Arguments& argus)
            CPU LAPACK
         =================================================================== */
 
-        // Workspace query
-        host_vector<T> work(1);
-        cblas_geqrf(M, N, hA[0], lda, hIpiv[0], work.data(), -1);
-        int lwork = type2int(work[0]);
-
-        // Perform factorization
-        work = host_vector<T>(lwork);
-        for(int b = 0; b < batch_count; b++)
-        {
-            cblas_geqrf(M, N, hA[b], lda, hIpiv[b], work.data(), N);
-        }
+        cblas_geqrf_batched<T>(M, N, hA, lda, hIpiv, batch_count);
 
         double e1 = norm_check_general<T>('F', M, N, lda, hA, hA1, batch_count);
         double e2 = norm_check_general<T>('F', min(M, N), 1, min(M, N), hIpiv, hIpiv1, batch_count);
@@ -124,6 +114,7 @@ hipblasStatus_t testing_geqrf_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGeqrfBatchedFn(
                 handle, M, N, dA.ptr_on_device(), lda, dIpiv.ptr_on_device(), &info, batch_count));
@@ -95,18 +95,8 @@ hipblasStatus_t testing_geqrf_strided_batched(const Arguments& argus)
            CPU LAPACK
         =================================================================== */
 
-        // Workspace query
-        host_vector<T> work(1);
-        cblas_geqrf(M, N, hA.data(), lda, hIpiv.data(), work.data(), -1);
-        int lwork = type2int(work[0]);
-
-        // Perform factorization
-        work = host_vector<T>(lwork);
-        for(int b = 0; b < batch_count; b++)
-        {
-            cblas_geqrf(
-                M, N, hA.data() + b * strideA, lda, hIpiv.data() + b * strideP, work.data(), N);
-        }
+        cblas_geqrf_strided_batched<T>(
+            M, N, hA.data(), lda, strideA, hIpiv.data(), strideP, batch_count);
 
         double e1 = norm_check_general<T>('F', M, N, lda, strideA, hA, hA1, batch_count);
         double e2 = norm_check_general<T>(
@@ -133,6 +123,7 @@ hipblasStatus_t testing_geqrf_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGeqrfStridedBatchedFn(
                 handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count));
@@ -0,0 +1,355 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The full storage A has leading dimension argus.lda, the band storage AB has ldab = argus.ldb
+template <typename T>
+hipblasStatus_t testing_getgb(const Arguments& argus)
+{
+    int M    = argus.M;
+    int N    = argus.N;
+    int KL   = argus.KL;
+    int KU   = argus.KU;
+    int lda  = argus.lda;
+    int ldab = argus.ldb;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size
+        = M < 0 || N < 0 || KL < 0 || KU < 0 || ldab < KL + KU + 1 || lda < std::max(M, 1);
+    if(invalid_size || !M || !N)
+    {
+        hipblasStatus_t actual
+            = hipblasGetgb<T>(handle, M, N, KL, KU, nullptr, lda, nullptr, ldab);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size  = size_t(lda) * N;
+    size_t AB_size = size_t(ldab) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hAB(AB_size);
+    host_vector<T> hAB_cpu(AB_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dAB(AB_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, lda, N, lda);
+    hipblas_init<T>(hAB, ldab, N, ldab);
+    hAB_cpu = hAB;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAB, hAB.data(), sizeof(T) * AB_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGetgb<T>(handle, M, N, KL, KU, dA, lda, dAB, ldab));
+
+        CHECK_HIP_ERROR(hipMemcpy(hAB.data(), dAB, sizeof(T) * AB_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_getgb<T>(M, N, KL, KU, hA.data(), lda, hAB_cpu.data(), ldab);
+
+        // the whole of AB is compared, so the elements of the band storage that fall outside A
+        // are checked to be left unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(ldab, N, ldab, hAB_cpu, hAB);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', ldab, N, ldab, hAB_cpu, hAB);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGetgb<T>(handle, M, N, KL, KU, dA, lda, dAB, ldab));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_KL, e_KU, e_lda, e_ldb>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbtge_gbyte_count<T>(M, N, KL, KU),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_getgb_batched(const Arguments& argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int KL          = argus.KL;
+    int KU          = argus.KU;
+    int lda         = argus.lda;
+    int ldab        = argus.ldb;
+    int batch_count = argus.batch_count;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || KL < 0 || KU < 0 || ldab < KL + KU + 1
+                        || lda < std::max(M, 1) || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGetgbBatched<T>(
+            handle, M, N, KL, KU, nullptr, lda, nullptr, ldab, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size  = size_t(lda) * N;
+    size_t AB_size = size_t(ldab) * N;
+
+    double gpu_time_used, hipblas_error;
+
+    // arrays of pointers-to-host on host
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hAB(AB_size, 1, batch_count);
+    host_batch_vector<T> hAB_cpu(AB_size, 1, batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dAB(AB_size, 1, batch_count);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dAB.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init(hA, true);
+    hipblas_init(hAB);
+    hAB_cpu.copy_from(hAB);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dAB.transfer_from(hAB));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGetgbBatched<T>(handle,
+                                                   M,
+                                                   N,
+                                                   KL,
+                                                   KU,
+                                                   dA.ptr_on_device(),
+                                                   lda,
+                                                   dAB.ptr_on_device(),
+                                                   ldab,
+                                                   batch_count));
+
+        CHECK_HIP_ERROR(hAB.transfer_from(dAB));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_getgb<T>(M, N, KL, KU, hA[b], lda, hAB_cpu[b], ldab);
+        });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(ldab, N, batch_count, ldab, hAB_cpu, hAB);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', ldab, N, ldab, hAB_cpu, hAB, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGetgbBatched<T>(handle,
+                                                       M,
+                                                       N,
+                                                       KL,
+                                                       KU,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       dAB.ptr_on_device(),
+                                                       ldab,
+                                                       batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_KL, e_KU, e_lda, e_ldb, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbtge_gbyte_count<T>(M, N, KL, KU),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_getgb_strided_batched(const Arguments& argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    KL           = argus.KL;
+    int    KU           = argus.KU;
+    int    lda          = argus.lda;
+    int    ldab         = argus.ldb;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasStride stride_A  = size_t(lda) * N * stride_scale;
+    hipblasStride stride_AB = size_t(ldab) * N * stride_scale;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = M < 0 || N < 0 || KL < 0 || KU < 0 || ldab < KL + KU + 1
+                        || lda < std::max(M, 1) || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasGetgbStridedBatched<T>(
+            handle, M, N, KL, KU, nullptr, lda, stride_A, nullptr, ldab, stride_AB, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size  = stride_A * batch_count;
+    size_t AB_size = stride_AB * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hAB(AB_size);
+    host_vector<T> hAB_cpu(AB_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dAB(AB_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU, the gaps between the instances included
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hAB, 1, AB_size, 1);
+    hAB_cpu = hAB;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAB, hAB.data(), sizeof(T) * AB_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGetgbStridedBatched<T>(
+            handle, M, N, KL, KU, dA, lda, stride_A, dAB, ldab, stride_AB, batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hAB.data(), dAB, sizeof(T) * AB_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_getgb<T>(M,
+                           N,
+                           KL,
+                           KU,
+                           hA.data() + b * stride_A,
+                           lda,
+                           hAB_cpu.data() + b * stride_AB,
+                           ldab);
+        });
+
+        // the whole allocation is compared, so the gaps between the instances are checked to be
+        // left unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, AB_size, 1, hAB_cpu, hAB);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', 1, AB_size, 1, hAB_cpu, hAB);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasGetgbStridedBatched<T>(
+                handle, M, N, KL, KU, dA, lda, stride_A, dAB, ldab, stride_AB, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_KL, e_KU, e_lda, e_ldb, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            gbtge_gbyte_count<T>(M, N, KL, KU),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <vector>
 
+#include "hipblas_ref_cache.hpp"
 #include "testing_common.hpp"
 
 using namespace std;
@@ -83,7 +84,9 @@ hipblasStatus_t testing_getrf(const Arguments& argus)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        hInfo[0] = cblas_getrf(M, N, hA.data(), lda, hIpiv.data());
+        hipblas_ref_cached<T>(argus, "getrf", {}, {hA, hIpiv, hInfo}, [&] {
+            hInfo[0] = cblas_getrf(M, N, hA.data(), lda, hIpiv.data());
+        });
 
         hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1);
         if(argus.unit_check)
@@ -105,6 +108,7 @@ hipblasStatus_t testing_getrf(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfFn(handle, N, dA, lda, dIpiv, dInfo));
         }
@@ -88,10 +88,9 @@ hipblasStatus_t testing_getrf_npvt_batched(const Arguments& argus)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             hInfo[b] = cblas_getrf(M, N, hA[b], lda, hIpiv.data() + b * strideP);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1, batch_count);
         if(argus.unit_check)
@@ -113,6 +112,7 @@ hipblasStatus_t testing_getrf_npvt_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfBatchedFn(
                 handle, N, dA.ptr_on_device(), lda, nullptr, dInfo, batch_count));
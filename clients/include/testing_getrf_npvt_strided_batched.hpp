@@ -95,10 +95,9 @@ hipblasStatus_t testing_getrf_npvt_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             hInfo[b] = cblas_getrf(M, N, hA.data() + b * strideA, lda, hIpiv.data() + b * strideP);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', M, N, lda, strideA, hA, hA1, batch_count);
 
@@ -121,6 +120,7 @@ hipblasStatus_t testing_getrf_npvt_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrfStridedBatchedFn(
                 handle, N, dA, lda, strideA, nullptr, strideP, dInfo, batch_count));
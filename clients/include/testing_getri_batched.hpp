@@ -59,8 +59,7 @@ hipblasStatus_t testing_getri_batched(const Arguments& argus)
     // Initial hA on CPU
     hipblas_init(hA, true);
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         // scale A to avoid singularities
         for(int i = 0; i < M; i++)
         {
@@ -76,7 +75,7 @@ hipblasStatus_t testing_getri_batched(const Arguments& argus)
         // perform LU factorization on A
         int* hIpivb = hIpiv.data() + b * strideP;
         hInfo[b]    = cblas_getrf(M, N, hA[b], lda, hIpivb);
-    }
+    });
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dC.transfer_from(hC));
@@ -139,6 +138,7 @@ hipblasStatus_t testing_getri_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGetriBatchedFn(handle,
                                                       N,
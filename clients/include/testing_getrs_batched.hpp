@@ -117,10 +117,9 @@ hipblasStatus_t testing_getrs_batched(const Arguments& argus)
            CPU LAPACK
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_getrs('N', N, 1, hA[b], lda, hIpiv.data() + b * strideP, hB[b], ldb);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB, hB1, batch_count);
         if(argus.unit_check)
@@ -142,6 +141,7 @@ hipblasStatus_t testing_getrs_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrsBatchedFn(handle,
                                                       op,
@@ -129,8 +129,7 @@ hipblasStatus_t testing_getrs_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU LAPACK
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_getrs('N',
                         N,
                         1,
@@ -139,7 +138,7 @@ hipblasStatus_t testing_getrs_strided_batched(const Arguments& argus)
                         hIpiv.data() + b * strideP,
                         hB.data() + b * strideB,
                         ldb);
-        }
+        });
 
         hipblas_error = norm_check_general<T>('F', N, 1, ldb, strideB, hB, hB1, batch_count);
 
@@ -162,6 +161,7 @@ hipblasStatus_t testing_getrs_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedFn(handle,
                                                              op,
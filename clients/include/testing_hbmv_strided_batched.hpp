@@ -154,8 +154,7 @@ hipblasStatus_t testing_hbmv_strided_batched(const Arguments& argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_hbmv<T>(uplo,
                           N,
                           K,
@@ -167,9 +166,10 @@ hipblasStatus_t testing_hbmv_strided_batched(const Arguments& argus)
                           h_beta,
                           hy_cpu.data() + b * stride_y,
                           incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -197,6 +197,7 @@ hipblasStatus_t testing_hbmv_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasHbmvStridedBatchedFn(handle,
                                                             uplo,
@@ -103,6 +103,7 @@ hipblasStatus_t testing_hemm(const Arguments& argus)
             side, uplo, M, N, h_alpha, hA.data(), lda, hB.data(), ldb, h_beta, hC_gold.data(), ldc);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -128,6 +129,7 @@ hipblasStatus_t testing_hemm(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasHemmFn(
                 handle, side, uplo, M, N, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
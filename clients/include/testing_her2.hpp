@@ -101,6 +101,7 @@ hipblasStatus_t testing_her2(const Arguments& argus)
         cblas_her2<T>(uplo, N, h_alpha, hx.data(), incx, hy.data(), incy, hA_cpu.data(), lda);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -131,6 +132,7 @@ hipblasStatus_t testing_her2(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasHer2Fn(handle, uplo, N, d_alpha, dx, incx, dy, incy, dA, lda));
@@ -142,8 +142,7 @@ hipblasStatus_t testing_her2_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_her2<T>(uplo,
                           N,
                           h_alpha,
@@ -153,9 +152,10 @@ hipblasStatus_t testing_her2_strided_batched(const Arguments& argus)
                           incy,
                           hA_cpu.data() + b * stride_A,
                           lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -184,6 +184,7 @@ hipblasStatus_t testing_her2_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasHer2StridedBatchedFn(handle,
                                                             uplo,
@@ -99,8 +99,7 @@ hipblasStatus_t testing_her_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_her<T>(uplo,
                          N,
                          h_alpha,
@@ -108,9 +107,10 @@ hipblasStatus_t testing_her_strided_batched(const Arguments& argus)
                          incx,
                          hA_cpu.data() + b * stride_A,
                          lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -139,6 +139,7 @@ hipblasStatus_t testing_her_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasHerStridedBatchedFn(
                 handle, uplo, N, d_alpha, dx, incx, stride_x, dA, lda, stride_A, batch_count));
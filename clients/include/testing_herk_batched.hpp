@@ -57,6 +57,7 @@ hipblasStatus_t testing_herk_batched(const Arguments& argus)
     host_batch_vector<T> hA(A_size, 1, batch_count);
     host_batch_vector<T> hC_host(C_size, 1, batch_count);
     host_batch_vector<T> hC_device(C_size, 1, batch_count);
+    host_batch_vector<T> hC_host_ptrs(C_size, 1, batch_count);
     host_batch_vector<T> hC_gold(C_size, 1, batch_count);
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
@@ -71,6 +72,7 @@ hipblasStatus_t testing_herk_batched(const Arguments& argus)
     hipblas_init(hC_host);
 
     hC_device.copy_from(hC_host);
+    hC_host_ptrs.copy_from(hC_host);
     hC_gold.copy_from(hC_host);
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
@@ -116,20 +118,47 @@ hipblasStatus_t testing_herk_batched(const Arguments& argus)
 
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
+        // the arrays of pointers on host, in reverse order so that they are uploaded
+        std::vector<const T*> hA_ptrs(batch_count);
+        std::vector<T*>       hC_ptrs(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hA_ptrs[b] = dA[batch_count - 1 - b];
+            hC_ptrs[b] = dC[batch_count - 1 - b];
+        }
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host_ptrs));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasHerkBatchedHostPtrs(handle,
+                                                       uplo,
+                                                       transA,
+                                                       N,
+                                                       K,
+                                                       &h_alpha,
+                                                       hA_ptrs.data(),
+                                                       lda,
+                                                       &h_beta,
+                                                       hC_ptrs.data(),
+                                                       ldc,
+                                                       batch_count));
+
+        CHECK_HIP_ERROR(hC_host_ptrs.transfer_from(dC));
+
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_herk<T>(uplo, transA, N, K, h_alpha, hA[b], lda, h_beta, hC_gold[b], ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
             unit_check_general<T>(N, N, batch_count, ldc, hC_gold, hC_host);
             unit_check_general<T>(N, N, batch_count, ldc, hC_gold, hC_device);
+            unit_check_general<T>(N, N, batch_count, ldc, hC_gold, hC_host_ptrs);
         }
 
         if(argus.norm_check)
@@ -152,6 +181,7 @@ hipblasStatus_t testing_herk_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasHerkBatchedFn(handle,
                                                      uplo,
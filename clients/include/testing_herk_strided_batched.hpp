@@ -125,8 +125,7 @@ hipblasStatus_t testing_herk_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_herk<T>(uplo,
                           transA,
                           N,
@@ -137,9 +136,10 @@ hipblasStatus_t testing_herk_strided_batched(const Arguments& argus)
                           h_beta,
                           hC_gold.data() + b * stride_C,
                           ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -167,6 +167,7 @@ hipblasStatus_t testing_herk_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasHerkStridedBatchedFn(handle,
                                                             uplo,
@@ -138,8 +138,7 @@ hipblasStatus_t testing_hpr2_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_hpr2<T>(uplo,
                           N,
                           h_alpha,
@@ -148,9 +147,10 @@ hipblasStatus_t testing_hpr2_strided_batched(const Arguments& argus)
                           hy.data() + b * stride_y,
                           incy,
                           hA_cpu.data() + b * stride_A);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -180,6 +180,7 @@ hipblasStatus_t testing_hpr2_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasHpr2StridedBatchedFn(handle,
                                                             uplo,
@@ -126,6 +126,7 @@ hipblasStatus_t testing_iamax_iamin_batched(const Arguments&                 arg
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 func(handle, N, dx.ptr_on_device(), incx, batch_count, d_hipblas_result_device));
@@ -139,6 +139,7 @@ hipblasStatus_t testing_iamax_iamin_strided_batched(const Arguments&
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(func(handle, N, dx, incx, stridex, batch_count, d_hipblas_result));
         }
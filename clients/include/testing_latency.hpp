@@ -0,0 +1,185 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+/*! \brief  Dispatch overhead of tiny problems. Every routine of the table runs at sizes
+            0, 1, 4, 16, ... up to N, in host and in device pointer mode, and two times are
+            reported in ns per call: host submit (calls issued back to back, measured before the
+            stream is synchronized) and end-to-end (each call followed by a synchronization).
+            The number of calls is --iters, at least latency_min_calls.  */
+
+constexpr int latency_min_calls = 100000;
+
+template <typename F>
+hipblasStatus_t latency_measure(hipStream_t stream,
+                                int         calls,
+                                int         cold_calls,
+                                F&&         call,
+                                double&     submit_ns,
+                                double&     end_to_end_ns)
+{
+    using clock = std::chrono::steady_clock;
+
+    for(int i = 0; i < cold_calls; i++)
+        CHECK_HIPBLAS_ERROR(call());
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    auto start = clock::now();
+    for(int i = 0; i < calls; i++)
+        CHECK_HIPBLAS_ERROR(call());
+    auto submitted = clock::now();
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+    auto sync_start = clock::now();
+    for(int i = 0; i < calls; i++)
+    {
+        CHECK_HIPBLAS_ERROR(call());
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    auto sync_end = clock::now();
+
+    using ns      = std::chrono::duration<double, std::nano>;
+    submit_ns     = ns(submitted - start).count() / calls;
+    end_to_end_ns = ns(sync_end - sync_start).count() / calls;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_latency(const Arguments& argus)
+{
+    using Tr           = real_t<T>;
+    bool FORTRAN       = argus.fortran;
+    auto hipblasScalFn = FORTRAN ? hipblasScal<T, T, true> : hipblasScal<T, T, false>;
+    auto hipblasAxpyFn = FORTRAN ? hipblasAxpy<T, true> : hipblasAxpy<T, false>;
+    auto hipblasDotFn  = FORTRAN ? hipblasDot<T, true> : hipblasDot<T, false>;
+    auto hipblasNrm2Fn = FORTRAN ? hipblasNrm2<T, Tr, true> : hipblasNrm2<T, Tr, false>;
+    auto hipblasGemvFn = FORTRAN ? hipblasGemv<T, true> : hipblasGemv<T, false>;
+    auto hipblasTrsvFn = FORTRAN ? hipblasTrsv<T, true> : hipblasTrsv<T, false>;
+    auto hipblasGemmFn = FORTRAN ? hipblasGemm<T, true> : hipblasGemm<T, false>;
+    auto hipblasTrsmFn = FORTRAN ? hipblasTrsm<T, true> : hipblasTrsm<T, false>;
+
+    int max_n      = argus.N;
+    int calls      = std::max(argus.iters, latency_min_calls);
+    int cold_calls = std::max(argus.cold_iters, 1);
+
+    if(max_n < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasLocalHandle handle(argus);
+    hipStream_t        stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    // One allocation at the largest size serves every size; lda = n for all of them
+    size_t vec_size = std::max(max_n, 1);
+    size_t mat_size = vec_size * vec_size;
+
+    host_vector<T> hx(vec_size);
+    host_vector<T> hA(mat_size);
+
+    device_vector<T>  dA(mat_size);
+    device_vector<T>  dB(mat_size);
+    device_vector<T>  dC(mat_size);
+    device_vector<T>  dx(vec_size);
+    device_vector<T>  dy(vec_size);
+    device_vector<T>  d_alpha(1);
+    device_vector<T>  d_beta(1);
+    device_vector<T>  d_result(1);
+    device_vector<Tr> d_norm(1);
+
+    T  h_alpha = argus.get_alpha<T>();
+    T  h_beta  = argus.get_beta<T>();
+    T  h_result;
+    Tr h_norm;
+
+    // Zero strictly triangular part and unit diagonal keep the repeated solves stable
+    srand(1);
+    hipblas_init<T>(hx, 1, vec_size, 1);
+    std::fill(hA.begin(), hA.end(), T(0));
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(T) * mat_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hA, sizeof(T) * mat_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hA, sizeof(T) * mat_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * vec_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hx, sizeof(T) * vec_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    std::vector<int> sizes{0};
+    for(int n = 1; n <= max_n; n *= 4)
+        sizes.push_back(n);
+    if(sizes.back() != max_n)
+        sizes.push_back(max_n);
+
+    std::cout << "routine,N,pointer_mode,calls,submit-ns/call,end-to-end-ns/call" << std::endl;
+
+    for(hipblasPointerMode_t mode : {HIPBLAS_POINTER_MODE_HOST, HIPBLAS_POINTER_MODE_DEVICE})
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, mode));
+
+        bool        host    = mode == HIPBLAS_POINTER_MODE_HOST;
+        const T*    alpha   = host ? &h_alpha : (const T*)d_alpha;
+        const T*    beta    = host ? &h_beta : (const T*)d_beta;
+        T*          result  = host ? &h_result : (T*)d_result;
+        Tr*         norm    = host ? &h_norm : (Tr*)d_norm;
+        const char* ptrmode = host ? "host" : "device";
+
+        for(int n : sizes)
+        {
+            int ld = std::max(n, 1);
+
+            std::vector<std::pair<const char*, std::function<hipblasStatus_t()>>> routines{
+                {"scal", [&] { return hipblasScalFn(handle, n, alpha, dx, 1); }},
+                {"axpy", [&] { return hipblasAxpyFn(handle, n, alpha, dx, 1, dy, 1); }},
+                {"dot", [&] { return hipblasDotFn(handle, n, dx, 1, dy, 1, result); }},
+                {"nrm2", [&] { return hipblasNrm2Fn(handle, n, dx, 1, norm); }},
+                {"gemv",
+                 [&] {
+                     return hipblasGemvFn(
+                         handle, HIPBLAS_OP_N, n, n, alpha, dA, ld, dx, 1, beta, dy, 1);
+                 }},
+                {"trsv",
+                 [&] {
+                     return hipblasTrsvFn(
+                         handle, HIPBLAS_FILL_MODE_LOWER, HIPBLAS_OP_N, HIPBLAS_DIAG_UNIT, n, dA,
+                         ld, dx, 1);
+                 }},
+                {"gemm",
+                 [&] {
+                     return hipblasGemmFn(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, alpha, dA,
+                                          ld, dB, ld, beta, dC, ld);
+                 }},
+                {"trsm",
+                 [&] {
+                     return hipblasTrsmFn(handle, HIPBLAS_SIDE_LEFT, HIPBLAS_FILL_MODE_LOWER,
+                                          HIPBLAS_OP_N, HIPBLAS_DIAG_UNIT, n, n, alpha, dA, ld,
+                                          dB, ld);
+                 }},
+            };
+
+            for(auto& routine : routines)
+            {
+                double submit_ns, end_to_end_ns;
+                CHECK_HIPBLAS_ERROR(latency_measure(
+                    stream, calls, cold_calls, routine.second, submit_ns, end_to_end_ns));
+
+                std::cout << routine.first << ", " << n << ", " << ptrmode << ", " << calls
+                          << ", " << submit_ns << ", " << end_to_end_ns << std::endl;
+            }
+        }
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
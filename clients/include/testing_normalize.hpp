@@ -0,0 +1,462 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <limits>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T, typename Tr = T>
+hipblasStatus_t testing_normalize(const Arguments& argus)
+{
+    int N    = argus.N;
+    int incx = argus.incx;
+
+    auto hipblasNormalizeFn = hipblasNormalize<T, Tr>;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || incx <= 0)
+    {
+        device_vector<Tr> d_hipblas_result_0(1);
+        host_vector<Tr>   h_hipblas_result_0(1);
+        hipblas_init_nan(h_hipblas_result_0.data(), 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(d_hipblas_result_0, h_hipblas_result_0, sizeof(Tr), hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeFn(handle, N, nullptr, incx, d_hipblas_result_0));
+
+        host_vector<Tr> cpu_0(1);
+        host_vector<Tr> gpu_0(1);
+
+        CHECK_HIP_ERROR(hipMemcpy(gpu_0, d_hipblas_result_0, sizeof(Tr), hipMemcpyDeviceToHost));
+        unit_check_general<Tr>(1, 1, 1, cpu_0, gpu_0);
+
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t sizeX = size_t(N) * incx;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx_host(sizeX);
+    host_vector<T> hx_device(sizeX);
+    host_vector<T> hx_cpu(sizeX);
+
+    Tr                cpu_result, h_hipblas_result_host, h_hipblas_result_device;
+    device_vector<T>  dx_host(sizeX);
+    device_vector<T>  dx_device(sizeX);
+    device_vector<Tr> d_hipblas_result(1);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hx_host, 1, N, incx);
+    hx_device = hx_host;
+    hx_cpu    = hx_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx_host, hx_host.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_device, hx_device.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeFn(handle, N, dx_device, incx, d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeFn(handle, N, dx_host, incx, &h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            &h_hipblas_result_device, d_hipblas_result, sizeof(Tr), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hx_host.data(), dx_host, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hx_device.data(), dx_device, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_normalize<T, Tr>(N, hx_cpu.data(), incx, &cpu_result);
+
+        // the norm is summed in another order than the reference, so x is only near it
+        double tolerance = N * std::numeric_limits<Tr>::epsilon();
+        if(argus.unit_check)
+        {
+            unit_check_nrm2<Tr>(cpu_result, h_hipblas_result_host, N);
+            unit_check_nrm2<Tr>(cpu_result, h_hipblas_result_device, N);
+            near_check_general<T>(1, N, incx, hx_cpu.data(), hx_host.data(), tolerance);
+            near_check_general<T>(1, N, incx, hx_cpu.data(), hx_device.data(), tolerance);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, N, incx, hx_cpu.data(), hx_host.data());
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, N, incx, hx_cpu.data(), hx_device.data());
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasNormalizeFn(handle, N, dx_device, incx, d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            nrm2_gflop_count<T>(N) + scal_gflop_count<T, Tr>(N),
+            nrm2_gbyte_count<T>(N) + copy_gbyte_count<T>(N),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// a zero x has a zero norm and is left unchanged, in both pointer modes
+template <typename T, typename Tr = T>
+hipblasStatus_t testing_normalize_zero(const Arguments& argus)
+{
+    int N    = argus.N;
+    int incx = argus.incx;
+
+    auto hipblasNormalizeFn = hipblasNormalize<T, Tr>;
+
+    hipblasLocalHandle handle(argus);
+
+    if(N <= 0 || incx <= 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    size_t sizeX = size_t(N) * incx;
+
+    host_vector<T> hx_zero(sizeX);
+    host_vector<T> hx_host(sizeX);
+    host_vector<T> hx_device(sizeX);
+
+    Tr                cpu_result = 0, h_hipblas_result_host, h_hipblas_result_device;
+    device_vector<T>  dx_host(sizeX);
+    device_vector<T>  dx_device(sizeX);
+    device_vector<Tr> d_hipblas_result(1);
+
+    for(size_t i = 0; i < sizeX; i++)
+        hx_zero[i] = T(0);
+    hipblas_init_nan(&h_hipblas_result_host, 1);
+    hipblas_init_nan(&h_hipblas_result_device, 1);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx_host, hx_zero.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_device, hx_zero.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        d_hipblas_result, &h_hipblas_result_device, sizeof(Tr), hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+    CHECK_HIPBLAS_ERROR(hipblasNormalizeFn(handle, N, dx_device, incx, d_hipblas_result));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasNormalizeFn(handle, N, dx_host, incx, &h_hipblas_result_host));
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        &h_hipblas_result_device, d_hipblas_result, sizeof(Tr), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hx_host.data(), dx_host, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hx_device.data(), dx_device, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<Tr>(1, 1, 1, &cpu_result, &h_hipblas_result_host);
+        unit_check_general<Tr>(1, 1, 1, &cpu_result, &h_hipblas_result_device);
+        unit_check_general<T>(1, N, incx, hx_zero.data(), hx_host.data());
+        unit_check_general<T>(1, N, incx, hx_zero.data(), hx_device.data());
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T, typename Tr = T>
+hipblasStatus_t testing_normalize_batched(const Arguments& argus)
+{
+    int N           = argus.N;
+    int incx        = argus.incx;
+    int batch_count = argus.batch_count;
+
+    auto hipblasNormalizeBatchedFn = hipblasNormalizeBatched<T, Tr>;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        device_vector<Tr> d_hipblas_result_0(std::max(batch_count, 1));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(
+            hipblasNormalizeBatchedFn(handle, N, nullptr, incx, batch_count, d_hipblas_result_0));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_batch_vector<T> hx_host(N, incx, batch_count);
+    host_batch_vector<T> hx_device(N, incx, batch_count);
+    host_batch_vector<T> hx_cpu(N, incx, batch_count);
+    host_vector<Tr>      h_cpu_result(batch_count);
+    host_vector<Tr>      h_hipblas_result_host(batch_count);
+    host_vector<Tr>      h_hipblas_result_device(batch_count);
+
+    device_batch_vector<T> dx_host(N, incx, batch_count);
+    device_batch_vector<T> dx_device(N, incx, batch_count);
+    device_vector<Tr>      d_hipblas_result(batch_count);
+    CHECK_HIP_ERROR(dx_host.memcheck());
+    CHECK_HIP_ERROR(dx_device.memcheck());
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    hipblas_init(hx_host, true);
+    // a zero first instance checks that a zero norm leaves its x unchanged next to the others
+    if(batch_count > 1)
+        for(int i = 0; i < N; i++)
+            hx_host[0][size_t(i) * incx] = T(0);
+    hx_device.copy_from(hx_host);
+    hx_cpu.copy_from(hx_host);
+
+    CHECK_HIP_ERROR(dx_host.transfer_from(hx_host));
+    CHECK_HIP_ERROR(dx_device.transfer_from(hx_device));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeBatchedFn(
+            handle, N, dx_device.ptr_on_device(), incx, batch_count, d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeBatchedFn(
+            handle, N, dx_host.ptr_on_device(), incx, batch_count, h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
+                                  d_hipblas_result,
+                                  sizeof(Tr) * batch_count,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hx_host.transfer_from(dx_host));
+        CHECK_HIP_ERROR(hx_device.transfer_from(dx_device));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_normalize<T, Tr>(N, hx_cpu[b], incx, &h_cpu_result[b]);
+        });
+
+        // the norm is summed in another order than the reference, so x is only near it
+        double tolerance = N * std::numeric_limits<Tr>::epsilon();
+        if(argus.unit_check)
+        {
+            unit_check_nrm2<Tr>(batch_count, h_cpu_result, h_hipblas_result_host, N);
+            unit_check_nrm2<Tr>(batch_count, h_cpu_result, h_hipblas_result_device, N);
+            near_check_general<T>(1, N, batch_count, incx, hx_cpu, hx_host, tolerance);
+            near_check_general<T>(1, N, batch_count, incx, hx_cpu, hx_device, tolerance);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', 1, N, incx, hx_cpu, hx_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<T>('F', 1, N, incx, hx_cpu, hx_device, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasNormalizeBatchedFn(
+                handle, N, dx_device.ptr_on_device(), incx, batch_count, d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            nrm2_gflop_count<T>(N) + scal_gflop_count<T, Tr>(N),
+            nrm2_gbyte_count<T>(N) + copy_gbyte_count<T>(N),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T, typename Tr = T>
+hipblasStatus_t testing_normalize_strided_batched(const Arguments& argus)
+{
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasStride stridex = size_t(N) * incx * stride_scale;
+    size_t        sizeX   = stridex * batch_count;
+
+    auto hipblasNormalizeStridedBatchedFn = hipblasNormalizeStridedBatched<T, Tr>;
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N <= 0 || incx <= 0 || batch_count <= 0)
+    {
+        device_vector<Tr> d_hipblas_result_0(std::max(batch_count, 1));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeStridedBatchedFn(
+            handle, N, nullptr, incx, stridex, batch_count, d_hipblas_result_0));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T>  hx_host(sizeX);
+    host_vector<T>  hx_device(sizeX);
+    host_vector<T>  hx_cpu(sizeX);
+    host_vector<Tr> h_cpu_result(batch_count);
+    host_vector<Tr> h_hipblas_result_host(batch_count);
+    host_vector<Tr> h_hipblas_result_device(batch_count);
+
+    device_vector<T>  dx_host(sizeX);
+    device_vector<T>  dx_device(sizeX);
+    device_vector<Tr> d_hipblas_result(batch_count);
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hx_host, 1, N, incx, stridex, batch_count);
+    // a zero first instance checks that a zero norm leaves its x unchanged next to the others
+    if(batch_count > 1)
+        for(int i = 0; i < N; i++)
+            hx_host[size_t(i) * incx] = T(0);
+    hx_device = hx_host;
+    hx_cpu    = hx_host;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx_host, hx_host.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_device, hx_device.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+                    HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeStridedBatchedFn(
+            handle, N, dx_device, incx, stridex, batch_count, d_hipblas_result));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasNormalizeStridedBatchedFn(
+            handle, N, dx_host, incx, stridex, batch_count, h_hipblas_result_host));
+
+        CHECK_HIP_ERROR(hipMemcpy(h_hipblas_result_device,
+                                  d_hipblas_result,
+                                  sizeof(Tr) * batch_count,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hx_host.data(), dx_host, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hx_device.data(), dx_device, sizeof(T) * sizeX, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_normalize<T, Tr>(N, hx_cpu.data() + b * stridex, incx, &h_cpu_result[b]);
+        });
+
+        // the norm is summed in another order than the reference, so x is only near it
+        double tolerance = N * std::numeric_limits<Tr>::epsilon();
+        if(argus.unit_check)
+        {
+            unit_check_nrm2<Tr>(batch_count, h_cpu_result, h_hipblas_result_host, N);
+            unit_check_nrm2<Tr>(batch_count, h_cpu_result, h_hipblas_result_device, N);
+            near_check_general<T>(
+                1, N, batch_count, incx, stridex, hx_cpu.data(), hx_host.data(), tolerance);
+            near_check_general<T>(
+                1, N, batch_count, incx, stridex, hx_cpu.data(), hx_device.data(), tolerance);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error_host = norm_check_general<T>(
+                'F', 1, N, incx, stridex, hx_cpu.data(), hx_host.data(), batch_count);
+            hipblas_error_device = norm_check_general<T>(
+                'F', 1, N, incx, stridex, hx_cpu.data(), hx_device.data(), batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasNormalizeStridedBatchedFn(
+                handle, N, dx_device, incx, stridex, batch_count, d_hipblas_result));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_incx, e_stride_x, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            nrm2_gflop_count<T>(N) + scal_gflop_count<T, Tr>(N),
+            nrm2_gbyte_count<T>(N) + copy_gbyte_count<T>(N),
+            hipblas_error_host,
+            hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -92,10 +92,9 @@ hipblasStatus_t testing_nrm2_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_nrm2<T, Tr>(N, hx[b], incx, &(h_cpu_result[b]));
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -128,6 +127,7 @@ hipblasStatus_t testing_nrm2_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasNrm2BatchedFn(
                 handle, N, dx.ptr_on_device(), incx, batch_count, d_hipblas_result));
@@ -110,6 +110,7 @@ hipblasStatus_t testing_nrm2_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasNrm2ExFn(
                 handle, N, dx, xType, incx, d_hipblas_result, resultType, executionType));
@@ -123,10 +123,9 @@ hipblasStatus_t testing_nrm2_strided_batched_ex_template(const Arguments& argus)
                     CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_nrm2<Tx, Tr>(N, hx.data() + b * stridex, incx, &(h_cpu_result[b]));
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -159,6 +158,7 @@ hipblasStatus_t testing_nrm2_strided_batched_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasNrm2StridedBatchedExFn(handle,
                                                               N,
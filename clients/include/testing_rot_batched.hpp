@@ -73,10 +73,9 @@ hipblasStatus_t testing_rot_batched(const Arguments& arg)
     // cblas_rotg<T, U>(cx, cy, hc, hs);
     // cx[0] = hx[0];
     // cy[0] = hy[0];
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         cblas_rot<T, U, V>(N, cx[b], incx, cy[b], incy, *hc, *hs);
-    }
+    });
 
     if(arg.unit_check || arg.norm_check)
     {
@@ -171,6 +170,7 @@ hipblasStatus_t testing_rot_batched(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR((hipblasRotBatchedFn(handle,
                                                      N,
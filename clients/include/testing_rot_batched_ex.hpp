@@ -129,10 +129,9 @@ hipblasStatus_t testing_rot_batched_ex_template(const Arguments& arg)
         CHECK_HIP_ERROR(hy_device.transfer_from(dy));
 
         // CBLAS
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_rot<Tx, Tcs, Tcs>(N, hx_cpu[b], incx, hy_cpu[b], incy, *hc, *hs);
-        }
+        });
 
         if(arg.unit_check)
         {
@@ -165,6 +164,7 @@ hipblasStatus_t testing_rot_batched_ex_template(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasRotBatchedExFn(handle,
                                                       N,
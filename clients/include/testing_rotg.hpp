@@ -113,6 +113,7 @@ hipblasStatus_t testing_rotg(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR((hipblasRotgFn(handle, da, db, dc, ds)));
         }
@@ -104,10 +104,9 @@ hipblasStatus_t testing_rotg_batched(const Arguments& arg)
         CHECK_HIP_ERROR(rs.transfer_from(ds));
 
         // CBLAS
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_rotg<T, U>(ca[b], cb[b], cc[b], cs[b]);
-        }
+        });
 
         if(arg.unit_check)
         {
@@ -150,6 +149,7 @@ hipblasStatus_t testing_rotg_batched(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR((hipblasRotgBatchedFn(handle,
                                                       da.ptr_on_device(),
@@ -98,13 +98,12 @@ hipblasStatus_t testing_rotg_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(rc, dc, sizeof(U) * size_c, hipMemcpyDeviceToHost));
         CHECK_HIP_ERROR(hipMemcpy(rs, ds, sizeof(T) * size_s, hipMemcpyDeviceToHost));
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_rotg<T, U>(ca.data() + b * stride_a,
                              cb.data() + b * stride_b,
                              cc.data() + b * stride_c,
                              cs.data() + b * stride_s);
-        }
+        });
 
         if(arg.unit_check)
         {
@@ -151,6 +150,7 @@ hipblasStatus_t testing_rotg_strided_batched(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR((hipblasRotgStridedBatchedFn(
                 handle, da, stride_a, db, stride_b, dc, stride_c, ds, stride_s, batch_count)));
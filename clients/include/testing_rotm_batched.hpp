@@ -56,10 +56,9 @@ hipblasStatus_t testing_rotm_batched(const Arguments& arg)
     hipblas_init(hy, false);
     hipblas_init(hdata, false);
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         cblas_rotmg<T>(&hdata[b][0], &hdata[b][1], &hdata[b][2], &hdata[b][3], hparam[b]);
-    }
+    });
 
     constexpr int FLAG_COUNT        = 4;
     const T       FLAGS[FLAG_COUNT] = {-1, 0, 1, -2};
@@ -95,11 +94,10 @@ hipblasStatus_t testing_rotm_batched(const Arguments& arg)
             cx.copy_from(hx);
             cy.copy_from(hy);
 
-            for(int b = 0; b < batch_count; b++)
-            {
+            cblas_batched(batch_count, [&](int b) {
                 // CPU BLAS reference data
                 cblas_rotm<T>(N, cx[b], incx, cy[b], incy, hparam[b]);
-            }
+            });
 
             if(arg.unit_check)
             {
@@ -135,6 +133,7 @@ hipblasStatus_t testing_rotm_batched(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasRotmBatchedFn(handle,
                                                      N,
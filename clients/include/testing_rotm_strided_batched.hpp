@@ -123,11 +123,10 @@ hipblasStatus_t testing_rotm_strided_batched(const Arguments& arg)
             host_vector<T> cy = hy;
 
             // CPU BLAS reference data
-            for(int b = 0; b < batch_count; b++)
-            {
+            cblas_batched(batch_count, [&](int b) {
                 cblas_rotm<T>(
                     N, cx + b * stride_x, incx, cy + b * stride_y, incy, hparam + b * stride_param);
-            }
+            });
 
             if(arg.unit_check)
             {
@@ -160,6 +159,7 @@ hipblasStatus_t testing_rotm_strided_batched(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR((hipblasRotmStridedBatchedFn(handle,
                                                              N,
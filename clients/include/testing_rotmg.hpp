@@ -75,6 +75,7 @@ hipblasStatus_t testing_rotmg(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasRotmgFn(
                 handle, dparams, dparams + 1, dparams + 2, dparams + 3, dparams + 4));
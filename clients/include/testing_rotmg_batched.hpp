@@ -111,10 +111,9 @@ hipblasStatus_t testing_rotmg_batched(const Arguments& arg)
         CHECK_HIP_ERROR(hparams_d.transfer_from(dparams));
 
         // CBLAS
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_rotmg<T>(cd1[b], cd2[b], cx1[b], cy1[b], cparams[b]);
-        }
+        });
 
         if(arg.unit_check)
         {
@@ -163,6 +162,7 @@ hipblasStatus_t testing_rotmg_batched(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasRotmgBatchedFn(handle,
                                                       dd1.ptr_on_device(),
@@ -129,14 +129,13 @@ hipblasStatus_t testing_rotmg_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(
             hipMemcpy(hparams_d, dparams, sizeof(T) * size_param, hipMemcpyDeviceToHost));
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_rotmg<T>(cd1 + b * stride_d1,
                            cd2 + b * stride_d2,
                            cx1 + b * stride_x1,
                            cy1 + b * stride_y1,
                            cparams + b * stride_param);
-        }
+        });
 
         if(arg.unit_check)
         {
@@ -191,6 +190,7 @@ hipblasStatus_t testing_rotmg_strided_batched(const Arguments& arg)
         {
             if(iter == arg.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasRotmgStridedBatchedFn(handle,
                                                              dd1,
@@ -140,12 +140,12 @@ hipblasStatus_t testing_sbmv_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_sbmv<T>(uplo, M, K, h_alpha, hA[b], lda, hx[b], incx, h_beta, hy_cpu[b], incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -176,6 +176,7 @@ hipblasStatus_t testing_sbmv_batched(const Arguments& argus)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            hipblas_bench_mark_call(stream);
             CHECK_HIPBLAS_ERROR(hipblasSbmvBatchedFn(handle,
                                                      uplo,
                                                      M,
@@ -71,6 +71,7 @@ hipblasStatus_t testing_scal(const Arguments& argus)
         cblas_scal<T, U>(N, alpha, hz.data(), incx);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -95,6 +96,7 @@ hipblasStatus_t testing_scal(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasScalFn(handle, N, &alpha, dx, incx));
         }
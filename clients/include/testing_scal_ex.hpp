@@ -89,6 +89,7 @@ hipblasStatus_t testing_scal_ex_template(const Arguments& argus)
         cblas_scal<Tx, Ta>(N, h_alpha, hx_cpu, incx);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(unit_check)
         {
@@ -115,6 +116,7 @@ hipblasStatus_t testing_scal_ex_template(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasScalExFn(handle, N, d_alpha, alphaType, dx, xType, incx, executionType));
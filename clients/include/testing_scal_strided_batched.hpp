@@ -76,12 +76,12 @@ hipblasStatus_t testing_scal_strided_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_scal<T, U>(N, alpha, hz.data() + b * stridex, incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -100,6 +100,7 @@ hipblasStatus_t testing_scal_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasScalStridedBatchedFn(handle, N, &alpha, dx, incx, stridex, batch_count));
@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+hipblasStatus_t testing_set_get_capture_mode(const Arguments& argus)
+{
+    bool FORTRAN                 = argus.fortran;
+    auto hipblasSetCaptureModeFn = FORTRAN ? hipblasSetCaptureModeFortran : hipblasSetCaptureMode;
+    auto hipblasGetCaptureModeFn = FORTRAN ? hipblasGetCaptureModeFortran : hipblasGetCaptureMode;
+
+    hipblasCaptureMode_t mode;
+    hipblasLocalHandle   handle(argus);
+
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureModeFn(handle, &mode));
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_DEFAULT, mode);
+
+    // Make sure set()/get() functions work
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureModeFn(handle, HIPBLAS_CAPTURE_MODE_SAFE));
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureModeFn(handle, &mode));
+
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_SAFE, mode);
+
+    // A call which needs its arrays of pointers uploaded fails before enqueuing anything
+    int                  n     = 4;
+    float                alpha = 2.0f, beta = 0.0f;
+    device_vector<float> d(2 * n * n);
+    const float*         A[2] = {d + n * n, d};
+    float*               C[2] = {d + n * n, d};
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED,
+              hipblasSgemmBatchedHostPtrs(
+                  handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, A, n, A, n, &beta, C, n, 2));
+
+    // Capture a scal into a graph and replay it twice
+    host_vector<float>   hx(n), hx_gold(n);
+    device_vector<float> dx(n);
+    hipblas_init<float>(hx, 1, n, 1);
+    for(int i = 0; i < n; i++)
+        hx_gold[i] = hx[i] * alpha * alpha;
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * n, hipMemcpyHostToDevice));
+
+    hipStream_t stream, user_stream;
+    hipGraph_t  graph;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &user_stream));
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, stream));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    CHECK_HIPBLAS_ERROR(hipblasSscal(handle, n, &alpha, dx, 1));
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+
+    hipGraphExec_t instance;
+    CHECK_HIP_ERROR(hipGraphInstantiate(&instance, graph, nullptr, nullptr, 0));
+    for(int replay = 0; replay < 2; replay++)
+        CHECK_HIP_ERROR(hipGraphLaunch(instance, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipMemcpy(hx.data(), dx, sizeof(float) * n, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+        unit_check_general<float>(1, n, 1, hx_gold.data(), hx.data());
+
+    CHECK_HIP_ERROR(hipGraphExecDestroy(instance));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    CHECK_HIPBLAS_ERROR(hipblasSetStream(handle, user_stream));
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetCaptureModeFn(handle, HIPBLAS_CAPTURE_MODE_DEFAULT));
+    CHECK_HIPBLAS_ERROR(hipblasGetCaptureModeFn(handle, &mode));
+
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_DEFAULT, mode);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -89,6 +89,7 @@ hipblasStatus_t testing_set_get_matrix_async(const Arguments& argus)
         }
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -110,6 +111,7 @@ hipblasStatus_t testing_set_get_matrix_async(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasSetMatrixAsyncFn(
                 rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc, stream));
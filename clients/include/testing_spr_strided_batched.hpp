@@ -97,13 +97,13 @@ hipblasStatus_t testing_spr_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_spr<T>(
                 uplo, N, h_alpha, hx.data() + b * stridex, incx, hA_cpu.data() + b * strideA);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -131,6 +131,7 @@ hipblasStatus_t testing_spr_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasSprStridedBatchedFn(
                 handle, uplo, N, d_alpha, dx, incx, stridex, dA, strideA, batch_count));
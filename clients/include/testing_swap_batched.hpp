@@ -79,10 +79,9 @@ hipblasStatus_t testing_swap_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_swap<T>(N, hx_cpu[b], incx, hy_cpu[b], incy);
-        }
+        });
 
         if(unit_check)
         {
@@ -108,6 +107,7 @@ hipblasStatus_t testing_swap_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasSwapBatchedFn(
                 handle, N, dx.ptr_on_device(), incx, dy.ptr_on_device(), incy, batch_count));
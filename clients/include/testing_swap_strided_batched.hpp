@@ -89,10 +89,9 @@ hipblasStatus_t testing_swap_strided_batched(const Arguments& argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_swap<T>(N, hx.data() + b * stridex, incx, hy.data() + b * stridey, incy);
-        }
+        });
 
         if(unit_check)
         {
@@ -116,6 +115,7 @@ hipblasStatus_t testing_swap_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasSwapStridedBatchedFn(
                 handle, N, dx, incx, stridex, dy, incy, stridey, batch_count));
@@ -60,6 +60,7 @@ hipblasStatus_t testing_symm_batched(const Arguments& argus)
     host_batch_vector<T> hB(B_size, 1, batch_count);
     host_batch_vector<T> hC_host(C_size, 1, batch_count);
     host_batch_vector<T> hC_device(C_size, 1, batch_count);
+    host_batch_vector<T> hC_host_ptrs(C_size, 1, batch_count);
     host_batch_vector<T> hC_gold(C_size, 1, batch_count);
 
     // device arrays
@@ -77,6 +78,7 @@ hipblasStatus_t testing_symm_batched(const Arguments& argus)
     hipblas_init(hB);
     hipblas_init(hC_host);
     hC_device.copy_from(hC_host);
+    hC_host_ptrs.copy_from(hC_host);
     hC_gold.copy_from(hC_host);
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
@@ -126,21 +128,51 @@ hipblasStatus_t testing_symm_batched(const Arguments& argus)
 
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
+        // the arrays of pointers on host, in reverse order so that they are uploaded
+        std::vector<const T*> hA_ptrs(batch_count), hB_ptrs(batch_count);
+        std::vector<T*>       hC_ptrs(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hA_ptrs[b] = dA[batch_count - 1 - b];
+            hB_ptrs[b] = dB[batch_count - 1 - b];
+            hC_ptrs[b] = dC[batch_count - 1 - b];
+        }
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC_host_ptrs));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasSymmBatchedHostPtrs<T>(handle,
+                                                          side,
+                                                          uplo,
+                                                          M,
+                                                          N,
+                                                          &h_alpha,
+                                                          hA_ptrs.data(),
+                                                          lda,
+                                                          hB_ptrs.data(),
+                                                          ldb,
+                                                          &h_beta,
+                                                          hC_ptrs.data(),
+                                                          ldc,
+                                                          batch_count));
+
+        CHECK_HIP_ERROR(hC_host_ptrs.transfer_from(dC));
+
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_symm<T>(
                 side, uplo, M, N, h_alpha, hA[b], lda, hB[b], ldb, h_beta, hC_gold[b], ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
             unit_check_general<T>(M, N, batch_count, ldc, hC_gold, hC_host);
             unit_check_general<T>(M, N, batch_count, ldc, hC_gold, hC_device);
+            unit_check_general<T>(M, N, batch_count, ldc, hC_gold, hC_host_ptrs);
         }
 
         if(argus.norm_check)
@@ -163,6 +195,7 @@ hipblasStatus_t testing_symm_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasSymmBatchedFn(handle,
                                                      side,
@@ -141,8 +141,7 @@ hipblasStatus_t testing_syr2_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_syr2<T>(uplo,
                           N,
                           h_alpha,
@@ -152,9 +151,10 @@ hipblasStatus_t testing_syr2_strided_batched(const Arguments& argus)
                           incy,
                           hA_cpu.data() + b * strideA,
                           lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -182,6 +182,7 @@ hipblasStatus_t testing_syr2_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasSyr2StridedBatchedFn(handle,
                                                             uplo,
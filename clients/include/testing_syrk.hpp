@@ -99,6 +99,7 @@ hipblasStatus_t testing_syrk(const Arguments& argus)
         cblas_syrk<T>(uplo, transA, N, K, h_alpha, hA, lda, h_beta, hC_gold, ldc);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -124,6 +125,7 @@ hipblasStatus_t testing_syrk(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasSyrkFn(handle, uplo, transA, N, K, d_alpha, dA, lda, d_beta, dC, ldc));
@@ -0,0 +1,659 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <type_traits>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// syrk_ex and herk_ex are checked against cblas syrk and herk of A converted to the type of C. With
+// the integer initialization every product and sum is exact in C, so the unit check compares
+// exactly. The whole of C is compared, so the triangle that must not be written is checked as well.
+// HERK selects herk_ex, whose alpha and beta are real.
+
+template <typename T>
+inline T syrk_ex_convert(T a)
+{
+    return a;
+}
+
+inline float syrk_ex_convert(hipblasHalf a)
+{
+    return half_to_float(a);
+}
+
+inline float syrk_ex_convert(hipblasBfloat16 a)
+{
+    return bfloat16_to_float(a);
+}
+
+template <typename T, typename U>
+void syrk_ex_reference(std::false_type,
+                       hipblasFillMode_t  uplo,
+                       hipblasOperation_t transA,
+                       int                n,
+                       int                k,
+                       U                  alpha,
+                       T*                 A,
+                       int                lda,
+                       U                  beta,
+                       T*                 C,
+                       int                ldc)
+{
+    cblas_syrk<T>(uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <typename T, typename U>
+void syrk_ex_reference(std::true_type,
+                       hipblasFillMode_t  uplo,
+                       hipblasOperation_t transA,
+                       int                n,
+                       int                k,
+                       U                  alpha,
+                       T*                 A,
+                       int                lda,
+                       U                  beta,
+                       T*                 C,
+                       int                ldc)
+{
+    cblas_herk<T, U>(uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <typename Ta, typename Tc = Ta, bool HERK = false>
+hipblasStatus_t testing_syrk_ex_template(const Arguments& argus)
+{
+    using Ts = std::conditional_t<HERK, real_t<Tc>, Tc>;
+    auto hipblasSyrkExFn = HERK ? hipblasHerkEx : hipblasSyrkEx;
+
+    int N   = argus.N;
+    int K   = argus.K;
+    int lda = argus.lda;
+    int ldc = argus.ldc;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    Ts h_alpha = argus.get_alpha<Ts>();
+    Ts h_beta  = argus.get_beta<Ts>();
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || ldc < N || (transA == HIPBLAS_OP_N && lda < N)
+       || (transA != HIPBLAS_OP_N && lda < K))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int    K1     = (transA == HIPBLAS_OP_N ? K : N);
+    size_t A_size = size_t(lda) * K1;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta> hA(A_size);
+    host_vector<Tc> hA_gold(A_size);
+    host_vector<Tc> hC_host(C_size);
+    host_vector<Tc> hC_device(C_size);
+    host_vector<Tc> hC_gold(C_size);
+
+    device_vector<Ta> dA(A_size);
+    device_vector<Tc> dC(C_size);
+    device_vector<Ts> d_alpha(1);
+    device_vector<Ts> d_beta(1);
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Ta>(hA, N, K1, lda);
+    hipblas_init<Tc>(hC_host, N, N, ldc);
+
+    for(size_t i = 0; i < A_size; i++)
+        hA_gold[i] = syrk_ex_convert(hA[i]);
+    hC_device = hC_host;
+    hC_gold   = hC_host;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Ts), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Ts), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasSyrkExFn(handle,
+                                            uplo,
+                                            transA,
+                                            N,
+                                            K,
+                                            &h_alpha,
+                                            dA,
+                                            a_type,
+                                            lda,
+                                            &h_beta,
+                                            dC,
+                                            c_type,
+                                            ldc,
+                                            compute_type));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(Tc) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasSyrkExFn(handle,
+                                            uplo,
+                                            transA,
+                                            N,
+                                            K,
+                                            d_alpha,
+                                            dA,
+                                            a_type,
+                                            lda,
+                                            d_beta,
+                                            dC,
+                                            c_type,
+                                            ldc,
+                                            compute_type));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        syrk_ex_reference(std::integral_constant<bool, HERK>{},
+                          uplo,
+                          transA,
+                          N,
+                          K,
+                          h_alpha,
+                          hA_gold.data(),
+                          lda,
+                          h_beta,
+                          hC_gold.data(),
+                          ldc);
+
+        // enable unit check; unit check and norm check only read the results
+        if(argus.unit_check)
+        {
+            unit_check_general<Tc>(N, N, ldc, hC_gold, hC_host);
+            unit_check_general<Tc>(N, N, ldc, hC_gold, hC_device);
+        }
+
+        if(argus.norm_check)
+        {
+            hipblas_error_host   = norm_check_general<Tc>('F', N, N, ldc, hC_gold, hC_host);
+            hipblas_error_device = norm_check_general<Tc>('F', N, N, ldc, hC_gold, hC_device);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSyrkExFn(handle,
+                                                uplo,
+                                                transA,
+                                                N,
+                                                K,
+                                                d_alpha,
+                                                dA,
+                                                a_type,
+                                                lda,
+                                                d_beta,
+                                                dC,
+                                                c_type,
+                                                ldc,
+                                                compute_type));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        ArgumentModel<e_uplo_option, e_transA_option, e_N, e_K, e_alpha, e_lda, e_beta, e_ldc>{}
+            .log_args<Tc>(std::cout,
+                          argus,
+                          gpu_time_used,
+                          HERK ? herk_gflop_count<Tc>(N, K) : syrk_gflop_count<Tc>(N, K),
+                          HERK ? herk_gbyte_count<Tc>(N, K) : syrk_gbyte_count<Tc>(N, K),
+                          hipblas_error_host,
+                          hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename Ta, typename Tc = Ta, bool HERK = false>
+hipblasStatus_t testing_syrk_batched_ex_template(const Arguments& argus)
+{
+    using Ts = std::conditional_t<HERK, real_t<Tc>, Tc>;
+    auto hipblasSyrkBatchedExFn = HERK ? hipblasHerkBatchedEx : hipblasSyrkBatchedEx;
+
+    int N           = argus.N;
+    int K           = argus.K;
+    int lda         = argus.lda;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    Ts h_alpha = argus.get_alpha<Ts>();
+    Ts h_beta  = argus.get_beta<Ts>();
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || ldc < N || (transA == HIPBLAS_OP_N && lda < N)
+       || (transA != HIPBLAS_OP_N && lda < K) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(argus);
+
+    int    K1     = (transA == HIPBLAS_OP_N ? K : N);
+    size_t A_size = size_t(lda) * K1;
+    size_t C_size = size_t(ldc) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<Ta> hA(A_size, 1, batch_count);
+    host_batch_vector<Tc> hA_gold(A_size, 1, batch_count);
+    host_batch_vector<Tc> hC_host(C_size, 1, batch_count);
+    host_batch_vector<Tc> hC_device(C_size, 1, batch_count);
+    host_batch_vector<Tc> hC_gold(C_size, 1, batch_count);
+
+    device_batch_vector<Ta> dA(A_size, 1, batch_count);
+    device_batch_vector<Tc> dC(C_size, 1, batch_count);
+    device_vector<Ts>       d_alpha(1);
+    device_vector<Ts>       d_beta(1);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+
+    hipblas_init(hA, true);
+    hipblas_init(hC_host);
+    for(int b = 0; b < batch_count; b++)
+        for(size_t i = 0; i < A_size; i++)
+            hA_gold[b][i] = syrk_ex_convert(hA[b][i]);
+    hC_device.copy_from(hC_host);
+    hC_gold.copy_from(hC_host);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Ts), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Ts), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasSyrkBatchedExFn(handle,
+                                                   uplo,
+                                                   transA,
+                                                   N,
+                                                   K,
+                                                   &h_alpha,
+                                                   (const void**)(Ta**)dA.ptr_on_device(),
+                                                   a_type,
+                                                   lda,
+                                                   &h_beta,
+                                                   (void**)(Tc**)dC.ptr_on_device(),
+                                                   c_type,
+                                                   ldc,
+                                                   batch_count,
+                                                   compute_type));
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasSyrkBatchedExFn(handle,
+                                                   uplo,
+                                                   transA,
+                                                   N,
+                                                   K,
+                                                   d_alpha,
+                                                   (const void**)(Ta**)dA.ptr_on_device(),
+                                                   a_type,
+                                                   lda,
+                                                   d_beta,
+                                                   (void**)(Tc**)dC.ptr_on_device(),
+                                                   c_type,
+                                                   ldc,
+                                                   batch_count,
+                                                   compute_type));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            syrk_ex_reference(std::integral_constant<bool, HERK>{},
+                              uplo,
+                              transA,
+                              N,
+                              K,
+                              h_alpha,
+                              hA_gold[b],
+                              lda,
+                              h_beta,
+                              hC_gold[b],
+                              ldc);
+        });
+
+        // enable unit check; unit check and norm check only read the results
+        if(argus.unit_check)
+        {
+            unit_check_general<Tc>(N, N, batch_count, ldc, hC_gold, hC_host);
+            unit_check_general<Tc>(N, N, batch_count, ldc, hC_gold, hC_device);
+        }
+
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<Tc>('F', N, N, ldc, hC_gold, hC_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<Tc>('F', N, N, ldc, hC_gold, hC_device, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSyrkBatchedExFn(handle,
+                                                       uplo,
+                                                       transA,
+                                                       N,
+                                                       K,
+                                                       d_alpha,
+                                                       (const void**)(Ta**)dA.ptr_on_device(),
+                                                       a_type,
+                                                       lda,
+                                                       d_beta,
+                                                       (void**)(Tc**)dC.ptr_on_device(),
+                                                       c_type,
+                                                       ldc,
+                                                       batch_count,
+                                                       compute_type));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        ArgumentModel<e_uplo_option,
+                      e_transA_option,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldc,
+                      e_batch_count>{}
+            .log_args<Tc>(std::cout,
+                          argus,
+                          gpu_time_used,
+                          HERK ? herk_gflop_count<Tc>(N, K) : syrk_gflop_count<Tc>(N, K),
+                          HERK ? herk_gbyte_count<Tc>(N, K) : syrk_gbyte_count<Tc>(N, K),
+                          hipblas_error_host,
+                          hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename Ta, typename Tc = Ta, bool HERK = false>
+hipblasStatus_t testing_syrk_strided_batched_ex_template(const Arguments& argus)
+{
+    using Ts = std::conditional_t<HERK, real_t<Tc>, Tc>;
+    auto hipblasSyrkStridedBatchedExFn
+        = HERK ? hipblasHerkStridedBatchedEx : hipblasSyrkStridedBatchedEx;
+
+    int    N            = argus.N;
+    int    K            = argus.K;
+    int    lda          = argus.lda;
+    int    ldc          = argus.ldc;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasFillMode_t  uplo     = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA   = char2hipblas_operation(argus.transA_option);
+    int                K1       = (transA == HIPBLAS_OP_N ? K : N);
+    hipblasStride      stride_A = size_t(lda) * K1 * stride_scale;
+    hipblasStride      stride_C = size_t(ldc) * N * stride_scale;
+    size_t             A_size   = stride_A * batch_count;
+    size_t             C_size   = stride_C * batch_count;
+
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    Ts h_alpha = argus.get_alpha<Ts>();
+    Ts h_beta  = argus.get_beta<Ts>();
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || ldc < N || (transA == HIPBLAS_OP_N && lda < N)
+       || (transA != HIPBLAS_OP_N && lda < K) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta> hA(A_size);
+    host_vector<Tc> hA_gold(A_size);
+    host_vector<Tc> hC_host(C_size);
+    host_vector<Tc> hC_device(C_size);
+    host_vector<Tc> hC_gold(C_size);
+
+    device_vector<Ta> dA(A_size);
+    device_vector<Tc> dC(C_size);
+    device_vector<Ts> d_alpha(1);
+    device_vector<Ts> d_beta(1);
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(argus);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Ta>(hA, N, K1, lda, stride_A, batch_count);
+    hipblas_init<Tc>(hC_host, N, N, ldc, stride_C, batch_count);
+
+    for(size_t i = 0; i < A_size; i++)
+        hA_gold[i] = syrk_ex_convert(hA[i]);
+    hC_device = hC_host;
+    hC_gold   = hC_host;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC_host, sizeof(Tc) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(Ts), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(Ts), hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasSyrkStridedBatchedExFn(handle,
+                                                          uplo,
+                                                          transA,
+                                                          N,
+                                                          K,
+                                                          &h_alpha,
+                                                          dA,
+                                                          a_type,
+                                                          lda,
+                                                          stride_A,
+                                                          &h_beta,
+                                                          dC,
+                                                          c_type,
+                                                          ldc,
+                                                          stride_C,
+                                                          batch_count,
+                                                          compute_type));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_host, dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC_device, sizeof(Tc) * C_size, hipMemcpyHostToDevice));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasSyrkStridedBatchedExFn(handle,
+                                                          uplo,
+                                                          transA,
+                                                          N,
+                                                          K,
+                                                          d_alpha,
+                                                          dA,
+                                                          a_type,
+                                                          lda,
+                                                          stride_A,
+                                                          d_beta,
+                                                          dC,
+                                                          c_type,
+                                                          ldc,
+                                                          stride_C,
+                                                          batch_count,
+                                                          compute_type));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hC_device, dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            syrk_ex_reference(std::integral_constant<bool, HERK>{},
+                              uplo,
+                              transA,
+                              N,
+                              K,
+                              h_alpha,
+                              hA_gold.data() + b * stride_A,
+                              lda,
+                              h_beta,
+                              hC_gold.data() + b * stride_C,
+                              ldc);
+        }
+
+        // enable unit check; unit check and norm check only read the results
+        if(argus.unit_check)
+        {
+            unit_check_general<Tc>(N, N, batch_count, ldc, stride_C, hC_gold, hC_host);
+            unit_check_general<Tc>(N, N, batch_count, ldc, stride_C, hC_gold, hC_device);
+        }
+
+        if(argus.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<Tc>('F', N, N, ldc, stride_C, hC_gold, hC_host, batch_count);
+            hipblas_error_device = norm_check_general<Tc>(
+                'F', N, N, ldc, stride_C, hC_gold, hC_device, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasSyrkStridedBatchedExFn(handle,
+                                                              uplo,
+                                                              transA,
+                                                              N,
+                                                              K,
+                                                              d_alpha,
+                                                              dA,
+                                                              a_type,
+                                                              lda,
+                                                              stride_A,
+                                                              d_beta,
+                                                              dC,
+                                                              c_type,
+                                                              ldc,
+                                                              stride_C,
+                                                              batch_count,
+                                                              compute_type));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        ArgumentModel<e_uplo_option,
+                      e_transA_option,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_stride_a,
+                      e_beta,
+                      e_ldc,
+                      e_stride_c,
+                      e_batch_count>{}
+            .log_args<Tc>(std::cout,
+                          argus,
+                          gpu_time_used,
+                          HERK ? herk_gflop_count<Tc>(N, K) : syrk_gflop_count<Tc>(N, K),
+                          HERK ? herk_gbyte_count<Tc>(N, K) : syrk_gbyte_count<Tc>(N, K),
+                          hipblas_error_host,
+                          hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
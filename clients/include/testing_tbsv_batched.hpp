@@ -139,6 +139,7 @@ hipblasStatus_t testing_tbsv_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTbsvBatchedFn(handle,
                                                      uplo,
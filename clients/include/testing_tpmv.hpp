@@ -83,6 +83,7 @@ hipblasStatus_t testing_tpmv(const Arguments& argus)
         cblas_tpmv<T>(uplo, transA, diag, M, hA.data(), hx.data(), incx);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -104,6 +105,7 @@ hipblasStatus_t testing_tpmv(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTpmvFn(handle, uplo, transA, diag, M, dA, dx, incx));
         }
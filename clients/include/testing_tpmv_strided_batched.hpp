@@ -86,13 +86,13 @@ hipblasStatus_t testing_tpmv_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_tpmv<T>(
                 uplo, transA, diag, M, hA.data() + b * stride_A, hx.data() + b * stride_x, incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -115,6 +115,7 @@ hipblasStatus_t testing_tpmv_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTpmvStridedBatchedFn(
                 handle, uplo, transA, diag, M, dA, stride_A, dx, incx, stride_x, batch_count));
@@ -73,8 +73,7 @@ hipblasStatus_t testing_tpsv_batched(const Arguments& argus)
     hipblas_init(hx);
     hb.copy_from(hx);
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         //  calculate AAT = hA * hA ^ T
         cblas_gemm<T>(HIPBLAS_OP_N,
                       HIPBLAS_OP_T,
@@ -128,7 +127,7 @@ hipblasStatus_t testing_tpsv_batched(const Arguments& argus)
         cblas_trmv<T>(uplo, transA, diag, N, hA[b], N, hb[b], incx);
 
         regular_to_packed(uplo == HIPBLAS_FILL_MODE_UPPER, (T*)hA[b], (T*)hAP[b], N);
-    }
+    });
 
     cpu_x_or_b.copy_from(hb);
     hx_or_b_1.copy_from(hb);
@@ -181,6 +180,7 @@ hipblasStatus_t testing_tpsv_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTpsvBatchedFn(handle,
                                                      uplo,
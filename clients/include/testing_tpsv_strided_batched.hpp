@@ -75,8 +75,7 @@ hipblasStatus_t testing_tpsv_strided_batched(const Arguments& argus)
     hipblas_init<T>(hx, 1, N, abs_incx, stridex, batch_count);
     hb = hx;
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         T* hAb  = hA.data() + b * strideA;
         T* hAPb = hAP.data() + b * strideAP;
         T* AATb = AAT.data() + b * strideA;
@@ -121,7 +120,7 @@ hipblasStatus_t testing_tpsv_strided_batched(const Arguments& argus)
         cblas_trmv<T>(uplo, transA, diag, N, hAb, N, hbb, incx);
 
         regular_to_packed(uplo == HIPBLAS_FILL_MODE_UPPER, (T*)hAb, (T*)hAPb, N);
-    }
+    });
 
     cpu_x_or_b = hb; // cpuXorB <- B
     hx_or_b_1  = hb;
@@ -169,6 +168,7 @@ hipblasStatus_t testing_tpsv_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTpsvStridedBatchedFn(
                 handle, uplo, transA, diag, N, dAP, strideAP, dx_or_b, incx, stridex, batch_count));
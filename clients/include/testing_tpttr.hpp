@@ -0,0 +1,319 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_tpttr(const Arguments& argus)
+{
+    int N   = argus.N;
+    int lda = argus.lda;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1);
+    if(invalid_size || !N)
+    {
+        hipblasStatus_t actual = hipblasTpttr<T>(handle, uplo, N, nullptr, nullptr, lda);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t AP_size = size_t(N) * (N + 1) / 2;
+    size_t A_size  = size_t(lda) * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hAP(AP_size);
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_cpu(A_size);
+
+    device_vector<T> dAP(AP_size);
+    device_vector<T> dA(A_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hAP, 1, AP_size, 1);
+    hipblas_init<T>(hA, N, N, lda);
+    hA_cpu = hA;
+
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP.data(), sizeof(T) * AP_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasTpttr<T>(handle, uplo, N, dAP, dA, lda));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_tpttr<T>(uplo, N, hAP.data(), hA_cpu.data(), lda);
+
+        // the whole of A is compared, so the other triangle and the rows past N are checked to
+        // be left unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(lda, N, lda, hA_cpu, hA);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', lda, N, lda, hA_cpu, hA);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTpttr<T>(handle, uplo, N, dAP, dA, lda));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_uplo_option, e_N, e_lda>{}.log_args<T>(std::cout,
+                                                              argus,
+                                                              gpu_time_used,
+                                                              ArgumentLogging::NA_value,
+                                                              tpttr_gbyte_count<T>(N),
+                                                              hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_tpttr_batched(const Arguments& argus)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1) || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        hipblasStatus_t actual
+            = hipblasTpttrBatched<T>(handle, uplo, N, nullptr, nullptr, lda, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t AP_size = size_t(N) * (N + 1) / 2;
+    size_t A_size  = size_t(lda) * N;
+
+    double gpu_time_used, hipblas_error;
+
+    // arrays of pointers-to-host on host
+    host_batch_vector<T> hAP(AP_size, 1, batch_count);
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hA_cpu(A_size, 1, batch_count);
+
+    device_batch_vector<T> dAP(AP_size, 1, batch_count);
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+
+    CHECK_HIP_ERROR(dAP.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init(hAP, true);
+    hipblas_init(hA);
+    hA_cpu.copy_from(hA);
+
+    CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasTpttrBatched<T>(
+            handle, uplo, N, dAP.ptr_on_device(), dA.ptr_on_device(), lda, batch_count));
+
+        CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count,
+                      [&](int b) { cblas_tpttr<T>(uplo, N, hAP[b], hA_cpu[b], lda); });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(lda, N, batch_count, lda, hA_cpu, hA);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', lda, N, lda, hA_cpu, hA, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTpttrBatched<T>(
+                handle, uplo, N, dAP.ptr_on_device(), dA.ptr_on_device(), lda, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_uplo_option, e_N, e_lda, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            tpttr_gbyte_count<T>(N),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_tpttr_strided_batched(const Arguments& argus)
+{
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasStride stride_AP = size_t(N) * (N + 1) / 2 * stride_scale;
+    hipblasStride stride_A  = size_t(lda) * N * stride_scale;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1) || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasTpttrStridedBatched<T>(
+            handle, uplo, N, nullptr, stride_AP, nullptr, lda, stride_A, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t AP_size = stride_AP * batch_count;
+    size_t A_size  = stride_A * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hAP(AP_size);
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_cpu(A_size);
+
+    device_vector<T> dAP(AP_size);
+    device_vector<T> dA(A_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU, the gaps between the instances included
+    srand(1);
+    hipblas_init<T>(hAP, 1, AP_size, 1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hA_cpu = hA;
+
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP.data(), sizeof(T) * AP_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasTpttrStridedBatched<T>(
+            handle, uplo, N, dAP, stride_AP, dA, lda, stride_A, batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_tpttr<T>(uplo, N, hAP.data() + b * stride_AP, hA_cpu.data() + b * stride_A, lda);
+        });
+
+        // the whole allocation is compared, so the gaps between the instances are checked to be
+        // left unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, A_size, 1, hA_cpu, hA);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', 1, A_size, 1, hA_cpu, hA);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTpttrStridedBatched<T>(
+                handle, uplo, N, dAP, stride_AP, dA, lda, stride_A, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_uplo_option, e_N, e_lda, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            tpttr_gbyte_count<T>(N),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -58,6 +58,7 @@ hipblasStatus_t testing_trmm_batched(const Arguments& argus)
     host_batch_vector<T> hA(A_size, 1, batch_count);
     host_batch_vector<T> hB_host(B_size, 1, batch_count);
     host_batch_vector<T> hB_device(B_size, 1, batch_count);
+    host_batch_vector<T> hB_host_ptrs(B_size, 1, batch_count);
     host_batch_vector<T> hB_gold(B_size, 1, batch_count);
 
     // device arrays
@@ -71,6 +72,7 @@ hipblasStatus_t testing_trmm_batched(const Arguments& argus)
     hipblas_init(hA, true);
     hipblas_init(hB_host);
     hB_device.copy_from(hB_host);
+    hB_host_ptrs.copy_from(hB_host);
     hB_gold.copy_from(hB_host);
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
@@ -117,20 +119,48 @@ hipblasStatus_t testing_trmm_batched(const Arguments& argus)
 
         CHECK_HIP_ERROR(hB_device.transfer_from(dB));
 
+        // the arrays of pointers on host, in reverse order so that they are uploaded
+        std::vector<const T*> hA_ptrs(batch_count);
+        std::vector<T*>       hB_ptrs(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hA_ptrs[b] = dA[batch_count - 1 - b];
+            hB_ptrs[b] = dB[batch_count - 1 - b];
+        }
+
+        CHECK_HIP_ERROR(dB.transfer_from(hB_host_ptrs));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasTrmmBatchedHostPtrs<T>(handle,
+                                                          side,
+                                                          uplo,
+                                                          transA,
+                                                          diag,
+                                                          M,
+                                                          N,
+                                                          &h_alpha,
+                                                          hA_ptrs.data(),
+                                                          lda,
+                                                          hB_ptrs.data(),
+                                                          ldb,
+                                                          batch_count));
+
+        CHECK_HIP_ERROR(hB_host_ptrs.transfer_from(dB));
+
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trmm<T>(side, uplo, transA, diag, M, N, h_alpha, hA[b], lda, hB_gold[b], ldb);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
             unit_check_general<T>(M, N, batch_count, ldb, hB_gold, hB_host);
             unit_check_general<T>(M, N, batch_count, ldb, hB_gold, hB_device);
+            unit_check_general<T>(M, N, batch_count, ldb, hB_gold, hB_host_ptrs);
         }
         if(argus.norm_check)
         {
@@ -152,6 +182,7 @@ hipblasStatus_t testing_trmm_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrmmBatchedFn(handle,
                                                      side,
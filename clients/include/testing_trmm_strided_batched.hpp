@@ -123,8 +123,7 @@ hipblasStatus_t testing_trmm_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trmm<T>(side,
                           uplo,
                           transA,
@@ -136,9 +135,10 @@ hipblasStatus_t testing_trmm_strided_batched(const Arguments& argus)
                           lda,
                           hB_gold.data() + b * stride_B,
                           ldb);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -165,6 +165,7 @@ hipblasStatus_t testing_trmm_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrmmStridedBatchedFn(handle,
                                                             side,
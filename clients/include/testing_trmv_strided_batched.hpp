@@ -95,8 +95,7 @@ hipblasStatus_t testing_trmv_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trmv<T>(uplo,
                           transA,
                           diag,
@@ -105,9 +104,10 @@ hipblasStatus_t testing_trmv_strided_batched(const Arguments& argus)
                           lda,
                           hx.data() + b * stride_x,
                           incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -130,6 +130,7 @@ hipblasStatus_t testing_trmv_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrmvStridedBatchedFn(
                 handle, uplo, transA, diag, M, dA, lda, stride_A, dx, incx, stride_x, batch_count));
@@ -8,6 +8,7 @@
 #include <stdlib.h>
 #include <vector>
 
+#include "hipblas_ref_cache.hpp"
 #include "testing_common.hpp"
 
 using namespace std;
@@ -72,7 +73,9 @@ hipblasStatus_t testing_trsm(const Arguments& argus)
     }
     // proprocess the matrix to avoid ill-conditioned matrix
     vector<int> ipiv(K);
-    cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    hipblas_ref_cached<T>(argus, "trsm_getrf", {}, {hA, ipiv}, [&] {
+        cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    });
     for(int i = 0; i < K; i++)
     {
         for(int j = i; j < K; j++)
@@ -99,8 +102,10 @@ hipblasStatus_t testing_trsm(const Arguments& argus)
     hB_gold = hB_host; // original solution hX
 
     // Calculate hB = hA*hX;
-    cblas_trmm<T>(
-        side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_host, ldb);
+    hipblas_ref_cached<T>(argus, "trsm_trmm", {hA}, {hB_host}, [&] {
+        cblas_trmm<T>(
+            side, uplo, transA, diag, M, N, T(1.0) / h_alpha, (const T*)hA, lda, hB_host, ldb);
+    });
 
     hB_device = hB_host;
 
@@ -158,6 +163,7 @@ hipblasStatus_t testing_trsm(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasTrsmFn(handle, side, uplo, transA, diag, M, N, d_alpha, dA, lda, dB, ldb));
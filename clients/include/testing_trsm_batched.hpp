@@ -56,6 +56,7 @@ hipblasStatus_t testing_trsm_batched(const Arguments& argus)
     host_batch_vector<T> hA(A_size, 1, batch_count);
     host_batch_vector<T> hB_host(B_size, 1, batch_count);
     host_batch_vector<T> hB_device(B_size, 1, batch_count);
+    host_batch_vector<T> hB_host_ptrs(B_size, 1, batch_count);
     host_batch_vector<T> hB_gold(B_size, 1, batch_count);
 
     device_batch_vector<T> dA(A_size, 1, batch_count);
@@ -72,8 +73,7 @@ hipblasStatus_t testing_trsm_batched(const Arguments& argus)
     hipblas_init(hA, true);
     hipblas_init(hB_host);
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         // pad untouched area into zero
         for(int i = K; i < lda; i++)
         {
@@ -121,9 +121,10 @@ hipblasStatus_t testing_trsm_batched(const Arguments& argus)
                       lda,
                       hB_host[b],
                       ldb);
-    }
+    });
     hB_gold.copy_from(hB_host);
     hB_device.copy_from(hB_host);
+    hB_host_ptrs.copy_from(hB_host);
 
     CHECK_HIP_ERROR(dA.transfer_from(hA));
     CHECK_HIP_ERROR(dB.transfer_from(hB_host));
@@ -169,14 +170,39 @@ hipblasStatus_t testing_trsm_batched(const Arguments& argus)
 
         CHECK_HIP_ERROR(hB_device.transfer_from(dB));
 
+        // the arrays of pointers on host, in reverse order so that they are uploaded
+        std::vector<T*> hA_ptrs(batch_count), hB_ptrs(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            hA_ptrs[b] = dA[batch_count - 1 - b];
+            hB_ptrs[b] = dB[batch_count - 1 - b];
+        }
+
+        CHECK_HIP_ERROR(dB.transfer_from(hB_host_ptrs));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedHostPtrs<T>(handle,
+                                                          side,
+                                                          uplo,
+                                                          transA,
+                                                          diag,
+                                                          M,
+                                                          N,
+                                                          &h_alpha,
+                                                          hA_ptrs.data(),
+                                                          lda,
+                                                          hB_ptrs.data(),
+                                                          ldb,
+                                                          batch_count));
+
+        CHECK_HIP_ERROR(hB_host_ptrs.transfer_from(dB));
+
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trsm<T>(
                 side, uplo, transA, diag, M, N, h_alpha, (const T*)hA[b], lda, hB_gold[b], ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
@@ -189,6 +215,9 @@ hipblasStatus_t testing_trsm_batched(const Arguments& argus)
         {
             unit_check_error(hipblas_error_host, tolerance);
             unit_check_error(hipblas_error_device, tolerance);
+            unit_check_error(
+                norm_check_general<T>('F', M, N, ldb, hB_gold, hB_host_ptrs, batch_count),
+                tolerance);
         }
     }
 
@@ -206,6 +235,7 @@ hipblasStatus_t testing_trsm_batched(const Arguments& argus)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedFn(handle,
                                                      side,
@@ -74,8 +74,7 @@ hipblasStatus_t testing_trsm_batched_ex(const Arguments& argus)
     // Initial hA on CPU
     hipblas_init(hA, true);
     hipblas_init(hB_host);
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         // pad untouched area into zero
         for(int i = K; i < lda; i++)
         {
@@ -122,7 +121,7 @@ hipblasStatus_t testing_trsm_batched_ex(const Arguments& argus)
                       lda,
                       hB_host[b],
                       ldb);
-    }
+    });
 
     hB_device.copy_from(hB_host);
     hB_cpu.copy_from(hB_host);
@@ -218,11 +217,10 @@ hipblasStatus_t testing_trsm_batched_ex(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trsm<T>(
                 side, uplo, transA, diag, M, N, h_alpha, (const T*)hA[b], lda, hB_cpu[b], ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
@@ -252,6 +250,7 @@ hipblasStatus_t testing_trsm_batched_ex(const Arguments& argus)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmBatchedExFn(handle,
                                                        side,
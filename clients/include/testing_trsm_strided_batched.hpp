@@ -174,8 +174,7 @@ hipblasStatus_t testing_trsm_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trsm<T>(side,
                           uplo,
                           transA,
@@ -187,7 +186,7 @@ hipblasStatus_t testing_trsm_strided_batched(const Arguments& argus)
                           lda,
                           hB_gold.data() + b * strideB,
                           ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
@@ -216,6 +215,7 @@ hipblasStatus_t testing_trsm_strided_batched(const Arguments& argus)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedFn(handle,
                                                             side,
@@ -225,8 +225,7 @@ hipblasStatus_t testing_trsm_strided_batched_ex(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trsm<T>(side,
                           uplo,
                           transA,
@@ -238,7 +237,7 @@ hipblasStatus_t testing_trsm_strided_batched_ex(const Arguments& argus)
                           lda,
                           hB_cpu.data() + b * strideB,
                           ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
@@ -268,6 +267,7 @@ hipblasStatus_t testing_trsm_strided_batched_ex(const Arguments& argus)
             {
                 gpu_time_used = get_time_us_sync(stream);
             }
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsmStridedBatchedExFn(handle,
                                                               side,
@@ -157,6 +157,7 @@ hipblasStatus_t testing_trsv(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasTrsvFn(handle, uplo, transA, diag, M, dA, lda, dx_or_b, incx));
@@ -124,11 +124,10 @@ hipblasStatus_t testing_trsv_batched(const Arguments& argus)
     hipblas_init(hx, false);
     hb.copy_from(hx);
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         // Calculate hb = hA*hx;
         cblas_trmv<T>(uplo, transA, diag, M, hA[b], lda, hb[b], incx);
-    }
+    });
 
     hx_or_b_1.copy_from(hb);
 
@@ -180,6 +179,7 @@ hipblasStatus_t testing_trsv_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsvBatchedFn(handle,
                                                      uplo,
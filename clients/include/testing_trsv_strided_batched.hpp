@@ -81,8 +81,7 @@ hipblasStatus_t testing_trsv_strided_batched(const Arguments& argus)
     hipblas_init<T>(hx, 1, M, abs_incx, stridex, batch_count);
     hb = hx;
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    cblas_batched(batch_count, [&](int b) {
         T* hAb  = hA.data() + b * strideA;
         T* AATb = AAT.data() + b * strideA;
         T* hbb  = hb.data() + b * stridex;
@@ -125,7 +124,7 @@ hipblasStatus_t testing_trsv_strided_batched(const Arguments& argus)
 
         // Calculate hb = hA*hx;
         cblas_trmv<T>(uplo, transA, diag, M, hAb, lda, hbb, incx);
-    }
+    });
 
     hx_or_b_1 = hb;
 
@@ -174,6 +173,7 @@ hipblasStatus_t testing_trsv_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrsvStridedBatchedFn(handle,
                                                             uplo,
@@ -107,10 +107,9 @@ hipblasStatus_t testing_trtri_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trtri<T>(char_uplo, char_diag, N, hB[b], lda);
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -133,6 +132,7 @@ hipblasStatus_t testing_trtri_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrtriBatchedFn(handle,
                                                       uplo,
@@ -102,12 +102,12 @@ hipblasStatus_t testing_trtri_strided_batched(const Arguments& argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        cblas_batched(batch_count, [&](int b) {
             cblas_trtri<T>(char_uplo, char_diag, N, hB.data() + b * strideA, lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
+
         // unit check and norm check can not be interchanged their order
         if(argus.unit_check)
         {
@@ -129,6 +129,7 @@ hipblasStatus_t testing_trtri_strided_batched(const Arguments& argus)
         {
             if(iter == argus.cold_iters)
                 gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
 
             CHECK_HIPBLAS_ERROR(hipblasTrtriStridedBatchedFn(
                 handle, uplo, diag, N, dA, lda, strideA, dinvA, ldinvA, strideA, batch_count));
@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_trttp(const Arguments& argus)
+{
+    int N   = argus.N;
+    int lda = argus.lda;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1);
+    if(invalid_size || !N)
+    {
+        hipblasStatus_t actual = hipblasTrttp<T>(handle, uplo, N, nullptr, lda, nullptr);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size  = size_t(lda) * N;
+    size_t AP_size = size_t(N) * (N + 1) / 2;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hAP(AP_size);
+    host_vector<T> hAP_cpu(AP_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dAP(AP_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, N, N, lda);
+    hipblas_init<T>(hAP, 1, AP_size, 1);
+    hAP_cpu = hAP;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP.data(), sizeof(T) * AP_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasTrttp<T>(handle, uplo, N, dA, lda, dAP));
+
+        CHECK_HIP_ERROR(hipMemcpy(hAP.data(), dAP, sizeof(T) * AP_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_trttp<T>(uplo, N, hA.data(), lda, hAP_cpu.data());
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, AP_size, 1, hAP_cpu, hAP);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', 1, AP_size, 1, hAP_cpu, hAP);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTrttp<T>(handle, uplo, N, dA, lda, dAP));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_uplo_option, e_N, e_lda>{}.log_args<T>(std::cout,
+                                                              argus,
+                                                              gpu_time_used,
+                                                              ArgumentLogging::NA_value,
+                                                              tpttr_gbyte_count<T>(N),
+                                                              hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_trttp_batched(const Arguments& argus)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1) || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        hipblasStatus_t actual
+            = hipblasTrttpBatched<T>(handle, uplo, N, nullptr, lda, nullptr, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size  = size_t(lda) * N;
+    size_t AP_size = size_t(N) * (N + 1) / 2;
+
+    double gpu_time_used, hipblas_error;
+
+    // arrays of pointers-to-host on host
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hAP(AP_size, 1, batch_count);
+    host_batch_vector<T> hAP_cpu(AP_size, 1, batch_count);
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dAP(AP_size, 1, batch_count);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dAP.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init(hA, true);
+    hipblas_init(hAP);
+    hAP_cpu.copy_from(hAP);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dAP.transfer_from(hAP));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasTrttpBatched<T>(
+            handle, uplo, N, dA.ptr_on_device(), lda, dAP.ptr_on_device(), batch_count));
+
+        CHECK_HIP_ERROR(hAP.transfer_from(dAP));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count,
+                      [&](int b) { cblas_trttp<T>(uplo, N, hA[b], lda, hAP_cpu[b]); });
+
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, AP_size, batch_count, 1, hAP_cpu, hAP);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', 1, AP_size, 1, hAP_cpu, hAP, batch_count);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTrttpBatched<T>(
+                handle, uplo, N, dA.ptr_on_device(), lda, dAP.ptr_on_device(), batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_uplo_option, e_N, e_lda, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            tpttr_gbyte_count<T>(N),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_trttp_strided_batched(const Arguments& argus)
+{
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasStride stride_A  = size_t(lda) * N * stride_scale;
+    hipblasStride stride_AP = size_t(N) * (N + 1) / 2 * stride_scale;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasLocalHandle handle(argus);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    bool invalid_size = N < 0 || lda < std::max(N, 1) || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        hipblasStatus_t actual = hipblasTrttpStridedBatched<T>(
+            handle, uplo, N, nullptr, lda, stride_A, nullptr, stride_AP, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            actual, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+        return actual;
+    }
+
+    size_t A_size  = stride_A * batch_count;
+    size_t AP_size = stride_AP * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hAP(AP_size);
+    host_vector<T> hAP_cpu(AP_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dAP(AP_size);
+
+    double gpu_time_used, hipblas_error;
+
+    // Initial Data on CPU, the gaps between the instances included
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hAP, 1, AP_size, 1);
+    hAP_cpu = hAP;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAP, hAP.data(), sizeof(T) * AP_size, hipMemcpyHostToDevice));
+
+    if(argus.unit_check || argus.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasTrttpStridedBatched<T>(
+            handle, uplo, N, dA, lda, stride_A, dAP, stride_AP, batch_count));
+
+        CHECK_HIP_ERROR(hipMemcpy(hAP.data(), dAP, sizeof(T) * AP_size, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_batched(batch_count, [&](int b) {
+            cblas_trttp<T>(
+                uplo, N, hA.data() + b * stride_A, lda, hAP_cpu.data() + b * stride_AP);
+        });
+
+        // the whole allocation is compared, so the gaps between the instances are checked to be
+        // left unchanged as well
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(1, AP_size, 1, hAP_cpu, hAP);
+        }
+        if(argus.norm_check)
+        {
+            hipblas_error = norm_check_general<T>('F', 1, AP_size, 1, hAP_cpu, hAP);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = argus.cold_iters + argus.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            if(iter == argus.cold_iters)
+                gpu_time_used = get_time_us_sync(stream);
+            hipblas_bench_mark_call(stream);
+
+            CHECK_HIPBLAS_ERROR(hipblasTrttpStridedBatched<T>(
+                handle, uplo, N, dA, lda, stride_A, dAP, stride_AP, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_uplo_option, e_N, e_lda, e_batch_count>{}.log_args<T>(
+            std::cout,
+            argus,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            tpttr_gbyte_count<T>(N),
+            hipblas_error);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -74,6 +74,24 @@ auto hipblas_blas1_dispatch(const Arguments& arg)
     return TEST<void>{}(arg);
 }
 
+// syrk_ex and herk_ex functions, where C is of the type of the computation
+template <template <typename...> class TEST>
+auto hipblas_syrk_ex_dispatch(const Arguments& arg)
+{
+    const auto Ta = arg.a_type, Tc = arg.c_type, Tex = arg.compute_type;
+
+    if(Tc == Tex)
+    {
+        if(Ta == Tc)
+            return hipblas_simple_dispatch<TEST>(arg); // Ta = Tc = Tex
+        else if(Ta == HIPBLAS_R_16F && Tc == HIPBLAS_R_32F)
+            return TEST<hipblasHalf, float>{}(arg);
+        else if(Ta == HIPBLAS_R_16B && Tc == HIPBLAS_R_32F)
+            return TEST<hipblasBfloat16, float>{}(arg);
+    }
+    return TEST<void>{}(arg);
+}
+
 // BLAS1_ex functions
 // TODO: Update this when adding these functions to hipblas-bench
 template <template <typename...> class TEST>
@@ -13,7 +13,9 @@
 #include "cblas_interface.h"
 #include "complex.hpp"
 #include "hipblas_datatype2string.hpp"
+#include "hipblas_random.hpp"
 #include <cmath>
+#include <functional>
 #include <immintrin.h>
 #include <iostream>
 #include <random>
@@ -363,6 +365,127 @@ inline hipblasDoubleComplex random_generator_negative<hipblasDoubleComplex>()
     return {double(-(rand() % 10 + 1)), double(-(rand() % 10 + 1))};
 }
 
+/* ============================================================================================ */
+/* counter based generation: the random_generator values, drawn from the random bits of an
+   element instead of rand(), see hipblas_random.hpp */
+
+/*! \brief  a number in range [1,2,3,4,5,6,7,8,9,10] */
+template <typename T>
+inline T random_generator(const hipblas_random_bits& r)
+{
+    return T(r.w[0] % 10 + 1);
+}
+
+/*! \brief  a number in range [1,2,3] */
+template <>
+inline hipblasHalf random_generator<hipblasHalf>(const hipblas_random_bits& r)
+{
+    return float_to_half(float(r.w[0] % 3 + 1));
+}
+
+template <>
+inline hipblasBfloat16 random_generator<hipblasBfloat16>(const hipblas_random_bits& r)
+{
+    return float_to_bfloat16(float(r.w[0] % 3 + 1));
+}
+
+/*! \brief  two numbers in range [1,2,3,4,5,6,7,8,9,10] */
+template <>
+inline hipblasComplex random_generator<hipblasComplex>(const hipblas_random_bits& r)
+{
+    return {float(r.w[0] % 10 + 1), float(r.w[1] % 10 + 1)};
+}
+
+template <>
+inline hipblasDoubleComplex random_generator<hipblasDoubleComplex>(const hipblas_random_bits& r)
+{
+    return {double(r.w[0] % 10 + 1), double(r.w[1] % 10 + 1)};
+}
+
+/*! \brief  a number in range [-1,-2,-3,-4,-5,-6,-7,-8,-9,-10], [-1,-2,-3] for 16 bit floats */
+template <typename T>
+inline T random_generator_negative(const hipblas_random_bits& r)
+{
+    return -T(r.w[0] % 10 + 1);
+}
+
+template <>
+inline hipblasHalf random_generator_negative<hipblasHalf>(const hipblas_random_bits& r)
+{
+    return float_to_half(-float(r.w[0] % 3 + 1));
+}
+
+template <>
+inline hipblasBfloat16 random_generator_negative<hipblasBfloat16>(const hipblas_random_bits& r)
+{
+    return float_to_bfloat16(-float(r.w[0] % 3 + 1));
+}
+
+template <>
+inline hipblasComplex random_generator_negative<hipblasComplex>(const hipblas_random_bits& r)
+{
+    return {-float(r.w[0] % 10 + 1), -float(r.w[1] % 10 + 1)};
+}
+
+template <>
+inline hipblasDoubleComplex
+    random_generator_negative<hipblasDoubleComplex>(const hipblas_random_bits& r)
+{
+    return {-double(r.w[0] % 10 + 1), -double(r.w[1] % 10 + 1)};
+}
+
+/*! \brief  T from the real and imaginary parts of a value */
+template <typename T>
+inline T hipblas_value_cast(double re, double)
+{
+    return T(re);
+}
+
+template <>
+inline hipblasHalf hipblas_value_cast<hipblasHalf>(double re, double)
+{
+    return float_to_half(float(re));
+}
+
+template <>
+inline hipblasBfloat16 hipblas_value_cast<hipblasBfloat16>(double re, double)
+{
+    return float_to_bfloat16(float(re));
+}
+
+template <>
+inline hipblasComplex hipblas_value_cast<hipblasComplex>(double re, double im)
+{
+    return {float(re), float(im)};
+}
+
+template <>
+inline hipblasDoubleComplex hipblas_value_cast<hipblasDoubleComplex>(double re, double im)
+{
+    return {re, im};
+}
+
+/*! \brief  value of an element with random bits r, at offset index of its (strided batched)
+            allocation. rand_int gives the random_generator values, negated when negative;
+            trig_float gives sin(index) (and cos(index) as imaginary part); hpl gives values
+            uniform in [-0.5, 0.5).  */
+template <typename T>
+inline T hipblas_init_value(hipblas_initialization     init,
+                            const hipblas_random_bits& r,
+                            size_t                     index,
+                            bool                       negative = false)
+{
+    switch(init)
+    {
+    case hipblas_initialization::trig_float:
+        return hipblas_value_cast<T>(sin(double(index)), cos(double(index)));
+    case hipblas_initialization::hpl:
+        return hipblas_value_cast<T>(r.w[0] / 4294967296.0 - 0.5, r.w[1] / 4294967296.0 - 0.5);
+    default:
+        return negative ? random_generator_negative<T>(r) : random_generator<T>(r);
+    }
+}
+
 /* ============================================================================================ */
 
 /* ============================================================================================ */
@@ -400,24 +523,55 @@ void hipblas_packInt8(T* A, const T* temp, size_t M, size_t N, size_t lda)
 /* ============================================================================================ */
 /*! \brief  matrix/vector initialization: */
 // for vector x (M=1, N=lengthX, lda=incx);
-// for complex number, the real/imag part would be initialized with the same value
+// element (b, i, j) is keyed by its position and a seed drawn from rand(), so the matrices are
+// filled in parallel and do not depend on the number of threads
+template <typename T>
+void hipblas_init_matrix(T*                     A,
+                         int                    M,
+                         int                    N,
+                         int                    lda,
+                         hipblasStride          stride,
+                         int                    batch_count,
+                         hipblas_initialization init,
+                         bool                   alternating_sign)
+{
+    hipblas_fill<T>(
+        M,
+        N,
+        lda,
+        [=](size_t b) { return A + b * stride; },
+        batch_count,
+        hipblas_batches_overlap(M, N, lda, stride, batch_count),
+        hipblas_random_seed(),
+        [=](size_t b, int i, int j, const hipblas_random_bits& r) {
+            // with alternating sign, adjacent entries have opposite signs
+            return hipblas_init_value<T>(
+                init, r, i + j * size_t(lda) + b * stride, alternating_sign && !(j % 2 ^ i % 2));
+        });
+}
+
 template <typename T>
-void hipblas_init(
-    std::vector<T>& A, int M, int N, int lda, hipblasStride stride = 0, int batch_count = 1)
+void hipblas_init(std::vector<T>&        A,
+                  int                    M,
+                  int                    N,
+                  int                    lda,
+                  hipblasStride          stride      = 0,
+                  int                    batch_count = 1,
+                  hipblas_initialization init        = hipblas_initialization::rand_int)
 {
-    for(int b = 0; b < batch_count; b++)
-        for(int i = 0; i < M; ++i)
-            for(int j = 0; j < N; ++j)
-                A[i + j * lda + b * stride] = random_generator<T>();
+    hipblas_init_matrix(A.data(), M, N, lda, stride, batch_count, init, false);
 }
 
 template <typename T>
-void hipblas_init(T* A, int M, int N, int lda, hipblasStride stride = 0, int batch_count = 1)
+void hipblas_init(T*                     A,
+                  int                    M,
+                  int                    N,
+                  int                    lda,
+                  hipblasStride          stride      = 0,
+                  int                    batch_count = 1,
+                  hipblas_initialization init        = hipblas_initialization::rand_int)
 {
-    for(int b = 0; b < batch_count; b++)
-        for(int i = 0; i < M; ++i)
-            for(int j = 0; j < N; ++j)
-                A[i + j * lda + b * stride] = random_generator<T>();
+    hipblas_init_matrix(A, M, N, lda, stride, batch_count, init, false);
 }
 
 template <typename T>
@@ -430,12 +584,7 @@ void hipblas_init_alternating_sign(std::vector<T>& A, int M, int N, int lda)
     // This helps reduce floating point inaccuracies for 16bit
     // arithmetic where the exponent has only 5 bits, and the
     // mantissa 10 bits.
-    for(int i = 0; i < M; ++i)
-        for(int j = 0; j < N; ++j)
-            if(j % 2 ^ i % 2)
-                A[i + j * lda] = random_generator<T>();
-            else
-                A[i + j * lda] = random_generator_negative<T>();
+    hipblas_init_matrix(A.data(), M, N, lda, 0, 1, hipblas_initialization::rand_int, true);
 }
 
 template <typename T>
@@ -449,42 +598,48 @@ void hipblas_init_alternating_sign(
     // This helps reduce floating point inaccuracies for 16bit
     // arithmetic where the exponent has only 5 bits, and the
     // mantissa 10 bits.
-    for(int i_batch = 0; i_batch < batch_count; i_batch++)
-        for(int i = 0; i < M; ++i)
-            for(int j = 0; j < N; ++j)
-                if(j % 2 ^ i % 2)
-                    A[i + j * lda + i_batch * stride] = random_generator<T>();
-                else
-                    A[i + j * lda + i_batch * stride] = random_generator_negative<T>();
+    hipblas_init_matrix(
+        A.data(), M, N, lda, stride, batch_count, hipblas_initialization::rand_int, true);
+}
+
+/*! \brief  Copy the lower triangle of N x N matrices to their upper triangle; diagonal holds the
+            value written to the diagonal */
+template <typename T, typename Diagonal>
+void hipblas_mirror_lower(
+    T* A, int N, int lda, hipblasStride stride, int batch_count, Diagonal&& diagonal)
+{
+    auto mirror = [&](size_t b, int j) {
+        T* Ab = A + b * stride;
+        for(int i = 0; i < j; i++)
+            Ab[i + j * size_t(lda)] = Ab[j + i * size_t(lda)];
+        Ab[j + j * size_t(lda)] = diagonal(Ab[j + j * size_t(lda)]);
+    };
+
+    // the upper triangle is only written and the lower one only read, unless batches overlap
+    if(hipblas_batches_overlap(N, N, lda, stride, batch_count))
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                mirror(b, j);
+    else
+        hipblas_parallel_for(size_t(N) * batch_count,
+                             [&](size_t c) { mirror(c / N, int(c % N)); });
 }
 
-/*! \brief  symmetric matrix initialization: */
-// for real matrix only
+/*! \brief symmetric matrix initialization for strided_batched matricies: */
 template <typename T>
-void hipblas_init_symmetric(std::vector<T>& A, int N, int lda)
+void hipblas_init_symmetric(
+    std::vector<T>& A, int N, int lda, hipblasStride strideA, int batch_count)
 {
-    for(int i = 0; i < N; ++i)
-        for(int j = 0; j <= i; ++j)
-        {
-            auto r         = random_generator<T>();
-            A[j + i * lda] = r;
-            A[i + j * lda] = r;
-        }
+    hipblas_init(A, N, N, lda, strideA, batch_count);
+    hipblas_mirror_lower(A.data(), N, lda, strideA, batch_count, [](const T& d) { return d; });
 }
 
-/*! \brief symmetric matrix initialization for strided_batched matricies: */
+/*! \brief  symmetric matrix initialization: */
+// for real matrix only
 template <typename T>
-void hipblas_init_symmetric(
-    std::vector<T>& A, int N, int lda, hipblasStride strideA, int batch_count)
+void hipblas_init_symmetric(std::vector<T>& A, int N, int lda)
 {
-    for(int b = 0; b < batch_count; b++)
-        for(int off = b * strideA, i = 0; i < N; ++i)
-            for(int j = 0; j <= i; ++j)
-            {
-                auto r               = random_generator<T>();
-                A[i + j * lda + off] = r;
-                A[j + i * lda + off] = r;
-            }
+    hipblas_init_symmetric(A, N, lda, 0, 1);
 }
 
 /*! \brief  hermitian matrix initialization: */
@@ -493,12 +648,8 @@ void hipblas_init_symmetric(
 template <typename T>
 void hipblas_init_hermitian(std::vector<T>& A, int N, int lda)
 {
-    for(int i = 0; i < N; ++i)
-        for(int j = 0; j <= i; ++j)
-            if(i == j)
-                A[j + i * lda] = random_generator<real_t<T>>();
-            else
-                A[j + i * lda] = A[i + j * lda] = random_generator<T>();
+    hipblas_init(A, N, N, lda);
+    hipblas_mirror_lower(A.data(), N, lda, 0, 1, [](const T& d) { return T(std::real(d)); });
 }
 
 /* ============================================================================================ */
@@ -726,6 +877,9 @@ double get_time_us(void);
 /*! \brief  CPU Timer(in microsecond): synchronize with given queue/stream and return wall time */
 double get_time_us_sync(hipStream_t stream);
 
+/*! \brief  Mark the start of a timed call on stream, for the per-call latencies of hipblas-bench */
+void hipblas_bench_mark_call(hipStream_t stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -736,12 +890,41 @@ double get_time_us_sync(hipStream_t stream);
 
 struct Arguments;
 
+/* ============================================================================================ */
+/*! \brief  per-thread overrides installed by hipblas-bench when several host threads replay
+            the same problem. Default constructed state leaves the testers untouched.  */
+struct hipblas_bench_thread_context
+{
+    // borrowed by hipblasLocalHandle(const Arguments&) instead of creating a new handle
+    hipblasHandle_t handle = nullptr;
+
+    // attached with hipblasSetStream to the handle of hipblasLocalHandle(const Arguments&)
+    hipStream_t stream = nullptr;
+
+    // invoked once by get_time_us_sync before the first timestamp is taken, then cleared
+    std::function<void()> on_timing_start;
+
+    // invoked by hipblas_bench_mark_call before every timed call, and by get_time_us_sync before
+    // the stream is synchronized, so consecutive marks delimit the calls
+    std::function<void(hipStream_t)> on_call_mark;
+
+    // invoked by every get_time_us_sync once the stream is synchronized and the time is read
+    std::function<void()> on_time_sample;
+
+    // time spent in on_time_sample, left out of the times returned by get_time_us_sync
+    double sample_us = 0;
+};
+
+/*! \brief  context of the calling thread */
+hipblas_bench_thread_context& hipblas_bench_context();
+
 /* ============================================================================================ */
 /*! \brief  local handle which is automatically created and destroyed  */
 class hipblasLocalHandle
 {
     hipblasHandle_t m_handle;
     void*           m_memory = nullptr;
+    bool            m_owned  = true;
 
 public:
     hipblasLocalHandle();
@@ -306,6 +306,34 @@ typedef enum
     HIPBLAS_ATOMICS_ALLOWED     = 1,
 } hipblasAtomicsMode_t;
 
+/*! \brief Whether the calls on a handle may be captured into a graph, see hipblasSetCaptureMode */
+typedef enum
+{
+    HIPBLAS_CAPTURE_MODE_DEFAULT = 0, /**< calls may allocate, synchronize and read back */
+    HIPBLAS_CAPTURE_MODE_SAFE    = 1, /**< calls never allocate, synchronize or read back */
+} hipblasCaptureMode_t;
+
+/*! \brief Whether the batched solvers of a handle summarize their info arrays, see
+    hipblasSetBatchedInfoMode */
+typedef enum
+{
+    HIPBLAS_BATCHED_INFO_NONE    = 0, /**< the info arrays are only written */
+    HIPBLAS_BATCHED_INFO_SUMMARY = 1, /**< the info arrays are folded into the summary */
+} hipblasBatchedInfoMode_t;
+
+/*! \brief Summary of the info arrays of the batched solvers of a handle */
+typedef struct
+{
+    int calls; /**< solver calls summarized */
+    int failures; /**< nonzero entries in their info arrays */
+    int first_call; /**< call of the first nonzero entry, counted from 0, or -1 */
+    int first_index; /**< instance of the first nonzero entry in its call, or -1 */
+    int first_info; /**< value of the first nonzero entry, or 0 */
+} hipblasBatchedInfoSummary_t;
+
+/*! \brief Lane of hipblasSetStreamLane following the lane selected last */
+#define HIPBLAS_STREAM_LANE_NEXT (-1)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -366,6 +394,167 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Set the capture mode of a handle
+
+    \details
+    In HIPBLAS_CAPTURE_MODE_SAFE the calls on handle can be captured into a graph with
+    hipStreamBeginCapture and replayed: they never allocate device memory, synchronize a
+    stream or read device memory back to the host. A call which would do so fails instead,
+    before any work is enqueued:
+
+    - HIPBLAS_STATUS_ALLOC_FAILED when the workspace of the handle is too small for it.
+    - HIPBLAS_STATUS_NOT_SUPPORTED when it needs arrays of pointers copied between the host
+      and the device, as the batched functions emulated on the cuBLAS backend and the
+      HostPtrs functions with unevenly spaced arrays do.
+
+    The workspace is reserved when the mode is set: on the rocBLAS backend the device memory
+    of the handle stops growing at its current size, so calls issued once before the mode is
+    set size it for the same calls captured afterwards. It stays reserved when the mode is set
+    back to HIPBLAS_CAPTURE_MODE_DEFAULT, as captured graphs may still use it.
+
+    Argument errors of the solver functions are written to the host info when the call is
+    captured, not when the graph is replayed.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasCaptureMode_t]
+              HIPBLAS_CAPTURE_MODE_DEFAULT (the default) or HIPBLAS_CAPTURE_MODE_SAFE.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetCaptureMode(hipblasHandle_t      handle,
+                                                     hipblasCaptureMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetCaptureMode(hipblasHandle_t       handle,
+                                                     hipblasCaptureMode_t* mode);
+
+/*! \brief Set the batched info mode of a handle
+
+    \details
+    In HIPBLAS_BATCHED_INFO_SUMMARY the batched and strided batched getrf and getri functions
+    called on handle fold the info array they write into a summary kept by the handle: the
+    number of calls, the number of nonzero entries and the first of them. After the solver the
+    whole info array is copied to page-locked memory of the handle and scanned there, on a
+    stream the handle creates on the current device at the first such call. The stream of the
+    handle waits for the copy, which takes batch_count integers every call, but not for the
+    scan, so the scan overlaps with the work queued after the solver and the host is never
+    blocked. The caller learns whether any instance of a large batch failed without reading
+    the info arrays back. The summary is read with hipblasGetBatchedInfoSummaryAsync.
+
+    The copy and the scan are queued from the host, so the functions summarizing fail with
+    HIPBLAS_STATUS_NOT_SUPPORTED in HIPBLAS_CAPTURE_MODE_SAFE.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasBatchedInfoMode_t]
+              HIPBLAS_BATCHED_INFO_NONE (the default) or HIPBLAS_BATCHED_INFO_SUMMARY.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetBatchedInfoMode(hipblasHandle_t          handle,
+                                                         hipblasBatchedInfoMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetBatchedInfoMode(hipblasHandle_t           handle,
+                                                         hipblasBatchedInfoMode_t* mode);
+
+/*! \brief Read the summary of the info arrays of the batched solvers of a handle
+
+    \details
+    The summary is written to summary after the scans of the solvers queued on the handle
+    before the call: it covers them, and is valid once the stream of the handle, or an event
+    recorded on it after the call, has been synchronized. The call does not block the host, but
+    the stream of the handle waits for the readback, so the work queued after it starts once
+    those scans are done.
+
+    With no nonzero entry, first_call and first_index are -1 and first_info is 0. The summary
+    of a handle starts empty; with reset, the readback empties it after the copy, so the next
+    readback only covers the solvers queued after this one.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[out]
+    summary   pointer to a hipblasBatchedInfoSummary_t in host memory which outlives the
+              readback.
+    @param[in]
+    reset     [int]
+              nonzero to empty the summary after it is read.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetBatchedInfoSummaryAsync(
+    hipblasHandle_t handle, hipblasBatchedInfoSummary_t* summary, int reset);
+
+/*! \brief Set the number of lanes of a handle
+
+    \details
+    The lanes are streams owned by the handle, on which the independent calls of one host
+    thread are issued so that they may run concurrently on the device. A call is issued on the
+    lane selected by hipblasSetStreamLane, and hipblasJoinStreams orders the stream set with
+    hipblasSetStream, the user stream, after the work issued on the lanes:
+
+        hipblasSetStreamPool(handle, 4);
+        for(int i = 0; i < count; i++)
+        {
+            hipblasSetStreamLane(handle, HIPBLAS_STREAM_LANE_NEXT);
+            hipblasSaxpy(handle, n, &alpha, x[i], 1, y[i], 1);
+        }
+        hipblasJoinStreams(handle);
+
+    The lanes are created on the current device, and replace the lanes of handle after these
+    are joined. hipblasDestroy joins the lanes before it releases them.
+
+    The lanes share the backend handle, and with it the single device workspace that rocBLAS
+    and cuBLAS keep per handle. Calls using that workspace must not run on two lanes at once,
+    or they overwrite each other's partial results: issue them on one lane, or join the lanes
+    between them. These include the reductions asum, nrm2, dot, dotc, amax and amin with their
+    batched, strided batched and _ex forms, in either pointer mode, the triangular functions of
+    levels 2 and 3, gemv and gemm_ex on some sizes, and the solver functions. The other level 1
+    functions, ger, gemm and geam use no workspace and are lane-safe. The functions which use
+    memory of the hipBLAS handle, such as the emulated batched functions, gemm3m and syrk_ex,
+    wait for its last use on another lane, so they are safe but do not overlap.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              number of lanes; 0 (the default) releases them.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetStreamPool(hipblasHandle_t handle, int n);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetStreamPool(hipblasHandle_t handle, int* n);
+
+/*! \brief Issue the following calls of a handle on one of its lanes
+
+    \details
+    The calls on handle are issued on lane until the next hipblasSetStreamLane or
+    hipblasJoinStreams, and hipblasGetStream returns the stream of the lane. A lane selected for
+    the first time since the last join first waits for the work issued on the user stream
+    before the selection. Calls issued on different lanes must be independent.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    lane      [int]
+              lane in [0, n) of hipblasSetStreamPool, or HIPBLAS_STREAM_LANE_NEXT for the lane
+              after the one selected last, so that successive calls rotate over the lanes. The
+              rotation starts at lane 0 after a join.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetStreamLane(hipblasHandle_t handle, int lane);
+
+/*! \brief Join the lanes of a handle onto its user stream
+
+    \details
+    The user stream waits for the work issued on the lanes selected since the last join, and
+    the following calls on handle are issued on it again. Nothing is done when no lane was
+    selected. hipblasSetStream and hipblasSetStreamPool join the lanes first.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasJoinStreams(hipblasHandle_t handle);
+
 //amax
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
@@ -2909,1148 +3098,1069 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t
                                                           int                   batchCount);
 
 // ================================
-// ========== LEVEL 2 =============
+// ======= LEVEL 1 (fused) ========
 // ================================
 
-// gbmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmv(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            int                m,
-                                            int                n,
-                                            int                kl,
-                                            int                ku,
-                                            const float*       alpha,
-                                            const float*       A,
-                                            int                lda,
-                                            const float*       x,
-                                            int                incx,
-                                            const float*       beta,
-                                            float*             y,
-                                            int                incy);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            int                m,
-                                            int                n,
-                                            int                kl,
-                                            int                ku,
-                                            const double*      alpha,
-                                            const double*      A,
-                                            int                lda,
-                                            const double*      x,
-                                            int                incx,
-                                            const double*      beta,
-                                            double*            y,
-                                            int                incy);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
-                                            hipblasOperation_t    trans,
-                                            int                   m,
-                                            int                   n,
-                                            int                   kl,
-                                            int                   ku,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       y,
-                                            int                   incy);
+// axpby
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpby(hipblasHandle_t    handle,
+                                             int                n,
+                                             const hipblasHalf* alpha,
+                                             const hipblasHalf* x,
+                                             int                incx,
+                                             const hipblasHalf* beta,
+                                             hipblasHalf*       y,
+                                             int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpby(hipblasHandle_t handle,
+                                             int             n,
+                                             const float*    alpha,
+                                             const float*    x,
+                                             int             incx,
+                                             const float*    beta,
+                                             float*          y,
+                                             int             incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpby(hipblasHandle_t handle,
+                                             int             n,
+                                             const double*   alpha,
+                                             const double*   x,
+                                             int             incx,
+                                             const double*   beta,
+                                             double*         y,
+                                             int             incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpby(hipblasHandle_t       handle,
+                                             int                   n,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* x,
+                                             int                   incx,
+                                             const hipblasComplex* beta,
+                                             hipblasComplex*       y,
+                                             int                   incy);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    gbmv performs one of the matrix-vector operations
+    axpby  computes constant alpha multiplied by vector x, plus constant beta multiplied by
+           vector y
 
-        y := alpha*A*x    + beta*y,   or
-        y := alpha*A**T*x + beta*y,   or
-        y := alpha*A**H*x + beta*y,
+        y := alpha * x + beta * y
 
-    where alpha and beta are scalars, x and y are vectors and A is an
-    m by n banded matrix with kl sub-diagonals and ku super-diagonals.
+    With nonzero increments of the same sign the update is one pass over x and y; otherwise,
+    and in half precision, y is scaled first and alpha * x added in a second pass. For
+    beta = 0, y is not read.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    trans     [hipblasOperation_t]
-              indicates whether matrix A is tranposed (conjugated) or not
-    @param[in]
-    m         [int]
-              number of rows of matrix A
-    @param[in]
     n         [int]
-              number of columns of matrix A
-    @param[in]
-    kl        [int]
-              number of sub-diagonals of A
-    @param[in]
-    ku        [int]
-              number of super-diagonals of A
-    @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
-    @param[in]
-        A     device pointer storing banded matrix A.
-              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
-              of the banded matrix. The leading diagonal resides in row (ku + 1) with
-              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
-              resides below on the LHS of row ku + 2. This propogates up and down across
-              sub/super-diagonals.
-                Ex: (m = n = 7; ku = 2, kl = 2)
-                1 2 3 0 0 0 0             0 0 3 3 3 3 3
-                4 1 2 3 0 0 0             0 2 2 2 2 2 2
-                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
-                0 5 4 1 2 3 0             4 4 4 4 4 4 0
-                0 0 5 4 1 2 0             5 5 5 5 5 0 0
-                0 0 0 5 4 1 2             0 0 0 0 0 0 0
-                0 0 0 0 5 4 1             0 0 0 0 0 0 0
-              Note that the empty elements which don't correspond to data will not
-              be referenced.
+              the number of elements in each vector.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A. Must be >= (kl + ku + 1)
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
     x         device pointer storing vector x.
     @param[in]
     incx      [int]
               specifies the increment for the elements of x.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    beta      device pointer or host pointer to specify the scalar beta.
     @param[inout]
     y         device pointer storing vector y.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of y.
+              specifies the increment for the elements of y, incy != 0.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
-                                            hipblasOperation_t          trans,
-                                            int                         m,
-                                            int                         n,
-                                            int                         kl,
-                                            int                         ku,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* A,
-                                            int                         lda,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            const hipblasDoubleComplex* beta,
-                                            hipblasDoubleComplex*       y,
-                                            int                         incy);
 
-// gbmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
-                                                   hipblasOperation_t trans,
-                                                   int                m,
-                                                   int                n,
-                                                   int                kl,
-                                                   int                ku,
-                                                   const float*       alpha,
-                                                   const float* const A[],
-                                                   int                lda,
-                                                   const float* const x[],
-                                                   int                incx,
-                                                   const float*       beta,
-                                                   float* const       y[],
-                                                   int                incy,
-                                                   int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpby(hipblasHandle_t             handle,
+                                             int                         n,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* x,
+                                             int                         incx,
+                                             const hipblasDoubleComplex* beta,
+                                             hipblasDoubleComplex*       y,
+                                             int                         incy);
+
+// axpbyBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpbyBatched(hipblasHandle_t          handle,
+                                                    int                      n,
+                                                    const hipblasHalf*       alpha,
+                                                    const hipblasHalf* const x[],
+                                                    int                      incx,
+                                                    const hipblasHalf*       beta,
+                                                    hipblasHalf* const       y[],
+                                                    int                      incy,
+                                                    int                      batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpbyBatched(hipblasHandle_t    handle,
+                                                    int                n,
+                                                    const float*       alpha,
+                                                    const float* const x[],
+                                                    int                incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    int                incy,
+                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
-                                                   hipblasOperation_t  trans,
-                                                   int                 m,
-                                                   int                 n,
-                                                   int                 kl,
-                                                   int                 ku,
-                                                   const double*       alpha,
-                                                   const double* const A[],
-                                                   int                 lda,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   const double*       beta,
-                                                   double* const       y[],
-                                                   int                 incy,
-                                                   int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpbyBatched(hipblasHandle_t     handle,
+                                                    int                 n,
+                                                    const double*       alpha,
+                                                    const double* const x[],
+                                                    int                 incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    int                 incy,
+                                                    int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          trans,
-                                                   int                         m,
-                                                   int                         n,
-                                                   int                         kl,
-                                                   int                         ku,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex* const       y[],
-                                                   int                         incy,
-                                                   int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpbyBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       y[],
+                                                    int                         incy,
+                                                    int                         batchCount);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    gbmvBatched performs one of the matrix-vector operations
-
-        y_i := alpha*A_i*x_i    + beta*y_i,   or
-        y_i := alpha*A_i**T*x_i + beta*y_i,   or
-        y_i := alpha*A_i**H*x_i + beta*y_i,
+    axpbyBatched  computes constant alpha multiplied by vector x_i, plus constant beta
+                  multiplied by vector y_i, for each instance i in the batch
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
-    for i = 1, ..., batchCount.
+        y_i := alpha * x_i + beta * y_i
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    trans     [hipblasOperation_t]
-              indicates whether matrix A is tranposed (conjugated) or not
-    @param[in]
-    m         [int]
-              number of rows of each matrix A_i
-    @param[in]
     n         [int]
-              number of columns of each matrix A_i
-    @param[in]
-    kl        [int]
-              number of sub-diagonals of each A_i
-    @param[in]
-    ku        [int]
-              number of super-diagonals of each A_i
-    @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
-    @param[in]
-        A     device array of device pointers storing each banded matrix A_i.
-              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
-              of the banded matrix. The leading diagonal resides in row (ku + 1) with
-              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
-              resides below on the LHS of row ku + 2. This propogates up and down across
-              sub/super-diagonals.
-                Ex: (m = n = 7; ku = 2, kl = 2)
-                1 2 3 0 0 0 0             0 0 3 3 3 3 3
-                4 1 2 3 0 0 0             0 2 2 2 2 2 2
-                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
-                0 5 4 1 2 3 0             4 4 4 4 4 4 0
-                0 0 5 4 1 2 0             5 5 5 5 5 0 0
-                0 0 0 5 4 1 2             0 0 0 0 0 0 0
-                0 0 0 0 5 4 1             0 0 0 0 0 0 0
-              Note that the empty elements which don't correspond to data will not
-              be referenced.
+              the number of elements in each vector.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i. Must be >= (kl + ku + 1)
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
     x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of x.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    beta      device pointer or host pointer to specify the scalar beta.
     @param[inout]
     y         device array of device pointers storing each vector y_i.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of each y_i.
+              specifies the increment for the elements of y, incy != 0.
     @param[in]
     batchCount [int]
-                specifies the number of instances in the batch.
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
-                                                   hipblasOperation_t                trans,
-                                                   int                               m,
-                                                   int                               n,
-                                                   int                               kl,
-                                                   int                               ku,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const A[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex*       beta,
-                                                   hipblasDoubleComplex* const       y[],
-                                                   int                               incy,
-                                                   int                               batchCount);
 
-// gbmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t trans,
-                                                          int                m,
-                                                          int                n,
-                                                          int                kl,
-                                                          int                ku,
-                                                          const float*       alpha,
-                                                          const float*       A,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          const float*       x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          const float*       beta,
-                                                          float*             y,
-                                                          int                incy,
-                                                          hipblasStride      stridey,
-                                                          int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpbyBatched(hipblasHandle_t                   handle,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex*       alpha,
+                                                    const hipblasDoubleComplex* const x[],
+                                                    int                               incx,
+                                                    const hipblasDoubleComplex*       beta,
+                                                    hipblasDoubleComplex* const       y[],
+                                                    int                               incy,
+                                                    int                               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t trans,
-                                                          int                m,
-                                                          int                n,
-                                                          int                kl,
-                                                          int                ku,
-                                                          const double*      alpha,
-                                                          const double*      A,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          const double*      x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          const double*      beta,
-                                                          double*            y,
-                                                          int                incy,
-                                                          hipblasStride      stridey,
-                                                          int                batchCount);
+// axpbyStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpbyStridedBatched(hipblasHandle_t    handle,
+                                                           int                n,
+                                                           const hipblasHalf* alpha,
+                                                           const hipblasHalf* x,
+                                                           int                incx,
+                                                           hipblasStride      stridex,
+                                                           const hipblasHalf* beta,
+                                                           hipblasHalf*       y,
+                                                           int                incy,
+                                                           hipblasStride      stridey,
+                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    trans,
-                                                          int                   m,
-                                                          int                   n,
-                                                          int                   kl,
-                                                          int                   ku,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpbyStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           const float*    alpha,
+                                                           const float*    x,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           const float*    beta,
+                                                           float*          y,
+                                                           int             incy,
+                                                           hipblasStride   stridey,
+                                                           int             batchCount);
 
-/*! \brief BLAS Level 2 API
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpbyStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           const double*   alpha,
+                                                           const double*   x,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           const double*   beta,
+                                                           double*         y,
+                                                           int             incy,
+                                                           hipblasStride   stridey,
+                                                           int             batchCount);
 
-    \details
-    gbmvStridedBatched performs one of the matrix-vector operations
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpbyStridedBatched(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           const hipblasComplex* alpha,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           hipblasStride         stridex,
+                                                           const hipblasComplex* beta,
+                                                           hipblasComplex*       y,
+                                                           int                   incy,
+                                                           hipblasStride         stridey,
+                                                           int                   batchCount);
 
-        y_i := alpha*A_i*x_i    + beta*y_i,   or
-        y_i := alpha*A_i**T*x_i + beta*y_i,   or
-        y_i := alpha*A_i**H*x_i + beta*y_i,
+/*! \brief BLAS Level 1 API
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
-    for i = 1, ..., batchCount.
+    \details
+    axpbyStridedBatched  computes constant alpha multiplied by vector x_i, plus constant beta
+                         multiplied by vector y_i, for each instance i in the batch
+
+        y_i := alpha * x_i + beta * y_i
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    trans     [hipblasOperation_t]
-              indicates whether matrix A is tranposed (conjugated) or not
+    n         [int]
+              the number of elements in each vector.
     @param[in]
-    m         [int]
-              number of rows of matrix A
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
-    n         [int]
-              number of columns of matrix A
+    x         device pointer to the first vector x_1.
     @param[in]
-    kl        [int]
-              number of sub-diagonals of A
+    incx      [int]
+              specifies the increment for the elements of x.
     @param[in]
-    ku        [int]
-              number of super-diagonals of A
+    stridex   [hipblasStride]
+              stride from the start of one vector (x_i) to the next one (x_i+1).
     @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
+    beta      device pointer or host pointer to specify the scalar beta.
+    @param[inout]
+    y         device pointer to the first vector y_1.
     @param[in]
-        A     device pointer to first banded matrix (A_1).
-              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
-              of the banded matrix. The leading diagonal resides in row (ku + 1) with
-              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
-              resides below on the LHS of row ku + 2. This propogates up and down across
-              sub/super-diagonals.
-                Ex: (m = n = 7; ku = 2, kl = 2)
-                1 2 3 0 0 0 0             0 0 3 3 3 3 3
-                4 1 2 3 0 0 0             0 2 2 2 2 2 2
-                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
-                0 5 4 1 2 3 0             4 4 4 4 4 4 0
-                0 0 5 4 1 2 0             5 5 5 5 5 0 0
-                0 0 0 5 4 1 2             0 0 0 0 0 0 0
-                0 0 0 0 5 4 1             0 0 0 0 0 0 0
-              Note that the empty elements which don't correspond to data will not
-              be referenced.
+    incy      [int]
+              specifies the increment for the elements of y, incy != 0.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A. Must be >= (kl + ku + 1)
+    stridey   [hipblasStride]
+              stride from the start of one vector (y_i) to the next one (y_i+1).
     @param[in]
-    strideA  [hipblasStride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    batchCount [int]
+              number of instances in the batch.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpbyStridedBatched(hipblasHandle_t             handle,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* alpha,
+                                                           const hipblasDoubleComplex* x,
+                                                           int                         incx,
+                                                           hipblasStride               stridex,
+                                                           const hipblasDoubleComplex* beta,
+                                                           hipblasDoubleComplex*       y,
+                                                           int                         incy,
+                                                           hipblasStride               stridey,
+                                                           int                         batchCount);
+
+// axpyDot
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyDot(hipblasHandle_t handle,
+                                               int             n,
+                                               const float*    alpha,
+                                               const float*    x,
+                                               int             incx,
+                                               float*          y,
+                                               int             incy,
+                                               const float*    z,
+                                               int             incz,
+                                               float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyDot(hipblasHandle_t handle,
+                                               int             n,
+                                               const double*   alpha,
+                                               const double*   x,
+                                               int             incx,
+                                               double*         y,
+                                               int             incy,
+                                               const double*   z,
+                                               int             incz,
+                                               double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDot(hipblasHandle_t       handle,
+                                               int                   n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int                   incx,
+                                               hipblasComplex*       y,
+                                               int                   incy,
+                                               const hipblasComplex* z,
+                                               int                   incz,
+                                               hipblasComplex*       result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    axpyDot  updates vector y with axpy and returns its dot product with vector z
+
+        y := alpha * x + y
+        result := y**H * z    (y**T * z for real types)
+
+    z may be y, for the squared norm of the updated y. This is two passes over y, axpy and
+    then dot issued back to back on the stream of the handle, so it saves a call and not the
+    memory traffic of a second read of y.
+
     @param[in]
-    x         device pointer to first vector (x_1).
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of x.
+    n         [int]
+              the number of elements in each vector.
     @param[in]
-    stridex  [hipblasStride]
-              stride from the start of one vector (x_i) and the next one (x_i+1)
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
     @param[inout]
-    y         device pointer to first vector (y_1).
+    y         device pointer storing vector y.
     @param[in]
     incy      [int]
               specifies the increment for the elements of y.
     @param[in]
-    stridey  [hipblasStride]
-              stride from the start of one vector (y_i) and the next one (x_i+1)
+    z         device pointer storing vector z.
     @param[in]
-    batchCount [int]
-                specifies the number of instances in the batch.
+    incz      [int]
+              specifies the increment for the elements of z.
+    @param[inout]
+    result
+              device pointer or host pointer to store the dot product.
+              return is 0.0 if n <= 0.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasOperation_t          trans,
-                                                          int                         m,
-                                                          int                         n,
-                                                          int                         kl,
-                                                          int                         ku,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* beta,
-                                                          hipblasDoubleComplex*       y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          int                         batchCount);
 
-// gemv
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            int                m,
-                                            int                n,
-                                            const float*       alpha,
-                                            const float*       A,
-                                            int                lda,
-                                            const float*       x,
-                                            int                incx,
-                                            const float*       beta,
-                                            float*             y,
-                                            int                incy);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
-                                            hipblasOperation_t trans,
-                                            int                m,
-                                            int                n,
-                                            const double*      alpha,
-                                            const double*      A,
-                                            int                lda,
-                                            const double*      x,
-                                            int                incx,
-                                            const double*      beta,
-                                            double*            y,
-                                            int                incy);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
-                                            hipblasOperation_t    trans,
-                                            int                   m,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       y,
-                                            int                   incy);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyDot(hipblasHandle_t             handle,
+                                               int                         n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int                         incx,
+                                               hipblasDoubleComplex*       y,
+                                               int                         incy,
+                                               const hipblasDoubleComplex* z,
+                                               int                         incz,
+                                               hipblasDoubleComplex*       result);
+
+// axpyDotBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyDotBatched(hipblasHandle_t    handle,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int                incx,
+                                                      float* const       y[],
+                                                      int                incy,
+                                                      const float* const z[],
+                                                      int                incz,
+                                                      int                batchCount,
+                                                      float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyDotBatched(hipblasHandle_t     handle,
+                                                      int                 n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int                 incx,
+                                                      double* const       y[],
+                                                      int                 incy,
+                                                      const double* const z[],
+                                                      int                 incz,
+                                                      int                 batchCount,
+                                                      double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotBatched(hipblasHandle_t             handle,
+                                                      int                         n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int                         incx,
+                                                      hipblasComplex* const       y[],
+                                                      int                         incy,
+                                                      const hipblasComplex* const z[],
+                                                      int                         incz,
+                                                      int                         batchCount,
+                                                      hipblasComplex*             result);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    gemv performs one of the matrix-vector operations
+    axpyDotBatched  updates vector y_i with axpy and returns its dot product with vector z_i,
+                    for each instance i in the batch
 
-        y := alpha*A*x    + beta*y,   or
-        y := alpha*A**T*x + beta*y,   or
-        y := alpha*A**H*x + beta*y,
+        y_i := alpha * x_i + y_i
+        result[i] := y_i**H * z_i    (y_i**T * z_i for real types)
 
-    where alpha and beta are scalars, x and y are vectors and A is an
-    m by n matrix.
+    As for axpyDot, these are two passes: axpyBatched and then dotBatched.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    trans     [hipblasOperation_t]
-              indicates whether matrix A is tranposed (conjugated) or not
-    @param[in]
-    m         [int]
-              number of rows of matrix A
-    @param[in]
     n         [int]
-              number of columns of matrix A
-    @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
-    @param[in]
-    A         device pointer storing matrix A.
+              the number of elements in each vector.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A.
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
-    x         device pointer storing vector x.
+    x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
               specifies the increment for the elements of x.
-    @param[in]
-    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device pointer storing vector y.
+    y         device array of device pointers storing each vector y_i.
     @param[in]
     incy      [int]
               specifies the increment for the elements of y.
+    @param[in]
+    z         device array of device pointers storing each vector z_i.
+    @param[in]
+    incz      [int]
+              specifies the increment for the elements of z.
+    @param[in]
+    batchCount [int]
+              number of instances in the batch.
+    @param[inout]
+    result
+              device array or host array of batchCount dot products.
+              return is 0.0 for each element if n <= 0.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
-                                            hipblasOperation_t          trans,
-                                            int                         m,
-                                            int                         n,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* A,
-                                            int                         lda,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            const hipblasDoubleComplex* beta,
-                                            hipblasDoubleComplex*       y,
-                                            int                         incy);
-
-// gemvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
-                                                   hipblasOperation_t trans,
-                                                   int                m,
-                                                   int                n,
-                                                   const float*       alpha,
-                                                   const float* const A[],
-                                                   int                lda,
-                                                   const float* const x[],
-                                                   int                incx,
-                                                   const float*       beta,
-                                                   float* const       y[],
-                                                   int                incy,
-                                                   int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
-                                                   hipblasOperation_t  trans,
-                                                   int                 m,
-                                                   int                 n,
-                                                   const double*       alpha,
-                                                   const double* const A[],
-                                                   int                 lda,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   const double*       beta,
-                                                   double* const       y[],
-                                                   int                 incy,
-                                                   int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          trans,
-                                                   int                         m,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex* const       y[],
-                                                   int                         incy,
-                                                   int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyDotBatched(hipblasHandle_t                   handle,
+                                                      int                               n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int                               incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int                               incy,
+                                                      const hipblasDoubleComplex* const z[],
+                                                      int                               incz,
+                                                      int                               batchCount,
+                                                      hipblasDoubleComplex*             result);
+
+// axpyDotStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyDotStridedBatched(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const float*    alpha,
+                                                             const float*    x,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int             incy,
+                                                             hipblasStride   stridey,
+                                                             const float*    z,
+                                                             int             incz,
+                                                             hipblasStride   stridez,
+                                                             int             batchCount,
+                                                             float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyDotStridedBatched(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const double*   alpha,
+                                                             const double*   x,
+                                                             int             incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int             incy,
+                                                             hipblasStride   stridey,
+                                                             const double*   z,
+                                                             int             incz,
+                                                             hipblasStride   stridez,
+                                                             int             batchCount,
+                                                             double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotStridedBatched(hipblasHandle_t       handle,
+                                                             int                   n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int                   incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int                   incy,
+                                                             hipblasStride         stridey,
+                                                             const hipblasComplex* z,
+                                                             int                   incz,
+                                                             hipblasStride         stridez,
+                                                             int                   batchCount,
+                                                             hipblasComplex*       result);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    gemvBatched performs a batch of matrix-vector operations
+    axpyDotStridedBatched  updates vector y_i with axpy and returns its dot product with
+                           vector z_i, for each instance i in the batch
 
-        y_i := alpha*A_i*x_i    + beta*y_i,   or
-        y_i := alpha*A_i**T*x_i + beta*y_i,   or
-        y_i := alpha*A_i**H*x_i + beta*y_i,
+        y_i := alpha * x_i + y_i
+        result[i] := y_i**H * z_i    (y_i**T * z_i for real types)
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n matrix, for i = 1, ..., batchCount.
+    As for axpyDot, these are two passes: axpyStridedBatched and then dotStridedBatched.
 
     @param[in]
-    handle      [hipblasHandle_t]
-                handle to the hipblas library context queue.
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
-    trans       [hipblasOperation_t]
-                indicates whether matrices A_i are tranposed (conjugated) or not
+    n         [int]
+              the number of elements in each vector.
     @param[in]
-    m           [int]
-                number of rows of each matrix A_i
+    alpha     device pointer or host pointer to specify the scalar alpha.
     @param[in]
-    n           [int]
-                number of columns of each matrix A_i
+    x         device pointer to the first vector x_1.
     @param[in]
-    alpha       device pointer or host pointer to scalar alpha.
+    incx      [int]
+              specifies the increment for the elements of x.
     @param[in]
-    A           device array of device pointers storing each matrix A_i.
+    stridex   [hipblasStride]
+              stride from the start of one vector (x_i) to the next one (x_i+1).
+    @param[inout]
+    y         device pointer to the first vector y_1.
     @param[in]
-    lda         [int]
-                specifies the leading dimension of each matrix A_i.
+    incy      [int]
+              specifies the increment for the elements of y.
     @param[in]
-    x           device array of device pointers storing each vector x_i.
+    stridey   [hipblasStride]
+              stride from the start of one vector (y_i) to the next one (y_i+1).
     @param[in]
-    incx        [int]
-                specifies the increment for the elements of each vector x_i.
+    z         device pointer to the first vector z_1.
     @param[in]
-    beta        device pointer or host pointer to scalar beta.
-    @param[inout]
-    y           device array of device pointers storing each vector y_i.
+    incz      [int]
+              specifies the increment for the elements of z.
     @param[in]
-    incy        [int]
-                specifies the increment for the elements of each vector y_i.
+    stridez   [hipblasStride]
+              stride from the start of one vector (z_i) to the next one (z_i+1).
     @param[in]
     batchCount [int]
-                number of instances in the batch
+              number of instances in the batch.
+    @param[inout]
+    result
+              device array or host array of batchCount dot products.
+              return is 0.0 for each element if n <= 0.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
-                                                   hipblasOperation_t                trans,
-                                                   int                               m,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const A[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex*       beta,
-                                                   hipblasDoubleComplex* const       y[],
-                                                   int                               incy,
-                                                   int                               batchCount);
-
-// gemvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t trans,
-                                                          int                m,
-                                                          int                n,
-                                                          const float*       alpha,
-                                                          const float*       A,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          const float*       x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          const float*       beta,
-                                                          float*             y,
-                                                          int                incy,
-                                                          hipblasStride      stridey,
-                                                          int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t trans,
-                                                          int                m,
-                                                          int                n,
-                                                          const double*      alpha,
-                                                          const double*      A,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          const double*      x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          const double*      beta,
-                                                          double*            y,
-                                                          int                incy,
-                                                          hipblasStride      stridey,
-                                                          int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    trans,
-                                                          int                   m,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyDotStridedBatched(hipblasHandle_t             handle,
+                                  int                         n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int                         incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       y,
+                                  int                         incy,
+                                  hipblasStride               stridey,
+                                  const hipblasDoubleComplex* z,
+                                  int                         incz,
+                                  hipblasStride               stridez,
+                                  int                         batchCount,
+                                  hipblasDoubleComplex*       result);
+
+// dotMulti
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdotMulti(hipblasHandle_t    handle,
+                                                int                n,
+                                                int                k,
+                                                const hipblasHalf* x,
+                                                int                incx,
+                                                const hipblasHalf* Y,
+                                                int                ldy,
+                                                hipblasHalf*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotMulti(hipblasHandle_t handle,
+                                                int             n,
+                                                int             k,
+                                                const float*    x,
+                                                int             incx,
+                                                const float*    Y,
+                                                int             ldy,
+                                                float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotMulti(hipblasHandle_t handle,
+                                                int             n,
+                                                int             k,
+                                                const double*   x,
+                                                int             incx,
+                                                const double*   Y,
+                                                int             ldy,
+                                                double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotMulti(hipblasHandle_t       handle,
+                                                int                   n,
+                                                int                   k,
+                                                const hipblasComplex* x,
+                                                int                   incx,
+                                                const hipblasComplex* Y,
+                                                int                   ldy,
+                                                hipblasComplex*       result);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    gemvStridedBatched performs a batch of matrix-vector operations
+    dotMulti  computes the dot products of vector x with k vectors y_j in one pass
 
-        y_i := alpha*A_i*x_i    + beta*y_i,   or
-        y_i := alpha*A_i**T*x_i + beta*y_i,   or
-        y_i := alpha*A_i**H*x_i + beta*y_i,
+        result[j] := y_j**H * x    (y_j**T * x for real types), j = 0, ..., k - 1
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    m by n matrix, for i = 1, ..., batchCount.
+    In device pointer mode this reads x and Y once, except in half precision with incx < 0;
+    otherwise the k dot products are computed one after the other.
 
     @param[in]
-    handle      [hipblasHandle_t]
-                handle to the hipblas library context queue.
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
-    transA      [hipblasOperation_t]
-                indicates whether matrices A_i are tranposed (conjugated) or not
+    n         [int]
+              the number of elements in x and in each y_j.
     @param[in]
-    m           [int]
-                number of rows of matrices A_i
+    k         [int]
+              the number of vectors y_j.
     @param[in]
-    n           [int]
-                number of columns of matrices A_i
+    x         device pointer storing vector x.
     @param[in]
-    alpha       device pointer or host pointer to scalar alpha.
+    incx      [int]
+              specifies the increment for the elements of x.
     @param[in]
-    A           device pointer to the first matrix (A_1) in the batch.
+    Y         device pointer storing the n x k matrix Y of the vectors y_j, column by column.
     @param[in]
-    lda         [int]
-                specifies the leading dimension of matrices A_i.
+    ldy       [int]
+              specifies the leading dimension of Y, ldy >= max(1, n).
+    @param[inout]
+    result
+              device pointer or host pointer to store the k dot products.
+              return is 0.0 for each element if n <= 0.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotMulti(hipblasHandle_t             handle,
+                                                int                         n,
+                                                int                         k,
+                                                const hipblasDoubleComplex* x,
+                                                int                         incx,
+                                                const hipblasDoubleComplex* Y,
+                                                int                         ldy,
+                                                hipblasDoubleComplex*       result);
+
+// dotMultiBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdotMultiBatched(hipblasHandle_t          handle,
+                                                       int                      n,
+                                                       int                      k,
+                                                       const hipblasHalf* const x[],
+                                                       int                      incx,
+                                                       const hipblasHalf* const Y[],
+                                                       int                      ldy,
+                                                       int                      batchCount,
+                                                       hipblasHalf*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotMultiBatched(hipblasHandle_t    handle,
+                                                       int                n,
+                                                       int                k,
+                                                       const float* const x[],
+                                                       int                incx,
+                                                       const float* const Y[],
+                                                       int                ldy,
+                                                       int                batchCount,
+                                                       float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotMultiBatched(hipblasHandle_t     handle,
+                                                       int                 n,
+                                                       int                 k,
+                                                       const double* const x[],
+                                                       int                 incx,
+                                                       const double* const Y[],
+                                                       int                 ldy,
+                                                       int                 batchCount,
+                                                       double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotMultiBatched(hipblasHandle_t             handle,
+                                                       int                         n,
+                                                       int                         k,
+                                                       const hipblasComplex* const x[],
+                                                       int                         incx,
+                                                       const hipblasComplex* const Y[],
+                                                       int                         ldy,
+                                                       int                         batchCount,
+                                                       hipblasComplex*             result);
+
+/*! \brief BLAS Level 1 API
+
+    \details
+    dotMultiBatched  computes the dot products of vector x_i with k vectors y_ij in one pass,
+                     for each instance i in the batch
+
+        result[i * k + j] := y_ij**H * x_i    (y_ij**T * x_i for real types)
+
+    The arrays of pointers are read back to the host. When the instances are evenly spaced in
+    memory this is dotMultiStridedBatched; otherwise the instances run one at a time as
+    dotMulti.
+
     @param[in]
-    strideA     [hipblasStride]
-                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
-    x           device pointer to the first vector (x_1) in the batch.
+    n         [int]
+              the number of elements in each x_i and y_ij.
     @param[in]
-    incx        [int]
-                specifies the increment for the elements of vectors x_i.
+    k         [int]
+              the number of vectors y_ij of each instance.
     @param[in]
-    stridex     [hipblasStride]
-                stride from the start of one vector (x_i) and the next one (x_i+1).
-                There are no restrictions placed on stridex, however the user should
-                take care to ensure that stridex is of appropriate size. When trans equals HIPBLAS_OP_N
-                this typically means stridex >= n * incx, otherwise stridex >= m * incx.
+    x         device array of device pointers storing each vector x_i.
     @param[in]
-    beta        device pointer or host pointer to scalar beta.
-    @param[inout]
-    y           device pointer to the first vector (y_1) in the batch.
+    incx      [int]
+              specifies the increment for the elements of x.
     @param[in]
-    incy        [int]
-                specifies the increment for the elements of vectors y_i.
+    Y         device array of device pointers storing each n x k matrix Y_i of the vectors
+              y_ij, column by column.
     @param[in]
-    stridey     [hipblasStride]
-                stride from the start of one vector (y_i) and the next one (y_i+1).
-                There are no restrictions placed on stridey, however the user should
-                take care to ensure that stridey is of appropriate size. When trans equals HIPBLAS_OP_N
-                this typically means stridey >= m * incy, otherwise stridey >= n * incy. stridey should be non zero.
+    ldy       [int]
+              specifies the leading dimension of Y, ldy >= max(1, n).
     @param[in]
     batchCount [int]
-                number of instances in the batch
+              number of instances in the batch.
+    @param[inout]
+    result
+              device array or host array of batchCount * k dot products.
+              return is 0.0 for each element if n <= 0.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasOperation_t          trans,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* beta,
-                                                          hipblasDoubleComplex*       y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          int                         batchCount);
-
-// ger
-HIPBLAS_EXPORT hipblasStatus_t hipblasSger(hipblasHandle_t handle,
-                                           int             m,
-                                           int             n,
-                                           const float*    alpha,
-                                           const float*    x,
-                                           int             incx,
-                                           const float*    y,
-                                           int             incy,
-                                           float*          A,
-                                           int             lda);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDger(hipblasHandle_t handle,
-                                           int             m,
-                                           int             n,
-                                           const double*   alpha,
-                                           const double*   x,
-                                           int             incx,
-                                           const double*   y,
-                                           int             incy,
-                                           double*         A,
-                                           int             lda);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
-                                            int                   m,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* y,
-                                            int                   incy,
-                                            hipblasComplex*       A,
-                                            int                   lda);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
-                                            int                   m,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* y,
-                                            int                   incy,
-                                            hipblasComplex*       A,
-                                            int                   lda);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
-                                            int                         m,
-                                            int                         n,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            const hipblasDoubleComplex* y,
-                                            int                         incy,
-                                            hipblasDoubleComplex*       A,
-                                            int                         lda);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotMultiBatched(hipblasHandle_t                   handle,
+                                                       int                               n,
+                                                       int                               k,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int                               incx,
+                                                       const hipblasDoubleComplex* const Y[],
+                                                       int                               ldy,
+                                                       int                               batchCount,
+                                                       hipblasDoubleComplex*             result);
+
+// dotMultiStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdotMultiStridedBatched(hipblasHandle_t    handle,
+                                                              int                n,
+                                                              int                k,
+                                                              const hipblasHalf* x,
+                                                              int                incx,
+                                                              hipblasStride      stridex,
+                                                              const hipblasHalf* Y,
+                                                              int                ldy,
+                                                              hipblasStride      strideY,
+                                                              int                batchCount,
+                                                              hipblasHalf*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotMultiStridedBatched(hipblasHandle_t handle,
+                                                              int             n,
+                                                              int             k,
+                                                              const float*    x,
+                                                              int             incx,
+                                                              hipblasStride   stridex,
+                                                              const float*    Y,
+                                                              int             ldy,
+                                                              hipblasStride   strideY,
+                                                              int             batchCount,
+                                                              float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotMultiStridedBatched(hipblasHandle_t handle,
+                                                              int             n,
+                                                              int             k,
+                                                              const double*   x,
+                                                              int             incx,
+                                                              hipblasStride   stridex,
+                                                              const double*   Y,
+                                                              int             ldy,
+                                                              hipblasStride   strideY,
+                                                              int             batchCount,
+                                                              double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotMultiStridedBatched(hipblasHandle_t       handle,
+                                                              int                   n,
+                                                              int                   k,
+                                                              const hipblasComplex* x,
+                                                              int                   incx,
+                                                              hipblasStride         stridex,
+                                                              const hipblasComplex* Y,
+                                                              int                   ldy,
+                                                              hipblasStride         strideY,
+                                                              int                   batchCount,
+                                                              hipblasComplex*       result);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    ger,geru,gerc performs the matrix-vector operations
-
-        A := A + alpha*x*y**T , OR
-        A := A + alpha*x*y**H for gerc
+    dotMultiStridedBatched  computes the dot products of vector x_i with k vectors y_ij in
+                            one pass, for each instance i in the batch
 
-    where alpha is a scalar, x and y are vectors, and A is an
-    m by n matrix.
+        result[i * k + j] := y_ij**H * x_i    (y_ij**T * x_i for real types)
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    m         [int]
-              the number of rows of the matrix A.
-    @param[in]
     n         [int]
-              the number of columns of the matrix A.
+              the number of elements in each x_i and y_ij.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    k         [int]
+              the number of vectors y_ij of each instance.
     @param[in]
-    x         device pointer storing vector x.
+    x         device pointer to the first vector x_1.
     @param[in]
     incx      [int]
               specifies the increment for the elements of x.
     @param[in]
-    y         device pointer storing vector y.
+    stridex   [hipblasStride]
+              stride from the start of one vector (x_i) to the next one (x_i+1).
     @param[in]
-    incy      [int]
-              specifies the increment for the elements of y.
-    @param[inout]
-    A         device pointer storing matrix A.
+    Y         device pointer to the first n x k matrix Y_1 of the vectors y_1j.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A.
+    ldy       [int]
+              specifies the leading dimension of Y, ldy >= max(1, n).
+    @param[in]
+    strideY   [hipblasStride]
+              stride from the start of one matrix (Y_i) to the next one (Y_i+1).
+    @param[in]
+    batchCount [int]
+              number of instances in the batch.
+    @param[inout]
+    result
+              device array or host array of batchCount * k dot products.
+              return is 0.0 for each element if n <= 0.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
-                                            int                         m,
-                                            int                         n,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            const hipblasDoubleComplex* y,
-                                            int                         incy,
-                                            hipblasDoubleComplex*       A,
-                                            int                         lda);
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZdotMultiStridedBatched(hipblasHandle_t             handle,
+                                   int                         n,
+                                   int                         k,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   hipblasStride               stridex,
+                                   const hipblasDoubleComplex* Y,
+                                   int                         ldy,
+                                   hipblasStride               strideY,
+                                   int                         batchCount,
+                                   hipblasDoubleComplex*       result);
+
+// normalize
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSnormalize(hipblasHandle_t handle, int n, float* x, int incx, float* result);
 
-// gerBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
-                                                  int                m,
-                                                  int                n,
-                                                  const float*       alpha,
-                                                  const float* const x[],
-                                                  int                incx,
-                                                  const float* const y[],
-                                                  int                incy,
-                                                  float* const       A[],
-                                                  int                lda,
-                                                  int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDnormalize(hipblasHandle_t handle, int n, double* x, int incx, double* result);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
-                                                  int                 m,
-                                                  int                 n,
-                                                  const double*       alpha,
-                                                  const double* const x[],
-                                                  int                 incx,
-                                                  const double* const y[],
-                                                  int                 incy,
-                                                  double* const       A[],
-                                                  int                 lda,
-                                                  int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCnormalize(hipblasHandle_t handle, int n, hipblasComplex* x, int incx, float* result);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
-                                                   int                         m,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex* const y[],
-                                                   int                         incy,
-                                                   hipblasComplex* const       A[],
-                                                   int                         lda,
-                                                   int                         batchCount);
+/*! \brief BLAS Level 1 API
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
-                                                   int                         m,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex* const y[],
-                                                   int                         incy,
-                                                   hipblasComplex* const       A[],
-                                                   int                         lda,
-                                                   int                         batchCount);
+    \details
+    normalize  computes the euclidean norm of vector x and scales x to unit norm
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
-                                                   int                               m,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex* const y[],
-                                                   int                               incy,
-                                                   hipblasDoubleComplex* const       A[],
-                                                   int                               lda,
-                                                   int                               batchCount);
+        result := sqrt( x**H * x )
+        x := x / result
 
-/*! \brief BLAS Level 2 API
+    A zero x has a zero norm and is left unchanged, in both pointer modes. In device pointer
+    mode the norm stays in device memory and x is divided by it there, through a scratch of
+    4 reals kept by the handle; in host pointer mode x is scaled by the reciprocal of the norm.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in each vector.
+    @param[inout]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    result
+              device pointer or host pointer to store the norm.
+              return is 0.0 and x is unchanged if n <= 0, incx <= 0.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZnormalize(hipblasHandle_t       handle,
+                                                 int                   n,
+                                                 hipblasDoubleComplex* x,
+                                                 int                   incx,
+                                                 double*               result);
+
+// normalizeBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnormalizeBatched(hipblasHandle_t handle,
+                                                        int             n,
+                                                        float* const    x[],
+                                                        int             incx,
+                                                        int             batchCount,
+                                                        float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnormalizeBatched(hipblasHandle_t handle,
+                                                        int             n,
+                                                        double* const   x[],
+                                                        int             incx,
+                                                        int             batchCount,
+                                                        double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCnormalizeBatched(hipblasHandle_t       handle,
+                                                        int                   n,
+                                                        hipblasComplex* const x[],
+                                                        int                   incx,
+                                                        int                   batchCount,
+                                                        float*                result);
+
+/*! \brief BLAS Level 1 API
 
     \details
-    gerBatched,geruBatched,gercBatched performs a batch of the matrix-vector operations
+    normalizeBatched  computes the euclidean norm of vector x_i and scales x_i to unit norm,
+                      for each instance i in the batch
 
-        A := A + alpha*x*y**T , OR
-        A := A + alpha*x*y**H for gerc
+        result[i] := sqrt( x_i**H * x_i )
+        x_i := x_i / result[i]
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha is a scalar, x_i and y_i are vectors and A_i is an
-    m by n matrix, for i = 1, ..., batchCount.
+    As for normalize, a zero x_i is left unchanged. The arrays of pointers are read back to the
+    host. When the instances are evenly spaced in memory this is normalizeStridedBatched;
+    otherwise the instances run one at a time as normalize.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    m         [int]
-              the number of rows of each matrix A_i.
-    @param[in]
     n         [int]
-              the number of columns of eaceh matrix A_i.
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
-    @param[in]
-    x         device array of device pointers storing each vector x_i.
+              the number of elements in each vector.
+    @param[inout]
+    x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each vector x_i.
-    @param[in]
-    y         device array of device pointers storing each vector y_i.
-    @param[in]
-    incy      [int]
-              specifies the increment for the elements of each vector y_i.
-    @param[inout]
-    A         device array of device pointers storing each matrix A_i.
-    @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
+              specifies the increment for the elements of x.
     @param[in]
     batchCount [int]
-                number of instances in the batch
+              number of instances in the batch.
+    @param[inout]
+    result
+              device array or host array of batchCount norms.
+              return is 0.0 for each element and x is unchanged if n <= 0, incx <= 0.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
-                                                   int                               m,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex* const y[],
-                                                   int                               incy,
-                                                   hipblasDoubleComplex* const       A[],
-                                                   int                               lda,
-                                                   int                               batchCount);
-
-// gerStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
-                                                         int             m,
-                                                         int             n,
-                                                         const float*    alpha,
-                                                         const float*    x,
-                                                         int             incx,
-                                                         hipblasStride   stridex,
-                                                         const float*    y,
-                                                         int             incy,
-                                                         hipblasStride   stridey,
-                                                         float*          A,
-                                                         int             lda,
-                                                         hipblasStride   strideA,
-                                                         int             batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
-                                                         int             m,
-                                                         int             n,
-                                                         const double*   alpha,
-                                                         const double*   x,
-                                                         int             incx,
-                                                         hipblasStride   stridex,
-                                                         const double*   y,
-                                                         int             incy,
-                                                         hipblasStride   stridey,
-                                                         double*         A,
-                                                         int             lda,
-                                                         hipblasStride   strideA,
-                                                         int             batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
-                                                          int                   m,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          hipblasComplex*       A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          int                   batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
-                                                          int                   m,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          hipblasComplex*       A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          int                   batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          hipblasDoubleComplex*       A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZnormalizeBatched(hipblasHandle_t             handle,
+                                                        int                         n,
+                                                        hipblasDoubleComplex* const x[],
+                                                        int                         incx,
+                                                        int                         batchCount,
+                                                        double*                     result);
+
+// normalizeStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnormalizeStridedBatched(hipblasHandle_t handle,
+                                                               int             n,
+                                                               float*          x,
+                                                               int             incx,
+                                                               hipblasStride   stridex,
+                                                               int             batchCount,
+                                                               float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnormalizeStridedBatched(hipblasHandle_t handle,
+                                                               int             n,
+                                                               double*         x,
+                                                               int             incx,
+                                                               hipblasStride   stridex,
+                                                               int             batchCount,
+                                                               double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCnormalizeStridedBatched(hipblasHandle_t handle,
+                                                               int             n,
+                                                               hipblasComplex* x,
+                                                               int             incx,
+                                                               hipblasStride   stridex,
+                                                               int             batchCount,
+                                                               float*          result);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 1 API
 
     \details
-    gerStridedBatched,geruStridedBatched,gercStridedBatched performs the matrix-vector operations
+    normalizeStridedBatched  computes the euclidean norm of vector x_i and scales x_i to unit
+                             norm, for each instance i in the batch
 
-        A_i := A_i + alpha*x_i*y_i**T, OR
-        A_i := A_i + alpha*x_i*y_i**H  for gerc
+        result[i] := sqrt( x_i**H * x_i )
+        x_i := x_i / result[i]
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha is a scalar, x_i and y_i are vectors and A_i is an
-    m by n matrix, for i = 1, ..., batchCount.
+    As for normalize, a zero x_i is left unchanged; in device pointer mode the scratch of the
+    handle holds 4 reals per instance.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    m         [int]
-              the number of rows of each matrix A_i.
-    @param[in]
     n         [int]
-              the number of columns of each matrix A_i.
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
-    @param[in]
-    x         device pointer to the first vector (x_1) in the batch.
+              the number of elements in each vector.
+    @param[inout]
+    x         device pointer to the first vector x_1.
     @param[in]
     incx      [int]
-              specifies the increments for the elements of each vector x_i.
+              specifies the increment for the elements of x.
     @param[in]
     stridex   [hipblasStride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
-              There are no restrictions placed on stridex, however the user should
-              take care to ensure that stridex is of appropriate size, for a typical
-              case this means stridex >= m * incx.
-    @param[inout]
-    y         device pointer to the first vector (y_1) in the batch.
-    @param[in]
-    incy      [int]
-              specifies the increment for the elements of each vector y_i.
-    @param[in]
-    stridey   [hipblasStride]
-              stride from the start of one vector (y_i) and the next one (y_i+1).
-              There are no restrictions placed on stridey, however the user should
-              take care to ensure that stridey is of appropriate size, for a typical
-              case this means stridey >= n * incy.
-    @param[inout]
-    A         device pointer to the first matrix (A_1) in the batch.
-    @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
-    @param[in]
-    strideA     [hipblasStride]
-                stride from the start of one matrix (A_i) and the next one (A_i+1)
+              stride from the start of one vector (x_i) to the next one (x_i+1).
     @param[in]
     batchCount [int]
-                number of instances in the batch
+              number of instances in the batch.
+    @param[inout]
+    result
+              device array or host array of batchCount norms.
+              return is 0.0 for each element and x is unchanged if n <= 0, incx <= 0.
 
     ********************************************************************/
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          hipblasDoubleComplex*       A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZnormalizeStridedBatched(hipblasHandle_t       handle,
+                                                               int                   n,
+                                                               hipblasDoubleComplex* x,
+                                                               int                   incx,
+                                                               hipblasStride         stridex,
+                                                               int                   batchCount,
+                                                               double*               result);
+// ================================
+// ========== LEVEL 2 =============
+// ================================
 
-// hbmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
+// gbmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmv(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            int                kl,
+                                            int                ku,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            const float*       x,
+                                            int                incx,
+                                            const float*       beta,
+                                            float*             y,
+                                            int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmv(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            int                kl,
+                                            int                ku,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            const double*      x,
+                                            int                incx,
+                                            const double*      beta,
+                                            double*            y,
+                                            int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmv(hipblasHandle_t       handle,
+                                            hipblasOperation_t    trans,
+                                            int                   m,
                                             int                   n,
-                                            int                   k,
+                                            int                   kl,
+                                            int                   ku,
                                             const hipblasComplex* alpha,
                                             const hipblasComplex* A,
                                             int                   lda,
@@ -4063,61 +4173,55 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    hbmv performs the matrix-vector operations
+    gbmv performs one of the matrix-vector operations
 
-        y := alpha*A*x + beta*y
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
 
-    where alpha and beta are scalars, x and y are n element vectors and A is an
-    n by n Hermitian band matrix, with k super-diagonals.
+    where alpha and beta are scalars, x and y are vectors and A is an
+    m by n banded matrix with kl sub-diagonals and ku super-diagonals.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is being supplied.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is being supplied.
+    trans     [hipblasOperation_t]
+              indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m         [int]
+              number of rows of matrix A
     @param[in]
     n         [int]
-              the order of the matrix A.
+              number of columns of matrix A
     @param[in]
-    k         [int]
-              the number of super-diagonals of the matrix A. Must be >= 0.
+    kl        [int]
+              number of sub-diagonals of A
+    @param[in]
+    ku        [int]
+              number of super-diagonals of A
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device pointer storing matrix A. Of dimension (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The leading (k + 1) by n part of A must contain the upper
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (k + 1), the first super-diagonal on the RHS
-                of row k, etc.
-                The top left k by x triangle of A will not be referenced.
-                    Ex (upper, lda = n = 4, k = 1):
-                    A                             Represented matrix
-                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
-                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
-
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The leading (k + 1) by n part of A must contain the lower
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (1), the first sub-diagonal on the LHS of
-                row 2, etc.
-                The bottom right k by k triangle of A will not be referenced.
-                    Ex (lower, lda = 2, n = 4, k = 1):
-                    A                               Represented matrix
-                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
-                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
-                                                    (0, 0) (6, 8) (3, 0) (7,-7)
-                                                    (0, 0) (0, 0) (7, 7) (4, 0)
-
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of A will not be referenced and is assumed to be == 0.
+        A     device pointer storing banded matrix A.
+              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
+              of the banded matrix. The leading diagonal resides in row (ku + 1) with
+              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
+              resides below on the LHS of row ku + 2. This propogates up and down across
+              sub/super-diagonals.
+                Ex: (m = n = 7; ku = 2, kl = 2)
+                1 2 3 0 0 0 0             0 0 3 3 3 3 3
+                4 1 2 3 0 0 0             0 2 2 2 2 2 2
+                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
+                0 5 4 1 2 3 0             4 4 4 4 4 4 0
+                0 0 5 4 1 2 0             5 5 5 5 5 0 0
+                0 0 0 5 4 1 2             0 0 0 0 0 0 0
+                0 0 0 0 5 4 1             0 0 0 0 0 0 0
+              Note that the empty elements which don't correspond to data will not
+              be referenced.
     @param[in]
     lda       [int]
-              specifies the leading dimension of A. must be >= k + 1
+              specifies the leading dimension of A. Must be >= (kl + ku + 1)
     @param[in]
     x         device pointer storing vector x.
     @param[in]
@@ -4132,10 +4236,12 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
               specifies the increment for the elements of y.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmv(hipblasHandle_t             handle,
+                                            hipblasOperation_t          trans,
+                                            int                         m,
                                             int                         n,
-                                            int                         k,
+                                            int                         kl,
+                                            int                         ku,
                                             const hipblasDoubleComplex* alpha,
                                             const hipblasDoubleComplex* A,
                                             int                         lda,
@@ -4145,11 +4251,45 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
-// hbmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
+// gbmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t trans,
+                                                   int                m,
+                                                   int                n,
+                                                   int                kl,
+                                                   int                ku,
+                                                   const float*       alpha,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float*       beta,
+                                                   float* const       y[],
+                                                   int                incy,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  trans,
+                                                   int                 m,
+                                                   int                 n,
+                                                   int                 kl,
+                                                   int                 ku,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double*       beta,
+                                                   double* const       y[],
+                                                   int                 incy,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          trans,
+                                                   int                         m,
                                                    int                         n,
-                                                   int                         k,
+                                                   int                         kl,
+                                                   int                         ku,
                                                    const hipblasComplex*       alpha,
                                                    const hipblasComplex* const A[],
                                                    int                         lda,
@@ -4163,61 +4303,57 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             h
 /*! \brief BLAS Level 2 API
 
     \details
-    hbmvBatched performs one of the matrix-vector operations
+    gbmvBatched performs one of the matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i
+        y_i := alpha*A_i*x_i    + beta*y_i,   or
+        y_i := alpha*A_i**T*x_i + beta*y_i,   or
+        y_i := alpha*A_i**H*x_i + beta*y_i,
 
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batchCount].
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
+    for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is being supplied.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is being supplied.
+    trans     [hipblasOperation_t]
+              indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m         [int]
+              number of rows of each matrix A_i
     @param[in]
     n         [int]
-              the order of each matrix A_i.
+              number of columns of each matrix A_i
     @param[in]
-    k         [int]
-              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    kl        [int]
+              number of sub-diagonals of each A_i
+    @param[in]
+    ku        [int]
+              number of super-diagonals of each A_i
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device array of device pointers storing each matrix_i A of dimension (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The leading (k + 1) by n part of each A_i must contain the upper
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (k + 1), the first super-diagonal on the RHS
-                of row k, etc.
-                The top left k by x triangle of each A_i will not be referenced.
-                    Ex (upper, lda = n = 4, k = 1):
-                    A                             Represented matrix
-                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
-                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
-
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The leading (k + 1) by n part of each A_i must contain the lower
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (1), the first sub-diagonal on the LHS of
-                row 2, etc.
-                The bottom right k by k triangle of each A_i will not be referenced.
-                    Ex (lower, lda = 2, n = 4, k = 1):
-                    A                               Represented matrix
-                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
-                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
-                                                    (0, 0) (6, 8) (3, 0) (7,-7)
-                                                    (0, 0) (0, 0) (7, 7) (4, 0)
-
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+        A     device array of device pointers storing each banded matrix A_i.
+              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
+              of the banded matrix. The leading diagonal resides in row (ku + 1) with
+              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
+              resides below on the LHS of row ku + 2. This propogates up and down across
+              sub/super-diagonals.
+                Ex: (m = n = 7; ku = 2, kl = 2)
+                1 2 3 0 0 0 0             0 0 3 3 3 3 3
+                4 1 2 3 0 0 0             0 2 2 2 2 2 2
+                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
+                0 5 4 1 2 3 0             4 4 4 4 4 4 0
+                0 0 5 4 1 2 0             5 5 5 5 5 0 0
+                0 0 0 5 4 1 2             0 0 0 0 0 0 0
+                0 0 0 0 5 4 1             0 0 0 0 0 0 0
+              Note that the empty elements which don't correspond to data will not
+              be referenced.
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+              specifies the leading dimension of each A_i. Must be >= (kl + ku + 1)
     @param[in]
     x         device array of device pointers storing each vector x_i.
     @param[in]
@@ -4229,16 +4365,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             h
     y         device array of device pointers storing each vector y_i.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of y.
+              specifies the increment for the elements of each y_i.
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                specifies the number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
+                                                   hipblasOperation_t                trans,
+                                                   int                               m,
                                                    int                               n,
-                                                   int                               k,
+                                                   int                               kl,
+                                                   int                               ku,
                                                    const hipblasDoubleComplex*       alpha,
                                                    const hipblasDoubleComplex* const A[],
                                                    int                               lda,
@@ -4249,11 +4387,51 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount);
 
-// hbmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
+// gbmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          int                kl,
+                                                          int                ku,
+                                                          const float*       alpha,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const float*       x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          const float*       beta,
+                                                          float*             y,
+                                                          int                incy,
+                                                          hipblasStride      stridey,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          int                kl,
+                                                          int                ku,
+                                                          const double*      alpha,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const double*      x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          const double*      beta,
+                                                          double*            y,
+                                                          int                incy,
+                                                          hipblasStride      stridey,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    trans,
+                                                          int                   m,
                                                           int                   n,
-                                                          int                   k,
+                                                          int                   kl,
+                                                          int                   ku,
                                                           const hipblasComplex* alpha,
                                                           const hipblasComplex* A,
                                                           int                   lda,
@@ -4270,91 +4448,89 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t
 /*! \brief BLAS Level 2 API
 
     \details
-    hbmvStridedBatched performs one of the matrix-vector operations
+    gbmvStridedBatched performs one of the matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i
+        y_i := alpha*A_i*x_i    + beta*y_i,   or
+        y_i := alpha*A_i**T*x_i + beta*y_i,   or
+        y_i := alpha*A_i**H*x_i + beta*y_i,
 
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batchCount].
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n banded matrix with kl sub-diagonals and ku super-diagonals,
+    for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is being supplied.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is being supplied.
+    trans     [hipblasOperation_t]
+              indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m         [int]
+              number of rows of matrix A
     @param[in]
     n         [int]
-              the order of each matrix A_i.
+              number of columns of matrix A
     @param[in]
-    k         [int]
-              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    kl        [int]
+              number of sub-diagonals of A
+    @param[in]
+    ku        [int]
+              number of super-diagonals of A
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device array pointing to the first matrix A_1. Each A_i is of dimension (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The leading (k + 1) by n part of each A_i must contain the upper
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (k + 1), the first super-diagonal on the RHS
-                of row k, etc.
-                The top left k by x triangle of each A_i will not be referenced.
-                    Ex (upper, lda = n = 4, k = 1):
-                    A                             Represented matrix
-                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
-                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
-                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
-
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The leading (k + 1) by n part of each A_i must contain the lower
-                triangular band part of the Hermitian matrix, with the leading
-                diagonal in row (1), the first sub-diagonal on the LHS of
-                row 2, etc.
-                The bottom right k by k triangle of each A_i will not be referenced.
-                    Ex (lower, lda = 2, n = 4, k = 1):
-                    A                               Represented matrix
-                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
-                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
-                                                    (0, 0) (6, 8) (3, 0) (7,-7)
-                                                    (0, 0) (0, 0) (7, 7) (4, 0)
-
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+        A     device pointer to first banded matrix (A_1).
+              Leading (kl + ku + 1) by n part of the matrix contains the coefficients
+              of the banded matrix. The leading diagonal resides in row (ku + 1) with
+              the first super-diagonal above on the RHS of row ku. The first sub-diagonal
+              resides below on the LHS of row ku + 2. This propogates up and down across
+              sub/super-diagonals.
+                Ex: (m = n = 7; ku = 2, kl = 2)
+                1 2 3 0 0 0 0             0 0 3 3 3 3 3
+                4 1 2 3 0 0 0             0 2 2 2 2 2 2
+                5 4 1 2 3 0 0    ---->    1 1 1 1 1 1 1
+                0 5 4 1 2 3 0             4 4 4 4 4 4 0
+                0 0 5 4 1 2 0             5 5 5 5 5 0 0
+                0 0 0 5 4 1 2             0 0 0 0 0 0 0
+                0 0 0 0 5 4 1             0 0 0 0 0 0 0
+              Note that the empty elements which don't correspond to data will not
+              be referenced.
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+              specifies the leading dimension of A. Must be >= (kl + ku + 1)
     @param[in]
     strideA  [hipblasStride]
               stride from the start of one matrix (A_i) and the next one (A_i+1)
     @param[in]
-    x         device array pointing to the first vector y_1.
+    x         device pointer to first vector (x_1).
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of x.
     @param[in]
     stridex  [hipblasStride]
               stride from the start of one vector (x_i) and the next one (x_i+1)
     @param[in]
     beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array pointing to the first vector y_1.
+    y         device pointer to first vector (y_1).
     @param[in]
     incy      [int]
               specifies the increment for the elements of y.
     @param[in]
     stridey  [hipblasStride]
-              stride from the start of one vector (y_i) and the next one (y_i+1)
+              stride from the start of one vector (y_i) and the next one (x_i+1)
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                specifies the number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          trans,
+                                                          int                         m,
                                                           int                         n,
-                                                          int                         k,
+                                                          int                         kl,
+                                                          int                         ku,
                                                           const hipblasDoubleComplex* alpha,
                                                           const hipblasDoubleComplex* A,
                                                           int                         lda,
@@ -4368,9 +4544,36 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
 
-// hemv
-HIPBLAS_EXPORT hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
+// gemv
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            const float*       x,
+                                            int                incx,
+                                            const float*       beta,
+                                            float*             y,
+                                            int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            const double*      x,
+                                            int                incx,
+                                            const double*      beta,
+                                            double*            y,
+                                            int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
+                                            hipblasOperation_t    trans,
+                                            int                   m,
                                             int                   n,
                                             const hipblasComplex* alpha,
                                             const hipblasComplex* A,
@@ -4384,40 +4587,34 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    hemv performs one of the matrix-vector operations
+    gemv performs one of the matrix-vector operations
 
-        y := alpha*A*x + beta*y
+        y := alpha*A*x    + beta*y,   or
+        y := alpha*A**T*x + beta*y,   or
+        y := alpha*A**H*x + beta*y,
 
-    where alpha and beta are scalars, x and y are n element vectors and A is an
-    n by n Hermitian matrix.
+    where alpha and beta are scalars, x and y are vectors and A is an
+    m by n matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied.
-              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied.
+    trans     [hipblasOperation_t]
+              indicates whether matrix A is tranposed (conjugated) or not
+    @param[in]
+    m         [int]
+              number of rows of matrix A
     @param[in]
     n         [int]
-              the order of the matrix A.
+              number of columns of matrix A
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         device pointer storing matrix A. Of dimension (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular part of A must contain
-                the upper triangular part of a Hermitian matrix. The lower
-                triangular part of A will not be referenced.
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular part of A must contain
-                the lower triangular part of a Hermitian matrix. The upper
-                triangular part of A will not be referenced.
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of A will not be referenced and is assumed to be == 0.
+    A         device pointer storing matrix A.
     @param[in]
     lda       [int]
-              specifies the leading dimension of A. must be >= max(1, n)
+              specifies the leading dimension of A.
     @param[in]
     x         device pointer storing vector x.
     @param[in]
@@ -4432,21 +4629,51 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
               specifies the increment for the elements of y.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
+                                            hipblasOperation_t          trans,
+                                            int                         m,
                                             int                         n,
                                             const hipblasDoubleComplex* alpha,
                                             const hipblasDoubleComplex* A,
-                                            int                         da,
+                                            int                         lda,
                                             const hipblasDoubleComplex* x,
                                             int                         incx,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
-// hemvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
+// gemvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t trans,
+                                                   int                m,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float*       beta,
+                                                   float* const       y[],
+                                                   int                incy,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  trans,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double*       beta,
+                                                   double* const       y[],
+                                                   int                 incy,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          trans,
+                                                   int                         m,
                                                    int                         n,
                                                    const hipblasComplex*       alpha,
                                                    const hipblasComplex* const A[],
@@ -4461,59 +4688,55 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             h
 /*! \brief BLAS Level 2 API
 
     \details
-    hemvBatched performs one of the matrix-vector operations
+    gemvBatched performs a batch of matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i
+        y_i := alpha*A_i*x_i    + beta*y_i,   or
+        y_i := alpha*A_i**T*x_i + beta*y_i,   or
+        y_i := alpha*A_i**H*x_i + beta*y_i,
 
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, for each batch in i = [1, batchCount].
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n matrix, for i = 1, ..., batchCount.
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied.
-              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied.
+    trans       [hipblasOperation_t]
+                indicates whether matrices A_i are tranposed (conjugated) or not
     @param[in]
-    n         [int]
-              the order of each matrix A_i.
+    m           [int]
+                number of rows of each matrix A_i
     @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
+    n           [int]
+                number of columns of each matrix A_i
     @param[in]
-    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular part of each A_i must contain
-                the upper triangular part of a Hermitian matrix. The lower
-                triangular part of each A_i will not be referenced.
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular part of each A_i must contain
-                the lower triangular part of a Hermitian matrix. The upper
-                triangular part of each A_i will not be referenced.
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+    alpha       device pointer or host pointer to scalar alpha.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+    A           device array of device pointers storing each matrix A_i.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    lda         [int]
+                specifies the leading dimension of each matrix A_i.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    x           device array of device pointers storing each vector x_i.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    incx        [int]
+                specifies the increment for the elements of each vector x_i.
+    @param[in]
+    beta        device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array of device pointers storing each vector y_i.
+    y           device array of device pointers storing each vector y_i.
     @param[in]
-    incy      [int]
-              specifies the increment for the elements of y.
+    incy        [int]
+                specifies the increment for the elements of each vector y_i.
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                number of instances in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
+                                                   hipblasOperation_t                trans,
+                                                   int                               m,
                                                    int                               n,
                                                    const hipblasDoubleComplex*       alpha,
                                                    const hipblasDoubleComplex* const A[],
@@ -4525,89 +4748,125 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount);
 
-// hemvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batchCount);
-
-/*! \brief BLAS Level 2 API
-
-    \details
-    hemvStridedBatched performs one of the matrix-vector operations
-
-        y_i := alpha*A_i*x_i + beta*y_i
-
-    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, for each batch in i = [1, batchCount].
+// gemvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          const float*       alpha,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const float*       x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          const float*       beta,
+                                                          float*             y,
+                                                          int                incy,
+                                                          hipblasStride      stridey,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t trans,
+                                                          int                m,
+                                                          int                n,
+                                                          const double*      alpha,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          const double*      x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          const double*      beta,
+                                                          double*            y,
+                                                          int                incy,
+                                                          hipblasStride      stridey,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    trans,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    gemvStridedBatched performs a batch of matrix-vector operations
+
+        y_i := alpha*A_i*x_i    + beta*y_i,   or
+        y_i := alpha*A_i**T*x_i + beta*y_i,   or
+        y_i := alpha*A_i**H*x_i + beta*y_i,
+
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    m by n matrix, for i = 1, ..., batchCount.
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied.
-              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied.
+    transA      [hipblasOperation_t]
+                indicates whether matrices A_i are tranposed (conjugated) or not
     @param[in]
-    n         [int]
-              the order of each matrix A_i.
+    m           [int]
+                number of rows of matrices A_i
     @param[in]
-    alpha     device pointer or host pointer to scalar alpha.
+    n           [int]
+                number of columns of matrices A_i
     @param[in]
-    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular part of each A_i must contain
-                the upper triangular part of a Hermitian matrix. The lower
-                triangular part of each A_i will not be referenced.
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular part of each A_i must contain
-                the lower triangular part of a Hermitian matrix. The upper
-                triangular part of each A_i will not be referenced.
-              As a Hermitian matrix, the imaginary part of the main diagonal
-              of each A_i will not be referenced and is assumed to be == 0.
+    alpha       device pointer or host pointer to scalar alpha.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i. must be >= max(1, n)
+    A           device pointer to the first matrix (A_1) in the batch.
     @param[in]
-    strideA    [hipblasStride]
-                stride from the start of one (A_i) to the next (A_i+1)
-
+    lda         [int]
+                specifies the leading dimension of matrices A_i.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    strideA     [hipblasStride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    x           device pointer to the first vector (x_1) in the batch.
     @param[in]
-    stridex  [hipblasStride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
+    incx        [int]
+                specifies the increment for the elements of vectors x_i.
     @param[in]
-    beta      device pointer or host pointer to scalar beta.
+    stridex     [hipblasStride]
+                stride from the start of one vector (x_i) and the next one (x_i+1).
+                There are no restrictions placed on stridex, however the user should
+                take care to ensure that stridex is of appropriate size. When trans equals HIPBLAS_OP_N
+                this typically means stridex >= n * incx, otherwise stridex >= m * incx.
+    @param[in]
+    beta        device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array of device pointers storing each vector y_i.
+    y           device pointer to the first vector (y_1) in the batch.
     @param[in]
-    incy      [int]
-              specifies the increment for the elements of y.
+    incy        [int]
+                specifies the increment for the elements of vectors y_i.
     @param[in]
-    stridey  [hipblasStride]
-              stride from the start of one vector (y_i) and the next one (y_i+1).
+    stridey     [hipblasStride]
+                stride from the start of one vector (y_i) and the next one (y_i+1).
+                There are no restrictions placed on stridey, however the user should
+                take care to ensure that stridey is of appropriate size. When trans equals HIPBLAS_OP_N
+                this typically means stridey >= m * incy, otherwise stridey >= n * incy. stridey should be non zero.
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                number of instances in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          trans,
+                                                          int                         m,
                                                           int                         n,
                                                           const hipblasDoubleComplex* alpha,
                                                           const hipblasDoubleComplex* A,
@@ -4622,218 +4881,257 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
 
-// her
-HIPBLAS_EXPORT hipblasStatus_t hipblasCher(hipblasHandle_t       handle,
-                                           hipblasFillMode_t     uplo,
-                                           int                   n,
-                                           const float*          alpha,
-                                           const hipblasComplex* x,
-                                           int                   incx,
-                                           hipblasComplex*       A,
-                                           int                   lda);
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasOperation_t trans,
+                                                           int                m,
+                                                           int                n,
+                                                           const float*       alpha,
+                                                           const float* const A[],
+                                                           int                lda,
+                                                           const float* const x[],
+                                                           int                incx,
+                                                           const float*       beta,
+                                                           float* const       y[],
+                                                           int                incy,
+                                                           int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatchedHostPtrs(hipblasHandle_t     handle,
+                                                           hipblasOperation_t  trans,
+                                                           int                 m,
+                                                           int                 n,
+                                                           const double*       alpha,
+                                                           const double* const A[],
+                                                           int                 lda,
+                                                           const double* const x[],
+                                                           int                 incx,
+                                                           const double*       beta,
+                                                           double* const       y[],
+                                                           int                 incy,
+                                                           int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasOperation_t          trans,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex* const x[],
+                                                           int                         incx,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       y[],
+                                                           int                         incy,
+                                                           int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    her performs the matrix-vector operations
+    gemvBatchedHostPtrs performs the batched matrix-vector operations of gemvBatched
 
-        A := A + alpha*x*x**H
+        y_i := alpha*op( A_i )*x_i + beta*y_i, for i = 1, ..., batchCount,
 
-    where alpha is a real scalar, x is a vector, and A is an
-    n by n Hermitian matrix.
+    with the arrays of pointers to the matrices A_i and the vectors x_i and y_i in host
+    memory; the matrices and vectors themselves are in device memory. When the pointers
+    of every array are evenly spaced the call is issued as gemvStridedBatched and the
+    arrays are not copied to the device. Otherwise they are copied to a pointer array
+    workspace kept by the handle, on the stream of the handle, and the call is issued as
+    gemvBatched.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied in A.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied in A.
+    trans     [hipblasOperation_t]
+              indicates whether matrices A_i are tranposed (conjugated) or not
+    @param[in]
+    m         [int]
+              number of rows of each matrix A_i
     @param[in]
     n         [int]
-              the number of rows and columns of matrix A, must be at least 0.
+              number of columns of each matrix A_i
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device pointer storing vector x.
+    A         host array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each matrix A_i.
+    @param[in]
+    x         host array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of each vector x_i.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    A         device pointer storing the specified triangular portion of
-              the Hermitian matrix A. Of size (lda * n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of the Hermitian matrix A is supplied. The lower
-                triangluar portion will not be touched.
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of the Hermitian matrix A is supplied. The upper
-                triangular portion will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         host array of device pointers storing each vector y_i.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A. Must be at least max(1, n).
+    incy      [int]
+              specifies the increment for the elements of each vector y_i.
+    @param[in]
+    batchCount
+              [int]
+              number of instances in the batch.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
-                                           hipblasFillMode_t           uplo,
-                                           int                         n,
-                                           const double*               alpha,
-                                           const hipblasDoubleComplex* x,
-                                           int                         incx,
-                                           hipblasDoubleComplex*       A,
-                                           int                         lda);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatchedHostPtrs(hipblasHandle_t                   handle,
+                                                           hipblasOperation_t                trans,
+                                                           int                               m,
+                                                           int                               n,
+                                                           const hipblasDoubleComplex*       alpha,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           int                               lda,
+                                                           const hipblasDoubleComplex* const x[],
+                                                           int                               incx,
+                                                           const hipblasDoubleComplex*       beta,
+                                                           hipblasDoubleComplex* const       y[],
+                                                           int                               incy,
+                                                           int batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvVbatched(hipblasHandle_t    handle,
+                                                    hipblasOperation_t trans,
+                                                    const int          m[],
+                                                    const int          n[],
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    const int          lda[],
+                                                    const float* const x[],
+                                                    const int          incx[],
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    const int          incy[],
+                                                    int                batchCount);
 
-// herBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasCherBatched(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
-                                                  int                         n,
-                                                  const float*                alpha,
-                                                  const hipblasComplex* const x[],
-                                                  int                         incx,
-                                                  hipblasComplex* const       A[],
-                                                  int                         lda,
-                                                  int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvVbatched(hipblasHandle_t     handle,
+                                                    hipblasOperation_t  trans,
+                                                    const int           m[],
+                                                    const int           n[],
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    const int           lda[],
+                                                    const double* const x[],
+                                                    const int           incx[],
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    const int           incy[],
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvVbatched(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          trans,
+                                                    const int                   m[],
+                                                    const int                   n[],
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    const hipblasComplex* const x[],
+                                                    const int                   incx[],
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       y[],
+                                                    const int                   incy[],
+                                                    int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    herBatched performs the matrix-vector operations
+    gemvVbatched performs a batch of matrix-vector operations of different sizes
 
-        A_i := A_i + alpha*x_i*x_i**H
+        y_i := alpha*op( A_i )*x_i + beta*y_i, for i = 1, ..., batchCount,
 
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n symmetric matrix, for i = 1, ..., batchCount.
+    where op( A_i ) is A_i, A_i**T or A_i**H, alpha and beta are scalars shared by the batch,
+    and instance i has its own m[i], n[i], lda[i], incx[i] and incy[i].
+
+    The size arrays and the arrays of pointers are in host memory; the matrices and vectors
+    themselves are in device memory. The instances are grouped by shape (m, n, lda, incx,
+    incy) on the host. A shape with several instances is issued as one batched gemv call,
+    which runs many small instances per launch, and a shape with a single instance as a gemv
+    call. The arrays of pointers of all the groups are copied to the device in one upload,
+    and evenly spaced instances need none, as for gemvBatchedHostPtrs. The groups are issued
+    in order on the stream of the handle, largest first. The arguments of every instance are
+    checked before any group is issued.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in A.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in A.
+    trans     [hipblasOperation_t]
+              indicates whether matrices A_i are tranposed (conjugated) or not
     @param[in]
-    n         [int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+    m         host array of batchCount [int], the number of rows of each matrix A_i
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    n         host array of batchCount [int], the number of columns of each matrix A_i
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
-    @param[inout]
-    A         device array of device pointers storing the specified triangular portion of
-              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular portion
-                of each A_i will not be touched.
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular portion
-                of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
-    @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i. Must be at least max(1, n).
-    @param[in]
-    batchCount [int]
-                number of instances in the batch.
-    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
-                                                  hipblasFillMode_t                 uplo,
-                                                  int                               n,
-                                                  const double*                     alpha,
-                                                  const hipblasDoubleComplex* const x[],
-                                                  int                               incx,
-                                                  hipblasDoubleComplex* const       A[],
-                                                  int                               lda,
-                                                  int                               batchCount);
-
-// herStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       handle,
-                                                         hipblasFillMode_t     uplo,
-                                                         int                   n,
-                                                         const float*          alpha,
-                                                         const hipblasComplex* x,
-                                                         int                   incx,
-                                                         hipblasStride         stridex,
-                                                         hipblasComplex*       A,
-                                                         int                   lda,
-                                                         hipblasStride         strideA,
-                                                         int                   batchCount);
-
-/*! \brief BLAS Level 2 API
-
-    \details
-    herStridedBatched performs the matrix-vector operations
-
-        A_i := A_i + alpha*x_i*x_i**H
-
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n Hermitian matrix, for i = 1, ..., batchCount.
-
-    @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
-    @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in A.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in A.
-    @param[in]
-    n         [int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+    A         host array of device pointers storing each matrix A_i.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    lda       host array of batchCount [int], the leading dimension of each matrix A_i,
+              lda[i] >= max( 1, m[i] ).
     @param[in]
-    x         device pointer pointing to the first vector (x_1).
+    x         host array of device pointers storing each vector x_i.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    incx      host array of batchCount [int], the nonzero increment of each vector x_i.
     @param[in]
-    stridex  [hipblasStride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    A         device array of device pointers storing the specified triangular portion of
-              each Hermitian matrix A_i. Points to the first matrix (A_1).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
-                portion of each A_i will not be touched.
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
-                portion of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         host array of device pointers storing each vector y_i.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
-    @param[in]
-    strideA    [hipblasStride]
-                stride from the start of one (A_i) and the next (A_i+1)
+    incy      host array of batchCount [int], the nonzero increment of each vector y_i.
     @param[in]
-    batchCount [int]
-                number of instances in the batch.
+    batchCount
+              [int]
+              number of instances in the batch.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const double*               alpha,
-                                                         const hipblasDoubleComplex* x,
-                                                         int                         incx,
-                                                         hipblasStride               stridex,
-                                                         hipblasDoubleComplex*       A,
-                                                         int                         lda,
-                                                         hipblasStride               strideA,
-                                                         int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvVbatched(hipblasHandle_t                   handle,
+                                                    hipblasOperation_t                trans,
+                                                    const int                         m[],
+                                                    const int                         n[],
+                                                    const hipblasDoubleComplex*       alpha,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    const int                         lda[],
+                                                    const hipblasDoubleComplex* const x[],
+                                                    const int                         incx[],
+                                                    const hipblasDoubleComplex*       beta,
+                                                    hipblasDoubleComplex* const       y[],
+                                                    const int                         incy[],
+                                                    int                               batchCount);
 
-// her2
-HIPBLAS_EXPORT hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
+// ger
+HIPBLAS_EXPORT hipblasStatus_t hipblasSger(hipblasHandle_t handle,
+                                           int             m,
+                                           int             n,
+                                           const float*    alpha,
+                                           const float*    x,
+                                           int             incx,
+                                           const float*    y,
+                                           int             incy,
+                                           float*          A,
+                                           int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDger(hipblasHandle_t handle,
+                                           int             m,
+                                           int             n,
+                                           const double*   alpha,
+                                           const double*   x,
+                                           int             incx,
+                                           const double*   y,
+                                           int             incy,
+                                           double*         A,
+                                           int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* y,
+                                            int                   incy,
+                                            hipblasComplex*       A,
+                                            int                   lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
+                                            int                   m,
                                             int                   n,
                                             const hipblasComplex* alpha,
                                             const hipblasComplex* x,
@@ -4843,27 +5141,37 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
                                             hipblasComplex*       A,
                                             int                   lda);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            const hipblasDoubleComplex* y,
+                                            int                         incy,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda);
+
 /*! \brief BLAS Level 2 API
 
     \details
-    her2 performs the matrix-vector operations
+    ger,geru,gerc performs the matrix-vector operations
 
-        A := A + alpha*x*y**H + conj(alpha)*y*x**H
+        A := A + alpha*x*y**T , OR
+        A := A + alpha*x*y**H for gerc
 
-    where alpha is a complex scalar, x and y are vectors, and A is an
-    n by n Hermitian matrix.
+    where alpha is a scalar, x and y are vectors, and A is an
+    m by n matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied.
+    m         [int]
+              the number of rows of the matrix A.
     @param[in]
     n         [int]
-              the number of rows and columns of matrix A, must be at least 0.
+              the number of columns of the matrix A.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
@@ -4878,22 +5186,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
     incy      [int]
               specifies the increment for the elements of y.
     @param[inout]
-    A         device pointer storing the specified triangular portion of
-              the Hermitian matrix A. Of size (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of the Hermitian matrix A is supplied. The lower triangular
-                portion of A will not be touched.
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of the Hermitian matrix A is supplied. The upper triangular
-                portion of A will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    A         device pointer storing matrix A.
     @param[in]
     lda       [int]
-              specifies the leading dimension of A. Must be at least max(lda, 1).
+              specifies the leading dimension of A.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
+                                            int                         m,
                                             int                         n,
                                             const hipblasDoubleComplex* alpha,
                                             const hipblasDoubleComplex* x,
@@ -4903,9 +5204,45 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       A,
                                             int                         lda);
 
-// her2Batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
+// gerBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
+                                                  int                m,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float* const x[],
+                                                  int                incx,
+                                                  const float* const y[],
+                                                  int                incy,
+                                                  float* const       A[],
+                                                  int                lda,
+                                                  int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
+                                                  int                 m,
+                                                  int                 n,
+                                                  const double*       alpha,
+                                                  const double* const x[],
+                                                  int                 incx,
+                                                  const double* const y[],
+                                                  int                 incy,
+                                                  double* const       A[],
+                                                  int                 lda,
+                                                  int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex* const y[],
+                                                   int                         incy,
+                                                   hipblasComplex* const       A[],
+                                                   int                         lda,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
+                                                   int                         m,
                                                    int                         n,
                                                    const hipblasComplex*       alpha,
                                                    const hipblasComplex* const x[],
@@ -4916,27 +5253,39 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             h
                                                    int                         lda,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
+                                                   int                               m,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex* const y[],
+                                                   int                               incy,
+                                                   hipblasDoubleComplex* const       A[],
+                                                   int                               lda,
+                                                   int                               batchCount);
+
 /*! \brief BLAS Level 2 API
 
     \details
-    her2Batched performs the matrix-vector operations
+    gerBatched,geruBatched,gercBatched performs a batch of the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+        A := A + alpha*x*y**T , OR
+        A := A + alpha*x*y**H for gerc
 
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n Hermitian matrix for each batch in i = [1, batchCount].
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha is a scalar, x_i and y_i are vectors and A_i is an
+    m by n matrix, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied.
+    m         [int]
+              the number of rows of each matrix A_i.
     @param[in]
     n         [int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the number of columns of eaceh matrix A_i.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
@@ -4944,32 +5293,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             h
     x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of x.
+              specifies the increment for the elements of each vector x_i.
     @param[in]
     y         device array of device pointers storing each vector y_i.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of each y_i.
+              specifies the increment for the elements of each vector y_i.
     @param[inout]
-    A         device array of device pointers storing the specified triangular portion of
-              each Hermitian matrix A_i of size (lda, n).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
-                portion of each A_i will not be touched.
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
-                portion of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    A         device array of device pointers storing each matrix A_i.
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
+              specifies the leading dimension of each A_i.
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                number of instances in the batch
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
+                                                   int                               m,
                                                    int                               n,
                                                    const hipblasDoubleComplex*       alpha,
                                                    const hipblasDoubleComplex* const x[],
@@ -4980,9 +5322,54 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched(hipblasHandle_t
                                                    int                               lda,
                                                    int                               batchCount);
 
-// her2StridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
+// gerStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
+                                                         int             m,
+                                                         int             n,
+                                                         const float*    alpha,
+                                                         const float*    x,
+                                                         int             incx,
+                                                         hipblasStride   stridex,
+                                                         const float*    y,
+                                                         int             incy,
+                                                         hipblasStride   stridey,
+                                                         float*          A,
+                                                         int             lda,
+                                                         hipblasStride   strideA,
+                                                         int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
+                                                         int             m,
+                                                         int             n,
+                                                         const double*   alpha,
+                                                         const double*   x,
+                                                         int             incx,
+                                                         hipblasStride   stridex,
+                                                         const double*   y,
+                                                         int             incy,
+                                                         hipblasStride   stridey,
+                                                         double*         A,
+                                                         int             lda,
+                                                         hipblasStride   strideA,
+                                                         int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          hipblasComplex*       A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
+                                                          int                   m,
                                                           int                   n,
                                                           const hipblasComplex* alpha,
                                                           const hipblasComplex* x,
@@ -4996,69 +5383,83 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t
                                                           hipblasStride         strideA,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          hipblasDoubleComplex*       A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          int                         batchCount);
+
 /*! \brief BLAS Level 2 API
 
     \details
-    her2StridedBatched performs the matrix-vector operations
+    gerStridedBatched,geruStridedBatched,gercStridedBatched performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+        A_i := A_i + alpha*x_i*y_i**T, OR
+        A_i := A_i + alpha*x_i*y_i**H  for gerc
 
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n Hermitian matrix for each batch in i = [1, batchCount].
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha is a scalar, x_i and y_i are vectors and A_i is an
+    m by n matrix, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied.
+    m         [int]
+              the number of rows of each matrix A_i.
     @param[in]
     n         [int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the number of columns of each matrix A_i.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device pointer pointing to the first vector x_1.
+    x         device pointer to the first vector (x_1) in the batch.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each x_i.
-    @param[in]
-    stridex  [hipblasStride]
-              specifies the stride between the beginning of one vector (x_i) and the next (x_i+1).
+              specifies the increments for the elements of each vector x_i.
     @param[in]
-    y         device pointer pointing to the first vector y_i.
+    stridex   [hipblasStride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+              There are no restrictions placed on stridex, however the user should
+              take care to ensure that stridex is of appropriate size, for a typical
+              case this means stridex >= m * incx.
+    @param[inout]
+    y         device pointer to the first vector (y_1) in the batch.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of each y_i.
+              specifies the increment for the elements of each vector y_i.
     @param[in]
-    stridey  [hipblasStride]
-              specifies the stride between the beginning of one vector (y_i) and the next (y_i+1).
+    stridey   [hipblasStride]
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+              There are no restrictions placed on stridey, however the user should
+              take care to ensure that stridey is of appropriate size, for a typical
+              case this means stridey >= n * incy.
     @param[inout]
-    A         device pointer pointing to the first matrix (A_1). Stores the specified triangular portion of
-              each Hermitian matrix A_i.
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
-                portion of each A_i will not be touched.
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
-                portion of each A_i will not be touched.
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    A         device pointer to the first matrix (A_1) in the batch.
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
+              specifies the leading dimension of each A_i.
     @param[in]
-    strideA  [hipblasStride]
-              specifies the stride between the beginning of one matrix (A_i) and the next (A_i+1).
+    strideA     [hipblasStride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                number of instances in the batch
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
+                                                          int                         m,
                                                           int                         n,
                                                           const hipblasDoubleComplex* alpha,
                                                           const hipblasDoubleComplex* x,
@@ -5072,12 +5473,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t
                                                           hipblasStride               strideA,
                                                           int                         batchCount);
 
-// hpmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
+// hbmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             int                   n,
+                                            int                   k,
                                             const hipblasComplex* alpha,
-                                            const hipblasComplex* AP,
+                                            const hipblasComplex* A,
+                                            int                   lda,
                                             const hipblasComplex* x,
                                             int                   incx,
                                             const hipblasComplex* beta,
@@ -5087,52 +5490,61 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    hpmv performs the matrix-vector operation
+    hbmv performs the matrix-vector operations
 
         y := alpha*A*x + beta*y
 
     where alpha and beta are scalars, x and y are n element vectors and A is an
-    n by n Hermitian matrix, supplied in packed form (see description below).
+    n by n Hermitian band matrix, with k super-diagonals.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is being supplied.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is being supplied.
     @param[in]
     n         [int]
-              the order of the matrix A, must be >= 0.
+              the order of the matrix A.
+    @param[in]
+    k         [int]
+              the number of super-diagonals of the matrix A. Must be >= 0.
     @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+    A         device pointer storing matrix A. Of dimension (lda, n).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+                The leading (k + 1) by n part of A must contain the upper
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (k + 1), the first super-diagonal on the RHS
+                of row k, etc.
+                The top left k by x triangle of A will not be referenced.
+                    Ex (upper, lda = n = 4, k = 1):
+                    A                             Represented matrix
+                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
+                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
+
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The leading (k + 1) by n part of A must contain the lower
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (1), the first sub-diagonal on the LHS of
+                row 2, etc.
+                The bottom right k by k triangle of A will not be referenced.
+                    Ex (lower, lda = 2, n = 4, k = 1):
+                    A                               Represented matrix
+                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
+                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
+                                                    (0, 0) (6, 8) (3, 0) (7,-7)
+                                                    (0, 0) (0, 0) (7, 7) (4, 0)
+
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of A will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. must be >= k + 1
     @param[in]
     x         device pointer storing vector x.
     @param[in]
@@ -5147,23 +5559,27 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
               specifies the increment for the elements of y.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             int                         n,
+                                            int                         k,
                                             const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* AP,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
                                             const hipblasDoubleComplex* x,
                                             int                         incx,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
-// hpmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             handle,
+// hbmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    int                         n,
+                                                   int                         k,
                                                    const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const AP[],
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
                                                    const hipblasComplex* const x[],
                                                    int                         incx,
                                                    const hipblasComplex*       beta,
@@ -5174,53 +5590,61 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             h
 /*! \brief BLAS Level 2 API
 
     \details
-    hpmvBatched performs the matrix-vector operation
+    hbmvBatched performs one of the matrix-vector operations
 
         y_i := alpha*A_i*x_i + beta*y_i
 
     where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, supplied in packed form (see description below),
-    for each batch in i = [1, batchCount].
+    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is being supplied.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is being supplied.
     @param[in]
     n         [int]
               the order of each matrix A_i.
     @param[in]
+    k         [int]
+              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    AP      device pointer of device pointers storing the packed version of the specified triangular
-            portion of each Hermitian matrix A_i. Each A_i is of at least size ((n * (n + 1)) / 2).
-            if uplo == HIPBLAS_FILL_MODE_UPPER:
-            The upper triangular portion of each Hermitian matrix A_i is supplied.
-            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-            so that:
-            AP(0) = A(0,0)
-            AP(1) = A(0,1)
-            AP(2) = A(1,1), etc.
-                Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                    (1, 0) (2, 1) (3, 2)
-                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
-                    (3,-2) (5, 1) (6, 0)
-        if uplo == HIPBLAS_FILL_MODE_LOWER:
-            The lower triangular portion of each Hermitian matrix A_i is supplied.
-            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-            so that:
-            AP(0) = A(0,0)
-            AP(1) = A(1,0)
-            AP(2) = A(2,1), etc.
-                Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                    (1, 0) (2, 1) (3, 2)
-                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
-                    (3,-2) (5, 1) (6, 0)
-        Note that the imaginary part of the diagonal elements are not accessed and are assumed
-        to be 0.
+    A         device array of device pointers storing each matrix_i A of dimension (lda, n).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The leading (k + 1) by n part of each A_i must contain the upper
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (k + 1), the first super-diagonal on the RHS
+                of row k, etc.
+                The top left k by x triangle of each A_i will not be referenced.
+                    Ex (upper, lda = n = 4, k = 1):
+                    A                             Represented matrix
+                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
+                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
+
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The leading (k + 1) by n part of each A_i must contain the lower
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (1), the first sub-diagonal on the LHS of
+                row 2, etc.
+                The bottom right k by k triangle of each A_i will not be referenced.
+                    Ex (lower, lda = 2, n = 4, k = 1):
+                    A                               Represented matrix
+                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
+                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
+                                                    (0, 0) (6, 8) (3, 0) (7,-7)
+                                                    (0, 0) (0, 0) (7, 7) (4, 0)
+
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
     @param[in]
     x         device array of device pointers storing each vector x_i.
     @param[in]
@@ -5238,11 +5662,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             h
                 number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    int                               n,
+                                                   int                               k,
                                                    const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const AP[],
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
                                                    const hipblasDoubleComplex* const x[],
                                                    int                               incx,
                                                    const hipblasDoubleComplex*       beta,
@@ -5250,13 +5676,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount);
 
-// hpmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t       handle,
+// hbmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           int                   n,
+                                                          int                   k,
                                                           const hipblasComplex* alpha,
-                                                          const hipblasComplex* AP,
-                                                          hipblasStride         strideAP,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
                                                           const hipblasComplex* x,
                                                           int                   incx,
                                                           hipblasStride         stridex,
@@ -5269,85 +5697,95 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t
 /*! \brief BLAS Level 2 API
 
     \details
-    hpmvStridedBatched performs the matrix-vector operation
+    hbmvStridedBatched performs one of the matrix-vector operations
 
         y_i := alpha*A_i*x_i + beta*y_i
 
     where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
-    n by n Hermitian matrix, supplied in packed form (see description below),
-    for each batch in i = [1, batchCount].
+    n by n Hermitian band matrix with k super-diagonals, for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is being supplied.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is being supplied.
     @param[in]
     n         [int]
               the order of each matrix A_i.
     @param[in]
+    k         [int]
+              the number of super-diagonals of each matrix A_i. Must be >= 0.
+    @param[in]
     alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    AP        device pointer pointing to the beginning of the first matrix (AP_1). Stores the packed
-              version of the specified triangular portion of each Hermitian matrix AP_i of size ((n * (n + 1)) / 2).
+    A         device array pointing to the first matrix A_1. Each A_i is of dimension (lda, n).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (3, 2)
-                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
-                        (3,-2) (5, 1) (6, 0)
-        Note that the imaginary part of the diagonal elements are not accessed and are assumed
-        to be 0.
+                The leading (k + 1) by n part of each A_i must contain the upper
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (k + 1), the first super-diagonal on the RHS
+                of row k, etc.
+                The top left k by x triangle of each A_i will not be referenced.
+                    Ex (upper, lda = n = 4, k = 1):
+                    A                             Represented matrix
+                    (0,0) (5,9) (6,8) (7,7)       (1, 0) (5, 9) (0, 0) (0, 0)
+                    (1,0) (2,0) (3,0) (4,0)       (5,-9) (2, 0) (6, 8) (0, 0)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (6,-8) (3, 0) (7, 7)
+                    (0,0) (0,0) (0,0) (0,0)       (0, 0) (0, 0) (7,-7) (4, 0)
+
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The leading (k + 1) by n part of each A_i must contain the lower
+                triangular band part of the Hermitian matrix, with the leading
+                diagonal in row (1), the first sub-diagonal on the LHS of
+                row 2, etc.
+                The bottom right k by k triangle of each A_i will not be referenced.
+                    Ex (lower, lda = 2, n = 4, k = 1):
+                    A                               Represented matrix
+                    (1,0) (2,0) (3,0) (4,0)         (1, 0) (5,-9) (0, 0) (0, 0)
+                    (5,9) (6,8) (7,7) (0,0)         (5, 9) (2, 0) (6,-8) (0, 0)
+                                                    (0, 0) (6, 8) (3, 0) (7,-7)
+                                                    (0, 0) (0, 0) (7, 7) (4, 0)
+
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
     @param[in]
     strideA  [hipblasStride]
-              stride from the start of one matrix (AP_i) and the next one (AP_i+1).
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
     @param[in]
-    x         device array pointing to the beginning of the first vector (x_1).
+    x         device array pointing to the first vector y_1.
     @param[in]
     incx      [int]
               specifies the increment for the elements of each x_i.
     @param[in]
     stridex  [hipblasStride]
-              stride from the start of one vector (x_i) and the next one (x_i+1).
+              stride from the start of one vector (x_i) and the next one (x_i+1)
     @param[in]
     beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    y         device array pointing to the beginning of the first vector (y_1).
+    y         device array pointing to the first vector y_1.
     @param[in]
     incy      [int]
               specifies the increment for the elements of y.
     @param[in]
     stridey  [hipblasStride]
-              stride from the start of one vector (y_i) and the next one (y_i+1).
+              stride from the start of one vector (y_i) and the next one (y_i+1)
     @param[in]
     batchCount [int]
                 number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           int                         n,
+                                                          int                         k,
                                                           const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* AP,
-                                                          hipblasStride               strideAP,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
                                                           const hipblasDoubleComplex* x,
                                                           int                         incx,
                                                           hipblasStride               stridex,
@@ -5357,268 +5795,279 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
 
-// hpr
-HIPBLAS_EXPORT hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
-                                           hipblasFillMode_t     uplo,
-                                           int                   n,
-                                           const float*          alpha,
-                                           const hipblasComplex* x,
-                                           int                   incx,
-                                           hipblasComplex*       AP);
+// hemv
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemv(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    hpr performs the matrix-vector operations
+    hemv performs one of the matrix-vector operations
 
-        A := A + alpha*x*x**H
+        y := alpha*A*x + beta*y
 
-    where alpha is a real scalar, x is a vector, and A is an
-    n by n Hermitian matrix, supplied in packed form.
+    where alpha and beta are scalars, x and y are n element vectors and A is an
+    n by n Hermitian matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied.
+              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied.
     @param[in]
     n         [int]
-              the number of rows and columns of matrix A, must be at least 0.
+              the order of the matrix A.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A. Of dimension (lda, n).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular part of A must contain
+                the upper triangular part of a Hermitian matrix. The lower
+                triangular part of A will not be referenced.
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular part of A must contain
+                the lower triangular part of a Hermitian matrix. The upper
+                triangular part of A will not be referenced.
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of A will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. must be >= max(1, n)
     @param[in]
     x         device pointer storing vector x.
     @param[in]
     incx      [int]
               specifies the increment for the elements of x.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
-                                           hipblasFillMode_t           uplo,
-                                           int                         n,
-                                           const double*               alpha,
-                                           const hipblasDoubleComplex* x,
-                                           int                         incx,
-                                           hipblasDoubleComplex*       AP);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemv(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         da,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       y,
+                                            int                         incy);
 
-// hprBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
-                                                  int                         n,
-                                                  const float*                alpha,
-                                                  const hipblasComplex* const x[],
-                                                  int                         incx,
-                                                  hipblasComplex* const       AP[],
-                                                  int                         batchCount);
+// hemvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       y[],
+                                                   int                         incy,
+                                                   int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    hprBatched performs the matrix-vector operations
+    hemvBatched performs one of the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**H
+        y_i := alpha*A_i*x_i + beta*y_i
 
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied.
+              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied.
     @param[in]
     n         [int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the order of each matrix A_i.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    alpha     device pointer or host pointer to scalar alpha.
+    @param[in]
+    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular part of each A_i must contain
+                the upper triangular part of a Hermitian matrix. The lower
+                triangular part of each A_i will not be referenced.
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular part of each A_i must contain
+                the lower triangular part of a Hermitian matrix. The upper
+                triangular part of each A_i will not be referenced.
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
     @param[in]
     x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
               specifies the increment for the elements of each x_i.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
-              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y.
     @param[in]
     batchCount [int]
                 number of instances in the batch.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
-                                                  hipblasFillMode_t                 uplo,
-                                                  int                               n,
-                                                  const double*                     alpha,
-                                                  const hipblasDoubleComplex* const x[],
-                                                  int                               incx,
-                                                  hipblasDoubleComplex* const       AP[],
-                                                  int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex* const       y[],
+                                                   int                               incy,
+                                                   int                               batchCount);
 
-// hprStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
-                                                         hipblasFillMode_t     uplo,
-                                                         int                   n,
-                                                         const float*          alpha,
-                                                         const hipblasComplex* x,
-                                                         int                   incx,
-                                                         hipblasStride         stridex,
-                                                         hipblasComplex*       AP,
-                                                         hipblasStride         strideAP,
-                                                         int                   batchCount);
+// hemvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    hprStridedBatched performs the matrix-vector operations
+    hemvStridedBatched performs one of the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**H
+        y_i := alpha*A_i*x_i + beta*y_i
 
-    where alpha is a real scalar, x_i is a vector, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied.
+              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied.
     @param[in]
     n         [int]
-              the number of rows and columns of each matrix A_i, must be at least 0.
+              the order of each matrix A_i.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device pointer pointing to the first vector (x_1).
+    A         device array of device pointers storing each matrix A_i of dimension (lda, n).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular part of each A_i must contain
+                the upper triangular part of a Hermitian matrix. The lower
+                triangular part of each A_i will not be referenced.
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular part of each A_i must contain
+                the lower triangular part of a Hermitian matrix. The upper
+                triangular part of each A_i will not be referenced.
+              As a Hermitian matrix, the imaginary part of the main diagonal
+              of each A_i will not be referenced and is assumed to be == 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. must be >= max(1, n)
+    @param[in]
+    strideA    [hipblasStride]
+                stride from the start of one (A_i) to the next (A_i+1)
+
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
               specifies the increment for the elements of each x_i.
     @param[in]
     stridex  [hipblasStride]
               stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
-              each Hermitian matrix A_i. Points to the first matrix (A_1).
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
-            Note that the imaginary part of the diagonal elements are not accessed and are assumed
-            to be 0.
+    y         device array of device pointers storing each vector y_i.
     @param[in]
-    strideAP   [hipblasStride]
-                stride from the start of one (A_i) and the next (A_i+1)
+    incy      [int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stridey  [hipblasStride]
+              stride from the start of one vector (y_i) and the next one (y_i+1).
     @param[in]
     batchCount [int]
                 number of instances in the batch.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const double*               alpha,
-                                                         const hipblasDoubleComplex* x,
-                                                         int                         incx,
-                                                         hipblasStride               stridex,
-                                                         hipblasDoubleComplex*       AP,
-                                                         hipblasStride               strideAP,
-                                                         int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          int                         batchCount);
 
-// hpr2
-HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* y,
-                                            int                   incy,
-                                            hipblasComplex*       AP);
+// her
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher(hipblasHandle_t       handle,
+                                           hipblasFillMode_t     uplo,
+                                           int                   n,
+                                           const float*          alpha,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasComplex*       A,
+                                           int                   lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    hpr2 performs the matrix-vector operations
+    her performs the matrix-vector operations
 
-        A := A + alpha*x*y**H + conj(alpha)*y*x**H
+        A := A + alpha*x*x**H
 
-    where alpha is a complex scalar, x and y are vectors, and A is an
-    n by n Hermitian matrix, supplied in packed form.
+    where alpha is a real scalar, x is a vector, and A is an
+    n by n Hermitian matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -5626,8 +6075,8 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
     @param[in]
     uplo      [hipblasFillMode_t]
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied in A.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied in A.
     @param[in]
     n         [int]
               the number of rows and columns of matrix A, must be at least 0.
@@ -5639,70 +6088,50 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
     @param[in]
     incx      [int]
               specifies the increment for the elements of x.
-    @param[in]
-    y         device pointer storing vector y.
-    @param[in]
-    incy      [int]
-              specifies the increment for the elements of y.
     @param[inout]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+    A         device pointer storing the specified triangular portion of
+              the Hermitian matrix A. Of size (lda * n).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The upper triangular portion of the Hermitian matrix A is supplied. The lower
+                triangluar portion will not be touched.
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of the Hermitian matrix A is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The lower triangular portion of the Hermitian matrix A is supplied. The upper
+                triangular portion will not be touched.
             Note that the imaginary part of the diagonal elements are not accessed and are assumed
             to be 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. Must be at least max(1, n).
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
-                                            int                         n,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            const hipblasDoubleComplex* y,
-                                            int                         incy,
-                                            hipblasDoubleComplex*       AP);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int                         n,
+                                           const double*               alpha,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasDoubleComplex*       A,
+                                           int                         lda);
 
-// hpr2Batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex* const y[],
-                                                   int                         incy,
-                                                   hipblasComplex* const       AP[],
-                                                   int                         batchCount);
+// herBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherBatched(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  const float*                alpha,
+                                                  const hipblasComplex* const x[],
+                                                  int                         incx,
+                                                  hipblasComplex* const       A[],
+                                                  int                         lda,
+                                                  int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    hpr2Batched performs the matrix-vector operations
+    herBatched performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+        A_i := A_i + alpha*x_i*x_i**H
 
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+    where alpha is a real scalar, x_i is a vector, and A_i is an
+    n by n symmetric matrix, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -5710,8 +6139,8 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             h
     @param[in]
     uplo      [hipblasFillMode_t]
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in A.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in A.
     @param[in]
     n         [int]
               the number of rows and columns of each matrix A_i, must be at least 0.
@@ -5723,77 +6152,56 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             h
     @param[in]
     incx      [int]
               specifies the increment for the elements of each x_i.
-    @param[in]
-    y         device array of device pointers storing each vector y_i.
-    @param[in]
-    incy      [int]
-              specifies the increment for the elements of each y_i.
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
+    A         device array of device pointers storing the specified triangular portion of
               each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular portion
+                of each A_i will not be touched.
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular portion
+                of each A_i will not be touched.
             Note that the imaginary part of the diagonal elements are not accessed and are assumed
             to be 0.
     @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. Must be at least max(1, n).
+    @param[in]
     batchCount [int]
                 number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex* const y[],
-                                                   int                               incy,
-                                                   hipblasDoubleComplex* const       AP[],
-                                                   int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
+                                                  hipblasFillMode_t                 uplo,
+                                                  int                               n,
+                                                  const double*                     alpha,
+                                                  const hipblasDoubleComplex* const x[],
+                                                  int                               incx,
+                                                  hipblasDoubleComplex* const       A[],
+                                                  int                               lda,
+                                                  int                               batchCount);
 
-// hpr2StridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          hipblasComplex*       AP,
-                                                          hipblasStride         strideAP,
-                                                          int                   batchCount);
+// herStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       handle,
+                                                         hipblasFillMode_t     uplo,
+                                                         int                   n,
+                                                         const float*          alpha,
+                                                         const hipblasComplex* x,
+                                                         int                   incx,
+                                                         hipblasStride         stridex,
+                                                         hipblasComplex*       A,
+                                                         int                   lda,
+                                                         hipblasStride         strideA,
+                                                         int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    hpr2StridedBatched performs the matrix-vector operations
+    herStridedBatched performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
+        A_i := A_i + alpha*x_i*x_i**H
 
-    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
-    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+    where alpha is a real scalar, x_i is a vector, and A_i is an
+    n by n Hermitian matrix, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -5801,8 +6209,8 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t
     @param[in]
     uplo      [hipblasFillMode_t]
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
-              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in A.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in A.
     @param[in]
     n         [int]
               the number of rows and columns of each matrix A_i, must be at least 0.
@@ -5817,85 +6225,60 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t
     @param[in]
     stridex  [hipblasStride]
               stride from the start of one vector (x_i) and the next one (x_i+1).
-    @param[in]
-    y         device pointer pointing to the first vector (y_1).
-    @param[in]
-    incy      [int]
-              specifies the increment for the elements of each y_i.
-    @param[in]
-    stridey  [hipblasStride]
-              stride from the start of one vector (y_i) and the next one (y_i+1).
     @param[inout]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
+    A         device array of device pointers storing the specified triangular portion of
               each Hermitian matrix A_i. Points to the first matrix (A_1).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(0,1)
-                AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
+                portion of each A_i will not be touched.
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each Hermitian matrix A_i is supplied.
-                The matrix is compacted so that AP contains the triangular portion column-by-column
-                so that:
-                AP(0) = A(0,0)
-                AP(1) = A(1,0)
-                AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
-                        (1, 0) (2, 1) (4,9)
-                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
-                        (4,-9) (5,-3) (6,0)
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
+                portion of each A_i will not be touched.
             Note that the imaginary part of the diagonal elements are not accessed and are assumed
             to be 0.
     @param[in]
-    strideAP    [hipblasStride]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA    [hipblasStride]
                 stride from the start of one (A_i) and the next (A_i+1)
     @param[in]
     batchCount [int]
                 number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          hipblasDoubleComplex*       AP,
-                                                          hipblasStride               strideAP,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const double*               alpha,
+                                                         const hipblasDoubleComplex* x,
+                                                         int                         incx,
+                                                         hipblasStride               stridex,
+                                                         hipblasDoubleComplex*       A,
+                                                         int                         lda,
+                                                         hipblasStride               strideA,
+                                                         int                         batchCount);
 
-// sbmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            int               k,
-                                            const float*      alpha,
-                                            const float*      A,
-                                            int               lda,
-                                            const float*      x,
-                                            int               incx,
-                                            const float*      beta,
-                                            float*            y,
-                                            int               incy);
+// her2
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* y,
+                                            int                   incy,
+                                            hipblasComplex*       A,
+                                            int                   lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    sbmv performs the matrix-vector operation:
+    her2 performs the matrix-vector operations
 
-        y := alpha*A*x + beta*y,
+        A := A + alpha*x*y**H + conj(alpha)*y*x**H
 
-    where alpha and beta are scalars, x and y are n element vectors and
-    A should contain an upper or lower triangular n by n symmetric banded matrix.
+    where alpha is a complex scalar, x and y are vectors, and A is an
+    n by n Hermitian matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -5903,474 +6286,509 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
     @param[in]
     uplo      [hipblasFillMode_t]
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied.
     @param[in]
     n         [int]
-    @param[in]
-    k         [int]
-              specifies the number of sub- and super-diagonals
+              the number of rows and columns of matrix A, must be at least 0.
     @param[in]
     alpha
-              specifies the scalar alpha
-    @param[in]
-    A         pointer storing matrix A on the GPU
-    @param[in]
-    lda       [int]
-              specifies the leading dimension of matrix A
+              device pointer or host pointer to scalar alpha.
     @param[in]
-    x         pointer storing vector x on the GPU
+    x         device pointer storing vector x.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of x
+              specifies the increment for the elements of x.
     @param[in]
-    beta      specifies the scalar beta
-    @param[out]
-    y         pointer storing vector y on the GPU
+    y         device pointer storing vector y.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of y
-
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         device pointer storing the specified triangular portion of
+              the Hermitian matrix A. Of size (lda, n).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of the Hermitian matrix A is supplied. The lower triangular
+                portion of A will not be touched.
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of the Hermitian matrix A is supplied. The upper triangular
+                portion of A will not be touched.
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. Must be at least max(lda, 1).
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            int               k,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            int               lda,
-                                            const double*     x,
-                                            int               incx,
-                                            const double*     beta,
-                                            double*           y,
-                                            int               incy);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            const hipblasDoubleComplex* y,
+                                            int                         incy,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda);
 
-// sbmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
-                                                   hipblasFillMode_t  uplo,
-                                                   int                n,
-                                                   int                k,
-                                                   const float*       alpha,
-                                                   const float* const A[],
-                                                   int                lda,
-                                                   const float* const x[],
-                                                   int                incx,
-                                                   const float*       beta,
-                                                   float*             y[],
-                                                   int                incy,
-                                                   int                batchCount);
+// her2Batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex* const y[],
+                                                   int                         incy,
+                                                   hipblasComplex* const       A[],
+                                                   int                         lda,
+                                                   int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    sbmvBatched performs the matrix-vector operation:
+    her2Batched performs the matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i,
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    n by n symmetric banded matrix, for i = 1, ..., batchCount.
-    A should contain an upper or lower triangular n by n symmetric banded matrix.
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
+    n by n Hermitian matrix for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
-              handle to the hipblas library context queue
+              handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied.
     @param[in]
     n         [int]
-              number of rows and columns of each matrix A_i
-    @param[in]
-    k         [int]
-              specifies the number of sub- and super-diagonals
+              the number of rows and columns of each matrix A_i, must be at least 0.
     @param[in]
     alpha
-              device pointer or host pointer to scalar alpha
-    @param[in]
-    A         device array of device pointers storing each matrix A_i
-    @param[in]
-    lda       [int]
-              specifies the leading dimension of each matrix A_i
+              device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device array of device pointers storing each vector x_i
+    x         device array of device pointers storing each vector x_i.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each vector x_i
+              specifies the increment for the elements of x.
     @param[in]
-    beta      device pointer or host pointer to scalar beta
-    @param[out]
-    y         device array of device pointers storing each vector y_i
+    y         device array of device pointers storing each vector y_i.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of each vector y_i
+              specifies the increment for the elements of each y_i.
+    @param[inout]
+    A         device array of device pointers storing the specified triangular portion of
+              each Hermitian matrix A_i of size (lda, n).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
+                portion of each A_i will not be touched.
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
+                portion of each A_i will not be touched.
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
     @param[in]
     batchCount [int]
-                number of instances in the batch
-
+                number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   int                 n,
-                                                   int                 k,
-                                                   const double*       alpha,
-                                                   const double* const A[],
-                                                   int                 lda,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   const double*       beta,
-                                                   double*             y[],
-                                                   int                 incy,
-                                                   int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex* const y[],
+                                                   int                               incy,
+                                                   hipblasDoubleComplex* const       A[],
+                                                   int                               lda,
+                                                   int                               batchCount);
 
-// sbmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          int               k,
-                                                          const float*      alpha,
-                                                          const float*      A,
-                                                          int               lda,
-                                                          hipblasStride     strideA,
-                                                          const float*      x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const float*      beta,
-                                                          float*            y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          int               batchCount);
+// her2StridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          hipblasComplex*       A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    sbmvStridedBatched performs the matrix-vector operation:
+    her2StridedBatched performs the matrix-vector operations
 
-        y_i := alpha*A_i*x_i + beta*y_i,
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    n by n symmetric banded matrix, for i = 1, ..., batchCount.
-    A should contain an upper or lower triangular n by n symmetric banded matrix.
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
+    n by n Hermitian matrix for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
-              handle to the hipblas library context queue
+              handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied.
     @param[in]
     n         [int]
-              number of rows and columns of each matrix A_i
-    @param[in]
-    k         [int]
-              specifies the number of sub- and super-diagonals
+              the number of rows and columns of each matrix A_i, must be at least 0.
     @param[in]
     alpha
-              device pointer or host pointer to scalar alpha
-    @param[in]
-    A         Device pointer to the first matrix A_1 on the GPU
-    @param[in]
-    lda       [int]
-              specifies the leading dimension of each matrix A_i
-    @param[in]
-    strideA     [hipblasStride]
-                stride from the start of one matrix (A_i) and the next one (A_i+1)
+              device pointer or host pointer to scalar alpha.
     @param[in]
-    x         Device pointer to the first vector x_1 on the GPU
+    x         device pointer pointing to the first vector x_1.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each vector x_i
+              specifies the increment for the elements of each x_i.
     @param[in]
-    stridex     [hipblasStride]
-                stride from the start of one vector (x_i) and the next one (x_i+1).
-                There are no restrictions placed on stridex, however the user should
-                take care to ensure that stridex is of appropriate size.
-                This typically means stridex >= n * incx. stridex should be non zero.
+    stridex  [hipblasStride]
+              specifies the stride between the beginning of one vector (x_i) and the next (x_i+1).
     @param[in]
-    beta      device pointer or host pointer to scalar beta
-    @param[out]
-    y         Device pointer to the first vector y_1 on the GPU
+    y         device pointer pointing to the first vector y_i.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of each vector y_i
+              specifies the increment for the elements of each y_i.
     @param[in]
-    stridey     [hipblasStride]
-                stride from the start of one vector (y_i) and the next one (y_i+1).
-                There are no restrictions placed on stridey, however the user should
-                take care to ensure that stridey is of appropriate size.
-                This typically means stridey >= n * incy. stridey should be non zero.
+    stridey  [hipblasStride]
+              specifies the stride between the beginning of one vector (y_i) and the next (y_i+1).
+    @param[inout]
+    A         device pointer pointing to the first matrix (A_1). Stores the specified triangular portion of
+              each Hermitian matrix A_i.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of each Hermitian matrix A_i is supplied. The lower triangular
+                portion of each A_i will not be touched.
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of each Hermitian matrix A_i is supplied. The upper triangular
+                portion of each A_i will not be touched.
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. Must be at least max(lda, 1).
+    @param[in]
+    strideA  [hipblasStride]
+              specifies the stride between the beginning of one matrix (A_i) and the next (A_i+1).
     @param[in]
     batchCount [int]
-                number of instances in the batch
-
+                number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          int               k,
-                                                          const double*     alpha,
-                                                          const double*     A,
-                                                          int               lda,
-                                                          hipblasStride     strideA,
-                                                          const double*     x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const double*     beta,
-                                                          double*           y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          int               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          hipblasDoubleComplex*       A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          int                         batchCount);
 
-// spmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            const float*      alpha,
-                                            const float*      AP,
-                                            const float*      x,
-                                            int               incx,
-                                            const float*      beta,
-                                            float*            y,
-                                            int               incy);
+// hpmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmv(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* AP,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    spmv performs the matrix-vector operation:
+    hpmv performs the matrix-vector operation
 
-        y := alpha*A*x + beta*y,
+        y := alpha*A*x + beta*y
 
-    where alpha and beta are scalars, x and y are n element vectors and
-    A should contain an upper or lower triangular n by n packed symmetric matrix.
+    where alpha and beta are scalars, x and y are n element vectors and A is an
+    n by n Hermitian matrix, supplied in packed form (see description below).
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of the Hermitian matrix A is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of the Hermitian matrix A is supplied in AP.
     @param[in]
     n         [int]
+              the order of the matrix A, must be >= 0.
     @param[in]
-    alpha
-              specifies the scalar alpha
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         pointer storing matrix A on the GPU
+    AP        device pointer storing the packed version of the specified triangular portion of
+              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of the Hermitian matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
     @param[in]
-    x         pointer storing vector x on the GPU
+    x         device pointer storing vector x.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of x
+              specifies the increment for the elements of x.
     @param[in]
-    beta      specifies the scalar beta
-    @param[out]
-    y         pointer storing vector y on the GPU
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device pointer storing vector y.
     @param[in]
     incy      [int]
-              specifies the increment for the elements of y
+              specifies the increment for the elements of y.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            const double*     alpha,
-                                            const double*     AP,
-                                            const double*     x,
-                                            int               incx,
-                                            const double*     beta,
-                                            double*           y,
-                                            int               incy);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmv(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* AP,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       y,
+                                            int                         incy);
 
-// TODO: Complex
-// spmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
-                                                   hipblasFillMode_t  uplo,
-                                                   int                n,
-                                                   const float*       alpha,
-                                                   const float* const AP[],
-                                                   const float* const x[],
-                                                   int                incx,
-                                                   const float*       beta,
-                                                   float*             y[],
-                                                   int                incy,
-                                                   int                batchCount);
+// hpmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const AP[],
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       y[],
+                                                   int                         incy,
+                                                   int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    spmvBatched performs the matrix-vector operation:
+    hpmvBatched performs the matrix-vector operation
 
-        y_i := alpha*A_i*x_i + beta*y_i,
+        y_i := alpha*A_i*x_i + beta*y_i
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    n by n symmetric matrix, for i = 1, ..., batchCount.
-    A should contain an upper or lower triangular n by n packed symmetric matrix.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, supplied in packed form (see description below),
+    for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
-              handle to the hipblas library context queue
+              handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
     @param[in]
     n         [int]
-              number of rows and columns of each matrix A_i
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha
-    @param[in]
-    A         device array of device pointers storing each matrix A_i
-    @param[in]
-    x         device array of device pointers storing each vector x_i
-    @param[in]
-    incx      [int]
-              specifies the increment for the elements of each vector x_i
-    @param[in]
-    beta      device pointer or host pointer to scalar beta
-    @param[out]
-    y         device array of device pointers storing each vector y_i
+              the order of each matrix A_i.
     @param[in]
-    incy      [int]
-              specifies the increment for the elements of each vector y_i
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    batchCount [int]
-                number of instances in the batch
-
+    AP      device pointer of device pointers storing the packed version of the specified triangular
+            portion of each Hermitian matrix A_i. Each A_i is of at least size ((n * (n + 1)) / 2).
+            if uplo == HIPBLAS_FILL_MODE_UPPER:
+            The upper triangular portion of each Hermitian matrix A_i is supplied.
+            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+            so that:
+            AP(0) = A(0,0)
+            AP(1) = A(0,1)
+            AP(2) = A(1,1), etc.
+                Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                    (1, 0) (2, 1) (3, 2)
+                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
+                    (3,-2) (5, 1) (6, 0)
+        if uplo == HIPBLAS_FILL_MODE_LOWER:
+            The lower triangular portion of each Hermitian matrix A_i is supplied.
+            The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+            so that:
+            AP(0) = A(0,0)
+            AP(1) = A(1,0)
+            AP(2) = A(2,1), etc.
+                Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                    (1, 0) (2, 1) (3, 2)
+                    (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
+                    (3,-2) (5, 1) (6, 0)
+        Note that the imaginary part of the diagonal elements are not accessed and are assumed
+        to be 0.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   int                 n,
-                                                   const double*       alpha,
-                                                   const double* const AP[],
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   const double*       beta,
-                                                   double*             y[],
-                                                   int                 incy,
-                                                   int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const AP[],
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex* const       y[],
+                                                   int                               incy,
+                                                   int                               batchCount);
 
-// spmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          const float*      alpha,
-                                                          const float*      AP,
-                                                          hipblasStride     strideAP,
-                                                          const float*      x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const float*      beta,
-                                                          float*            y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          int               batchCount);
+// hpmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* AP,
+                                                          hipblasStride         strideAP,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    spmvStridedBatched performs the matrix-vector operation:
+    hpmvStridedBatched performs the matrix-vector operation
 
-        y_i := alpha*A_i*x_i + beta*y_i,
+        y_i := alpha*A_i*x_i + beta*y_i
 
-    where (A_i, x_i, y_i) is the i-th instance of the batch.
-    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    n by n symmetric matrix, for i = 1, ..., batchCount.
-    A should contain an upper or lower triangular n by n packed symmetric matrix.
+    where alpha and beta are scalars, x_i and y_i are n element vectors and A_i is an
+    n by n Hermitian matrix, supplied in packed form (see description below),
+    for each batch in i = [1, batchCount].
 
     @param[in]
     handle    [hipblasHandle_t]
-              handle to the hipblas library context queue
+              handle to the hipblas library context queue.
     @param[in]
     uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+              HIPBLAS_FILL_MODE_UPPER: the upper triangular part of each Hermitian matrix A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: the lower triangular part of each Hermitian matrix A_i is supplied in AP.
     @param[in]
     n         [int]
-              number of rows and columns of each matrix A_i
+              the order of each matrix A_i.
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha
+    alpha     device pointer or host pointer to scalar alpha.
     @param[in]
-    A         Device pointer to the first matrix A_1 on the GPU
+    AP        device pointer pointing to the beginning of the first matrix (AP_1). Stores the packed
+              version of the specified triangular portion of each Hermitian matrix AP_i of size ((n * (n + 1)) / 2).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,1), (4,0), (3,2), (5,-1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
+                The matrix is compacted so that each AP_i contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (3, 2)
+                        (2,-1) (4, 0) (5,-1)    -----> [(1,0), (2,-1), (3,-2), (4,0), (5,1), (6,0)]
+                        (3,-2) (5, 1) (6, 0)
+        Note that the imaginary part of the diagonal elements are not accessed and are assumed
+        to be 0.
     @param[in]
-    strideA     [hipblasStride]
-                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    strideA  [hipblasStride]
+              stride from the start of one matrix (AP_i) and the next one (AP_i+1).
     @param[in]
-    x         Device pointer to the first vector x_1 on the GPU
+    x         device array pointing to the beginning of the first vector (x_1).
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each vector x_i
+              specifies the increment for the elements of each x_i.
     @param[in]
-    stridex     [hipblasStride]
-                stride from the start of one vector (x_i) and the next one (x_i+1).
-                There are no restrictions placed on stridex, however the user should
-                take care to ensure that stridex is of appropriate size.
-                This typically means stridex >= n * incx. stridex should be non zero.
+    stridex  [hipblasStride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
     @param[in]
-    beta      device pointer or host pointer to scalar beta
-    @param[out]
-    y         Device pointer to the first vector y_1 on the GPU
+    beta      device pointer or host pointer to scalar beta.
+    @param[inout]
+    y         device array pointing to the beginning of the first vector (y_1).
     @param[in]
     incy      [int]
-              specifies the increment for the elements of each vector y_i
+              specifies the increment for the elements of y.
     @param[in]
-    stridey     [hipblasStride]
-                stride from the start of one vector (y_i) and the next one (y_i+1).
-                There are no restrictions placed on stridey, however the user should
-                take care to ensure that stridey is of appropriate size.
-                This typically means stridey >= n * incy. stridey should be non zero.
+    stridey  [hipblasStride]
+              stride from the start of one vector (y_i) and the next one (y_i+1).
     @param[in]
     batchCount [int]
-                number of instances in the batch
+                number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          const double*     alpha,
-                                                          const double*     AP,
-                                                          hipblasStride     strideAP,
-                                                          const double*     x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const double*     beta,
-                                                          double*           y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          int               batchCount);
-
-// spr
-HIPBLAS_EXPORT hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
-                                           hipblasFillMode_t uplo,
-                                           int               n,
-                                           const float*      alpha,
-                                           const float*      x,
-                                           int               incx,
-                                           float*            AP);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
-                                           hipblasFillMode_t uplo,
-                                           int               n,
-                                           const double*     alpha,
-                                           const double*     x,
-                                           int               incx,
-                                           double*           AP);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* AP,
+                                                          hipblasStride               strideAP,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
+// hpr
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr(hipblasHandle_t       handle,
                                            hipblasFillMode_t     uplo,
                                            int                   n,
-                                           const hipblasComplex* alpha,
+                                           const float*          alpha,
                                            const hipblasComplex* x,
                                            int                   incx,
                                            hipblasComplex*       AP);
@@ -6378,12 +6796,12 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    spr performs the matrix-vector operations
+    hpr performs the matrix-vector operations
 
-        A := A + alpha*x*x**T
+        A := A + alpha*x*x**H
 
-    where alpha is a scalar, x is a vector, and A is an
-    n by n symmetric matrix, supplied in packed form.
+    where alpha is a real scalar, x is a vector, and A is an
+    n by n Hermitian matrix, supplied in packed form.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -6406,63 +6824,45 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
               specifies the increment for the elements of x.
     @param[inout]
     AP        device pointer storing the packed version of the specified triangular portion of
-              the symmetric matrix A. Of at least size ((n * (n + 1)) / 2).
+              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of the symmetric matrix A is supplied.
+                The upper triangular portion of the Hermitian matrix A is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(0,1)
                 AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
-                        1 2 4 7
-                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        4 5 6 9
-                        7 8 9 0
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of the symmetric matrix A is supplied.
+                The lower triangular portion of the Hermitian matrix A is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(1,0)
                 AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
-                        1 2 3 4
-                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        3 6 8 9
-                        4 7 9 0
-    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr(hipblasHandle_t             handle,
                                            hipblasFillMode_t           uplo,
                                            int                         n,
-                                           const hipblasDoubleComplex* alpha,
+                                           const double*               alpha,
                                            const hipblasDoubleComplex* x,
                                            int                         incx,
                                            hipblasDoubleComplex*       AP);
 
-// sprBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
-                                                  hipblasFillMode_t  uplo,
-                                                  int                n,
-                                                  const float*       alpha,
-                                                  const float* const x[],
-                                                  int                incx,
-                                                  float* const       AP[],
-                                                  int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
-                                                  hipblasFillMode_t   uplo,
-                                                  int                 n,
-                                                  const double*       alpha,
-                                                  const double* const x[],
-                                                  int                 incx,
-                                                  double* const       AP[],
-                                                  int                 batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
+// hprBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
                                                   hipblasFillMode_t           uplo,
                                                   int                         n,
-                                                  const hipblasComplex*       alpha,
+                                                  const float*                alpha,
                                                   const hipblasComplex* const x[],
                                                   int                         incx,
                                                   hipblasComplex* const       AP[],
@@ -6471,11 +6871,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             ha
 /*! \brief BLAS Level 2 API
 
     \details
-    sprBatched performs the matrix-vector operations
+    hprBatched performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**T
+        A_i := A_i + alpha*x_i*x_i**H
 
-    where alpha is a scalar, x_i is a vector, and A_i is an
+    where alpha is a real scalar, x_i is a vector, and A_i is an
     n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
 
     @param[in]
@@ -6499,71 +6899,49 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             ha
               specifies the increment for the elements of each x_i.
     @param[inout]
     AP        device array of device pointers storing the packed version of the specified triangular portion of
-              each symmetric matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
+              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(0,1)
                 AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
-                        1 2 4 7
-                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        4 5 6 9
-                        7 8 9 0
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(1,0)
                 AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
-                        1 2 3 4
-                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        3 6 8 9
-                        4 7 9 0
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
     @param[in]
     batchCount [int]
                 number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                                   hipblasFillMode_t                 uplo,
                                                   int                               n,
-                                                  const hipblasDoubleComplex*       alpha,
+                                                  const double*                     alpha,
                                                   const hipblasDoubleComplex* const x[],
                                                   int                               incx,
                                                   hipblasDoubleComplex* const       AP[],
                                                   int                               batchCount);
 
-// sprStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
-                                                         hipblasFillMode_t uplo,
-                                                         int               n,
-                                                         const float*      alpha,
-                                                         const float*      x,
-                                                         int               incx,
-                                                         hipblasStride     stridex,
-                                                         float*            AP,
-                                                         hipblasStride     strideAP,
-                                                         int               batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
-                                                         hipblasFillMode_t uplo,
-                                                         int               n,
-                                                         const double*     alpha,
-                                                         const double*     x,
-                                                         int               incx,
-                                                         hipblasStride     stridex,
-                                                         double*           AP,
-                                                         hipblasStride     strideAP,
-                                                         int               batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
+// hprStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
                                                          hipblasFillMode_t     uplo,
                                                          int                   n,
-                                                         const hipblasComplex* alpha,
+                                                         const float*          alpha,
                                                          const hipblasComplex* x,
                                                          int                   incx,
                                                          hipblasStride         stridex,
@@ -6574,11 +6952,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       h
 /*! \brief BLAS Level 2 API
 
     \details
-    sprStridedBatched performs the matrix-vector operations
+    hprStridedBatched performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*x_i**T
+        A_i := A_i + alpha*x_i*x_i**H
 
-    where alpha is a scalar, x_i is a vector, and A_i is an
+    where alpha is a real scalar, x_i is a vector, and A_i is an
     n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
 
     @param[in]
@@ -6604,43 +6982,43 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       h
     stridex  [hipblasStride]
               stride from the start of one vector (x_i) and the next one (x_i+1).
     @param[inout]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              each symmetric matrix A_i. Points to the first A_1.
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each Hermitian matrix A_i. Points to the first matrix (A_1).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(0,1)
                 AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
-                        1 2 4 7
-                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        4 5 6 9
-                        7 8 9 0
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(1,0)
                 AP(2) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
-                        1 2 3 4
-                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        3 6 8 9
-                        4 7 9 0
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
     @param[in]
-    strideA    [hipblasStride]
+    strideAP   [hipblasStride]
                 stride from the start of one (A_i) and the next (A_i+1)
     @param[in]
     batchCount [int]
                 number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                                          hipblasFillMode_t           uplo,
                                                          int                         n,
-                                                         const hipblasDoubleComplex* alpha,
+                                                         const double*               alpha,
                                                          const hipblasDoubleComplex* x,
                                                          int                         incx,
                                                          hipblasStride               stridex,
@@ -6648,26 +7026,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t
                                                          hipblasStride               strideAP,
                                                          int                         batchCount);
 
-// spr2
-HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            const float*      alpha,
-                                            const float*      x,
-                                            int               incx,
-                                            const float*      y,
-                                            int               incy,
-                                            float*            AP);
+// hpr2
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* y,
+                                            int                   incy,
+                                            hipblasComplex*       AP);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    spr2 performs the matrix-vector operation
+    hpr2 performs the matrix-vector operations
 
-        A := A + alpha*x*y**T + alpha*y*x**T
+        A := A + alpha*x*y**H + conj(alpha)*y*x**H
 
-    where alpha is a scalar, x and y are vectors, and A is an
-    n by n symmetric matrix, supplied in packed form.
+    where alpha is a complex scalar, x and y are vectors, and A is an
+    n by n Hermitian matrix, supplied in packed form.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -6695,62 +7073,62 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
               specifies the increment for the elements of y.
     @param[inout]
     AP        device pointer storing the packed version of the specified triangular portion of
-              the symmetric matrix A. Of at least size ((n * (n + 1)) / 2).
+              the Hermitian matrix A. Of at least size ((n * (n + 1)) / 2).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of the symmetric matrix A is supplied.
+                The upper triangular portion of the Hermitian matrix A is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(0,1)
                 AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
-                        1 2 4 7
-                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        4 5 6 9
-                        7 8 9 0
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of the symmetric matrix A is supplied.
+                The lower triangular portion of the Hermitian matrix A is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(1,0)
-                AP(n) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
-                        1 2 3 4
-                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        3 6 8 9
-                        4 7 9 0
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            const double*     alpha,
-                                            const double*     x,
-                                            int               incx,
-                                            const double*     y,
-                                            int               incy,
-                                            double*           AP);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            const hipblasDoubleComplex* y,
+                                            int                         incy,
+                                            hipblasDoubleComplex*       AP);
 
-// spr2Batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
-                                                   hipblasFillMode_t  uplo,
-                                                   int                n,
-                                                   const float*       alpha,
-                                                   const float* const x[],
-                                                   int                incx,
-                                                   const float* const y[],
-                                                   int                incy,
-                                                   float* const       AP[],
-                                                   int                batchCount);
+// hpr2Batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex* const y[],
+                                                   int                         incy,
+                                                   hipblasComplex* const       AP[],
+                                                   int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    spr2Batched performs the matrix-vector operation
+    hpr2Batched performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
 
-    where alpha is a scalar, x_i and y_i are vectors, and A_i is an
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
     n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
 
     @param[in]
@@ -6779,69 +7157,69 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
               specifies the increment for the elements of each y_i.
     @param[inout]
     AP        device array of device pointers storing the packed version of the specified triangular portion of
-              each symmetric matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
+              each Hermitian matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(0,1)
                 AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
-                        1 2 4 7
-                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        4 5 6 9
-                        7 8 9 0
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(1,0)
-                AP(n) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
-                        1 2 3 4
-                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        3 6 8 9
-                        4 7 9 0
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
     @param[in]
     batchCount [int]
                 number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   int                 n,
-                                                   const double*       alpha,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   const double* const y[],
-                                                   int                 incy,
-                                                   double* const       AP[],
-                                                   int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex* const y[],
+                                                   int                               incy,
+                                                   hipblasDoubleComplex* const       AP[],
+                                                   int                               batchCount);
 
-// spr2StridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          const float*      alpha,
-                                                          const float*      x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const float*      y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          float*            AP,
-                                                          hipblasStride     strideAP,
-                                                          int               batchCount);
+// hpr2StridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          hipblasComplex*       AP,
+                                                          hipblasStride         strideAP,
+                                                          int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    spr2StridedBatched performs the matrix-vector operation
+    hpr2StridedBatched performs the matrix-vector operations
 
-        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T
+        A_i := A_i + alpha*x_i*y_i**H + conj(alpha)*y_i*x_i**H
 
-    where alpha is a scalar, x_i amd y_i are vectors, and A_i is an
+    where alpha is a complex scalar, x_i and y_i are vectors, and A_i is an
     n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
 
     @param[in]
@@ -6875,57 +7253,58 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   hand
     stridey  [hipblasStride]
               stride from the start of one vector (y_i) and the next one (y_i+1).
     @param[inout]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              each symmetric matrix A_i. Points to the first A_1.
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each Hermitian matrix A_i. Points to the first matrix (A_1).
               if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The upper triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(0,1)
                 AP(2) = A(1,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
-                        1 2 4 7
-                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        4 5 6 9
-                        7 8 9 0
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,1), (3,0), (4,9), (5,3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
             if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The lower triangular portion of each Hermitian matrix A_i is supplied.
                 The matrix is compacted so that AP contains the triangular portion column-by-column
                 so that:
                 AP(0) = A(0,0)
                 AP(1) = A(1,0)
-                AP(n) = A(2,1), etc.
-                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
-                        1 2 3 4
-                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                        3 6 8 9
-                        4 7 9 0
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 3)
+                        (1, 0) (2, 1) (4,9)
+                        (2,-1) (3, 0) (5,3)  -----> [(1,0), (2,-1), (4,-9), (3,0), (5,-3), (6,0)]
+                        (4,-9) (5,-3) (6,0)
+            Note that the imaginary part of the diagonal elements are not accessed and are assumed
+            to be 0.
     @param[in]
-    strideA    [hipblasStride]
+    strideAP    [hipblasStride]
                 stride from the start of one (A_i) and the next (A_i+1)
     @param[in]
     batchCount [int]
                 number of instances in the batch.
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          const double*     alpha,
-                                                          const double*     x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const double*     y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          double*           AP,
-                                                          hipblasStride     strideAP,
-                                                          int               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          hipblasDoubleComplex*       AP,
+                                                          hipblasStride               strideAP,
+                                                          int                         batchCount);
 
-// symv
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
+// sbmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmv(hipblasHandle_t   handle,
                                             hipblasFillMode_t uplo,
                                             int               n,
+                                            int               k,
                                             const float*      alpha,
                                             const float*      A,
                                             int               lda,
@@ -6935,39 +7314,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
                                             float*            y,
                                             int               incy);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            const double*     alpha,
-                                            const double*     A,
-                                            int               lda,
-                                            const double*     x,
-                                            int               incx,
-                                            const double*     beta,
-                                            double*           y,
-                                            int               incy);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       y,
-                                            int                   incy);
-
 /*! \brief BLAS Level 2 API
 
     \details
-    symv performs the matrix-vector operation:
+    sbmv performs the matrix-vector operation:
 
         y := alpha*A*x + beta*y,
 
     where alpha and beta are scalars, x and y are n element vectors and
-    A should contain an upper or lower triangular n by n symmetric matrix.
+    A should contain an upper or lower triangular n by n symmetric banded matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -6980,13 +7335,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
     @param[in]
     n         [int]
     @param[in]
+    k         [int]
+              specifies the number of sub- and super-diagonals
+    @param[in]
     alpha
               specifies the scalar alpha
     @param[in]
     A         pointer storing matrix A on the GPU
     @param[in]
     lda       [int]
-              specifies the leading dimension of A
+              specifies the leading dimension of matrix A
     @param[in]
     x         pointer storing vector x on the GPU
     @param[in]
@@ -7001,22 +7359,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
               specifies the increment for the elements of y
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
-                                            int                         n,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* A,
-                                            int                         lda,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            const hipblasDoubleComplex* beta,
-                                            hipblasDoubleComplex*       y,
-                                            int                         incy);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmv(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            int               k,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            int               lda,
+                                            const double*     x,
+                                            int               incx,
+                                            const double*     beta,
+                                            double*           y,
+                                            int               incy);
 
-// symvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
+// sbmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                                    hipblasFillMode_t  uplo,
                                                    int                n,
+                                                   int                k,
                                                    const float*       alpha,
                                                    const float* const A[],
                                                    int                lda,
@@ -7027,44 +7387,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   int                 n,
-                                                   const double*       alpha,
-                                                   const double* const A[],
-                                                   int                 lda,
-                                                   const double* const x[],
-                                                   int                 incx,
-                                                   const double*       beta,
-                                                   double*             y[],
-                                                   int                 incy,
-                                                   int                 batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const x[],
-                                                   int                         incx,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex*             y[],
-                                                   int                         incy,
-                                                   int                         batchCount);
-
 /*! \brief BLAS Level 2 API
 
     \details
-    symvBatched performs the matrix-vector operation:
+    sbmvBatched performs the matrix-vector operation:
 
         y_i := alpha*A_i*x_i + beta*y_i,
 
     where (A_i, x_i, y_i) is the i-th instance of the batch.
     alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    n by n symmetric matrix, for i = 1, ..., batchCount.
-    A a should contain an upper or lower triangular symmetric matrix
-    and the opposing triangular part of A is not referenced
+    n by n symmetric banded matrix, for i = 1, ..., batchCount.
+    A should contain an upper or lower triangular n by n symmetric banded matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -7078,6 +7411,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             h
     n         [int]
               number of rows and columns of each matrix A_i
     @param[in]
+    k         [int]
+              specifies the number of sub- and super-diagonals
+    @param[in]
     alpha
               device pointer or host pointer to scalar alpha
     @param[in]
@@ -7102,23 +7438,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             h
                 number of instances in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const A[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex* const x[],
-                                                   int                               incx,
-                                                   const hipblasDoubleComplex*       beta,
-                                                   hipblasDoubleComplex*             y[],
-                                                   int                               incy,
-                                                   int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double*       beta,
+                                                   double*             y[],
+                                                   int                 incy,
+                                                   int                 batchCount);
 
-// symvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
+// sbmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
                                                           hipblasFillMode_t uplo,
                                                           int               n,
+                                                          int               k,
                                                           const float*      alpha,
                                                           const float*      A,
                                                           int               lda,
@@ -7132,50 +7470,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     stridey,
                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          const double*     alpha,
-                                                          const double*     A,
-                                                          int               lda,
-                                                          hipblasStride     strideA,
-                                                          const double*     x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const double*     beta,
-                                                          double*           y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          int               batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          int                   batchCount);
-
 /*! \brief BLAS Level 2 API
 
     \details
-    symvStridedBatched performs the matrix-vector operation:
+    sbmvStridedBatched performs the matrix-vector operation:
 
         y_i := alpha*A_i*x_i + beta*y_i,
 
     where (A_i, x_i, y_i) is the i-th instance of the batch.
     alpha and beta are scalars, x_i and y_i are vectors and A_i is an
-    n by n symmetric matrix, for i = 1, ..., batchCount.
-    A a should contain an upper or lower triangular symmetric matrix
-    and the opposing triangular part of A is not referenced
+    n by n symmetric banded matrix, for i = 1, ..., batchCount.
+    A should contain an upper or lower triangular n by n symmetric banded matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -7189,6 +7494,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t
     n         [int]
               number of rows and columns of each matrix A_i
     @param[in]
+    k         [int]
+              specifies the number of sub- and super-diagonals
+    @param[in]
     alpha
               device pointer or host pointer to scalar alpha
     @param[in]
@@ -7228,59 +7536,44 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t
                 number of instances in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          const hipblasDoubleComplex* x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* beta,
-                                                          hipblasDoubleComplex*       y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          int                         batchCount);
-
-// syr
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
-                                           hipblasFillMode_t uplo,
-                                           int               n,
-                                           const float*      alpha,
-                                           const float*      x,
-                                           int               incx,
-                                           float*            A,
-                                           int               lda);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
-                                           hipblasFillMode_t uplo,
-                                           int               n,
-                                           const double*     alpha,
-                                           const double*     x,
-                                           int               incx,
-                                           double*           A,
-                                           int               lda);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          int               k,
+                                                          const double*     alpha,
+                                                          const double*     A,
+                                                          int               lda,
+                                                          hipblasStride     strideA,
+                                                          const double*     x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const double*     beta,
+                                                          double*           y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
-                                           hipblasFillMode_t     uplo,
-                                           int                   n,
-                                           const hipblasComplex* alpha,
-                                           const hipblasComplex* x,
-                                           int                   incx,
-                                           hipblasComplex*       A,
-                                           int                   lda);
+// spmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmv(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      alpha,
+                                            const float*      AP,
+                                            const float*      x,
+                                            int               incx,
+                                            const float*      beta,
+                                            float*            y,
+                                            int               incy);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    syr performs the matrix-vector operations
+    spmv performs the matrix-vector operation:
 
-        A := A + alpha*x*x**T
+        y := alpha*A*x + beta*y,
 
-    where alpha is a scalar, x is a vector, and A is an
-    n by n symmetric matrix.
+    where alpha and beta are scalars, x and y are n element vectors and
+    A should contain an upper or lower triangular n by n packed symmetric matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -7290,78 +7583,67 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
               if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
               if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
-
     @param[in]
     n         [int]
-              the number of rows and columns of matrix A.
     @param[in]
     alpha
-              device pointer or host pointer to scalar alpha.
+              specifies the scalar alpha
     @param[in]
-    x         device pointer storing vector x.
+    A         pointer storing matrix A on the GPU
+    @param[in]
+    x         pointer storing vector x on the GPU
     @param[in]
     incx      [int]
-              specifies the increment for the elements of x.
-    @param[inout]
-    A         device pointer storing matrix A.
+              specifies the increment for the elements of x
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A.
+    beta      specifies the scalar beta
+    @param[out]
+    y         pointer storing vector y on the GPU
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
-                                           hipblasFillMode_t           uplo,
-                                           int                         n,
-                                           const hipblasDoubleComplex* alpha,
-                                           const hipblasDoubleComplex* x,
-                                           int                         incx,
-                                           hipblasDoubleComplex*       A,
-                                           int                         lda);
-
-// syrBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
-                                                  hipblasFillMode_t  uplo,
-                                                  int                n,
-                                                  const float*       alpha,
-                                                  const float* const x[],
-                                                  int                incx,
-                                                  float* const       A[],
-                                                  int                lda,
-                                                  int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
-                                                  hipblasFillMode_t   uplo,
-                                                  int                 n,
-                                                  const double*       alpha,
-                                                  const double* const x[],
-                                                  int                 incx,
-                                                  double* const       A[],
-                                                  int                 lda,
-                                                  int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmv(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     alpha,
+                                            const double*     AP,
+                                            const double*     x,
+                                            int               incx,
+                                            const double*     beta,
+                                            double*           y,
+                                            int               incy);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
-                                                  hipblasFillMode_t           uplo,
-                                                  int                         n,
-                                                  const hipblasComplex*       alpha,
-                                                  const hipblasComplex* const x[],
-                                                  int                         incx,
-                                                  hipblasComplex* const       A[],
-                                                  int                         lda,
-                                                  int                         batchCount);
+// TODO: Complex
+// spmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float* const AP[],
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float*       beta,
+                                                   float*             y[],
+                                                   int                incy,
+                                                   int                batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    syrBatched performs a batch of matrix-vector operations
+    spmvBatched performs the matrix-vector operation:
 
-        A[i] := A[i] + alpha*x[i]*x[i]**T
+        y_i := alpha*A_i*x_i + beta*y_i,
 
-    where alpha is a scalar, x is an array of vectors, and A is an array of
-    n by n symmetric matrices, for i = 1 , ... , batchCount
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    n by n symmetric matrix, for i = 1, ..., batchCount.
+    A should contain an upper or lower triangular n by n packed symmetric matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+              handle to the hipblas library context queue
     @param[in]
     uplo      [hipblasFillMode_t]
               specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
@@ -7369,39 +7651,1184 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             ha
               if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
     @param[in]
     n         [int]
-              the number of rows and columns of matrix A.
+              number of rows and columns of each matrix A_i
     @param[in]
     alpha
-              device pointer or host pointer to scalar alpha.
+              device pointer or host pointer to scalar alpha
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    A         device array of device pointers storing each matrix A_i
+    @param[in]
+    x         device array of device pointers storing each vector x_i
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each x_i.
-    @param[inout]
-    A         device array of device pointers storing each matrix A_i.
+              specifies the increment for the elements of each vector x_i
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
+    beta      device pointer or host pointer to scalar beta
+    @param[out]
+    y         device array of device pointers storing each vector y_i
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each vector y_i
     @param[in]
     batchCount [int]
                 number of instances in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
-                                                  hipblasFillMode_t                 uplo,
-                                                  int                               n,
-                                                  const hipblasDoubleComplex*       alpha,
-                                                  const hipblasDoubleComplex* const x[],
-                                                  int                               incx,
-                                                  hipblasDoubleComplex* const       A[],
-                                                  int                               lda,
-                                                  int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const AP[],
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double*       beta,
+                                                   double*             y[],
+                                                   int                 incy,
+                                                   int                 batchCount);
 
-// syrStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
-                                                         hipblasFillMode_t uplo,
-                                                         int               n,
+// spmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const float*      alpha,
+                                                          const float*      AP,
+                                                          hipblasStride     strideAP,
+                                                          const float*      x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const float*      beta,
+                                                          float*            y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          int               batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    spmvStridedBatched performs the matrix-vector operation:
+
+        y_i := alpha*A_i*x_i + beta*y_i,
+
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    n by n symmetric matrix, for i = 1, ..., batchCount.
+    A should contain an upper or lower triangular n by n packed symmetric matrix.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+              number of rows and columns of each matrix A_i
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha
+    @param[in]
+    A         Device pointer to the first matrix A_1 on the GPU
+    @param[in]
+    strideA     [hipblasStride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    x         Device pointer to the first vector x_1 on the GPU
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each vector x_i
+    @param[in]
+    stridex     [hipblasStride]
+                stride from the start of one vector (x_i) and the next one (x_i+1).
+                There are no restrictions placed on stridex, however the user should
+                take care to ensure that stridex is of appropriate size.
+                This typically means stridex >= n * incx. stridex should be non zero.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta
+    @param[out]
+    y         Device pointer to the first vector y_1 on the GPU
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each vector y_i
+    @param[in]
+    stridey     [hipblasStride]
+                stride from the start of one vector (y_i) and the next one (y_i+1).
+                There are no restrictions placed on stridey, however the user should
+                take care to ensure that stridey is of appropriate size.
+                This typically means stridey >= n * incy. stridey should be non zero.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const double*     alpha,
+                                                          const double*     AP,
+                                                          hipblasStride     strideAP,
+                                                          const double*     x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const double*     beta,
+                                                          double*           y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          int               batchCount);
+
+// spr
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const float*      alpha,
+                                           const float*      x,
+                                           int               incx,
+                                           float*            AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const double*     alpha,
+                                           const double*     x,
+                                           int               incx,
+                                           double*           AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCspr(hipblasHandle_t       handle,
+                                           hipblasFillMode_t     uplo,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasComplex*       AP);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    spr performs the matrix-vector operations
+
+        A := A + alpha*x*x**T
+
+    where alpha is a scalar, x is a vector, and A is an
+    n by n symmetric matrix, supplied in packed form.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied in AP.
+    @param[in]
+    n         [int]
+              the number of rows and columns of matrix A, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              the symmetric matrix A. Of at least size ((n * (n + 1)) / 2).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of the symmetric matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
+                        1 2 4 7
+                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        4 5 6 9
+                        7 8 9 0
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of the symmetric matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
+                        1 2 3 4
+                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        3 6 8 9
+                        4 7 9 0
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZspr(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasDoubleComplex*       AP);
+
+// sprBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
+                                                  hipblasFillMode_t  uplo,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float* const x[],
+                                                  int                incx,
+                                                  float* const       AP[],
+                                                  int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
+                                                  hipblasFillMode_t   uplo,
+                                                  int                 n,
+                                                  const double*       alpha,
+                                                  const double* const x[],
+                                                  int                 incx,
+                                                  double* const       AP[],
+                                                  int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  const hipblasComplex*       alpha,
+                                                  const hipblasComplex* const x[],
+                                                  int                         incx,
+                                                  hipblasComplex* const       AP[],
+                                                  int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    sprBatched performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*x_i**T
+
+    where alpha is a scalar, x_i is a vector, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[inout]
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each symmetric matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
+                        1 2 4 7
+                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        4 5 6 9
+                        7 8 9 0
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
+                        1 2 3 4
+                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        3 6 8 9
+                        4 7 9 0
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsprBatched(hipblasHandle_t                   handle,
+                                                  hipblasFillMode_t                 uplo,
+                                                  int                               n,
+                                                  const hipblasDoubleComplex*       alpha,
+                                                  const hipblasDoubleComplex* const x[],
+                                                  int                               incx,
+                                                  hipblasDoubleComplex* const       AP[],
+                                                  int                               batchCount);
+
+// sprStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
+                                                         hipblasFillMode_t uplo,
+                                                         int               n,
+                                                         const float*      alpha,
+                                                         const float*      x,
+                                                         int               incx,
+                                                         hipblasStride     stridex,
+                                                         float*            AP,
+                                                         hipblasStride     strideAP,
+                                                         int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
+                                                         hipblasFillMode_t uplo,
+                                                         int               n,
+                                                         const double*     alpha,
+                                                         const double*     x,
+                                                         int               incx,
+                                                         hipblasStride     stridex,
+                                                         double*           AP,
+                                                         hipblasStride     strideAP,
+                                                         int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
+                                                         hipblasFillMode_t     uplo,
+                                                         int                   n,
+                                                         const hipblasComplex* alpha,
+                                                         const hipblasComplex* x,
+                                                         int                   incx,
+                                                         hipblasStride         stridex,
+                                                         hipblasComplex*       AP,
+                                                         hipblasStride         strideAP,
+                                                         int                   batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    sprStridedBatched performs the matrix-vector operations
+
+        A_i := A_i + alpha*x_i*x_i**T
+
+    where alpha is a scalar, x_i is a vector, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer pointing to the first vector (x_1).
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex  [hipblasStride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[inout]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              each symmetric matrix A_i. Points to the first A_1.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
+                        1 2 4 7
+                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        4 5 6 9
+                        7 8 9 0
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(2) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
+                        1 2 3 4
+                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        3 6 8 9
+                        4 7 9 0
+    @param[in]
+    strideA    [hipblasStride]
+                stride from the start of one (A_i) and the next (A_i+1)
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsprStridedBatched(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const hipblasDoubleComplex* alpha,
+                                                         const hipblasDoubleComplex* x,
+                                                         int                         incx,
+                                                         hipblasStride               stridex,
+                                                         hipblasDoubleComplex*       AP,
+                                                         hipblasStride               strideAP,
+                                                         int                         batchCount);
+
+// spr2
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      alpha,
+                                            const float*      x,
+                                            int               incx,
+                                            const float*      y,
+                                            int               incy,
+                                            float*            AP);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    spr2 performs the matrix-vector operation
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are vectors, and A is an
+    n by n symmetric matrix, supplied in packed form.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of A is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of A is supplied in AP.
+    @param[in]
+    n         [int]
+              the number of rows and columns of matrix A, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              the symmetric matrix A. Of at least size ((n * (n + 1)) / 2).
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of the symmetric matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
+                        1 2 4 7
+                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        4 5 6 9
+                        7 8 9 0
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of the symmetric matrix A is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(n) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
+                        1 2 3 4
+                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        3 6 8 9
+                        4 7 9 0
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     alpha,
+                                            const double*     x,
+                                            int               incx,
+                                            const double*     y,
+                                            int               incy,
+                                            double*           AP);
+
+// spr2Batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float* const y[],
+                                                   int                incy,
+                                                   float* const       AP[],
+                                                   int                batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    spr2Batched performs the matrix-vector operation
+
+        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T
+
+    where alpha is a scalar, x_i and y_i are vectors, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each y_i.
+    @param[inout]
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each symmetric matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batchCount.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
+                        1 2 4 7
+                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        4 5 6 9
+                        7 8 9 0
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(n) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
+                        1 2 3 4
+                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        3 6 8 9
+                        4 7 9 0
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double* const y[],
+                                                   int                 incy,
+                                                   double* const       AP[],
+                                                   int                 batchCount);
+
+// spr2StridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const float*      alpha,
+                                                          const float*      x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const float*      y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          float*            AP,
+                                                          hipblasStride     strideAP,
+                                                          int               batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    spr2StridedBatched performs the matrix-vector operation
+
+        A_i := A_i + alpha*x_i*y_i**T + alpha*y_i*x_i**T
+
+    where alpha is a scalar, x_i amd y_i are vectors, and A_i is an
+    n by n symmetric matrix, supplied in packed form, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              HIPBLAS_FILL_MODE_UPPER: The upper triangular part of each A_i is supplied in AP.
+              HIPBLAS_FILL_MODE_LOWER: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [int]
+              the number of rows and columns of each matrix A_i, must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer pointing to the first vector (x_1).
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex  [hipblasStride]
+              stride from the start of one vector (x_i) and the next one (x_i+1).
+    @param[in]
+    y         device pointer pointing to the first vector (y_1).
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey  [hipblasStride]
+              stride from the start of one vector (y_i) and the next one (y_i+1).
+    @param[inout]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              each symmetric matrix A_i. Points to the first A_1.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The upper triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(0,1)
+                AP(2) = A(1,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_UPPER; n = 4)
+                        1 2 4 7
+                        2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        4 5 6 9
+                        7 8 9 0
+            if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The lower triangular portion of each symmetric matrix A_i is supplied.
+                The matrix is compacted so that AP contains the triangular portion column-by-column
+                so that:
+                AP(0) = A(0,0)
+                AP(1) = A(1,0)
+                AP(n) = A(2,1), etc.
+                    Ex: (HIPBLAS_FILL_MODE_LOWER; n = 4)
+                        1 2 3 4
+                        2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                        3 6 8 9
+                        4 7 9 0
+    @param[in]
+    strideA    [hipblasStride]
+                stride from the start of one (A_i) and the next (A_i+1)
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const double*     alpha,
+                                                          const double*     x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const double*     y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          double*           AP,
+                                                          hipblasStride     strideAP,
+                                                          int               batchCount);
+
+// symv
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymv(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            int               lda,
+                                            const float*      x,
+                                            int               incx,
+                                            const float*      beta,
+                                            float*            y,
+                                            int               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymv(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            int               lda,
+                                            const double*     x,
+                                            int               incx,
+                                            const double*     beta,
+                                            double*           y,
+                                            int               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymv(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    symv performs the matrix-vector operation:
+
+        y := alpha*A*x + beta*y,
+
+    where alpha and beta are scalars, x and y are n element vectors and
+    A should contain an upper or lower triangular n by n symmetric matrix.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+    @param[in]
+    alpha
+              specifies the scalar alpha
+    @param[in]
+    A         pointer storing matrix A on the GPU
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A
+    @param[in]
+    x         pointer storing vector x on the GPU
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x
+    @param[in]
+    beta      specifies the scalar beta
+    @param[out]
+    y         pointer storing vector y on the GPU
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymv(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       y,
+                                            int                         incy);
+
+// symvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float*       beta,
+                                                   float*             y[],
+                                                   int                incy,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double*       beta,
+                                                   double*             y[],
+                                                   int                 incy,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex*             y[],
+                                                   int                         incy,
+                                                   int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    symvBatched performs the matrix-vector operation:
+
+        y_i := alpha*A_i*x_i + beta*y_i,
+
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    n by n symmetric matrix, for i = 1, ..., batchCount.
+    A a should contain an upper or lower triangular symmetric matrix
+    and the opposing triangular part of A is not referenced
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+              number of rows and columns of each matrix A_i
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha
+    @param[in]
+    A         device array of device pointers storing each matrix A_i
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each matrix A_i
+    @param[in]
+    x         device array of device pointers storing each vector x_i
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each vector x_i
+    @param[in]
+    beta      device pointer or host pointer to scalar beta
+    @param[out]
+    y         device array of device pointers storing each vector y_i
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each vector y_i
+    @param[in]
+    batchCount [int]
+                number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex*             y[],
+                                                   int                               incy,
+                                                   int                               batchCount);
+
+// symvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const float*      alpha,
+                                                          const float*      A,
+                                                          int               lda,
+                                                          hipblasStride     strideA,
+                                                          const float*      x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const float*      beta,
+                                                          float*            y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const double*     alpha,
+                                                          const double*     A,
+                                                          int               lda,
+                                                          hipblasStride     strideA,
+                                                          const double*     x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const double*     beta,
+                                                          double*           y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          int                   batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    symvStridedBatched performs the matrix-vector operation:
+
+        y_i := alpha*A_i*x_i + beta*y_i,
+
+    where (A_i, x_i, y_i) is the i-th instance of the batch.
+    alpha and beta are scalars, x_i and y_i are vectors and A_i is an
+    n by n symmetric matrix, for i = 1, ..., batchCount.
+    A a should contain an upper or lower triangular symmetric matrix
+    and the opposing triangular part of A is not referenced
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+              number of rows and columns of each matrix A_i
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha
+    @param[in]
+    A         Device pointer to the first matrix A_1 on the GPU
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each matrix A_i
+    @param[in]
+    strideA     [hipblasStride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    x         Device pointer to the first vector x_1 on the GPU
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each vector x_i
+    @param[in]
+    stridex     [hipblasStride]
+                stride from the start of one vector (x_i) and the next one (x_i+1).
+                There are no restrictions placed on stridex, however the user should
+                take care to ensure that stridex is of appropriate size.
+                This typically means stridex >= n * incx. stridex should be non zero.
+    @param[in]
+    beta      device pointer or host pointer to scalar beta
+    @param[out]
+    y         Device pointer to the first vector y_1 on the GPU
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each vector y_i
+    @param[in]
+    stridey     [hipblasStride]
+                stride from the start of one vector (y_i) and the next one (y_i+1).
+                There are no restrictions placed on stridey, however the user should
+                take care to ensure that stridey is of appropriate size.
+                This typically means stridey >= n * incy. stridey should be non zero.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          int                         batchCount);
+
+// syr
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const float*      alpha,
+                                           const float*      x,
+                                           int               incx,
+                                           float*            A,
+                                           int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               n,
+                                           const double*     alpha,
+                                           const double*     x,
+                                           int               incx,
+                                           double*           A,
+                                           int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr(hipblasHandle_t       handle,
+                                           hipblasFillMode_t     uplo,
+                                           int                   n,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* x,
+                                           int                   incx,
+                                           hipblasComplex*       A,
+                                           int                   lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    syr performs the matrix-vector operations
+
+        A := A + alpha*x*x**T
+
+    where alpha is a scalar, x is a vector, and A is an
+    n by n symmetric matrix.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+
+    @param[in]
+    n         [int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* x,
+                                           int                         incx,
+                                           hipblasDoubleComplex*       A,
+                                           int                         lda);
+
+// syrBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
+                                                  hipblasFillMode_t  uplo,
+                                                  int                n,
+                                                  const float*       alpha,
+                                                  const float* const x[],
+                                                  int                incx,
+                                                  float* const       A[],
+                                                  int                lda,
+                                                  int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
+                                                  hipblasFillMode_t   uplo,
+                                                  int                 n,
+                                                  const double*       alpha,
+                                                  const double* const x[],
+                                                  int                 incx,
+                                                  double* const       A[],
+                                                  int                 lda,
+                                                  int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  int                         n,
+                                                  const hipblasComplex*       alpha,
+                                                  const hipblasComplex* const x[],
+                                                  int                         incx,
+                                                  hipblasComplex* const       A[],
+                                                  int                         lda,
+                                                  int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    syrBatched performs a batch of matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*x[i]**T
+
+    where alpha is a scalar, x is an array of vectors, and A is an array of
+    n by n symmetric matrices, for i = 1 , ... , batchCount
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[inout]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
+                                                  hipblasFillMode_t                 uplo,
+                                                  int                               n,
+                                                  const hipblasDoubleComplex*       alpha,
+                                                  const hipblasDoubleComplex* const x[],
+                                                  int                               incx,
+                                                  hipblasDoubleComplex* const       A[],
+                                                  int                               lda,
+                                                  int                               batchCount);
+
+// syrStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
+                                                         hipblasFillMode_t uplo,
+                                                         int               n,
                                                          const float*      alpha,
                                                          const float*      x,
                                                          int               incx,
@@ -7411,410 +8838,1704 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handl
                                                          hipblasStride     stridey,
                                                          int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
-                                                         hipblasFillMode_t uplo,
-                                                         int               n,
-                                                         const double*     alpha,
-                                                         const double*     x,
-                                                         int               incx,
-                                                         hipblasStride     stridex,
-                                                         double*           A,
-                                                         int               lda,
-                                                         hipblasStride     stridey,
-                                                         int               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
+                                                         hipblasFillMode_t uplo,
+                                                         int               n,
+                                                         const double*     alpha,
+                                                         const double*     x,
+                                                         int               incx,
+                                                         hipblasStride     stridex,
+                                                         double*           A,
+                                                         int               lda,
+                                                         hipblasStride     stridey,
+                                                         int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
+                                                         hipblasFillMode_t     uplo,
+                                                         int                   n,
+                                                         const hipblasComplex* alpha,
+                                                         const hipblasComplex* x,
+                                                         int                   incx,
+                                                         hipblasStride         stridex,
+                                                         hipblasComplex*       A,
+                                                         int                   lda,
+                                                         hipblasStride         stridey,
+                                                         int                   batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    syrStridedBatched performs the matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*x[i]**T
+
+    where alpha is a scalar, vectors, and A is an array of
+    n by n symmetric matrices, for i = 1 , ... , batchCount
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+              the number of rows and columns of each matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   [hipblasStride]
+              specifies the pointer increment between vectors (x_i) and (x_i+1).
+    @param[inout]
+    A         device pointer to the first matrix A_1.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batchCount [int]
+              number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         const hipblasDoubleComplex* alpha,
+                                                         const hipblasDoubleComplex* x,
+                                                         int                         incx,
+                                                         hipblasStride               stridex,
+                                                         hipblasDoubleComplex*       A,
+                                                         int                         lda,
+                                                         hipblasStride               stridey,
+                                                         int                         batchCount);
+
+// syr2
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      alpha,
+                                            const float*      x,
+                                            int               incx,
+                                            const float*      y,
+                                            int               incy,
+                                            float*            A,
+                                            int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     alpha,
+                                            const double*     x,
+                                            int               incx,
+                                            const double*     y,
+                                            int               incy,
+                                            double*           A,
+                                            int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            const hipblasComplex* y,
+                                            int                   incy,
+                                            hipblasComplex*       A,
+                                            int                   lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    syr2 performs the matrix-vector operations
+
+        A := A + alpha*x*y**T + alpha*y*x**T
+
+    where alpha is a scalar, x and y are vectors, and A is an
+    n by n symmetric matrix.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+
+    @param[in]
+    n         [int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            const hipblasDoubleComplex* y,
+                                            int                         incy,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda);
+
+// syr2Batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float* const y[],
+                                                   int                incy,
+                                                   float* const       A[],
+                                                   int                lda,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double* const y[],
+                                                   int                 incy,
+                                                   double* const       A[],
+                                                   int                 lda,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
+                                                   const hipblasComplex* const y[],
+                                                   int                         incy,
+                                                   hipblasComplex* const       A[],
+                                                   int                         lda,
+                                                   int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    syr2Batched performs a batch of matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
+
+    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
+    n by n symmetric matrix, for i = 1 , ... , batchCount
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    y         device array of device pointers storing each vector y_i.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each y_i.
+    @param[inout]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
+                                                   const hipblasDoubleComplex* const y[],
+                                                   int                               incy,
+                                                   hipblasDoubleComplex* const       A[],
+                                                   int                               lda,
+                                                   int                               batchCount);
+
+// syr2StridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const float*      alpha,
+                                                          const float*      x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const float*      y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          float*            A,
+                                                          int               lda,
+                                                          hipblasStride     strideA,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
+                                                          hipblasFillMode_t uplo,
+                                                          int               n,
+                                                          const double*     alpha,
+                                                          const double*     x,
+                                                          int               incx,
+                                                          hipblasStride     stridex,
+                                                          const double*     y,
+                                                          int               incy,
+                                                          hipblasStride     stridey,
+                                                          double*           A,
+                                                          int               lda,
+                                                          hipblasStride     strideA,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          const hipblasComplex* y,
+                                                          int                   incy,
+                                                          hipblasStride         stridey,
+                                                          hipblasComplex*       A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          int                   batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    syr2StridedBatched the matrix-vector operations
+
+        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
+
+    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
+    n by n symmetric matrices, for i = 1 , ... , batchCount
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
+              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
+              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    @param[in]
+    n         [int]
+              the number of rows and columns of each matrix A.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer to the first vector x_1.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex   [hipblasStride]
+              specifies the pointer increment between vectors (x_i) and (x_i+1).
+    @param[in]
+    y         device pointer to the first vector y_1.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of each y_i.
+    @param[in]
+    stridey   [hipblasStride]
+              specifies the pointer increment between vectors (y_i) and (y_i+1).
+    @param[inout]
+    A         device pointer to the first matrix A_1.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batchCount [int]
+              number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          const hipblasDoubleComplex* y,
+                                                          int                         incy,
+                                                          hipblasStride               stridey,
+                                                          hipblasDoubleComplex*       A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          int                         batchCount);
+
+// tbmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                k,
+                                            const float*       A,
+                                            int                lda,
+                                            float*             x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                k,
+                                            const double*      A,
+                                            int                lda,
+                                            double*            x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            int                   k,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasComplex*       x,
+                                            int                   incx);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tbmv performs one of the matrix-vector operations
+
+        x := A*x      or
+        x := A**T*x   or
+        x := A**H*x,
+
+    x is a vectors and A is a banded m by m matrix (see description below).
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER: A is an upper banded triangular matrix.
+              HIPBLAS_FILL_MODE_LOWER: A is a  lower banded triangular matrix.
+    @param[in]
+    trans     [hipblasOperation_t]
+              indicates whether matrix A is tranposed (conjugated) or not.
+    @param[in]
+    diag      [hipblasDiagType_t]
+              HIPBLAS_DIAG_UNIT: The main diagonal of A is assumed to consist of only
+                                     1's and is not referenced.
+              HIPBLAS_DIAG_NON_UNIT: No assumptions are made of A's main diagonal.
+    @param[in]
+    m         [int]
+              the number of rows and columns of the matrix represented by A.
+    @param[in]
+    k         [int]
+              if uplo == HIPBLAS_FILL_MODE_UPPER, k specifies the number of super-diagonals
+              of the matrix A.
+              if uplo == HIPBLAS_FILL_MODE_LOWER, k specifies the number of sub-diagonals
+              of the matrix A.
+              k must satisfy k > 0 && k < lda.
+    @param[in]
+    A         device pointer storing banded triangular matrix A.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The matrix represented is an upper banded triangular matrix
+                with the main diagonal and k super-diagonals, everything
+                else can be assumed to be 0.
+                The matrix is compacted so that the main diagonal resides on the k'th
+                row, the first super diagonal resides on the RHS of the k-1'th row, etc,
+                with the k'th diagonal on the RHS of the 0'th row.
+                   Ex: (HIPBLAS_FILL_MODE_UPPER; m = 5; k = 2)
+                      1 6 9 0 0              0 0 9 8 7
+                      0 2 7 8 0              0 6 7 8 9
+                      0 0 3 8 7     ---->    1 2 3 4 5
+                      0 0 0 4 9              0 0 0 0 0
+                      0 0 0 0 5              0 0 0 0 0
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The matrix represnted is a lower banded triangular matrix
+                with the main diagonal and k sub-diagonals, everything else can be
+                assumed to be 0.
+                The matrix is compacted so that the main diagonal resides on the 0'th row,
+                working up to the k'th diagonal residing on the LHS of the k'th row.
+                   Ex: (HIPBLAS_FILL_MODE_LOWER; m = 5; k = 2)
+                      1 0 0 0 0              1 2 3 4 5
+                      6 2 0 0 0              6 7 8 9 0
+                      9 7 3 0 0     ---->    9 8 7 0 0
+                      0 8 8 4 0              0 0 0 0 0
+                      0 0 7 9 5              0 0 0 0 0
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. lda must satisfy lda > k.
+    @param[inout]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            int                         k,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasDoubleComplex*       x,
+                                            int                         incx);
+
+// tbmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                m,
+                                                   int                k,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   float* const       x[],
+                                                   int                incx,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasDiagType_t   diag,
+                                                   int                 m,
+                                                   int                 k,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   double* const       x[],
+                                                   int                 incx,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         m,
+                                                   int                         k,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   hipblasComplex* const       x[],
+                                                   int                         incx,
+                                                   int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tbmvBatched performs one of the matrix-vector operations
+
+        x_i := A_i*x_i      or
+        x_i := A_i**T*x_i   or
+        x_i := A_i**H*x_i,
+
+    where (A_i, x_i) is the i-th instance of the batch.
+    x_i is a vector and A_i is an m by m matrix, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER: each A_i is an upper banded triangular matrix.
+              HIPBLAS_FILL_MODE_LOWER: each A_i is a  lower banded triangular matrix.
+    @param[in]
+    trans     [hipblasOperation_t]
+              indicates whether each matrix A_i is tranposed (conjugated) or not.
+    @param[in]
+    diag      [hipblasDiagType_t]
+              HIPBLAS_DIAG_UNIT: The main diagonal of each A_i is assumed to consist of only
+                                     1's and is not referenced.
+              HIPBLAS_DIAG_NON_UNIT: No assumptions are made of each A_i's main diagonal.
+    @param[in]
+    m         [int]
+              the number of rows and columns of the matrix represented by each A_i.
+    @param[in]
+    k         [int]
+              if uplo == HIPBLAS_FILL_MODE_UPPER, k specifies the number of super-diagonals
+              of each matrix A_i.
+              if uplo == HIPBLAS_FILL_MODE_LOWER, k specifies the number of sub-diagonals
+              of each matrix A_i.
+              k must satisfy k > 0 && k < lda.
+    @param[in]
+    A         device array of device pointers storing each banded triangular matrix A_i.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The matrix represented is an upper banded triangular matrix
+                with the main diagonal and k super-diagonals, everything
+                else can be assumed to be 0.
+                The matrix is compacted so that the main diagonal resides on the k'th
+                row, the first super diagonal resides on the RHS of the k-1'th row, etc,
+                with the k'th diagonal on the RHS of the 0'th row.
+                   Ex: (HIPBLAS_FILL_MODE_UPPER; m = 5; k = 2)
+                      1 6 9 0 0              0 0 9 8 7
+                      0 2 7 8 0              0 6 7 8 9
+                      0 0 3 8 7     ---->    1 2 3 4 5
+                      0 0 0 4 9              0 0 0 0 0
+                      0 0 0 0 5              0 0 0 0 0
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The matrix represnted is a lower banded triangular matrix
+                with the main diagonal and k sub-diagonals, everything else can be
+                assumed to be 0.
+                The matrix is compacted so that the main diagonal resides on the 0'th row,
+                working up to the k'th diagonal residing on the LHS of the k'th row.
+                   Ex: (HIPBLAS_FILL_MODE_LOWER; m = 5; k = 2)
+                      1 0 0 0 0              1 2 3 4 5
+                      6 2 0 0 0              6 7 8 9 0
+                      9 7 3 0 0     ---->    9 8 7 0 0
+                      0 8 8 4 0              0 0 0 0 0
+                      0 0 7 9 5              0 0 0 0 0
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. lda must satisfy lda > k.
+    @param[inout]
+    x         device array of device pointer storing each vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   hipblasOperation_t                transA,
+                                                   hipblasDiagType_t                 diag,
+                                                   int                               m,
+                                                   int                               k,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   hipblasDoubleComplex* const       x[],
+                                                   int                               incx,
+                                                   int                               batchCount);
+
+// tbmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          int                k,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          float*             x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          int                k,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          double*            x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   m,
+                                                          int                   k,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          hipblasComplex*       x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          int                   batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tbmvStridedBatched performs one of the matrix-vector operations
+
+        x_i := A_i*x_i      or
+        x_i := A_i**T*x_i   or
+        x_i := A_i**H*x_i,
+
+    where (A_i, x_i) is the i-th instance of the batch.
+    x_i is a vector and A_i is an m by m matrix, for i = 1, ..., batchCount.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER: each A_i is an upper banded triangular matrix.
+              HIPBLAS_FILL_MODE_LOWER: each A_i is a  lower banded triangular matrix.
+    @param[in]
+    trans     [hipblasOperation_t]
+              indicates whether each matrix A_i is tranposed (conjugated) or not.
+    @param[in]
+    diag      [hipblasDiagType_t]
+              HIPBLAS_DIAG_UNIT: The main diagonal of each A_i is assumed to consist of only
+                                     1's and is not referenced.
+              HIPBLAS_DIAG_NON_UNIT: No assumptions are made of each A_i's main diagonal.
+    @param[in]
+    m         [int]
+              the number of rows and columns of the matrix represented by each A_i.
+    @param[in]
+    k         [int]
+              if uplo == HIPBLAS_FILL_MODE_UPPER, k specifies the number of super-diagonals
+              of each matrix A_i.
+              if uplo == HIPBLAS_FILL_MODE_LOWER, k specifies the number of sub-diagonals
+              of each matrix A_i.
+              k must satisfy k > 0 && k < lda.
+    @param[in]
+    A         device array to the first matrix A_i of the batch. Stores each banded triangular matrix A_i.
+              if uplo == HIPBLAS_FILL_MODE_UPPER:
+                The matrix represented is an upper banded triangular matrix
+                with the main diagonal and k super-diagonals, everything
+                else can be assumed to be 0.
+                The matrix is compacted so that the main diagonal resides on the k'th
+                row, the first super diagonal resides on the RHS of the k-1'th row, etc,
+                with the k'th diagonal on the RHS of the 0'th row.
+                   Ex: (HIPBLAS_FILL_MODE_UPPER; m = 5; k = 2)
+                      1 6 9 0 0              0 0 9 8 7
+                      0 2 7 8 0              0 6 7 8 9
+                      0 0 3 8 7     ---->    1 2 3 4 5
+                      0 0 0 4 9              0 0 0 0 0
+                      0 0 0 0 5              0 0 0 0 0
+              if uplo == HIPBLAS_FILL_MODE_LOWER:
+                The matrix represnted is a lower banded triangular matrix
+                with the main diagonal and k sub-diagonals, everything else can be
+                assumed to be 0.
+                The matrix is compacted so that the main diagonal resides on the 0'th row,
+                working up to the k'th diagonal residing on the LHS of the k'th row.
+                   Ex: (HIPBLAS_FILL_MODE_LOWER; m = 5; k = 2)
+                      1 0 0 0 0              1 2 3 4 5
+                      6 2 0 0 0              6 7 8 9 0
+                      9 7 3 0 0     ---->    9 8 7 0 0
+                      0 8 8 4 0              0 0 0 0 0
+                      0 0 7 9 5              0 0 0 0 0
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i. lda must satisfy lda > k.
+    @param[in]
+    strideA  [hipblasStride]
+              stride from the start of one A_i matrix to the next A_(i + 1).
+    @param[inout]
+    x         device array to the first vector x_i of the batch.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex  [hipblasStride]
+              stride from the start of one x_i matrix to the next x_(i + 1).
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         m,
+                                                          int                         k,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          hipblasDoubleComplex*       x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          int                         batchCount);
+
+// tbsv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                n,
+                                            int                k,
+                                            const float*       A,
+                                            int                lda,
+                                            float*             x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                n,
+                                            int                k,
+                                            const double*      A,
+                                            int                lda,
+                                            double*            x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasComplex*       x,
+                                            int                   incx);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tbsv solves
+
+         A*x = b or A**T*x = b or A**H*x = b,
+
+    where x and b are vectors and A is a banded triangular matrix.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA     [hipblasOperation_t]
+               HIPBLAS_OP_N: Solves A*x = b
+               HIPBLAS_OP_T: Solves A**T*x = b
+               HIPBLAS_OP_C: Solves A**H*x = b
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular (i.e. the diagonal elements
+                                       of A are not used in computations).
+            HIPBLAS_DIAG_NON_UNIT: A is not assumed to be unit triangular.
+
+    @param[in]
+    n         [int]
+              n specifies the number of rows of b. n >= 0.
+    @param[in]
+    k         [int]
+              if(uplo == HIPBLAS_FILL_MODE_UPPER)
+                k specifies the number of super-diagonals of A.
+              if(uplo == HIPBLAS_FILL_MODE_LOWER)
+                k specifies the number of sub-diagonals of A.
+              k >= 0.
+
+    @param[in]
+    A         device pointer storing the matrix A in banded format.
+
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+              lda >= (k + 1).
+
+    @param[inout]
+    x         device pointer storing input vector b. Overwritten by the output vector x.
+
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasDoubleComplex*       x,
+                                            int                         incx);
+
+// tbsvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                n,
+                                                   int                k,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   float* const       x[],
+                                                   int                incx,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasDiagType_t   diag,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   double* const       x[],
+                                                   int                 incx,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   hipblasComplex* const       x[],
+                                                   int                         incx,
+                                                   int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tbsvBatched solves
+
+         A_i*x_i = b_i or A_i**T*x_i = b_i or A_i**H*x_i = b_i,
+
+    where x_i and b_i are vectors and A_i is a banded triangular matrix,
+    for i = [1, batchCount].
+
+    The input vectors b_i are overwritten by the output vectors x_i.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+
+    @param[in]
+    transA     [hipblasOperation_t]
+               HIPBLAS_OP_N: Solves A_i*x_i = b_i
+               HIPBLAS_OP_T: Solves A_i**T*x_i = b_i
+               HIPBLAS_OP_C: Solves A_i**H*x_i = b_i
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
+                                       of each A_i are not used in computations).
+            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
+
+    @param[in]
+    n         [int]
+              n specifies the number of rows of each b_i. n >= 0.
+    @param[in]
+    k         [int]
+              if(uplo == HIPBLAS_FILL_MODE_UPPER)
+                k specifies the number of super-diagonals of each A_i.
+              if(uplo == HIPBLAS_FILL_MODE_LOWER)
+                k specifies the number of sub-diagonals of each A_i.
+              k >= 0.
+
+    @param[in]
+    A         device vector of device pointers storing each matrix A_i in banded format.
+
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+              lda >= (k + 1).
+
+    @param[inout]
+    x         device vector of device pointers storing each input vector b_i. Overwritten by each output
+              vector x_i.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   hipblasOperation_t                transA,
+                                                   hipblasDiagType_t                 diag,
+                                                   int                               n,
+                                                   int                               k,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   hipblasDoubleComplex* const       x[],
+                                                   int                               incx,
+                                                   int                               batchCount);
+
+// tbsvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                n,
+                                                          int                k,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          float*             x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                n,
+                                                          int                k,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          hipblasStride      strideA,
+                                                          double*            x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          hipblasComplex*       x,
+                                                          int                   incx,
+                                                          hipblasStride         stridex,
+                                                          int                   batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tbsvStridedBatched solves
+
+         A_i*x_i = b_i or A_i**T*x_i = b_i or A_i**H*x_i = b_i,
+
+    where x_i and b_i are vectors and A_i is a banded triangular matrix,
+    for i = [1, batchCount].
+
+    The input vectors b_i are overwritten by the output vectors x_i.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+
+    @param[in]
+    transA     [hipblasOperation_t]
+               HIPBLAS_OP_N: Solves A_i*x_i = b_i
+               HIPBLAS_OP_T: Solves A_i**T*x_i = b_i
+               HIPBLAS_OP_C: Solves A_i**H*x_i = b_i
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
+                                       of each A_i are not used in computations).
+            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
+
+    @param[in]
+    n         [int]
+              n specifies the number of rows of each b_i. n >= 0.
+    @param[in]
+    k         [int]
+              if(uplo == HIPBLAS_FILL_MODE_UPPER)
+                k specifies the number of super-diagonals of each A_i.
+              if(uplo == HIPBLAS_FILL_MODE_LOWER)
+                k specifies the number of sub-diagonals of each A_i.
+              k >= 0.
+
+    @param[in]
+    A         device pointer pointing to the first banded matrix A_1.
+
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+              lda >= (k + 1).
+    @param[in]
+    strideA  [hipblasStride]
+              specifies the distance between the start of one matrix (A_i) and the next (A_i+1).
+
+    @param[inout]
+    x         device pointer pointing to the first input vector b_1. Overwritten by output vectors x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+    @param[in]
+    stridex  [hipblasStride]
+              specifies the distance between the start of one vector (x_i) and the next (x_i+1).
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         n,
+                                                          int                         k,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          hipblasDoubleComplex*       x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
-                                                         hipblasFillMode_t     uplo,
-                                                         int                   n,
-                                                         const hipblasComplex* alpha,
-                                                         const hipblasComplex* x,
-                                                         int                   incx,
-                                                         hipblasStride         stridex,
-                                                         hipblasComplex*       A,
-                                                         int                   lda,
-                                                         hipblasStride         stridey,
-                                                         int                   batchCount);
+// tpmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            const float*       AP,
+                                            float*             x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            const double*      AP,
+                                            double*            x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            const hipblasComplex* AP,
+                                            hipblasComplex*       x,
+                                            int                   incx);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tpmv performs one of the matrix-vector operations
+
+         x = A*x or x = A**T*x,
+
+    where x is an n element vector and A is an n by n unit, or non-unit, upper or lower triangular matrix, supplied in the pack form.
+
+    The vector x is overwritten.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA     [hipblasOperation_t]
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       [int]
+            m specifies the number of rows of A. m >= 0.
+
+    @param[in]
+    A       device pointer storing matrix A,
+            of dimension at leat ( m * ( m + 1 ) / 2 ).
+          Before entry with uplo = HIPBLAS_FILL_MODE_UPPER, the array A
+          must contain the upper triangular matrix packed sequentially,
+          column by column, so that A[0] contains a_{0,0}, A[1] and A[2] contain
+          a_{0,1} and a_{1, 1} respectively, and so on.
+          Before entry with uplo = HIPBLAS_FILL_MODE_LOWER, the array A
+          must contain the lower triangular matrix packed sequentially,
+          column by column, so that A[0] contains a_{0,0}, A[1] and A[2] contain
+          a_{1,0} and a_{2,0} respectively, and so on.
+          Note that when DIAG = HIPBLAS_DIAG_UNIT, the diagonal elements of A are
+          not referenced, but are assumed to be unity.
+
+    @param[in]
+    x       device pointer storing vector x.
+
+    @param[in]
+    incx    [int]
+            specifies the increment for the elements of x. incx must not be zero.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            const hipblasDoubleComplex* AP,
+                                            hipblasDoubleComplex*       x,
+                                            int                         incx);
+
+// tpmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                m,
+                                                   const float* const AP[],
+                                                   float* const       x[],
+                                                   int                incx,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasDiagType_t   diag,
+                                                   int                 m,
+                                                   const double* const AP[],
+                                                   double* const       x[],
+                                                   int                 incx,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         m,
+                                                   const hipblasComplex* const AP[],
+                                                   hipblasComplex* const       x[],
+                                                   int                         incx,
+                                                   int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tpmvBatched performs one of the matrix-vector operations
+
+         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
+
+    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
+
+    The vectors x_i are overwritten.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+
+    @param[in]
+    transA     [hipblasOperation_t]
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+
+    @param[in]
+    m         [int]
+              m specifies the number of rows of matrices A_i. m >= 0.
+
+    @param[in]
+    A         device pointer storing pointer of matrices A_i,
+              of dimension ( lda, m )
+
+    @param[in]
+    x         device pointer storing vectors x_i.
+
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of vectors x_i.
+
+    @param[in]
+    batchCount [int]
+              The number of batched matrices/vectors.
+
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   hipblasOperation_t                transA,
+                                                   hipblasDiagType_t                 diag,
+                                                   int                               m,
+                                                   const hipblasDoubleComplex* const AP[],
+                                                   hipblasDoubleComplex* const       x[],
+                                                   int                               incx,
+                                                   int                               batchCount);
+
+// tpmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          const float*       AP,
+                                                          hipblasStride      strideAP,
+                                                          float*             x,
+                                                          int                incx,
+                                                          hipblasStride      stride,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          const double*      AP,
+                                                          hipblasStride      strideAP,
+                                                          double*            x,
+                                                          int                incx,
+                                                          hipblasStride      stride,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   m,
+                                                          const hipblasComplex* AP,
+                                                          hipblasStride         strideAP,
+                                                          hipblasComplex*       x,
+                                                          int                   incx,
+                                                          hipblasStride         stride,
+                                                          int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    syrStridedBatched performs the matrix-vector operations
+    tpmvStridedBatched performs one of the matrix-vector operations
 
-        A[i] := A[i] + alpha*x[i]*x[i]**T
+         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
 
-    where alpha is a scalar, vectors, and A is an array of
-    n by n symmetric matrices, for i = 1 , ... , batchCount
+    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
+    with strides specifying how to retrieve $x_i$ (resp. $A_i$) from $x_{i-1}$ (resp. $A_i$).
+
+    The vectors x_i are overwritten.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+
     @param[in]
-    n         [int]
-              the number of rows and columns of each matrix A.
+    transA     [hipblasOperation_t]
+
     @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+
     @param[in]
-    x         device pointer to the first vector x_1.
+    m         [int]
+              m specifies the number of rows of matrices A_i. m >= 0.
+
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    A         device pointer of the matrix A_0,
+              of dimension ( lda, m )
+
     @param[in]
-    stridex   [hipblasStride]
-              specifies the pointer increment between vectors (x_i) and (x_i+1).
-    @param[inout]
-    A         device pointer to the first matrix A_1.
+    strideA  [hipblasStride]
+              stride from the start of one A_i matrix to the next A_{i + 1}
+
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
+    x         device pointer storing the vector x_0.
+
     @param[in]
-    strideA   [hipblasStride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    incx      [int]
+              specifies the increment for the elements of one vector x.
+
+    @param[in]
+    stridex  [hipblasStride]
+              stride from the start of one x_i vector to the next x_{i + 1}
+
     @param[in]
     batchCount [int]
-              number of instances in the batch
+              The number of batched matrices/vectors.
+
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
-                                                         hipblasFillMode_t           uplo,
-                                                         int                         n,
-                                                         const hipblasDoubleComplex* alpha,
-                                                         const hipblasDoubleComplex* x,
-                                                         int                         incx,
-                                                         hipblasStride               stridex,
-                                                         hipblasDoubleComplex*       A,
-                                                         int                         lda,
-                                                         hipblasStride               stridey,
-                                                         int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         m,
+                                                          const hipblasDoubleComplex* AP,
+                                                          hipblasStride               strideAP,
+                                                          hipblasDoubleComplex*       x,
+                                                          int                         incx,
+                                                          hipblasStride               stride,
+                                                          int                         batchCount);
 
-// syr2
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            const float*      alpha,
-                                            const float*      x,
-                                            int               incx,
-                                            const float*      y,
-                                            int               incy,
-                                            float*            A,
-                                            int               lda);
+// tpsv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            const float*       AP,
+                                            float*             x,
+                                            int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2(hipblasHandle_t   handle,
-                                            hipblasFillMode_t uplo,
-                                            int               n,
-                                            const double*     alpha,
-                                            const double*     x,
-                                            int               incx,
-                                            const double*     y,
-                                            int               incy,
-                                            double*           A,
-                                            int               lda);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            const double*      AP,
+                                            double*            x,
+                                            int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
-                                            int                   n,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* x,
-                                            int                   incx,
-                                            const hipblasComplex* y,
-                                            int                   incy,
-                                            hipblasComplex*       A,
-                                            int                   lda);
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            const hipblasComplex* AP,
+                                            hipblasComplex*       x,
+                                            int                   incx);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    syr2 performs the matrix-vector operations
+    tpsv solves
 
-        A := A + alpha*x*y**T + alpha*y*x**T
+         A*x = b or A**T*x = b, or A**H*x = b,
 
-    where alpha is a scalar, x and y are vectors, and A is an
-    n by n symmetric matrix.
+    where x and b are vectors and A is a triangular matrix stored in the packed format.
+
+    The input vector b is overwritten by the output vector x.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-    @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
 
     @param[in]
-    n         [int]
-              the number of rows and columns of matrix A.
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
     @param[in]
-    x         device pointer storing vector x.
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: Solves A*x = b
+            HIPBLAS_OP_T: Solves A**T*x = b
+            HIPBLAS_OP_C: Solves A**H*x = b
+
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of x.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular (i.e. the diagonal elements
+                                       of A are not used in computations).
+            HIPBLAS_DIAG_NON_UNIT: A is not assumed to be unit triangular.
+
     @param[in]
-    y         device pointer storing vector y.
+    n         [int]
+              n specifies the number of rows of b. n >= 0.
+
     @param[in]
-    incy      [int]
-              specifies the increment for the elements of y.
+    AP        device pointer storing the packed version of matrix A,
+              of dimension >= (n * (n + 1) / 2)
+
     @param[inout]
-    A         device pointer storing matrix A.
+    x         device pointer storing vector b on input, overwritten by x on output.
+
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A.
+    incx      [int]
+              specifies the increment for the elements of x.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
-                                            int                         n,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* x,
-                                            int                         incx,
-                                            const hipblasDoubleComplex* y,
-                                            int                         incy,
-                                            hipblasDoubleComplex*       A,
-                                            int                         lda);
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            const hipblasDoubleComplex* AP,
+                                            hipblasDoubleComplex*       x,
+                                            int                         incx);
 
-// syr2Batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
+// tpsvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                                    hipblasFillMode_t  uplo,
-                                                   int                n,
-                                                   const float*       alpha,
-                                                   const float* const x[],
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                m,
+                                                   const float* const AP[],
+                                                   float* const       x[],
                                                    int                incx,
-                                                   const float* const y[],
-                                                   int                incy,
-                                                   float* const       A[],
-                                                   int                lda,
                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
-                                                   int                 n,
-                                                   const double*       alpha,
-                                                   const double* const x[],
+                                                   hipblasOperation_t  transA,
+                                                   hipblasDiagType_t   diag,
+                                                   int                 m,
+                                                   const double* const AP[],
+                                                   double* const       x[],
                                                    int                 incx,
-                                                   const double* const y[],
-                                                   int                 incy,
-                                                   double* const       A[],
-                                                   int                 lda,
                                                    int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
-                                                   int                         n,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const x[],
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         m,
+                                                   const hipblasComplex* const AP[],
+                                                   hipblasComplex* const       x[],
                                                    int                         incx,
-                                                   const hipblasComplex* const y[],
-                                                   int                         incy,
-                                                   hipblasComplex* const       A[],
-                                                   int                         lda,
                                                    int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    syr2Batched performs a batch of matrix-vector operations
+    tpsvBatched solves
 
-        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
+         A_i*x_i = b_i or A_i**T*x_i = b_i, or A_i**H*x_i = b_i,
+
+    where x_i and b_i are vectors and A_i is a triangular matrix stored in the packed format,
+    for i in [1, batchCount].
 
-    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
-    n by n symmetric matrix, for i = 1 , ... , batchCount
+    The input vectors b_i are overwritten by the output vectors x_i.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
-    @param[in]
-    n         [int]
-              the number of rows and columns of matrix A.
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
+
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: Solves A*x = b
+            HIPBLAS_OP_T: Solves A**T*x = b
+            HIPBLAS_OP_C: Solves A**H*x = b
+
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
+                                       of each A_i are not used in computations).
+            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
+
     @param[in]
-    y         device array of device pointers storing each vector y_i.
+    n         [int]
+              n specifies the number of rows of each b_i. n >= 0.
+
     @param[in]
-    incy      [int]
-              specifies the increment for the elements of each y_i.
+    AP        device array of device pointers storing the packed versions of each matrix A_i,
+              of dimension >= (n * (n + 1) / 2)
+
     @param[inout]
-    A         device array of device pointers storing each matrix A_i.
+    x         device array of device pointers storing each input vector b_i, overwritten by x_i on output.
+
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
+    incx      [int]
+              specifies the increment for the elements of each x_i.
     @param[in]
     batchCount [int]
-                number of instances in the batch
+                specifies the number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
-                                                   int                               n,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const x[],
+                                                   hipblasOperation_t                transA,
+                                                   hipblasDiagType_t                 diag,
+                                                   int                               m,
+                                                   const hipblasDoubleComplex* const AP[],
+                                                   hipblasDoubleComplex* const       x[],
                                                    int                               incx,
-                                                   const hipblasDoubleComplex* const y[],
-                                                   int                               incy,
-                                                   hipblasDoubleComplex* const       A[],
-                                                   int                               lda,
                                                    int                               batchCount);
 
-// syr2StridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          const float*      alpha,
-                                                          const float*      x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const float*      y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          float*            A,
-                                                          int               lda,
-                                                          hipblasStride     strideA,
-                                                          int               batchCount);
+// tpsvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          const float*       AP,
+                                                          hipblasStride      strideAP,
+                                                          float*             x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
-                                                          hipblasFillMode_t uplo,
-                                                          int               n,
-                                                          const double*     alpha,
-                                                          const double*     x,
-                                                          int               incx,
-                                                          hipblasStride     stridex,
-                                                          const double*     y,
-                                                          int               incy,
-                                                          hipblasStride     stridey,
-                                                          double*           A,
-                                                          int               lda,
-                                                          hipblasStride     strideA,
-                                                          int               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          const double*      AP,
+                                                          hipblasStride      strideAP,
+                                                          double*            x,
+                                                          int                incx,
+                                                          hipblasStride      stridex,
+                                                          int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* x,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   m,
+                                                          const hipblasComplex* AP,
+                                                          hipblasStride         strideAP,
+                                                          hipblasComplex*       x,
                                                           int                   incx,
                                                           hipblasStride         stridex,
-                                                          const hipblasComplex* y,
-                                                          int                   incy,
-                                                          hipblasStride         stridey,
-                                                          hipblasComplex*       A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
                                                           int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    syr2StridedBatched the matrix-vector operations
+    tpsvStridedBatched solves
 
-        A[i] := A[i] + alpha*x[i]*y[i]**T + alpha*y[i]*x[i]**T
+         A_i*x_i = b_i or A_i**T*x_i = b_i, or A_i**H*x_i = b_i,
 
-    where alpha is a scalar, x[i] and y[i] are vectors, and A[i] is a
-    n by n symmetric matrices, for i = 1 , ... , batchCount
+    where x_i and b_i are vectors and A_i is a triangular matrix stored in the packed format,
+    for i in [1, batchCount].
+
+    The input vectors b_i are overwritten by the output vectors x_i.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
-    uplo      [hipblasFillMode_t]
-              specifies whether the upper 'HIPBLAS_FILL_MODE_UPPER' or lower 'HIPBLAS_FILL_MODE_LOWER'
-              if HIPBLAS_FILL_MODE_UPPER, the lower part of A is not referenced
-              if HIPBLAS_FILL_MODE_LOWER, the upper part of A is not referenced
-    @param[in]
-    n         [int]
-              the number of rows and columns of each matrix A.
-    @param[in]
-    alpha
-              device pointer or host pointer to scalar alpha.
-    @param[in]
-    x         device pointer to the first vector x_1.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
+
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: Solves A*x = b
+            HIPBLAS_OP_T: Solves A**T*x = b
+            HIPBLAS_OP_C: Solves A**H*x = b
+
     @param[in]
-    stridex   [hipblasStride]
-              specifies the pointer increment between vectors (x_i) and (x_i+1).
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
+                                       of each A_i are not used in computations).
+            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
+
     @param[in]
-    y         device pointer to the first vector y_1.
+    n         [int]
+              n specifies the number of rows of each b_i. n >= 0.
+
     @param[in]
-    incy      [int]
-              specifies the increment for the elements of each y_i.
+    AP        device pointer pointing to the first packed matrix A_1,
+              of dimension >= (n * (n + 1) / 2)
+
     @param[in]
-    stridey   [hipblasStride]
-              specifies the pointer increment between vectors (y_i) and (y_i+1).
+    strideA  [hipblasStride]
+              stride from the beginning of one packed matrix (AP_i) and the next (AP_i+1).
+
     @param[inout]
-    A         device pointer to the first matrix A_1.
+    x         device pointer pointing to the first input vector b_1. Overwritten by each x_i on output.
+
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
+    incx      [int]
+              specifies the increment for the elements of each x_i.
     @param[in]
-    strideA   [hipblasStride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
+    stridex  [hipblasStride]
+              stride from the beginning of one vector (x_i) and the next (x_i+1).
     @param[in]
     batchCount [int]
-              number of instances in the batch
+                specifies the number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* x,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         m,
+                                                          const hipblasDoubleComplex* AP,
+                                                          hipblasStride               strideAP,
+                                                          hipblasDoubleComplex*       x,
                                                           int                         incx,
                                                           hipblasStride               stridex,
-                                                          const hipblasDoubleComplex* y,
-                                                          int                         incy,
-                                                          hipblasStride               stridey,
-                                                          hipblasDoubleComplex*       A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
                                                           int                         batchCount);
 
-// tbmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasStbmv(hipblasHandle_t    handle,
+// trmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
                                             hipblasDiagType_t  diag,
                                             int                m,
-                                            int                k,
                                             const float*       A,
                                             int                lda,
                                             float*             x,
                                             int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmv(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
                                             hipblasDiagType_t  diag,
                                             int                m,
-                                            int                k,
                                             const double*      A,
                                             int                lda,
                                             double*            x,
                                             int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
                                             hipblasDiagType_t     diag,
                                             int                   m,
-                                            int                   k,
                                             const hipblasComplex* A,
                                             int                   lda,
                                             hipblasComplex*       x,
@@ -7823,118 +10544,90 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmv(hipblasHandle_t       handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    tbmv performs one of the matrix-vector operations
+    trmv performs one of the matrix-vector operations
 
-        x := A*x      or
-        x := A**T*x   or
-        x := A**H*x,
+         x = A*x or x = A**T*x,
 
-    x is a vectors and A is a banded m by m matrix (see description below).
+    where x is an n element vector and A is an n by n unit, or non-unit, upper or lower triangular matrix.
+
+    The vector x is overwritten.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: A is an upper banded triangular matrix.
-              HIPBLAS_FILL_MODE_LOWER: A is a  lower banded triangular matrix.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
     @param[in]
-    trans     [hipblasOperation_t]
-              indicates whether matrix A is tranposed (conjugated) or not.
+    transA     [hipblasOperation_t]
+
     @param[in]
-    diag      [hipblasDiagType_t]
-              HIPBLAS_DIAG_UNIT: The main diagonal of A is assumed to consist of only
-                                     1's and is not referenced.
-              HIPBLAS_DIAG_NON_UNIT: No assumptions are made of A's main diagonal.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+
     @param[in]
     m         [int]
-              the number of rows and columns of the matrix represented by A.
-    @param[in]
-    k         [int]
-              if uplo == HIPBLAS_FILL_MODE_UPPER, k specifies the number of super-diagonals
-              of the matrix A.
-              if uplo == HIPBLAS_FILL_MODE_LOWER, k specifies the number of sub-diagonals
-              of the matrix A.
-              k must satisfy k > 0 && k < lda.
+              m specifies the number of rows of A. m >= 0.
+
     @param[in]
-    A         device pointer storing banded triangular matrix A.
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The matrix represented is an upper banded triangular matrix
-                with the main diagonal and k super-diagonals, everything
-                else can be assumed to be 0.
-                The matrix is compacted so that the main diagonal resides on the k'th
-                row, the first super diagonal resides on the RHS of the k-1'th row, etc,
-                with the k'th diagonal on the RHS of the 0'th row.
-                   Ex: (HIPBLAS_FILL_MODE_UPPER; m = 5; k = 2)
-                      1 6 9 0 0              0 0 9 8 7
-                      0 2 7 8 0              0 6 7 8 9
-                      0 0 3 8 7     ---->    1 2 3 4 5
-                      0 0 0 4 9              0 0 0 0 0
-                      0 0 0 0 5              0 0 0 0 0
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The matrix represnted is a lower banded triangular matrix
-                with the main diagonal and k sub-diagonals, everything else can be
-                assumed to be 0.
-                The matrix is compacted so that the main diagonal resides on the 0'th row,
-                working up to the k'th diagonal residing on the LHS of the k'th row.
-                   Ex: (HIPBLAS_FILL_MODE_LOWER; m = 5; k = 2)
-                      1 0 0 0 0              1 2 3 4 5
-                      6 2 0 0 0              6 7 8 9 0
-                      9 7 3 0 0     ---->    9 8 7 0 0
-                      0 8 8 4 0              0 0 0 0 0
-                      0 0 7 9 5              0 0 0 0 0
+    A         device pointer storing matrix A,
+              of dimension ( lda, m )
+
     @param[in]
     lda       [int]
-              specifies the leading dimension of A. lda must satisfy lda > k.
-    @param[inout]
+              specifies the leading dimension of A.
+              lda = max( 1, m ).
+
+    @param[in]
     x         device pointer storing vector x.
+
     @param[in]
     incx      [int]
               specifies the increment for the elements of x.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmv(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
                                             hipblasDiagType_t           diag,
                                             int                         m,
-                                            int                         k,
                                             const hipblasDoubleComplex* A,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
 
-// tbmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
+// trmvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                                    hipblasFillMode_t  uplo,
                                                    hipblasOperation_t transA,
                                                    hipblasDiagType_t  diag,
                                                    int                m,
-                                                   int                k,
                                                    const float* const A[],
                                                    int                lda,
                                                    float* const       x[],
                                                    int                incx,
                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
                                                    hipblasDiagType_t   diag,
                                                    int                 m,
-                                                   int                 k,
                                                    const double* const A[],
                                                    int                 lda,
                                                    double* const       x[],
                                                    int                 incx,
                                                    int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
                                                    hipblasDiagType_t           diag,
                                                    int                         m,
-                                                   int                         k,
                                                    const hipblasComplex* const A[],
                                                    int                         lda,
                                                    hipblasComplex* const       x[],
@@ -7944,99 +10637,74 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             h
 /*! \brief BLAS Level 2 API
 
     \details
-    tbmvBatched performs one of the matrix-vector operations
+    trmvBatched performs one of the matrix-vector operations
 
-        x_i := A_i*x_i      or
-        x_i := A_i**T*x_i   or
-        x_i := A_i**H*x_i,
+         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
 
-    where (A_i, x_i) is the i-th instance of the batch.
-    x_i is a vector and A_i is an m by m matrix, for i = 1, ..., batchCount.
+    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
+
+    The vectors x_i are overwritten.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: each A_i is an upper banded triangular matrix.
-              HIPBLAS_FILL_MODE_LOWER: each A_i is a  lower banded triangular matrix.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+
     @param[in]
-    trans     [hipblasOperation_t]
-              indicates whether each matrix A_i is tranposed (conjugated) or not.
+    transA     [hipblasOperation_t]
+
     @param[in]
-    diag      [hipblasDiagType_t]
-              HIPBLAS_DIAG_UNIT: The main diagonal of each A_i is assumed to consist of only
-                                     1's and is not referenced.
-              HIPBLAS_DIAG_NON_UNIT: No assumptions are made of each A_i's main diagonal.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+
     @param[in]
     m         [int]
-              the number of rows and columns of the matrix represented by each A_i.
-    @param[in]
-    k         [int]
-              if uplo == HIPBLAS_FILL_MODE_UPPER, k specifies the number of super-diagonals
-              of each matrix A_i.
-              if uplo == HIPBLAS_FILL_MODE_LOWER, k specifies the number of sub-diagonals
-              of each matrix A_i.
-              k must satisfy k > 0 && k < lda.
+              m specifies the number of rows of matrices A_i. m >= 0.
+
     @param[in]
-    A         device array of device pointers storing each banded triangular matrix A_i.
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The matrix represented is an upper banded triangular matrix
-                with the main diagonal and k super-diagonals, everything
-                else can be assumed to be 0.
-                The matrix is compacted so that the main diagonal resides on the k'th
-                row, the first super diagonal resides on the RHS of the k-1'th row, etc,
-                with the k'th diagonal on the RHS of the 0'th row.
-                   Ex: (HIPBLAS_FILL_MODE_UPPER; m = 5; k = 2)
-                      1 6 9 0 0              0 0 9 8 7
-                      0 2 7 8 0              0 6 7 8 9
-                      0 0 3 8 7     ---->    1 2 3 4 5
-                      0 0 0 4 9              0 0 0 0 0
-                      0 0 0 0 5              0 0 0 0 0
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The matrix represnted is a lower banded triangular matrix
-                with the main diagonal and k sub-diagonals, everything else can be
-                assumed to be 0.
-                The matrix is compacted so that the main diagonal resides on the 0'th row,
-                working up to the k'th diagonal residing on the LHS of the k'th row.
-                   Ex: (HIPBLAS_FILL_MODE_LOWER; m = 5; k = 2)
-                      1 0 0 0 0              1 2 3 4 5
-                      6 2 0 0 0              6 7 8 9 0
-                      9 7 3 0 0     ---->    9 8 7 0 0
-                      0 8 8 4 0              0 0 0 0 0
-                      0 0 7 9 5              0 0 0 0 0
+    A         device pointer storing pointer of matrices A_i,
+              of dimension ( lda, m )
+
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i. lda must satisfy lda > k.
-    @param[inout]
-    x         device array of device pointer storing each vector x_i.
+              specifies the leading dimension of A_i.
+              lda >= max( 1, m ).
+
+    @param[in]
+    x         device pointer storing vectors x_i.
+
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of vectors x_i.
+
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+              The number of batched matrices/vectors.
+
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
                                                    hipblasDiagType_t                 diag,
                                                    int                               m,
-                                                   int                               k,
                                                    const hipblasDoubleComplex* const A[],
                                                    int                               lda,
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
 
-// tbmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
+// trmvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
                                                           hipblasDiagType_t  diag,
                                                           int                m,
-                                                          int                k,
                                                           const float*       A,
                                                           int                lda,
                                                           hipblasStride      strideA,
@@ -8045,12 +10713,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
                                                           hipblasDiagType_t  diag,
                                                           int                m,
-                                                          int                k,
                                                           const double*      A,
                                                           int                lda,
                                                           hipblasStride      strideA,
@@ -8059,12 +10726,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
                                                           hipblasDiagType_t     diag,
                                                           int                   m,
-                                                          int                   k,
                                                           const hipblasComplex* A,
                                                           int                   lda,
                                                           hipblasStride         strideA,
@@ -8076,92 +10742,71 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t
 /*! \brief BLAS Level 2 API
 
     \details
-    tbmvStridedBatched performs one of the matrix-vector operations
+    trmvStridedBatched performs one of the matrix-vector operations
 
-        x_i := A_i*x_i      or
-        x_i := A_i**T*x_i   or
-        x_i := A_i**H*x_i,
+         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
 
-    where (A_i, x_i) is the i-th instance of the batch.
-    x_i is a vector and A_i is an m by m matrix, for i = 1, ..., batchCount.
+    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
+    with strides specifying how to retrieve $x_i$ (resp. $A_i$) from $x_{i-1}$ (resp. $A_i$).
+
+    The vectors x_i are overwritten.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+
     @param[in]
-    uplo      [hipblasFillMode_t]
-              HIPBLAS_FILL_MODE_UPPER: each A_i is an upper banded triangular matrix.
-              HIPBLAS_FILL_MODE_LOWER: each A_i is a  lower banded triangular matrix.
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+
     @param[in]
-    trans     [hipblasOperation_t]
-              indicates whether each matrix A_i is tranposed (conjugated) or not.
+    transA     [hipblasOperation_t]
+
     @param[in]
-    diag      [hipblasDiagType_t]
-              HIPBLAS_DIAG_UNIT: The main diagonal of each A_i is assumed to consist of only
-                                     1's and is not referenced.
-              HIPBLAS_DIAG_NON_UNIT: No assumptions are made of each A_i's main diagonal.
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+
     @param[in]
     m         [int]
-              the number of rows and columns of the matrix represented by each A_i.
-    @param[in]
-    k         [int]
-              if uplo == HIPBLAS_FILL_MODE_UPPER, k specifies the number of super-diagonals
-              of each matrix A_i.
-              if uplo == HIPBLAS_FILL_MODE_LOWER, k specifies the number of sub-diagonals
-              of each matrix A_i.
-              k must satisfy k > 0 && k < lda.
+              m specifies the number of rows of matrices A_i. m >= 0.
+
     @param[in]
-    A         device array to the first matrix A_i of the batch. Stores each banded triangular matrix A_i.
-              if uplo == HIPBLAS_FILL_MODE_UPPER:
-                The matrix represented is an upper banded triangular matrix
-                with the main diagonal and k super-diagonals, everything
-                else can be assumed to be 0.
-                The matrix is compacted so that the main diagonal resides on the k'th
-                row, the first super diagonal resides on the RHS of the k-1'th row, etc,
-                with the k'th diagonal on the RHS of the 0'th row.
-                   Ex: (HIPBLAS_FILL_MODE_UPPER; m = 5; k = 2)
-                      1 6 9 0 0              0 0 9 8 7
-                      0 2 7 8 0              0 6 7 8 9
-                      0 0 3 8 7     ---->    1 2 3 4 5
-                      0 0 0 4 9              0 0 0 0 0
-                      0 0 0 0 5              0 0 0 0 0
-              if uplo == HIPBLAS_FILL_MODE_LOWER:
-                The matrix represnted is a lower banded triangular matrix
-                with the main diagonal and k sub-diagonals, everything else can be
-                assumed to be 0.
-                The matrix is compacted so that the main diagonal resides on the 0'th row,
-                working up to the k'th diagonal residing on the LHS of the k'th row.
-                   Ex: (HIPBLAS_FILL_MODE_LOWER; m = 5; k = 2)
-                      1 0 0 0 0              1 2 3 4 5
-                      6 2 0 0 0              6 7 8 9 0
-                      9 7 3 0 0     ---->    9 8 7 0 0
-                      0 8 8 4 0              0 0 0 0 0
-                      0 0 7 9 5              0 0 0 0 0
+    A         device pointer of the matrix A_0,
+              of dimension ( lda, m )
+
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i. lda must satisfy lda > k.
+              specifies the leading dimension of A_i.
+              lda >= max( 1, m ).
+
     @param[in]
     strideA  [hipblasStride]
-              stride from the start of one A_i matrix to the next A_(i + 1).
-    @param[inout]
-    x         device array to the first vector x_i of the batch.
+              stride from the start of one A_i matrix to the next A_{i + 1}
+
+    @param[in]
+    x         device pointer storing the vector x_0.
+
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of one vector x.
+
     @param[in]
     stridex  [hipblasStride]
-              stride from the start of one x_i matrix to the next x_(i + 1).
+              stride from the start of one x_i vector to the next x_{i + 1}
+
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+              The number of batched matrices/vectors.
+
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasFillMode_t           uplo,
                                                           hipblasOperation_t          transA,
                                                           hipblasDiagType_t           diag,
                                                           int                         m,
-                                                          int                         k,
                                                           const hipblasDoubleComplex* A,
                                                           int                         lda,
                                                           hipblasStride               strideA,
@@ -8170,35 +10815,32 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
 
-// tbsv
-HIPBLAS_EXPORT hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
+// trsv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
                                             hipblasDiagType_t  diag,
-                                            int                n,
-                                            int                k,
+                                            int                m,
                                             const float*       A,
                                             int                lda,
                                             float*             x,
                                             int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
                                             hipblasDiagType_t  diag,
-                                            int                n,
-                                            int                k,
+                                            int                m,
                                             const double*      A,
                                             int                lda,
                                             double*            x,
                                             int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
                                             hipblasDiagType_t     diag,
-                                            int                   n,
-                                            int                   k,
+                                            int                   m,
                                             const hipblasComplex* A,
                                             int                   lda,
                                             hipblasComplex*       x,
@@ -8207,11 +10849,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
 /*! \brief BLAS Level 2 API
 
     \details
-    tbsv solves
+    trsv solves
 
-         A*x = b or A**T*x = b or A**H*x = b,
+         A*x = b or A**T*x = b,
 
-    where x and b are vectors and A is a banded triangular matrix.
+    where x and b are vectors and A is a triangular matrix.
+
+    The vector x is overwritten on b.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -8224,85 +10868,71 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
 
     @param[in]
     transA     [hipblasOperation_t]
-               HIPBLAS_OP_N: Solves A*x = b
-               HIPBLAS_OP_T: Solves A**T*x = b
-               HIPBLAS_OP_C: Solves A**H*x = b
 
     @param[in]
     diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular (i.e. the diagonal elements
-                                       of A are not used in computations).
-            HIPBLAS_DIAG_NON_UNIT: A is not assumed to be unit triangular.
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
 
     @param[in]
-    n         [int]
-              n specifies the number of rows of b. n >= 0.
-    @param[in]
-    k         [int]
-              if(uplo == HIPBLAS_FILL_MODE_UPPER)
-                k specifies the number of super-diagonals of A.
-              if(uplo == HIPBLAS_FILL_MODE_LOWER)
-                k specifies the number of sub-diagonals of A.
-              k >= 0.
+    m         [int]
+              m specifies the number of rows of b. m >= 0.
 
     @param[in]
-    A         device pointer storing the matrix A in banded format.
+    A         device pointer storing matrix A,
+              of dimension ( lda, m )
 
     @param[in]
     lda       [int]
               specifies the leading dimension of A.
-              lda >= (k + 1).
+              lda = max( 1, m ).
 
-    @param[inout]
-    x         device pointer storing input vector b. Overwritten by the output vector x.
+    @param[in]
+    x         device pointer storing vector x.
 
     @param[in]
     incx      [int]
               specifies the increment for the elements of x.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
                                             hipblasDiagType_t           diag,
-                                            int                         n,
-                                            int                         k,
+                                            int                         m,
                                             const hipblasDoubleComplex* A,
                                             int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
 
-// tbsvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
+// trsvBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                                    hipblasFillMode_t  uplo,
                                                    hipblasOperation_t transA,
                                                    hipblasDiagType_t  diag,
-                                                   int                n,
-                                                   int                k,
+                                                   int                m,
                                                    const float* const A[],
                                                    int                lda,
                                                    float* const       x[],
                                                    int                incx,
                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
                                                    hipblasDiagType_t   diag,
-                                                   int                 n,
-                                                   int                 k,
+                                                   int                 m,
                                                    const double* const A[],
                                                    int                 lda,
                                                    double* const       x[],
                                                    int                 incx,
                                                    int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
                                                    hipblasDiagType_t           diag,
-                                                   int                         n,
-                                                   int                         k,
+                                                   int                         m,
                                                    const hipblasComplex* const A[],
                                                    int                         lda,
                                                    hipblasComplex* const       x[],
@@ -8312,14 +10942,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             h
 /*! \brief BLAS Level 2 API
 
     \details
-    tbsvBatched solves
+    trsvBatched solves
 
-         A_i*x_i = b_i or A_i**T*x_i = b_i or A_i**H*x_i = b_i,
+         A_i*x_i = b_i or A_i**T*x_i = b_i,
 
-    where x_i and b_i are vectors and A_i is a banded triangular matrix,
-    for i = [1, batchCount].
+    where (A_i, x_i, b_i) is the i-th instance of the batch.
+    x_i and b_i are vectors and A_i is an
+    m by m triangular matrix.
 
-    The input vectors b_i are overwritten by the output vectors x_i.
+    The vector x is overwritten on b.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -8327,70 +10958,58 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             h
 
     @param[in]
     uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
 
     @param[in]
     transA     [hipblasOperation_t]
-               HIPBLAS_OP_N: Solves A_i*x_i = b_i
-               HIPBLAS_OP_T: Solves A_i**T*x_i = b_i
-               HIPBLAS_OP_C: Solves A_i**H*x_i = b_i
 
     @param[in]
     diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
-                                       of each A_i are not used in computations).
-            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
 
     @param[in]
-    n         [int]
-              n specifies the number of rows of each b_i. n >= 0.
-    @param[in]
-    k         [int]
-              if(uplo == HIPBLAS_FILL_MODE_UPPER)
-                k specifies the number of super-diagonals of each A_i.
-              if(uplo == HIPBLAS_FILL_MODE_LOWER)
-                k specifies the number of sub-diagonals of each A_i.
-              k >= 0.
+    m         [int]
+              m specifies the number of rows of b. m >= 0.
 
     @param[in]
-    A         device vector of device pointers storing each matrix A_i in banded format.
+    A         device array of device pointers storing each matrix A_i.
 
     @param[in]
     lda       [int]
               specifies the leading dimension of each A_i.
-              lda >= (k + 1).
+              lda = max(1, m)
+
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
 
-    @param[inout]
-    x         device vector of device pointers storing each input vector b_i. Overwritten by each output
-              vector x_i.
     @param[in]
     incx      [int]
-              specifies the increment for the elements of each x_i.
+              specifies the increment for the elements of x.
+
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+                number of instances in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
                                                    hipblasDiagType_t                 diag,
-                                                   int                               n,
-                                                   int                               k,
+                                                   int                               m,
                                                    const hipblasDoubleComplex* const A[],
                                                    int                               lda,
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
                                                    int                               batchCount);
 
-// tbsvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
+// trsvStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
                                                           hipblasDiagType_t  diag,
-                                                          int                n,
-                                                          int                k,
+                                                          int                m,
                                                           const float*       A,
                                                           int                lda,
                                                           hipblasStride      strideA,
@@ -8399,12 +11018,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
                                                           hipblasDiagType_t  diag,
-                                                          int                n,
-                                                          int                k,
+                                                          int                m,
                                                           const double*      A,
                                                           int                lda,
                                                           hipblasStride      strideA,
@@ -8413,12 +11031,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridex,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasFillMode_t     uplo,
                                                           hipblasOperation_t    transA,
                                                           hipblasDiagType_t     diag,
-                                                          int                   n,
-                                                          int                   k,
+                                                          int                   m,
                                                           const hipblasComplex* A,
                                                           int                   lda,
                                                           hipblasStride         strideA,
@@ -8430,1346 +11047,1691 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t
 /*! \brief BLAS Level 2 API
 
     \details
-    tbsvStridedBatched solves
+    trsvStridedBatched solves
+
+         A_i*x_i = b_i or A_i**T*x_i = b_i,
+
+    where (A_i, x_i, b_i) is the i-th instance of the batch.
+    x_i and b_i are vectors and A_i is an m by m triangular matrix, for i = 1, ..., batchCount.
+
+    The vector x is overwritten on b.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA     [hipblasOperation_t]
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m         [int]
+              m specifies the number of rows of each b_i. m >= 0.
+
+    @param[in]
+    A         device pointer to the first matrix (A_1) in the batch, of dimension ( lda, m )
+
+    @param[in]
+    strideA  [hipblasStride]
+              stride from the start of one A_i matrix to the next A_(i + 1)
+
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+              lda = max( 1, m ).
+
+    @param[in, out]
+    x         device pointer to the first vector (x_1) in the batch.
+
+    @param[in]
+    stridex [hipblasStride]
+             stride from the start of one x_i vector to the next x_(i + 1)
+
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of each x_i.
+
+    @param[in]
+    batchCount [int]
+                number of instances in the batch
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         m,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          hipblasDoubleComplex*       x,
+                                                          int                         incx,
+                                                          hipblasStride               stridex,
+                                                          int                         batchCount);
+
+// ================================
+// ====== STORAGE CONVERSION ======
+// ================================
+
+// tpttr
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttr(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               n,
+                                             const float*      AP,
+                                             float*            A,
+                                             int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttr(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               n,
+                                             const double*     AP,
+                                             double*           A,
+                                             int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttr(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int                   n,
+                                             const hipblasComplex* AP,
+                                             hipblasComplex*       A,
+                                             int                   lda);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tpttr converts the triangular matrix AP in packed storage, as tpmv and spmv take it, to the
+    triangular matrix A in full storage, as trmm and trsm take it
+
+        A(i, j) := AP(i + j * (j + 1) / 2)              for i <= j (upper),
+        A(i, j) := AP(i + j * (2 * n - j - 1) / 2)      for i >= j (lower).
+
+    The other triangle of A is not referenced.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  the upper triangle is converted.
+              HIPBLAS_FILL_MODE_LOWER:  the lower triangle is converted.
+    @param[in]
+    n         [int]
+              the number of rows and columns of A. n >= 0.
+    @param[in]
+    AP        device pointer to the matrix,
+              of dimension n * (n + 1) / 2, holding the triangle column by column.
+    @param[out]
+    A         device pointer to the matrix,
+              of dimension ( lda, n ).
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. lda >= max( 1, n ).
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttr(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int                         n,
+                                             const hipblasDoubleComplex* AP,
+                                             hipblasDoubleComplex*       A,
+                                             int                         lda);
+
+// tpttrBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    int                n,
+                                                    const float* const AP[],
+                                                    float* const       A[],
+                                                    int                lda,
+                                                    int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    int                 n,
+                                                    const double* const AP[],
+                                                    double* const       A[],
+                                                    int                 lda,
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const AP[],
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    tpttrBatched converts the triangular matrix AP_i in packed storage, as tpmv and spmv take
+    it, to the triangular matrix A_i in full storage, as trmm and trsm take it
 
-         A_i*x_i = b_i or A_i**T*x_i = b_i or A_i**H*x_i = b_i,
+        A_i(i, j) := AP_i(i + j * (j + 1) / 2)              for i <= j (upper),
+        A_i(i, j) := AP_i(i + j * (2 * n - j - 1) / 2)      for i >= j (lower).
 
-    where x_i and b_i are vectors and A_i is a banded triangular matrix,
-    for i = [1, batchCount].
+    The other triangle of A_i is not referenced.
 
-    The input vectors b_i are overwritten by the output vectors x_i.
+    (AP_i, A_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
+    The arrays of pointers are read back to the host, so the call waits for the work queued
+    before on the stream of the handle, and fails with HIPBLAS_STATUS_NOT_SUPPORTED in
+    HIPBLAS_CAPTURE_MODE_SAFE.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
-
     @param[in]
-    transA     [hipblasOperation_t]
-               HIPBLAS_OP_N: Solves A_i*x_i = b_i
-               HIPBLAS_OP_T: Solves A_i**T*x_i = b_i
-               HIPBLAS_OP_C: Solves A_i**H*x_i = b_i
-
-    @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
-                                       of each A_i are not used in computations).
-            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
-
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  the upper triangle is converted.
+              HIPBLAS_FILL_MODE_LOWER:  the lower triangle is converted.
     @param[in]
     n         [int]
-              n specifies the number of rows of each b_i. n >= 0.
-    @param[in]
-    k         [int]
-              if(uplo == HIPBLAS_FILL_MODE_UPPER)
-                k specifies the number of super-diagonals of each A_i.
-              if(uplo == HIPBLAS_FILL_MODE_LOWER)
-                k specifies the number of sub-diagonals of each A_i.
-              k >= 0.
-
+              the number of rows and columns of each A. n >= 0.
     @param[in]
-    A         device pointer pointing to the first banded matrix A_1.
-
+    AP        device array of device pointers to the matrices,
+              of dimension n * (n + 1) / 2, holding the triangle column by column.
+    @param[out]
+    A         device array of device pointers to the matrices,
+              of dimension ( lda, n ).
     @param[in]
     lda       [int]
-              specifies the leading dimension of each A_i.
-              lda >= (k + 1).
-    @param[in]
-    strideA  [hipblasStride]
-              specifies the distance between the start of one matrix (A_i) and the next (A_i+1).
-
-    @param[inout]
-    x         device pointer pointing to the first input vector b_1. Overwritten by output vectors x.
-    @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
-    @param[in]
-    stridex  [hipblasStride]
-              specifies the distance between the start of one vector (x_i) and the next (x_i+1).
+              specifies the leading dimension of each A. lda >= max( 1, n ).
     @param[in]
     batchCount [int]
-                number of instances in the batch.
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasDiagType_t           diag,
-                                                          int                         n,
-                                                          int                         k,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          hipblasDoubleComplex*       x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const AP[],
+                                                    hipblasDoubleComplex* const       A[],
+                                                    int                               lda,
+                                                    int                               batchCount);
 
-// tpmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            const float*       AP,
-                                            float*             x,
-                                            int                incx);
+// tpttrStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const float*      AP,
+                                                           hipblasStride     strideAP,
+                                                           float*            A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            const double*      AP,
-                                            double*            x,
-                                            int                incx);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const double*     AP,
+                                                           hipblasStride     strideAP,
+                                                           double*           A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
-                                            hipblasDiagType_t     diag,
-                                            int                   m,
-                                            const hipblasComplex* AP,
-                                            hipblasComplex*       x,
-                                            int                   incx);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* AP,
+                                                           hipblasStride         strideAP,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    tpmv performs one of the matrix-vector operations
+    tpttrStridedBatched converts the triangular matrix AP_i in packed storage, as tpmv and spmv
+    take it, to the triangular matrix A_i in full storage, as trmm and trsm take it
 
-         x = A*x or x = A**T*x,
+        A_i(i, j) := AP_i(i + j * (j + 1) / 2)              for i <= j (upper),
+        A_i(i, j) := AP_i(i + j * (2 * n - j - 1) / 2)      for i >= j (lower).
 
-    where x is an n element vector and A is an n by n unit, or non-unit, upper or lower triangular matrix, supplied in the pack form.
+    The other triangle of A_i is not referenced.
 
-    The vector x is overwritten.
+    (AP_i, A_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  the upper triangle is converted.
+              HIPBLAS_FILL_MODE_LOWER:  the lower triangle is converted.
     @param[in]
-    transA     [hipblasOperation_t]
-
+    n         [int]
+              the number of rows and columns of each A. n >= 0.
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
-
+    AP        device pointer to the first matrix of the batch,
+              of dimension n * (n + 1) / 2, holding the triangle column by column.
     @param[in]
-    m       [int]
-            m specifies the number of rows of A. m >= 0.
-
+    strideAP  [hipblasStride]
+              stride from the start of one AP_i to the next AP_(i + 1).
+    @param[out]
+    A         device pointer to the first matrix of the batch,
+              of dimension ( lda, n ).
     @param[in]
-    A       device pointer storing matrix A,
-            of dimension at leat ( m * ( m + 1 ) / 2 ).
-          Before entry with uplo = HIPBLAS_FILL_MODE_UPPER, the array A
-          must contain the upper triangular matrix packed sequentially,
-          column by column, so that A[0] contains a_{0,0}, A[1] and A[2] contain
-          a_{0,1} and a_{1, 1} respectively, and so on.
-          Before entry with uplo = HIPBLAS_FILL_MODE_LOWER, the array A
-          must contain the lower triangular matrix packed sequentially,
-          column by column, so that A[0] contains a_{0,0}, A[1] and A[2] contain
-          a_{1,0} and a_{2,0} respectively, and so on.
-          Note that when DIAG = HIPBLAS_DIAG_UNIT, the diagonal elements of A are
-          not referenced, but are assumed to be unity.
-
+    lda       [int]
+              specifies the leading dimension of each A. lda >= max( 1, n ).
     @param[in]
-    x       device pointer storing vector x.
-
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_(i + 1).
     @param[in]
-    incx    [int]
-            specifies the increment for the elements of x. incx must not be zero.
+    batchCount [int]
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
-                                            hipblasOperation_t          transA,
-                                            hipblasDiagType_t           diag,
-                                            int                         m,
-                                            const hipblasDoubleComplex* AP,
-                                            hipblasDoubleComplex*       x,
-                                            int                         incx);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* AP,
+                                                           hipblasStride               strideAP,
+                                                           hipblasDoubleComplex*       A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           int                         batchCount);
 
-// tpmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
-                                                   hipblasFillMode_t  uplo,
-                                                   hipblasOperation_t transA,
-                                                   hipblasDiagType_t  diag,
-                                                   int                m,
-                                                   const float* const AP[],
-                                                   float* const       x[],
-                                                   int                incx,
-                                                   int                batchCount);
+// trttp
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttp(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               n,
+                                             const float*      A,
+                                             int               lda,
+                                             float*            AP);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   hipblasOperation_t  transA,
-                                                   hipblasDiagType_t   diag,
-                                                   int                 m,
-                                                   const double* const AP[],
-                                                   double* const       x[],
-                                                   int                 incx,
-                                                   int                 batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttp(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               n,
+                                             const double*     A,
+                                             int               lda,
+                                             double*           AP);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
-                                                   hipblasDiagType_t           diag,
-                                                   int                         m,
-                                                   const hipblasComplex* const AP[],
-                                                   hipblasComplex* const       x[],
-                                                   int                         incx,
-                                                   int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttp(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int                   n,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       AP);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    tpmvBatched performs one of the matrix-vector operations
-
-         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
+    trttp converts the triangle of the matrix A in full storage to the triangular matrix AP in
+    packed storage, the reverse of tpttr
 
-    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
+        AP(i + j * (j + 1) / 2)         := A(i, j)      for i <= j (upper),
+        AP(i + j * (2 * n - j - 1) / 2) := A(i, j)      for i >= j (lower).
 
-    The vectors x_i are overwritten.
+    The other triangle of A is not referenced.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  the upper triangle is converted.
+              HIPBLAS_FILL_MODE_LOWER:  the lower triangle is converted.
+    @param[in]
+    n         [int]
+              the number of rows and columns of A. n >= 0.
+    @param[in]
+    A         device pointer to the matrix,
+              of dimension ( lda, n ).
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. lda >= max( 1, n ).
+    @param[out]
+    AP        device pointer to the matrix,
+              of dimension n * (n + 1) / 2, holding the triangle column by column.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttp(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int                         n,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             hipblasDoubleComplex*       AP);
+
+// trttpBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    int                n,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    float* const       AP[],
+                                                    int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    int                 n,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    double* const       AP[],
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AP[],
+                                                    int                         batchCount);
+
+/*! \brief BLAS Level 2 API
+
+    \details
+    trttpBatched converts the triangle of the matrix A_i in full storage to the triangular
+    matrix AP_i in packed storage, the reverse of tpttr
 
-    @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
+        AP_i(i + j * (j + 1) / 2)         := A_i(i, j)      for i <= j (upper),
+        AP_i(i + j * (2 * n - j - 1) / 2) := A_i(i, j)      for i >= j (lower).
 
-    @param[in]
-    transA     [hipblasOperation_t]
+    The other triangle of A_i is not referenced.
 
-    @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+    (A_i, AP_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
+    The arrays of pointers are read back to the host, so the call waits for the work queued
+    before on the stream of the handle, and fails with HIPBLAS_STATUS_NOT_SUPPORTED in
+    HIPBLAS_CAPTURE_MODE_SAFE.
 
     @param[in]
-    m         [int]
-              m specifies the number of rows of matrices A_i. m >= 0.
-
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
     @param[in]
-    A         device pointer storing pointer of matrices A_i,
-              of dimension ( lda, m )
-
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  the upper triangle is converted.
+              HIPBLAS_FILL_MODE_LOWER:  the lower triangle is converted.
     @param[in]
-    x         device pointer storing vectors x_i.
-
+    n         [int]
+              the number of rows and columns of each A. n >= 0.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of vectors x_i.
-
+    A         device array of device pointers to the matrices,
+              of dimension ( lda, n ).
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A. lda >= max( 1, n ).
+    @param[out]
+    AP        device array of device pointers to the matrices,
+              of dimension n * (n + 1) / 2, holding the triangle column by column.
     @param[in]
     batchCount [int]
-              The number of batched matrices/vectors.
-
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   hipblasOperation_t                transA,
-                                                   hipblasDiagType_t                 diag,
-                                                   int                               m,
-                                                   const hipblasDoubleComplex* const AP[],
-                                                   hipblasDoubleComplex* const       x[],
-                                                   int                               incx,
-                                                   int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    hipblasDoubleComplex* const       AP[],
+                                                    int                               batchCount);
 
-// tpmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const float*       AP,
-                                                          hipblasStride      strideAP,
-                                                          float*             x,
-                                                          int                incx,
-                                                          hipblasStride      stride,
-                                                          int                batchCount);
+// trttpStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const float*      A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           float*            AP,
+                                                           hipblasStride     strideAP,
+                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const double*      AP,
-                                                          hipblasStride      strideAP,
-                                                          double*            x,
-                                                          int                incx,
-                                                          hipblasStride      stride,
-                                                          int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               n,
+                                                           const double*     A,
+                                                           int               lda,
+                                                           hipblasStride     strideA,
+                                                           double*           AP,
+                                                           hipblasStride     strideAP,
+                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          hipblasOperation_t    transA,
-                                                          hipblasDiagType_t     diag,
-                                                          int                   m,
-                                                          const hipblasComplex* AP,
-                                                          hipblasStride         strideAP,
-                                                          hipblasComplex*       x,
-                                                          int                   incx,
-                                                          hipblasStride         stride,
-                                                          int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AP,
+                                                           hipblasStride         strideAP,
+                                                           int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    tpmvStridedBatched performs one of the matrix-vector operations
+    trttpStridedBatched converts the triangle of the matrix A_i in full storage to the
+    triangular matrix AP_i in packed storage, the reverse of tpttr
 
-         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
+        AP_i(i + j * (j + 1) / 2)         := A_i(i, j)      for i <= j (upper),
+        AP_i(i + j * (2 * n - j - 1) / 2) := A_i(i, j)      for i >= j (lower).
 
-    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
-    with strides specifying how to retrieve $x_i$ (resp. $A_i$) from $x_{i-1}$ (resp. $A_i$).
+    The other triangle of A_i is not referenced.
 
-    The vectors x_i are overwritten.
+    (A_i, AP_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
-
-    @param[in]
-    transA     [hipblasOperation_t]
-
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
-
-    @param[in]
-    m         [int]
-              m specifies the number of rows of matrices A_i. m >= 0.
-
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  the upper triangle is converted.
+              HIPBLAS_FILL_MODE_LOWER:  the lower triangle is converted.
     @param[in]
-    A         device pointer of the matrix A_0,
-              of dimension ( lda, m )
-
+    n         [int]
+              the number of rows and columns of each A. n >= 0.
     @param[in]
-    strideA  [hipblasStride]
-              stride from the start of one A_i matrix to the next A_{i + 1}
-
+    A         device pointer to the first matrix of the batch,
+              of dimension ( lda, n ).
     @param[in]
-    x         device pointer storing the vector x_0.
-
+    lda       [int]
+              specifies the leading dimension of each A. lda >= max( 1, n ).
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of one vector x.
-
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_(i + 1).
+    @param[out]
+    AP        device pointer to the first matrix of the batch,
+              of dimension n * (n + 1) / 2, holding the triangle column by column.
     @param[in]
-    stridex  [hipblasStride]
-              stride from the start of one x_i vector to the next x_{i + 1}
-
+    strideAP  [hipblasStride]
+              stride from the start of one AP_i to the next AP_(i + 1).
     @param[in]
     batchCount [int]
-              The number of batched matrices/vectors.
-
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasDiagType_t           diag,
-                                                          int                         m,
-                                                          const hipblasDoubleComplex* AP,
-                                                          hipblasStride               strideAP,
-                                                          hipblasDoubleComplex*       x,
-                                                          int                         incx,
-                                                          hipblasStride               stride,
-                                                          int                         batchCount);
-
-// tpsv
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpsv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            const float*       AP,
-                                            float*             x,
-                                            int                incx);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           hipblasDoubleComplex*       AP,
+                                                           hipblasStride               strideAP,
+                                                           int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            const double*      AP,
-                                            double*            x,
-                                            int                incx);
+// gbtge
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbtge(hipblasHandle_t handle,
+                                             int             m,
+                                             int             n,
+                                             int             kl,
+                                             int             ku,
+                                             const float*    AB,
+                                             int             ldab,
+                                             float*          A,
+                                             int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbtge(hipblasHandle_t handle,
+                                             int             m,
+                                             int             n,
+                                             int             kl,
+                                             int             ku,
+                                             const double*   AB,
+                                             int             ldab,
+                                             double*         A,
+                                             int             lda);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsv(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
-                                            hipblasDiagType_t     diag,
-                                            int                   m,
-                                            const hipblasComplex* AP,
-                                            hipblasComplex*       x,
-                                            int                   incx);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbtge(hipblasHandle_t       handle,
+                                             int                   m,
+                                             int                   n,
+                                             int                   kl,
+                                             int                   ku,
+                                             const hipblasComplex* AB,
+                                             int                   ldab,
+                                             hipblasComplex*       A,
+                                             int                   lda);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    tpsv solves
-
-         A*x = b or A**T*x = b, or A**H*x = b,
+    gbtge converts the m by n band matrix AB with kl sub-diagonals and ku super-diagonals in
+    band storage, as gbmv takes it, to the matrix A in full storage
 
-    where x and b are vectors and A is a triangular matrix stored in the packed format.
+        A(i, j) := AB(ku + i - j, j)      for max( 0, j - ku ) <= i <= min( m - 1, j + kl ).
 
-    The input vector b is overwritten by the output vector x.
+    The elements of A outside the band are not referenced; to promote AB to a full matrix, set
+    them to zero first. The triangular, symmetric and Hermitian band storage of tbmv, sbmv and
+    hbmv with k off-diagonals is kl = 0, ku = k for the upper triangle and kl = k, ku = 0 for
+    the lower triangle.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
+    m         [int]
+              the number of rows of A. m >= 0.
     @param[in]
-    transA  [hipblasOperation_t]
-            HIPBLAS_OP_N: Solves A*x = b
-            HIPBLAS_OP_T: Solves A**T*x = b
-            HIPBLAS_OP_C: Solves A**H*x = b
-
+    n         [int]
+              the number of columns of A. n >= 0.
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular (i.e. the diagonal elements
-                                       of A are not used in computations).
-            HIPBLAS_DIAG_NON_UNIT: A is not assumed to be unit triangular.
-
+    kl        [int]
+              the number of sub-diagonals of the band. kl >= 0.
     @param[in]
-    n         [int]
-              n specifies the number of rows of b. n >= 0.
-
+    ku        [int]
+              the number of super-diagonals of the band. ku >= 0.
     @param[in]
-    AP        device pointer storing the packed version of matrix A,
-              of dimension >= (n * (n + 1) / 2)
-
-    @param[inout]
-    x         device pointer storing vector b on input, overwritten by x on output.
-
+    AB        device pointer to the matrix,
+              of dimension ( ldab, n ).
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of x.
-
-    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsv(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
-                                            hipblasOperation_t          transA,
-                                            hipblasDiagType_t           diag,
-                                            int                         m,
-                                            const hipblasDoubleComplex* AP,
-                                            hipblasDoubleComplex*       x,
-                                            int                         incx);
-
-// tpsvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
-                                                   hipblasFillMode_t  uplo,
-                                                   hipblasOperation_t transA,
-                                                   hipblasDiagType_t  diag,
-                                                   int                m,
-                                                   const float* const AP[],
-                                                   float* const       x[],
-                                                   int                incx,
-                                                   int                batchCount);
+    ldab      [int]
+              specifies the leading dimension of AB. ldab >= kl + ku + 1.
+    @param[out]
+    A         device pointer to the matrix,
+              of dimension ( lda, n ).
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. lda >= max( 1, m ).
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   hipblasOperation_t  transA,
-                                                   hipblasDiagType_t   diag,
-                                                   int                 m,
-                                                   const double* const AP[],
-                                                   double* const       x[],
-                                                   int                 incx,
-                                                   int                 batchCount);
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbtge(hipblasHandle_t             handle,
+                                             int                         m,
+                                             int                         n,
+                                             int                         kl,
+                                             int                         ku,
+                                             const hipblasDoubleComplex* AB,
+                                             int                         ldab,
+                                             hipblasDoubleComplex*       A,
+                                             int                         lda);
+
+// gbtgeBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbtgeBatched(hipblasHandle_t    handle,
+                                                    int                m,
+                                                    int                n,
+                                                    int                kl,
+                                                    int                ku,
+                                                    const float* const AB[],
+                                                    int                ldab,
+                                                    float* const       A[],
+                                                    int                lda,
+                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
-                                                   hipblasDiagType_t           diag,
-                                                   int                         m,
-                                                   const hipblasComplex* const AP[],
-                                                   hipblasComplex* const       x[],
-                                                   int                         incx,
-                                                   int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbtgeBatched(hipblasHandle_t     handle,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 kl,
+                                                    int                 ku,
+                                                    const double* const AB[],
+                                                    int                 ldab,
+                                                    double* const       A[],
+                                                    int                 lda,
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbtgeBatched(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const AB[],
+                                                    int                         ldab,
+                                                    hipblasComplex* const       A[],
+                                                    int                         lda,
+                                                    int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    tpsvBatched solves
+    gbtgeBatched converts the m by n band matrix AB_i with kl sub-diagonals and ku
+    super-diagonals in band storage, as gbmv takes it, to the matrix A_i in full storage
 
-         A_i*x_i = b_i or A_i**T*x_i = b_i, or A_i**H*x_i = b_i,
+        A_i(i, j) := AB_i(ku + i - j, j)      for max( 0, j - ku ) <= i <= min( m - 1, j + kl ).
 
-    where x_i and b_i are vectors and A_i is a triangular matrix stored in the packed format,
-    for i in [1, batchCount].
+    The elements of A_i outside the band are not referenced; to promote AB_i to a full matrix,
+    set them to zero first. The triangular, symmetric and Hermitian band storage of tbmv, sbmv
+    and hbmv with k off-diagonals is kl = 0, ku = k for the upper triangle and kl = k, ku = 0
+    for the lower triangle.
 
-    The input vectors b_i are overwritten by the output vectors x_i.
+    (AB_i, A_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
+    The arrays of pointers are read back to the host, so the call waits for the work queued
+    before on the stream of the handle, and fails with HIPBLAS_STATUS_NOT_SUPPORTED in
+    HIPBLAS_CAPTURE_MODE_SAFE.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
-
+    m         [int]
+              the number of rows of each A. m >= 0.
     @param[in]
-    transA  [hipblasOperation_t]
-            HIPBLAS_OP_N: Solves A*x = b
-            HIPBLAS_OP_T: Solves A**T*x = b
-            HIPBLAS_OP_C: Solves A**H*x = b
-
+    n         [int]
+              the number of columns of each A. n >= 0.
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
-                                       of each A_i are not used in computations).
-            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
-
+    kl        [int]
+              the number of sub-diagonals of the band. kl >= 0.
     @param[in]
-    n         [int]
-              n specifies the number of rows of each b_i. n >= 0.
-
+    ku        [int]
+              the number of super-diagonals of the band. ku >= 0.
     @param[in]
-    AP        device array of device pointers storing the packed versions of each matrix A_i,
-              of dimension >= (n * (n + 1) / 2)
-
-    @param[inout]
-    x         device array of device pointers storing each input vector b_i, overwritten by x_i on output.
-
+    AB        device array of device pointers to the matrices,
+              of dimension ( ldab, n ).
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    ldab      [int]
+              specifies the leading dimension of each AB. ldab >= kl + ku + 1.
+    @param[out]
+    A         device array of device pointers to the matrices,
+              of dimension ( lda, n ).
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A. lda >= max( 1, m ).
     @param[in]
     batchCount [int]
-                specifies the number of instances in the batch.
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   hipblasOperation_t                transA,
-                                                   hipblasDiagType_t                 diag,
-                                                   int                               m,
-                                                   const hipblasDoubleComplex* const AP[],
-                                                   hipblasDoubleComplex* const       x[],
-                                                   int                               incx,
-                                                   int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbtgeBatched(hipblasHandle_t                   handle,
+                                                    int                               m,
+                                                    int                               n,
+                                                    int                               kl,
+                                                    int                               ku,
+                                                    const hipblasDoubleComplex* const AB[],
+                                                    int                               ldab,
+                                                    hipblasDoubleComplex* const       A[],
+                                                    int                               lda,
+                                                    int                               batchCount);
 
-// tpsvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const float*       AP,
-                                                          hipblasStride      strideAP,
-                                                          float*             x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          int                batchCount);
+// gbtgeStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgbtgeStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const float*    AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           float*          A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           int             batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const double*      AP,
-                                                          hipblasStride      strideAP,
-                                                          double*            x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgbtgeStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const double*   AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           double*         A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           int             batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          hipblasOperation_t    transA,
-                                                          hipblasDiagType_t     diag,
-                                                          int                   m,
-                                                          const hipblasComplex* AP,
-                                                          hipblasStride         strideAP,
-                                                          hipblasComplex*       x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgbtgeStridedBatched(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           hipblasComplex*       A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    tpsvStridedBatched solves
+    gbtgeStridedBatched converts the m by n band matrix AB_i with kl sub-diagonals and ku
+    super-diagonals in band storage, as gbmv takes it, to the matrix A_i in full storage
 
-         A_i*x_i = b_i or A_i**T*x_i = b_i, or A_i**H*x_i = b_i,
+        A_i(i, j) := AB_i(ku + i - j, j)      for max( 0, j - ku ) <= i <= min( m - 1, j + kl ).
 
-    where x_i and b_i are vectors and A_i is a triangular matrix stored in the packed format,
-    for i in [1, batchCount].
+    The elements of A_i outside the band are not referenced; to promote AB_i to a full matrix,
+    set them to zero first. The triangular, symmetric and Hermitian band storage of tbmv, sbmv
+    and hbmv with k off-diagonals is kl = 0, ku = k for the upper triangle and kl = k, ku = 0
+    for the lower triangle.
 
-    The input vectors b_i are overwritten by the output vectors x_i.
+    (AB_i, A_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
-
+    m         [int]
+              the number of rows of each A. m >= 0.
     @param[in]
-    transA  [hipblasOperation_t]
-            HIPBLAS_OP_N: Solves A*x = b
-            HIPBLAS_OP_T: Solves A**T*x = b
-            HIPBLAS_OP_C: Solves A**H*x = b
-
+    n         [int]
+              the number of columns of each A. n >= 0.
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular (i.e. the diagonal elements
-                                       of each A_i are not used in computations).
-            HIPBLAS_DIAG_NON_UNIT: each A_i is not assumed to be unit triangular.
-
+    kl        [int]
+              the number of sub-diagonals of the band. kl >= 0.
     @param[in]
-    n         [int]
-              n specifies the number of rows of each b_i. n >= 0.
-
+    ku        [int]
+              the number of super-diagonals of the band. ku >= 0.
     @param[in]
-    AP        device pointer pointing to the first packed matrix A_1,
-              of dimension >= (n * (n + 1) / 2)
-
+    AB        device pointer to the first matrix of the batch,
+              of dimension ( ldab, n ).
     @param[in]
-    strideA  [hipblasStride]
-              stride from the beginning of one packed matrix (AP_i) and the next (AP_i+1).
-
-    @param[inout]
-    x         device pointer pointing to the first input vector b_1. Overwritten by each x_i on output.
-
+    ldab      [int]
+              specifies the leading dimension of each AB. ldab >= kl + ku + 1.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
+    strideAB  [hipblasStride]
+              stride from the start of one AB_i to the next AB_(i + 1).
+    @param[out]
+    A         device pointer to the first matrix of the batch,
+              of dimension ( lda, n ).
     @param[in]
-    stridex  [hipblasStride]
-              stride from the beginning of one vector (x_i) and the next (x_i+1).
+    lda       [int]
+              specifies the leading dimension of each A. lda >= max( 1, m ).
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_(i + 1).
     @param[in]
     batchCount [int]
-                specifies the number of instances in the batch.
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasDiagType_t           diag,
-                                                          int                         m,
-                                                          const hipblasDoubleComplex* AP,
-                                                          hipblasStride               strideAP,
-                                                          hipblasDoubleComplex*       x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          int                         batchCount);
-
-// trmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrmv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            const float*       A,
-                                            int                lda,
-                                            float*             x,
-                                            int                incx);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
-                                            int                m,
-                                            const double*      A,
-                                            int                lda,
-                                            double*            x,
-                                            int                incx);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgbtgeStridedBatched(hipblasHandle_t             handle,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         kl,
+                                                           int                         ku,
+                                                           const hipblasDoubleComplex* AB,
+                                                           int                         ldab,
+                                                           hipblasStride               strideAB,
+                                                           hipblasDoubleComplex*       A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmv(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
-                                            hipblasDiagType_t     diag,
-                                            int                   m,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            hipblasComplex*       x,
-                                            int                   incx);
+// getgb
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetgb(hipblasHandle_t handle,
+                                             int             m,
+                                             int             n,
+                                             int             kl,
+                                             int             ku,
+                                             const float*    A,
+                                             int             lda,
+                                             float*          AB,
+                                             int             ldab);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetgb(hipblasHandle_t handle,
+                                             int             m,
+                                             int             n,
+                                             int             kl,
+                                             int             ku,
+                                             const double*   A,
+                                             int             lda,
+                                             double*         AB,
+                                             int             ldab);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetgb(hipblasHandle_t       handle,
+                                             int                   m,
+                                             int                   n,
+                                             int                   kl,
+                                             int                   ku,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       AB,
+                                             int                   ldab);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    trmv performs one of the matrix-vector operations
-
-         x = A*x or x = A**T*x,
+    getgb converts the band with kl sub-diagonals and ku super-diagonals of the m by n matrix A
+    in full storage to the band matrix AB in band storage, the reverse of gbtge
 
-    where x is an n element vector and A is an n by n unit, or non-unit, upper or lower triangular matrix.
+        AB(ku + i - j, j) := A(i, j)      for max( 0, j - ku ) <= i <= min( m - 1, j + kl ).
 
-    The vector x is overwritten.
+    The elements of AB outside the band are not written.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
-    @param[in]
-    transA     [hipblasOperation_t]
-
-    @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
-
     @param[in]
     m         [int]
-              m specifies the number of rows of A. m >= 0.
-
+              the number of rows of A. m >= 0.
     @param[in]
-    A         device pointer storing matrix A,
-              of dimension ( lda, m )
-
+    n         [int]
+              the number of columns of A. n >= 0.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A.
-              lda = max( 1, m ).
-
+    kl        [int]
+              the number of sub-diagonals of the band. kl >= 0.
     @param[in]
-    x         device pointer storing vector x.
-
+    ku        [int]
+              the number of super-diagonals of the band. ku >= 0.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of x.
-
-    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmv(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
-                                            hipblasOperation_t          transA,
-                                            hipblasDiagType_t           diag,
-                                            int                         m,
-                                            const hipblasDoubleComplex* A,
-                                            int                         lda,
-                                            hipblasDoubleComplex*       x,
-                                            int                         incx);
+    A         device pointer to the matrix,
+              of dimension ( lda, n ).
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. lda >= max( 1, m ).
+    @param[out]
+    AB        device pointer to the matrix,
+              of dimension ( ldab, n ).
+    @param[in]
+    ldab      [int]
+              specifies the leading dimension of AB. ldab >= kl + ku + 1.
 
-// trmvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
-                                                   hipblasFillMode_t  uplo,
-                                                   hipblasOperation_t transA,
-                                                   hipblasDiagType_t  diag,
-                                                   int                m,
-                                                   const float* const A[],
-                                                   int                lda,
-                                                   float* const       x[],
-                                                   int                incx,
-                                                   int                batchCount);
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetgb(hipblasHandle_t             handle,
+                                             int                         m,
+                                             int                         n,
+                                             int                         kl,
+                                             int                         ku,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             hipblasDoubleComplex*       AB,
+                                             int                         ldab);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   hipblasOperation_t  transA,
-                                                   hipblasDiagType_t   diag,
-                                                   int                 m,
-                                                   const double* const A[],
-                                                   int                 lda,
-                                                   double* const       x[],
-                                                   int                 incx,
-                                                   int                 batchCount);
+// getgbBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetgbBatched(hipblasHandle_t    handle,
+                                                    int                m,
+                                                    int                n,
+                                                    int                kl,
+                                                    int                ku,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    float* const       AB[],
+                                                    int                ldab,
+                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
-                                                   hipblasDiagType_t           diag,
-                                                   int                         m,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   hipblasComplex* const       x[],
-                                                   int                         incx,
-                                                   int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetgbBatched(hipblasHandle_t     handle,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 kl,
+                                                    int                 ku,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    double* const       AB[],
+                                                    int                 ldab,
+                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetgbBatched(hipblasHandle_t             handle,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         kl,
+                                                    int                         ku,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       AB[],
+                                                    int                         ldab,
+                                                    int                         batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    trmvBatched performs one of the matrix-vector operations
+    getgbBatched converts the band with kl sub-diagonals and ku super-diagonals of the m by n
+    matrix A_i in full storage to the band matrix AB_i in band storage, the reverse of gbtge
 
-         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
+        AB_i(ku + i - j, j) := A_i(i, j)      for max( 0, j - ku ) <= i <= min( m - 1, j + kl ).
 
-    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
+    The elements of AB_i outside the band are not written.
 
-    The vectors x_i are overwritten.
+    (A_i, AB_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
+    The arrays of pointers are read back to the host, so the call waits for the work queued
+    before on the stream of the handle, and fails with HIPBLAS_STATUS_NOT_SUPPORTED in
+    HIPBLAS_CAPTURE_MODE_SAFE.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
-
+    m         [int]
+              the number of rows of each A. m >= 0.
     @param[in]
-    transA     [hipblasOperation_t]
-
+    n         [int]
+              the number of columns of each A. n >= 0.
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
-
+    kl        [int]
+              the number of sub-diagonals of the band. kl >= 0.
     @param[in]
-    m         [int]
-              m specifies the number of rows of matrices A_i. m >= 0.
-
+    ku        [int]
+              the number of super-diagonals of the band. ku >= 0.
     @param[in]
-    A         device pointer storing pointer of matrices A_i,
-              of dimension ( lda, m )
-
+    A         device array of device pointers to the matrices,
+              of dimension ( lda, n ).
     @param[in]
     lda       [int]
-              specifies the leading dimension of A_i.
-              lda >= max( 1, m ).
-
-    @param[in]
-    x         device pointer storing vectors x_i.
-
+              specifies the leading dimension of each A. lda >= max( 1, m ).
+    @param[out]
+    AB        device array of device pointers to the matrices,
+              of dimension ( ldab, n ).
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of vectors x_i.
-
+    ldab      [int]
+              specifies the leading dimension of each AB. ldab >= kl + ku + 1.
     @param[in]
     batchCount [int]
-              The number of batched matrices/vectors.
-
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   hipblasOperation_t                transA,
-                                                   hipblasDiagType_t                 diag,
-                                                   int                               m,
-                                                   const hipblasDoubleComplex* const A[],
-                                                   int                               lda,
-                                                   hipblasDoubleComplex* const       x[],
-                                                   int                               incx,
-                                                   int                               batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetgbBatched(hipblasHandle_t                   handle,
+                                                    int                               m,
+                                                    int                               n,
+                                                    int                               kl,
+                                                    int                               ku,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    hipblasDoubleComplex* const       AB[],
+                                                    int                               ldab,
+                                                    int                               batchCount);
 
-// trmvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const float*       A,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          float*             x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          int                batchCount);
+// getgbStridedBatched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetgbStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const float*    A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           float*          AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           int             batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const double*      A,
-                                                          int                lda,
-                                                          hipblasStride      strideA,
-                                                          double*            x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
-                                                          int                batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetgbStridedBatched(hipblasHandle_t handle,
+                                                           int             m,
+                                                           int             n,
+                                                           int             kl,
+                                                           int             ku,
+                                                           const double*   A,
+                                                           int             lda,
+                                                           hipblasStride   strideA,
+                                                           double*         AB,
+                                                           int             ldab,
+                                                           hipblasStride   strideAB,
+                                                           int             batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          hipblasOperation_t    transA,
-                                                          hipblasDiagType_t     diag,
-                                                          int                   m,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          hipblasComplex*       x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
-                                                          int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetgbStridedBatched(hipblasHandle_t       handle,
+                                                           int                   m,
+                                                           int                   n,
+                                                           int                   kl,
+                                                           int                   ku,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           hipblasStride         strideA,
+                                                           hipblasComplex*       AB,
+                                                           int                   ldab,
+                                                           hipblasStride         strideAB,
+                                                           int                   batchCount);
 
 /*! \brief BLAS Level 2 API
 
     \details
-    trmvStridedBatched performs one of the matrix-vector operations
+    getgbStridedBatched converts the band with kl sub-diagonals and ku super-diagonals of the m
+    by n matrix A_i in full storage to the band matrix AB_i in band storage, the reverse of
+    gbtge
 
-         x_i = A_i*x_i or x_i = A**T*x_i, 0 \le i < batchCount
+        AB_i(ku + i - j, j) := A_i(i, j)      for max( 0, j - ku ) <= i <= min( m - 1, j + kl ).
 
-    where x_i is an n element vector and A_i is an n by n (unit, or non-unit, upper or lower triangular matrix)
-    with strides specifying how to retrieve $x_i$ (resp. $A_i$) from $x_{i-1}$ (resp. $A_i$).
+    The elements of AB_i outside the band are not written.
 
-    The vectors x_i are overwritten.
+    (A_i, AB_i) is the i-th instance of the batch, for i = 1, ..., batchCount.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
     @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix.
-
+    m         [int]
+              the number of rows of each A. m >= 0.
     @param[in]
-    transA     [hipblasOperation_t]
-
+    n         [int]
+              the number of columns of each A. n >= 0.
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A_i is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
-
+    kl        [int]
+              the number of sub-diagonals of the band. kl >= 0.
     @param[in]
-    m         [int]
-              m specifies the number of rows of matrices A_i. m >= 0.
-
+    ku        [int]
+              the number of super-diagonals of the band. ku >= 0.
     @param[in]
-    A         device pointer of the matrix A_0,
-              of dimension ( lda, m )
-
+    A         device pointer to the first matrix of the batch,
+              of dimension ( lda, n ).
     @param[in]
     lda       [int]
-              specifies the leading dimension of A_i.
-              lda >= max( 1, m ).
-
-    @param[in]
-    strideA  [hipblasStride]
-              stride from the start of one A_i matrix to the next A_{i + 1}
-
+              specifies the leading dimension of each A. lda >= max( 1, m ).
     @param[in]
-    x         device pointer storing the vector x_0.
-
+    strideA   [hipblasStride]
+              stride from the start of one A_i to the next A_(i + 1).
+    @param[out]
+    AB        device pointer to the first matrix of the batch,
+              of dimension ( ldab, n ).
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of one vector x.
-
+    ldab      [int]
+              specifies the leading dimension of each AB. ldab >= kl + ku + 1.
     @param[in]
-    stridex  [hipblasStride]
-              stride from the start of one x_i vector to the next x_{i + 1}
-
+    strideAB  [hipblasStride]
+              stride from the start of one AB_i to the next AB_(i + 1).
     @param[in]
     batchCount [int]
-              The number of batched matrices/vectors.
-
+              number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasDiagType_t           diag,
-                                                          int                         m,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          hipblasDoubleComplex*       x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetgbStridedBatched(hipblasHandle_t             handle,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         kl,
+                                                           int                         ku,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           hipblasStride               strideA,
+                                                           hipblasDoubleComplex*       AB,
+                                                           int                         ldab,
+                                                           hipblasStride               strideAB,
+                                                           int                         batchCount);
 
-// trsv
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
+// ================================
+// ========== LEVEL 3 =============
+// ================================
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
                                             int                m,
-                                            const float*       A,
+                                            int                n,
+                                            int                k,
+                                            const hipblasHalf* alpha,
+                                            const hipblasHalf* A,
                                             int                lda,
-                                            float*             x,
-                                            int                incx);
+                                            const hipblasHalf* B,
+                                            int                ldb,
+                                            const hipblasHalf* beta,
+                                            hipblasHalf*       C,
+                                            int                ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            hipblasDiagType_t  diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            const float*       B,
+                                            int                ldb,
+                                            const float*       beta,
+                                            float*             C,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
                                             int                m,
+                                            int                n,
+                                            int                k,
+                                            const double*      alpha,
                                             const double*      A,
                                             int                lda,
-                                            double*            x,
-                                            int                incx);
+                                            const double*      B,
+                                            int                ldb,
+                                            const double*      beta,
+                                            double*            C,
+                                            int                ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
-                                            hipblasDiagType_t     diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
+                                            hipblasOperation_t    transa,
+                                            hipblasOperation_t    transb,
                                             int                   m,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* alpha,
                                             const hipblasComplex* A,
                                             int                   lda,
-                                            hipblasComplex*       x,
-                                            int                   incx);
+                                            const hipblasComplex* B,
+                                            int                   ldb,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       C,
+                                            int                   ldc);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 3 API
 
     \details
-    trsv solves
+    gemm performs one of the matrix-matrix operations
 
-         A*x = b or A**T*x = b,
+        C = alpha*op( A )*op( B ) + beta*C,
 
-    where x and b are vectors and A is a triangular matrix.
+    where op( X ) is one of
 
-    The vector x is overwritten on b.
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B and C are matrices, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
     @param[in]
-    transA     [hipblasOperation_t]
-
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
-
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
     @param[in]
     m         [int]
-              m specifies the number of rows of b. m >= 0.
-
+              number or rows of matrices op( A ) and C
     @param[in]
-    A         device pointer storing matrix A,
-              of dimension ( lda, m )
-
+    n         [int]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer storing matrix A.
     @param[in]
     lda       [int]
               specifies the leading dimension of A.
-              lda = max( 1, m ).
-
     @param[in]
-    x         device pointer storing vector x.
-
+    B         device pointer storing matrix B.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of x.
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         device pointer storing matrix C on the GPU.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
-                                            hipblasOperation_t          transA,
-                                            hipblasDiagType_t           diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
                                             int                         m,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* alpha,
                                             const hipblasDoubleComplex* A,
                                             int                         lda,
-                                            hipblasDoubleComplex*       x,
-                                            int                         incx);
+                                            const hipblasDoubleComplex* B,
+                                            int                         ldb,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       C,
+                                            int                         ldc);
 
-// trsvBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
-                                                   hipblasFillMode_t  uplo,
-                                                   hipblasOperation_t transA,
-                                                   hipblasDiagType_t  diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
+                                                   hipblasOperation_t       transa,
+                                                   hipblasOperation_t       transb,
+                                                   int                      m,
+                                                   int                      n,
+                                                   int                      k,
+                                                   const hipblasHalf*       alpha,
+                                                   const hipblasHalf* const A[],
+                                                   int                      lda,
+                                                   const hipblasHalf* const B[],
+                                                   int                      ldb,
+                                                   const hipblasHalf*       beta,
+                                                   hipblasHalf* const       C[],
+                                                   int                      ldc,
+                                                   int                      batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
                                                    int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const float*       alpha,
                                                    const float* const A[],
                                                    int                lda,
-                                                   float* const       x[],
-                                                   int                incx,
+                                                   const float* const B[],
+                                                   int                ldb,
+                                                   const float*       beta,
+                                                   float* const       C[],
+                                                   int                ldc,
                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
-                                                   hipblasFillMode_t   uplo,
-                                                   hipblasOperation_t  transA,
-                                                   hipblasDiagType_t   diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transa,
+                                                   hipblasOperation_t  transb,
                                                    int                 m,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double*       alpha,
                                                    const double* const A[],
                                                    int                 lda,
-                                                   double* const       x[],
-                                                   int                 incx,
+                                                   const double* const B[],
+                                                   int                 ldb,
+                                                   const double*       beta,
+                                                   double* const       C[],
+                                                   int                 ldc,
                                                    int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
-                                                   hipblasDiagType_t           diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transa,
+                                                   hipblasOperation_t          transb,
                                                    int                         m,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasComplex*       alpha,
                                                    const hipblasComplex* const A[],
                                                    int                         lda,
-                                                   hipblasComplex* const       x[],
-                                                   int                         incx,
+                                                   const hipblasComplex* const B[],
+                                                   int                         ldb,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       C[],
+                                                   int                         ldc,
                                                    int                         batchCount);
 
-/*! \brief BLAS Level 2 API
-
-    \details
-    trsvBatched solves
-
-         A_i*x_i = b_i or A_i**T*x_i = b_i,
-
-    where (A_i, x_i, b_i) is the i-th instance of the batch.
-    x_i and b_i are vectors and A_i is an
-    m by m triangular matrix.
-
-    The vector x is overwritten on b.
-
+/*! \brief BLAS Level 3 API
+     \details
+    gemmBatched performs one of the batched matrix-matrix operations
+         C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount.
+     where op( X ) is one of
+         op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+     alpha and beta are scalars, and A, B and C are strided batched matrices, with
+    op( A ) an m by k by batchCount strided_batched matrix,
+    op( B ) an k by n by batchCount strided_batched matrix and
+    C an m by n by batchCount strided_batched matrix.
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
     @param[in]
-    transA     [hipblasOperation_t]
-
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
-
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
     @param[in]
     m         [int]
-              m specifies the number of rows of b. m >= 0.
-
+              matrix dimention m.
+    @param[in]
+    n         [int]
+              matrix dimention n.
+    @param[in]
+    k         [int]
+              matrix dimention k.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
     @param[in]
     A         device array of device pointers storing each matrix A_i.
-
     @param[in]
     lda       [int]
               specifies the leading dimension of each A_i.
-              lda = max(1, m)
-
     @param[in]
-    x         device array of device pointers storing each vector x_i.
-
+    B         device array of device pointers storing each matrix B_i.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of x.
-
+    ldb       [int]
+              specifies the leading dimension of each B_i.
     @param[in]
-    batchCount [int]
-                number of instances in the batch
-
-    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   hipblasOperation_t                transA,
-                                                   hipblasDiagType_t                 diag,
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
+                                                   hipblasOperation_t                transa,
+                                                   hipblasOperation_t                transb,
                                                    int                               m,
+                                                   int                               n,
+                                                   int                               k,
+                                                   const hipblasDoubleComplex*       alpha,
                                                    const hipblasDoubleComplex* const A[],
                                                    int                               lda,
-                                                   hipblasDoubleComplex* const       x[],
-                                                   int                               incx,
+                                                   const hipblasDoubleComplex* const B[],
+                                                   int                               ldb,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex* const       C[],
+                                                   int                               ldc,
                                                    int                               batchCount);
 
-// trsvStridedBatched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const hipblasHalf* alpha,
+                                                          const hipblasHalf* A,
+                                                          int                lda,
+                                                          long long          strideA,
+                                                          const hipblasHalf* B,
+                                                          int                ldb,
+                                                          long long          strideB,
+                                                          const hipblasHalf* beta,
+                                                          hipblasHalf*       C,
+                                                          int                ldc,
+                                                          long long          strideC,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
                                                           int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const float*       alpha,
                                                           const float*       A,
                                                           int                lda,
-                                                          hipblasStride      strideA,
-                                                          float*             x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
+                                                          long long          strideA,
+                                                          const float*       B,
+                                                          int                ldb,
+                                                          long long          strideB,
+                                                          const float*       beta,
+                                                          float*             C,
+                                                          int                ldc,
+                                                          long long          strideC,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
-                                                          hipblasDiagType_t  diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
                                                           int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const double*      alpha,
                                                           const double*      A,
                                                           int                lda,
-                                                          hipblasStride      strideA,
-                                                          double*            x,
-                                                          int                incx,
-                                                          hipblasStride      stridex,
+                                                          long long          strideA,
+                                                          const double*      B,
+                                                          int                ldb,
+                                                          long long          strideB,
+                                                          const double*      beta,
+                                                          double*            C,
+                                                          int                ldc,
+                                                          long long          strideC,
                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          hipblasOperation_t    transA,
-                                                          hipblasDiagType_t     diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    transa,
+                                                          hipblasOperation_t    transb,
                                                           int                   m,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const hipblasComplex* alpha,
                                                           const hipblasComplex* A,
                                                           int                   lda,
-                                                          hipblasStride         strideA,
-                                                          hipblasComplex*       x,
-                                                          int                   incx,
-                                                          hipblasStride         stridex,
+                                                          long long             strideA,
+                                                          const hipblasComplex* B,
+                                                          int                   ldb,
+                                                          long long             strideB,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          long long             strideC,
                                                           int                   batchCount);
 
-/*! \brief BLAS Level 2 API
+/*! \brief BLAS Level 3 API
 
     \details
-    trsvStridedBatched solves
+    gemmStridedBatched performs one of the strided batched matrix-matrix operations
 
-         A_i*x_i = b_i or A_i**T*x_i = b_i,
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount.
 
-    where (A_i, x_i, b_i) is the i-th instance of the batch.
-    x_i and b_i are vectors and A_i is an m by m triangular matrix, for i = 1, ..., batchCount.
+    where op( X ) is one of
 
-    The vector x is overwritten on b.
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B and C are strided batched matrices, with
+    op( A ) an m by k by batchCount strided_batched matrix,
+    op( B ) an k by n by batchCount strided_batched matrix and
+    C an m by n by batchCount strided_batched matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
-
-    @param[in]
-    uplo    [hipblasFillMode_t]
-            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
-
     @param[in]
-    transA     [hipblasOperation_t]
-
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
     @param[in]
-    diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     A is assumed to be unit triangular.
-            HIPBLAS_DIAG_NON_UNIT:  A is not assumed to be unit triangular.
-
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
     @param[in]
     m         [int]
-              m specifies the number of rows of each b_i. m >= 0.
-
+              matrix dimention m.
     @param[in]
-    A         device pointer to the first matrix (A_1) in the batch, of dimension ( lda, m )
-
+    n         [int]
+              matrix dimention n.
     @param[in]
-    strideA  [hipblasStride]
-              stride from the start of one A_i matrix to the next A_(i + 1)
-
+    k         [int]
+              matrix dimention k.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         device pointer pointing to the first matrix A_1.
     @param[in]
     lda       [int]
               specifies the leading dimension of each A_i.
-              lda = max( 1, m ).
-
+    @param[in]
+    strideA  [hipblasStride]
+              stride from the start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    B         device pointer pointing to the first matrix B_1.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB  [hipblasStride]
+              stride from the start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
     @param[in, out]
-    x         device pointer to the first vector (x_1) in the batch.
-
+    C         device pointer pointing to the first matrix C_1.
     @param[in]
-    stridex [hipblasStride]
-             stride from the start of one x_i vector to the next x_(i + 1)
-
+    ldc       [int]
+              specifies the leading dimension of each C_i.
     @param[in]
-    incx      [int]
-              specifies the increment for the elements of each x_i.
-
+    strideC  [hipblasStride]
+              stride from the start of one C_i matrix to the next C_(i + 1).
     @param[in]
-    batchCount [int]
-                number of instances in the batch
+    batchCount
+              [int]
+              number of gemm operatons in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasDiagType_t           diag,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          transa,
+                                                          hipblasOperation_t          transb,
                                                           int                         m,
+                                                          int                         n,
+                                                          int                         k,
+                                                          const hipblasDoubleComplex* alpha,
                                                           const hipblasDoubleComplex* A,
                                                           int                         lda,
-                                                          hipblasStride               strideA,
-                                                          hipblasDoubleComplex*       x,
-                                                          int                         incx,
-                                                          hipblasStride               stridex,
+                                                          long long                   strideA,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          long long                   strideB,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          long long                   strideC,
                                                           int                         batchCount);
 
-// ================================
-// ========== LEVEL 3 =============
-// ================================
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatchedHostPtrs(hipblasHandle_t          handle,
+                                                           hipblasOperation_t       transa,
+                                                           hipblasOperation_t       transb,
+                                                           int                      m,
+                                                           int                      n,
+                                                           int                      k,
+                                                           const hipblasHalf*       alpha,
+                                                           const hipblasHalf* const A[],
+                                                           int                      lda,
+                                                           const hipblasHalf* const B[],
+                                                           int                      ldb,
+                                                           const hipblasHalf*       beta,
+                                                           hipblasHalf* const       C[],
+                                                           int                      ldc,
+                                                           int                      batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transa,
+                                                           hipblasOperation_t transb,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const float*       alpha,
+                                                           const float* const A[],
+                                                           int                lda,
+                                                           const float* const B[],
+                                                           int                ldb,
+                                                           const float*       beta,
+                                                           float* const       C[],
+                                                           int                ldc,
+                                                           int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
-                                            hipblasOperation_t transa,
-                                            hipblasOperation_t transb,
-                                            int                m,
-                                            int                n,
-                                            int                k,
-                                            const hipblasHalf* alpha,
-                                            const hipblasHalf* A,
-                                            int                lda,
-                                            const hipblasHalf* B,
-                                            int                ldb,
-                                            const hipblasHalf* beta,
-                                            hipblasHalf*       C,
-                                            int                ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatchedHostPtrs(hipblasHandle_t     handle,
+                                                           hipblasOperation_t  transa,
+                                                           hipblasOperation_t  transb,
+                                                           int                 m,
+                                                           int                 n,
+                                                           int                 k,
+                                                           const double*       alpha,
+                                                           const double* const A[],
+                                                           int                 lda,
+                                                           const double* const B[],
+                                                           int                 ldb,
+                                                           const double*       beta,
+                                                           double* const       C[],
+                                                           int                 ldc,
+                                                           int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasOperation_t          transa,
+                                                           hipblasOperation_t          transb,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex* const B[],
+                                                           int                         ldb,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
-                                            hipblasOperation_t transa,
-                                            hipblasOperation_t transb,
-                                            int                m,
-                                            int                n,
-                                            int                k,
-                                            const float*       alpha,
-                                            const float*       A,
-                                            int                lda,
-                                            const float*       B,
-                                            int                ldb,
-                                            const float*       beta,
-                                            float*             C,
-                                            int                ldc);
+/*! \brief BLAS Level 3 API
+
+    \details
+    gemmBatchedHostPtrs performs the batched matrix-matrix operations of gemmBatched
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
-                                            hipblasOperation_t transa,
-                                            hipblasOperation_t transb,
-                                            int                m,
-                                            int                n,
-                                            int                k,
-                                            const double*      alpha,
-                                            const double*      A,
-                                            int                lda,
-                                            const double*      B,
-                                            int                ldb,
-                                            const double*      beta,
-                                            double*            C,
-                                            int                ldc);
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
-                                            hipblasOperation_t    transa,
-                                            hipblasOperation_t    transb,
-                                            int                   m,
-                                            int                   n,
-                                            int                   k,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
-                                            int                   lda,
-                                            const hipblasComplex* B,
-                                            int                   ldb,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       C,
-                                            int                   ldc);
+    with the arrays of pointers to the matrices A_i, B_i and C_i in host memory; the
+    matrices themselves are in device memory. When the pointers of every array are
+    evenly spaced, as for matrices carved out of one allocation, the call is issued as
+    gemmStridedBatched and the arrays are not copied to the device. Otherwise they are
+    copied to a pointer array workspace kept by the handle, on the stream of the handle,
+    and the call is issued as gemmBatched.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int]
+              matrix dimention m.
+    @param[in]
+    n         [int]
+              matrix dimention n.
+    @param[in]
+    k         [int]
+              matrix dimention k.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         host array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    B         host array of device pointers storing each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    batchCount
+              [int]
+              number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                                           hipblasOperation_t                transa,
+                                                           hipblasOperation_t                transb,
+                                                           int                               m,
+                                                           int                               n,
+                                                           int                               k,
+                                                           const hipblasDoubleComplex*       alpha,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           int                               lda,
+                                                           const hipblasDoubleComplex* const B[],
+                                                           int                               ldb,
+                                                           const hipblasDoubleComplex*       beta,
+                                                           hipblasDoubleComplex* const       C[],
+                                                           int                               ldc,
+                                                           int batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3m(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc);
 
 /*! \brief BLAS Level 3 API
 
     \details
-    gemm performs one of the matrix-matrix operations
+    gemm3m performs the complex matrix-matrix operation of gemm
 
         C = alpha*op( A )*op( B ) + beta*C,
 
-    where op( X ) is one of
+    forming op( A )*op( B ) from three real matrix products where gemm does the work of
+    four. With op( A ) = Ar + i*Ai and op( B ) = Br + i*Bi,
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+        op( A )*op( B ) = (Ar*Br - Ai*Bi) + i*((Ar + Ai)*(Br + Bi) - Ar*Br - Ai*Bi),
 
-    alpha and beta are scalars, and A, B and C are matrices, with
-    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n matrix.
+    which saves about a quarter of the floating point operations for large matrices.
+    The gain is paid in accuracy of the imaginary part. With u the unit roundoff, the
+    computed product differs from the exact one by (Higham, 1992)
+
+        |real error|      <= (k + 1)*u*(|Ar|*|Br| + |Ai|*|Bi|) + O(u^2),
+        |imaginary error| <= (k + 4)*u*(|Ar| + |Ai|)*(|Br| + |Bi|) + O(u^2),
+
+    elementwise. The bound on the real part is the one of gemm; the one on the imaginary
+    part is weaker when the real and the imaginary parts differ widely in magnitude, or
+    when Ar*Bi and Ai*Br cancel. Use gemm where that matters.
+
+    On the AMD backend the parts of op( A ) and op( B ) and of the product are held in
+    a device workspace kept by the handle, of 2*(lda*cols(A) + ldb*cols(B) + 2*m*n) reals
+    per matrix, where cols(X) is the number of columns of X as stored, and work is queued
+    on the stream of the handle; large batches are run in groups.
+    Problems too large for the workspace indexing, and problems with k or alpha equal
+    to zero, are run as gemm. On the NVIDIA backend the cuBLAS 3M routines are called.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -9810,97 +12772,51 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
               specifies the leading dimension of C.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
-                                            hipblasOperation_t          transa,
-                                            hipblasOperation_t          transb,
-                                            int                         m,
-                                            int                         n,
-                                            int                         k,
-                                            const hipblasDoubleComplex* alpha,
-                                            const hipblasDoubleComplex* A,
-                                            int                         lda,
-                                            const hipblasDoubleComplex* B,
-                                            int                         ldb,
-                                            const hipblasDoubleComplex* beta,
-                                            hipblasDoubleComplex*       C,
-                                            int                         ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3m(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              const hipblasDoubleComplex* B,
+                                              int                         ldb,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3mBatched(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          transa,
+                                                     hipblasOperation_t          transb,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const A[],
+                                                     int                         lda,
+                                                     const hipblasComplex* const B[],
+                                                     int                         ldb,
+                                                     const hipblasComplex*       beta,
+                                                     hipblasComplex* const       C[],
+                                                     int                         ldc,
+                                                     int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
-                                                   hipblasOperation_t       transa,
-                                                   hipblasOperation_t       transb,
-                                                   int                      m,
-                                                   int                      n,
-                                                   int                      k,
-                                                   const hipblasHalf*       alpha,
-                                                   const hipblasHalf* const A[],
-                                                   int                      lda,
-                                                   const hipblasHalf* const B[],
-                                                   int                      ldb,
-                                                   const hipblasHalf*       beta,
-                                                   hipblasHalf* const       C[],
-                                                   int                      ldc,
-                                                   int                      batchCount);
+/*! \brief BLAS Level 3 API
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
-                                                   hipblasOperation_t transa,
-                                                   hipblasOperation_t transb,
-                                                   int                m,
-                                                   int                n,
-                                                   int                k,
-                                                   const float*       alpha,
-                                                   const float* const A[],
-                                                   int                lda,
-                                                   const float* const B[],
-                                                   int                ldb,
-                                                   const float*       beta,
-                                                   float* const       C[],
-                                                   int                ldc,
-                                                   int                batchCount);
+    \details
+    gemm3mBatched performs the batched complex matrix-matrix operations of gemmBatched
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
-                                                   hipblasOperation_t  transa,
-                                                   hipblasOperation_t  transb,
-                                                   int                 m,
-                                                   int                 n,
-                                                   int                 k,
-                                                   const double*       alpha,
-                                                   const double* const A[],
-                                                   int                 lda,
-                                                   const double* const B[],
-                                                   int                 ldb,
-                                                   const double*       beta,
-                                                   double* const       C[],
-                                                   int                 ldc,
-                                                   int                 batchCount);
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          transa,
-                                                   hipblasOperation_t          transb,
-                                                   int                         m,
-                                                   int                         n,
-                                                   int                         k,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
-                                                   int                         lda,
-                                                   const hipblasComplex* const B[],
-                                                   int                         ldb,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex* const       C[],
-                                                   int                         ldc,
-                                                   int                         batchCount);
+    by the 3M method of gemm3m, with its error bounds. On the AMD backend the arrays of
+    pointers are read back to the host; when every array is evenly spaced the batch is
+    run as gemm3mStridedBatched, otherwise from the arrays of pointers, in the same number
+    of calls. The read back waits on
+    the stream, so the call returns HIPBLAS_STATUS_NOT_SUPPORTED while the stream of
+    the handle is being captured in a graph.
 
-/*! \brief BLAS Level 3 API
-     \details
-    gemmBatched performs one of the batched matrix-matrix operations
-         C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount.
-     where op( X ) is one of
-         op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
-     alpha and beta are scalars, and A, B and C are strided batched matrices, with
-    op( A ) an m by k by batchCount strided_batched matrix,
-    op( B ) an k by n by batchCount strided_batched matrix and
-    C an m by n by batchCount strided_batched matrix.
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
@@ -9927,131 +12843,67 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             h
     lda       [int]
               specifies the leading dimension of each A_i.
     @param[in]
-    B         device array of device pointers storing each matrix B_i.
-    @param[in]
-    ldb       [int]
-              specifies the leading dimension of each B_i.
-    @param[in]
-    beta      device pointer or host pointer specifying the scalar beta.
-    @param[in, out]
-    C         device array of device pointers storing each matrix C_i.
-    @param[in]
-    ldc       [int]
-              specifies the leading dimension of each C_i.
-    @param[in]
-    batchCount
-              [int]
-              number of gemm operations in the batch
-     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
-                                                   hipblasOperation_t                transa,
-                                                   hipblasOperation_t                transb,
-                                                   int                               m,
-                                                   int                               n,
-                                                   int                               k,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const A[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex* const B[],
-                                                   int                               ldb,
-                                                   const hipblasDoubleComplex*       beta,
-                                                   hipblasDoubleComplex* const       C[],
-                                                   int                               ldc,
-                                                   int                               batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transa,
-                                                          hipblasOperation_t transb,
-                                                          int                m,
-                                                          int                n,
-                                                          int                k,
-                                                          const hipblasHalf* alpha,
-                                                          const hipblasHalf* A,
-                                                          int                lda,
-                                                          long long          strideA,
-                                                          const hipblasHalf* B,
-                                                          int                ldb,
-                                                          long long          strideB,
-                                                          const hipblasHalf* beta,
-                                                          hipblasHalf*       C,
-                                                          int                ldc,
-                                                          long long          strideC,
-                                                          int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transa,
-                                                          hipblasOperation_t transb,
-                                                          int                m,
-                                                          int                n,
-                                                          int                k,
-                                                          const float*       alpha,
-                                                          const float*       A,
-                                                          int                lda,
-                                                          long long          strideA,
-                                                          const float*       B,
-                                                          int                ldb,
-                                                          long long          strideB,
-                                                          const float*       beta,
-                                                          float*             C,
-                                                          int                ldc,
-                                                          long long          strideC,
-                                                          int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transa,
-                                                          hipblasOperation_t transb,
-                                                          int                m,
-                                                          int                n,
-                                                          int                k,
-                                                          const double*      alpha,
-                                                          const double*      A,
-                                                          int                lda,
-                                                          long long          strideA,
-                                                          const double*      B,
-                                                          int                ldb,
-                                                          long long          strideB,
-                                                          const double*      beta,
-                                                          double*            C,
-                                                          int                ldc,
-                                                          long long          strideC,
-                                                          int                batchCount);
+    B         device array of device pointers storing each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    transa,
-                                                          hipblasOperation_t    transb,
-                                                          int                   m,
-                                                          int                   n,
-                                                          int                   k,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          long long             strideA,
-                                                          const hipblasComplex* B,
-                                                          int                   ldb,
-                                                          long long             strideB,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       C,
-                                                          int                   ldc,
-                                                          long long             strideC,
-                                                          int                   batchCount);
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3mBatched(hipblasHandle_t                   handle,
+                                                     hipblasOperation_t                transa,
+                                                     hipblasOperation_t                transb,
+                                                     int                               m,
+                                                     int                               n,
+                                                     int                               k,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     int                               lda,
+                                                     const hipblasDoubleComplex* const B[],
+                                                     int                               ldb,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     hipblasDoubleComplex* const       C[],
+                                                     int                               ldc,
+                                                     int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3mStridedBatched(hipblasHandle_t       handle,
+                                                            hipblasOperation_t    transa,
+                                                            hipblasOperation_t    transb,
+                                                            int                   m,
+                                                            int                   n,
+                                                            int                   k,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* A,
+                                                            int                   lda,
+                                                            long long             strideA,
+                                                            const hipblasComplex* B,
+                                                            int                   ldb,
+                                                            long long             strideB,
+                                                            const hipblasComplex* beta,
+                                                            hipblasComplex*       C,
+                                                            int                   ldc,
+                                                            long long             strideC,
+                                                            int                   batchCount);
 
 /*! \brief BLAS Level 3 API
 
     \details
-    gemmStridedBatched performs one of the strided batched matrix-matrix operations
-
-        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount.
-
-    where op( X ) is one of
+    gemm3mStridedBatched performs the strided batched complex matrix-matrix operations of
+    gemmStridedBatched
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
 
-    alpha and beta are scalars, and A, B and C are strided batched matrices, with
-    op( A ) an m by k by batchCount strided_batched matrix,
-    op( B ) an k by n by batchCount strided_batched matrix and
-    C an m by n by batchCount strided_batched matrix.
+    by the 3M method of gemm3m, with its error bounds and its workspace per matrix.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -10079,7 +12931,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t
     lda       [int]
               specifies the leading dimension of each A_i.
     @param[in]
-    strideA  [hipblasStride]
+    strideA   [long long]
               stride from the start of one A_i matrix to the next A_(i + 1).
     @param[in]
     B         device pointer pointing to the first matrix B_1.
@@ -10087,7 +12939,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t
     ldb       [int]
               specifies the leading dimension of each B_i.
     @param[in]
-    strideB  [hipblasStride]
+    strideB   [long long]
               stride from the start of one B_i matrix to the next B_(i + 1).
     @param[in]
     beta      device pointer or host pointer specifying the scalar beta.
@@ -10097,7 +12949,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t
     ldc       [int]
               specifies the leading dimension of each C_i.
     @param[in]
-    strideC  [hipblasStride]
+    strideC   [long long]
               stride from the start of one C_i matrix to the next C_(i + 1).
     @param[in]
     batchCount
@@ -10105,24 +12957,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t
               number of gemm operatons in the batch
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasOperation_t          transa,
-                                                          hipblasOperation_t          transb,
-                                                          int                         m,
-                                                          int                         n,
-                                                          int                         k,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          long long                   strideA,
-                                                          const hipblasDoubleComplex* B,
-                                                          int                         ldb,
-                                                          long long                   strideB,
-                                                          const hipblasDoubleComplex* beta,
-                                                          hipblasDoubleComplex*       C,
-                                                          int                         ldc,
-                                                          long long                   strideC,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3mStridedBatched(hipblasHandle_t             handle,
+                                                            hipblasOperation_t          transa,
+                                                            hipblasOperation_t          transb,
+                                                            int                         m,
+                                                            int                         n,
+                                                            int                         k,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* A,
+                                                            int                         lda,
+                                                            long long                   strideA,
+                                                            const hipblasDoubleComplex* B,
+                                                            int                         ldb,
+                                                            long long                   strideB,
+                                                            const hipblasDoubleComplex* beta,
+                                                            hipblasDoubleComplex*       C,
+                                                            int                         ldc,
+                                                            long long                   strideC,
+                                                            int                         batchCount);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
@@ -10419,6 +13271,100 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasOperation_t          transA,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const float*                alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const float*                beta,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    herkBatchedHostPtrs performs the batched hermitian rank-k updates of herkBatched
+
+        C_i := alpha*op( A_i )*op( A_i )^H + beta*C_i, for i = 1, ..., batchCount,
+
+    with the arrays of pointers to the matrices A_i and C_i in host memory; the matrices
+    themselves are in device memory. When the pointers of both arrays are evenly spaced the call
+    is issued as herkStridedBatched and the arrays are not copied to the device. Otherwise they
+    are copied to a pointer array workspace kept by the handle, on the stream of the handle, and
+    the call is issued as herkBatched.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  C_i is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  C_i is a  lower triangular matrix
+
+    @param[in]
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_C: op(A) = A^H
+            HIPBLAS_OP_N: op(A) = A
+
+    @param[in]
+    n       [int]
+            n specifies the number of rows and columns of C_i. n >= 0.
+
+    @param[in]
+    k       [int]
+            k specifies the number of columns of op(A). k >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A is not referenced and A need not be set before
+            entry.
+
+    @param[in]
+    A       host array of device pointers storing each matrix_i A of dimension (lda, k)
+            when transA is HIPBLAS_OP_N, otherwise of dimension (lda, n)
+
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A_i.
+            if transA = HIPBLAS_OP_N,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
+
+    @param[in]
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C need not be set before entry.
+
+    @param[in]
+    C       host array of device pointers storing each matrix C_i on the GPU.
+            The imaginary component of the diagonal elements are not used but are set to zero unless quick return.
+
+    @param[in]
+    ldc    [int]
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatchedHostPtrs(hipblasHandle_t                   handle,
+                                                           hipblasFillMode_t                 uplo,
+                                                           hipblasOperation_t                transA,
+                                                           int                               n,
+                                                           int                               k,
+                                                           const double*                     alpha,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           int                               lda,
+                                                           const double*                     beta,
+                                                           hipblasDoubleComplex* const       C[],
+                                                           int                               ldc,
+                                                           int batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
                                              hipblasFillMode_t     uplo,
                                              hipblasOperation_t    transA,
@@ -11406,35 +14352,186 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   hand
                                                           hipblasStride     strideC,
                                                           int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasSideMode_t     side,
-                                                          hipblasFillMode_t     uplo,
-                                                          int                   m,
-                                                          int                   n,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
-                                                          int                   lda,
-                                                          hipblasStride         strideA,
-                                                          const hipblasComplex* B,
-                                                          int                   ldb,
-                                                          hipblasStride         strideB,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       C,
-                                                          int                   ldc,
-                                                          hipblasStride         strideC,
-                                                          int                   batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          hipblasStride         strideA,
+                                                          const hipblasComplex* B,
+                                                          int                   ldb,
+                                                          hipblasStride         strideB,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          hipblasStride         strideC,
+                                                          int                   batchCount);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+
+    symmStridedBatched performs a batch of the matrix-matrix operations:
+
+    C_i := alpha*A_i*B_i + beta*C_i if side == HIPBLAS_SIDE_LEFT,
+    C_i := alpha*B_i*A_i + beta*C_i if side == HIPBLAS_SIDE_RIGHT,
+
+    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
+    A_i is a symmetric matrix stored as either upper or lower.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    side  [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:      C_i := alpha*A_i*B_i + beta*C_i
+            HIPBLAS_SIDE_RIGHT:     C_i := alpha*B_i*A_i + beta*C_i
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  A_i is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  A_i is a  lower triangular matrix
+
+    @param[in]
+    m       [int]
+            m specifies the number of rows of B_i and C_i. m >= 0.
+
+    @param[in]
+    n       [int]
+            n specifies the number of columns of B_i and C_i. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A_i and B_i are not referenced.
+
+    @param[in]
+    A       device pointer to first matrix A_1
+            A_i is m by m if side == HIPBLAS_SIDE_LEFT
+            A_i is n by n if side == HIPBLAS_SIDE_RIGHT
+            only the upper/lower triangular part is accessed.
+
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A_i.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            otherwise lda >= max( 1, n ).
+
+    @param[in]
+    strideA  [hipblasStride]
+              stride from the start of one matrix (A_i) and the next one (A_i+1)
+
+    @param[in]
+    B       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU.
+
+    @param[in]
+    ldb     [int]
+            ldb specifies the first dimension of B_i. ldb >= max( 1, m )
+
+    @param[in]
+    strideB  [hipblasStride]
+              stride from the start of one matrix (B_i) and the next one (B_i+1)
+    @param[in]
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C need not be set before entry.
+
+    @param[in]
+    C        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
+
+    @param[in]
+    ldc    [int]
+           ldc specifies the first dimension of C. ldc >= max( 1, m ).
+
+    @param[inout]
+    strideC  [hipblasStride]
+              stride from the start of one matrix (C_i) and the next one (C_i+1)
+
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasSideMode_t           side,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          hipblasStride               strideB,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          hipblasStride               strideC,
+                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasSideMode_t  side,
+                                                           hipblasFillMode_t  uplo,
+                                                           int                m,
+                                                           int                n,
+                                                           const float*       alpha,
+                                                           const float* const A[],
+                                                           int                lda,
+                                                           const float* const B[],
+                                                           int                ldb,
+                                                           const float*       beta,
+                                                           float* const       C[],
+                                                           int                ldc,
+                                                           int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmBatchedHostPtrs(hipblasHandle_t     handle,
+                                                           hipblasSideMode_t   side,
+                                                           hipblasFillMode_t   uplo,
+                                                           int                 m,
+                                                           int                 n,
+                                                           const double*       alpha,
+                                                           const double* const A[],
+                                                           int                 lda,
+                                                           const double* const B[],
+                                                           int                 ldb,
+                                                           const double*       beta,
+                                                           double* const       C[],
+                                                           int                 ldc,
+                                                           int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasSideMode_t           side,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex* const B[],
+                                                           int                         ldb,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount);
 
 /*! \brief BLAS Level 3 API
 
     \details
+    symmBatchedHostPtrs performs the batched matrix-matrix operations of symmBatched
 
-    symmStridedBatched performs a batch of the matrix-matrix operations:
-
-    C_i := alpha*A_i*B_i + beta*C_i if side == HIPBLAS_SIDE_LEFT,
-    C_i := alpha*B_i*A_i + beta*C_i if side == HIPBLAS_SIDE_RIGHT,
+        C_i := alpha*A_i*B_i + beta*C_i or
+        C_i := alpha*B_i*A_i + beta*C_i, for i = 1, ..., batchCount,
 
-    where alpha and beta are scalars, B_i and C_i are m by n matrices, and
-    A_i is a symmetric matrix stored as either upper or lower.
+    with the arrays of pointers to the matrices A_i, B_i and C_i in host memory; the matrices
+    themselves are in device memory. When the pointers of every array are evenly spaced the call
+    is issued as symmStridedBatched and the arrays are not copied to the device. Otherwise they
+    are copied to a pointer array workspace kept by the handle, on the stream of the handle, and
+    the call is issued as symmBatched.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -11464,7 +14561,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t
             zero then A_i and B_i are not referenced.
 
     @param[in]
-    A       device pointer to first matrix A_1
+    A       host array of device pointers storing each matrix A_i on the GPU.
             A_i is m by m if side == HIPBLAS_SIDE_LEFT
             A_i is n by n if side == HIPBLAS_SIDE_RIGHT
             only the upper/lower triangular part is accessed.
@@ -11476,57 +14573,45 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t
             otherwise lda >= max( 1, n ).
 
     @param[in]
-    strideA  [hipblasStride]
-              stride from the start of one matrix (A_i) and the next one (A_i+1)
-
-    @param[in]
-    B       device pointer to first matrix B_1 of dimension (ldb, n) on the GPU.
+    B       host array of device pointers storing each matrix B_i on the GPU.
+            Matrix dimension is m by n
 
     @param[in]
     ldb     [int]
             ldb specifies the first dimension of B_i. ldb >= max( 1, m )
 
     @param[in]
-    strideB  [hipblasStride]
-              stride from the start of one matrix (B_i) and the next one (B_i+1)
-    @param[in]
     beta
             beta specifies the scalar beta. When beta is
-            zero then C need not be set before entry.
+            zero then C_i need not be set before entry.
 
     @param[in]
-    C        device pointer to first matrix C_1 of dimension (ldc, n) on the GPU.
+    C       host array of device pointers storing each matrix C_i on the GPU.
+            Matrix dimension is m by n
 
     @param[in]
     ldc    [int]
-           ldc specifies the first dimension of C. ldc >= max( 1, m ).
-
-    @param[inout]
-    strideC  [hipblasStride]
-              stride from the start of one matrix (C_i) and the next one (C_i+1)
+           ldc specifies the first dimension of C_i. ldc >= max( 1, m )
 
     @param[in]
     batchCount [int]
                 number of instances in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasSideMode_t           side,
-                                                          hipblasFillMode_t           uplo,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          const hipblasDoubleComplex* B,
-                                                          int                         ldb,
-                                                          hipblasStride               strideB,
-                                                          const hipblasDoubleComplex* beta,
-                                                          hipblasDoubleComplex*       C,
-                                                          int                         ldc,
-                                                          hipblasStride               strideC,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                                           hipblasSideMode_t                 side,
+                                                           hipblasFillMode_t                 uplo,
+                                                           int                               m,
+                                                           int                               n,
+                                                           const hipblasDoubleComplex*       alpha,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           int                               lda,
+                                                           const hipblasDoubleComplex* const B[],
+                                                           int                               ldb,
+                                                           const hipblasDoubleComplex*       beta,
+                                                           hipblasDoubleComplex* const       C[],
+                                                           int                               ldc,
+                                                           int batchCount);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
@@ -11911,6 +14996,129 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t
                                                           hipblasStride               strideC,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           int                n,
+                                                           int                k,
+                                                           const float*       alpha,
+                                                           const float* const A[],
+                                                           int                lda,
+                                                           const float*       beta,
+                                                           float* const       C[],
+                                                           int                ldc,
+                                                           int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkBatchedHostPtrs(hipblasHandle_t     handle,
+                                                           hipblasFillMode_t   uplo,
+                                                           hipblasOperation_t  transA,
+                                                           int                 n,
+                                                           int                 k,
+                                                           const double*       alpha,
+                                                           const double* const A[],
+                                                           int                 lda,
+                                                           const double*       beta,
+                                                           double* const       C[],
+                                                           int                 ldc,
+                                                           int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasOperation_t          transA,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex*       beta,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    syrkBatchedHostPtrs performs the batched symmetric rank-k updates of syrkBatched
+
+        C_i := alpha*op( A_i )*op( A_i )^T + beta*C_i, for i = 1, ..., batchCount,
+
+    with the arrays of pointers to the matrices A_i and C_i in host memory; the matrices
+    themselves are in device memory. When the pointers of both arrays are evenly spaced the call
+    is issued as syrkStridedBatched and the arrays are not copied to the device. Otherwise they
+    are copied to a pointer array workspace kept by the handle, on the stream of the handle, and
+    the call is issued as syrkBatched.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  C_i is an upper triangular matrix
+            HIPBLAS_FILL_MODE_LOWER:  C_i is a  lower triangular matrix
+
+    @param[in]
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_T: op(A) = A^T
+            HIPBLAS_OP_N: op(A) = A
+            HIPBLAS_OP_C: op(A) = A^T
+
+            HIPBLAS_OP_C is not supported for complex types, see cherk
+            and zherk.
+
+    @param[in]
+    n       [int]
+            n specifies the number of rows and columns of C_i. n >= 0.
+
+    @param[in]
+    k       [int]
+            k specifies the number of columns of op(A). k >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A is not referenced and A need not be set before
+            entry.
+
+    @param[in]
+    A       host array of device pointers storing each matrix_i A of dimension (lda, k)
+            when transA is HIPBLAS_OP_N, otherwise of dimension (lda, n)
+
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A_i.
+            if transA = HIPBLAS_OP_N,  lda >= max( 1, n ),
+            otherwise lda >= max( 1, k ).
+
+    @param[in]
+    beta
+            beta specifies the scalar beta. When beta is
+            zero then C need not be set before entry.
+
+    @param[in]
+    C       host array of device pointers storing each matrix C_i on the GPU.
+
+    @param[in]
+    ldc    [int]
+           ldc specifies the first dimension of C. ldc >= max( 1, n ).
+    @param[in]
+    batchCount [int]
+                number of instances in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatchedHostPtrs(hipblasHandle_t                   handle,
+                                                           hipblasFillMode_t                 uplo,
+                                                           hipblasOperation_t                transA,
+                                                           int                               n,
+                                                           int                               k,
+                                                           const hipblasDoubleComplex*       alpha,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           int                               lda,
+                                                           const hipblasDoubleComplex*       beta,
+                                                           hipblasDoubleComplex* const       C[],
+                                                           int                               ldc,
+                                                           int batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSsyr2k(hipblasHandle_t    handle,
                                              hipblasFillMode_t  uplo,
                                              hipblasOperation_t transA,
@@ -13112,55 +16320,175 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t
 
     @param[in]
     beta      device pointer or host pointer specifying the scalar beta.
-
+
+    @param[in]
+    B         pointer to the first matrix B_0 on the GPU.
+              Each B_i is of dimension ( ldb, k ), where k is m
+              when  transB == HIPBLAS_OP_N and
+              is  n  when  transB == HIPBLAS_OP_T.
+
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+
+    @param[in]
+    strideB  [hipblasStride]
+              stride from the start of one matrix (B_i) and the next one (B_i+1)
+
+    @param[in, out]
+    C         pointer to the first matrix C_0 on the GPU.
+              Each C_i is of dimension ( ldc, n ).
+
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+
+    @param[in]
+    strideC  [hipblasStride]
+              stride from the start of one matrix (C_i) and the next one (C_i+1)
+
+    @param[in]
+    batchCount [int]
+                number of instances i in the batch.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          transa,
+                                                          hipblasOperation_t          transb,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          const hipblasDoubleComplex* beta,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          hipblasStride               strideB,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          hipblasStride               strideC,
+                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transa,
+                                                           hipblasOperation_t transb,
+                                                           int                m,
+                                                           int                n,
+                                                           const float*       alpha,
+                                                           const float* const A[],
+                                                           int                lda,
+                                                           const float*       beta,
+                                                           const float* const B[],
+                                                           int                ldb,
+                                                           float* const       C[],
+                                                           int                ldc,
+                                                           int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatchedHostPtrs(hipblasHandle_t     handle,
+                                                           hipblasOperation_t  transa,
+                                                           hipblasOperation_t  transb,
+                                                           int                 m,
+                                                           int                 n,
+                                                           const double*       alpha,
+                                                           const double* const A[],
+                                                           int                 lda,
+                                                           const double*       beta,
+                                                           const double* const B[],
+                                                           int                 ldb,
+                                                           double* const       C[],
+                                                           int                 ldc,
+                                                           int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasOperation_t          transa,
+                                                           hipblasOperation_t          transb,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           const hipblasComplex*       beta,
+                                                           const hipblasComplex* const B[],
+                                                           int                         ldb,
+                                                           hipblasComplex* const       C[],
+                                                           int                         ldc,
+                                                           int                         batchCount);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    geamBatchedHostPtrs performs the batched matrix-matrix operations of geamBatched
+
+        C_i = alpha*op( A_i ) + beta*op( B_i ), for i = 1, ..., batchCount,
+
+    with the arrays of pointers to the matrices A_i, B_i and C_i in host memory; the matrices
+    themselves are in device memory. When the pointers of every array are evenly spaced the call
+    is issued as geamStridedBatched and the arrays are not copied to the device. Otherwise they
+    are copied to a pointer array workspace kept by the handle, on the stream of the handle, and
+    the call is issued as geamBatched.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    alpha     device pointer or host pointer specifying the scalar alpha.
+    @param[in]
+    A         host array of device pointers storing each matrix A_i on the GPU.
+              Each A_i is of dimension ( lda, k ), where k is m
+              when  transA == HIPBLAS_OP_N and
+              is  n  when  transA == HIPBLAS_OP_T.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    beta      device pointer or host pointer specifying the scalar beta.
     @param[in]
-    B         pointer to the first matrix B_0 on the GPU.
+    B         host array of device pointers storing each matrix B_i on the GPU.
               Each B_i is of dimension ( ldb, k ), where k is m
               when  transB == HIPBLAS_OP_N and
               is  n  when  transB == HIPBLAS_OP_T.
-
     @param[in]
     ldb       [int]
               specifies the leading dimension of B.
-
-    @param[in]
-    strideB  [hipblasStride]
-              stride from the start of one matrix (B_i) and the next one (B_i+1)
-
     @param[in, out]
-    C         pointer to the first matrix C_0 on the GPU.
+    C         host array of device pointers storing each matrix C_i on the GPU.
               Each C_i is of dimension ( ldc, n ).
-
     @param[in]
     ldc       [int]
               specifies the leading dimension of C.
 
-    @param[in]
-    strideC  [hipblasStride]
-              stride from the start of one matrix (C_i) and the next one (C_i+1)
-
     @param[in]
     batchCount [int]
                 number of instances i in the batch.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasOperation_t          transa,
-                                                          hipblasOperation_t          transb,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          const hipblasDoubleComplex* beta,
-                                                          const hipblasDoubleComplex* B,
-                                                          int                         ldb,
-                                                          hipblasStride               strideB,
-                                                          hipblasDoubleComplex*       C,
-                                                          int                         ldc,
-                                                          hipblasStride               strideC,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatchedHostPtrs(hipblasHandle_t                   handle,
+                                                           hipblasOperation_t                transa,
+                                                           hipblasOperation_t                transb,
+                                                           int                               m,
+                                                           int                               n,
+                                                           const hipblasDoubleComplex*       alpha,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           int                               lda,
+                                                           const hipblasDoubleComplex*       beta,
+                                                           const hipblasDoubleComplex* const B[],
+                                                           int                               ldb,
+                                                           hipblasDoubleComplex* const       C[],
+                                                           int                               ldc,
+                                                           int batchCount);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                                             hipblasSideMode_t     side,
@@ -13965,6 +17293,157 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t
                                                           hipblasStride               strideB,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasSideMode_t  side,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           hipblasDiagType_t  diag,
+                                                           int                m,
+                                                           int                n,
+                                                           const float*       alpha,
+                                                           const float* const A[],
+                                                           int                lda,
+                                                           float* const       B[],
+                                                           int                ldb,
+                                                           int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmBatchedHostPtrs(hipblasHandle_t     handle,
+                                                           hipblasSideMode_t   side,
+                                                           hipblasFillMode_t   uplo,
+                                                           hipblasOperation_t  transA,
+                                                           hipblasDiagType_t   diag,
+                                                           int                 m,
+                                                           int                 n,
+                                                           const double*       alpha,
+                                                           const double* const A[],
+                                                           int                 lda,
+                                                           double* const       B[],
+                                                           int                 ldb,
+                                                           int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasSideMode_t           side,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasOperation_t          transA,
+                                                           hipblasDiagType_t           diag,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const A[],
+                                                           int                         lda,
+                                                           hipblasComplex* const       B[],
+                                                           int                         ldb,
+                                                           int                         batchCount);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trmmBatchedHostPtrs performs the batched matrix-matrix operations of trmmBatched
+
+        B_i := alpha*op( A_i )*B_i or B_i := alpha*B_i*op( A_i ), for i = 1, ..., batchCount,
+
+    with the arrays of pointers to the matrices A_i and B_i in host memory; the matrices
+    themselves are in device memory. When the pointers of both arrays are evenly spaced the call
+    is issued as trmmStridedBatched and the arrays are not copied to the device. Otherwise they
+    are copied to a pointer array workspace kept by the handle, on the stream of the handle, and
+    the call is issued as trmmBatched.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+
+    @param[in]
+    side    [hipblasSideMode_t]
+            Specifies whether op(A_i) multiplies B_i from the left or right as follows:
+            HIPBLAS_SIDE_LEFT:       B_i := alpha*op( A_i )*B_i.
+            HIPBLAS_SIDE_RIGHT:      B_i := alpha*B_i*op( A_i ).
+
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            Specifies whether the matrix A is an upper or lower triangular matrix as follows:
+            HIPBLAS_FILL_MODE_UPPER:  A is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  A is a  lower triangular matrix.
+
+    @param[in]
+    transA  [hipblasOperation_t]
+            Specifies the form of op(A_i) to be used in the matrix multiplication as follows:
+            HIPBLAS_OP_N:    op(A_i) = A_i.
+            HIPBLAS_OP_T:      op(A_i) = A_i^T.
+            HIPBLAS_OP_C:  op(A_i) = A_i^H.
+
+    @param[in]
+    diag    [hipblasDiagType_t]
+            Specifies whether or not A_i is unit triangular as follows:
+            HIPBLAS_DIAG_UNIT:      A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  A_i is not assumed to be unit triangular.
+
+    @param[in]
+    m       [int]
+            m specifies the number of rows of B_i. m >= 0.
+
+    @param[in]
+    n       [int]
+            n specifies the number of columns of B_i. n >= 0.
+
+    @param[in]
+    alpha
+            alpha specifies the scalar alpha. When alpha is
+            zero then A_i is not referenced and B_i need not be set before
+            entry.
+
+    @param[in]
+    A       host array of device pointers storing each matrix A_i on the GPU.
+            Each A_i is of dimension ( lda, k ), where k is m
+            when  side == HIPBLAS_SIDE_LEFT  and
+            is  n  when  side == HIPBLAS_SIDE_RIGHT.
+
+        When uplo == HIPBLAS_FILL_MODE_UPPER the  leading  k by k
+        upper triangular part of the array  A must contain the upper
+        triangular matrix  and the strictly lower triangular part of
+        A is not referenced.
+
+        When uplo == HIPBLAS_FILL_MODE_LOWER the  leading  k by k
+        lower triangular part of the array  A must contain the lower
+        triangular matrix  and the strictly upper triangular part of
+        A is not referenced.
+
+        Note that when  diag == HIPBLAS_DIAG_UNIT  the diagonal elements of
+        A_i  are not referenced either,  but are assumed to be  unity.
+
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of A.
+            if side == HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side == HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+
+    @param[inout]
+    B       host array of device pointers storing each matrix B_i on the GPU.
+            On entry,  the leading  m by n part of the array  B_i must
+           contain the matrix  B_i,  and  on exit  is overwritten  by the
+           transformed matrix.
+
+    @param[in]
+    ldb    [int]
+           ldb specifies the first dimension of B_i. ldb >= max( 1, m ).
+
+    @param[in]
+    batchCount [int]
+                number of instances i in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                                           hipblasSideMode_t                 side,
+                                                           hipblasFillMode_t                 uplo,
+                                                           hipblasOperation_t                transA,
+                                                           hipblasDiagType_t                 diag,
+                                                           int                               m,
+                                                           int                               n,
+                                                           const hipblasDoubleComplex*       alpha,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           int                               lda,
+                                                           hipblasDoubleComplex* const       B[],
+                                                           int                               ldb,
+                                                           int batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                                             hipblasSideMode_t  side,
                                             hipblasFillMode_t  uplo,
@@ -14293,34 +17772,160 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t
 
     Each matrix X_i is overwritten on B_i for i = 1, ..., batchCount.
 
-    Note about memory allocation:
-    When trsm is launched with a k evenly divisible by the internal block size of 128,
-    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
-    memory found in the handle to increase overall performance. This memory can be managed by using
-    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
-    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
-    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
-    to the desired chunk of right hand sides to be used at a time.
-    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
+    Note about memory allocation:
+    When trsm is launched with a k evenly divisible by the internal block size of 128,
+    and is no larger than 10 of these blocks, the API takes advantage of utilizing pre-allocated
+    memory found in the handle to increase overall performance. This memory can be managed by using
+    the environment variable WORKBUF_TRSM_B_CHNK. When this variable is not set the device memory
+    used for temporary storage will default to 1 MB and may result in chunking, which in turn may
+    reduce performance. Under these circumstances it is recommended that WORKBUF_TRSM_B_CHNK be set
+    to the desired chunk of right hand sides to be used at a time.
+    (where k is m when HIPBLAS_SIDE_LEFT and is n when HIPBLAS_SIDE_RIGHT)
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    side    [hipblasSideMode_t]
+            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
+            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+    @param[in]
+    uplo    [hipblasFillMode_t]
+            HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
+    @param[in]
+    transA  [hipblasOperation_t]
+            HIPBLAS_OP_N: op(A) = A.
+            HIPBLAS_OP_T: op(A) = A^T.
+            HIPBLAS_OP_C: op(A) = A^H.
+    @param[in]
+    diag    [hipblasDiagType_t]
+            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_NON_UNIT:  each A_i is not assumed to be unit triangular.
+    @param[in]
+    m       [int]
+            m specifies the number of rows of each B_i. m >= 0.
+    @param[in]
+    n       [int]
+            n specifies the number of columns of each B_i. n >= 0.
+    @param[in]
+    alpha
+            device pointer or host pointer specifying the scalar alpha. When alpha is
+            &zero then A is not referenced and B need not be set before
+            entry.
+    @param[in]
+    A       device pointer pointing to the first matrix A_1.
+            of dimension ( lda, k ), where k is m
+            when  HIPBLAS_SIDE_LEFT  and
+            is  n  when  HIPBLAS_SIDE_RIGHT
+            only the upper/lower triangular part is accessed.
+    @param[in]
+    lda     [int]
+            lda specifies the first dimension of each A_i.
+            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
+            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+    @param[in]
+    strideA [hipblasStride]
+             stride from the start of one A_i matrix to the next A_(i + 1).
+    @param[in,out]
+    B       device pointer pointing to the first matrix B_1.
+    @param[in]
+    ldb    [int]
+           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
+    @param[in]
+    strideB [hipblasStride]
+             stride from the start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    batchCount [int]
+                number of trsm operatons in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasSideMode_t           side,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          hipblasDoubleComplex*       A,
+                                                          int                         lda,
+                                                          hipblasStride               strideA,
+                                                          hipblasDoubleComplex*       B,
+                                                          int                         ldb,
+                                                          hipblasStride               strideB,
+                                                          int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasSideMode_t  side,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           hipblasDiagType_t  diag,
+                                                           int                m,
+                                                           int                n,
+                                                           const float*       alpha,
+                                                           float* const       A[],
+                                                           int                lda,
+                                                           float*             B[],
+                                                           int                ldb,
+                                                           int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmBatchedHostPtrs(hipblasHandle_t    handle,
+                                                           hipblasSideMode_t  side,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           hipblasDiagType_t  diag,
+                                                           int                m,
+                                                           int                n,
+                                                           const double*      alpha,
+                                                           double* const      A[],
+                                                           int                lda,
+                                                           double*            B[],
+                                                           int                ldb,
+                                                           int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmBatchedHostPtrs(hipblasHandle_t       handle,
+                                                           hipblasSideMode_t     side,
+                                                           hipblasFillMode_t     uplo,
+                                                           hipblasOperation_t    transA,
+                                                           hipblasDiagType_t     diag,
+                                                           int                   m,
+                                                           int                   n,
+                                                           const hipblasComplex* alpha,
+                                                           hipblasComplex* const A[],
+                                                           int                   lda,
+                                                           hipblasComplex*       B[],
+                                                           int                   ldb,
+                                                           int                   batchCount);
+
+/*! \brief BLAS Level 3 API
+
+    \details
+    trsmBatchedHostPtrs solves the batched triangular systems of trsmBatched
+
+        op(A_i)*X_i = alpha*B_i or X_i*op(A_i) = alpha*B_i, for i = 1, ..., batchCount,
+
+    overwriting B_i with X_i, with the arrays of pointers to the matrices A_i and B_i in
+    host memory; the matrices themselves are in device memory. When the pointers of both
+    arrays are evenly spaced the call is issued as trsmStridedBatched and the arrays are
+    not copied to the device. Otherwise they are copied to a pointer array workspace kept
+    by the handle, on the stream of the handle, and the call is issued as trsmBatched.
+
     @param[in]
     handle    [hipblasHandle_t]
               handle to the hipblas library context queue.
     @param[in]
     side    [hipblasSideMode_t]
-            HIPBLAS_SIDE_LEFT:       op(A)*X = alpha*B.
-            HIPBLAS_SIDE_RIGHT:      X*op(A) = alpha*B.
+            HIPBLAS_SIDE_LEFT:       op(A_i)*X_i = alpha*B_i.
+            HIPBLAS_SIDE_RIGHT:      X_i*op(A_i) = alpha*B_i.
     @param[in]
     uplo    [hipblasFillMode_t]
             HIPBLAS_FILL_MODE_UPPER:  each A_i is an upper triangular matrix.
-            HIPBLAS_FILL_MODE_LOWER:  each A_i is a  lower triangular matrix.
+            HIPBLAS_FILL_MODE_LOWER:  each A_i is a lower triangular matrix.
     @param[in]
     transA  [hipblasOperation_t]
-            HIPBLAS_OP_N: op(A) = A.
-            HIPBLAS_OP_T: op(A) = A^T.
-            HIPBLAS_OP_C: op(A) = A^H.
+            specifies the form of op( A_i ).
     @param[in]
     diag    [hipblasDiagType_t]
-            HIPBLAS_DIAG_UNIT:     each A_i is assumed to be unit triangular.
+            HIPBLAS_DIAG_UNIT:      each A_i is assumed to be unit triangular.
             HIPBLAS_DIAG_NON_UNIT:  each A_i is not assumed to be unit triangular.
     @param[in]
     m       [int]
@@ -14329,51 +17934,36 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t
     n       [int]
             n specifies the number of columns of each B_i. n >= 0.
     @param[in]
-    alpha
-            device pointer or host pointer specifying the scalar alpha. When alpha is
-            &zero then A is not referenced and B need not be set before
-            entry.
-    @param[in]
-    A       device pointer pointing to the first matrix A_1.
-            of dimension ( lda, k ), where k is m
-            when  HIPBLAS_SIDE_LEFT  and
-            is  n  when  HIPBLAS_SIDE_RIGHT
-            only the upper/lower triangular part is accessed.
+    alpha   device pointer or host pointer specifying the scalar alpha.
     @param[in]
-    lda     [int]
-            lda specifies the first dimension of each A_i.
-            if side = HIPBLAS_SIDE_LEFT,  lda >= max( 1, m ),
-            if side = HIPBLAS_SIDE_RIGHT, lda >= max( 1, n ).
+    A         host array of device pointers storing each matrix A_i.
     @param[in]
-    strideA [hipblasStride]
-             stride from the start of one A_i matrix to the next A_(i + 1).
+    lda       [int]
+              lda specifies the first dimension of each A_i.
     @param[in,out]
-    B       device pointer pointing to the first matrix B_1.
-    @param[in]
-    ldb    [int]
-           ldb specifies the first dimension of each B_i. ldb >= max( 1, m ).
+    B         host array of device pointers storing each matrix B_i.
     @param[in]
-    strideB [hipblasStride]
-             stride from the start of one B_i matrix to the next B_(i + 1).
+    ldb       [int]
+              ldb specifies the first dimension of each B_i.
     @param[in]
-    batchCount [int]
-                number of trsm operatons in the batch.
+    batchCount
+              [int]
+              number of instances in the batch.
+
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasSideMode_t           side,
-                                                          hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
-                                                          hipblasDiagType_t           diag,
-                                                          int                         m,
-                                                          int                         n,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          hipblasDoubleComplex*       A,
-                                                          int                         lda,
-                                                          hipblasStride               strideA,
-                                                          hipblasDoubleComplex*       B,
-                                                          int                         ldb,
-                                                          hipblasStride               strideB,
-                                                          int                         batchCount);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmBatchedHostPtrs(hipblasHandle_t             handle,
+                                                           hipblasSideMode_t           side,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasOperation_t          transA,
+                                                           hipblasDiagType_t           diag,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* alpha,
+                                                           hipblasDoubleComplex* const A[],
+                                                           int                         lda,
+                                                           hipblasDoubleComplex*       B[],
+                                                           int                         ldb,
+                                                           int                         batchCount);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
                                              hipblasFillMode_t uplo,
@@ -15991,35 +19581,328 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    ha
                                                            hipblasStride      stride_invA,
                                                            hipblasDatatype_t  compute_type);
 
-// // syrk_ex
-// HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t       handle,
-//                                               hipblasFillMode_t     uplo,
-//                                               hipblasOperation_t    trans,
-//                                               int                   n,
-//                                               int                   k,
-//                                               const hipblasComplex* alpha,
-//                                               const void*           A,
-//                                               hipblasDatatype_t     Atype,
-//                                               int                   lda,
-//                                               const hipblasComplex* beta,
-//                                               hipblasComplex*       C,
-//                                               hipblasDatatype_t     Ctype,
-//                                               int                   ldc);
-
-// // herk_ex
-// HIPBLAS_EXPORT hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
-//                                               hipblasFillMode_t  uplo,
-//                                               hipblasOperation_t trans,
-//                                               int                n,
-//                                               int                k,
-//                                               const float*       alpha,
-//                                               const void*        A,
-//                                               hipblasDatatype_t  Atype,
-//                                               int                lda,
-//                                               const float*       beta,
-//                                               hipblasComplex*    C,
-//                                               hipblasDatatype_t  Ctype,
-//                                               int                ldc);
+// syrk_ex
+/*! \brief BLAS EX API
+
+    \details
+    syrkEx performs the symmetric rank k update of syrk
+
+        C := alpha*op( A )*op( A )^T + beta*C,
+
+    with the type of A, of C and of the computation chosen as for gemmEx, e.g. half or bfloat16 A
+    accumulated in a float C. op( A ) = A and A is n by k if trans = HIPBLAS_OP_N; op( A ) = A^T and
+    A is k by n if trans = HIPBLAS_OP_T, or HIPBLAS_OP_C for real C.
+
+    Only the uplo triangle of C is read and written, and the work in the other triangle is limited
+    to diagonal blocks of 64 columns: the update is issued as gemmEx on the rectangles below (or
+    above) the diagonal blocks, and as one strided batched gemmEx on the diagonal blocks, which are
+    computed whole in a workspace kept by the handle and copied back one triangle at a time.
+
+    The supported types are c_type = compute_type, one of HIPBLAS_R_32F, HIPBLAS_R_64F,
+    HIPBLAS_C_32F and HIPBLAS_C_64F, with any a_type gemmEx accepts with them, e.g. HIPBLAS_R_16F or
+    HIPBLAS_R_16B with HIPBLAS_R_32F; other combinations return HIPBLAS_STATUS_NOT_SUPPORTED, as do
+    the combinations gemmEx does not support.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  C is an upper triangular matrix
+              HIPBLAS_FILL_MODE_LOWER:  C is a  lower triangular matrix
+    @param[in]
+    trans     [hipblasOperation_t]
+              HIPBLAS_OP_T: op(A) = A^T
+              HIPBLAS_OP_N: op(A) = A
+              HIPBLAS_OP_C: op(A) = A^T, for real C only
+    @param[in]
+    n         [int]
+              n specifies the number of rows and columns of C. n >= 0.
+    @param[in]
+    k         [int]
+              k specifies the number of columns of op(A). k >= 0.
+    @param[in]
+    alpha     device pointer or host pointer to the scalar alpha, of compute_type.
+    @param[in]
+    A         pointer storing matrix A on the GPU, of a_type.
+    @param[in]
+    a_type    [hipblasDatatype_t]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              lda specifies the first dimension of A.
+              if trans = HIPBLAS_OP_N,  lda >= max( 1, n ),
+              otherwise lda >= max( 1, k ).
+    @param[in]
+    beta      device pointer or host pointer to the scalar beta, of compute_type.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU, of c_type.
+    @param[in]
+    c_type    [hipblasDatatype_t]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              ldc specifies the first dimension of C. ldc >= max( 1, n ).
+    @param[in]
+    compute_type
+              [hipblasDatatype_t]
+              specifies the datatype of computation, the same as c_type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSyrkEx(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t trans,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasDatatype_t  compute_type);
+
+/*! \brief BLAS EX API
+
+    \details
+    syrkBatchedEx performs the syrkEx update of each instance of a batch
+
+        C_i := alpha*op( A_i )*op( A_i )^T + beta*C_i, for i = 1, ..., batch_count,
+
+    with the arrays of pointers A and C in device memory. The arrays are read back to the host on
+    the stream of the handle; when the pointers of both arrays are evenly spaced the batch runs as
+    syrkStridedBatchedEx, otherwise one instance at a time. The read back waits on the stream, so
+    the call returns HIPBLAS_STATUS_NOT_SUPPORTED in HIPBLAS_CAPTURE_MODE_SAFE.
+
+    @param[in]
+    A         device array of device pointers storing each matrix A_i, of a_type.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i, of c_type.
+    @param[in]
+    batch_count
+              [int]
+              number of instances in the batch.
+
+    The other arguments are those of syrkEx.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSyrkBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t trans,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  a_type,
+                                                    int                lda,
+                                                    const void*        beta,
+                                                    void*              C[],
+                                                    hipblasDatatype_t  c_type,
+                                                    int                ldc,
+                                                    int                batch_count,
+                                                    hipblasDatatype_t  compute_type);
+
+/*! \brief BLAS EX API
+
+    \details
+    syrkStridedBatchedEx performs the syrkEx update of each instance of a batch
+
+        C_i := alpha*op( A_i )*op( A_i )^T + beta*C_i, for i = 1, ..., batch_count,
+
+    where A_i = A + (i - 1)*stride_A and C_i = C + (i - 1)*stride_C, in elements. The diagonal
+    blocks of the instances are batched together.
+
+    @param[in]
+    stride_A  [hipblasStride]
+              stride from the start of one A_i to the next A_(i + 1).
+    @param[in]
+    stride_C  [hipblasStride]
+              stride from the start of one C_i to the next C_(i + 1).
+    @param[in]
+    batch_count
+              [int]
+              number of instances in the batch.
+
+    The other arguments are those of syrkEx.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSyrkStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t trans,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  a_type,
+                                                           int                lda,
+                                                           hipblasStride      stride_A,
+                                                           const void*        beta,
+                                                           void*              C,
+                                                           hipblasDatatype_t  c_type,
+                                                           int                ldc,
+                                                           hipblasStride      stride_C,
+                                                           int                batch_count,
+                                                           hipblasDatatype_t  compute_type);
+
+// herk_ex
+/*! \brief BLAS EX API
+
+    \details
+    herkEx performs the Hermitian rank k update of herk
+
+        C := alpha*op( A )*op( A )^H + beta*C,
+
+    with the type of A, of C and of the computation chosen as for gemmEx. op( A ) = A and A is n by
+    k if trans = HIPBLAS_OP_N; op( A ) = A^H and A is k by n if trans = HIPBLAS_OP_C.
+
+    Only the uplo triangle of C is read and written, as for syrkEx, and the imaginary parts of the
+    diagonal of C are set to zero.
+
+    The supported types are c_type = compute_type, HIPBLAS_C_32F or HIPBLAS_C_64F, with any a_type
+    gemmEx accepts with them; other combinations return HIPBLAS_STATUS_NOT_SUPPORTED.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    uplo      [hipblasFillMode_t]
+              HIPBLAS_FILL_MODE_UPPER:  C is an upper triangular matrix
+              HIPBLAS_FILL_MODE_LOWER:  C is a  lower triangular matrix
+    @param[in]
+    trans     [hipblasOperation_t]
+              HIPBLAS_OP_C: op(A) = A^H
+              HIPBLAS_OP_N: op(A) = A
+    @param[in]
+    n         [int]
+              n specifies the number of rows and columns of C. n >= 0.
+    @param[in]
+    k         [int]
+              k specifies the number of columns of op(A). k >= 0.
+    @param[in]
+    alpha     device pointer or host pointer to the real scalar alpha, of the real type of
+              compute_type.
+    @param[in]
+    A         pointer storing matrix A on the GPU, of a_type.
+    @param[in]
+    a_type    [hipblasDatatype_t]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              lda specifies the first dimension of A.
+              if trans = HIPBLAS_OP_N,  lda >= max( 1, n ),
+              otherwise lda >= max( 1, k ).
+    @param[in]
+    beta      device pointer or host pointer to the real scalar beta, of the real type of
+              compute_type.
+    @param[in, out]
+    C         pointer storing matrix C on the GPU, of c_type.
+    @param[in]
+    c_type    [hipblasDatatype_t]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              ldc specifies the first dimension of C. ldc >= max( 1, n ).
+    @param[in]
+    compute_type
+              [hipblasDatatype_t]
+              specifies the datatype of computation, the same as c_type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHerkEx(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t trans,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasDatatype_t  compute_type);
+
+/*! \brief BLAS EX API
+
+    \details
+    herkBatchedEx performs the herkEx update of each instance of a batch
+
+        C_i := alpha*op( A_i )*op( A_i )^H + beta*C_i, for i = 1, ..., batch_count,
+
+    with the arrays of pointers A and C in device memory, read back to the host as for
+    syrkBatchedEx.
+
+    @param[in]
+    A         device array of device pointers storing each matrix A_i, of a_type.
+    @param[in, out]
+    C         device array of device pointers storing each matrix C_i, of c_type.
+    @param[in]
+    batch_count
+              [int]
+              number of instances in the batch.
+
+    The other arguments are those of herkEx.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHerkBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t trans,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  a_type,
+                                                    int                lda,
+                                                    const void*        beta,
+                                                    void*              C[],
+                                                    hipblasDatatype_t  c_type,
+                                                    int                ldc,
+                                                    int                batch_count,
+                                                    hipblasDatatype_t  compute_type);
+
+/*! \brief BLAS EX API
+
+    \details
+    herkStridedBatchedEx performs the herkEx update of each instance of a batch
+
+        C_i := alpha*op( A_i )*op( A_i )^H + beta*C_i, for i = 1, ..., batch_count,
+
+    where A_i = A + (i - 1)*stride_A and C_i = C + (i - 1)*stride_C, in elements.
+
+    @param[in]
+    stride_A  [hipblasStride]
+              stride from the start of one A_i to the next A_(i + 1).
+    @param[in]
+    stride_C  [hipblasStride]
+              stride from the start of one C_i to the next C_(i + 1).
+    @param[in]
+    batch_count
+              [int]
+              number of instances in the batch.
+
+    The other arguments are those of herkEx.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasHerkStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t trans,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  a_type,
+                                                           int                lda,
+                                                           hipblasStride      stride_A,
+                                                           const void*        beta,
+                                                           void*              C,
+                                                           hipblasDatatype_t  c_type,
+                                                           int                ldc,
+                                                           hipblasStride      stride_C,
+                                                           int                batch_count,
+                                                           hipblasDatatype_t  compute_type);
 
 // axpy_ex
 HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
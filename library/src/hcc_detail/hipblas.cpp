@@ -2,9 +2,15 @@
  * Copyright 2016-2021 Advanced Micro Devices, Inc.
  * ************************************************************************ */
 #include "hipblas.h"
+#include "batched_emulation.hpp"
 #include "exceptions.hpp"
+#include "gemm3m.hpp"
+#include "host_pointer_arrays.hpp"
 #include "limits.h"
 #include "rocblas.h"
+#include "storage_conversion.hpp"
+#include "syrk_ex.hpp"
+#include "variable_size_batch.hpp"
 #ifdef __HIP_PLATFORM_SOLVER__
 #include "rocsolver.h"
 #endif
@@ -13,14 +19,16 @@
 #include <math.h>
 
 extern "C" hipblasStatus_t rocBLASStatusToHIPStatus(rocblas_status_ error);
+static bool                capture_safe(rocblas_handle handle);
 
 // Attempt a rocBLAS call; if it gets an allocation error, query the
-// size needed and attempt to allocate it, retrying the operation
+// size needed and attempt to allocate it, retrying the operation.
+// In capture mode the workspace is reserved, so the error is returned
 static hipblasStatus_t hipblasDemandAlloc(rocblas_handle                   handle,
                                           std::function<hipblasStatus_t()> func)
 {
     hipblasStatus_t status = func();
-    if(status == HIPBLAS_STATUS_ALLOC_FAILED)
+    if(status == HIPBLAS_STATUS_ALLOC_FAILED && !capture_safe(handle))
     {
         rocblas_status blas_status = rocblas_start_device_memory_size_query(handle);
         if(blas_status != rocblas_status_success)
@@ -321,6 +329,137 @@ hipblasStatus_t rocBLASStatusToHIPStatus(rocblas_status_ error)
     }
 }
 
+hipblasStatus_t hipErrorToHIPBLASStatus(hipError_t hipError)
+{
+    switch(hipError)
+    {
+    case hipSuccess:
+        return HIPBLAS_STATUS_SUCCESS;
+    case hipErrorOutOfMemory:
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    case hipErrorInvalidValue:
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    default:
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// Stream and memory primitives of the pointer array workspace of the HostPtrs batched routines,
+// see batched_emulation.hpp
+struct hipblas_hip_backend
+{
+    using stream_t = hipStream_t;
+    using event_t  = hipEvent_t;
+
+    static hipblasStatus_t get_stream(hipblasHandle_t handle, hipStream_t* stream)
+    {
+        return rocBLASStatusToHIPStatus(rocblas_get_stream((rocblas_handle)handle, stream));
+    }
+
+    static hipblasStatus_t set_stream(hipblasHandle_t handle, hipStream_t stream)
+    {
+        return rocBLASStatusToHIPStatus(rocblas_set_stream((rocblas_handle)handle, stream));
+    }
+
+    static hipblasStatus_t create_stream(hipStream_t* stream)
+    {
+        return hipErrorToHIPBLASStatus(hipStreamCreateWithFlags(stream, hipStreamNonBlocking));
+    }
+
+    static hipblasStatus_t destroy_stream(hipStream_t stream)
+    {
+        return hipErrorToHIPBLASStatus(hipStreamDestroy(stream));
+    }
+
+    static hipblasStatus_t create_event(hipEvent_t* event)
+    {
+        return hipErrorToHIPBLASStatus(hipEventCreateWithFlags(event, hipEventDisableTiming));
+    }
+
+    static hipblasStatus_t destroy_event(hipEvent_t event)
+    {
+        return hipErrorToHIPBLASStatus(hipEventDestroy(event));
+    }
+
+    static hipblasStatus_t record_event(hipEvent_t event, hipStream_t stream)
+    {
+        return hipErrorToHIPBLASStatus(hipEventRecord(event, stream));
+    }
+
+    static hipblasStatus_t wait_event(hipStream_t stream, hipEvent_t event)
+    {
+        return hipErrorToHIPBLASStatus(hipStreamWaitEvent(stream, event, 0));
+    }
+
+    static hipblasStatus_t synchronize(hipStream_t stream)
+    {
+        return hipErrorToHIPBLASStatus(hipStreamSynchronize(stream));
+    }
+
+    static hipblasStatus_t device_malloc(void** ptr, size_t bytes)
+    {
+        return hipErrorToHIPBLASStatus(hipMalloc(ptr, bytes));
+    }
+
+    static hipblasStatus_t device_free(void* ptr)
+    {
+        return hipErrorToHIPBLASStatus(hipFree(ptr));
+    }
+
+    static hipblasStatus_t
+        copy_to_host(void* dst, const void* src, size_t bytes, hipStream_t stream)
+    {
+        hipError_t err = hipMemcpyAsync(dst, src, bytes, hipMemcpyDeviceToHost, stream);
+        return hipErrorToHIPBLASStatus(err == hipSuccess ? hipStreamSynchronize(stream) : err);
+    }
+
+    // from pageable memory the copy is staged before hipMemcpyAsync returns
+    static hipblasStatus_t
+        copy_to_device(void* dst, const void* src, size_t bytes, hipStream_t stream)
+    {
+        return hipErrorToHIPBLASStatus(
+            hipMemcpyAsync(dst, src, bytes, hipMemcpyHostToDevice, stream));
+    }
+
+    static hipblasStatus_t host_malloc(void** ptr, size_t bytes)
+    {
+        return hipErrorToHIPBLASStatus(hipHostMalloc(ptr, bytes, 0));
+    }
+
+    static hipblasStatus_t host_free(void* ptr)
+    {
+        return hipErrorToHIPBLASStatus(hipHostFree(ptr));
+    }
+
+    static hipblasStatus_t
+        copy_to_host_async(void* dst, const void* src, size_t bytes, hipStream_t stream)
+    {
+        return hipErrorToHIPBLASStatus(
+            hipMemcpyAsync(dst, src, bytes, hipMemcpyDeviceToHost, stream));
+    }
+
+    static hipblasStatus_t launch_host_func(hipStream_t stream, void (*fn)(void*), void* data)
+    {
+        return hipErrorToHIPBLASStatus(hipLaunchHostFunc(stream, fn, data));
+    }
+};
+
+using batched_emulation = hipblas_batched_emulation<hipblas_hip_backend>;
+
+} // extern "C"
+
+static bool capture_safe(rocblas_handle handle)
+{
+    return batched_emulation::capture_mode((hipblasHandle_t)handle) == HIPBLAS_CAPTURE_MODE_SAFE;
+}
+
+void* hipblas_scratch(hipblasHandle_t handle, size_t bytes)
+{
+    return batched_emulation::scratch(handle, bytes);
+}
+
+extern "C" {
+
 hipblasStatus_t hipblasCreate(hipblasHandle_t* handle)
 try
 {
@@ -338,6 +477,7 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    batched_emulation::release(handle);
     return rocBLASStatusToHIPStatus(rocblas_destroy_handle((rocblas_handle)handle));
 }
 catch(...)
@@ -352,6 +492,9 @@ try
     {
         return HIPBLAS_STATUS_NOT_INITIALIZED;
     }
+    hipblasStatus_t status = batched_emulation::join_lanes(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
     return rocBLASStatusToHIPStatus(rocblas_set_stream((rocblas_handle)handle, streamId));
 }
 catch(...)
@@ -510,6 +653,150 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasSetCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // Stop the device memory of rocBLAS from growing, at the size reached by the calls so far
+    if(mode == HIPBLAS_CAPTURE_MODE_SAFE
+       && rocblas_is_managing_device_memory((rocblas_handle)handle))
+    {
+        size_t         size;
+        rocblas_status status = rocblas_get_device_memory_size((rocblas_handle)handle, &size);
+        if(status == rocblas_status_success)
+            status = rocblas_set_device_memory_size((rocblas_handle)handle, size);
+        if(status != rocblas_status_success)
+            return rocBLASStatusToHIPStatus(status);
+    }
+    batched_emulation::set_capture_mode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = batched_emulation::capture_mode(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetBatchedInfoMode(hipblasHandle_t handle, hipblasBatchedInfoMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::set_batched_info_mode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetBatchedInfoMode(hipblasHandle_t handle, hipblasBatchedInfoMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = batched_emulation::batched_info_mode(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetBatchedInfoSummaryAsync(hipblasHandle_t              handle,
+                                                  hipblasBatchedInfoSummary_t* summary,
+                                                  int                          reset)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::read_summary_async(handle, summary, reset != 0);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetStreamPool(hipblasHandle_t handle, int n)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::set_stream_pool(handle, n);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetStreamPool(hipblasHandle_t handle, int* n)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *n = batched_emulation::stream_pool_size(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetStreamLane(hipblasHandle_t handle, int lane)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::select_lane(handle, lane);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasJoinStreams(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    return batched_emulation::join_lanes(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // amax
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
@@ -4635,82 +4922,467 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
-// ger
-hipblasStatus_t hipblasSger(hipblasHandle_t handle,
-                            int             m,
-                            int             n,
-                            const float*    alpha,
-                            const float*    x,
-                            int             incx,
-                            const float*    y,
-                            int             incy,
-                            float*          A,
-                            int             lda)
+hipblasStatus_t hipblasSgemvBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float* const x[],
+                                            int                incx,
+                                            const float*       beta,
+                                            float* const       y[],
+                                            int                incy,
+                                            int                batchCount)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_sger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasSgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+    return hipblasSgemvBatched(handle,
+                               trans,
+                               m,
+                               n,
+                               alpha,
+                               (const float* const*)arrays,
+                               lda,
+                               (const float* const*)(arrays + batchCount),
+                               incx,
+                               beta,
+                               (float* const*)(arrays + 2 * batchCount),
+                               incy,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasOperation_t  trans,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double* const x[],
+                                            int                 incx,
+                                            const double*       beta,
+                                            double* const       y[],
+                                            int                 incy,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasDgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+    return hipblasDgemvBatched(handle,
+                               trans,
+                               m,
+                               n,
+                               alpha,
+                               (const double* const*)arrays,
+                               lda,
+                               (const double* const*)(arrays + batchCount),
+                               incx,
+                               beta,
+                               (double* const*)(arrays + 2 * batchCount),
+                               incy,
+                               batchCount);
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasDger(hipblasHandle_t handle,
-                            int             m,
-                            int             n,
-                            const double*   alpha,
-                            const double*   x,
-                            int             incx,
-                            const double*   y,
-                            int             incy,
-                            double*         A,
-                            int             lda)
+hipblasStatus_t hipblasCgemvBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasOperation_t          trans,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex* const x[],
+                                            int                         incx,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       y[],
+                                            int                         incy,
+                                            int                         batchCount)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_dger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasCgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+    return hipblasCgemvBatched(handle,
+                               trans,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               (const hipblasComplex* const*)(arrays + batchCount),
+                               incx,
+                               beta,
+                               (hipblasComplex* const*)(arrays + 2 * batchCount),
+                               incy,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasOperation_t                trans,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex* const x[],
+                                            int                               incx,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       y[],
+                                            int                               incy,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasZgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+    return hipblasZgemvBatched(handle,
+                               trans,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               (const hipblasDoubleComplex* const*)(arrays + batchCount),
+                               incx,
+                               beta,
+                               (hipblasDoubleComplex* const*)(arrays + 2 * batchCount),
+                               incy,
+                               batchCount);
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
-                             int                   m,
-                             int                   n,
-                             const hipblasComplex* alpha,
-                             const hipblasComplex* x,
-                             int                   incx,
-                             const hipblasComplex* y,
-                             int                   incy,
-                             hipblasComplex*       A,
-                             int                   lda)
+// gemv_vbatched
+hipblasStatus_t hipblasSgemvVbatched(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     const int          m[],
+                                     const int          n[],
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     const int          lda[],
+                                     const float* const x[],
+                                     const int          incx[],
+                                     const float*       beta,
+                                     float* const       y[],
+                                     const int          incy[],
+                                     int                batchCount)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cgeru((rocblas_handle)handle,
-                                                  m,
-                                                  n,
-                                                  (rocblas_float_complex*)alpha,
-                                                  (rocblas_float_complex*)x,
-                                                  incx,
-                                                  (rocblas_float_complex*)y,
-                                                  incy,
-                                                  (rocblas_float_complex*)A,
-                                                  lda));
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [](int, int, int, int) { return true; },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
-                             int                   m,
-                             int                   n,
-                             const hipblasComplex* alpha,
-                             const hipblasComplex* x,
-                             int                   incx,
-                             const hipblasComplex* y,
+hipblasStatus_t hipblasDgemvVbatched(hipblasHandle_t     handle,
+                                     hipblasOperation_t  trans,
+                                     const int           m[],
+                                     const int           n[],
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     const int           lda[],
+                                     const double* const x[],
+                                     const int           incx[],
+                                     const double*       beta,
+                                     double* const       y[],
+                                     const int           incy[],
+                                     int                 batchCount)
+try
+{
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [](int, int, int, int) { return true; },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvVbatched(hipblasHandle_t             handle,
+                                     hipblasOperation_t          trans,
+                                     const int                   m[],
+                                     const int                   n[],
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const A[],
+                                     const int                   lda[],
+                                     const hipblasComplex* const x[],
+                                     const int                   incx[],
+                                     const hipblasComplex*       beta,
+                                     hipblasComplex* const       y[],
+                                     const int                   incy[],
+                                     int                         batchCount)
+try
+{
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [](int, int, int, int) { return true; },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvVbatched(hipblasHandle_t                   handle,
+                                     hipblasOperation_t                trans,
+                                     const int                         m[],
+                                     const int                         n[],
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda[],
+                                     const hipblasDoubleComplex* const x[],
+                                     const int                         incx[],
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       y[],
+                                     const int                         incy[],
+                                     int                               batchCount)
+try
+{
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [](int, int, int, int) { return true; },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// ger
+hipblasStatus_t hipblasSger(hipblasHandle_t handle,
+                            int             m,
+                            int             n,
+                            const float*    alpha,
+                            const float*    x,
+                            int             incx,
+                            const float*    y,
+                            int             incy,
+                            float*          A,
+                            int             lda)
+try
+{
+    return rocBLASStatusToHIPStatus(
+        rocblas_sger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDger(hipblasHandle_t handle,
+                            int             m,
+                            int             n,
+                            const double*   alpha,
+                            const double*   x,
+                            int             incx,
+                            const double*   y,
+                            int             incy,
+                            double*         A,
+                            int             lda)
+try
+{
+    return rocBLASStatusToHIPStatus(
+        rocblas_dger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
+                             int                   m,
+                             int                   n,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             const hipblasComplex* y,
+                             int                   incy,
+                             hipblasComplex*       A,
+                             int                   lda)
+try
+{
+    return rocBLASStatusToHIPStatus(rocblas_cgeru((rocblas_handle)handle,
+                                                  m,
+                                                  n,
+                                                  (rocblas_float_complex*)alpha,
+                                                  (rocblas_float_complex*)x,
+                                                  incx,
+                                                  (rocblas_float_complex*)y,
+                                                  incy,
+                                                  (rocblas_float_complex*)A,
+                                                  lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
+                             int                   m,
+                             int                   n,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* x,
+                             int                   incx,
+                             const hipblasComplex* y,
                              int                   incy,
                              hipblasComplex*       A,
                              int                   lda)
@@ -10418,176 +11090,872 @@ catch(...)
 
 //------------------------------------------------------------------------------------------------------------
 
-// herk
-hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
-                             hipblasFillMode_t     uplo,
-                             hipblasOperation_t    transA,
-                             int                   n,
-                             int                   k,
-                             const float*          alpha,
-                             const hipblasComplex* A,
-                             int                   lda,
-                             const float*          beta,
-                             hipblasComplex*       C,
-                             int                   ldc)
+// tpttr
+hipblasStatus_t hipblasStpttr(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const float*      AP,
+                              float*            A,
+                              int               lda)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cherk((rocblas_handle)handle,
-                                                  (rocblas_fill)uplo,
-                                                  hipOperationToHCCOperation(transA),
-                                                  n,
-                                                  k,
-                                                  alpha,
-                                                  (rocblas_float_complex*)A,
-                                                  lda,
-                                                  beta,
-                                                  (rocblas_float_complex*)C,
-                                                  ldc));
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        0,
+        A,
+        0,
+        lda,
+        1,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
-                             hipblasFillMode_t           uplo,
-                             hipblasOperation_t          transA,
-                             int                         n,
-                             int                         k,
-                             const double*               alpha,
-                             const hipblasDoubleComplex* A,
-                             int                         lda,
-                             const double*               beta,
-                             hipblasDoubleComplex*       C,
-                             int                         ldc)
+hipblasStatus_t hipblasDtpttr(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const double*     AP,
+                              double*           A,
+                              int               lda)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zherk((rocblas_handle)handle,
-                                                  (rocblas_fill)uplo,
-                                                  hipOperationToHCCOperation(transA),
-                                                  n,
-                                                  k,
-                                                  alpha,
-                                                  (rocblas_double_complex*)A,
-                                                  lda,
-                                                  beta,
-                                                  (rocblas_double_complex*)C,
-                                                  ldc));
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        0,
+        A,
+        0,
+        lda,
+        1,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-// herk_batched
-hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
-                                    hipblasFillMode_t           uplo,
-                                    hipblasOperation_t          transA,
-                                    int                         n,
-                                    int                         k,
-                                    const float*                alpha,
-                                    const hipblasComplex* const A[],
-                                    int                         lda,
-                                    const float*                beta,
-                                    hipblasComplex* const       C[],
-                                    int                         ldc,
-                                    int                         batchCount)
+hipblasStatus_t hipblasCtpttr(hipblasHandle_t       handle,
+                              hipblasFillMode_t     uplo,
+                              int                   n,
+                              const hipblasComplex* AP,
+                              hipblasComplex*       A,
+                              int                   lda)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_cherk_batched((rocblas_handle)handle,
-                                                          (rocblas_fill)uplo,
-                                                          hipOperationToHCCOperation(transA),
-                                                          n,
-                                                          k,
-                                                          alpha,
-                                                          (rocblas_float_complex**)A,
-                                                          lda,
-                                                          beta,
-                                                          (rocblas_float_complex**)C,
-                                                          ldc,
-                                                          batchCount));
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        0,
+        A,
+        0,
+        lda,
+        1,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
-                                    hipblasFillMode_t                 uplo,
-                                    hipblasOperation_t                transA,
-                                    int                               n,
-                                    int                               k,
-                                    const double*                     alpha,
-                                    const hipblasDoubleComplex* const A[],
-                                    int                               lda,
-                                    const double*                     beta,
-                                    hipblasDoubleComplex* const       C[],
-                                    int                               ldc,
-                                    int                               batchCount)
+hipblasStatus_t hipblasZtpttr(hipblasHandle_t             handle,
+                              hipblasFillMode_t           uplo,
+                              int                         n,
+                              const hipblasDoubleComplex* AP,
+                              hipblasDoubleComplex*       A,
+                              int                         lda)
 try
 {
-    return rocBLASStatusToHIPStatus(rocblas_zherk_batched((rocblas_handle)handle,
-                                                          (rocblas_fill)uplo,
-                                                          hipOperationToHCCOperation(transA),
-                                                          n,
-                                                          k,
-                                                          alpha,
-                                                          (rocblas_double_complex**)A,
-                                                          lda,
-                                                          beta,
-                                                          (rocblas_double_complex**)C,
-                                                          ldc,
-                                                          batchCount));
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        0,
+        A,
+        0,
+        lda,
+        1,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-// herk_strided_batched
-hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
-                                           hipblasFillMode_t     uplo,
-                                           hipblasOperation_t    transA,
-                                           int                   n,
-                                           int                   k,
-                                           const float*          alpha,
-                                           const hipblasComplex* A,
-                                           int                   lda,
-                                           hipblasStride         strideA,
-                                           const float*          beta,
-                                           hipblasComplex*       C,
-                                           int                   ldc,
-                                           hipblasStride         strideC,
-                                           int                   batchCount)
+// tpttrBatched
+hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     int                n,
+                                     const float* const AP[],
+                                     float* const       A[],
+                                     int                lda,
+                                     int                batchCount)
 try
 {
-    return rocBLASStatusToHIPStatus(
-        rocblas_cherk_strided_batched((rocblas_handle)handle,
-                                      (rocblas_fill)uplo,
-                                      hipOperationToHCCOperation(transA),
-                                      n,
-                                      k,
-                                      alpha,
-                                      (rocblas_float_complex*)A,
-                                      lda,
-                                      strideA,
-                                      beta,
-                                      (rocblas_float_complex*)C,
-                                      ldc,
-                                      strideC,
-                                      batchCount));
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        A,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
-                                           hipblasFillMode_t           uplo,
-                                           hipblasOperation_t          transA,
-                                           int                         n,
-                                           int                         k,
-                                           const double*               alpha,
+hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     const double* const AP[],
+                                     double* const       A[],
+                                     int                 lda,
+                                     int                 batchCount)
+try
+{
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        A,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     int                         n,
+                                     const hipblasComplex* const AP[],
+                                     hipblasComplex* const       A[],
+                                     int                         lda,
+                                     int                         batchCount)
+try
+{
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        A,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const AP[],
+                                     hipblasDoubleComplex* const       A[],
+                                     int                               lda,
+                                     int                               batchCount)
+try
+{
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        A,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// tpttrStridedBatched
+hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      AP,
+                                            hipblasStride     strideAP,
+                                            float*            A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            int               batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        strideAP,
+        A,
+        strideA,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     AP,
+                                            hipblasStride     strideAP,
+                                            double*           A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            int               batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        strideAP,
+        A,
+        strideA,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* AP,
+                                            hipblasStride         strideAP,
+                                            hipblasComplex*       A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            int                   batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        strideAP,
+        A,
+        strideA,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* AP,
+                                            hipblasStride               strideAP,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            int                         batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        AP,
+        strideAP,
+        A,
+        strideA,
+        lda,
+        batchCount,
+        true,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trttp
+hipblasStatus_t hipblasStrttp(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const float*      A,
+                              int               lda,
+                              float*            AP)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        0,
+        AP,
+        0,
+        lda,
+        1,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttp(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const double*     A,
+                              int               lda,
+                              double*           AP)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        0,
+        AP,
+        0,
+        lda,
+        1,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttp(hipblasHandle_t       handle,
+                              hipblasFillMode_t     uplo,
+                              int                   n,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              hipblasComplex*       AP)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        0,
+        AP,
+        0,
+        lda,
+        1,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttp(hipblasHandle_t             handle,
+                              hipblasFillMode_t           uplo,
+                              int                         n,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              hipblasDoubleComplex*       AP)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        0,
+        AP,
+        0,
+        lda,
+        1,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trttpBatched
+hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     int                n,
+                                     const float* const A[],
+                                     int                lda,
+                                     float* const       AP[],
+                                     int                batchCount)
+try
+{
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        AP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     const double* const A[],
+                                     int                 lda,
+                                     double* const       AP[],
+                                     int                 batchCount)
+try
+{
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        AP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     int                         n,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     hipblasComplex* const       AP[],
+                                     int                         batchCount)
+try
+{
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        AP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     hipblasDoubleComplex* const       AP[],
+                                     int                               batchCount)
+try
+{
+    return hipblas_packed_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        AP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trttpStridedBatched
+hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            float*            AP,
+                                            hipblasStride     strideAP,
+                                            int               batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        strideA,
+        AP,
+        strideAP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            double*           AP,
+                                            hipblasStride     strideAP,
+                                            int               batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        strideA,
+        AP,
+        strideAP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            hipblasComplex*       AP,
+                                            hipblasStride         strideAP,
+                                            int                   batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        strideA,
+        AP,
+        strideAP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            hipblasDoubleComplex*       AP,
+                                            hipblasStride               strideAP,
+                                            int                         batchCount)
+try
+{
+    return hipblas_packed_strided_batched(
+        handle,
+        uplo,
+        n,
+        A,
+        strideA,
+        AP,
+        strideAP,
+        lda,
+        batchCount,
+        false,
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+//------------------------------------------------------------------------------------------------------------
+
+// herk
+hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
+                             hipblasFillMode_t     uplo,
+                             hipblasOperation_t    transA,
+                             int                   n,
+                             int                   k,
+                             const float*          alpha,
+                             const hipblasComplex* A,
+                             int                   lda,
+                             const float*          beta,
+                             hipblasComplex*       C,
+                             int                   ldc)
+try
+{
+    return rocBLASStatusToHIPStatus(rocblas_cherk((rocblas_handle)handle,
+                                                  (rocblas_fill)uplo,
+                                                  hipOperationToHCCOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  (rocblas_float_complex*)A,
+                                                  lda,
+                                                  beta,
+                                                  (rocblas_float_complex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
+                             hipblasFillMode_t           uplo,
+                             hipblasOperation_t          transA,
+                             int                         n,
+                             int                         k,
+                             const double*               alpha,
+                             const hipblasDoubleComplex* A,
+                             int                         lda,
+                             const double*               beta,
+                             hipblasDoubleComplex*       C,
+                             int                         ldc)
+try
+{
+    return rocBLASStatusToHIPStatus(rocblas_zherk((rocblas_handle)handle,
+                                                  (rocblas_fill)uplo,
+                                                  hipOperationToHCCOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  (rocblas_double_complex*)A,
+                                                  lda,
+                                                  beta,
+                                                  (rocblas_double_complex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// herk_batched
+hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    int                         n,
+                                    int                         k,
+                                    const float*                alpha,
+                                    const hipblasComplex* const A[],
+                                    int                         lda,
+                                    const float*                beta,
+                                    hipblasComplex* const       C[],
+                                    int                         ldc,
+                                    int                         batchCount)
+try
+{
+    return rocBLASStatusToHIPStatus(rocblas_cherk_batched((rocblas_handle)handle,
+                                                          (rocblas_fill)uplo,
+                                                          hipOperationToHCCOperation(transA),
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          (rocblas_float_complex**)A,
+                                                          lda,
+                                                          beta,
+                                                          (rocblas_float_complex**)C,
+                                                          ldc,
+                                                          batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
+                                    hipblasFillMode_t                 uplo,
+                                    hipblasOperation_t                transA,
+                                    int                               n,
+                                    int                               k,
+                                    const double*                     alpha,
+                                    const hipblasDoubleComplex* const A[],
+                                    int                               lda,
+                                    const double*                     beta,
+                                    hipblasDoubleComplex* const       C[],
+                                    int                               ldc,
+                                    int                               batchCount)
+try
+{
+    return rocBLASStatusToHIPStatus(rocblas_zherk_batched((rocblas_handle)handle,
+                                                          (rocblas_fill)uplo,
+                                                          hipOperationToHCCOperation(transA),
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          (rocblas_double_complex**)A,
+                                                          lda,
+                                                          beta,
+                                                          (rocblas_double_complex**)C,
+                                                          ldc,
+                                                          batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// herk_strided_batched
+hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
+                                           hipblasFillMode_t     uplo,
+                                           hipblasOperation_t    transA,
+                                           int                   n,
+                                           int                   k,
+                                           const float*          alpha,
+                                           const hipblasComplex* A,
+                                           int                   lda,
+                                           hipblasStride         strideA,
+                                           const float*          beta,
+                                           hipblasComplex*       C,
+                                           int                   ldc,
+                                           hipblasStride         strideC,
+                                           int                   batchCount)
+try
+{
+    return rocBLASStatusToHIPStatus(
+        rocblas_cherk_strided_batched((rocblas_handle)handle,
+                                      (rocblas_fill)uplo,
+                                      hipOperationToHCCOperation(transA),
+                                      n,
+                                      k,
+                                      alpha,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      (rocblas_float_complex*)C,
+                                      ldc,
+                                      strideC,
+                                      batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           int                         n,
+                                           int                         k,
+                                           const double*               alpha,
                                            const hipblasDoubleComplex* A,
                                            int                         lda,
                                            hipblasStride               strideA,
@@ -10619,6 +11987,110 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasCherkBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int                         n,
+                                            int                         k,
+                                            const float*                alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const float*                beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasCherkStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)C});
+    return hipblasCherkBatched(handle,
+                               uplo,
+                               transA,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               beta,
+                               (hipblasComplex* const*)(arrays + batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int                               n,
+                                            int                               k,
+                                            const double*                     alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const double*                     beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasZherkStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)C});
+    return hipblasZherkBatched(handle,
+                               uplo,
+                               transA,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               beta,
+                               (hipblasDoubleComplex* const*)(arrays + batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // herkx
 hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
                               hipblasFillMode_t     uplo,
@@ -11528,6 +13000,246 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasSsymmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float* const B[],
+                                            int                ldb,
+                                            const float*       beta,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasSsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasSsymmBatched(handle,
+                               side,
+                               uplo,
+                               m,
+                               n,
+                               alpha,
+                               (const float* const*)arrays,
+                               lda,
+                               (const float* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (float* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymmBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasFillMode_t   uplo,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double* const B[],
+                                            int                 ldb,
+                                            const double*       beta,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasDsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasDsymmBatched(handle,
+                               side,
+                               uplo,
+                               m,
+                               n,
+                               alpha,
+                               (const double* const*)arrays,
+                               lda,
+                               (const double* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (double* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex* const B[],
+                                            int                         ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasCsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasCsymmBatched(handle,
+                               side,
+                               uplo,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               (const hipblasComplex* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasSideMode_t                 side,
+                                            hipblasFillMode_t                 uplo,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int                               ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasZsymmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasZsymmBatched(handle,
+                               side,
+                               uplo,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               (const hipblasDoubleComplex* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasDoubleComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // syrk
 hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
                              hipblasFillMode_t  uplo,
@@ -11927,6 +13639,214 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasSsyrkBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float*       beta,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasSsyrkStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)C});
+    return hipblasSsyrkBatched(handle,
+                               uplo,
+                               transA,
+                               n,
+                               k,
+                               alpha,
+                               (const float* const*)arrays,
+                               lda,
+                               beta,
+                               (float* const*)(arrays + batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            hipblasOperation_t  transA,
+                                            int                 n,
+                                            int                 k,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double*       beta,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasDsyrkStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)C});
+    return hipblasDsyrkBatched(handle,
+                               uplo,
+                               transA,
+                               n,
+                               k,
+                               alpha,
+                               (const double* const*)arrays,
+                               lda,
+                               beta,
+                               (double* const*)(arrays + batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasCsyrkStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)C});
+    return hipblasCsyrkBatched(handle,
+                               uplo,
+                               transA,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               beta,
+                               (hipblasComplex* const*)(arrays + batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int                               n,
+                                            int                               k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasZsyrkStridedBatched(handle,
+                                          uplo,
+                                          transA,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)C});
+    return hipblasZsyrkBatched(handle,
+                               uplo,
+                               transA,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               beta,
+                               (hipblasDoubleComplex* const*)(arrays + batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // syr2k
 hipblasStatus_t hipblasSsyr2k(hipblasHandle_t    handle,
                               hipblasFillMode_t  uplo,
@@ -13292,6 +15212,246 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasSgeamBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float*       beta,
+                                            const float* const B[],
+                                            int                ldb,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasSgeamStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasSgeamBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               alpha,
+                               (const float* const*)arrays,
+                               lda,
+                               beta,
+                               (const float* const*)(arrays + batchCount),
+                               ldb,
+                               (float* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgeamBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasOperation_t  transa,
+                                            hipblasOperation_t  transb,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double*       beta,
+                                            const double* const B[],
+                                            int                 ldb,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasDgeamStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasDgeamBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               alpha,
+                               (const double* const*)arrays,
+                               lda,
+                               beta,
+                               (const double* const*)(arrays + batchCount),
+                               ldb,
+                               (double* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeamBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex*       beta,
+                                            const hipblasComplex* const B[],
+                                            int                         ldb,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasCgeamStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasCgeamBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               beta,
+                               (const hipblasComplex* const*)(arrays + batchCount),
+                               ldb,
+                               (hipblasComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeamBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasOperation_t                transa,
+                                            hipblasOperation_t                transb,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex*       beta,
+                                            const hipblasDoubleComplex* const B[],
+                                            int                               ldb,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasZgeamStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          beta,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasZgeamBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               beta,
+                               (const hipblasDoubleComplex* const*)(arrays + batchCount),
+                               ldb,
+                               (hipblasDoubleComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // hemm
 hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
                              hipblasSideMode_t     side,
@@ -13942,6 +16102,226 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasStrmmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            float* const       B[],
+                                            int                ldb,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasStrmmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasStrmmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (const float* const*)arrays,
+                               lda,
+                               (float* const*)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmmBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasFillMode_t   uplo,
+                                            hipblasOperation_t  transA,
+                                            hipblasDiagType_t   diag,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       B[],
+                                            int                 ldb,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasDtrmmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasDtrmmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (const double* const*)arrays,
+                               lda,
+                               (double* const*)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            hipblasComplex* const       B[],
+                                            int                         ldb,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasCtrmmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasCtrmmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               (hipblasComplex* const*)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasSideMode_t                 side,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            hipblasDiagType_t                 diag,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            hipblasDoubleComplex* const       B[],
+                                            int                               ldb,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasZtrmmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasZtrmmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               (hipblasDoubleComplex* const*)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // trsm
 hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                              hipblasSideMode_t  side,
@@ -14373,6 +16753,226 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasStrsmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            float* const       A[],
+                                            int                lda,
+                                            float*             B[],
+                                            int                ldb,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasStrsmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasStrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (float* const*)arrays,
+                               lda,
+                               (float**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const double*      alpha,
+                                            double* const      A[],
+                                            int                lda,
+                                            double*            B[],
+                                            int                ldb,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasDtrsmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasDtrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (double* const*)arrays,
+                               lda,
+                               (double**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmBatchedHostPtrs(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            hipblasComplex* const A[],
+                                            int                   lda,
+                                            hipblasComplex*       B[],
+                                            int                   ldb,
+                                            int                   batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasCtrsmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasCtrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (hipblasComplex* const*)arrays,
+                               lda,
+                               (hipblasComplex**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            hipblasDoubleComplex* const A[],
+                                            int                         lda,
+                                            hipblasDoubleComplex*       B[],
+                                            int                         ldb,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideB;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB))
+        return hipblasZtrsmStridedBatched(handle,
+                                          side,
+                                          uplo,
+                                          transA,
+                                          diag,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasZtrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               (hipblasDoubleComplex**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // trtri
 hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
                               hipblasFillMode_t uplo,
@@ -15197,12 +17797,14 @@ hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_batched(
-            (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_batched(
+                (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_batched(
+                (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+    });
 }
 catch(...)
 {
@@ -15218,12 +17820,14 @@ hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_batched(
-            (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_batched(
+                (rocblas_handle)handle, n, n, A, lda, ipiv, n, info, batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_batched(
+                (rocblas_handle)handle, n, n, A, lda, info, batch_count)));
+    });
 }
 catch(...)
 {
@@ -15233,26 +17837,28 @@ catch(...)
 hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
                                      const int             n,
                                      hipblasComplex* const A[],
-                                     const int             lda,
-                                     int*                  ipiv,
-                                     int*                  info,
-                                     const int             batch_count)
-try
-{
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_cgetrf_batched((rocblas_handle)handle,
-                                                              n,
-                                                              n,
-                                                              (rocblas_float_complex**)A,
-                                                              lda,
-                                                              ipiv,
-                                                              n,
-                                                              info,
-                                                              batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_cgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, (rocblas_float_complex**)A, lda, info, batch_count)));
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     int*                  info,
+                                     const int             batch_count)
+try
+{
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_cgetrf_batched((rocblas_handle)handle,
+                                                                  n,
+                                                                  n,
+                                                                  (rocblas_float_complex**)A,
+                                                                  lda,
+                                                                  ipiv,
+                                                                  n,
+                                                                  info,
+                                                                  batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_cgetrf_npvt_batched(
+                (rocblas_handle)handle, n, n, (rocblas_float_complex**)A, lda, info, batch_count)));
+    });
 }
 catch(...)
 {
@@ -15268,20 +17874,28 @@ hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_zgetrf_batched((rocblas_handle)handle,
-                                                              n,
-                                                              n,
-                                                              (rocblas_double_complex**)A,
-                                                              lda,
-                                                              ipiv,
-                                                              n,
-                                                              info,
-                                                              batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_zgetrf_npvt_batched(
-            (rocblas_handle)handle, n, n, (rocblas_double_complex**)A, lda, info, batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_zgetrf_batched((rocblas_handle)handle,
+                                                                  n,
+                                                                  n,
+                                                                  (rocblas_double_complex**)A,
+                                                                  lda,
+                                                                  ipiv,
+                                                                  n,
+                                                                  info,
+                                                                  batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_zgetrf_npvt_batched((rocblas_handle)handle,
+                                              n,
+                                              n,
+                                              (rocblas_double_complex**)A,
+                                              lda,
+                                              info,
+                                              batch_count)));
+    });
 }
 catch(...)
 {
@@ -15300,12 +17914,15 @@ hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetrf_strided_batched(
+                (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_sgetrf_npvt_strided_batched(
+                    (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+    });
 }
 catch(...)
 {
@@ -15323,12 +17940,15 @@ hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_strided_batched(
-            (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetrf_strided_batched(
+                (rocblas_handle)handle, n, n, A, lda, strideA, ipiv, strideP, info, batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_dgetrf_npvt_strided_batched(
+                    (rocblas_handle)handle, n, n, A, lda, strideA, info, batch_count)));
+    });
 }
 catch(...)
 {
@@ -15346,28 +17966,30 @@ hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
                                             const int           batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_cgetrf_strided_batched((rocblas_handle)handle,
-                                                                      n,
-                                                                      n,
-                                                                      (rocblas_float_complex*)A,
-                                                                      lda,
-                                                                      strideA,
-                                                                      ipiv,
-                                                                      strideP,
-                                                                      info,
-                                                                      batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_cgetrf_npvt_strided_batched((rocblas_handle)handle,
-                                                  n,
-                                                  n,
-                                                  (rocblas_float_complex*)A,
-                                                  lda,
-                                                  strideA,
-                                                  info,
-                                                  batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_cgetrf_strided_batched((rocblas_handle)handle,
+                                                                          n,
+                                                                          n,
+                                                                          (rocblas_float_complex*)A,
+                                                                          lda,
+                                                                          strideA,
+                                                                          ipiv,
+                                                                          strideP,
+                                                                          info,
+                                                                          batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_cgetrf_npvt_strided_batched((rocblas_handle)handle,
+                                                      n,
+                                                      n,
+                                                      (rocblas_float_complex*)A,
+                                                      lda,
+                                                      strideA,
+                                                      info,
+                                                      batch_count)));
+    });
 }
 catch(...)
 {
@@ -15385,28 +18007,30 @@ hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
                                             const int             batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_zgetrf_strided_batched((rocblas_handle)handle,
-                                                                      n,
-                                                                      n,
-                                                                      (rocblas_double_complex*)A,
-                                                                      lda,
-                                                                      strideA,
-                                                                      ipiv,
-                                                                      strideP,
-                                                                      info,
-                                                                      batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_zgetrf_npvt_strided_batched((rocblas_handle)handle,
-                                                  n,
-                                                  n,
-                                                  (rocblas_double_complex*)A,
-                                                  lda,
-                                                  strideA,
-                                                  info,
-                                                  batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_zgetrf_strided_batched((rocblas_handle)handle,
+                                                 n,
+                                                 n,
+                                                 (rocblas_double_complex*)A,
+                                                 lda,
+                                                 strideA,
+                                                 ipiv,
+                                                 strideP,
+                                                 info,
+                                                 batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_zgetrf_npvt_strided_batched((rocblas_handle)handle,
+                                                      n,
+                                                      n,
+                                                      (rocblas_double_complex*)A,
+                                                      lda,
+                                                      strideA,
+                                                      info,
+                                                      batch_count)));
+    });
 }
 catch(...)
 {
@@ -16036,13 +18660,16 @@ hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_sgetri_outofplace_batched(
-            (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_sgetri_npvt_outofplace_batched(
-                (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_sgetri_outofplace_batched(
+                    (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_sgetri_npvt_outofplace_batched(
+                    (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
+    });
 }
 catch(...)
 {
@@ -16060,13 +18687,16 @@ hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(rocsolver_dgetri_outofplace_batched(
-            (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_dgetri_npvt_outofplace_batched(
-                (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_dgetri_outofplace_batched(
+                    (rocblas_handle)handle, n, A, lda, ipiv, n, C, ldc, info, batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(
+                rocBLASStatusToHIPStatus(rocsolver_dgetri_npvt_outofplace_batched(
+                    (rocblas_handle)handle, n, A, lda, C, ldc, info, batch_count)));
+    });
 }
 catch(...)
 {
@@ -16084,28 +18714,30 @@ hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(
-            rocBLASStatusToHIPStatus(rocsolver_cgetri_outofplace_batched((rocblas_handle)handle,
-                                                                         n,
-                                                                         (rocblas_float_complex**)A,
-                                                                         lda,
-                                                                         ipiv,
-                                                                         n,
-                                                                         (rocblas_float_complex**)C,
-                                                                         ldc,
-                                                                         info,
-                                                                         batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_cgetri_npvt_outofplace_batched((rocblas_handle)handle,
-                                                     n,
-                                                     (rocblas_float_complex**)A,
-                                                     lda,
-                                                     (rocblas_float_complex**)C,
-                                                     ldc,
-                                                     info,
-                                                     batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_cgetri_outofplace_batched((rocblas_handle)handle,
+                                                    n,
+                                                    (rocblas_float_complex**)A,
+                                                    lda,
+                                                    ipiv,
+                                                    n,
+                                                    (rocblas_float_complex**)C,
+                                                    ldc,
+                                                    info,
+                                                    batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_cgetri_npvt_outofplace_batched((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_float_complex**)A,
+                                                         lda,
+                                                         (rocblas_float_complex**)C,
+                                                         ldc,
+                                                         info,
+                                                         batch_count)));
+    });
 }
 catch(...)
 {
@@ -16123,28 +18755,30 @@ hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
-    if(ipiv != nullptr)
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_zgetri_outofplace_batched((rocblas_handle)handle,
-                                                n,
-                                                (rocblas_double_complex**)A,
-                                                lda,
-                                                ipiv,
-                                                n,
-                                                (rocblas_double_complex**)C,
-                                                ldc,
-                                                info,
-                                                batch_count)));
-    else
-        return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
-            rocsolver_zgetri_npvt_outofplace_batched((rocblas_handle)handle,
-                                                     n,
-                                                     (rocblas_double_complex**)A,
-                                                     lda,
-                                                     (rocblas_double_complex**)C,
-                                                     ldc,
-                                                     info,
-                                                     batch_count)));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        if(ipiv != nullptr)
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_zgetri_outofplace_batched((rocblas_handle)handle,
+                                                    n,
+                                                    (rocblas_double_complex**)A,
+                                                    lda,
+                                                    ipiv,
+                                                    n,
+                                                    (rocblas_double_complex**)C,
+                                                    ldc,
+                                                    info,
+                                                    batch_count)));
+        else
+            return HIPBLAS_DEMAND_ALLOC(rocBLASStatusToHIPStatus(
+                rocsolver_zgetri_npvt_outofplace_batched((rocblas_handle)handle,
+                                                         n,
+                                                         (rocblas_double_complex**)A,
+                                                         lda,
+                                                         (rocblas_double_complex**)C,
+                                                         ldc,
+                                                         info,
+                                                         batch_count)));
+    });
 }
 catch(...)
 {
@@ -17308,6 +19942,610 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasHgemmBatchedHostPtrs(hipblasHandle_t          handle,
+                                            hipblasOperation_t       transa,
+                                            hipblasOperation_t       transb,
+                                            int                      m,
+                                            int                      n,
+                                            int                      k,
+                                            const hipblasHalf*       alpha,
+                                            const hipblasHalf* const A[],
+                                            int                      lda,
+                                            const hipblasHalf* const B[],
+                                            int                      ldb,
+                                            const hipblasHalf*       beta,
+                                            hipblasHalf* const       C[],
+                                            int                      ldc,
+                                            int                      batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasHgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasHgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasHalf* const*)arrays,
+                               lda,
+                               (const hipblasHalf* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasHalf* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float* const B[],
+                                            int                ldb,
+                                            const float*       beta,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasSgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasSgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const float* const*)arrays,
+                               lda,
+                               (const float* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (float* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasOperation_t  transa,
+                                            hipblasOperation_t  transb,
+                                            int                 m,
+                                            int                 n,
+                                            int                 k,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double* const B[],
+                                            int                 ldb,
+                                            const double*       beta,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasDgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasDgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const double* const*)arrays,
+                               lda,
+                               (const double* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (double* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
+                                            int                         m,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex* const B[],
+                                            int                         ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasCgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasCgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               (const hipblasComplex* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasOperation_t                transa,
+                                            hipblasOperation_t                transb,
+                                            int                               m,
+                                            int                               n,
+                                            int                               k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int                               ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasZgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasZgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               (const hipblasDoubleComplex* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasDoubleComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gemm3m
+hipblasStatus_t hipblasCgemm3m(hipblasHandle_t       handle,
+                               hipblasOperation_t    transa,
+                               hipblasOperation_t    transb,
+                               int                   m,
+                               int                   n,
+                               int                   k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* B,
+                               int                   ldb,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int                   ldc)
+{
+    return hipblasCgemm3mStridedBatched(
+        handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+}
+
+hipblasStatus_t hipblasCgemm3mBatched(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transa,
+                                      hipblasOperation_t          transb,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasComplex*       alpha,
+                                      const hipblasComplex* const A[],
+                                      int                         lda,
+                                      const hipblasComplex* const B[],
+                                      int                         ldb,
+                                      const hipblasComplex*       beta,
+                                      hipblasComplex* const       C[],
+                                      int                         ldc,
+                                      int                         batchCount)
+try
+{
+    hipblasStatus_t status
+        = hipblas_gemm3m_arguments(handle, transa, transb, m, n, k, lda, ldb, ldc, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batchCount)
+        return status;
+    if(!k)
+        return hipblasCgemmBatched(
+            handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+
+    // The pointers are read back, an evenly spaced batch is run strided, any other from the
+    // arrays of the caller
+    auto          a = batched_emulation::pointers(handle, A, batchCount);
+    auto          b = batched_emulation::pointers(handle, B, batchCount);
+    auto          c = batched_emulation::pointers(handle, C, batchCount);
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(a.data(), batchCount, &strideA)
+       && hipblas_uniform_stride(b.data(), batchCount, &strideB)
+       && hipblas_uniform_stride(c.data(), batchCount, &strideC))
+        return hipblasCgemm3mStridedBatched(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             a[0],
+                                             lda,
+                                             strideA,
+                                             b[0],
+                                             ldb,
+                                             strideB,
+                                             beta,
+                                             c[0],
+                                             ldc,
+                                             strideC,
+                                             batchCount);
+
+    return hipblas_gemm3m_batched(
+        handle,
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        alpha,
+        A,
+        lda,
+        B,
+        ldb,
+        beta,
+        C,
+        ldc,
+        batchCount,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm3mStridedBatched(hipblasHandle_t       handle,
+                                             hipblasOperation_t    transa,
+                                             hipblasOperation_t    transb,
+                                             int                   m,
+                                             int                   n,
+                                             int                   k,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             long long             strideA,
+                                             const hipblasComplex* B,
+                                             int                   ldb,
+                                             long long             strideB,
+                                             const hipblasComplex* beta,
+                                             hipblasComplex*       C,
+                                             int                   ldc,
+                                             long long             strideC,
+                                             int                   batchCount)
+try
+{
+    return hipblas_gemm3m_strided_batched(
+        handle,
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        alpha,
+        A,
+        lda,
+        strideA,
+        B,
+        ldb,
+        strideB,
+        beta,
+        C,
+        ldc,
+        strideC,
+        batchCount,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm3m(hipblasHandle_t             handle,
+                               hipblasOperation_t          transa,
+                               hipblasOperation_t          transb,
+                               int                         m,
+                               int                         n,
+                               int                         k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* B,
+                               int                         ldb,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int                         ldc)
+{
+    return hipblasZgemm3mStridedBatched(
+        handle, transa, transb, m, n, k, alpha, A, lda, 0, B, ldb, 0, beta, C, ldc, 0, 1);
+}
+
+hipblasStatus_t hipblasZgemm3mBatched(hipblasHandle_t                   handle,
+                                      hipblasOperation_t                transa,
+                                      hipblasOperation_t                transb,
+                                      int                               m,
+                                      int                               n,
+                                      int                               k,
+                                      const hipblasDoubleComplex*       alpha,
+                                      const hipblasDoubleComplex* const A[],
+                                      int                               lda,
+                                      const hipblasDoubleComplex* const B[],
+                                      int                               ldb,
+                                      const hipblasDoubleComplex*       beta,
+                                      hipblasDoubleComplex* const       C[],
+                                      int                               ldc,
+                                      int                               batchCount)
+try
+{
+    hipblasStatus_t status
+        = hipblas_gemm3m_arguments(handle, transa, transb, m, n, k, lda, ldb, ldc, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batchCount)
+        return status;
+    if(!k)
+        return hipblasZgemmBatched(
+            handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+
+    // The pointers are read back, an evenly spaced batch is run strided, any other from the
+    // arrays of the caller
+    auto          a = batched_emulation::pointers(handle, A, batchCount);
+    auto          b = batched_emulation::pointers(handle, B, batchCount);
+    auto          c = batched_emulation::pointers(handle, C, batchCount);
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(a.data(), batchCount, &strideA)
+       && hipblas_uniform_stride(b.data(), batchCount, &strideB)
+       && hipblas_uniform_stride(c.data(), batchCount, &strideC))
+        return hipblasZgemm3mStridedBatched(handle,
+                                             transa,
+                                             transb,
+                                             m,
+                                             n,
+                                             k,
+                                             alpha,
+                                             a[0],
+                                             lda,
+                                             strideA,
+                                             b[0],
+                                             ldb,
+                                             strideB,
+                                             beta,
+                                             c[0],
+                                             ldc,
+                                             strideC,
+                                             batchCount);
+
+    return hipblas_gemm3m_batched(
+        handle,
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        alpha,
+        A,
+        lda,
+        B,
+        ldb,
+        beta,
+        C,
+        ldc,
+        batchCount,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm3mStridedBatched(hipblasHandle_t             handle,
+                                             hipblasOperation_t          transa,
+                                             hipblasOperation_t          transb,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             long long                   strideA,
+                                             const hipblasDoubleComplex* B,
+                                             int                         ldb,
+                                             long long                   strideB,
+                                             const hipblasDoubleComplex* beta,
+                                             hipblasDoubleComplex*       C,
+                                             int                         ldc,
+                                             long long                   strideC,
+                                             int                         batchCount)
+try
+{
+    return hipblas_gemm3m_strided_batched(
+        handle,
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        alpha,
+        A,
+        lda,
+        strideA,
+        B,
+        ldb,
+        strideB,
+        beta,
+        C,
+        ldc,
+        strideC,
+        batchCount,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // gemm_ex
 // Note for int8 users - For rocBLAS backend, please read rocblas_gemm_ex documentation on int8
 // data layout requirements. hipBLAS makes the assumption that the data layout is in the preferred
@@ -17618,51 +20856,283 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
-// // syrk_ex
-// hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t       handle,
-//                                           hipblasFillMode_t     uplo,
-//                                           hipblasOperation_t    trans,
-//                                           int                   n,
-//                                           int                   k,
-//                                           const hipblasComplex* alpha,
-//                                           const void*           A,
-//                                           hipblasDatatype_t     Atype,
-//                                           int                   lda,
-//                                           const hipblasComplex* beta,
-//                                           hipblasComplex*       C,
-//                                           hipblasDatatype_t     Ctype,
-//                                           int                   ldc)
-// try
-// {
-//     return HIPBLAS_STATUS_NOT_SUPPORTED;
-// }
-// catch(...)
-// {
-//     return exception_to_hipblas_status();
-// }
-
-// // herk_ex
-// hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
-//                                           hipblasFillMode_t  uplo,
-//                                           hipblasOperation_t trans,
-//                                           int                n,
-//                                           int                k,
-//                                           const float*       alpha,
-//                                           const void*        A,
-//                                           hipblasDatatype_t  Atype,
-//                                           int                lda,
-//                                           const float*       beta,
-//                                           hipblasComplex*    C,
-//                                           hipblasDatatype_t  Ctype,
-//                                           int                ldc)
-// try
-// {
-//     return HIPBLAS_STATUS_NOT_SUPPORTED;
-// }
-// catch(...)
-// {
-//     return exception_to_hipblas_status();
-// }
+// syrk_ex
+hipblasStatus_t hipblasSyrkEx(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t trans,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        beta,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        0,
+        beta,
+        C,
+        c_type,
+        ldc,
+        0,
+        1,
+        compute_type,
+        false,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSyrkBatchedEx(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t trans,
+                                     int                n,
+                                     int                k,
+                                     const void*        alpha,
+                                     const void*        A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        beta,
+                                     void*              C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        beta,
+        C,
+        c_type,
+        ldc,
+        batch_count,
+        compute_type,
+        false,
+        [&](auto array) { return batched_emulation::pointers(handle, array, batch_count); },
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSyrkStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t trans,
+                                            int                n,
+                                            int                k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            hipblasStride      stride_C,
+                                            int                batch_count,
+                                            hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        stride_A,
+        beta,
+        C,
+        c_type,
+        ldc,
+        stride_C,
+        batch_count,
+        compute_type,
+        false,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// herk_ex
+hipblasStatus_t hipblasHerkEx(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t trans,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        beta,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        0,
+        beta,
+        C,
+        c_type,
+        ldc,
+        0,
+        1,
+        compute_type,
+        true,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHerkBatchedEx(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t trans,
+                                     int                n,
+                                     int                k,
+                                     const void*        alpha,
+                                     const void*        A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        beta,
+                                     void*              C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        beta,
+        C,
+        c_type,
+        ldc,
+        batch_count,
+        compute_type,
+        true,
+        [&](auto array) { return batched_emulation::pointers(handle, array, batch_count); },
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHerkStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t trans,
+                                            int                n,
+                                            int                k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            hipblasStride      stride_C,
+                                            int                batch_count,
+                                            hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        stride_A,
+        beta,
+        C,
+        c_type,
+        ldc,
+        stride_C,
+        batch_count,
+        compute_type,
+        true,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
 
 // axpy_ex
 hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
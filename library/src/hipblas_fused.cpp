@@ -0,0 +1,2117 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "batched_emulation.hpp"
+#include "exceptions.hpp"
+#include "host_pointer_arrays.hpp"
+#include "host_pointer_mode.hpp"
+#include "storage_conversion.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+/*!\file
+ * \brief Fused level 1 routines: axpby, axpy followed by dot, a dot of one vector with k vectors
+ * and nrm2 followed by the scaling to unit norm.
+ *
+ * They are built on the routines of the public API, so one implementation serves both backends.
+ * Where a backend routine does the fused work in one pass over the vectors it is used: axpby is
+ * geam on 1 x n matrices in place, the k dots are one gemv (one gemm in half precision) and the
+ * scaling by the norm is a 1 x 1 triangular solve, which reads the norm from device memory so
+ * that no host round trip separates it from nrm2. axpy and dot have no such backend routine and
+ * are issued back to back on the stream of the handle, two passes over y.
+ */
+
+namespace
+{
+    // value + 0i for complex T
+    template <typename T, typename R>
+    T real_scalar(R value)
+    {
+        T scalar{};
+        *reinterpret_cast<R*>(&scalar) = value;
+        return scalar;
+    }
+
+    // only 0 and 1 are needed in half precision, which is stored as its bits
+    template <>
+    hipblasHalf real_scalar<hipblasHalf, float>(float value)
+    {
+        return value == 0 ? 0 : 0x3C00;
+    }
+
+    // Marks a precision without geam; axpby then always scales y and adds alpha * x
+    struct no_geam
+    {
+        template <typename... Args>
+        hipblasStatus_t operator()(Args...) const
+        {
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+    };
+
+    template <typename Geam>
+    constexpr bool has_geam(Geam)
+    {
+        return true;
+    }
+
+    constexpr bool has_geam(no_geam)
+    {
+        return false;
+    }
+
+    // y := alpha * x + beta * y is geam on the 1 x n matrices x and y with leading dimensions
+    // |incx| and |incy|, in place in y. Increments of opposite signs pair the elements of x and y
+    // in reverse storage order and incx = 0 repeats x[0], which geam cannot express; then y is
+    // scaled by a gemm with k = 0, C := beta * C, and axpy adds alpha * x. Like geam, that gemm
+    // does not read y for beta = 0, so both ways give alpha * x even where y holds NaN. An
+    // increment incy = 0 would make the result depend on the order of the updates and is invalid
+    template <typename T, typename Geam, typename Gemm, typename Axpy>
+    hipblasStatus_t axpby(hipblasHandle_t handle,
+                          int             n,
+                          const T*        alpha,
+                          const T*        x,
+                          int             incx,
+                          const T*        beta,
+                          T*              y,
+                          int             incy,
+                          Geam            geam,
+                          Gemm            gemm,
+                          Axpy            axpy)
+    {
+        if(incy == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(has_geam(geam) && incx != 0 && (incx > 0) == (incy > 0))
+            return geam(handle,
+                        HIPBLAS_OP_N,
+                        HIPBLAS_OP_N,
+                        1,
+                        n,
+                        alpha,
+                        x,
+                        std::abs(incx),
+                        beta,
+                        y,
+                        std::abs(incy),
+                        y,
+                        std::abs(incy));
+
+        hipblasStatus_t status = gemm(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      1,
+                                      n,
+                                      0,
+                                      alpha,
+                                      x,
+                                      1,
+                                      x,
+                                      1,
+                                      beta,
+                                      y,
+                                      std::abs(incy));
+        return status != HIPBLAS_STATUS_SUCCESS ? status : axpy(handle, n, alpha, x, incx, y, incy);
+    }
+
+    template <typename T, typename Geam, typename Gemm, typename Axpy>
+    hipblasStatus_t axpby_batched(hipblasHandle_t handle,
+                                  int             n,
+                                  const T*        alpha,
+                                  const T* const  x[],
+                                  int             incx,
+                                  const T*        beta,
+                                  T* const        y[],
+                                  int             incy,
+                                  int             batchCount,
+                                  Geam            geam,
+                                  Gemm            gemm,
+                                  Axpy            axpy)
+    {
+        if(incy == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n <= 0 || batchCount <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(has_geam(geam) && incx != 0 && (incx > 0) == (incy > 0))
+            return geam(handle,
+                        HIPBLAS_OP_N,
+                        HIPBLAS_OP_N,
+                        1,
+                        n,
+                        alpha,
+                        x,
+                        std::abs(incx),
+                        beta,
+                        y,
+                        std::abs(incy),
+                        y,
+                        std::abs(incy),
+                        batchCount);
+
+        hipblasStatus_t status = gemm(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      1,
+                                      n,
+                                      0,
+                                      alpha,
+                                      x,
+                                      1,
+                                      x,
+                                      1,
+                                      beta,
+                                      y,
+                                      std::abs(incy),
+                                      batchCount);
+        return status != HIPBLAS_STATUS_SUCCESS
+                   ? status
+                   : axpy(handle, n, alpha, x, incx, y, incy, batchCount);
+    }
+
+    template <typename T, typename Geam, typename Gemm, typename Axpy>
+    hipblasStatus_t axpby_strided_batched(hipblasHandle_t handle,
+                                          int             n,
+                                          const T*        alpha,
+                                          const T*        x,
+                                          int             incx,
+                                          hipblasStride   stridex,
+                                          const T*        beta,
+                                          T*              y,
+                                          int             incy,
+                                          hipblasStride   stridey,
+                                          int             batchCount,
+                                          Geam            geam,
+                                          Gemm            gemm,
+                                          Axpy            axpy)
+    {
+        if(incy == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n <= 0 || batchCount <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(has_geam(geam) && incx != 0 && (incx > 0) == (incy > 0))
+            return geam(handle,
+                        HIPBLAS_OP_N,
+                        HIPBLAS_OP_N,
+                        1,
+                        n,
+                        alpha,
+                        x,
+                        std::abs(incx),
+                        stridex,
+                        beta,
+                        y,
+                        std::abs(incy),
+                        stridey,
+                        y,
+                        std::abs(incy),
+                        stridey,
+                        batchCount);
+
+        hipblasStatus_t status = gemm(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      1,
+                                      n,
+                                      0,
+                                      alpha,
+                                      x,
+                                      1,
+                                      stridex,
+                                      x,
+                                      1,
+                                      stridex,
+                                      beta,
+                                      y,
+                                      std::abs(incy),
+                                      stridey,
+                                      batchCount);
+        return status != HIPBLAS_STATUS_SUCCESS
+                   ? status
+                   : axpy(handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    }
+
+    // Half precision has gemm but no gemv: result**T := x**T * Y with x seen as the 1 x n matrix of
+    // leading dimension incx, which needs incx > 0
+    struct hgemv_by_gemm
+    {
+        hipblasStatus_t operator()(hipblasHandle_t    handle,
+                                   hipblasOperation_t,
+                                   int                n,
+                                   int                k,
+                                   const hipblasHalf* alpha,
+                                   const hipblasHalf* Y,
+                                   int                ldy,
+                                   const hipblasHalf* x,
+                                   int                incx,
+                                   const hipblasHalf* beta,
+                                   hipblasHalf*       result,
+                                   int) const
+        {
+            return hipblasHgemm(handle,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_OP_N,
+                                1,
+                                k,
+                                n,
+                                alpha,
+                                x,
+                                incx,
+                                Y,
+                                ldy,
+                                beta,
+                                result,
+                                1);
+        }
+
+        hipblasStatus_t operator()(hipblasHandle_t    handle,
+                                   hipblasOperation_t,
+                                   int                n,
+                                   int                k,
+                                   const hipblasHalf* alpha,
+                                   const hipblasHalf* Y,
+                                   int                ldy,
+                                   hipblasStride      strideY,
+                                   const hipblasHalf* x,
+                                   int                incx,
+                                   hipblasStride      stridex,
+                                   const hipblasHalf* beta,
+                                   hipblasHalf*       result,
+                                   int,
+                                   hipblasStride      strideResult,
+                                   int                batchCount) const
+        {
+            return hipblasHgemmStridedBatched(handle,
+                                              HIPBLAS_OP_N,
+                                              HIPBLAS_OP_N,
+                                              1,
+                                              k,
+                                              n,
+                                              alpha,
+                                              x,
+                                              incx,
+                                              stridex,
+                                              Y,
+                                              ldy,
+                                              strideY,
+                                              beta,
+                                              result,
+                                              1,
+                                              strideResult,
+                                              batchCount);
+        }
+    };
+
+    template <typename Gemv>
+    bool gemv_supports(Gemv, int)
+    {
+        return true;
+    }
+
+    bool gemv_supports(hgemv_by_gemm, int incx)
+    {
+        return incx > 0;
+    }
+
+    // result[j] := Y(:, j)**H * x as one gemv with Y**H (Y**T for real types), which reads Y and
+    // x once. gemv writes its result to device memory and leaves it unwritten for n = 0, so in
+    // host pointer mode or for n <= 0 the k dots are issued instead
+    template <typename T, typename R, typename Gemv, typename Dot>
+    hipblasStatus_t dot_multi(hipblasHandle_t    handle,
+                              int                n,
+                              int                k,
+                              const T*           x,
+                              int                incx,
+                              const T*           Y,
+                              int                ldy,
+                              T*                 result,
+                              hipblasOperation_t trans,
+                              Gemv               gemv,
+                              Dot                dot)
+    {
+        if(k < 0 || ldy < std::max(n, 1))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(n > 0 && gemv_supports(gemv, incx)
+           && hipblas_pointer_mode(handle) == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            hipblas_host_pointer_mode constants(handle);
+            T                         one = real_scalar<T, R>(1), zero = real_scalar<T, R>(0);
+            return gemv(handle, trans, n, k, &one, Y, ldy, x, incx, &zero, result, 1);
+        }
+
+        for(int j = 0; j < k; j++)
+        {
+            hipblasStatus_t status = dot(handle, n, Y + size_t(j) * ldy, 1, x, incx, result + j);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // result + b * k holds the k dots of instance b. The fallback issues one strided batched dot
+    // per instance over its k columns, all with the same x_b; for n <= 0 a single one zeroes
+    // every result
+    template <typename T, typename R, typename Gemv, typename Dot>
+    hipblasStatus_t dot_multi_strided_batched(hipblasHandle_t    handle,
+                                              int                n,
+                                              int                k,
+                                              const T*           x,
+                                              int                incx,
+                                              hipblasStride      stridex,
+                                              const T*           Y,
+                                              int                ldy,
+                                              hipblasStride      strideY,
+                                              int                batchCount,
+                                              T*                 result,
+                                              hipblasOperation_t trans,
+                                              Gemv               gemv,
+                                              Dot                dot)
+    {
+        if(k < 0 || ldy < std::max(n, 1) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(k == 0 || batchCount == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(n <= 0)
+            return dot(handle, n, x, incx, stridex, x, incx, stridex, k * batchCount, result);
+
+        if(gemv_supports(gemv, incx) && hipblas_pointer_mode(handle) == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            hipblas_host_pointer_mode constants(handle);
+            T                         one = real_scalar<T, R>(1), zero = real_scalar<T, R>(0);
+            return gemv(handle,
+                        trans,
+                        n,
+                        k,
+                        &one,
+                        Y,
+                        ldy,
+                        strideY,
+                        x,
+                        incx,
+                        stridex,
+                        &zero,
+                        result,
+                        1,
+                        k,
+                        batchCount);
+        }
+
+        for(int b = 0; b < batchCount; b++)
+        {
+            hipblasStatus_t status = dot(handle,
+                                         n,
+                                         Y + b * strideY,
+                                         1,
+                                         ldy,
+                                         x + b * stridex,
+                                         incx,
+                                         0,
+                                         k,
+                                         result + size_t(b) * k);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The arrays of pointers are read back to the host. Instances evenly spaced in memory run as
+    // the strided batched form, others one at a time with their k dots at result + b * k
+    template <typename T, typename R, typename Gemv, typename Dot>
+    hipblasStatus_t dot_multi_batched(hipblasHandle_t    handle,
+                                      int                n,
+                                      int                k,
+                                      const T* const     x[],
+                                      int                incx,
+                                      const T* const     Y[],
+                                      int                ldy,
+                                      int                batchCount,
+                                      T*                 result,
+                                      hipblasOperation_t trans,
+                                      Gemv               gemv,
+                                      Dot                dot)
+    {
+        if(k < 0 || ldy < std::max(n, 1) || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n <= 0 || k == 0 || batchCount == 0)
+            return dot_multi_strided_batched<T, R>(handle,
+                                                   n,
+                                                   k,
+                                                   nullptr,
+                                                   incx,
+                                                   0,
+                                                   nullptr,
+                                                   ldy,
+                                                   0,
+                                                   batchCount,
+                                                   result,
+                                                   trans,
+                                                   gemv,
+                                                   dot);
+        if(!x || !Y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::vector<const T*> host_x = hipblas_host_pointers(handle, x, batchCount);
+        std::vector<const T*> host_Y = hipblas_host_pointers(handle, Y, batchCount);
+        hipblasStride         stridex, strideY;
+        if(hipblas_uniform_stride(host_x.data(), batchCount, &stridex)
+           && hipblas_uniform_stride(host_Y.data(), batchCount, &strideY))
+            return dot_multi_strided_batched<T, R>(handle,
+                                                   n,
+                                                   k,
+                                                   host_x[0],
+                                                   incx,
+                                                   stridex,
+                                                   host_Y[0],
+                                                   ldy,
+                                                   strideY,
+                                                   batchCount,
+                                                   result,
+                                                   trans,
+                                                   gemv,
+                                                   dot);
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = dot_multi_strided_batched<T, R>(handle,
+                                                     n,
+                                                     k,
+                                                     host_x[b],
+                                                     incx,
+                                                     0,
+                                                     host_Y[b],
+                                                     ldy,
+                                                     0,
+                                                     1,
+                                                     result + size_t(b) * k,
+                                                     trans,
+                                                     gemv,
+                                                     dot);
+        return status;
+    }
+
+    // x := x / result solves result * x' = x, the 1 x 1 triangular matrix result on the left of
+    // x seen as a 1 x n matrix of reals with leading dimension incx. The real and imaginary parts
+    // of a complex x are two such rows, or one row of 2n reals for incx = 1
+    template <typename T, typename R, typename Trsm>
+    hipblasStatus_t divide_by_norm(hipblasHandle_t handle,
+                                   int             n,
+                                   T*              x,
+                                   int             incx,
+                                   hipblasStride   stridex,
+                                   int             batchCount,
+                                   R*              result,
+                                   Trsm            trsm)
+    {
+        constexpr int             parts = sizeof(T) / sizeof(R);
+        hipblas_host_pointer_mode constants(handle);
+        R                         one = 1;
+        R*                        re  = (R*)x;
+
+        if(parts == 1 || incx == 1)
+            return trsm(handle,
+                        HIPBLAS_SIDE_LEFT,
+                        HIPBLAS_FILL_MODE_UPPER,
+                        HIPBLAS_OP_N,
+                        HIPBLAS_DIAG_NON_UNIT,
+                        1,
+                        n * parts,
+                        &one,
+                        result,
+                        1,
+                        1,
+                        re,
+                        parts == 1 ? incx : 1,
+                        stridex * parts,
+                        batchCount);
+
+        for(int part = 0; part < parts; part++)
+        {
+            hipblasStatus_t status = trsm(handle,
+                                          HIPBLAS_SIDE_LEFT,
+                                          HIPBLAS_FILL_MODE_UPPER,
+                                          HIPBLAS_OP_N,
+                                          HIPBLAS_DIAG_NON_UNIT,
+                                          1,
+                                          n,
+                                          &one,
+                                          result,
+                                          1,
+                                          1,
+                                          re + part,
+                                          incx * parts,
+                                          stridex * parts,
+                                          batchCount);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // result := ||x||, then x := x / result where result != 0; a zero x is left unchanged. In host
+    // pointer mode the norm is on the host and x is scaled by its reciprocal. In device pointer
+    // mode x is divided on the device by result + c, where rotg of (0, result) gives c = 1 for
+    // result = 0 and c = 0 otherwise, so no host round trip separates nrm2 from the division.
+    // The divisors are built in the scratch of the handle from a copy of the norms, which rotg
+    // overwrites
+    template <typename T,
+              typename R,
+              typename Nrm2,
+              typename Scal,
+              typename Copy,
+              typename Rotg,
+              typename Axpy,
+              typename Trsm>
+    hipblasStatus_t normalize_strided_batched(hipblasHandle_t handle,
+                                              int             n,
+                                              T*              x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              int             batchCount,
+                                              R*              result,
+                                              Nrm2            nrm2,
+                                              Scal            scal,
+                                              Copy            copy,
+                                              Rotg            rotg,
+                                              Axpy            axpy,
+                                              Trsm            trsm)
+    {
+        hipblasStatus_t status = nrm2(handle, n, x, incx, stridex, batchCount, result);
+        if(status != HIPBLAS_STATUS_SUCCESS || n <= 0 || incx <= 0 || batchCount <= 0)
+            return status;
+
+        if(hipblas_pointer_mode(handle) == HIPBLAS_POINTER_MODE_HOST)
+        {
+            for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+                if(result[b] != 0)
+                {
+                    R inverse = R(1) / result[b];
+                    status    = scal(handle, n, &inverse, x + b * stridex, incx);
+                }
+            return status;
+        }
+
+        R* divisor = static_cast<R*>(hipblas_scratch(handle, 4 * sizeof(R) * batchCount));
+        R* norm    = divisor + batchCount;
+        R* c       = norm + batchCount;
+        R* s       = c + batchCount;
+
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && hipMemsetAsync(divisor, 0, sizeof(R) * batchCount, stream) != hipSuccess)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy(handle, batchCount, result, 1, norm, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = rotg(handle, divisor, 1, norm, 1, c, 1, s, 1, batchCount);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_host_pointer_mode constants(handle);
+            R                         one = 1;
+            status = axpy(handle, batchCount, &one, c, 1, divisor, 1);
+        }
+        return status != HIPBLAS_STATUS_SUCCESS
+                   ? status
+                   : divide_by_norm(handle, n, x, incx, stridex, batchCount, divisor, trsm);
+    }
+
+    // As dot_multi_batched, the arrays of pointers are read back to the host
+    template <typename T,
+              typename R,
+              typename Nrm2,
+              typename Scal,
+              typename Copy,
+              typename Rotg,
+              typename Axpy,
+              typename Trsm>
+    hipblasStatus_t normalize_batched(hipblasHandle_t handle,
+                                      int             n,
+                                      T* const        x[],
+                                      int             incx,
+                                      int             batchCount,
+                                      R*              result,
+                                      Nrm2            nrm2,
+                                      Scal            scal,
+                                      Copy            copy,
+                                      Rotg            rotg,
+                                      Axpy            axpy,
+                                      Trsm            trsm)
+    {
+        if(n <= 0 || incx <= 0 || batchCount <= 0)
+            return normalize_strided_batched<T>(handle,
+                                                n,
+                                                nullptr,
+                                                incx,
+                                                0,
+                                                batchCount,
+                                                result,
+                                                nrm2,
+                                                scal,
+                                                copy,
+                                                rotg,
+                                                axpy,
+                                                trsm);
+        if(!x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::vector<T*> host_x = hipblas_host_pointers(handle, x, batchCount);
+        hipblasStride   stridex;
+        if(hipblas_uniform_stride(host_x.data(), batchCount, &stridex))
+            return normalize_strided_batched(handle,
+                                             n,
+                                             host_x[0],
+                                             incx,
+                                             stridex,
+                                             batchCount,
+                                             result,
+                                             nrm2,
+                                             scal,
+                                             copy,
+                                             rotg,
+                                             axpy,
+                                             trsm);
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = normalize_strided_batched(handle,
+                                               n,
+                                               host_x[b],
+                                               incx,
+                                               0,
+                                               1,
+                                               result + b,
+                                               nrm2,
+                                               scal,
+                                               copy,
+                                               rotg,
+                                               axpy,
+                                               trsm);
+        return status;
+    }
+}
+
+extern "C" {
+
+// axpby
+hipblasStatus_t hipblasHaxpby(hipblasHandle_t    handle,
+                              int                n,
+                              const hipblasHalf* alpha,
+                              const hipblasHalf* x,
+                              int                incx,
+                              const hipblasHalf* beta,
+                              hipblasHalf*       y,
+                              int                incy)
+try
+{
+    return axpby(handle, n, alpha, x, incx, beta, y, incy, no_geam{}, hipblasHgemm, hipblasHaxpy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpby(hipblasHandle_t handle,
+                              int             n,
+                              const float*    alpha,
+                              const float*    x,
+                              int             incx,
+                              const float*    beta,
+                              float*          y,
+                              int             incy)
+try
+{
+    return axpby(
+        handle, n, alpha, x, incx, beta, y, incy, hipblasSgeam, hipblasSgemm, hipblasSaxpy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpby(hipblasHandle_t handle,
+                              int             n,
+                              const double*   alpha,
+                              const double*   x,
+                              int             incx,
+                              const double*   beta,
+                              double*         y,
+                              int             incy)
+try
+{
+    return axpby(
+        handle, n, alpha, x, incx, beta, y, incy, hipblasDgeam, hipblasDgemm, hipblasDaxpy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpby(hipblasHandle_t       handle,
+                              int                   n,
+                              const hipblasComplex* alpha,
+                              const hipblasComplex* x,
+                              int                   incx,
+                              const hipblasComplex* beta,
+                              hipblasComplex*       y,
+                              int                   incy)
+try
+{
+    return axpby(
+        handle, n, alpha, x, incx, beta, y, incy, hipblasCgeam, hipblasCgemm, hipblasCaxpy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpby(hipblasHandle_t             handle,
+                              int                         n,
+                              const hipblasDoubleComplex* alpha,
+                              const hipblasDoubleComplex* x,
+                              int                         incx,
+                              const hipblasDoubleComplex* beta,
+                              hipblasDoubleComplex*       y,
+                              int                         incy)
+try
+{
+    return axpby(
+        handle, n, alpha, x, incx, beta, y, incy, hipblasZgeam, hipblasZgemm, hipblasZaxpy);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// axpbyBatched
+hipblasStatus_t hipblasHaxpbyBatched(hipblasHandle_t          handle,
+                                     int                      n,
+                                     const hipblasHalf*       alpha,
+                                     const hipblasHalf* const x[],
+                                     int                      incx,
+                                     const hipblasHalf*       beta,
+                                     hipblasHalf* const       y[],
+                                     int                      incy,
+                                     int                      batchCount)
+try
+{
+    return axpby_batched(handle,
+                         n,
+                         alpha,
+                         x,
+                         incx,
+                         beta,
+                         y,
+                         incy,
+                         batchCount,
+                         no_geam{},
+                         hipblasHgemmBatched,
+                         hipblasHaxpyBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpbyBatched(hipblasHandle_t    handle,
+                                     int                n,
+                                     const float*       alpha,
+                                     const float* const x[],
+                                     int                incx,
+                                     const float*       beta,
+                                     float* const       y[],
+                                     int                incy,
+                                     int                batchCount)
+try
+{
+    return axpby_batched(handle,
+                         n,
+                         alpha,
+                         x,
+                         incx,
+                         beta,
+                         y,
+                         incy,
+                         batchCount,
+                         hipblasSgeamBatched,
+                         hipblasSgemmBatched,
+                         hipblasSaxpyBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpbyBatched(hipblasHandle_t     handle,
+                                     int                 n,
+                                     const double*       alpha,
+                                     const double* const x[],
+                                     int                 incx,
+                                     const double*       beta,
+                                     double* const       y[],
+                                     int                 incy,
+                                     int                 batchCount)
+try
+{
+    return axpby_batched(handle,
+                         n,
+                         alpha,
+                         x,
+                         incx,
+                         beta,
+                         y,
+                         incy,
+                         batchCount,
+                         hipblasDgeamBatched,
+                         hipblasDgemmBatched,
+                         hipblasDaxpyBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpbyBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     const hipblasComplex*       beta,
+                                     hipblasComplex* const       y[],
+                                     int                         incy,
+                                     int                         batchCount)
+try
+{
+    return axpby_batched(handle,
+                         n,
+                         alpha,
+                         x,
+                         incx,
+                         beta,
+                         y,
+                         incy,
+                         batchCount,
+                         hipblasCgeamBatched,
+                         hipblasCgemmBatched,
+                         hipblasCaxpyBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpbyBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       y[],
+                                     int                               incy,
+                                     int                               batchCount)
+try
+{
+    return axpby_batched(handle,
+                         n,
+                         alpha,
+                         x,
+                         incx,
+                         beta,
+                         y,
+                         incy,
+                         batchCount,
+                         hipblasZgeamBatched,
+                         hipblasZgemmBatched,
+                         hipblasZaxpyBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// axpbyStridedBatched
+hipblasStatus_t hipblasHaxpbyStridedBatched(hipblasHandle_t    handle,
+                                            int                n,
+                                            const hipblasHalf* alpha,
+                                            const hipblasHalf* x,
+                                            int                incx,
+                                            hipblasStride      stridex,
+                                            const hipblasHalf* beta,
+                                            hipblasHalf*       y,
+                                            int                incy,
+                                            hipblasStride      stridey,
+                                            int                batchCount)
+try
+{
+    return axpby_strided_batched(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 stridex,
+                                 beta,
+                                 y,
+                                 incy,
+                                 stridey,
+                                 batchCount,
+                                 no_geam{},
+                                 hipblasHgemmStridedBatched,
+                                 hipblasHaxpyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSaxpbyStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    alpha,
+                                            const float*    x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            const float*    beta,
+                                            float*          y,
+                                            int             incy,
+                                            hipblasStride   stridey,
+                                            int             batchCount)
+try
+{
+    return axpby_strided_batched(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 stridex,
+                                 beta,
+                                 y,
+                                 incy,
+                                 stridey,
+                                 batchCount,
+                                 hipblasSgeamStridedBatched,
+                                 hipblasSgemmStridedBatched,
+                                 hipblasSaxpyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpbyStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const double*   alpha,
+                                            const double*   x,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            const double*   beta,
+                                            double*         y,
+                                            int             incy,
+                                            hipblasStride   stridey,
+                                            int             batchCount)
+try
+{
+    return axpby_strided_batched(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 stridex,
+                                 beta,
+                                 y,
+                                 incy,
+                                 stridey,
+                                 batchCount,
+                                 hipblasDgeamStridedBatched,
+                                 hipblasDgemmStridedBatched,
+                                 hipblasDaxpyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpbyStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            hipblasStride         stridex,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy,
+                                            hipblasStride         stridey,
+                                            int                   batchCount)
+try
+{
+    return axpby_strided_batched(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 stridex,
+                                 beta,
+                                 y,
+                                 incy,
+                                 stridey,
+                                 batchCount,
+                                 hipblasCgeamStridedBatched,
+                                 hipblasCgemmStridedBatched,
+                                 hipblasCaxpyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpbyStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            hipblasStride               stridex,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       y,
+                                            int                         incy,
+                                            hipblasStride               stridey,
+                                            int                         batchCount)
+try
+{
+    return axpby_strided_batched(handle,
+                                 n,
+                                 alpha,
+                                 x,
+                                 incx,
+                                 stridex,
+                                 beta,
+                                 y,
+                                 incy,
+                                 stridey,
+                                 batchCount,
+                                 hipblasZgeamStridedBatched,
+                                 hipblasZgemmStridedBatched,
+                                 hipblasZaxpyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// axpyDot
+hipblasStatus_t hipblasSaxpyDot(hipblasHandle_t handle,
+                                int             n,
+                                const float*    alpha,
+                                const float*    x,
+                                int             incx,
+                                float*          y,
+                                int             incy,
+                                const float*    z,
+                                int             incz,
+                                float*          result)
+try
+{
+    hipblasStatus_t status = hipblasSaxpy(handle, n, alpha, x, incx, y, incy);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasSdot(handle, n, y, incy, z, incz, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpyDot(hipblasHandle_t handle,
+                                int             n,
+                                const double*   alpha,
+                                const double*   x,
+                                int             incx,
+                                double*         y,
+                                int             incy,
+                                const double*   z,
+                                int             incz,
+                                double*         result)
+try
+{
+    hipblasStatus_t status = hipblasDaxpy(handle, n, alpha, x, incx, y, incy);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDdot(handle, n, y, incy, z, incz, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpyDot(hipblasHandle_t       handle,
+                                int                   n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int                   incx,
+                                hipblasComplex*       y,
+                                int                   incy,
+                                const hipblasComplex* z,
+                                int                   incz,
+                                hipblasComplex*       result)
+try
+{
+    hipblasStatus_t status = hipblasCaxpy(handle, n, alpha, x, incx, y, incy);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasCdotc(handle, n, y, incy, z, incz, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpyDot(hipblasHandle_t             handle,
+                                int                         n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int                         incx,
+                                hipblasDoubleComplex*       y,
+                                int                         incy,
+                                const hipblasDoubleComplex* z,
+                                int                         incz,
+                                hipblasDoubleComplex*       result)
+try
+{
+    hipblasStatus_t status = hipblasZaxpy(handle, n, alpha, x, incx, y, incy);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasZdotc(handle, n, y, incy, z, incz, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// axpyDotBatched
+hipblasStatus_t hipblasSaxpyDotBatched(hipblasHandle_t    handle,
+                                       int                n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int                incx,
+                                       float* const       y[],
+                                       int                incy,
+                                       const float* const z[],
+                                       int                incz,
+                                       int                batchCount,
+                                       float*             result)
+try
+{
+    hipblasStatus_t status = hipblasSaxpyBatched(handle, n, alpha, x, incx, y, incy, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasSdotBatched(handle, n, y, incy, z, incz, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpyDotBatched(hipblasHandle_t     handle,
+                                       int                 n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int                 incx,
+                                       double* const       y[],
+                                       int                 incy,
+                                       const double* const z[],
+                                       int                 incz,
+                                       int                 batchCount,
+                                       double*             result)
+try
+{
+    hipblasStatus_t status = hipblasDaxpyBatched(handle, n, alpha, x, incx, y, incy, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDdotBatched(handle, n, y, incy, z, incz, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpyDotBatched(hipblasHandle_t             handle,
+                                       int                         n,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int                         incx,
+                                       hipblasComplex* const       y[],
+                                       int                         incy,
+                                       const hipblasComplex* const z[],
+                                       int                         incz,
+                                       int                         batchCount,
+                                       hipblasComplex*             result)
+try
+{
+    hipblasStatus_t status = hipblasCaxpyBatched(handle, n, alpha, x, incx, y, incy, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasCdotcBatched(handle, n, y, incy, z, incz, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpyDotBatched(hipblasHandle_t                   handle,
+                                       int                               n,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int                               incx,
+                                       hipblasDoubleComplex* const       y[],
+                                       int                               incy,
+                                       const hipblasDoubleComplex* const z[],
+                                       int                               incz,
+                                       int                               batchCount,
+                                       hipblasDoubleComplex*             result)
+try
+{
+    hipblasStatus_t status = hipblasZaxpyBatched(handle, n, alpha, x, incx, y, incy, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasZdotcBatched(handle, n, y, incy, z, incz, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// axpyDotStridedBatched
+hipblasStatus_t hipblasSaxpyDotStridedBatched(hipblasHandle_t handle,
+                                              int             n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              float*          y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              const float*    z,
+                                              int             incz,
+                                              hipblasStride   stridez,
+                                              int             batchCount,
+                                              float*          result)
+try
+{
+    hipblasStatus_t status = hipblasSaxpyStridedBatched(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasSdotStridedBatched(
+        handle, n, y, incy, stridey, z, incz, stridez, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDaxpyDotStridedBatched(hipblasHandle_t handle,
+                                              int             n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int             incx,
+                                              hipblasStride   stridex,
+                                              double*         y,
+                                              int             incy,
+                                              hipblasStride   stridey,
+                                              const double*   z,
+                                              int             incz,
+                                              hipblasStride   stridez,
+                                              int             batchCount,
+                                              double*         result)
+try
+{
+    hipblasStatus_t status = hipblasDaxpyStridedBatched(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasDdotStridedBatched(
+        handle, n, y, incy, stridey, z, incz, stridez, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCaxpyDotStridedBatched(hipblasHandle_t       handle,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int                   incx,
+                                              hipblasStride         stridex,
+                                              hipblasComplex*       y,
+                                              int                   incy,
+                                              hipblasStride         stridey,
+                                              const hipblasComplex* z,
+                                              int                   incz,
+                                              hipblasStride         stridez,
+                                              int                   batchCount,
+                                              hipblasComplex*       result)
+try
+{
+    hipblasStatus_t status = hipblasCaxpyStridedBatched(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasCdotcStridedBatched(
+        handle, n, y, incy, stridey, z, incz, stridez, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZaxpyDotStridedBatched(hipblasHandle_t             handle,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int                         incx,
+                                              hipblasStride               stridex,
+                                              hipblasDoubleComplex*       y,
+                                              int                         incy,
+                                              hipblasStride               stridey,
+                                              const hipblasDoubleComplex* z,
+                                              int                         incz,
+                                              hipblasStride               stridez,
+                                              int                         batchCount,
+                                              hipblasDoubleComplex*       result)
+try
+{
+    hipblasStatus_t status = hipblasZaxpyStridedBatched(
+        handle, n, alpha, x, incx, stridex, y, incy, stridey, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipblasZdotcStridedBatched(
+        handle, n, y, incy, stridey, z, incz, stridez, batchCount, result);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// dotMulti
+hipblasStatus_t hipblasHdotMulti(hipblasHandle_t    handle,
+                                 int                n,
+                                 int                k,
+                                 const hipblasHalf* x,
+                                 int                incx,
+                                 const hipblasHalf* Y,
+                                 int                ldy,
+                                 hipblasHalf*       result)
+try
+{
+    return dot_multi<hipblasHalf, float>(
+        handle, n, k, x, incx, Y, ldy, result, HIPBLAS_OP_T, hgemv_by_gemm{}, hipblasHdot);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdotMulti(hipblasHandle_t handle,
+                                 int             n,
+                                 int             k,
+                                 const float*    x,
+                                 int             incx,
+                                 const float*    Y,
+                                 int             ldy,
+                                 float*          result)
+try
+{
+    return dot_multi<float, float>(
+        handle, n, k, x, incx, Y, ldy, result, HIPBLAS_OP_T, hipblasSgemv, hipblasSdot);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotMulti(hipblasHandle_t handle,
+                                 int             n,
+                                 int             k,
+                                 const double*   x,
+                                 int             incx,
+                                 const double*   Y,
+                                 int             ldy,
+                                 double*         result)
+try
+{
+    return dot_multi<double, double>(
+        handle, n, k, x, incx, Y, ldy, result, HIPBLAS_OP_T, hipblasDgemv, hipblasDdot);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotMulti(hipblasHandle_t       handle,
+                                 int                   n,
+                                 int                   k,
+                                 const hipblasComplex* x,
+                                 int                   incx,
+                                 const hipblasComplex* Y,
+                                 int                   ldy,
+                                 hipblasComplex*       result)
+try
+{
+    return dot_multi<hipblasComplex, float>(
+        handle, n, k, x, incx, Y, ldy, result, HIPBLAS_OP_C, hipblasCgemv, hipblasCdotc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotMulti(hipblasHandle_t             handle,
+                                 int                         n,
+                                 int                         k,
+                                 const hipblasDoubleComplex* x,
+                                 int                         incx,
+                                 const hipblasDoubleComplex* Y,
+                                 int                         ldy,
+                                 hipblasDoubleComplex*       result)
+try
+{
+    return dot_multi<hipblasDoubleComplex, double>(
+        handle, n, k, x, incx, Y, ldy, result, HIPBLAS_OP_C, hipblasZgemv, hipblasZdotc);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// dotMultiBatched
+hipblasStatus_t hipblasHdotMultiBatched(hipblasHandle_t          handle,
+                                        int                      n,
+                                        int                      k,
+                                        const hipblasHalf* const x[],
+                                        int                      incx,
+                                        const hipblasHalf* const Y[],
+                                        int                      ldy,
+                                        int                      batchCount,
+                                        hipblasHalf*             result)
+try
+{
+    return dot_multi_batched<hipblasHalf, float>(handle,
+                                                 n,
+                                                 k,
+                                                 x,
+                                                 incx,
+                                                 Y,
+                                                 ldy,
+                                                 batchCount,
+                                                 result,
+                                                 HIPBLAS_OP_T,
+                                                 hgemv_by_gemm{},
+                                                 hipblasHdotStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdotMultiBatched(hipblasHandle_t    handle,
+                                        int                n,
+                                        int                k,
+                                        const float* const x[],
+                                        int                incx,
+                                        const float* const Y[],
+                                        int                ldy,
+                                        int                batchCount,
+                                        float*             result)
+try
+{
+    return dot_multi_batched<float, float>(handle,
+                                           n,
+                                           k,
+                                           x,
+                                           incx,
+                                           Y,
+                                           ldy,
+                                           batchCount,
+                                           result,
+                                           HIPBLAS_OP_T,
+                                           hipblasSgemvStridedBatched,
+                                           hipblasSdotStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotMultiBatched(hipblasHandle_t     handle,
+                                        int                 n,
+                                        int                 k,
+                                        const double* const x[],
+                                        int                 incx,
+                                        const double* const Y[],
+                                        int                 ldy,
+                                        int                 batchCount,
+                                        double*             result)
+try
+{
+    return dot_multi_batched<double, double>(handle,
+                                             n,
+                                             k,
+                                             x,
+                                             incx,
+                                             Y,
+                                             ldy,
+                                             batchCount,
+                                             result,
+                                             HIPBLAS_OP_T,
+                                             hipblasDgemvStridedBatched,
+                                             hipblasDdotStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotMultiBatched(hipblasHandle_t             handle,
+                                        int                         n,
+                                        int                         k,
+                                        const hipblasComplex* const x[],
+                                        int                         incx,
+                                        const hipblasComplex* const Y[],
+                                        int                         ldy,
+                                        int                         batchCount,
+                                        hipblasComplex*             result)
+try
+{
+    return dot_multi_batched<hipblasComplex, float>(handle,
+                                                    n,
+                                                    k,
+                                                    x,
+                                                    incx,
+                                                    Y,
+                                                    ldy,
+                                                    batchCount,
+                                                    result,
+                                                    HIPBLAS_OP_C,
+                                                    hipblasCgemvStridedBatched,
+                                                    hipblasCdotcStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotMultiBatched(hipblasHandle_t                   handle,
+                                        int                               n,
+                                        int                               k,
+                                        const hipblasDoubleComplex* const x[],
+                                        int                               incx,
+                                        const hipblasDoubleComplex* const Y[],
+                                        int                               ldy,
+                                        int                               batchCount,
+                                        hipblasDoubleComplex*             result)
+try
+{
+    return dot_multi_batched<hipblasDoubleComplex, double>(handle,
+                                                           n,
+                                                           k,
+                                                           x,
+                                                           incx,
+                                                           Y,
+                                                           ldy,
+                                                           batchCount,
+                                                           result,
+                                                           HIPBLAS_OP_C,
+                                                           hipblasZgemvStridedBatched,
+                                                           hipblasZdotcStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// dotMultiStridedBatched
+hipblasStatus_t hipblasHdotMultiStridedBatched(hipblasHandle_t    handle,
+                                               int                n,
+                                               int                k,
+                                               const hipblasHalf* x,
+                                               int                incx,
+                                               hipblasStride      stridex,
+                                               const hipblasHalf* Y,
+                                               int                ldy,
+                                               hipblasStride      strideY,
+                                               int                batchCount,
+                                               hipblasHalf*       result)
+try
+{
+    return dot_multi_strided_batched<hipblasHalf, float>(handle,
+                                                         n,
+                                                         k,
+                                                         x,
+                                                         incx,
+                                                         stridex,
+                                                         Y,
+                                                         ldy,
+                                                         strideY,
+                                                         batchCount,
+                                                         result,
+                                                         HIPBLAS_OP_T,
+                                                         hgemv_by_gemm{},
+                                                         hipblasHdotStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSdotMultiStridedBatched(hipblasHandle_t handle,
+                                               int             n,
+                                               int             k,
+                                               const float*    x,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               const float*    Y,
+                                               int             ldy,
+                                               hipblasStride   strideY,
+                                               int             batchCount,
+                                               float*          result)
+try
+{
+    return dot_multi_strided_batched<float, float>(handle,
+                                                   n,
+                                                   k,
+                                                   x,
+                                                   incx,
+                                                   stridex,
+                                                   Y,
+                                                   ldy,
+                                                   strideY,
+                                                   batchCount,
+                                                   result,
+                                                   HIPBLAS_OP_T,
+                                                   hipblasSgemvStridedBatched,
+                                                   hipblasSdotStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDdotMultiStridedBatched(hipblasHandle_t handle,
+                                               int             n,
+                                               int             k,
+                                               const double*   x,
+                                               int             incx,
+                                               hipblasStride   stridex,
+                                               const double*   Y,
+                                               int             ldy,
+                                               hipblasStride   strideY,
+                                               int             batchCount,
+                                               double*         result)
+try
+{
+    return dot_multi_strided_batched<double, double>(handle,
+                                                     n,
+                                                     k,
+                                                     x,
+                                                     incx,
+                                                     stridex,
+                                                     Y,
+                                                     ldy,
+                                                     strideY,
+                                                     batchCount,
+                                                     result,
+                                                     HIPBLAS_OP_T,
+                                                     hipblasDgemvStridedBatched,
+                                                     hipblasDdotStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCdotMultiStridedBatched(hipblasHandle_t       handle,
+                                               int                   n,
+                                               int                   k,
+                                               const hipblasComplex* x,
+                                               int                   incx,
+                                               hipblasStride         stridex,
+                                               const hipblasComplex* Y,
+                                               int                   ldy,
+                                               hipblasStride         strideY,
+                                               int                   batchCount,
+                                               hipblasComplex*       result)
+try
+{
+    return dot_multi_strided_batched<hipblasComplex, float>(handle,
+                                                            n,
+                                                            k,
+                                                            x,
+                                                            incx,
+                                                            stridex,
+                                                            Y,
+                                                            ldy,
+                                                            strideY,
+                                                            batchCount,
+                                                            result,
+                                                            HIPBLAS_OP_C,
+                                                            hipblasCgemvStridedBatched,
+                                                            hipblasCdotcStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZdotMultiStridedBatched(hipblasHandle_t             handle,
+                                               int                         n,
+                                               int                         k,
+                                               const hipblasDoubleComplex* x,
+                                               int                         incx,
+                                               hipblasStride               stridex,
+                                               const hipblasDoubleComplex* Y,
+                                               int                         ldy,
+                                               hipblasStride               strideY,
+                                               int                         batchCount,
+                                               hipblasDoubleComplex*       result)
+try
+{
+    return dot_multi_strided_batched<hipblasDoubleComplex, double>(handle,
+                                                                   n,
+                                                                   k,
+                                                                   x,
+                                                                   incx,
+                                                                   stridex,
+                                                                   Y,
+                                                                   ldy,
+                                                                   strideY,
+                                                                   batchCount,
+                                                                   result,
+                                                                   HIPBLAS_OP_C,
+                                                                   hipblasZgemvStridedBatched,
+                                                                   hipblasZdotcStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// normalize
+hipblasStatus_t hipblasSnormalize(hipblasHandle_t handle, int n, float* x, int incx, float* result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     0,
+                                     1,
+                                     result,
+                                     hipblasSnrm2StridedBatched,
+                                     hipblasSscal,
+                                     hipblasScopy,
+                                     hipblasSrotgStridedBatched,
+                                     hipblasSaxpy,
+                                     hipblasStrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnormalize(hipblasHandle_t handle,
+                                  int             n,
+                                  double*         x,
+                                  int             incx,
+                                  double*         result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     0,
+                                     1,
+                                     result,
+                                     hipblasDnrm2StridedBatched,
+                                     hipblasDscal,
+                                     hipblasDcopy,
+                                     hipblasDrotgStridedBatched,
+                                     hipblasDaxpy,
+                                     hipblasDtrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCnormalize(hipblasHandle_t handle,
+                                  int             n,
+                                  hipblasComplex* x,
+                                  int             incx,
+                                  float*          result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     0,
+                                     1,
+                                     result,
+                                     hipblasScnrm2StridedBatched,
+                                     hipblasCsscal,
+                                     hipblasScopy,
+                                     hipblasSrotgStridedBatched,
+                                     hipblasSaxpy,
+                                     hipblasStrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZnormalize(hipblasHandle_t       handle,
+                                  int                   n,
+                                  hipblasDoubleComplex* x,
+                                  int                   incx,
+                                  double*               result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     0,
+                                     1,
+                                     result,
+                                     hipblasDznrm2StridedBatched,
+                                     hipblasZdscal,
+                                     hipblasDcopy,
+                                     hipblasDrotgStridedBatched,
+                                     hipblasDaxpy,
+                                     hipblasDtrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// normalizeBatched
+hipblasStatus_t hipblasSnormalizeBatched(hipblasHandle_t handle,
+                                         int             n,
+                                         float* const    x[],
+                                         int             incx,
+                                         int             batchCount,
+                                         float*          result)
+try
+{
+    return normalize_batched(handle,
+                             n,
+                             x,
+                             incx,
+                             batchCount,
+                             result,
+                             hipblasSnrm2StridedBatched,
+                             hipblasSscal,
+                             hipblasScopy,
+                             hipblasSrotgStridedBatched,
+                             hipblasSaxpy,
+                             hipblasStrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnormalizeBatched(hipblasHandle_t handle,
+                                         int             n,
+                                         double* const   x[],
+                                         int             incx,
+                                         int             batchCount,
+                                         double*         result)
+try
+{
+    return normalize_batched(handle,
+                             n,
+                             x,
+                             incx,
+                             batchCount,
+                             result,
+                             hipblasDnrm2StridedBatched,
+                             hipblasDscal,
+                             hipblasDcopy,
+                             hipblasDrotgStridedBatched,
+                             hipblasDaxpy,
+                             hipblasDtrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCnormalizeBatched(hipblasHandle_t       handle,
+                                         int                   n,
+                                         hipblasComplex* const x[],
+                                         int                   incx,
+                                         int                   batchCount,
+                                         float*                result)
+try
+{
+    return normalize_batched(handle,
+                             n,
+                             x,
+                             incx,
+                             batchCount,
+                             result,
+                             hipblasScnrm2StridedBatched,
+                             hipblasCsscal,
+                             hipblasScopy,
+                             hipblasSrotgStridedBatched,
+                             hipblasSaxpy,
+                             hipblasStrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZnormalizeBatched(hipblasHandle_t             handle,
+                                         int                         n,
+                                         hipblasDoubleComplex* const x[],
+                                         int                         incx,
+                                         int                         batchCount,
+                                         double*                     result)
+try
+{
+    return normalize_batched(handle,
+                             n,
+                             x,
+                             incx,
+                             batchCount,
+                             result,
+                             hipblasDznrm2StridedBatched,
+                             hipblasZdscal,
+                             hipblasDcopy,
+                             hipblasDrotgStridedBatched,
+                             hipblasDaxpy,
+                             hipblasDtrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// normalizeStridedBatched
+hipblasStatus_t hipblasSnormalizeStridedBatched(hipblasHandle_t handle,
+                                                int             n,
+                                                float*          x,
+                                                int             incx,
+                                                hipblasStride   stridex,
+                                                int             batchCount,
+                                                float*          result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     stridex,
+                                     batchCount,
+                                     result,
+                                     hipblasSnrm2StridedBatched,
+                                     hipblasSscal,
+                                     hipblasScopy,
+                                     hipblasSrotgStridedBatched,
+                                     hipblasSaxpy,
+                                     hipblasStrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDnormalizeStridedBatched(hipblasHandle_t handle,
+                                                int             n,
+                                                double*         x,
+                                                int             incx,
+                                                hipblasStride   stridex,
+                                                int             batchCount,
+                                                double*         result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     stridex,
+                                     batchCount,
+                                     result,
+                                     hipblasDnrm2StridedBatched,
+                                     hipblasDscal,
+                                     hipblasDcopy,
+                                     hipblasDrotgStridedBatched,
+                                     hipblasDaxpy,
+                                     hipblasDtrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCnormalizeStridedBatched(hipblasHandle_t handle,
+                                                int             n,
+                                                hipblasComplex* x,
+                                                int             incx,
+                                                hipblasStride   stridex,
+                                                int             batchCount,
+                                                float*          result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     stridex,
+                                     batchCount,
+                                     result,
+                                     hipblasScnrm2StridedBatched,
+                                     hipblasCsscal,
+                                     hipblasScopy,
+                                     hipblasSrotgStridedBatched,
+                                     hipblasSaxpy,
+                                     hipblasStrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZnormalizeStridedBatched(hipblasHandle_t       handle,
+                                                int                   n,
+                                                hipblasDoubleComplex* x,
+                                                int                   incx,
+                                                hipblasStride         stridex,
+                                                int                   batchCount,
+                                                double*               result)
+try
+{
+    return normalize_strided_batched(handle,
+                                     n,
+                                     x,
+                                     incx,
+                                     stridex,
+                                     batchCount,
+                                     result,
+                                     hipblasDznrm2StridedBatched,
+                                     hipblasZdscal,
+                                     hipblasDcopy,
+                                     hipblasDrotgStridedBatched,
+                                     hipblasDaxpy,
+                                     hipblasDtrsmStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
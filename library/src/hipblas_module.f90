@@ -79,6 +79,20 @@ module hipblas_enums
         enumerator :: HIPBLAS_ATOMICS_ALLOWED = 1
     end enum
 
+    enum, bind(c)
+        enumerator :: HIPBLAS_CAPTURE_MODE_DEFAULT = 0
+        enumerator :: HIPBLAS_CAPTURE_MODE_SAFE = 1
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_BATCHED_INFO_NONE = 0
+        enumerator :: HIPBLAS_BATCHED_INFO_SUMMARY = 1
+    end enum
+
+    enum, bind(c)
+        enumerator :: HIPBLAS_STREAM_LANE_NEXT = -1
+    end enum
+
 end module hipblas_enums
 
 module hipblas
@@ -304,6 +318,113 @@ module hipblas
         end function hipblasGetAtomicsMode
     end interface
 
+    ! capture mode
+    interface
+        function hipblasSetCaptureMode(handle, mode) &
+                result(c_int) &
+                bind(c, name = 'hipblasSetCaptureMode')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_CAPTURE_MODE_SAFE)), value :: mode
+        end function hipblasSetCaptureMode
+    end interface
+
+    interface
+        function hipblasGetCaptureMode(handle, mode) &
+                result(c_int) &
+                bind(c, name = 'hipblasGetCaptureMode')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: mode
+        end function hipblasGetCaptureMode
+    end interface
+
+    ! batched info mode
+    interface
+        function hipblasSetBatchedInfoMode(handle, mode) &
+                result(c_int) &
+                bind(c, name = 'hipblasSetBatchedInfoMode')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_BATCHED_INFO_SUMMARY)), value :: mode
+        end function hipblasSetBatchedInfoMode
+    end interface
+
+    interface
+        function hipblasGetBatchedInfoMode(handle, mode) &
+                result(c_int) &
+                bind(c, name = 'hipblasGetBatchedInfoMode')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: mode
+        end function hipblasGetBatchedInfoMode
+    end interface
+
+    interface
+        function hipblasGetBatchedInfoSummaryAsync(handle, summary, reset) &
+                result(c_int) &
+                bind(c, name = 'hipblasGetBatchedInfoSummaryAsync')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: summary
+            integer(c_int), value :: reset
+        end function hipblasGetBatchedInfoSummaryAsync
+    end interface
+
+    ! stream pool
+    interface
+        function hipblasSetStreamPool(handle, n) &
+                result(c_int) &
+                bind(c, name = 'hipblasSetStreamPool')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+        end function hipblasSetStreamPool
+    end interface
+
+    interface
+        function hipblasGetStreamPool(handle, n) &
+                result(c_int) &
+                bind(c, name = 'hipblasGetStreamPool')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: n
+        end function hipblasGetStreamPool
+    end interface
+
+    interface
+        function hipblasSetStreamLane(handle, lane) &
+                result(c_int) &
+                bind(c, name = 'hipblasSetStreamLane')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+            integer(c_int), value :: lane
+        end function hipblasSetStreamLane
+    end interface
+
+    interface
+        function hipblasJoinStreams(handle) &
+                result(c_int) &
+                bind(c, name = 'hipblasJoinStreams')
+            use iso_c_binding
+            implicit none
+            type(c_ptr), value :: handle
+        end function hipblasJoinStreams
+    end interface
+
     !--------!
     ! blas 1 !
     !--------!
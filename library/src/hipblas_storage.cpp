@@ -0,0 +1,975 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+#include "hipblas.h"
+#include "exceptions.hpp"
+#include "host_pointer_arrays.hpp"
+#include "host_pointer_mode.hpp"
+#include "storage_conversion.hpp"
+#include <algorithm>
+#include <vector>
+
+/*!\file
+ * \brief Storage conversions gbtge and getgb between the band and the full storage of a general
+ * band matrix, so that the matrices of gbmv or tbmv can be handed to the level 3 routines and back
+ * without leaving the device. The conversions between packed and full storage, tpttr and trttp,
+ * are native on the CUDA backend and live with each backend (see storage_conversion.hpp).
+ *
+ * One implementation serves both backends, and only the elements of the band are read and written.
+ * The diagonals of a band matrix are evenly spaced in full storage: seen from A + ku * lda with
+ * leading dimension lda + 1, the columns ku <= j < m - kl, in which the whole band lies, are a
+ * kl + ku + 1 row matrix laid out like their band storage, converted by one geam. The columns in
+ * which the top or bottom of A cuts the band, at most kl + 2 * ku, are copied one at a time.
+ *
+ * The batched forms read the arrays of pointers back to the host. Instances evenly spaced in
+ * memory run as the strided batched form, others one at a time.
+ */
+
+namespace
+{
+    hipblasStatus_t band_arguments(
+        hipblasHandle_t handle, int m, int n, int kl, int ku, int ldab, int lda, int batchCount)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(m < 0 || n < 0 || kl < 0 || ku < 0 || ldab < kl + ku + 1 || lda < std::max(m, 1)
+           || batchCount < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // from is converted to to: AB to A when to_full (gbtge), A to AB otherwise (getgb). Instance
+    // b is from + b * stride_from and to + b * stride_to. Element (i, j) of the band is
+    // AB[ku + i - j + j * ldab] and A[i + j * lda]
+    template <typename T, typename Geam, typename Copy>
+    hipblasStatus_t band_strided_batched(hipblasHandle_t handle,
+                                         int             m,
+                                         int             n,
+                                         int             kl,
+                                         int             ku,
+                                         const T*        from,
+                                         hipblasStride   stride_from,
+                                         T*              to,
+                                         hipblasStride   stride_to,
+                                         int             ldab,
+                                         int             lda,
+                                         int             batchCount,
+                                         bool            to_full,
+                                         Geam            geam,
+                                         Copy            copy)
+    {
+        hipblasStatus_t status = band_arguments(handle, m, n, kl, ku, ldab, lda, batchCount);
+        if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batchCount)
+            return status;
+        if(!from || !to)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // the columns ku <= j < m - kl hold the whole band: element (r + c, ku + c) of A is
+        // r + c * (lda + 1) from A + ku * lda, element (r, c) of a kl + ku + 1 by whole view whose
+        // columns do not overlap, as lda >= m > kl + ku
+        int whole = std::min(n, m - kl) - ku;
+        if(whole > 0)
+        {
+            hipblas_host_pointer_mode constants(handle);
+            T                         one(1), zero(0);
+            size_t                    band = size_t(ku) * ldab, full = size_t(ku) * lda;
+            const T*                  source    = from + (to_full ? band : full);
+            int                       ld_source = to_full ? ldab : lda + 1;
+
+            status = geam(handle,
+                          HIPBLAS_OP_N,
+                          HIPBLAS_OP_N,
+                          kl + ku + 1,
+                          whole,
+                          &one,
+                          source,
+                          ld_source,
+                          stride_from,
+                          &zero,
+                          source,
+                          ld_source,
+                          stride_from,
+                          to + (to_full ? full : band),
+                          to_full ? lda + 1 : ldab,
+                          stride_to,
+                          batchCount);
+        }
+
+        // the rows top <= r <= bottom of column j of the band storage lie in A
+        int columns = std::min(n, m + ku);
+        for(int j = 0; j < columns && status == HIPBLAS_STATUS_SUCCESS; j++)
+        {
+            if(j >= ku && j < ku + whole)
+                continue;
+
+            int    top    = std::max(ku - j, 0);
+            int    bottom = std::min(kl + ku, m - 1 + ku - j);
+            size_t band   = top + size_t(j) * ldab;
+            size_t full   = top + j - ku + size_t(j) * lda;
+            status        = copy(handle,
+                          bottom - top + 1,
+                          from + (to_full ? band : full),
+                          1,
+                          stride_from,
+                          to + (to_full ? full : band),
+                          1,
+                          stride_to,
+                          batchCount);
+        }
+        return status;
+    }
+
+    template <typename T, typename Geam, typename Copy>
+    hipblasStatus_t band_batched(hipblasHandle_t handle,
+                                 int             m,
+                                 int             n,
+                                 int             kl,
+                                 int             ku,
+                                 const T* const  from[],
+                                 T* const        to[],
+                                 int             ldab,
+                                 int             lda,
+                                 int             batchCount,
+                                 bool            to_full,
+                                 Geam            geam,
+                                 Copy            copy)
+    {
+        hipblasStatus_t status = band_arguments(handle, m, n, kl, ku, ldab, lda, batchCount);
+        if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batchCount)
+            return status;
+        if(!from || !to)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::vector<const T*> host_from = hipblas_host_pointers(handle, from, batchCount);
+        std::vector<T*>       host_to   = hipblas_host_pointers(handle, to, batchCount);
+        hipblasStride         stride_from, stride_to;
+        if(hipblas_uniform_stride(host_from.data(), batchCount, &stride_from)
+           && hipblas_uniform_stride(host_to.data(), batchCount, &stride_to))
+            return band_strided_batched(handle,
+                                        m,
+                                        n,
+                                        kl,
+                                        ku,
+                                        host_from[0],
+                                        stride_from,
+                                        host_to[0],
+                                        stride_to,
+                                        ldab,
+                                        lda,
+                                        batchCount,
+                                        to_full,
+                                        geam,
+                                        copy);
+
+        for(int b = 0; b < batchCount && status == HIPBLAS_STATUS_SUCCESS; b++)
+            status = band_strided_batched(handle,
+                                          m,
+                                          n,
+                                          kl,
+                                          ku,
+                                          host_from[b],
+                                          0,
+                                          host_to[b],
+                                          0,
+                                          ldab,
+                                          lda,
+                                          1,
+                                          to_full,
+                                          geam,
+                                          copy);
+        return status;
+    }
+}
+
+extern "C" {
+// gbtge
+hipblasStatus_t hipblasSgbtge(hipblasHandle_t handle,
+                              int             m,
+                              int             n,
+                              int             kl,
+                              int             ku,
+                              const float*    AB,
+                              int             ldab,
+                              float*          A,
+                              int             lda)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                0,
+                                A,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                true,
+                                hipblasSgeamStridedBatched,
+                                hipblasScopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgbtge(hipblasHandle_t handle,
+                              int             m,
+                              int             n,
+                              int             kl,
+                              int             ku,
+                              const double*   AB,
+                              int             ldab,
+                              double*         A,
+                              int             lda)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                0,
+                                A,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                true,
+                                hipblasDgeamStridedBatched,
+                                hipblasDcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbtge(hipblasHandle_t       handle,
+                              int                   m,
+                              int                   n,
+                              int                   kl,
+                              int                   ku,
+                              const hipblasComplex* AB,
+                              int                   ldab,
+                              hipblasComplex*       A,
+                              int                   lda)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                0,
+                                A,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                true,
+                                hipblasCgeamStridedBatched,
+                                hipblasCcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgbtge(hipblasHandle_t             handle,
+                              int                         m,
+                              int                         n,
+                              int                         kl,
+                              int                         ku,
+                              const hipblasDoubleComplex* AB,
+                              int                         ldab,
+                              hipblasDoubleComplex*       A,
+                              int                         lda)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                0,
+                                A,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                true,
+                                hipblasZgeamStridedBatched,
+                                hipblasZcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gbtgeBatched
+hipblasStatus_t hipblasSgbtgeBatched(hipblasHandle_t    handle,
+                                     int                m,
+                                     int                n,
+                                     int                kl,
+                                     int                ku,
+                                     const float* const AB[],
+                                     int                ldab,
+                                     float* const       A[],
+                                     int                lda,
+                                     int                batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        AB,
+                        A,
+                        ldab,
+                        lda,
+                        batchCount,
+                        true,
+                        hipblasSgeamStridedBatched,
+                        hipblasScopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgbtgeBatched(hipblasHandle_t     handle,
+                                     int                 m,
+                                     int                 n,
+                                     int                 kl,
+                                     int                 ku,
+                                     const double* const AB[],
+                                     int                 ldab,
+                                     double* const       A[],
+                                     int                 lda,
+                                     int                 batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        AB,
+                        A,
+                        ldab,
+                        lda,
+                        batchCount,
+                        true,
+                        hipblasDgeamStridedBatched,
+                        hipblasDcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbtgeBatched(hipblasHandle_t             handle,
+                                     int                         m,
+                                     int                         n,
+                                     int                         kl,
+                                     int                         ku,
+                                     const hipblasComplex* const AB[],
+                                     int                         ldab,
+                                     hipblasComplex* const       A[],
+                                     int                         lda,
+                                     int                         batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        AB,
+                        A,
+                        ldab,
+                        lda,
+                        batchCount,
+                        true,
+                        hipblasCgeamStridedBatched,
+                        hipblasCcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgbtgeBatched(hipblasHandle_t                   handle,
+                                     int                               m,
+                                     int                               n,
+                                     int                               kl,
+                                     int                               ku,
+                                     const hipblasDoubleComplex* const AB[],
+                                     int                               ldab,
+                                     hipblasDoubleComplex* const       A[],
+                                     int                               lda,
+                                     int                               batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        AB,
+                        A,
+                        ldab,
+                        lda,
+                        batchCount,
+                        true,
+                        hipblasZgeamStridedBatched,
+                        hipblasZcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gbtgeStridedBatched
+hipblasStatus_t hipblasSgbtgeStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const float*    AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            float*          A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            int             batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                strideAB,
+                                A,
+                                strideA,
+                                ldab,
+                                lda,
+                                batchCount,
+                                true,
+                                hipblasSgeamStridedBatched,
+                                hipblasScopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgbtgeStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const double*   AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            double*         A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            int             batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                strideAB,
+                                A,
+                                strideA,
+                                ldab,
+                                lda,
+                                batchCount,
+                                true,
+                                hipblasDgeamStridedBatched,
+                                hipblasDcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbtgeStridedBatched(hipblasHandle_t       handle,
+                                            int                   m,
+                                            int                   n,
+                                            int                   kl,
+                                            int                   ku,
+                                            const hipblasComplex* AB,
+                                            int                   ldab,
+                                            hipblasStride         strideAB,
+                                            hipblasComplex*       A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            int                   batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                strideAB,
+                                A,
+                                strideA,
+                                ldab,
+                                lda,
+                                batchCount,
+                                true,
+                                hipblasCgeamStridedBatched,
+                                hipblasCcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgbtgeStridedBatched(hipblasHandle_t             handle,
+                                            int                         m,
+                                            int                         n,
+                                            int                         kl,
+                                            int                         ku,
+                                            const hipblasDoubleComplex* AB,
+                                            int                         ldab,
+                                            hipblasStride               strideAB,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            int                         batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                AB,
+                                strideAB,
+                                A,
+                                strideA,
+                                ldab,
+                                lda,
+                                batchCount,
+                                true,
+                                hipblasZgeamStridedBatched,
+                                hipblasZcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// getgb
+hipblasStatus_t hipblasSgetgb(hipblasHandle_t handle,
+                              int             m,
+                              int             n,
+                              int             kl,
+                              int             ku,
+                              const float*    A,
+                              int             lda,
+                              float*          AB,
+                              int             ldab)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                0,
+                                AB,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                false,
+                                hipblasSgeamStridedBatched,
+                                hipblasScopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetgb(hipblasHandle_t handle,
+                              int             m,
+                              int             n,
+                              int             kl,
+                              int             ku,
+                              const double*   A,
+                              int             lda,
+                              double*         AB,
+                              int             ldab)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                0,
+                                AB,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                false,
+                                hipblasDgeamStridedBatched,
+                                hipblasDcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetgb(hipblasHandle_t       handle,
+                              int                   m,
+                              int                   n,
+                              int                   kl,
+                              int                   ku,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              hipblasComplex*       AB,
+                              int                   ldab)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                0,
+                                AB,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                false,
+                                hipblasCgeamStridedBatched,
+                                hipblasCcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetgb(hipblasHandle_t             handle,
+                              int                         m,
+                              int                         n,
+                              int                         kl,
+                              int                         ku,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              hipblasDoubleComplex*       AB,
+                              int                         ldab)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                0,
+                                AB,
+                                0,
+                                ldab,
+                                lda,
+                                1,
+                                false,
+                                hipblasZgeamStridedBatched,
+                                hipblasZcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// getgbBatched
+hipblasStatus_t hipblasSgetgbBatched(hipblasHandle_t    handle,
+                                     int                m,
+                                     int                n,
+                                     int                kl,
+                                     int                ku,
+                                     const float* const A[],
+                                     int                lda,
+                                     float* const       AB[],
+                                     int                ldab,
+                                     int                batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        A,
+                        AB,
+                        ldab,
+                        lda,
+                        batchCount,
+                        false,
+                        hipblasSgeamStridedBatched,
+                        hipblasScopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetgbBatched(hipblasHandle_t     handle,
+                                     int                 m,
+                                     int                 n,
+                                     int                 kl,
+                                     int                 ku,
+                                     const double* const A[],
+                                     int                 lda,
+                                     double* const       AB[],
+                                     int                 ldab,
+                                     int                 batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        A,
+                        AB,
+                        ldab,
+                        lda,
+                        batchCount,
+                        false,
+                        hipblasDgeamStridedBatched,
+                        hipblasDcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetgbBatched(hipblasHandle_t             handle,
+                                     int                         m,
+                                     int                         n,
+                                     int                         kl,
+                                     int                         ku,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     hipblasComplex* const       AB[],
+                                     int                         ldab,
+                                     int                         batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        A,
+                        AB,
+                        ldab,
+                        lda,
+                        batchCount,
+                        false,
+                        hipblasCgeamStridedBatched,
+                        hipblasCcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetgbBatched(hipblasHandle_t                   handle,
+                                     int                               m,
+                                     int                               n,
+                                     int                               kl,
+                                     int                               ku,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     hipblasDoubleComplex* const       AB[],
+                                     int                               ldab,
+                                     int                               batchCount)
+try
+{
+    return band_batched(handle,
+                        m,
+                        n,
+                        kl,
+                        ku,
+                        A,
+                        AB,
+                        ldab,
+                        lda,
+                        batchCount,
+                        false,
+                        hipblasZgeamStridedBatched,
+                        hipblasZcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// getgbStridedBatched
+hipblasStatus_t hipblasSgetgbStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const float*    A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            float*          AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            int             batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                strideA,
+                                AB,
+                                strideAB,
+                                ldab,
+                                lda,
+                                batchCount,
+                                false,
+                                hipblasSgeamStridedBatched,
+                                hipblasScopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgetgbStridedBatched(hipblasHandle_t handle,
+                                            int             m,
+                                            int             n,
+                                            int             kl,
+                                            int             ku,
+                                            const double*   A,
+                                            int             lda,
+                                            hipblasStride   strideA,
+                                            double*         AB,
+                                            int             ldab,
+                                            hipblasStride   strideAB,
+                                            int             batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                strideA,
+                                AB,
+                                strideAB,
+                                ldab,
+                                lda,
+                                batchCount,
+                                false,
+                                hipblasDgeamStridedBatched,
+                                hipblasDcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgetgbStridedBatched(hipblasHandle_t       handle,
+                                            int                   m,
+                                            int                   n,
+                                            int                   kl,
+                                            int                   ku,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            hipblasComplex*       AB,
+                                            int                   ldab,
+                                            hipblasStride         strideAB,
+                                            int                   batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                strideA,
+                                AB,
+                                strideAB,
+                                ldab,
+                                lda,
+                                batchCount,
+                                false,
+                                hipblasCgeamStridedBatched,
+                                hipblasCcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgetgbStridedBatched(hipblasHandle_t             handle,
+                                            int                         m,
+                                            int                         n,
+                                            int                         kl,
+                                            int                         ku,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            hipblasDoubleComplex*       AB,
+                                            int                         ldab,
+                                            hipblasStride               strideAB,
+                                            int                         batchCount)
+try
+{
+    return band_strided_batched(handle,
+                                m,
+                                n,
+                                kl,
+                                ku,
+                                A,
+                                strideA,
+                                AB,
+                                strideAB,
+                                ldab,
+                                lda,
+                                batchCount,
+                                false,
+                                hipblasZgeamStridedBatched,
+                                hipblasZcopyStridedBatched);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+} // extern "C"
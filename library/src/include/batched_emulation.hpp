@@ -0,0 +1,761 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <cstdlib>
+#include <initializer_list>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*!\file
+ * \brief Emulation of batched and strided batched routines which a backend does not provide.
+ *
+ * A batch is decomposed into one call of the backend's non-batched routine (or of a native
+ * batched sibling) per instance. The calls are spread round-robin over a small pool of streams
+ * owned by the handle: the pool streams wait for an event recorded on the stream of the handle,
+ * and the stream of the handle waits for an event recorded on every pool stream used, so the
+ * batch is ordered like a single call on the stream of the handle. Scalars are passed through
+ * unchanged and reductions write result + b, so both pointer modes keep their meaning.
+ *
+ * The size of the pool is HIPBLAS_BATCHED_STREAMS (default 4); 1 issues all the calls on the
+ * stream of the handle. The pool is created on the current device at the first emulated call of
+ * a handle and released by release(), from hipblasDestroy.
+ *
+ * The registry also keeps the capture mode of the handle (hipblasSetCaptureMode). In
+ * HIPBLAS_CAPTURE_MODE_SAFE the host copies of pointer arrays, which read back or upload through
+ * memory that does not outlive the call, fail with HIPBLAS_STATUS_NOT_SUPPORTED; the fork and
+ * join of run() only records and waits for events, which stream capture turns into graph edges.
+ *
+ * Backend supplies the stream and memory primitives, each returning a hipblasStatus_t:
+ *
+ *     using stream_t; using event_t;
+ *     get_stream(hipblasHandle_t, stream_t*)        set_stream(hipblasHandle_t, stream_t)
+ *     create_stream(stream_t*)                      destroy_stream(stream_t)
+ *     create_event(event_t*)                        destroy_event(event_t)
+ *     record_event(event_t, stream_t)               wait_event(stream_t, event_t)
+ *     synchronize(stream_t)
+ *     device_malloc(void**, size_t)                 device_free(void*)
+ *     copy_to_host(void*, const void*, size_t, stream_t)   - complete on return
+ *     copy_to_device(void*, const void*, size_t, stream_t) - the source is free on return
+ *     host_malloc(void**, size_t)                   host_free(void*)  - page-locked memory
+ *     copy_to_host_async(void*, const void*, size_t, stream_t)
+ *     launch_host_func(stream_t, void (*)(void*), void*)
+ *
+ * so the decomposition can be exercised with a host stub in place of a GPU runtime.
+ *
+ * The registry also owns a device scratch per handle for the routines composed from several
+ * calls which pass intermediate results between them, such as the 3M complex gemm (gemm3m.hpp).
+ * It grows on demand and is released with the pool.
+ *
+ * In HIPBLAS_BATCHED_INFO_SUMMARY (hipblasSetBatchedInfoMode) the batched solvers pass their
+ * calls through summarized(), which queues a copy of the whole device info array to a
+ * page-locked staging buffer of the handle and a host function which folds it into the summary
+ * of the handle. Both run on a stream of the info channel, created at the first summarized call,
+ * which waits for an event recorded on the stream of the handle after the solver. The stream of
+ * the handle waits for the copy, so later calls may write the info array again, but not for the
+ * host function, which would hold back the work queued after it: the scan of a batch overlaps
+ * with the solvers queued after it. read_summary_async() queues a host function which copies the
+ * summary out after the scans queued before, and the stream of the handle waits for it. Growing
+ * the staging buffer first synchronizes the channel stream.
+ *
+ * The registry also owns the lanes of hipblasSetStreamPool: streams on which the caller issues
+ * independent calls of one host thread so that they overlap. select_lane() switches the stream of
+ * the handle to a lane; a lane selected for the first time since the last join first waits for
+ * an event recorded on the stream of the handle before the first selection, the user stream.
+ * join_lanes() makes the user stream wait for an event recorded on every lane selected, and
+ * switches the handle back to it; release() joins the lanes before it destroys them.
+ */
+template <typename Backend>
+class hipblas_batched_emulation
+{
+    using stream_t = typename Backend::stream_t;
+    using event_t  = typename Backend::event_t;
+
+    struct info_channel;
+
+    // A host function queued by the info channel: the aggregation of the batch_count entries of
+    // the staging buffer, or a readback to summary
+    struct info_job
+    {
+        info_channel*                channel;
+        int                          batch_count;
+        hipblasBatchedInfoSummary_t* summary;
+        bool                         reset;
+        bool                         done;
+    };
+
+    // Summary of the info arrays of the batched solvers of a handle
+    struct info_channel
+    {
+        hipblasBatchedInfoMode_t    mode  = HIPBLAS_BATCHED_INFO_NONE;
+        hipblasBatchedInfoSummary_t total = empty_summary();
+        std::mutex                  mutex; // guards total and jobs
+        std::list<info_job>         jobs;
+        int*                        staging       = nullptr; // page-locked copy of an info array
+        int                         staging_count = 0;
+        bool                        created       = false; // stream and events
+        stream_t                    stream{}; // stream of the jobs
+        event_t                     queued{}; // on the stream of the handle, before a job
+        event_t                     copied{}; // on stream, after the copy of a job
+
+        bool pending()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return std::any_of(
+                jobs.begin(), jobs.end(), [](const info_job& job) { return !job.done; });
+        }
+
+        ~info_channel()
+        {
+            // the host functions still queued use the channel and its staging buffer
+            if(pending())
+                Backend::synchronize(stream);
+            if(created)
+            {
+                Backend::destroy_stream(stream);
+                Backend::destroy_event(queued);
+                Backend::destroy_event(copied);
+            }
+            if(staging)
+                Backend::host_free(staging);
+        }
+    };
+
+    // Streams of hipblasSetStreamPool, with the lanes selected since the last join
+    struct lane_pool
+    {
+        std::vector<stream_t> streams;
+        std::vector<event_t>  events; // events[0] forks, events[1 + l] joins streams[l]
+        std::vector<bool>     used;
+        stream_t              user{};       // stream of the handle at the first selection
+        int                   current = -1; // lane selected, -1 on the user stream
+        int                   next    = 0;  // lane of HIPBLAS_STREAM_LANE_NEXT
+
+        void destroy()
+        {
+            for(stream_t stream : streams)
+                Backend::destroy_stream(stream);
+            for(event_t event : events)
+                Backend::destroy_event(event);
+            streams.clear();
+            events.clear();
+            used.clear();
+        }
+
+        ~lane_pool()
+        {
+            destroy();
+        }
+    };
+
+    // Pool streams of a handle with their events, and the device array of pointers last uploaded
+    struct lanes
+    {
+        std::vector<stream_t> streams;
+        std::vector<event_t>  events; // events[0] forks, events[1 + s] joins streams[s]
+        void*                 workspace       = nullptr;
+        size_t                workspace_bytes = 0;
+        stream_t              workspace_stream{}; // stream of the last upload to workspace
+        void*                 scratch         = nullptr;
+        size_t                scratch_bytes   = 0;
+        stream_t              scratch_stream{}; // stream of the last user of scratch
+        bool                  streams_created = false;
+        hipblasCaptureMode_t  capture_mode    = HIPBLAS_CAPTURE_MODE_DEFAULT;
+        lane_pool             stream_pool;
+        info_channel          info; // destroyed first, waiting for its jobs
+
+        ~lanes()
+        {
+            for(stream_t stream : streams)
+                Backend::destroy_stream(stream);
+            for(event_t event : events)
+                Backend::destroy_event(event);
+            if(workspace)
+                Backend::device_free(workspace);
+            if(scratch)
+                Backend::device_free(scratch);
+        }
+    };
+
+    static std::mutex& registry_mutex()
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::map<hipblasHandle_t, std::unique_ptr<lanes>>& registry()
+    {
+        static std::map<hipblasHandle_t, std::unique_ptr<lanes>> handles;
+        return handles;
+    }
+
+    static int pool_size()
+    {
+        static int size = [] {
+            const char* env = getenv("HIPBLAS_BATCHED_STREAMS");
+            return env && atoi(env) > 0 ? atoi(env) : 4;
+        }();
+        return size;
+    }
+
+    static lanes& lanes_of(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        std::unique_ptr<lanes>&     entry = registry()[handle];
+        if(!entry)
+            entry.reset(new lanes);
+        return *entry;
+    }
+
+    // The pool streams are created at the first run() of the handle, so handles which only
+    // upload pointer arrays do not own streams
+    static void create_streams(lanes& pool)
+    {
+        int size = pool_size() > 1 ? pool_size() : 0;
+        for(int s = 0; s < size; s++)
+        {
+            stream_t stream;
+            if(Backend::create_stream(&stream) != HIPBLAS_STATUS_SUCCESS)
+                break;
+            pool.streams.push_back(stream);
+        }
+        for(size_t e = 0; e <= pool.streams.size(); e++)
+        {
+            event_t event;
+            if(Backend::create_event(&event) != HIPBLAS_STATUS_SUCCESS)
+                break;
+            pool.events.push_back(event);
+        }
+        // without an event for every stream the pool cannot be joined, so it is not used
+        if(pool.events.size() != pool.streams.size() + 1)
+            pool.streams.resize(0);
+        pool.streams_created = true;
+    }
+
+    static void check_not_capturing(lanes& pool)
+    {
+        if(pool.capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            throw HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // Copy the pointers in host to the workspace of handle, on the stream of handle
+    static void* const* upload(hipblasHandle_t handle, const std::vector<const void*>& host)
+    {
+        lanes& pool = lanes_of(handle);
+        check_not_capturing(pool);
+
+        stream_t        stream;
+        size_t          bytes  = std::max(host.size(), size_t(1)) * sizeof(void*);
+        hipblasStatus_t status = Backend::get_stream(handle, &stream);
+
+        // a call on another stream may still read the workspace
+        if(status == HIPBLAS_STATUS_SUCCESS && pool.workspace && pool.workspace_stream != stream)
+            status = Backend::synchronize(pool.workspace_stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && pool.workspace_bytes < bytes)
+        {
+            if(pool.workspace)
+                Backend::device_free(pool.workspace);
+            pool.workspace       = nullptr;
+            pool.workspace_bytes = 0;
+            status               = Backend::device_malloc(&pool.workspace, bytes);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                pool.workspace_bytes = bytes;
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && !host.empty())
+            status = Backend::copy_to_device(
+                pool.workspace, host.data(), host.size() * sizeof(void*), stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+
+        pool.workspace_stream = stream;
+        return static_cast<void* const*>(pool.workspace);
+    }
+
+    static hipblasBatchedInfoSummary_t empty_summary()
+    {
+        return {0, 0, -1, -1, 0};
+    }
+
+    // Host function of an info job, run in stream order
+    static void run_info_job(void* data)
+    {
+        info_job&                    job     = *static_cast<info_job*>(data);
+        info_channel&                channel = *job.channel;
+        std::lock_guard<std::mutex>  lock(channel.mutex);
+        hipblasBatchedInfoSummary_t& total = channel.total;
+
+        if(job.summary)
+        {
+            *job.summary = total;
+            if(job.reset)
+                total = empty_summary();
+        }
+        else
+        {
+            for(int b = 0; b < job.batch_count; b++)
+            {
+                if(channel.staging[b] == 0)
+                    continue;
+                if(total.failures++ == 0)
+                {
+                    total.first_call  = total.calls;
+                    total.first_index = b;
+                    total.first_info  = channel.staging[b];
+                }
+            }
+            total.calls++;
+        }
+        job.done = true;
+    }
+
+    // The stream and events of the info channel, created on the current device
+    static hipblasStatus_t create_channel(info_channel& channel)
+    {
+        hipblasStatus_t status = Backend::create_stream(&channel.stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        status = Backend::create_event(&channel.queued);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            status = Backend::create_event(&channel.copied);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                Backend::destroy_event(channel.queued);
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            Backend::destroy_stream(channel.stream);
+        channel.created = status == HIPBLAS_STATUS_SUCCESS;
+        return status;
+    }
+
+    // Queue on the channel stream, after the work queued on the stream of handle, the copy of the
+    // batch_count entries of the device array info to the staging buffer, if any, then the host
+    // function of the job. The stream of handle waits for the copy of info, or for the host
+    // function of a readback to summary. Throws hipblasStatus_t
+    static void queue_info_job(hipblasHandle_t              handle,
+                               const int*                   info,
+                               int                          batch_count,
+                               hipblasBatchedInfoSummary_t* summary,
+                               bool                         reset)
+    {
+        lanes& pool = lanes_of(handle);
+        check_not_capturing(pool);
+        info_channel& channel = pool.info;
+
+        stream_t        stream;
+        hipblasStatus_t status = Backend::get_stream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && !channel.created)
+            status = create_channel(channel);
+
+        // the jobs queued before do not read the staging buffer any more
+        if(status == HIPBLAS_STATUS_SUCCESS && channel.staging_count < batch_count
+           && channel.pending())
+            status = Backend::synchronize(channel.stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && channel.staging_count < batch_count)
+        {
+            if(channel.staging)
+                Backend::host_free(channel.staging);
+            channel.staging       = nullptr;
+            channel.staging_count = 0;
+            status = Backend::host_malloc((void**)&channel.staging, batch_count * sizeof(int));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                channel.staging_count = batch_count;
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = Backend::record_event(channel.queued, stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = Backend::wait_event(channel.stream, channel.queued);
+        if(status == HIPBLAS_STATUS_SUCCESS && batch_count > 0)
+        {
+            status = Backend::copy_to_host_async(
+                channel.staging, info, batch_count * sizeof(int), channel.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = Backend::record_event(channel.copied, channel.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = Backend::wait_event(stream, channel.copied);
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+
+        info_job* job;
+        {
+            std::lock_guard<std::mutex> lock(channel.mutex);
+            channel.jobs.remove_if([](const info_job& done) { return done.done; });
+            channel.jobs.push_back({&channel, batch_count, summary, reset, false});
+            job = &channel.jobs.back();
+        }
+
+        status = Backend::launch_host_func(channel.stream, run_info_job, job);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            std::lock_guard<std::mutex> lock(channel.mutex);
+            job->done = true;
+            throw status;
+        }
+        if(summary)
+        {
+            status = Backend::record_event(channel.copied, channel.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = Backend::wait_event(stream, channel.copied);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                throw status;
+        }
+    }
+
+public:
+    /*! \brief  Release the pool of handle; called before the handle is destroyed. The handle is
+                switched back to its user stream, after the work of its lanes, and the info jobs
+                still queued are run, before the streams are destroyed */
+    static void release(hipblasHandle_t handle)
+    {
+        join_lanes(handle);
+
+        // destroyed outside the lock, as the info channel may wait for its jobs
+        std::unique_ptr<lanes> entry;
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex());
+            auto                        found = registry().find(handle);
+            if(found == registry().end())
+                return;
+            entry = std::move(found->second);
+            registry().erase(found);
+        }
+    }
+
+    /*! \brief  Set the capture mode of handle */
+    static void set_capture_mode(hipblasHandle_t handle, hipblasCaptureMode_t mode)
+    {
+        if(mode != HIPBLAS_CAPTURE_MODE_DEFAULT && mode != HIPBLAS_CAPTURE_MODE_SAFE)
+            throw HIPBLAS_STATUS_INVALID_ENUM;
+        lanes_of(handle).capture_mode = mode;
+    }
+
+    /*! \brief  Capture mode of handle; handles without state are in the default mode */
+    static hipblasCaptureMode_t capture_mode(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        auto                        entry = registry().find(handle);
+        return entry != registry().end() ? entry->second->capture_mode
+                                         : HIPBLAS_CAPTURE_MODE_DEFAULT;
+    }
+
+    /*! \brief  Set the batched info mode of handle */
+    static void set_batched_info_mode(hipblasHandle_t handle, hipblasBatchedInfoMode_t mode)
+    {
+        if(mode != HIPBLAS_BATCHED_INFO_NONE && mode != HIPBLAS_BATCHED_INFO_SUMMARY)
+            throw HIPBLAS_STATUS_INVALID_ENUM;
+        lanes_of(handle).info.mode = mode;
+    }
+
+    /*! \brief  Batched info mode of handle; handles without state do not summarize */
+    static hipblasBatchedInfoMode_t batched_info_mode(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        auto                        entry = registry().find(handle);
+        return entry != registry().end() ? entry->second->info.mode : HIPBLAS_BATCHED_INFO_NONE;
+    }
+
+    /*! \brief  Run solve(), a batched solver writing batch_count entries of the device array info,
+                and fold info into the summary of handle when the handle summarizes. Nothing is
+                queued in HIPBLAS_CAPTURE_MODE_SAFE, as the jobs cannot be replayed.
+                Throws hipblasStatus_t */
+    template <typename F>
+    static hipblasStatus_t
+        summarized(hipblasHandle_t handle, const int* info, int batch_count, F&& solve)
+    {
+        bool summary = batched_info_mode(handle) == HIPBLAS_BATCHED_INFO_SUMMARY;
+        if(summary)
+            check_not_capturing(lanes_of(handle));
+
+        hipblasStatus_t status = solve();
+        if(summary && status == HIPBLAS_STATUS_SUCCESS && info && batch_count > 0)
+            queue_info_job(handle, info, batch_count, nullptr, false);
+        return status;
+    }
+
+    /*! \brief  Queue the copy of the summary of handle to the host memory summary, after the
+                solvers queued before on the stream of handle and their scans; the stream of
+                handle waits for it. reset starts a new summary after it. Throws hipblasStatus_t */
+    static void
+        read_summary_async(hipblasHandle_t handle, hipblasBatchedInfoSummary_t* summary, bool reset)
+    {
+        if(!summary)
+            throw HIPBLAS_STATUS_INVALID_VALUE;
+        queue_info_job(handle, nullptr, 0, summary, reset);
+    }
+
+    /*! \brief  Join the lanes of handle, then replace them by size new streams created on the
+                current device; 0 releases them. Throws hipblasStatus_t */
+    static void set_stream_pool(hipblasHandle_t handle, int size)
+    {
+        if(size < 0)
+            throw HIPBLAS_STATUS_INVALID_VALUE;
+        hipblasStatus_t status = join_lanes(handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+
+        lane_pool& pool = lanes_of(handle).stream_pool;
+        pool.destroy();
+        pool.next = 0;
+        for(int l = 0; l < size && status == HIPBLAS_STATUS_SUCCESS; l++)
+        {
+            stream_t stream;
+            status = Backend::create_stream(&stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                pool.streams.push_back(stream);
+        }
+        for(int e = 0; e <= size && size > 0 && status == HIPBLAS_STATUS_SUCCESS; e++)
+        {
+            event_t event;
+            status = Backend::create_event(&event);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                pool.events.push_back(event);
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            pool.destroy();
+            throw status;
+        }
+        pool.used.assign(size, false);
+    }
+
+    /*! \brief  Number of lanes of handle */
+    static int stream_pool_size(hipblasHandle_t handle)
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex());
+        auto                        entry = registry().find(handle);
+        return entry != registry().end() ? int(entry->second->stream_pool.streams.size()) : 0;
+    }
+
+    /*! \brief  Issue the following calls on handle on lane, or on the lane after the last one
+                selected for HIPBLAS_STREAM_LANE_NEXT. Throws hipblasStatus_t */
+    static void select_lane(hipblasHandle_t handle, int lane)
+    {
+        lane_pool& pool = lanes_of(handle).stream_pool;
+        int        size = int(pool.streams.size());
+        if(lane == HIPBLAS_STREAM_LANE_NEXT)
+            lane = pool.next;
+        if(lane < 0 || lane >= size)
+            throw HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        if(pool.current < 0)
+            status = Backend::get_stream(handle, &pool.user);
+        if(status == HIPBLAS_STATUS_SUCCESS && !pool.used[lane])
+        {
+            status = Backend::record_event(pool.events[0], pool.user);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = Backend::wait_event(pool.streams[lane], pool.events[0]);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = Backend::set_stream(handle, pool.streams[lane]);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+
+        pool.used[lane] = true;
+        pool.current    = lane;
+        pool.next       = (lane + 1) % size;
+    }
+
+    /*! \brief  Order the user stream of handle after the work issued on its lanes since the last
+                join, and issue the following calls on it again. Nothing to do without lanes
+                selected */
+    static hipblasStatus_t join_lanes(hipblasHandle_t handle)
+    {
+        lane_pool* pool;
+        {
+            std::lock_guard<std::mutex> lock(registry_mutex());
+            auto                        entry = registry().find(handle);
+            if(entry == registry().end() || entry->second->stream_pool.current < 0)
+                return HIPBLAS_STATUS_SUCCESS;
+            pool = &entry->second->stream_pool;
+        }
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(size_t l = 0; l < pool->streams.size(); l++)
+        {
+            if(!pool->used[l])
+                continue;
+            hipblasStatus_t joined = Backend::record_event(pool->events[1 + l], pool->streams[l]);
+            if(joined == HIPBLAS_STATUS_SUCCESS)
+                joined = Backend::wait_event(pool->user, pool->events[1 + l]);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = joined;
+            pool->used[l] = false;
+        }
+        pool->current = -1;
+        pool->next    = 0;
+
+        hipblasStatus_t restored = Backend::set_stream(handle, pool->user);
+        return status == HIPBLAS_STATUS_SUCCESS ? restored : status;
+    }
+
+    /*! \brief  Host copy of the device array of batch_count pointers of a batched routine, read
+                on the stream of handle after the work queued before. Throws hipblasStatus_t */
+    template <typename T>
+    static std::vector<T*> pointers(hipblasHandle_t handle, T* const* array, int batch_count)
+    {
+        std::vector<T*> host(std::max(batch_count, 0));
+        if(host.empty())
+            return host;
+        if(!array)
+            throw HIPBLAS_STATUS_INVALID_VALUE;
+        check_not_capturing(lanes_of(handle));
+
+        stream_t        stream;
+        hipblasStatus_t status = Backend::get_stream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = Backend::copy_to_host(host.data(), array, host.size() * sizeof(T*), stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+        return host;
+    }
+
+    /*! \brief  A strided operand: base + b * stride is the operand of instance b */
+    struct strided
+    {
+        const void* base;
+        size_t      byte_stride;
+
+        template <typename T>
+        strided(T* base, hipblasStride stride)
+            : base(base)
+            , byte_stride(stride * sizeof(T))
+        {
+        }
+    };
+
+    /*! \brief  Device arrays of batch_count pointers to the instances of each strided operand,
+                for a native batched routine. The arrays follow each other, batch_count apart, in
+                a workspace of handle which stays valid until the next upload to it on the same
+                stream. Throws hipblasStatus_t */
+    static void* const*
+        device_pointers(hipblasHandle_t handle, int batch_count, std::initializer_list<strided> ops)
+    {
+        std::vector<const void*> host;
+        host.reserve(std::max(batch_count, 0) * ops.size());
+        for(const strided& op : ops)
+            for(int b = 0; b < batch_count; b++)
+                host.push_back(static_cast<const char*>(op.base) + b * op.byte_stride);
+        return upload(handle, host);
+    }
+
+    /*! \brief  Device copies of host arrays of batch_count pointers, laid out and kept like the
+                arrays of the strided overload. Throws hipblasStatus_t */
+    static void* const* device_pointers(hipblasHandle_t                          handle,
+                                        int                                      batch_count,
+                                        std::initializer_list<const void* const*> arrays)
+    {
+        std::vector<const void*> host;
+        host.reserve(std::max(batch_count, 0) * arrays.size());
+        for(const void* const* array : arrays)
+        {
+            if(!array && batch_count > 0)
+                throw HIPBLAS_STATUS_INVALID_VALUE;
+            host.insert(host.end(), array, array + std::max(batch_count, 0));
+        }
+        return upload(handle, host);
+    }
+
+    /*! \brief  Device scratch of at least bytes owned by handle, for work queued on the stream of
+                handle; it stays valid until the next request on the same stream. Growing it, or
+                moving it to another stream, is not possible in HIPBLAS_CAPTURE_MODE_SAFE.
+                Throws hipblasStatus_t */
+    static void* scratch(hipblasHandle_t handle, size_t bytes)
+    {
+        lanes& pool = lanes_of(handle);
+
+        stream_t        stream;
+        hipblasStatus_t status = Backend::get_stream(handle, &stream);
+
+        // a call on another stream may still use the scratch
+        if(status == HIPBLAS_STATUS_SUCCESS && pool.scratch && pool.scratch_stream != stream)
+        {
+            check_not_capturing(pool);
+            status = Backend::synchronize(pool.scratch_stream);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && pool.scratch_bytes < bytes)
+        {
+            check_not_capturing(pool);
+            if(pool.scratch)
+                Backend::device_free(pool.scratch);
+            pool.scratch       = nullptr;
+            pool.scratch_bytes = 0;
+            status             = Backend::device_malloc(&pool.scratch, bytes);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                pool.scratch_bytes = bytes;
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+
+        pool.scratch_stream = stream;
+        return pool.scratch;
+    }
+
+    /*! \brief  Run call(b), which issues instance b on the current stream of handle, for every
+                b < batch_count, spread over the pool of handle. Stops at the first failing call;
+                the work issued is joined back onto the stream of handle in any case */
+    template <typename F>
+    static hipblasStatus_t run(hipblasHandle_t handle, int batch_count, F&& call)
+    {
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        lanes& pool = lanes_of(handle);
+        if(!pool.streams_created)
+            create_streams(pool);
+
+        int streams = std::min(int(pool.streams.size()), batch_count);
+        if(streams <= 1)
+        {
+            for(int b = 0; b < batch_count; b++)
+            {
+                hipblasStatus_t status = call(b);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        stream_t        user;
+        hipblasStatus_t status = Backend::get_stream(handle, &user);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = Backend::record_event(pool.events[0], user);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Instances s, s + streams, ... go to pool stream s, so the stream of the handle is
+        // switched once per pool stream
+        int forked = 0;
+        for(; forked < streams && status == HIPBLAS_STATUS_SUCCESS; forked++)
+        {
+            status = Backend::wait_event(pool.streams[forked], pool.events[0]);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = Backend::set_stream(handle, pool.streams[forked]);
+            for(int b = forked; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b += streams)
+                status = call(b);
+        }
+
+        for(int s = 0; s < forked; s++)
+        {
+            hipblasStatus_t joined = Backend::record_event(pool.events[1 + s], pool.streams[s]);
+            if(joined == HIPBLAS_STATUS_SUCCESS)
+                joined = Backend::wait_event(user, pool.events[1 + s]);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = joined;
+        }
+
+        hipblasStatus_t restored = Backend::set_stream(handle, user);
+        return status == HIPBLAS_STATUS_SUCCESS ? restored : status;
+    }
+};
+
+/*! \brief  scratch() of the backend of the library, for the routines built on the public API
+            which are compiled once for both backends. Throws hipblasStatus_t */
+void* hipblas_scratch(hipblasHandle_t handle, size_t bytes);
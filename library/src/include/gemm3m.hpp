@@ -0,0 +1,588 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_routines.hpp"
+#include "host_pointer_mode.hpp"
+#include <algorithm>
+#include <climits>
+#include <initializer_list>
+#include <vector>
+
+/*!\file
+ * \brief 3M (Gauss) form of the complex gemm C = alpha * op(A) * op(B) + beta * C, which computes
+ * the product from three real gemm where the classical form does the work of four. With
+ * op(A) = Ar + i * Ai and op(B) = Br + i * Bi,
+ *
+ *     T1 = Ar * Br,   T2 = Ai * Bi,   T3 = (Ar + Ai) * (Br + Bi)
+ *     op(A) * op(B) = (T1 - T2) + i * (T3 - T1 - T2)
+ *
+ * The real and imaginary parts are split out of the interleaved storage into a workspace by one
+ * transposing real geam per operand, the sums and differences are real geam, and the product is
+ * interleaved back and added to C by one complex geam in the pointer mode of the caller, so alpha
+ * and beta are read where the caller put them. Every step covers a whole group of instances,
+ * whatever their strides, or through arrays of pointers when the instances are given by
+ * pointers. The workspace and the upload of the arrays of pointers are supplied by the caller.
+ */
+
+/*! \brief  Argument check of the 3M gemm, shared by its batched forms */
+inline hipblasStatus_t hipblas_gemm3m_arguments(hipblasHandle_t    handle,
+                                                hipblasOperation_t transa,
+                                                hipblasOperation_t transb,
+                                                int                m,
+                                                int                n,
+                                                int                k,
+                                                int                lda,
+                                                int                ldb,
+                                                int                ldc,
+                                                int                batch_count)
+{
+    auto valid_op = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    };
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!valid_op(transa) || !valid_op(transb))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || k < 0 || lda < (transa == HIPBLAS_OP_N ? m : k)
+       || ldb < (transb == HIPBLAS_OP_N ? k : n) || ldc < m || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/*! \brief  Bytes of workspace used per instance by the 3M gemm of m by n whose parts of op(A)
+            and op(B) take size_a and size_b elements: those parts, the parts of the product and
+            the interleaved product */
+template <typename Complex>
+size_t hipblas_gemm3m_workspace_size(size_t size_a, size_t size_b, int m, int n)
+{
+    using Real = typename hipblas_routines<Complex>::real_t;
+    return (2 * size_a + 2 * size_b + 4 * size_t(m) * n) * sizeof(Real);
+}
+
+/*! \brief  Copies the real and the imaginary parts of the count rows by cols matrices X_b, of
+            leading dimension ldx, to re + b * part and re + (count + b) * part, with the same
+            leading dimension. X_b is X + b * stride_x, or xs[b] when the device array xs is
+            given, and then res is the device array of the re + b * part. The interleaved
+            elements of X_b are read as a 2 row real matrix, which one geam transposes into the
+            two parts of all the instances */
+template <typename Complex, typename Real>
+hipblasStatus_t hipblas_gemm3m_split(hipblasHandle_t       handle,
+                                     int                   rows,
+                                     int                   cols,
+                                     const Complex*        X,
+                                     int                   ldx,
+                                     hipblasStride         stride_x,
+                                     const Complex* const* xs,
+                                     Real*                 re,
+                                     Real* const*          res,
+                                     size_t                part,
+                                     int                   count)
+{
+    using routines = hipblas_routines<Real>;
+
+    // the constants are read in the host pointer mode set by the caller; ld_parts steps from
+    // the real parts to the imaginary ones
+    Real one(1), zero(0);
+    int  span     = ldx * (cols - 1) + rows;
+    int  ld_parts = int(part * count);
+    if(xs)
+    {
+        const Real* const* x = reinterpret_cast<const Real* const*>(xs);
+        return routines::geam_batched(handle,
+                                      HIPBLAS_OP_T,
+                                      HIPBLAS_OP_T,
+                                      span,
+                                      2,
+                                      &one,
+                                      x,
+                                      2,
+                                      &zero,
+                                      x,
+                                      2,
+                                      res,
+                                      ld_parts,
+                                      count);
+    }
+
+    const Real* x = reinterpret_cast<const Real*>(X);
+    return routines::geam_strided_batched(handle,
+                                          HIPBLAS_OP_T,
+                                          HIPBLAS_OP_T,
+                                          span,
+                                          2,
+                                          &one,
+                                          x,
+                                          2,
+                                          2 * stride_x,
+                                          &zero,
+                                          x,
+                                          2,
+                                          2 * stride_x,
+                                          re,
+                                          ld_parts,
+                                          part,
+                                          count);
+}
+
+/*! \brief  3M gemm of batch_count instances: A_b is A + b * strideA, or A_array[b] when the device
+            arrays of pointers A_array, B_array and C_array are given, and so on. workspace(bytes)
+            returns device memory of at least bytes, valid for the work queued on the stream of
+            handle until the next request; upload(count, arrays) copies host arrays of count
+            pointers to the device together, and returns them count apart. The batch is run in
+            groups whose workspace fits in hipblas_gemm3m_group_bytes, or one instance at a
+            time, each group a fixed number of calls. Throws hipblasStatus_t */
+template <typename Complex, typename Workspace, typename Upload>
+hipblasStatus_t hipblas_gemm3m_run(hipblasHandle_t       handle,
+                                   hipblasOperation_t    transa,
+                                   hipblasOperation_t    transb,
+                                   int                   m,
+                                   int                   n,
+                                   int                   k,
+                                   const Complex*        alpha,
+                                   const Complex*        A,
+                                   const Complex* const* A_array,
+                                   int                   lda,
+                                   hipblasStride         strideA,
+                                   const Complex*        B,
+                                   const Complex* const* B_array,
+                                   int                   ldb,
+                                   hipblasStride         strideB,
+                                   const Complex*        beta,
+                                   Complex*              C,
+                                   Complex* const*       C_array,
+                                   int                   ldc,
+                                   hipblasStride         strideC,
+                                   int                   batch_count,
+                                   Workspace             workspace,
+                                   Upload                upload)
+{
+    using complex_routines = hipblas_routines<Complex>;
+    using Real             = typename complex_routines::real_t;
+    using routines         = hipblas_routines<Real>;
+
+    // workspace of a group of instances beyond which the batch is split
+    const size_t hipblas_gemm3m_group_bytes = size_t(1) << 28;
+
+    bool arrays = A_array && B_array && C_array;
+    int  rows_a = transa == HIPBLAS_OP_N ? m : k, cols_a = transa == HIPBLAS_OP_N ? k : m;
+    int  rows_b = transb == HIPBLAS_OP_N ? k : n, cols_b = transb == HIPBLAS_OP_N ? n : k;
+
+    // The parts of op(A) and op(B) keep the leading dimensions of the caller, so that they are
+    // split from instances of any stride at once. Without a product to compute, or with parts
+    // too large to be addressed by the int sizes of the routines issued, the classical form is
+    // run
+    size_t size_a = size_t(lda) * cols_a, size_b = size_t(ldb) * cols_b, size_c = size_t(m) * n;
+    bool   no_product = !k;
+    if(hipblas_pointer_mode(handle) == HIPBLAS_POINTER_MODE_HOST)
+    {
+        const Real* a = reinterpret_cast<const Real*>(alpha);
+        no_product    = no_product || (a[0] == 0 && a[1] == 0);
+    }
+    if(no_product || std::max(std::max(size_a, size_b), 2 * size_c) > INT_MAX)
+    {
+        if(!arrays)
+            return complex_routines::gemm_strided_batched(handle,
+                                                          transa,
+                                                          transb,
+                                                          m,
+                                                          n,
+                                                          k,
+                                                          alpha,
+                                                          A,
+                                                          lda,
+                                                          strideA,
+                                                          B,
+                                                          ldb,
+                                                          strideB,
+                                                          beta,
+                                                          C,
+                                                          ldc,
+                                                          strideC,
+                                                          batch_count);
+
+        return complex_routines::gemm_batched(handle,
+                                              transa,
+                                              transb,
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A_array,
+                                              lda,
+                                              B_array,
+                                              ldb,
+                                              beta,
+                                              C_array,
+                                              ldc,
+                                              batch_count);
+    }
+
+    // op(X) = Xr + i * sign * Xi, conjugation flips the sign of the imaginary part
+    hipblasOperation_t op_a   = transa == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    hipblasOperation_t op_b   = transb == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+    Real               sign_a = transa == HIPBLAS_OP_C ? -1 : 1;
+    Real               sign_b = transb == HIPBLAS_OP_C ? -1 : 1;
+    Real               sign   = sign_a * sign_b;
+    Real               one(1), zero(0), minus_one(-1);
+
+    size_t instance = hipblas_gemm3m_workspace_size<Complex>(size_a, size_b, m, n);
+    int    group    = int(std::min(std::max(hipblas_gemm3m_group_bytes / instance, size_t(1)),
+                                size_t(batch_count)));
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(int b0 = 0; b0 < batch_count && status == HIPBLAS_STATUS_SUCCESS; b0 += group)
+    {
+        int count = std::min(group, batch_count - b0);
+
+        // Parts of count instances each, the interleaved product pc holds s * Ai * Bi until
+        // the parts of the product are formed
+        Real* ar = static_cast<Real*>(workspace(instance * count));
+        Real* ai = ar + size_a * count;
+        Real* br = ai + size_a * count;
+        Real* bi = br + size_b * count;
+        Real* pr = bi + size_b * count;
+        Real* pi = pr + size_c * count;
+        Real* pc = pi + size_c * count;
+        Real* w  = pc;
+
+        // The instances given by pointers are split from, and added to, through arrays of
+        // pointers to the parts of each instance in the workspace, uploaded together
+        Real* const* parts = nullptr;
+        if(arrays)
+        {
+            std::vector<const void*> host(3 * size_t(count));
+            for(int i = 0; i < count; i++)
+            {
+                host[i]             = ar + i * size_a;
+                host[count + i]     = br + i * size_b;
+                host[2 * count + i] = pc + i * 2 * size_c;
+            }
+            parts = reinterpret_cast<Real* const*>(upload(3 * count, {host.data()}));
+        }
+
+        {
+            hipblas_host_pointer_mode constants(handle);
+
+            status = hipblas_gemm3m_split(handle,
+                                          rows_a,
+                                          cols_a,
+                                          A + b0 * strideA,
+                                          lda,
+                                          strideA,
+                                          arrays ? A_array + b0 : nullptr,
+                                          ar,
+                                          parts,
+                                          size_a,
+                                          count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hipblas_gemm3m_split(
+                    handle,
+                    rows_b,
+                    cols_b,
+                    B + b0 * strideB,
+                    ldb,
+                    strideB,
+                    arrays ? B_array + b0 : nullptr,
+                    br,
+                    arrays ? parts + count : nullptr,
+                    size_b,
+                    count);
+
+            // w = s * T2, pr = T1
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::gemm_strided_batched(handle,
+                                                        op_a,
+                                                        op_b,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        &sign,
+                                                        ai,
+                                                        lda,
+                                                        size_a,
+                                                        bi,
+                                                        ldb,
+                                                        size_b,
+                                                        &zero,
+                                                        w,
+                                                        m,
+                                                        size_c,
+                                                        count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::gemm_strided_batched(handle,
+                                                        op_a,
+                                                        op_b,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        &one,
+                                                        ar,
+                                                        lda,
+                                                        size_a,
+                                                        br,
+                                                        ldb,
+                                                        size_b,
+                                                        &zero,
+                                                        pr,
+                                                        m,
+                                                        size_c,
+                                                        count);
+
+            // ai = Ar + sign_a * Ai and bi = Br + sign_b * Bi in place, then pi = T3
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::geam_strided_batched(handle,
+                                                        HIPBLAS_OP_N,
+                                                        HIPBLAS_OP_N,
+                                                        rows_a,
+                                                        cols_a,
+                                                        &sign_a,
+                                                        ai,
+                                                        lda,
+                                                        size_a,
+                                                        &one,
+                                                        ar,
+                                                        lda,
+                                                        size_a,
+                                                        ai,
+                                                        lda,
+                                                        size_a,
+                                                        count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::geam_strided_batched(handle,
+                                                        HIPBLAS_OP_N,
+                                                        HIPBLAS_OP_N,
+                                                        rows_b,
+                                                        cols_b,
+                                                        &sign_b,
+                                                        bi,
+                                                        ldb,
+                                                        size_b,
+                                                        &one,
+                                                        br,
+                                                        ldb,
+                                                        size_b,
+                                                        bi,
+                                                        ldb,
+                                                        size_b,
+                                                        count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::gemm_strided_batched(handle,
+                                                        op_a,
+                                                        op_b,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        &one,
+                                                        ai,
+                                                        lda,
+                                                        size_a,
+                                                        bi,
+                                                        ldb,
+                                                        size_b,
+                                                        &zero,
+                                                        pi,
+                                                        m,
+                                                        size_c,
+                                                        count);
+
+            // pi = T3 - T1 - s * T2, pr = T1 - s * T2
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::geam_strided_batched(handle,
+                                                        HIPBLAS_OP_N,
+                                                        HIPBLAS_OP_N,
+                                                        m,
+                                                        n,
+                                                        &one,
+                                                        pi,
+                                                        m,
+                                                        size_c,
+                                                        &minus_one,
+                                                        pr,
+                                                        m,
+                                                        size_c,
+                                                        pi,
+                                                        m,
+                                                        size_c,
+                                                        count);
+            for(Real* part : {pi, pr})
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = routines::geam_strided_batched(handle,
+                                                            HIPBLAS_OP_N,
+                                                            HIPBLAS_OP_N,
+                                                            m,
+                                                            n,
+                                                            &one,
+                                                            part,
+                                                            m,
+                                                            size_c,
+                                                            &minus_one,
+                                                            w,
+                                                            m,
+                                                            size_c,
+                                                            part,
+                                                            m,
+                                                            size_c,
+                                                            count);
+
+            // interleaved into pc, over w
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::copy_strided_batched(
+                    handle, int(size_c), pr, 1, size_c, pc, 2, 2 * size_c, count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = routines::copy_strided_batched(
+                    handle, int(size_c), pi, 1, size_c, pc + 1, 2, 2 * size_c, count);
+        }
+
+        // C = alpha * product + beta * C with the scalars of the caller
+        if(status == HIPBLAS_STATUS_SUCCESS && arrays)
+            status = complex_routines::geam_batched(
+                handle,
+                HIPBLAS_OP_N,
+                HIPBLAS_OP_N,
+                m,
+                n,
+                alpha,
+                reinterpret_cast<const Complex* const*>(parts + 2 * count),
+                m,
+                beta,
+                C_array + b0,
+                ldc,
+                C_array + b0,
+                ldc,
+                count);
+        else if(status == HIPBLAS_STATUS_SUCCESS)
+            status = complex_routines::geam_strided_batched(handle,
+                                                            HIPBLAS_OP_N,
+                                                            HIPBLAS_OP_N,
+                                                            m,
+                                                            n,
+                                                            alpha,
+                                                            reinterpret_cast<const Complex*>(pc),
+                                                            m,
+                                                            size_c,
+                                                            beta,
+                                                            C + b0 * strideC,
+                                                            ldc,
+                                                            strideC,
+                                                            C + b0 * strideC,
+                                                            ldc,
+                                                            strideC,
+                                                            count);
+    }
+    return status;
+}
+
+/*! \brief  3M gemm of batch_count instances, A_b = A + b * strideA and so on; see
+            hipblas_gemm3m_run. Throws hipblasStatus_t */
+template <typename Complex, typename Workspace>
+hipblasStatus_t hipblas_gemm3m_strided_batched(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const Complex*     alpha,
+                                               const Complex*     A,
+                                               int                lda,
+                                               hipblasStride      strideA,
+                                               const Complex*     B,
+                                               int                ldb,
+                                               hipblasStride      strideB,
+                                               const Complex*     beta,
+                                               Complex*           C,
+                                               int                ldc,
+                                               hipblasStride      strideC,
+                                               int                batch_count,
+                                               Workspace          workspace)
+{
+    hipblasStatus_t status
+        = hipblas_gemm3m_arguments(handle, transa, transb, m, n, k, lda, ldb, ldc, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+        return status;
+    if(!alpha || !beta || !C || (k && (!A || !B)))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // strided operands upload no arrays of pointers
+    return hipblas_gemm3m_run<Complex>(
+        handle,
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        alpha,
+        A,
+        nullptr,
+        lda,
+        strideA,
+        B,
+        nullptr,
+        ldb,
+        strideB,
+        beta,
+        C,
+        nullptr,
+        ldc,
+        strideC,
+        batch_count,
+        workspace,
+        [](int, std::initializer_list<const void* const*>) -> void* const* { return nullptr; });
+}
+
+/*! \brief  3M gemm of the batch_count instances A[b], B[b] and C[b], given by device arrays of
+            pointers; see hipblas_gemm3m_run. Throws hipblasStatus_t */
+template <typename Complex, typename Workspace, typename Upload>
+hipblasStatus_t hipblas_gemm3m_batched(hipblasHandle_t       handle,
+                                       hipblasOperation_t    transa,
+                                       hipblasOperation_t    transb,
+                                       int                   m,
+                                       int                   n,
+                                       int                   k,
+                                       const Complex*        alpha,
+                                       const Complex* const* A,
+                                       int                   lda,
+                                       const Complex* const* B,
+                                       int                   ldb,
+                                       const Complex*        beta,
+                                       Complex* const*       C,
+                                       int                   ldc,
+                                       int                   batch_count,
+                                       Workspace             workspace,
+                                       Upload                upload)
+{
+    hipblasStatus_t status
+        = hipblas_gemm3m_arguments(handle, transa, transb, m, n, k, lda, ldb, ldc, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+        return status;
+    if(!alpha || !beta || !A || !B || !C)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblas_gemm3m_run<Complex>(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       nullptr,
+                                       A,
+                                       lda,
+                                       0,
+                                       nullptr,
+                                       B,
+                                       ldb,
+                                       0,
+                                       beta,
+                                       nullptr,
+                                       C,
+                                       ldc,
+                                       0,
+                                       batch_count,
+                                       workspace,
+                                       upload);
+}
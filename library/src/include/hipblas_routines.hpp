@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+/*!\file
+ * \brief Routines of the public API by element type, for the routines composed from them
+ * (gemm3m.hpp, storage_conversion.hpp, syrk_ex.hpp and variable_size_batch.hpp), which are
+ * templates over the type and issue only routines of the public API, so that they serve both
+ * backends.
+ */
+
+/*! \brief  Routines of the public API for elements of type T, and the real type real_t of T */
+template <typename T>
+struct hipblas_routines;
+
+template <>
+struct hipblas_routines<float>
+{
+    using real_t = float;
+
+    template <typename... Args>
+    static hipblasStatus_t copy_strided_batched(Args... args)
+    {
+        return hipblasScopyStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_strided_batched(Args... args)
+    {
+        return hipblasSgeamStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_batched(Args... args)
+    {
+        return hipblasSgeamBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_strided_batched(Args... args)
+    {
+        return hipblasSgemmStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_batched(Args... args)
+    {
+        return hipblasSgemmBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv(Args... args)
+    {
+        return hipblasSgemv(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched(Args... args)
+    {
+        return hipblasSgemvBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched_host_ptrs(Args... args)
+    {
+        return hipblasSgemvBatchedHostPtrs(args...);
+    }
+};
+
+template <>
+struct hipblas_routines<double>
+{
+    using real_t = double;
+
+    template <typename... Args>
+    static hipblasStatus_t copy_strided_batched(Args... args)
+    {
+        return hipblasDcopyStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_strided_batched(Args... args)
+    {
+        return hipblasDgeamStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_batched(Args... args)
+    {
+        return hipblasDgeamBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_strided_batched(Args... args)
+    {
+        return hipblasDgemmStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_batched(Args... args)
+    {
+        return hipblasDgemmBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv(Args... args)
+    {
+        return hipblasDgemv(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched(Args... args)
+    {
+        return hipblasDgemvBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched_host_ptrs(Args... args)
+    {
+        return hipblasDgemvBatchedHostPtrs(args...);
+    }
+};
+
+template <>
+struct hipblas_routines<hipblasComplex>
+{
+    using real_t = float;
+
+    template <typename... Args>
+    static hipblasStatus_t copy_strided_batched(Args... args)
+    {
+        return hipblasCcopyStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_strided_batched(Args... args)
+    {
+        return hipblasCgeamStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_batched(Args... args)
+    {
+        return hipblasCgeamBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_strided_batched(Args... args)
+    {
+        return hipblasCgemmStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_batched(Args... args)
+    {
+        return hipblasCgemmBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv(Args... args)
+    {
+        return hipblasCgemv(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched(Args... args)
+    {
+        return hipblasCgemvBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched_host_ptrs(Args... args)
+    {
+        return hipblasCgemvBatchedHostPtrs(args...);
+    }
+};
+
+template <>
+struct hipblas_routines<hipblasDoubleComplex>
+{
+    using real_t = double;
+
+    template <typename... Args>
+    static hipblasStatus_t copy_strided_batched(Args... args)
+    {
+        return hipblasZcopyStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_strided_batched(Args... args)
+    {
+        return hipblasZgeamStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t geam_batched(Args... args)
+    {
+        return hipblasZgeamBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_strided_batched(Args... args)
+    {
+        return hipblasZgemmStridedBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemm_batched(Args... args)
+    {
+        return hipblasZgemmBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv(Args... args)
+    {
+        return hipblasZgemv(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched(Args... args)
+    {
+        return hipblasZgemvBatched(args...);
+    }
+
+    template <typename... Args>
+    static hipblasStatus_t gemv_batched_host_ptrs(Args... args)
+    {
+        return hipblasZgemvBatchedHostPtrs(args...);
+    }
+};
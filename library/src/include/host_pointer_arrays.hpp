@@ -0,0 +1,39 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <cstdint>
+
+/*!\file
+ * \brief Support of the HostPtrs forms of the batched routines, which take the arrays of pointers
+ * to the instances in host memory. When every array is one allocation walked with a constant
+ * stride the call is dispatched to the strided batched routine, so neither the arrays nor their
+ * upload are needed; otherwise the arrays are uploaded to the pointer array workspace of the
+ * handle (see hipblas_batched_emulation::device_pointers) for the batched routine.
+ */
+
+/*! \brief  True when the batch_count pointers of array are array[0] + b * stride, for a stride
+            >= 0 counted in elements of T, which is returned in stride. A single instance has
+            stride 0; an empty or missing array is not uniform.  */
+template <typename T>
+bool hipblas_uniform_stride(T* const* array, int batch_count, hipblasStride* stride)
+{
+    if(!array || batch_count < 1)
+        return false;
+
+    // integer arithmetic: the pointers need not point into one object
+    uintptr_t base = reinterpret_cast<uintptr_t>(array[0]);
+    uintptr_t step = batch_count > 1 ? reinterpret_cast<uintptr_t>(array[1]) - base : 0;
+    if(batch_count > 1 && (reinterpret_cast<uintptr_t>(array[1]) < base || step % sizeof(T)))
+        return false;
+    for(int b = 2; b < batch_count; b++)
+        if(reinterpret_cast<uintptr_t>(array[b]) != base + b * step)
+            return false;
+
+    *stride = hipblasStride(step / sizeof(T));
+    return true;
+}
+
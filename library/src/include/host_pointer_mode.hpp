@@ -0,0 +1,45 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+
+/*!\file
+ * \brief Pointer mode of a handle for the routines composed from other routines of the public
+ * API, which pass their own constants to the routines they issue.
+ */
+
+/*! \brief  Pointer mode of handle. Throws hipblasStatus_t */
+inline hipblasPointerMode_t hipblas_pointer_mode(hipblasHandle_t handle)
+{
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        throw status;
+    return mode;
+}
+
+/*! \brief  Host pointer mode for the constants of the calls issued in its scope, which then
+            restores the mode of the caller. Throws hipblasStatus_t */
+class hipblas_host_pointer_mode
+{
+    hipblasHandle_t      handle;
+    hipblasPointerMode_t mode;
+
+public:
+    explicit hipblas_host_pointer_mode(hipblasHandle_t handle)
+        : handle(handle)
+        , mode(hipblas_pointer_mode(handle))
+    {
+        hipblasStatus_t status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            throw status;
+    }
+
+    ~hipblas_host_pointer_mode()
+    {
+        hipblasSetPointerMode(handle, mode);
+    }
+};
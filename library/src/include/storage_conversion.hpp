@@ -0,0 +1,292 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_routines.hpp"
+#include "host_pointer_arrays.hpp"
+#include "host_pointer_mode.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <initializer_list>
+#include <vector>
+
+/*!\file
+ * \brief Conversion of a triangular matrix between packed and full storage (tpttr and trttp) for
+ * a backend without it, and the host copy of the arrays of pointers of the batched conversions,
+ * shared with the band conversions of hipblas_storage.cpp.
+ *
+ * A column of a packed matrix is contiguous, but the n columns have n lengths and start at offsets
+ * quadratic in j, so no strided call covers more than one. The columns of at least chunk elements
+ * are cut into pieces of chunk elements, the last piece of a column ending at its end and possibly
+ * overlapping the one before, which writes the same elements again with the same values; the
+ * shorter columns are cut into single elements. Each size of piece is one geamBatched over arrays
+ * of pointers uploaded by the backend, in which a piece is a chunk by batchCount matrix whose
+ * columns are the instances of the batch, so a conversion is two launches whatever n and
+ * batchCount. A chunk near the cube root of n^2 / 2 balances the two sizes at about 2 * n^(4/3)
+ * pieces.
+ *
+ * In HIPBLAS_CAPTURE_MODE_SAFE, where the pointers cannot be uploaded, a conversion is one
+ * copyStridedBatched per column.
+ */
+
+/*! \brief  Host copy of the device array of batch_count pointers, read on the stream of handle
+            after the work queued before. Throws hipblasStatus_t */
+template <typename T>
+std::vector<T*> hipblas_host_pointers(hipblasHandle_t handle, T* const* array, int batch_count)
+{
+    hipblasCaptureMode_t mode;
+    hipStream_t          stream;
+    std::vector<T*>      host(batch_count);
+
+    // the copy synchronizes with the host, which a captured graph cannot replay
+    hipblasStatus_t status = hipblasGetCaptureMode(handle, &mode);
+    if(status == HIPBLAS_STATUS_SUCCESS && mode == HIPBLAS_CAPTURE_MODE_SAFE)
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetVectorAsync(batch_count, sizeof(T*), array, 1, host.data(), 1, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(stream) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        throw status;
+    return host;
+}
+
+/*! \brief  Column j of an n by n triangular matrix: its offsets in packed storage and in full
+            storage with leading dimension lda, and its length */
+struct hipblas_packed_column
+{
+    size_t packed, full;
+    int    length;
+};
+
+inline hipblas_packed_column
+    hipblas_packed_column_of(hipblasFillMode_t uplo, int n, int j, int lda)
+{
+    if(uplo == HIPBLAS_FILL_MODE_UPPER)
+        return {size_t(j) * (j + 1) / 2, size_t(j) * lda, j + 1};
+    return {size_t(j) * (2 * size_t(n) - j + 1) / 2, j + size_t(j) * lda, n - j};
+}
+
+inline hipblasStatus_t hipblas_packed_arguments(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, int lda, int batch_count)
+{
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(n < 0 || lda < std::max(n, 1) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/*! \brief  Length of the pieces of the columns of an n by n packed matrix */
+inline int hipblas_packed_chunk(int n)
+{
+    return std::min(n, std::max(1, int(std::cbrt(0.5 * n * n))));
+}
+
+/*! \brief  Converts from to to: AP to A when to_full (tpttr), A to AP otherwise (trttp). The
+            instances are from[i] + c * stride_from and to[i] + c * stride_to for every i and
+            c < columns; columns > 1 requires strides of at least hipblas_packed_chunk(n) which
+            fit in an int. The arrays of pointers to the pieces are copied to the device together
+            by upload(count, {from, to}), which returns the two device arrays count apart */
+template <typename T, typename Upload>
+hipblasStatus_t hipblas_packed_convert(hipblasHandle_t              handle,
+                                       hipblasFillMode_t            uplo,
+                                       int                          n,
+                                       const std::vector<const T*>& from,
+                                       hipblasStride                stride_from,
+                                       const std::vector<T*>&       to,
+                                       hipblasStride                stride_to,
+                                       int                          columns,
+                                       int                          lda,
+                                       bool                         to_full,
+                                       Upload                       upload)
+{
+    using routines = hipblas_routines<T>;
+
+    int    chunk  = hipblas_packed_chunk(n);
+    size_t pieces = 0;
+    for(int length = 1; length <= n; length++)
+        pieces += length < chunk ? length : (length + chunk - 1) / chunk;
+
+    hipblasCaptureMode_t mode;
+    hipblasStatus_t      status = hipblasGetCaptureMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(mode == HIPBLAS_CAPTURE_MODE_SAFE || pieces * from.size() > INT_MAX)
+    {
+        for(size_t i = 0; i < from.size(); i++)
+            for(int j = 0; j < n && status == HIPBLAS_STATUS_SUCCESS; j++)
+            {
+                hipblas_packed_column column = hipblas_packed_column_of(uplo, n, j, lda);
+                status = routines::copy_strided_batched(
+                    handle,
+                    column.length,
+                    from[i] + (to_full ? column.packed : column.full),
+                    1,
+                    stride_from,
+                    to[i] + (to_full ? column.full : column.packed),
+                    1,
+                    stride_to,
+                    columns);
+            }
+        return status;
+    }
+
+    // the pieces of chunk elements, then the single elements
+    std::vector<const void*> sources, targets;
+    sources.reserve(pieces * from.size());
+    targets.reserve(pieces * from.size());
+    int whole = 0;
+    for(int single = 0; single < 2; single++)
+    {
+        for(int j = 0; j < n; j++)
+        {
+            hipblas_packed_column column = hipblas_packed_column_of(uplo, n, j, lda);
+            if((column.length < chunk) != bool(single))
+                continue;
+
+            size_t source = to_full ? column.packed : column.full;
+            size_t target = to_full ? column.full : column.packed;
+            int    step   = single ? 1 : chunk;
+            for(int k = 0; k < column.length; k += step)
+            {
+                int start = std::min(k, column.length - step);
+                for(size_t i = 0; i < from.size(); i++)
+                {
+                    sources.push_back(from[i] + source + start);
+                    targets.push_back(to[i] + target + start);
+                }
+            }
+        }
+        if(!single)
+            whole = int(sources.size());
+    }
+
+    int             count   = int(sources.size());
+    void* const*    arrays  = upload(count, {sources.data(), targets.data()});
+    const T* const* A       = reinterpret_cast<const T* const*>(arrays);
+    T* const*       C       = reinterpret_cast<T* const*>(arrays) + count;
+    int             ld_from = columns > 1 ? int(stride_from) : chunk;
+    int             ld_to   = columns > 1 ? int(stride_to) : chunk;
+
+    hipblas_host_pointer_mode constants(handle);
+    T                         one(1), zero(0);
+    for(int single = 0; single < 2 && status == HIPBLAS_STATUS_SUCCESS; single++)
+    {
+        int first = single ? whole : 0;
+        int last  = single ? count : whole;
+        if(first < last)
+            status = routines::geam_batched(handle,
+                                            HIPBLAS_OP_N,
+                                            HIPBLAS_OP_N,
+                                            single ? 1 : chunk,
+                                            columns,
+                                            &one,
+                                            A + first,
+                                            ld_from,
+                                            &zero,
+                                            A + first,
+                                            ld_from,
+                                            C + first,
+                                            ld_to,
+                                            last - first);
+    }
+    return status;
+}
+
+/*! \brief  Converts from to to: AP to A when to_full (tpttr), A to AP otherwise (trttp). Instance
+            b is from + b * stride_from and to + b * stride_to. upload is as for
+            hipblas_packed_convert */
+template <typename T, typename Upload>
+hipblasStatus_t hipblas_packed_strided_batched(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int               n,
+                                               const T*          from,
+                                               hipblasStride     stride_from,
+                                               T*                to,
+                                               hipblasStride     stride_to,
+                                               int               lda,
+                                               int               batch_count,
+                                               bool              to_full,
+                                               Upload            upload)
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batch_count)
+        return status;
+    if(!from || !to)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // the instances are the columns of the pieces when they do not overlap within a piece
+    int  chunk   = hipblas_packed_chunk(n);
+    bool columns = batch_count == 1
+                   || (stride_from >= chunk && stride_from <= INT_MAX && stride_to >= chunk
+                       && stride_to <= INT_MAX);
+
+    std::vector<const T*> host_from;
+    std::vector<T*>       host_to;
+    for(int b = 0; b < (columns ? 1 : batch_count); b++)
+    {
+        host_from.push_back(from + b * stride_from);
+        host_to.push_back(to + b * stride_to);
+    }
+    return hipblas_packed_convert(handle,
+                                  uplo,
+                                  n,
+                                  host_from,
+                                  stride_from,
+                                  host_to,
+                                  stride_to,
+                                  columns ? batch_count : 1,
+                                  lda,
+                                  to_full,
+                                  upload);
+}
+
+/*! \brief  Converts from[b] to to[b] for every b < batch_count, like
+            hipblas_packed_strided_batched. The arrays of pointers are read back to the host */
+template <typename T, typename Upload>
+hipblasStatus_t hipblas_packed_batched(hipblasHandle_t   handle,
+                                       hipblasFillMode_t uplo,
+                                       int               n,
+                                       const T* const    from[],
+                                       T* const          to[],
+                                       int               lda,
+                                       int               batch_count,
+                                       bool              to_full,
+                                       Upload            upload)
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batch_count)
+        return status;
+    if(!from || !to)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::vector<const T*> host_from = hipblas_host_pointers(handle, from, batch_count);
+    std::vector<T*>       host_to   = hipblas_host_pointers(handle, to, batch_count);
+    hipblasStride         stride_from, stride_to;
+    if(hipblas_uniform_stride(host_from.data(), batch_count, &stride_from)
+       && hipblas_uniform_stride(host_to.data(), batch_count, &stride_to))
+        return hipblas_packed_strided_batched(handle,
+                                              uplo,
+                                              n,
+                                              host_from[0],
+                                              stride_from,
+                                              host_to[0],
+                                              stride_to,
+                                              lda,
+                                              batch_count,
+                                              to_full,
+                                              upload);
+
+    return hipblas_packed_convert(
+        handle, uplo, n, host_from, 0, host_to, 0, 1, lda, to_full, upload);
+}
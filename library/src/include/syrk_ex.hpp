@@ -0,0 +1,636 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_routines.hpp"
+#include "host_pointer_arrays.hpp"
+#include "host_pointer_mode.hpp"
+#include <algorithm>
+#include <initializer_list>
+#include <map>
+#include <utility>
+#include <vector>
+
+/*!\file
+ * \brief syrk_ex and herk_ex: the rank k update C = alpha * op(A) * op(A)^T + beta * C, or
+ * op(A)^H for herk, of the lower or the upper triangle of C, with the types of A, of C and of the
+ * computation chosen as for gemm_ex, e.g. half or bfloat16 A accumulated in a float C.
+ *
+ * The columns of C are cut in diagonal blocks of hipblas_syrk_ex_block columns, and the triangle
+ * is split recursively: the two halves of the blocks are triangles of their own, the rectangle
+ * between them is one gemm_ex, so most of the work runs in large gemm_ex calls and none of it in
+ * the other triangle, apart from the diagonal blocks. Those are computed whole by one strided
+ * batched gemm_ex into a scratch in the type of C, starting from a copy of the whole blocks so
+ * that beta applies, and their triangle is copied back into C, batched over the blocks or over
+ * the instances. The triangle of a block without its diagonal is split like the triangle of C,
+ * into rectangles between halves, each shape of rectangle one geamBatched over arrays of
+ * pointers to all of them, and the diagonal is one strided copy, so a few calls copy any number
+ * of blocks. In HIPBLAS_CAPTURE_MODE_SAFE, where the arrays cannot be uploaded, and when the
+ * backend declines the upload, the triangle is copied one column at a time. Only the triangle of
+ * C is written; the other triangle of the diagonal blocks is read into the scratch and dropped
+ * there. For herk the imaginary parts of the diagonal are set to zero last.
+ *
+ * C is float, double, float complex or double complex, in which gemm_ex computes too, so alpha
+ * and beta are of that type; for herk they are real. The scratch and the upload of the arrays of
+ * pointers are supplied by the caller.
+ */
+
+/*! \brief  Columns of the diagonal blocks computed whole */
+constexpr int hipblas_syrk_ex_block = 64;
+
+/*! \brief  Bytes of an element of type, 0 for a type that is not known */
+inline size_t hipblas_datatype_size(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    }
+    return 0;
+}
+
+/*! \brief  Argument check of syrk_ex and herk_ex, shared by their batched forms */
+inline hipblasStatus_t hipblas_syrk_ex_arguments(hipblasHandle_t    handle,
+                                                 hipblasFillMode_t  uplo,
+                                                 hipblasOperation_t trans,
+                                                 int                n,
+                                                 int                k,
+                                                 hipblasDatatype_t  a_type,
+                                                 int                lda,
+                                                 hipblasDatatype_t  c_type,
+                                                 int                ldc,
+                                                 int                batch_count,
+                                                 hipblasDatatype_t  compute_type,
+                                                 bool               hermitian)
+{
+    bool real    = c_type == HIPBLAS_R_32F || c_type == HIPBLAS_R_64F;
+    bool complex = c_type == HIPBLAS_C_32F || c_type == HIPBLAS_C_64F;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if((uplo != HIPBLAS_FILL_MODE_LOWER && uplo != HIPBLAS_FILL_MODE_UPPER)
+       || (trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(compute_type != c_type || !(complex || (real && !hermitian))
+       || !hipblas_datatype_size(a_type))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    // conjugation is for herk, plain transposition for syrk, both are the same on real C
+    if((complex && trans == (hermitian ? HIPBLAS_OP_T : HIPBLAS_OP_C)) || n < 0 || k < 0
+       || lda < std::max(1, trans == HIPBLAS_OP_N ? n : k) || ldc < std::max(1, n)
+       || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/*! \brief  syrk_ex or herk_ex of batch_count instances, A_b = A + b * stride_A and C likewise, on
+            C of type T. workspace(bytes) returns device memory of at least bytes, valid for the
+            work queued on the stream of handle until the next request; it is requested once.
+            upload(count, arrays) copies host arrays of count pointers to the device together,
+            and returns them count apart, or returns nullptr for a backend without a native
+            geamBatched, which then copies the triangle one column at a time. Arguments are
+            checked by the caller.
+            Throws hipblasStatus_t */
+template <typename T, typename Workspace, typename Upload>
+hipblasStatus_t hipblas_syrk_ex_typed(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t trans,
+                                      int                n,
+                                      int                k,
+                                      const void*        alpha,
+                                      const char*        A,
+                                      hipblasDatatype_t  a_type,
+                                      int                lda,
+                                      hipblasStride      stride_A,
+                                      const void*        beta,
+                                      T*                 C,
+                                      hipblasDatatype_t  c_type,
+                                      int                ldc,
+                                      hipblasStride      stride_C,
+                                      int                batch_count,
+                                      bool               hermitian,
+                                      Workspace          workspace,
+                                      Upload             upload)
+{
+    using routines = hipblas_routines<T>;
+    using Real     = typename routines::real_t;
+
+    // scratch of the diagonal blocks of a group of instances beyond which they are split
+    const size_t hipblas_syrk_ex_group_bytes = size_t(1) << 28;
+
+    const int  nb     = hipblas_syrk_ex_block;
+    const bool lower  = uplo == HIPBLAS_FILL_MODE_LOWER;
+    int        blocks = (n + nb - 1) / nb;
+    size_t     a_size = hipblas_datatype_size(a_type);
+
+    // op(A) * op(A)^T is op_a(A) * op_b(A), row i of op(A) starts at a_row(i)
+    hipblasOperation_t op_a = trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : trans;
+    hipblasOperation_t op_b
+        = trans != HIPBLAS_OP_N ? HIPBLAS_OP_N : hermitian ? HIPBLAS_OP_C : HIPBLAS_OP_T;
+    hipblasStride a_step = trans == HIPBLAS_OP_N ? 1 : lda;
+    auto          a_row  = [&](int i) { return A ? A + i * a_step * a_size : A; };
+
+    // The diagonal blocks are batched over the blocks of one instance, or over the instances
+    int    items = batch_count == 1 ? blocks : batch_count;
+    size_t block = size_t(nb) * nb;
+    int    group = int(std::min(std::max(hipblas_syrk_ex_group_bytes / (block * sizeof(T)),
+                                      size_t(1)),
+                             size_t(items)));
+
+    // Scalars first: alpha and beta of herk as T, and a zero
+    hipblasCaptureMode_t capture_mode;
+    if(hipblasGetCaptureMode(handle, &capture_mode) != HIPBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    char* scratch = static_cast<char*>(workspace(4 * sizeof(T) + block * group * sizeof(T)));
+    T*    scalars = reinterpret_cast<T*>(scratch);
+    T*    S       = scalars + 4;
+
+    T alpha_h{}, beta_h{};
+    if(hermitian)
+    {
+        hipStream_t stream;
+        hipError_t  error = hipSuccess;
+        if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        error = hipMemsetAsync(scalars, 0, 3 * sizeof(T), stream);
+        if(hipblas_pointer_mode(handle) == HIPBLAS_POINTER_MODE_HOST)
+        {
+            *reinterpret_cast<Real*>(&alpha_h) = *static_cast<const Real*>(alpha);
+            *reinterpret_cast<Real*>(&beta_h)  = *static_cast<const Real*>(beta);
+            alpha                              = &alpha_h;
+            beta                               = &beta_h;
+        }
+        else
+        {
+            if(error == hipSuccess)
+                error = hipMemcpyAsync(
+                    scalars, alpha, sizeof(Real), hipMemcpyDeviceToDevice, stream);
+            if(error == hipSuccess)
+                error = hipMemcpyAsync(
+                    scalars + 1, beta, sizeof(Real), hipMemcpyDeviceToDevice, stream);
+            alpha = scalars;
+            beta  = scalars + 1;
+        }
+        if(error != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // C(i0 : i1, j0 : j1) of every instance from rows i0 : i1 and j0 : j1 of op(A)
+    auto rectangle = [&](int i0, int i1, int j0, int j1) {
+        return hipblasGemmStridedBatchedEx(handle,
+                                           op_a,
+                                           op_b,
+                                           i1 - i0,
+                                           j1 - j0,
+                                           k,
+                                           alpha,
+                                           a_row(i0),
+                                           a_type,
+                                           lda,
+                                           stride_A,
+                                           a_row(j0),
+                                           a_type,
+                                           lda,
+                                           stride_A,
+                                           beta,
+                                           C + i0 + size_t(j0) * ldc,
+                                           c_type,
+                                           ldc,
+                                           stride_C,
+                                           batch_count,
+                                           c_type,
+                                           HIPBLAS_GEMM_DEFAULT);
+    };
+
+    // The triangle of the size columns of the count diagonal blocks at C0 + i * c_step, through
+    // the scratch. op(A) of block i starts at A0 + i * a_item elements of A
+    auto diagonal = [&](int           size,
+                        const char*   A0,
+                        hipblasStride a_item,
+                        T*            C0,
+                        hipblasStride c_step,
+                        int           count) {
+        hipblasStride   s_step = hipblasStride(size) * size;
+        hipblasStatus_t status;
+        {
+            hipblas_host_pointer_mode constants(handle);
+            T                         one{}, zero{};
+            *reinterpret_cast<Real*>(&one) = 1;
+
+            status = routines::geam_strided_batched(handle,
+                                                    HIPBLAS_OP_N,
+                                                    HIPBLAS_OP_N,
+                                                    size,
+                                                    size,
+                                                    &one,
+                                                    C0,
+                                                    ldc,
+                                                    c_step,
+                                                    &zero,
+                                                    S,
+                                                    size,
+                                                    s_step,
+                                                    S,
+                                                    size,
+                                                    s_step,
+                                                    count);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGemmStridedBatchedEx(handle,
+                                                 op_a,
+                                                 op_b,
+                                                 size,
+                                                 size,
+                                                 k,
+                                                 alpha,
+                                                 A0,
+                                                 a_type,
+                                                 lda,
+                                                 a_item,
+                                                 A0,
+                                                 a_type,
+                                                 lda,
+                                                 a_item,
+                                                 beta,
+                                                 S,
+                                                 c_type,
+                                                 size,
+                                                 s_step,
+                                                 count,
+                                                 c_type,
+                                                 HIPBLAS_GEMM_DEFAULT);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Rectangles (row, column) of the triangle of a block, grouped by shape (rows, columns)
+        std::map<std::pair<int, int>, std::vector<std::pair<int, int>>> shapes;
+        std::vector<std::pair<int, int>>                                 halves{{0, size}};
+        while(!halves.empty())
+        {
+            int first = halves.back().first, length = halves.back().second, h = length / 2;
+            halves.pop_back();
+            if(length < 2)
+                continue;
+            if(lower)
+                shapes[{length - h, h}].push_back({first + h, first});
+            else
+                shapes[{h, length - h}].push_back({first, first + h});
+            halves.push_back({first, h});
+            halves.push_back({first + h, length - h});
+        }
+
+        std::vector<const void*> from, to;
+        for(const auto& shape : shapes)
+            for(int i = 0; i < count; i++)
+                for(const std::pair<int, int>& at : shape.second)
+                {
+                    from.push_back(S + i * s_step + at.first + size_t(at.second) * size);
+                    to.push_back(C0 + i * c_step + at.first + size_t(at.second) * ldc);
+                }
+
+        int          total  = int(from.size());
+        void* const* arrays
+            = capture_mode == HIPBLAS_CAPTURE_MODE_SAFE ? nullptr
+                                                        : upload(total, {from.data(), to.data()});
+        if(!arrays)
+        {
+            for(int j = 0; j < size && status == HIPBLAS_STATUS_SUCCESS; j++)
+            {
+                int first = lower ? j : 0;
+                status    = routines::copy_strided_batched(handle,
+                                                        lower ? size - j : j + 1,
+                                                        S + first + size_t(j) * size,
+                                                        1,
+                                                        s_step,
+                                                        C0 + first + size_t(j) * ldc,
+                                                        1,
+                                                        c_step,
+                                                        count);
+            }
+            return status;
+        }
+        auto         source = reinterpret_cast<const T* const*>(arrays);
+        auto         target = reinterpret_cast<T* const*>(arrays) + total;
+        {
+            hipblas_host_pointer_mode constants(handle);
+            T                         one{}, zero{};
+            *reinterpret_cast<Real*>(&one) = 1;
+
+            int offset = 0;
+            for(const auto& shape : shapes)
+            {
+                int rectangles = count * int(shape.second.size());
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = routines::geam_batched(handle,
+                                                    HIPBLAS_OP_N,
+                                                    HIPBLAS_OP_N,
+                                                    shape.first.first,
+                                                    shape.first.second,
+                                                    &one,
+                                                    source + offset,
+                                                    size,
+                                                    &zero,
+                                                    source + offset,
+                                                    size,
+                                                    target + offset,
+                                                    ldc,
+                                                    rectangles);
+                offset += rectangles;
+            }
+        }
+
+        // the diagonals of all the blocks
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = routines::copy_strided_batched(
+                handle, size, S, size + 1, s_step, C0, ldc + 1, c_step, count);
+        return status;
+    };
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Rectangles between the halves of the blocks b0 : b0 + count, largest first
+    std::vector<std::pair<int, int>> halves{{0, blocks}};
+    while(!halves.empty() && status == HIPBLAS_STATUS_SUCCESS)
+    {
+        int b0 = halves.back().first, count = halves.back().second;
+        halves.pop_back();
+        if(count < 2)
+            continue;
+
+        int h = count / 2;
+        int c0 = b0 * nb, c1 = (b0 + h) * nb, c2 = std::min(n, (b0 + count) * nb);
+        status = lower ? rectangle(c1, c2, c0, c1) : rectangle(c0, c1, c1, c2);
+        halves.push_back({b0, h});
+        halves.push_back({b0 + h, count - h});
+    }
+
+    // Diagonal blocks of nb columns, then the last one of n % nb
+    int full = n / nb, last = n % nb;
+    if(batch_count == 1)
+    {
+        hipblasStride a_item = nb * a_step, c_step = hipblasStride(nb) * (ldc + 1);
+        for(int b0 = 0; b0 < full && status == HIPBLAS_STATUS_SUCCESS; b0 += group)
+            status = diagonal(nb,
+                              a_row(b0 * nb),
+                              a_item,
+                              C + b0 * c_step,
+                              c_step,
+                              std::min(group, full - b0));
+        if(last && status == HIPBLAS_STATUS_SUCCESS)
+            status = diagonal(last, a_row(full * nb), 0, C + full * c_step, 0, 1);
+    }
+    else
+    {
+        for(int j = 0; j < blocks && status == HIPBLAS_STATUS_SUCCESS; j++)
+        {
+            int size = std::min(nb, n - j * nb);
+            for(int b0 = 0; b0 < batch_count && status == HIPBLAS_STATUS_SUCCESS; b0 += group)
+                status = diagonal(size,
+                                  a_row(j * nb) + (A ? b0 * stride_A * a_size : 0),
+                                  stride_A,
+                                  C + size_t(j) * nb * (ldc + 1) + b0 * stride_C,
+                                  stride_C,
+                                  std::min(group, batch_count - b0));
+        }
+    }
+
+    // Im C(i, i) = 0, from the zero among the scalars
+    if(hermitian && status == HIPBLAS_STATUS_SUCCESS)
+    {
+        status = hipblas_routines<Real>::copy_strided_batched(
+            handle,
+            n,
+            reinterpret_cast<const Real*>(scalars + 2),
+            0,
+            hipblasStride(0),
+            reinterpret_cast<Real*>(C) + 1,
+            2 * (ldc + 1),
+            2 * stride_C,
+            batch_count);
+    }
+    return status;
+}
+
+/*! \brief  syrk_ex or herk_ex of batch_count instances, A_b = A + b * stride_A and C likewise,
+            dispatched on the type of C. Throws hipblasStatus_t */
+template <typename Workspace, typename Upload>
+hipblasStatus_t hipblas_syrk_ex_strided_batched(hipblasHandle_t    handle,
+                                                hipblasFillMode_t  uplo,
+                                                hipblasOperation_t trans,
+                                                int                n,
+                                                int                k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                hipblasDatatype_t  a_type,
+                                                int                lda,
+                                                hipblasStride      stride_A,
+                                                const void*        beta,
+                                                void*              C,
+                                                hipblasDatatype_t  c_type,
+                                                int                ldc,
+                                                hipblasStride      stride_C,
+                                                int                batch_count,
+                                                hipblasDatatype_t  compute_type,
+                                                bool               hermitian,
+                                                Workspace          workspace,
+                                                Upload             upload)
+{
+    hipblasStatus_t status = hipblas_syrk_ex_arguments(
+        handle, uplo, trans, n, k, a_type, lda, c_type, ldc, batch_count, compute_type, hermitian);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batch_count)
+        return status;
+    if(!alpha || !beta || !C || (k && !A))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    const char* a = static_cast<const char*>(A);
+    switch(c_type)
+    {
+    case HIPBLAS_R_32F:
+        return hipblas_syrk_ex_typed(handle,
+                                     uplo,
+                                     trans,
+                                     n,
+                                     k,
+                                     alpha,
+                                     a,
+                                     a_type,
+                                     lda,
+                                     stride_A,
+                                     beta,
+                                     static_cast<float*>(C),
+                                     c_type,
+                                     ldc,
+                                     stride_C,
+                                     batch_count,
+                                     hermitian,
+                                     workspace,
+                                     upload);
+    case HIPBLAS_R_64F:
+        return hipblas_syrk_ex_typed(handle,
+                                     uplo,
+                                     trans,
+                                     n,
+                                     k,
+                                     alpha,
+                                     a,
+                                     a_type,
+                                     lda,
+                                     stride_A,
+                                     beta,
+                                     static_cast<double*>(C),
+                                     c_type,
+                                     ldc,
+                                     stride_C,
+                                     batch_count,
+                                     hermitian,
+                                     workspace,
+                                     upload);
+    case HIPBLAS_C_32F:
+        return hipblas_syrk_ex_typed(handle,
+                                     uplo,
+                                     trans,
+                                     n,
+                                     k,
+                                     alpha,
+                                     a,
+                                     a_type,
+                                     lda,
+                                     stride_A,
+                                     beta,
+                                     static_cast<hipblasComplex*>(C),
+                                     c_type,
+                                     ldc,
+                                     stride_C,
+                                     batch_count,
+                                     hermitian,
+                                     workspace,
+                                     upload);
+    default:
+        return hipblas_syrk_ex_typed(handle,
+                                     uplo,
+                                     trans,
+                                     n,
+                                     k,
+                                     alpha,
+                                     a,
+                                     a_type,
+                                     lda,
+                                     stride_A,
+                                     beta,
+                                     static_cast<hipblasDoubleComplex*>(C),
+                                     c_type,
+                                     ldc,
+                                     stride_C,
+                                     batch_count,
+                                     hermitian,
+                                     workspace,
+                                     upload);
+    }
+}
+
+/*! \brief  syrk_ex or herk_ex on arrays of batch_count pointers in device memory, which
+            pointers(array) reads back to the host. Evenly spaced instances run as the strided
+            batched form, others one at a time. Throws hipblasStatus_t */
+template <typename Pointers, typename Workspace, typename Upload>
+hipblasStatus_t hipblas_syrk_ex_batched(hipblasHandle_t    handle,
+                                        hipblasFillMode_t  uplo,
+                                        hipblasOperation_t trans,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void* const  A[],
+                                        hipblasDatatype_t  a_type,
+                                        int                lda,
+                                        const void*        beta,
+                                        void* const        C[],
+                                        hipblasDatatype_t  c_type,
+                                        int                ldc,
+                                        int                batch_count,
+                                        hipblasDatatype_t  compute_type,
+                                        bool               hermitian,
+                                        Pointers           pointers,
+                                        Workspace          workspace,
+                                        Upload             upload)
+{
+    hipblasStatus_t status = hipblas_syrk_ex_arguments(
+        handle, uplo, trans, n, k, a_type, lda, c_type, ldc, batch_count, compute_type, hermitian);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batch_count)
+        return status;
+
+    // Without k the instances of A are not read, nor their pointers
+    std::vector<const char*> a = k ? pointers(reinterpret_cast<const char* const*>(A))
+                                   : std::vector<const char*>(batch_count);
+    std::vector<char*>       c = pointers(reinterpret_cast<char* const*>(C));
+
+    size_t        a_size = hipblas_datatype_size(a_type), c_size = hipblas_datatype_size(c_type);
+    hipblasStride stride_A, stride_C;
+    if(hipblas_uniform_stride(a.data(), batch_count, &stride_A) && stride_A % a_size == 0
+       && hipblas_uniform_stride(c.data(), batch_count, &stride_C) && stride_C % c_size == 0)
+        return hipblas_syrk_ex_strided_batched(handle,
+                                               uplo,
+                                               trans,
+                                               n,
+                                               k,
+                                               alpha,
+                                               a[0],
+                                               a_type,
+                                               lda,
+                                               stride_A / a_size,
+                                               beta,
+                                               c[0],
+                                               c_type,
+                                               ldc,
+                                               stride_C / c_size,
+                                               batch_count,
+                                               compute_type,
+                                               hermitian,
+                                               workspace,
+                                               upload);
+
+    for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+        status = hipblas_syrk_ex_strided_batched(handle,
+                                                 uplo,
+                                                 trans,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 a[b],
+                                                 a_type,
+                                                 lda,
+                                                 0,
+                                                 beta,
+                                                 c[b],
+                                                 c_type,
+                                                 ldc,
+                                                 0,
+                                                 1,
+                                                 compute_type,
+                                                 hermitian,
+                                                 workspace,
+                                                 upload);
+    return status;
+}
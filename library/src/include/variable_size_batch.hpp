@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright 2021 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "hipblas_routines.hpp"
+#include "host_pointer_arrays.hpp"
+#include <algorithm>
+#include <initializer_list>
+#include <map>
+#include <tuple>
+#include <vector>
+
+/*!\file
+ * \brief Support of the variable size batched routines (Vbatched), whose instances each have
+ * their own sizes. Instances of one shape are gathered so that they are issued together as a
+ * batched routine of uniform size, which runs many small instances per launch, rather than as one
+ * call per instance. The upload of the arrays of pointers is supplied by the backend.
+ */
+
+/*! \brief  Indices of the batch_count instances grouped by key_of(b), the shape of instance b,
+            which must be ordered by operator<. Every group lists its instances in batch order;
+            the groups are sorted by decreasing size, and groups of equal size by the first
+            instance of the group, so the largest batched call is issued first.  */
+template <typename KeyOf>
+std::vector<std::vector<int>> hipblas_shape_groups(int batch_count, KeyOf key_of)
+{
+    std::map<decltype(key_of(0)), size_t> group_of;
+    std::vector<std::vector<int>>         groups;
+    for(int b = 0; b < batch_count; b++)
+    {
+        auto entry = group_of.emplace(key_of(b), groups.size());
+        if(entry.second)
+            groups.emplace_back();
+        groups[entry.first->second].push_back(b);
+    }
+
+    std::stable_sort(groups.begin(),
+                     groups.end(),
+                     [](const std::vector<int>& a, const std::vector<int>& b) {
+                         return a.size() > b.size();
+                     });
+    return groups;
+}
+
+/*! \brief  gemv of batch_count instances with sizes of their own, one call per shape. A shape
+            with a single instance is gemv, and a shape whose instances are evenly spaced, or
+            for which batched(m, n, incx, incy) is false, the HostPtrs form of the batched
+            routine. The arrays of pointers of the other shapes are copied to the device
+            together by upload(count, {A, x, y}), which returns the three device arrays count
+            apart, and each of these shapes is the batched routine on its part of them.  */
+template <typename T, typename Batched, typename Upload>
+hipblasStatus_t hipblas_gemv_vbatched(hipblasHandle_t    handle,
+                                      hipblasOperation_t trans,
+                                      const int*         m,
+                                      const int*         n,
+                                      const T*           alpha,
+                                      const T* const*    A,
+                                      const int*         lda,
+                                      const T* const*    x,
+                                      const int*         incx,
+                                      const T*           beta,
+                                      T* const*          y,
+                                      const int*         incy,
+                                      int                batch_count,
+                                      Batched            batched,
+                                      Upload             upload)
+{
+    using routines = hipblas_routines<T>;
+
+    if(!handle)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!batch_count)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!m || !n || !lda || !incx || !incy || !A || !x || !y)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // nothing is issued unless every instance is valid
+    for(int b = 0; b < batch_count; b++)
+        if(m[b] < 0 || n[b] < 0 || lda[b] < std::max(1, m[b]) || !incx[b] || !incy[b])
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+    auto groups = hipblas_shape_groups(batch_count, [&](int b) {
+        return std::make_tuple(m[b], n[b], lda[b], incx[b], incy[b]);
+    });
+
+    enum class path
+    {
+        none,
+        single,
+        host_ptrs,
+        device_ptrs
+    };
+
+    // the arrays of pointers in the order of the groups, so every group is a contiguous part
+    std::vector<const T*> A_all, x_all;
+    std::vector<T*>       y_all;
+    std::vector<path>     paths;
+    A_all.reserve(batch_count);
+    x_all.reserve(batch_count);
+    y_all.reserve(batch_count);
+    for(const std::vector<int>& group : groups)
+    {
+        size_t first = A_all.size();
+        int    count = int(group.size());
+        for(int i : group)
+        {
+            A_all.push_back(A[i]);
+            x_all.push_back(x[i]);
+            y_all.push_back(y[i]);
+        }
+
+        // every instance of the group has the sizes of the first one
+        int           b = group[0];
+        hipblasStride stride;
+
+        // empty instances are quick returns of gemv, which leave y unchanged
+        if(!m[b] || !n[b])
+            paths.push_back(path::none);
+        else if(count == 1)
+            paths.push_back(path::single);
+        else if(!batched(m[b], n[b], incx[b], incy[b])
+                || (hipblas_uniform_stride(&A_all[first], count, &stride)
+                    && hipblas_uniform_stride(&x_all[first], count, &stride)
+                    && hipblas_uniform_stride(&y_all[first], count, &stride)))
+            paths.push_back(path::host_ptrs);
+        else
+            paths.push_back(path::device_ptrs);
+    }
+
+    // one upload serves every group issued on the device arrays
+    void* const* arrays = nullptr;
+    if(std::find(paths.begin(), paths.end(), path::device_ptrs) != paths.end())
+        arrays = upload(batch_count,
+                        {(const void* const*)A_all.data(),
+                         (const void* const*)x_all.data(),
+                         (const void* const*)y_all.data()});
+
+    size_t first = 0;
+    for(size_t g = 0; g < groups.size(); first += groups[g++].size())
+    {
+        int             b      = groups[g][0];
+        int             count  = int(groups[g].size());
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        switch(paths[g])
+        {
+        case path::none:
+            break;
+        case path::single:
+            status = routines::gemv(handle,
+                                    trans,
+                                    m[b],
+                                    n[b],
+                                    alpha,
+                                    A[b],
+                                    lda[b],
+                                    x[b],
+                                    incx[b],
+                                    beta,
+                                    y[b],
+                                    incy[b]);
+            break;
+        case path::host_ptrs:
+            status = routines::gemv_batched_host_ptrs(handle,
+                                                      trans,
+                                                      m[b],
+                                                      n[b],
+                                                      alpha,
+                                                      &A_all[first],
+                                                      lda[b],
+                                                      &x_all[first],
+                                                      incx[b],
+                                                      beta,
+                                                      &y_all[first],
+                                                      incy[b],
+                                                      count);
+            break;
+        case path::device_ptrs:
+            status = routines::gemv_batched(handle,
+                                            trans,
+                                            m[b],
+                                            n[b],
+                                            alpha,
+                                            (const T* const*)arrays + first,
+                                            lda[b],
+                                            (const T* const*)(arrays + batch_count) + first,
+                                            incx[b],
+                                            beta,
+                                            (T* const*)(arrays + 2 * batch_count) + first,
+                                            incy[b],
+                                            count);
+            break;
+        }
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
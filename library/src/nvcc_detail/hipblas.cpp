@@ -3,7 +3,12 @@
  * ************************************************************************ */
 
 #include "hipblas.h"
+#include "batched_emulation.hpp"
 #include "exceptions.hpp"
+#include "host_pointer_arrays.hpp"
+#include "storage_conversion.hpp"
+#include "syrk_ex.hpp"
+#include "variable_size_batch.hpp"
 #include <cublas.h>
 #include <cublas_v2.h>
 #include <cuda_runtime_api.h>
@@ -263,9 +268,159 @@ hipblasStatus_t hipCUBLASStatusToHIPStatus(cublasStatus_t cuStatus)
     }
 }
 
+hipblasStatus_t hipCUDAErrorToHIPStatus(cudaError_t cuError)
+{
+    switch(cuError)
+    {
+    case cudaSuccess:
+        return HIPBLAS_STATUS_SUCCESS;
+    case cudaErrorMemoryAllocation:
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    case cudaErrorInvalidValue:
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    default:
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// Stream and memory primitives of the emulation of batched routines, see batched_emulation.hpp
+struct hipblas_cuda_backend
+{
+    using stream_t = cudaStream_t;
+    using event_t  = cudaEvent_t;
+
+    static hipblasStatus_t get_stream(hipblasHandle_t handle, cudaStream_t* stream)
+    {
+        return hipCUBLASStatusToHIPStatus(cublasGetStream((cublasHandle_t)handle, stream));
+    }
+
+    static hipblasStatus_t set_stream(hipblasHandle_t handle, cudaStream_t stream)
+    {
+        return hipCUBLASStatusToHIPStatus(cublasSetStream((cublasHandle_t)handle, stream));
+    }
+
+    static hipblasStatus_t create_stream(cudaStream_t* stream)
+    {
+        return hipCUDAErrorToHIPStatus(cudaStreamCreateWithFlags(stream, cudaStreamNonBlocking));
+    }
+
+    static hipblasStatus_t destroy_stream(cudaStream_t stream)
+    {
+        return hipCUDAErrorToHIPStatus(cudaStreamDestroy(stream));
+    }
+
+    static hipblasStatus_t create_event(cudaEvent_t* event)
+    {
+        return hipCUDAErrorToHIPStatus(cudaEventCreateWithFlags(event, cudaEventDisableTiming));
+    }
+
+    static hipblasStatus_t destroy_event(cudaEvent_t event)
+    {
+        return hipCUDAErrorToHIPStatus(cudaEventDestroy(event));
+    }
+
+    static hipblasStatus_t record_event(cudaEvent_t event, cudaStream_t stream)
+    {
+        return hipCUDAErrorToHIPStatus(cudaEventRecord(event, stream));
+    }
+
+    static hipblasStatus_t wait_event(cudaStream_t stream, cudaEvent_t event)
+    {
+        return hipCUDAErrorToHIPStatus(cudaStreamWaitEvent(stream, event, 0));
+    }
+
+    static hipblasStatus_t synchronize(cudaStream_t stream)
+    {
+        return hipCUDAErrorToHIPStatus(cudaStreamSynchronize(stream));
+    }
+
+    static hipblasStatus_t device_malloc(void** ptr, size_t bytes)
+    {
+        return hipCUDAErrorToHIPStatus(cudaMalloc(ptr, bytes));
+    }
+
+    static hipblasStatus_t device_free(void* ptr)
+    {
+        return hipCUDAErrorToHIPStatus(cudaFree(ptr));
+    }
+
+    static hipblasStatus_t
+        copy_to_host(void* dst, const void* src, size_t bytes, cudaStream_t stream)
+    {
+        cudaError_t err = cudaMemcpyAsync(dst, src, bytes, cudaMemcpyDeviceToHost, stream);
+        return hipCUDAErrorToHIPStatus(err == cudaSuccess ? cudaStreamSynchronize(stream) : err);
+    }
+
+    // from pageable memory the copy is staged before cudaMemcpyAsync returns
+    static hipblasStatus_t
+        copy_to_device(void* dst, const void* src, size_t bytes, cudaStream_t stream)
+    {
+        return hipCUDAErrorToHIPStatus(
+            cudaMemcpyAsync(dst, src, bytes, cudaMemcpyHostToDevice, stream));
+    }
+
+    static hipblasStatus_t host_malloc(void** ptr, size_t bytes)
+    {
+        return hipCUDAErrorToHIPStatus(cudaMallocHost(ptr, bytes));
+    }
+
+    static hipblasStatus_t host_free(void* ptr)
+    {
+        return hipCUDAErrorToHIPStatus(cudaFreeHost(ptr));
+    }
+
+    static hipblasStatus_t
+        copy_to_host_async(void* dst, const void* src, size_t bytes, cudaStream_t stream)
+    {
+        return hipCUDAErrorToHIPStatus(
+            cudaMemcpyAsync(dst, src, bytes, cudaMemcpyDeviceToHost, stream));
+    }
+
+    static hipblasStatus_t launch_host_func(cudaStream_t stream, void (*fn)(void*), void* data)
+    {
+        return hipCUDAErrorToHIPStatus(cudaLaunchHostFunc(stream, fn, data));
+    }
+};
+
+using batched_emulation = hipblas_batched_emulation<hipblas_cuda_backend>;
+
+#ifdef __cplusplus
+}
+#endif
+
+void* hipblas_scratch(hipblasHandle_t handle, size_t bytes)
+{
+    return batched_emulation::scratch(handle, bytes);
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// cuBLAS has no batched gemv, but a gemv whose vectors have positive increments is the gemm of a
+// single row, y^T = alpha * x^T * op(A)^T + beta * y^T, with x and y read as 1-row matrices of
+// leading dimension incx and incy. cuBLAS runs a batch of those as one launch that packs many
+// small instances together, instead of one gemv launch per instance. Empty instances keep the
+// quick return of gemv, which leaves y unscaled, and A^H has no single-row gemm form.
+static bool gemv_as_gemm(hipblasOperation_t trans, int m, int n, int incx, int incy, bool complex)
+{
+    return m > 0 && n > 0 && incx > 0 && incy > 0 && !(complex && trans == HIPBLAS_OP_C);
+}
+
+// Operation applied to A in the gemm of gemv_as_gemm
+static cublasOperation_t gemv_as_gemm_op(hipblasOperation_t trans)
+{
+    if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+        throw HIPBLAS_STATUS_INVALID_ENUM;
+    return trans == HIPBLAS_OP_N ? CUBLAS_OP_T : CUBLAS_OP_N;
+}
+
 hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId)
 try
 {
+    hipblasStatus_t status = batched_emulation::join_lanes(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
     return hipCUBLASStatusToHIPStatus(cublasSetStream((cublasHandle_t)handle, streamId));
 }
 catch(...)
@@ -297,6 +452,7 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    batched_emulation::release(handle);
     return hipCUBLASStatusToHIPStatus(cublasDestroy((cublasHandle_t)handle));
 }
 catch(...)
@@ -445,6 +601,140 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+// cuBLAS manages the capture of its own calls; only the emulated batched functions are restricted
+hipblasStatus_t hipblasSetCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::set_capture_mode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetCaptureMode(hipblasHandle_t handle, hipblasCaptureMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = batched_emulation::capture_mode(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetBatchedInfoMode(hipblasHandle_t handle, hipblasBatchedInfoMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::set_batched_info_mode(handle, mode);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetBatchedInfoMode(hipblasHandle_t handle, hipblasBatchedInfoMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *mode = batched_emulation::batched_info_mode(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetBatchedInfoSummaryAsync(hipblasHandle_t              handle,
+                                                  hipblasBatchedInfoSummary_t* summary,
+                                                  int                          reset)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::read_summary_async(handle, summary, reset != 0);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetStreamPool(hipblasHandle_t handle, int n)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::set_stream_pool(handle, n);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasGetStreamPool(hipblasHandle_t handle, int* n)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    *n = batched_emulation::stream_pool_size(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSetStreamLane(hipblasHandle_t handle, int lane)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    batched_emulation::select_lane(handle, lane);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasJoinStreams(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    return batched_emulation::join_lanes(handle);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // amax
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
@@ -493,14 +783,30 @@ catch(...)
 // amax_batched
 hipblasStatus_t hipblasIsamaxBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIsamax(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdamaxBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIdamax(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
@@ -509,8 +815,16 @@ hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIcamax(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
@@ -519,8 +833,16 @@ hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      int*                              result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIzamax(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // amax_strided_batched
@@ -531,8 +853,15 @@ hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIsamax(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
@@ -542,8 +871,15 @@ hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIdamax(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
@@ -553,8 +889,15 @@ hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             int*                  result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIcamax(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
@@ -564,8 +907,15 @@ hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIzamax(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // amin
@@ -616,14 +966,30 @@ catch(...)
 // amin_batched
 hipblasStatus_t hipblasIsaminBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIsamin(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdaminBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIdamin(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
@@ -632,8 +998,16 @@ hipblasStatus_t hipblasIcaminBatched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIcamin(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
@@ -642,8 +1016,16 @@ hipblasStatus_t hipblasIzaminBatched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      int*                              result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIzamin(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // amin_strided_batched
@@ -654,8 +1036,15 @@ hipblasStatus_t hipblasIsaminStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIsamin(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
@@ -665,10 +1054,17 @@ hipblasStatus_t hipblasIdaminStridedBatched(hipblasHandle_t handle,
                                             hipblasStride   stridex,
                                             int             batchCount,
                                             int*            result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIdamin(handle, n, x + b * stridex, incx, result + b);
+    });
 }
-
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* x,
@@ -676,8 +1072,15 @@ hipblasStatus_t hipblasIcaminStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             int*                  result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIcamin(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
@@ -687,8 +1090,15 @@ hipblasStatus_t hipblasIzaminStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             int*                        result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasIzamin(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // ASUM
@@ -742,9 +1152,10 @@ hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(cublasSasum((cublasHandle_t)handle, n, x, incx, result));
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSasum(handle, n, x_batch[b], incx, result + b);
+    });
 }
 catch(...)
 {
@@ -757,8 +1168,16 @@ hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batchCount,
                                     double*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDasum(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
@@ -767,8 +1186,16 @@ hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      float*                      result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasScasum(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
@@ -777,8 +1204,16 @@ hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      double*                           result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDzasum(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // asum_strided_batched
@@ -789,8 +1224,15 @@ hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            float*          result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSasum(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
@@ -800,8 +1242,15 @@ hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            double*         result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDasum(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
@@ -811,8 +1260,15 @@ hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             float*                result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasScasum(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
@@ -822,8 +1278,15 @@ hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             double*                     result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDzasum(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // axpy
@@ -929,10 +1392,11 @@ hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(
-    //     cublasSaxpy((cublasHandle_t)handle, n, alpha, x, incx, y, incy));
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSaxpy(handle, n, alpha, x_batch[b], incx, y_batch[b], incy);
+    });
 }
 catch(...)
 {
@@ -947,8 +1411,17 @@ hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                     double* const       y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDaxpy(handle, n, alpha, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
@@ -959,8 +1432,17 @@ hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCaxpy(handle, n, alpha, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
@@ -971,8 +1453,17 @@ hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZaxpy(handle, n, alpha, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // axpy_strided_batched
@@ -1000,8 +1491,15 @@ hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSaxpy(handle, n, alpha, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
@@ -1014,8 +1512,15 @@ hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDaxpy(handle, n, alpha, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
@@ -1028,8 +1533,15 @@ hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCaxpy(handle, n, alpha, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
@@ -1042,8 +1554,15 @@ hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZaxpy(handle, n, alpha, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // copy
@@ -1105,8 +1624,17 @@ hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                     float* const       y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasScopy(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
@@ -1116,8 +1644,17 @@ hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                     double* const       y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDcopy(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
@@ -1127,8 +1664,17 @@ hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCcopy(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
@@ -1138,8 +1684,17 @@ hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZcopy(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // copy_strided_batched
@@ -1152,8 +1707,15 @@ hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasScopy(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
@@ -1165,8 +1727,15 @@ hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDcopy(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
@@ -1178,8 +1747,15 @@ hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCcopy(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
@@ -1191,8 +1767,15 @@ hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZcopy(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // dot
@@ -1373,10 +1956,11 @@ hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                    float*             result)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(
-    //     cublasSdot((cublasHandle_t)handle, n, x, incx, y, incy, result));
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSdot(handle, n, x_batch[b], incx, y_batch[b], incy, result + b);
+    });
 }
 catch(...)
 {
@@ -1391,8 +1975,17 @@ hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                    int                 incy,
                                    int                 batchCount,
                                    double*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDdot(handle, n, x_batch[b], incx, y_batch[b], incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
@@ -1403,8 +1996,17 @@ hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount,
                                     hipblasComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCdotc(handle, n, x_batch[b], incx, y_batch[b], incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
@@ -1415,8 +2017,17 @@ hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
                                     int                         incy,
                                     int                         batchCount,
                                     hipblasComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCdotu(handle, n, x_batch[b], incx, y_batch[b], incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
@@ -1427,8 +2038,17 @@ hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount,
                                     hipblasDoubleComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdotc(handle, n, x_batch[b], incx, y_batch[b], incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
@@ -1439,8 +2059,17 @@ hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     int                               batchCount,
                                     hipblasDoubleComplex*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdotu(handle, n, x_batch[b], incx, y_batch[b], incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // dot_strided_batched
@@ -1482,8 +2111,15 @@ hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   stridey,
                                           int             batchCount,
                                           float*          result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSdot(handle, n, x + b * stridex, incx, y + b * stridey, incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
@@ -1496,8 +2132,15 @@ hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                           hipblasStride   stridey,
                                           int             batchCount,
                                           double*         result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDdot(handle, n, x + b * stridex, incx, y + b * stridey, incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
@@ -1510,8 +2153,15 @@ hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount,
                                            hipblasComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCdotc(handle, n, x + b * stridex, incx, y + b * stridey, incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
@@ -1524,8 +2174,15 @@ hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
                                            hipblasStride         stridey,
                                            int                   batchCount,
                                            hipblasComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCdotu(handle, n, x + b * stridex, incx, y + b * stridey, incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
@@ -1538,8 +2195,15 @@ hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount,
                                            hipblasDoubleComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdotc(handle, n, x + b * stridex, incx, y + b * stridey, incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
@@ -1552,8 +2216,15 @@ hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
                                            hipblasStride               stridey,
                                            int                         batchCount,
                                            hipblasDoubleComplex*       result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdotu(handle, n, x + b * stridex, incx, y + b * stridey, incy, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // nrm2
@@ -1605,8 +2276,16 @@ catch(...)
 // nrm2_batched
 hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSnrm2(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
@@ -1615,8 +2294,16 @@ hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                     int                 incx,
                                     int                 batchCount,
                                     double*             result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDnrm2(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
@@ -1625,8 +2312,16 @@ hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
                                      int                         incx,
                                      int                         batchCount,
                                      float*                      result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasScnrm2(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
@@ -1635,8 +2330,16 @@ hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
                                      int                               incx,
                                      int                               batchCount,
                                      double*                           result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDznrm2(handle, n, x_batch[b], incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // nrm2_strided_batched
@@ -1647,8 +2350,15 @@ hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            float*          result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSnrm2(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
@@ -1658,10 +2368,17 @@ hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
                                            hipblasStride   stridex,
                                            int             batchCount,
                                            double*         result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDnrm2(handle, n, x + b * stridex, incx, result + b);
+    });
 }
-
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* x,
@@ -1669,8 +2386,15 @@ hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                             hipblasStride         stridex,
                                             int                   batchCount,
                                             float*                result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasScnrm2(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
@@ -1680,8 +2404,15 @@ hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
                                             hipblasStride               stridex,
                                             int                         batchCount,
                                             double*                     result)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDznrm2(handle, n, x + b * stridex, incx, result + b);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rot
@@ -1809,8 +2540,17 @@ hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
                                    const float*    c,
                                    const float*    s,
                                    int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSrot(handle, n, x_batch[b], incx, y_batch[b], incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
@@ -1822,8 +2562,17 @@ hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                    const double*   c,
                                    const double*   s,
                                    int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDrot(handle, n, x_batch[b], incx, y_batch[b], incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
@@ -1835,8 +2584,17 @@ hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                    const float*          c,
                                    const hipblasComplex* s,
                                    int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCrot(handle, n, x_batch[b], incx, y_batch[b], incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
@@ -1848,8 +2606,17 @@ hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                     const float*          c,
                                     const float*          s,
                                     int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsrot(handle, n, x_batch[b], incx, y_batch[b], incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
@@ -1861,8 +2628,17 @@ hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
                                    const double*               c,
                                    const hipblasDoubleComplex* s,
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZrot(handle, n, x_batch[b], incx, y_batch[b], incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
@@ -1874,8 +2650,17 @@ hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
                                     const double*               c,
                                     const double*               s,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdrot(handle, n, x_batch[b], incx, y_batch[b], incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rot_strided_batched
@@ -1890,8 +2675,15 @@ hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
                                           const float*    c,
                                           const float*    s,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSrot(handle, n, x + b * stridex, incx, y + b * stridey, incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
@@ -1905,8 +2697,15 @@ hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                           const double*   c,
                                           const double*   s,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDrot(handle, n, x + b * stridex, incx, y + b * stridey, incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
@@ -1920,8 +2719,15 @@ hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
                                           const float*          c,
                                           const hipblasComplex* s,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCrot(handle, n, x + b * stridex, incx, y + b * stridey, incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
@@ -1935,8 +2741,15 @@ hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
                                            const float*    c,
                                            const float*    s,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsrot(handle, n, x + b * stridex, incx, y + b * stridey, incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
@@ -1950,8 +2763,15 @@ hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
                                           const double*               c,
                                           const hipblasDoubleComplex* s,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZrot(handle, n, x + b * stridex, incx, y + b * stridey, incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
@@ -1965,8 +2785,15 @@ hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
                                            const double*         c,
                                            const double*         s,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdrot(handle, n, x + b * stridex, incx, y + b * stridey, incy, c, s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotg
@@ -2069,8 +2896,16 @@ hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle,
                                            float*          s,
                                            hipblasStride   stride_s,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int i) {
+        return hipblasSrotg(
+            handle, a + i * stride_a, b + i * stride_b, c + i * stride_c, s + i * stride_s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
@@ -2083,8 +2918,16 @@ hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
                                            double*         s,
                                            hipblasStride   stride_s,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int i) {
+        return hipblasDrotg(
+            handle, a + i * stride_a, b + i * stride_b, c + i * stride_c, s + i * stride_s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
@@ -2097,8 +2940,16 @@ hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
                                            hipblasComplex* s,
                                            hipblasStride   stride_s,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int i) {
+        return hipblasCrotg(
+            handle, a + i * stride_a, b + i * stride_b, c + i * stride_c, s + i * stride_s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
@@ -2111,8 +2962,16 @@ hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
                                            hipblasDoubleComplex* s,
                                            hipblasStride         stride_s,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int i) {
+        return hipblasZrotg(
+            handle, a + i * stride_a, b + i * stride_b, c + i * stride_c, s + i * stride_s);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotm
@@ -2149,8 +3008,18 @@ hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
                                     int                incy,
                                     const float* const param[],
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch     = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch     = batched_emulation::pointers(handle, y, batchCount);
+    auto param_batch = batched_emulation::pointers(handle, param, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSrotm(handle, n, x_batch[b], incx, y_batch[b], incy, param_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
@@ -2161,8 +3030,18 @@ hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                     int                 incy,
                                     const double* const param[],
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch     = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch     = batched_emulation::pointers(handle, y, batchCount);
+    auto param_batch = batched_emulation::pointers(handle, param, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDrotm(handle, n, x_batch[b], incx, y_batch[b], incy, param_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotm_strided_batched
@@ -2177,8 +3056,16 @@ hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle,
                                            const float*    param,
                                            hipblasStride   strideParam,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSrotm(
+            handle, n, x + b * stridex, incx, y + b * stridey, incy, param + b * strideParam);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
@@ -2192,8 +3079,16 @@ hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
                                            const double*   param,
                                            hipblasStride   strideParam,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDrotm(
+            handle, n, x + b * stridex, incx, y + b * stridey, incy, param + b * strideParam);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // rotmg
@@ -2353,9 +3248,10 @@ hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount)
 try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // TODO warn user that function was demoted to ignore batch
-    // return hipCUBLASStatusToHIPStatus(cublasSscal((cublasHandle_t)handle, n, alpha, x, incx));
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSscal(handle, n, alpha, x_batch[b], incx);
+    });
 }
 catch(...)
 {
@@ -2373,8 +3269,16 @@ hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                     hipblasComplex* const x[],
                                     int                   incx,
                                     int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCscal(handle, n, alpha, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
@@ -2383,8 +3287,16 @@ hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
                                     hipblasDoubleComplex* const x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZscal(handle, n, alpha, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
@@ -2393,8 +3305,16 @@ hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
                                      hipblasComplex* const x[],
                                      int                   incx,
                                      int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsscal(handle, n, alpha, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
@@ -2403,8 +3323,16 @@ hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
                                      hipblasDoubleComplex* const x[],
                                      int                         incx,
                                      int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdscal(handle, n, alpha, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // scal_strided_batched
@@ -2415,8 +3343,15 @@ hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle,
                                            int             incx,
                                            hipblasStride   stridex,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSscal(handle, n, alpha, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
@@ -2426,8 +3361,15 @@ hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
                                            int             incx,
                                            hipblasStride   stridex,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDscal(handle, n, alpha, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
@@ -2437,8 +3379,15 @@ hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCscal(handle, n, alpha, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
@@ -2448,8 +3397,15 @@ hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZscal(handle, n, alpha, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
@@ -2459,8 +3415,15 @@ hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
                                             int             incx,
                                             hipblasStride   stridex,
                                             int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsscal(handle, n, alpha, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
@@ -2470,8 +3433,15 @@ hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
                                             int                   incx,
                                             hipblasStride         stridex,
                                             int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZdscal(handle, n, alpha, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // swap
@@ -2527,14 +3497,32 @@ catch(...)
 // swap_batched
 hipblasStatus_t hipblasSswapBatched(
     hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSswap(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDswapBatched(
     hipblasHandle_t handle, int n, double* x[], int incx, double* y[], int incy, int batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDswap(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
@@ -2544,8 +3532,17 @@ hipblasStatus_t hipblasCswapBatched(hipblasHandle_t handle,
                                     hipblasComplex* y[],
                                     int             incy,
                                     int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCswap(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
@@ -2555,8 +3552,17 @@ hipblasStatus_t hipblasZswapBatched(hipblasHandle_t       handle,
                                     hipblasDoubleComplex* y[],
                                     int                   incy,
                                     int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZswap(handle, n, x_batch[b], incx, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // swap_strided_batched
@@ -2569,8 +3575,15 @@ hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSswap(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
@@ -2582,8 +3595,15 @@ hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDswap(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
@@ -2595,8 +3615,15 @@ hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
                                            int             incy,
                                            hipblasStride   stridey,
                                            int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCswap(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
@@ -2608,8 +3635,15 @@ hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZswap(handle, n, x + b * stridex, incx, y + b * stridey, incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gbmv
@@ -2773,8 +3807,31 @@ hipblasStatus_t hipblasSgbmvBatched(hipblasHandle_t    handle,
                                     float* const       y[],
                                     int                incy,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto y_batch = batched_emulation::pointers(handle, y, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasSgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            x_batch[b],
+                            incx,
+                            beta,
+                            y_batch[b],
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
@@ -2792,11 +3849,34 @@ hipblasStatus_t hipblasDgbmvBatched(hipblasHandle_t     handle,
                                     double* const       y[],
                                     int                 incy,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto y_batch = batched_emulation::pointers(handle, y, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            x_batch[b],
+                            incx,
+                            beta,
+                            y_batch[b],
+                            incy);
+    });
 }
-
-hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
                                     hipblasOperation_t          trans,
                                     int                         m,
                                     int                         n,
@@ -2811,8 +3891,31 @@ hipblasStatus_t hipblasCgbmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto y_batch = batched_emulation::pointers(handle, y, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            x_batch[b],
+                            incx,
+                            beta,
+                            y_batch[b],
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
@@ -2830,8 +3933,31 @@ hipblasStatus_t hipblasZgbmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto y_batch = batched_emulation::pointers(handle, y, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            x_batch[b],
+                            incx,
+                            beta,
+                            y_batch[b],
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gbmv_strided_batched
@@ -2853,8 +3979,28 @@ hipblasStatus_t hipblasSgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incy,
                                            hipblasStride      stride_y,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasSgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A + b * stride_a,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            beta,
+                            y + b * stride_y,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
@@ -2875,8 +4021,28 @@ hipblasStatus_t hipblasDgbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incy,
                                            hipblasStride      stride_y,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A + b * stride_a,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            beta,
+                            y + b * stride_y,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
@@ -2897,8 +4063,28 @@ hipblasStatus_t hipblasCgbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stride_y,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A + b * stride_a,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            beta,
+                            y + b * stride_y,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
@@ -2919,8 +4105,28 @@ hipblasStatus_t hipblasZgbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stride_y,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZgbmv(handle,
+                            trans,
+                            m,
+                            n,
+                            kl,
+                            ku,
+                            alpha,
+                            A + b * stride_a,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            beta,
+                            y + b * stride_y,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gemv
@@ -3068,20 +4274,30 @@ hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
                                     int                batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    if(gemv_as_gemm(trans, m, n, incx, incy, false))
+        return hipCUBLASStatusToHIPStatus(cublasSgemmBatched((cublasHandle_t)handle,
+                                                             CUBLAS_OP_N,
+                                                             gemv_as_gemm_op(trans),
+                                                             1,
+                                                             trans == HIPBLAS_OP_N ? m : n,
+                                                             trans == HIPBLAS_OP_N ? n : m,
+                                                             alpha,
+                                                             x,
+                                                             incx,
+                                                             A,
+                                                             lda,
+                                                             beta,
+                                                             y,
+                                                             incy,
+                                                             batchCount));
+
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSgemv(
+            handle, trans, m, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
 }
 catch(...)
 {
@@ -3103,20 +4319,30 @@ hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                     int                 batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    if(gemv_as_gemm(trans, m, n, incx, incy, false))
+        return hipCUBLASStatusToHIPStatus(cublasDgemmBatched((cublasHandle_t)handle,
+                                                             CUBLAS_OP_N,
+                                                             gemv_as_gemm_op(trans),
+                                                             1,
+                                                             trans == HIPBLAS_OP_N ? m : n,
+                                                             trans == HIPBLAS_OP_N ? n : m,
+                                                             alpha,
+                                                             x,
+                                                             incx,
+                                                             A,
+                                                             lda,
+                                                             beta,
+                                                             y,
+                                                             incy,
+                                                             batchCount));
+
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDgemv(
+            handle, trans, m, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
 }
 catch(...)
 {
@@ -3136,8 +4362,36 @@ hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(gemv_as_gemm(trans, m, n, incx, incy, true))
+        return hipCUBLASStatusToHIPStatus(cublasCgemmBatched((cublasHandle_t)handle,
+                                                             CUBLAS_OP_N,
+                                                             gemv_as_gemm_op(trans),
+                                                             1,
+                                                             trans == HIPBLAS_OP_N ? m : n,
+                                                             trans == HIPBLAS_OP_N ? n : m,
+                                                             (const cuComplex*)alpha,
+                                                             (cuComplex* const*)x,
+                                                             incx,
+                                                             (cuComplex* const*)A,
+                                                             lda,
+                                                             (const cuComplex*)beta,
+                                                             (cuComplex* const*)y,
+                                                             incy,
+                                                             batchCount));
+
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgemv(
+            handle, trans, m, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
@@ -3153,8 +4407,36 @@ hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(gemv_as_gemm(trans, m, n, incx, incy, true))
+        return hipCUBLASStatusToHIPStatus(cublasZgemmBatched((cublasHandle_t)handle,
+                                                             CUBLAS_OP_N,
+                                                             gemv_as_gemm_op(trans),
+                                                             1,
+                                                             trans == HIPBLAS_OP_N ? m : n,
+                                                             trans == HIPBLAS_OP_N ? n : m,
+                                                             (const cuDoubleComplex*)alpha,
+                                                             (cuDoubleComplex* const*)x,
+                                                             incx,
+                                                             (cuDoubleComplex* const*)A,
+                                                             lda,
+                                                             (const cuDoubleComplex*)beta,
+                                                             (cuDoubleComplex* const*)y,
+                                                             incy,
+                                                             batchCount));
+
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgemv(
+            handle, trans, m, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // gemv_strided_batched
@@ -3176,20 +4458,40 @@ hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasSgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    if(gemv_as_gemm(trans, m, n, incx, incy, false))
+        return hipCUBLASStatusToHIPStatus(cublasSgemmStridedBatched((cublasHandle_t)handle,
+                                                                    CUBLAS_OP_N,
+                                                                    gemv_as_gemm_op(trans),
+                                                                    1,
+                                                                    trans == HIPBLAS_OP_N ? m : n,
+                                                                    trans == HIPBLAS_OP_N ? n : m,
+                                                                    alpha,
+                                                                    x,
+                                                                    incx,
+                                                                    stridex,
+                                                                    A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    beta,
+                                                                    y,
+                                                                    incy,
+                                                                    stridey,
+                                                                    batchCount));
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSgemv(handle,
+                            trans,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
 }
 catch(...)
 {
@@ -3214,20 +4516,40 @@ hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
                                            int                batchCount)
 try
 {
-    // TODO warn user that function was demoted to ignore batch
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
-    // return hipCUBLASStatusToHIPStatus(cublasDgemv((cublasHandle_t)handle,
-    //                                               hipOperationToCudaOperation(trans),
-    //                                               m,
-    //                                               n,
-    //                                               alpha,
-    //                                               A,
-    //                                               lda,
-    //                                               x,
-    //                                               incx,
-    //                                               beta,
-    //                                               y,
-    //                                               incy));
+    if(gemv_as_gemm(trans, m, n, incx, incy, false))
+        return hipCUBLASStatusToHIPStatus(cublasDgemmStridedBatched((cublasHandle_t)handle,
+                                                                    CUBLAS_OP_N,
+                                                                    gemv_as_gemm_op(trans),
+                                                                    1,
+                                                                    trans == HIPBLAS_OP_N ? m : n,
+                                                                    trans == HIPBLAS_OP_N ? n : m,
+                                                                    alpha,
+                                                                    x,
+                                                                    incx,
+                                                                    stridex,
+                                                                    A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    beta,
+                                                                    y,
+                                                                    incy,
+                                                                    stridey,
+                                                                    batchCount));
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDgemv(handle,
+                            trans,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
 }
 catch(...)
 {
@@ -3250,8 +4572,46 @@ hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(gemv_as_gemm(trans, m, n, incx, incy, true))
+        return hipCUBLASStatusToHIPStatus(cublasCgemmStridedBatched((cublasHandle_t)handle,
+                                                                    CUBLAS_OP_N,
+                                                                    gemv_as_gemm_op(trans),
+                                                                    1,
+                                                                    trans == HIPBLAS_OP_N ? m : n,
+                                                                    trans == HIPBLAS_OP_N ? n : m,
+                                                                    (const cuComplex*)alpha,
+                                                                    (const cuComplex*)x,
+                                                                    incx,
+                                                                    stridex,
+                                                                    (const cuComplex*)A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    (const cuComplex*)beta,
+                                                                    (cuComplex*)y,
+                                                                    incy,
+                                                                    stridey,
+                                                                    batchCount));
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgemv(handle,
+                            trans,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
@@ -3270,8 +4630,491 @@ hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(gemv_as_gemm(trans, m, n, incx, incy, true))
+        return hipCUBLASStatusToHIPStatus(cublasZgemmStridedBatched((cublasHandle_t)handle,
+                                                                    CUBLAS_OP_N,
+                                                                    gemv_as_gemm_op(trans),
+                                                                    1,
+                                                                    trans == HIPBLAS_OP_N ? m : n,
+                                                                    trans == HIPBLAS_OP_N ? n : m,
+                                                                    (const cuDoubleComplex*)alpha,
+                                                                    (const cuDoubleComplex*)x,
+                                                                    incx,
+                                                                    stridex,
+                                                                    (const cuDoubleComplex*)A,
+                                                                    lda,
+                                                                    strideA,
+                                                                    (const cuDoubleComplex*)beta,
+                                                                    (cuDoubleComplex*)y,
+                                                                    incy,
+                                                                    stridey,
+                                                                    batchCount));
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgemv(handle,
+                            trans,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemvBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float* const x[],
+                                            int                incx,
+                                            const float*       beta,
+                                            float* const       y[],
+                                            int                incy,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasSgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    // as a single-row gemm the batch is one launch, which is worth the upload of the arrays;
+    // otherwise the host arrays feed the emulation of the batched gemv directly
+    if(gemv_as_gemm(trans, m, n, incx, incy, false)
+       && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE)
+    {
+        auto arrays = batched_emulation::device_pointers(
+            handle,
+            batchCount,
+            {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+        return hipblasSgemvBatched(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   alpha,
+                                   (const float* const*)arrays,
+                                   lda,
+                                   (const float* const*)(arrays + batchCount),
+                                   incx,
+                                   beta,
+                                   (float* const*)(arrays + 2 * batchCount),
+                                   incy,
+                                   batchCount);
+    }
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSgemv(handle, trans, m, n, alpha, A[b], lda, x[b], incx, beta, y[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasOperation_t  trans,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double* const x[],
+                                            int                 incx,
+                                            const double*       beta,
+                                            double* const       y[],
+                                            int                 incy,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasDgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    // as a single-row gemm the batch is one launch, which is worth the upload of the arrays;
+    // otherwise the host arrays feed the emulation of the batched gemv directly
+    if(gemv_as_gemm(trans, m, n, incx, incy, false)
+       && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE)
+    {
+        auto arrays = batched_emulation::device_pointers(
+            handle,
+            batchCount,
+            {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+        return hipblasDgemvBatched(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   alpha,
+                                   (const double* const*)arrays,
+                                   lda,
+                                   (const double* const*)(arrays + batchCount),
+                                   incx,
+                                   beta,
+                                   (double* const*)(arrays + 2 * batchCount),
+                                   incy,
+                                   batchCount);
+    }
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDgemv(handle, trans, m, n, alpha, A[b], lda, x[b], incx, beta, y[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasOperation_t          trans,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex* const x[],
+                                            int                         incx,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       y[],
+                                            int                         incy,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasCgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    // as a single-row gemm the batch is one launch, which is worth the upload of the arrays;
+    // otherwise the host arrays feed the emulation of the batched gemv directly
+    if(gemv_as_gemm(trans, m, n, incx, incy, true)
+       && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE)
+    {
+        auto arrays = batched_emulation::device_pointers(
+            handle,
+            batchCount,
+            {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+        return hipblasCgemvBatched(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   alpha,
+                                   (const hipblasComplex* const*)arrays,
+                                   lda,
+                                   (const hipblasComplex* const*)(arrays + batchCount),
+                                   incx,
+                                   beta,
+                                   (hipblasComplex* const*)(arrays + 2 * batchCount),
+                                   incy,
+                                   batchCount);
+    }
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgemv(handle, trans, m, n, alpha, A[b], lda, x[b], incx, beta, y[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasOperation_t                trans,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex* const x[],
+                                            int                               incx,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       y[],
+                                            int                               incy,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, stridex, stridey;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(x, batchCount, &stridex)
+       && hipblas_uniform_stride(y, batchCount, &stridey))
+        return hipblasZgemvStridedBatched(handle,
+                                          trans,
+                                          m,
+                                          n,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          x[0],
+                                          incx,
+                                          stridex,
+                                          beta,
+                                          y[0],
+                                          incy,
+                                          stridey,
+                                          batchCount);
+
+    // as a single-row gemm the batch is one launch, which is worth the upload of the arrays;
+    // otherwise the host arrays feed the emulation of the batched gemv directly
+    if(gemv_as_gemm(trans, m, n, incx, incy, true)
+       && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE)
+    {
+        auto arrays = batched_emulation::device_pointers(
+            handle,
+            batchCount,
+            {(const void* const*)A, (const void* const*)x, (const void* const*)y});
+        return hipblasZgemvBatched(handle,
+                                   trans,
+                                   m,
+                                   n,
+                                   alpha,
+                                   (const hipblasDoubleComplex* const*)arrays,
+                                   lda,
+                                   (const hipblasDoubleComplex* const*)(arrays + batchCount),
+                                   incx,
+                                   beta,
+                                   (hipblasDoubleComplex* const*)(arrays + 2 * batchCount),
+                                   incy,
+                                   batchCount);
+    }
+
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgemv(handle, trans, m, n, alpha, A[b], lda, x[b], incx, beta, y[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gemv_vbatched
+hipblasStatus_t hipblasSgemvVbatched(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     const int          m[],
+                                     const int          n[],
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     const int          lda[],
+                                     const float* const x[],
+                                     const int          incx[],
+                                     const float*       beta,
+                                     float* const       y[],
+                                     const int          incy[],
+                                     int                batchCount)
+try
+{
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [&](int mb, int nb, int incxb, int incyb) {
+            return gemv_as_gemm(trans, mb, nb, incxb, incyb, false)
+                   && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE;
+        },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemvVbatched(hipblasHandle_t     handle,
+                                     hipblasOperation_t  trans,
+                                     const int           m[],
+                                     const int           n[],
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     const int           lda[],
+                                     const double* const x[],
+                                     const int           incx[],
+                                     const double*       beta,
+                                     double* const       y[],
+                                     const int           incy[],
+                                     int                 batchCount)
+try
+{
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [&](int mb, int nb, int incxb, int incyb) {
+            return gemv_as_gemm(trans, mb, nb, incxb, incyb, false)
+                   && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE;
+        },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemvVbatched(hipblasHandle_t             handle,
+                                     hipblasOperation_t          trans,
+                                     const int                   m[],
+                                     const int                   n[],
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const A[],
+                                     const int                   lda[],
+                                     const hipblasComplex* const x[],
+                                     const int                   incx[],
+                                     const hipblasComplex*       beta,
+                                     hipblasComplex* const       y[],
+                                     const int                   incy[],
+                                     int                         batchCount)
+try
+{
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [&](int mb, int nb, int incxb, int incyb) {
+            return gemv_as_gemm(trans, mb, nb, incxb, incyb, true)
+                   && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE;
+        },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemvVbatched(hipblasHandle_t                   handle,
+                                     hipblasOperation_t                trans,
+                                     const int                         m[],
+                                     const int                         n[],
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda[],
+                                     const hipblasDoubleComplex* const x[],
+                                     const int                         incx[],
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       y[],
+                                     const int                         incy[],
+                                     int                               batchCount)
+try
+{
+    return hipblas_gemv_vbatched(
+        handle,
+        trans,
+        m,
+        n,
+        alpha,
+        A,
+        lda,
+        x,
+        incx,
+        beta,
+        y,
+        incy,
+        batchCount,
+        [&](int mb, int nb, int incxb, int incyb) {
+            return gemv_as_gemm(trans, mb, nb, incxb, incyb, true)
+                   && batched_emulation::capture_mode(handle) != HIPBLAS_CAPTURE_MODE_SAFE;
+        },
+        [&](int count, std::initializer_list<const void* const*> arrays) {
+            return batched_emulation::device_pointers(handle, count, arrays);
+        });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // ger
@@ -3439,8 +5282,19 @@ hipblasStatus_t hipblasSgerBatched(hipblasHandle_t    handle,
                                    float* const       A[],
                                    int                lda,
                                    int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSger(
+            handle, m, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
@@ -3454,8 +5308,19 @@ hipblasStatus_t hipblasDgerBatched(hipblasHandle_t     handle,
                                    double* const       A[],
                                    int                 lda,
                                    int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDger(
+            handle, m, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
@@ -3469,8 +5334,19 @@ hipblasStatus_t hipblasCgeruBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgeru(
+            handle, m, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
@@ -3484,8 +5360,19 @@ hipblasStatus_t hipblasCgercBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgerc(
+            handle, m, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
@@ -3499,8 +5386,19 @@ hipblasStatus_t hipblasZgeruBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgeru(
+            handle, m, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
@@ -3514,8 +5412,19 @@ hipblasStatus_t hipblasZgercBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgerc(
+            handle, m, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // ger_strided_batched
@@ -3533,8 +5442,24 @@ hipblasStatus_t hipblasSgerStridedBatched(hipblasHandle_t handle,
                                           int             lda,
                                           hipblasStride   strideA,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSger(handle,
+                           m,
+                           n,
+                           alpha,
+                           x + b * stridex,
+                           incx,
+                           y + b * stridey,
+                           incy,
+                           A + b * strideA,
+                           lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
@@ -3551,8 +5476,24 @@ hipblasStatus_t hipblasDgerStridedBatched(hipblasHandle_t handle,
                                           int             lda,
                                           hipblasStride   strideA,
                                           int             batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDger(handle,
+                           m,
+                           n,
+                           alpha,
+                           x + b * stridex,
+                           incx,
+                           y + b * stridey,
+                           incy,
+                           A + b * strideA,
+                           lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
@@ -3569,8 +5510,24 @@ hipblasStatus_t hipblasCgeruStridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgeru(handle,
+                            m,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
@@ -3587,8 +5544,24 @@ hipblasStatus_t hipblasCgercStridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgerc(handle,
+                            m,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
@@ -3605,8 +5578,24 @@ hipblasStatus_t hipblasZgeruStridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgeru(handle,
+                            m,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
@@ -3623,8 +5612,24 @@ hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgerc(handle,
+                            m,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hbmv
@@ -3706,8 +5711,19 @@ hipblasStatus_t hipblasChbmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChbmv(
+            handle, uplo, n, k, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
@@ -3723,8 +5739,19 @@ hipblasStatus_t hipblasZhbmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhbmv(
+            handle, uplo, n, k, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hbmv_strided_batched
@@ -3744,8 +5771,26 @@ hipblasStatus_t hipblasChbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChbmv(handle,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
@@ -3764,8 +5809,26 @@ hipblasStatus_t hipblasZhbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhbmv(handle,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hemv
@@ -3842,8 +5905,19 @@ hipblasStatus_t hipblasChemvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto y_batch = batched_emulation::pointers(handle, y, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasChemv(
+            handle, uplo, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
@@ -3858,8 +5932,19 @@ hipblasStatus_t hipblasZhemvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto y_batch = batched_emulation::pointers(handle, y, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZhemv(
+            handle, uplo, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hemv_strided_batched
@@ -3878,8 +5963,25 @@ hipblasStatus_t hipblasChemvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stride_y,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasChemv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            A + b * stride_a,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            beta,
+                            y + b * stride_y,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
@@ -3897,8 +5999,25 @@ hipblasStatus_t hipblasZhemvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stride_y,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZhemv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            A + b * stride_a,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            beta,
+                            y + b * stride_y,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her
@@ -3960,8 +6079,17 @@ hipblasStatus_t hipblasCherBatched(hipblasHandle_t             handle,
                                    hipblasComplex* const       A[],
                                    int                         lda,
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCher(handle, uplo, n, alpha, x_batch[b], incx, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
@@ -3973,8 +6101,17 @@ hipblasStatus_t hipblasZherBatched(hipblasHandle_t                   handle,
                                    hipblasDoubleComplex* const       A[],
                                    int                               lda,
                                    int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZher(handle, uplo, n, alpha, x_batch[b], incx, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her_strided_batched
@@ -3989,8 +6126,15 @@ hipblasStatus_t hipblasCherStridedBatched(hipblasHandle_t       handle,
                                           int                   lda,
                                           hipblasStride         strideA,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCher(handle, uplo, n, alpha, x + b * stridex, incx, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
@@ -4004,8 +6148,15 @@ hipblasStatus_t hipblasZherStridedBatched(hipblasHandle_t             handle,
                                           int                         lda,
                                           hipblasStride               strideA,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZher(handle, uplo, n, alpha, x + b * stridex, incx, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her2
@@ -4077,8 +6228,19 @@ hipblasStatus_t hipblasCher2Batched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCher2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
@@ -4092,8 +6254,19 @@ hipblasStatus_t hipblasZher2Batched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZher2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her2_strided_batched
@@ -4111,8 +6284,24 @@ hipblasStatus_t hipblasCher2StridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCher2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
@@ -4129,8 +6318,24 @@ hipblasStatus_t hipblasZher2StridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZher2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpmv
@@ -4202,8 +6407,19 @@ hipblasStatus_t hipblasChpmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch  = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChpmv(
+            handle, uplo, n, alpha, AP_batch[b], x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
@@ -4217,8 +6433,19 @@ hipblasStatus_t hipblasZhpmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch  = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhpmv(
+            handle, uplo, n, alpha, AP_batch[b], x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpmv_strided_batched
@@ -4236,8 +6463,24 @@ hipblasStatus_t hipblasChpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChpmv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            AP + b * strideAP,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
@@ -4254,8 +6497,24 @@ hipblasStatus_t hipblasZhpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhpmv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            AP + b * strideAP,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr
@@ -4312,8 +6571,17 @@ hipblasStatus_t hipblasChprBatched(hipblasHandle_t             handle,
                                    int                         incx,
                                    hipblasComplex* const       AP[],
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChpr(handle, uplo, n, alpha, x_batch[b], incx, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
@@ -4324,8 +6592,17 @@ hipblasStatus_t hipblasZhprBatched(hipblasHandle_t                   handle,
                                    int                               incx,
                                    hipblasDoubleComplex* const       AP[],
                                    int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhpr(handle, uplo, n, alpha, x_batch[b], incx, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr_strided_batched
@@ -4339,8 +6616,15 @@ hipblasStatus_t hipblasChprStridedBatched(hipblasHandle_t       handle,
                                           hipblasComplex*       AP,
                                           hipblasStride         strideAP,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChpr(handle, uplo, n, alpha, x + b * stridex, incx, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
@@ -4353,8 +6637,15 @@ hipblasStatus_t hipblasZhprStridedBatched(hipblasHandle_t             handle,
                                           hipblasDoubleComplex*       AP,
                                           hipblasStride               strideAP,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhpr(handle, uplo, n, alpha, x + b * stridex, incx, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr2
@@ -4421,8 +6712,19 @@ hipblasStatus_t hipblasChpr2Batched(hipblasHandle_t             handle,
                                     int                         incy,
                                     hipblasComplex* const       AP[],
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto yp_batch = batched_emulation::pointers(handle, yp, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChpr2(
+            handle, uplo, n, alpha, x_batch[b], incx, yp_batch[b], incy, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
@@ -4435,8 +6737,19 @@ hipblasStatus_t hipblasZhpr2Batched(hipblasHandle_t                   handle,
                                     int                               incy,
                                     hipblasDoubleComplex* const       AP[],
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto yp_batch = batched_emulation::pointers(handle, yp, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhpr2(
+            handle, uplo, n, alpha, x_batch[b], incx, yp_batch[b], incy, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hpr2_strided_batched
@@ -4453,8 +6766,23 @@ hipblasStatus_t hipblasChpr2StridedBatched(hipblasHandle_t       handle,
                                            hipblasComplex*       AP,
                                            hipblasStride         strideAP,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChpr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
@@ -4470,8 +6798,23 @@ hipblasStatus_t hipblasZhpr2StridedBatched(hipblasHandle_t             handle,
                                            hipblasDoubleComplex*       AP,
                                            hipblasStride               strideAP,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhpr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // sbmv
@@ -4553,8 +6896,19 @@ hipblasStatus_t hipblasSsbmvBatched(hipblasHandle_t    handle,
                                     float*             y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsbmv(
+            handle, uplo, n, k, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
@@ -4570,8 +6924,19 @@ hipblasStatus_t hipblasDsbmvBatched(hipblasHandle_t     handle,
                                     double*             y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsbmv(
+            handle, uplo, n, k, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // sbmv_strided_batched
@@ -4591,8 +6956,26 @@ hipblasStatus_t hipblasSsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsbmv(handle,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
@@ -4611,8 +6994,26 @@ hipblasStatus_t hipblasDsbmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsbmv(handle,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spmv
@@ -4668,8 +7069,19 @@ hipblasStatus_t hipblasSspmvBatched(hipblasHandle_t    handle,
                                     float*             y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch  = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSspmv(
+            handle, uplo, n, alpha, AP_batch[b], x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
@@ -4683,8 +7095,19 @@ hipblasStatus_t hipblasDspmvBatched(hipblasHandle_t     handle,
                                     double*             y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch  = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDspmv(
+            handle, uplo, n, alpha, AP_batch[b], x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spmv_strided_batched
@@ -4702,8 +7125,24 @@ hipblasStatus_t hipblasSspmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSspmv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            AP + b * strideAP,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
@@ -4720,8 +7159,24 @@ hipblasStatus_t hipblasDspmvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDspmv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            AP + b * strideAP,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spr
@@ -4790,8 +7245,17 @@ hipblasStatus_t hipblasSsprBatched(hipblasHandle_t    handle,
                                    int                incx,
                                    float* const       AP[],
                                    int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSspr(handle, uplo, n, alpha, x_batch[b], incx, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
@@ -4802,8 +7266,17 @@ hipblasStatus_t hipblasDsprBatched(hipblasHandle_t     handle,
                                    int                 incx,
                                    double* const       AP[],
                                    int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDspr(handle, uplo, n, alpha, x_batch[b], incx, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsprBatched(hipblasHandle_t             handle,
@@ -4841,8 +7314,15 @@ hipblasStatus_t hipblasSsprStridedBatched(hipblasHandle_t   handle,
                                           float*            AP,
                                           hipblasStride     strideAP,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSspr(handle, uplo, n, alpha, x + b * stridex, incx, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
@@ -4855,8 +7335,15 @@ hipblasStatus_t hipblasDsprStridedBatched(hipblasHandle_t   handle,
                                           double*           AP,
                                           hipblasStride     strideAP,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDspr(handle, uplo, n, alpha, x + b * stridex, incx, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsprStridedBatched(hipblasHandle_t       handle,
@@ -4937,8 +7424,19 @@ hipblasStatus_t hipblasSspr2Batched(hipblasHandle_t    handle,
                                     int                incy,
                                     float* const       AP[],
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch  = batched_emulation::pointers(handle, y, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSspr2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
@@ -4951,8 +7449,19 @@ hipblasStatus_t hipblasDspr2Batched(hipblasHandle_t     handle,
                                     int                 incy,
                                     double* const       AP[],
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch  = batched_emulation::pointers(handle, y, batchCount);
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDspr2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // spr2_strided_batched
@@ -4969,8 +7478,23 @@ hipblasStatus_t hipblasSspr2StridedBatched(hipblasHandle_t   handle,
                                            float*            AP,
                                            hipblasStride     strideAP,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSspr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
@@ -4986,8 +7510,23 @@ hipblasStatus_t hipblasDspr2StridedBatched(hipblasHandle_t   handle,
                                            double*           AP,
                                            hipblasStride     strideAP,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDspr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // symv
@@ -5106,8 +7645,19 @@ hipblasStatus_t hipblasSsymvBatched(hipblasHandle_t    handle,
                                     float*             y[],
                                     int                incy,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsymv(
+            handle, uplo, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
@@ -5122,8 +7672,19 @@ hipblasStatus_t hipblasDsymvBatched(hipblasHandle_t     handle,
                                     double*             y[],
                                     int                 incy,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsymv(
+            handle, uplo, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
@@ -5138,8 +7699,19 @@ hipblasStatus_t hipblasCsymvBatched(hipblasHandle_t             handle,
                                     hipblasComplex*             y[],
                                     int                         incy,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsymv(
+            handle, uplo, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
@@ -5154,8 +7726,19 @@ hipblasStatus_t hipblasZsymvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex*             y[],
                                     int                               incy,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsymv(
+            handle, uplo, n, alpha, A_batch[b], lda, x_batch[b], incx, beta, y_batch[b], incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // symv_strided_batched
@@ -5174,8 +7757,25 @@ hipblasStatus_t hipblasSsymvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsymv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
@@ -5193,8 +7793,25 @@ hipblasStatus_t hipblasDsymvStridedBatched(hipblasHandle_t   handle,
                                            int               incy,
                                            hipblasStride     stridey,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsymv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
@@ -5212,8 +7829,25 @@ hipblasStatus_t hipblasCsymvStridedBatched(hipblasHandle_t       handle,
                                            int                   incy,
                                            hipblasStride         stridey,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsymv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
@@ -5231,8 +7865,25 @@ hipblasStatus_t hipblasZsymvStridedBatched(hipblasHandle_t             handle,
                                            int                         incy,
                                            hipblasStride               stridey,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsymv(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            x + b * stridex,
+                            incx,
+                            beta,
+                            y + b * stridey,
+                            incy);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr
@@ -5330,8 +7981,17 @@ hipblasStatus_t hipblasSsyrBatched(hipblasHandle_t    handle,
                                    float* const       A[],
                                    int                lda,
                                    int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyr(handle, uplo, n, alpha, x_batch[b], incx, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
@@ -5343,8 +8003,17 @@ hipblasStatus_t hipblasDsyrBatched(hipblasHandle_t     handle,
                                    double* const       A[],
                                    int                 lda,
                                    int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyr(handle, uplo, n, alpha, x_batch[b], incx, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
@@ -5356,8 +8025,17 @@ hipblasStatus_t hipblasCsyrBatched(hipblasHandle_t             handle,
                                    hipblasComplex* const       A[],
                                    int                         lda,
                                    int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyr(handle, uplo, n, alpha, x_batch[b], incx, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
@@ -5369,8 +8047,17 @@ hipblasStatus_t hipblasZsyrBatched(hipblasHandle_t                   handle,
                                    hipblasDoubleComplex* const       A[],
                                    int                               lda,
                                    int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyr(handle, uplo, n, alpha, x_batch[b], incx, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr_strided_batched
@@ -5385,8 +8072,15 @@ hipblasStatus_t hipblasSsyrStridedBatched(hipblasHandle_t   handle,
                                           int               lda,
                                           hipblasStride     strideA,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyr(handle, uplo, n, alpha, x + b * stridex, incx, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
@@ -5400,8 +8094,15 @@ hipblasStatus_t hipblasDsyrStridedBatched(hipblasHandle_t   handle,
                                           int               lda,
                                           hipblasStride     strideA,
                                           int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyr(handle, uplo, n, alpha, x + b * stridex, incx, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
@@ -5415,8 +8116,15 @@ hipblasStatus_t hipblasCsyrStridedBatched(hipblasHandle_t       handle,
                                           int                   lda,
                                           hipblasStride         strideA,
                                           int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyr(handle, uplo, n, alpha, x + b * stridex, incx, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
@@ -5430,8 +8138,15 @@ hipblasStatus_t hipblasZsyrStridedBatched(hipblasHandle_t             handle,
                                           int                         lda,
                                           hipblasStride               strideA,
                                           int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyr(handle, uplo, n, alpha, x + b * stridex, incx, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr2
@@ -5543,8 +8258,19 @@ hipblasStatus_t hipblasSsyr2Batched(hipblasHandle_t    handle,
                                     float* const       A[],
                                     int                lda,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyr2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
@@ -5558,8 +8284,19 @@ hipblasStatus_t hipblasDsyr2Batched(hipblasHandle_t     handle,
                                     double* const       A[],
                                     int                 lda,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyr2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
@@ -5573,8 +8310,19 @@ hipblasStatus_t hipblasCsyr2Batched(hipblasHandle_t             handle,
                                     hipblasComplex* const       A[],
                                     int                         lda,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyr2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
@@ -5588,8 +8336,19 @@ hipblasStatus_t hipblasZsyr2Batched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       A[],
                                     int                               lda,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    auto y_batch = batched_emulation::pointers(handle, y, batchCount);
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyr2(
+            handle, uplo, n, alpha, x_batch[b], incx, y_batch[b], incy, A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr2_strided_batched
@@ -5607,8 +8366,24 @@ hipblasStatus_t hipblasSsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               lda,
                                            hipblasStride     strideA,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
@@ -5625,8 +8400,24 @@ hipblasStatus_t hipblasDsyr2StridedBatched(hipblasHandle_t   handle,
                                            int               lda,
                                            hipblasStride     strideA,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
@@ -5643,8 +8434,24 @@ hipblasStatus_t hipblasCsyr2StridedBatched(hipblasHandle_t       handle,
                                            int                   lda,
                                            hipblasStride         strideA,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
@@ -5661,8 +8468,24 @@ hipblasStatus_t hipblasZsyr2StridedBatched(hipblasHandle_t             handle,
                                            int                         lda,
                                            hipblasStride               strideA,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyr2(handle,
+                            uplo,
+                            n,
+                            alpha,
+                            x + b * stridex,
+                            incx,
+                            y + b * stridey,
+                            incy,
+                            A + b * strideA,
+                            lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbmv
@@ -5790,8 +8613,17 @@ hipblasStatus_t hipblasStbmvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasStbmv(handle, uplo, transA, diag, m, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
@@ -5805,8 +8637,17 @@ hipblasStatus_t hipblasDtbmvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDtbmv(handle, uplo, transA, diag, m, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
@@ -5820,8 +8661,17 @@ hipblasStatus_t hipblasCtbmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCtbmv(handle, uplo, transA, diag, m, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
@@ -5835,8 +8685,17 @@ hipblasStatus_t hipblasZtbmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZtbmv(handle, uplo, transA, diag, m, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbmv_strided_batched
@@ -5853,8 +8712,16 @@ hipblasStatus_t hipblasStbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasStbmv(
+            handle, uplo, transA, diag, m, k, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
@@ -5870,8 +8737,16 @@ hipblasStatus_t hipblasDtbmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDtbmv(
+            handle, uplo, transA, diag, m, k, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
@@ -5887,8 +8762,16 @@ hipblasStatus_t hipblasCtbmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stride_x,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCtbmv(
+            handle, uplo, transA, diag, m, k, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
@@ -5904,8 +8787,16 @@ hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stride_x,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZtbmv(
+            handle, uplo, transA, diag, m, k, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbsv
@@ -6033,8 +8924,17 @@ hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStbsv(handle, uplo, transA, diag, n, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
@@ -6048,8 +8948,17 @@ hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtbsv(handle, uplo, transA, diag, n, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
@@ -6063,8 +8972,17 @@ hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtbsv(handle, uplo, transA, diag, n, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
@@ -6078,8 +8996,17 @@ hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto x_batch = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtbsv(handle, uplo, transA, diag, n, k, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tbsv_strided_batched
@@ -6096,8 +9023,16 @@ hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStbsv(
+            handle, uplo, transA, diag, n, k, A + b * strideA, lda, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
@@ -6113,8 +9048,16 @@ hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtbsv(
+            handle, uplo, transA, diag, n, k, A + b * strideA, lda, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
@@ -6130,8 +9073,16 @@ hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtbsv(
+            handle, uplo, transA, diag, n, k, A + b * strideA, lda, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
@@ -6147,11 +9098,19 @@ hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtbsv(
+            handle, uplo, transA, diag, n, k, A + b * strideA, lda, x + b * stridex, incx);
+    });
 }
-
-// tpmv
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// tpmv
 hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
                              hipblasFillMode_t  uplo,
                              hipblasOperation_t transA,
@@ -6258,8 +9217,17 @@ hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStpmv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
@@ -6271,8 +9239,17 @@ hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtpmv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
@@ -6284,8 +9261,17 @@ hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtpmv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
@@ -6297,8 +9283,17 @@ hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtpmv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tpmv_strided_batched
@@ -6313,8 +9308,16 @@ hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStpmv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
@@ -6328,8 +9331,16 @@ hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtpmv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
@@ -6343,8 +9354,16 @@ hipblasStatus_t hipblasCtpmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtpmv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
@@ -6358,8 +9377,16 @@ hipblasStatus_t hipblasZtpmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtpmv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tpsv
@@ -6469,8 +9496,17 @@ hipblasStatus_t hipblasStpsvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStpsv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
@@ -6482,8 +9518,17 @@ hipblasStatus_t hipblasDtpsvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtpsv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
@@ -6495,8 +9540,17 @@ hipblasStatus_t hipblasCtpsvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtpsv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
@@ -6508,8 +9562,17 @@ hipblasStatus_t hipblasZtpsvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto x_batch  = batched_emulation::pointers(handle, x, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtpsv(handle, uplo, transA, diag, m, AP_batch[b], x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // tpsv_strided_batched
@@ -6524,8 +9587,16 @@ hipblasStatus_t hipblasStpsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStpsv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
@@ -6539,8 +9610,16 @@ hipblasStatus_t hipblasDtpsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtpsv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
@@ -6554,8 +9633,16 @@ hipblasStatus_t hipblasCtpsvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtpsv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
@@ -6569,8 +9656,16 @@ hipblasStatus_t hipblasZtpsvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtpsv(
+            handle, uplo, transA, diag, m, AP + b * strideAP, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trmv
@@ -6689,8 +9784,17 @@ hipblasStatus_t hipblasStrmvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasStrmv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
@@ -6703,8 +9807,17 @@ hipblasStatus_t hipblasDtrmvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDtrmv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
@@ -6717,8 +9830,17 @@ hipblasStatus_t hipblasCtrmvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCtrmv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
@@ -6731,8 +9853,17 @@ hipblasStatus_t hipblasZtrmvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZtrmv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trmv_strided_batched
@@ -6748,8 +9879,16 @@ hipblasStatus_t hipblasStrmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasStrmv(
+            handle, uplo, transA, diag, m, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
@@ -6764,8 +9903,16 @@ hipblasStatus_t hipblasDtrmvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stride_x,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDtrmv(
+            handle, uplo, transA, diag, m, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
@@ -6780,8 +9927,16 @@ hipblasStatus_t hipblasCtrmvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stride_x,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCtrmv(
+            handle, uplo, transA, diag, m, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
@@ -6796,8 +9951,16 @@ hipblasStatus_t hipblasZtrmvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stride_x,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZtrmv(
+            handle, uplo, transA, diag, m, A + b * stride_a, lda, x + b * stride_x, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trsv
@@ -6916,8 +10079,17 @@ hipblasStatus_t hipblasStrsvBatched(hipblasHandle_t    handle,
                                     float* const       x[],
                                     int                incx,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasStrsv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
@@ -6930,8 +10102,17 @@ hipblasStatus_t hipblasDtrsvBatched(hipblasHandle_t     handle,
                                     double* const       x[],
                                     int                 incx,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDtrsv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
@@ -6944,8 +10125,17 @@ hipblasStatus_t hipblasCtrsvBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       x[],
                                     int                         incx,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCtrsv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
@@ -6958,8 +10148,17 @@ hipblasStatus_t hipblasZtrsvBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       x[],
                                     int                               incx,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZtrsv(handle, uplo, transA, diag, m, A_batch[b], lda, x_batch[b], incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trsv_strided_batched
@@ -6975,8 +10174,16 @@ hipblasStatus_t hipblasStrsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasStrsv(
+            handle, uplo, transA, diag, m, A + b * strideA, lda, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
@@ -6991,8 +10198,16 @@ hipblasStatus_t hipblasDtrsvStridedBatched(hipblasHandle_t    handle,
                                            int                incx,
                                            hipblasStride      stridex,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDtrsv(
+            handle, uplo, transA, diag, m, A + b * strideA, lda, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
@@ -7007,8 +10222,16 @@ hipblasStatus_t hipblasCtrsvStridedBatched(hipblasHandle_t       handle,
                                            int                   incx,
                                            hipblasStride         stridex,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCtrsv(
+            handle, uplo, transA, diag, m, A + b * strideA, lda, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
@@ -7023,88 +10246,626 @@ hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t             handle,
                                            int                         incx,
                                            hipblasStride               stridex,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZtrsv(
+            handle, uplo, transA, diag, m, A + b * strideA, lda, x + b * stridex, incx);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 //------------------------------------------------------------------------------------------------------------
 
-// herk
-hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
-                             hipblasFillMode_t     uplo,
-                             hipblasOperation_t    transA,
-                             int                   n,
-                             int                   k,
-                             const float*          alpha,
-                             const hipblasComplex* A,
-                             int                   lda,
-                             const float*          beta,
-                             hipblasComplex*       C,
-                             int                   ldc)
+// tpttr
+hipblasStatus_t hipblasStpttr(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const float*      AP,
+                              float*            A,
+                              int               lda)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCherk((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  n,
-                                                  k,
-                                                  alpha,
-                                                  (cuComplex*)A,
-                                                  lda,
-                                                  beta,
-                                                  (cuComplex*)C,
-                                                  ldc));
+    return hipCUBLASStatusToHIPStatus(
+        cublasStpttr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, AP, A, lda));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
-                             hipblasFillMode_t           uplo,
-                             hipblasOperation_t          transA,
-                             int                         n,
-                             int                         k,
-                             const double*               alpha,
-                             const hipblasDoubleComplex* A,
-                             int                         lda,
-                             const double*               beta,
-                             hipblasDoubleComplex*       C,
-                             int                         ldc)
+hipblasStatus_t hipblasDtpttr(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const double*     AP,
+                              double*           A,
+                              int               lda)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZherk((cublasHandle_t)handle,
-                                                  hipFillToCudaFill(uplo),
-                                                  hipOperationToCudaOperation(transA),
-                                                  n,
-                                                  k,
-                                                  alpha,
-                                                  (cuDoubleComplex*)A,
-                                                  lda,
-                                                  beta,
-                                                  (cuDoubleComplex*)C,
-                                                  ldc));
+    return hipCUBLASStatusToHIPStatus(
+        cublasDtpttr((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, AP, A, lda));
 }
 catch(...)
 {
     return exception_to_hipblas_status();
 }
 
-// herk_batched
-hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
-                                    hipblasFillMode_t           uplo,
-                                    hipblasOperation_t          transA,
-                                    int                         n,
-                                    int                         k,
-                                    const float*                alpha,
+hipblasStatus_t hipblasCtpttr(hipblasHandle_t       handle,
+                              hipblasFillMode_t     uplo,
+                              int                   n,
+                              const hipblasComplex* AP,
+                              hipblasComplex*       A,
+                              int                   lda)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasCtpttr((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   n,
+                                                   (const cuComplex*)AP,
+                                                   (cuComplex*)A,
+                                                   lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpttr(hipblasHandle_t             handle,
+                              hipblasFillMode_t           uplo,
+                              int                         n,
+                              const hipblasDoubleComplex* AP,
+                              hipblasDoubleComplex*       A,
+                              int                         lda)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasZtpttr((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   n,
+                                                   (const cuDoubleComplex*)AP,
+                                                   (cuDoubleComplex*)A,
+                                                   lda));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// tpttrBatched
+hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     int                n,
+                                     const float* const AP[],
+                                     float* const       A[],
+                                     int                lda,
+                                     int                batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStpttr(handle, uplo, n, AP_batch[b], A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     const double* const AP[],
+                                     double* const       A[],
+                                     int                 lda,
+                                     int                 batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtpttr(handle, uplo, n, AP_batch[b], A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     int                         n,
+                                     const hipblasComplex* const AP[],
+                                     hipblasComplex* const       A[],
+                                     int                         lda,
+                                     int                         batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtpttr(handle, uplo, n, AP_batch[b], A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const AP[],
+                                     hipblasDoubleComplex* const       A[],
+                                     int                               lda,
+                                     int                               batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtpttr(handle, uplo, n, AP_batch[b], A_batch[b], lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// tpttrStridedBatched
+hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      AP,
+                                            hipblasStride     strideAP,
+                                            float*            A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            int               batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStpttr(handle, uplo, n, AP + b * strideAP, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     AP,
+                                            hipblasStride     strideAP,
+                                            double*           A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            int               batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtpttr(handle, uplo, n, AP + b * strideAP, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* AP,
+                                            hipblasStride         strideAP,
+                                            hipblasComplex*       A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            int                   batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtpttr(handle, uplo, n, AP + b * strideAP, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* AP,
+                                            hipblasStride               strideAP,
+                                            hipblasDoubleComplex*       A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            int                         batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtpttr(handle, uplo, n, AP + b * strideAP, A + b * strideA, lda);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trttp
+hipblasStatus_t hipblasStrttp(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const float*      A,
+                              int               lda,
+                              float*            AP)
+try
+{
+    return hipCUBLASStatusToHIPStatus(
+        cublasStrttp((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, A, lda, AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttp(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               n,
+                              const double*     A,
+                              int               lda,
+                              double*           AP)
+try
+{
+    return hipCUBLASStatusToHIPStatus(
+        cublasDtrttp((cublasHandle_t)handle, hipFillToCudaFill(uplo), n, A, lda, AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttp(hipblasHandle_t       handle,
+                              hipblasFillMode_t     uplo,
+                              int                   n,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              hipblasComplex*       AP)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasCtrttp((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   n,
+                                                   (const cuComplex*)A,
+                                                   lda,
+                                                   (cuComplex*)AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttp(hipblasHandle_t             handle,
+                              hipblasFillMode_t           uplo,
+                              int                         n,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              hipblasDoubleComplex*       AP)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasZtrttp((cublasHandle_t)handle,
+                                                   hipFillToCudaFill(uplo),
+                                                   n,
+                                                   (const cuDoubleComplex*)A,
+                                                   lda,
+                                                   (cuDoubleComplex*)AP));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trttpBatched
+hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     int                n,
+                                     const float* const A[],
+                                     int                lda,
+                                     float* const       AP[],
+                                     int                batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStrttp(handle, uplo, n, A_batch[b], lda, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     const double* const A[],
+                                     int                 lda,
+                                     double* const       AP[],
+                                     int                 batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtrttp(handle, uplo, n, A_batch[b], lda, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     int                         n,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     hipblasComplex* const       AP[],
+                                     int                         batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtrttp(handle, uplo, n, A_batch[b], lda, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     hipblasDoubleComplex* const       AP[],
+                                     int                               batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    auto AP_batch = batched_emulation::pointers(handle, AP, batchCount);
+    auto A_batch  = batched_emulation::pointers(handle, A, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtrttp(handle, uplo, n, A_batch[b], lda, AP_batch[b]);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// trttpStridedBatched
+hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const float*      A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            float*            AP,
+                                            hipblasStride     strideAP,
+                                            int               batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasStrttp(handle, uplo, n, A + b * strideA, lda, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               n,
+                                            const double*     A,
+                                            int               lda,
+                                            hipblasStride     strideA,
+                                            double*           AP,
+                                            hipblasStride     strideAP,
+                                            int               batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDtrttp(handle, uplo, n, A + b * strideA, lda, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   n,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasStride         strideA,
+                                            hipblasComplex*       AP,
+                                            hipblasStride         strideAP,
+                                            int                   batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCtrttp(handle, uplo, n, A + b * strideA, lda, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         n,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            hipblasStride               strideA,
+                                            hipblasDoubleComplex*       AP,
+                                            hipblasStride               strideAP,
+                                            int                         batchCount)
+try
+{
+    hipblasStatus_t status = hipblas_packed_arguments(handle, uplo, n, lda, batchCount);
+    if(status != HIPBLAS_STATUS_SUCCESS || !n || !batchCount)
+        return status;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZtrttp(handle, uplo, n, A + b * strideA, lda, AP + b * strideAP);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+//------------------------------------------------------------------------------------------------------------
+
+// herk
+hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
+                             hipblasFillMode_t     uplo,
+                             hipblasOperation_t    transA,
+                             int                   n,
+                             int                   k,
+                             const float*          alpha,
+                             const hipblasComplex* A,
+                             int                   lda,
+                             const float*          beta,
+                             hipblasComplex*       C,
+                             int                   ldc)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasCherk((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  (cuComplex*)A,
+                                                  lda,
+                                                  beta,
+                                                  (cuComplex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
+                             hipblasFillMode_t           uplo,
+                             hipblasOperation_t          transA,
+                             int                         n,
+                             int                         k,
+                             const double*               alpha,
+                             const hipblasDoubleComplex* A,
+                             int                         lda,
+                             const double*               beta,
+                             hipblasDoubleComplex*       C,
+                             int                         ldc)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasZherk((cublasHandle_t)handle,
+                                                  hipFillToCudaFill(uplo),
+                                                  hipOperationToCudaOperation(transA),
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  (cuDoubleComplex*)A,
+                                                  lda,
+                                                  beta,
+                                                  (cuDoubleComplex*)C,
+                                                  ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// herk_batched
+hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    int                         n,
+                                    int                         k,
+                                    const float*                alpha,
                                     const hipblasComplex* const A[],
                                     int                         lda,
                                     const float*                beta,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCherk(
+            handle, uplo, transA, n, k, alpha, A_batch[b], lda, beta, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
@@ -7119,8 +10880,18 @@ hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZherk(
+            handle, uplo, transA, n, k, alpha, A_batch[b], lda, beta, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // herk_strided_batched
@@ -7138,8 +10909,16 @@ hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
                                            int                   ldc,
                                            hipblasStride         strideC,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCherk(
+            handle, uplo, transA, n, k, alpha, A + b * strideA, lda, beta, C + b * strideC, ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
@@ -7156,8 +10935,68 @@ hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
                                            int                         ldc,
                                            hipblasStride               strideC,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZherk(
+            handle, uplo, transA, n, k, alpha, A + b * strideA, lda, beta, C + b * strideC, ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCherkBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int                         n,
+                                            int                         k,
+                                            const float*                alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const float*                beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    // batched herk is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCherk(handle, uplo, transA, n, k, alpha, A[b], lda, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZherkBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int                               n,
+                                            int                               k,
+                                            const double*                     alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const double*                     beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    // batched herk is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZherk(handle, uplo, transA, n, k, alpha, A[b], lda, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // herkx
@@ -7244,8 +11083,30 @@ hipblasStatus_t hipblasCherkxBatched(hipblasHandle_t             handle,
                                      hipblasComplex* const       C[],
                                      int                         ldc,
                                      int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCherkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t                   handle,
@@ -7262,8 +11123,30 @@ hipblasStatus_t hipblasZherkxBatched(hipblasHandle_t                   handle,
                                      hipblasDoubleComplex* const       C[],
                                      int                               ldc,
                                      int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZherkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // herkx_strided_batched
@@ -7284,8 +11167,27 @@ hipblasStatus_t hipblasCherkxStridedBatched(hipblasHandle_t       handle,
                                             int                   ldc,
                                             hipblasStride         strideC,
                                             int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCherkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t             handle,
@@ -7305,8 +11207,27 @@ hipblasStatus_t hipblasZherkxStridedBatched(hipblasHandle_t             handle,
                                             int                         ldc,
                                             hipblasStride               strideC,
                                             int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZherkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her2k
@@ -7393,8 +11314,30 @@ hipblasStatus_t hipblasCher2kBatched(hipblasHandle_t             handle,
                                      hipblasComplex* const       C[],
                                      int                         ldc,
                                      int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCher2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t                   handle,
@@ -7411,8 +11354,30 @@ hipblasStatus_t hipblasZher2kBatched(hipblasHandle_t                   handle,
                                      hipblasDoubleComplex* const       C[],
                                      int                               ldc,
                                      int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZher2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // her2k_strided_batched
@@ -7433,8 +11398,27 @@ hipblasStatus_t hipblasCher2kStridedBatched(hipblasHandle_t       handle,
                                             int                   ldc,
                                             hipblasStride         strideC,
                                             int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCher2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t             handle,
@@ -7454,8 +11438,27 @@ hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t             handle,
                                             int                         ldc,
                                             hipblasStride               strideC,
                                             int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZher2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // symm
@@ -7610,8 +11613,30 @@ hipblasStatus_t hipblasSsymmBatched(hipblasHandle_t    handle,
                                     float* const       C[],
                                     int                ldc,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            B_batch[b],
+                            ldb,
+                            beta,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
@@ -7628,8 +11653,30 @@ hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
                                     double* const       C[],
                                     int                 ldc,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            B_batch[b],
+                            ldb,
+                            beta,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
@@ -7646,8 +11693,30 @@ hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            B_batch[b],
+                            ldb,
+                            beta,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
@@ -7664,8 +11733,30 @@ hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            B_batch[b],
+                            ldb,
+                            beta,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // symm_strided_batched
@@ -7686,8 +11777,27 @@ hipblasStatus_t hipblasSsymmStridedBatched(hipblasHandle_t   handle,
                                            int               ldc,
                                            hipblasStride     strideC,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb,
+                            beta,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
@@ -7707,8 +11817,27 @@ hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
                                            int               ldc,
                                            hipblasStride     strideC,
                                            int               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb,
+                            beta,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
@@ -7728,8 +11857,27 @@ hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
                                            int                   ldc,
                                            hipblasStride         strideC,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb,
+                            beta,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
@@ -7749,8 +11897,139 @@ hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
                                            int                         ldc,
                                            hipblasStride               strideC,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsymm(handle,
+                            side,
+                            uplo,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb,
+                            beta,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsymmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float* const B[],
+                                            int                ldb,
+                                            const float*       beta,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    // batched symm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsymm(handle, side, uplo, m, n, alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsymmBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasFillMode_t   uplo,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double* const B[],
+                                            int                 ldb,
+                                            const double*       beta,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    // batched symm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsymm(handle, side, uplo, m, n, alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsymmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex* const B[],
+                                            int                         ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    // batched symm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsymm(handle, side, uplo, m, n, alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsymmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasSideMode_t                 side,
+                                            hipblasFillMode_t                 uplo,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int                               ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    // batched symm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsymm(handle, side, uplo, m, n, alpha, A[b], lda, B[b], ldb, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syrk
@@ -7887,8 +12166,18 @@ hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
                                     float* const       C[],
                                     int                ldc,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyrk(
+            handle, uplo, transA, n, k, alpha, A_batch[b], lda, beta, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
@@ -7903,8 +12192,18 @@ hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
                                     double* const       C[],
                                     int                 ldc,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyrk(
+            handle, uplo, transA, n, k, alpha, A_batch[b], lda, beta, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
@@ -7919,8 +12218,18 @@ hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyrk(
+            handle, uplo, transA, n, k, alpha, A_batch[b], lda, beta, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
@@ -7935,8 +12244,18 @@ hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyrk(
+            handle, uplo, transA, n, k, alpha, A_batch[b], lda, beta, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syrk_strided_batched
@@ -7954,62 +12273,198 @@ hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    handle,
                                            int                ldc,
                                            hipblasStride      strideC,
                                            int                batchCount)
+try
+{
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyrk(
+            handle, uplo, transA, n, k, alpha, A + b * strideA, lda, beta, C + b * strideC, ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           int                n,
+                                           int                k,
+                                           const double*      alpha,
+                                           const double*      A,
+                                           int                lda,
+                                           hipblasStride      strideA,
+                                           const double*      beta,
+                                           double*            C,
+                                           int                ldc,
+                                           hipblasStride      strideC,
+                                           int                batchCount)
+try
+{
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyrk(
+            handle, uplo, transA, n, k, alpha, A + b * strideA, lda, beta, C + b * strideC, ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
+                                           hipblasFillMode_t     uplo,
+                                           hipblasOperation_t    transA,
+                                           int                   n,
+                                           int                   k,
+                                           const hipblasComplex* alpha,
+                                           const hipblasComplex* A,
+                                           int                   lda,
+                                           hipblasStride         strideA,
+                                           const hipblasComplex* beta,
+                                           hipblasComplex*       C,
+                                           int                   ldc,
+                                           hipblasStride         strideC,
+                                           int                   batchCount)
+try
+{
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyrk(
+            handle, uplo, transA, n, k, alpha, A + b * strideA, lda, beta, C + b * strideC, ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           int                         n,
+                                           int                         k,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* A,
+                                           int                         lda,
+                                           hipblasStride               strideA,
+                                           const hipblasDoubleComplex* beta,
+                                           hipblasDoubleComplex*       C,
+                                           int                         ldc,
+                                           hipblasStride               strideC,
+                                           int                         batchCount)
+try
+{
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyrk(
+            handle, uplo, transA, n, k, alpha, A + b * strideA, lda, beta, C + b * strideC, ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSsyrkBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float*       beta,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    // batched syrk is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyrk(handle, uplo, transA, n, k, alpha, A[b], lda, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDsyrkBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            hipblasOperation_t  transA,
+                                            int                 n,
+                                            int                 k,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double*       beta,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    // batched syrk is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyrk(handle, uplo, transA, n, k, alpha, A[b], lda, beta, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCsyrkBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // batched syrk is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyrk(handle, uplo, transA, n, k, alpha, A[b], lda, beta, C[b], ldc);
+    });
 }
-
-hipblasStatus_t hipblasDsyrkStridedBatched(hipblasHandle_t    handle,
-                                           hipblasFillMode_t  uplo,
-                                           hipblasOperation_t transA,
-                                           int                n,
-                                           int                k,
-                                           const double*      alpha,
-                                           const double*      A,
-                                           int                lda,
-                                           hipblasStride      strideA,
-                                           const double*      beta,
-                                           double*            C,
-                                           int                ldc,
-                                           hipblasStride      strideC,
-                                           int                batchCount)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasCsyrkStridedBatched(hipblasHandle_t       handle,
-                                           hipblasFillMode_t     uplo,
-                                           hipblasOperation_t    transA,
-                                           int                   n,
-                                           int                   k,
-                                           const hipblasComplex* alpha,
-                                           const hipblasComplex* A,
-                                           int                   lda,
-                                           hipblasStride         strideA,
-                                           const hipblasComplex* beta,
-                                           hipblasComplex*       C,
-                                           int                   ldc,
-                                           hipblasStride         strideC,
-                                           int                   batchCount)
+hipblasStatus_t hipblasZsyrkBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            int                               n,
+                                            int                               k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // batched syrk is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyrk(handle, uplo, transA, n, k, alpha, A[b], lda, beta, C[b], ldc);
+    });
 }
-
-hipblasStatus_t hipblasZsyrkStridedBatched(hipblasHandle_t             handle,
-                                           hipblasFillMode_t           uplo,
-                                           hipblasOperation_t          transA,
-                                           int                         n,
-                                           int                         k,
-                                           const hipblasDoubleComplex* alpha,
-                                           const hipblasDoubleComplex* A,
-                                           int                         lda,
-                                           hipblasStride               strideA,
-                                           const hipblasDoubleComplex* beta,
-                                           hipblasDoubleComplex*       C,
-                                           int                         ldc,
-                                           hipblasStride               strideC,
-                                           int                         batchCount)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
 // syr2k
@@ -8164,8 +12619,30 @@ hipblasStatus_t hipblasSsyr2kBatched(hipblasHandle_t    handle,
                                      float* const       C[],
                                      int                ldc,
                                      int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
@@ -8182,8 +12659,30 @@ hipblasStatus_t hipblasDsyr2kBatched(hipblasHandle_t     handle,
                                      double* const       C[],
                                      int                 ldc,
                                      int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t             handle,
@@ -8200,8 +12699,30 @@ hipblasStatus_t hipblasCsyr2kBatched(hipblasHandle_t             handle,
                                      hipblasComplex* const       C[],
                                      int                         ldc,
                                      int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t                   handle,
@@ -8218,8 +12739,30 @@ hipblasStatus_t hipblasZsyr2kBatched(hipblasHandle_t                   handle,
                                      hipblasDoubleComplex* const       C[],
                                      int                               ldc,
                                      int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syr2k_strided_batched
@@ -8240,8 +12783,27 @@ hipblasStatus_t hipblasSsyr2kStridedBatched(hipblasHandle_t    handle,
                                             int                ldc,
                                             hipblasStride      strideC,
                                             int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    handle,
@@ -8261,8 +12823,27 @@ hipblasStatus_t hipblasDsyr2kStridedBatched(hipblasHandle_t    handle,
                                             int                ldc,
                                             hipblasStride      strideC,
                                             int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t       handle,
@@ -8282,8 +12863,27 @@ hipblasStatus_t hipblasCsyr2kStridedBatched(hipblasHandle_t       handle,
                                             int                   ldc,
                                             hipblasStride         strideC,
                                             int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t             handle,
@@ -8303,8 +12903,27 @@ hipblasStatus_t hipblasZsyr2kStridedBatched(hipblasHandle_t             handle,
                                             int                         ldc,
                                             hipblasStride               strideC,
                                             int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyr2k(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syrkx
@@ -8459,8 +13078,30 @@ hipblasStatus_t hipblasSsyrkxBatched(hipblasHandle_t    handle,
                                      float* const       C[],
                                      int                ldc,
                                      int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
@@ -8477,8 +13118,30 @@ hipblasStatus_t hipblasDsyrkxBatched(hipblasHandle_t     handle,
                                      double* const       C[],
                                      int                 ldc,
                                      int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t             handle,
@@ -8495,8 +13158,30 @@ hipblasStatus_t hipblasCsyrkxBatched(hipblasHandle_t             handle,
                                      hipblasComplex* const       C[],
                                      int                         ldc,
                                      int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t                   handle,
@@ -8513,8 +13198,30 @@ hipblasStatus_t hipblasZsyrkxBatched(hipblasHandle_t                   handle,
                                      hipblasDoubleComplex* const       C[],
                                      int                               ldc,
                                      int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A_batch[b],
+                             lda,
+                             B_batch[b],
+                             ldb,
+                             beta,
+                             C_batch[b],
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // syrkx_strided_batched
@@ -8535,8 +13242,27 @@ hipblasStatus_t hipblasSsyrkxStridedBatched(hipblasHandle_t    handle,
                                             int                ldc,
                                             hipblasStride      strideC,
                                             int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    handle,
@@ -8556,8 +13282,27 @@ hipblasStatus_t hipblasDsyrkxStridedBatched(hipblasHandle_t    handle,
                                             int                ldc,
                                             hipblasStride      strideC,
                                             int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t       handle,
@@ -8577,8 +13322,27 @@ hipblasStatus_t hipblasCsyrkxStridedBatched(hipblasHandle_t       handle,
                                             int                   ldc,
                                             hipblasStride         strideC,
                                             int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t             handle,
@@ -8598,8 +13362,27 @@ hipblasStatus_t hipblasZsyrkxStridedBatched(hipblasHandle_t             handle,
                                             int                         ldc,
                                             hipblasStride               strideC,
                                             int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZsyrkx(handle,
+                             uplo,
+                             transA,
+                             n,
+                             k,
+                             alpha,
+                             A + b * strideA,
+                             lda,
+                             B + b * strideB,
+                             ldb,
+                             beta,
+                             C + b * strideC,
+                             ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // geam
@@ -8754,8 +13537,30 @@ hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
                                     float* const       C[],
                                     int                ldc,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            beta,
+                            B_batch[b],
+                            ldb,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
@@ -8772,8 +13577,30 @@ hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
                                     double* const       C[],
                                     int                 ldc,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            beta,
+                            B_batch[b],
+                            ldb,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
@@ -8790,8 +13617,30 @@ hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            beta,
+                            B_batch[b],
+                            ldb,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
@@ -8808,8 +13657,30 @@ hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            beta,
+                            B_batch[b],
+                            ldb,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // geam_strided_batched
@@ -8830,8 +13701,27 @@ hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
                                            int                ldc,
                                            hipblasStride      strideC,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            beta,
+                            B + b * strideB,
+                            ldb,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
@@ -8851,8 +13741,27 @@ hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
                                            int                ldc,
                                            hipblasStride      strideC,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            beta,
+                            B + b * strideB,
+                            ldb,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
@@ -8872,29 +13781,183 @@ hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
                                            int                   ldc,
                                            hipblasStride         strideC,
                                            int                   batchCount)
+try
+{
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            beta,
+                            B + b * strideB,
+                            ldb,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
+                                           hipblasOperation_t          transa,
+                                           hipblasOperation_t          transb,
+                                           int                         m,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           const hipblasDoubleComplex* A,
+                                           int                         lda,
+                                           hipblasStride               strideA,
+                                           const hipblasDoubleComplex* beta,
+                                           const hipblasDoubleComplex* B,
+                                           int                         ldb,
+                                           hipblasStride               strideB,
+                                           hipblasDoubleComplex*       C,
+                                           int                         ldc,
+                                           hipblasStride               strideC,
+                                           int                         batchCount)
+try
+{
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgeam(handle,
+                            transa,
+                            transb,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            beta,
+                            B + b * strideB,
+                            ldb,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgeamBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float*       beta,
+                                            const float* const B[],
+                                            int                ldb,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    // batched geam is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasSgeam(
+            handle, transa, transb, m, n, alpha, A[b], lda, beta, B[b], ldb, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgeamBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasOperation_t  transa,
+                                            hipblasOperation_t  transb,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double*       beta,
+                                            const double* const B[],
+                                            int                 ldb,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    // batched geam is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasDgeam(
+            handle, transa, transb, m, n, alpha, A[b], lda, beta, B[b], ldb, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgeamBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex*       beta,
+                                            const hipblasComplex* const B[],
+                                            int                         ldb,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // batched geam is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasCgeam(
+            handle, transa, transb, m, n, alpha, A[b], lda, beta, B[b], ldb, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
-hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
-                                           hipblasOperation_t          transa,
-                                           hipblasOperation_t          transb,
-                                           int                         m,
-                                           int                         n,
-                                           const hipblasDoubleComplex* alpha,
-                                           const hipblasDoubleComplex* A,
-                                           int                         lda,
-                                           hipblasStride               strideA,
-                                           const hipblasDoubleComplex* beta,
-                                           const hipblasDoubleComplex* B,
-                                           int                         ldb,
-                                           hipblasStride               strideB,
-                                           hipblasDoubleComplex*       C,
-                                           int                         ldc,
-                                           hipblasStride               strideC,
-                                           int                         batchCount)
+hipblasStatus_t hipblasZgeamBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasOperation_t                transa,
+                                            hipblasOperation_t                transb,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex*       beta,
+                                            const hipblasDoubleComplex* const B[],
+                                            int                               ldb,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // batched geam is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B || !C))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgeam(
+            handle, transa, transb, m, n, alpha, A[b], lda, beta, B[b], ldb, C[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hemm
@@ -8981,8 +14044,30 @@ hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChemm(handle,
+                            side,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            B_batch[b],
+                            ldb,
+                            beta,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
@@ -8999,8 +14084,30 @@ hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto C_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhemm(handle,
+                            side,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A_batch[b],
+                            lda,
+                            B_batch[b],
+                            ldb,
+                            beta,
+                            C_batch[b],
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // hemm_strided_batched
@@ -9021,8 +14128,27 @@ hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
                                            int                   ldc,
                                            hipblasStride         strideC,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasChemm(handle,
+                            side,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb,
+                            beta,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
@@ -9042,8 +14168,27 @@ hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
                                            int                         ldc,
                                            hipblasStride               strideC,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZhemm(handle,
+                            side,
+                            uplo,
+                            n,
+                            k,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb,
+                            beta,
+                            C + b * strideC,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trmm
@@ -9200,8 +14345,30 @@ hipblasStatus_t hipblasStrmmBatched(hipblasHandle_t    handle,
                                     float* const       B[],
                                     int                ldb,
                                     int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasStrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A_batch[b],
+                                                      lda,
+                                                      B_batch[b],
+                                                      ldb,
+                                                      B_batch[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
@@ -9217,8 +14384,30 @@ hipblasStatus_t hipblasDtrmmBatched(hipblasHandle_t     handle,
                                     double* const       B[],
                                     int                 ldb,
                                     int                 batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasDtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A_batch[b],
+                                                      lda,
+                                                      B_batch[b],
+                                                      ldb,
+                                                      B_batch[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
@@ -9234,8 +14423,30 @@ hipblasStatus_t hipblasCtrmmBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       B[],
                                     int                         ldb,
                                     int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasCtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      (cuComplex*)alpha,
+                                                      (cuComplex*)A_batch[b],
+                                                      lda,
+                                                      (cuComplex*)B_batch[b],
+                                                      ldb,
+                                                      (cuComplex*)B_batch[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
@@ -9251,8 +14462,30 @@ hipblasStatus_t hipblasZtrmmBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       B[],
                                     int                               ldb,
                                     int                               batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto B_batch = batched_emulation::pointers(handle, B, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasZtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      (cuDoubleComplex*)alpha,
+                                                      (cuDoubleComplex*)A_batch[b],
+                                                      lda,
+                                                      (cuDoubleComplex*)B_batch[b],
+                                                      ldb,
+                                                      (cuDoubleComplex*)B_batch[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trmm_strided_batched
@@ -9271,8 +14504,28 @@ hipblasStatus_t hipblasStrmmStridedBatched(hipblasHandle_t    handle,
                                            int                ldb,
                                            hipblasStride      strideB,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasStrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A + b * strideA,
+                                                      lda,
+                                                      B + b * strideB,
+                                                      ldb,
+                                                      B + b * strideB,
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
@@ -9290,8 +14543,28 @@ hipblasStatus_t hipblasDtrmmStridedBatched(hipblasHandle_t    handle,
                                            int                ldb,
                                            hipblasStride      strideB,
                                            int                batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasDtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A + b * strideA,
+                                                      lda,
+                                                      B + b * strideB,
+                                                      ldb,
+                                                      B + b * strideB,
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
@@ -9309,8 +14582,28 @@ hipblasStatus_t hipblasCtrmmStridedBatched(hipblasHandle_t       handle,
                                            int                   ldb,
                                            hipblasStride         strideB,
                                            int                   batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasCtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      (cuComplex*)alpha,
+                                                      (cuComplex*)(A + b * strideA),
+                                                      lda,
+                                                      (cuComplex*)(B + b * strideB),
+                                                      ldb,
+                                                      (cuComplex*)(B + b * strideB),
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
@@ -9328,8 +14621,188 @@ hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t             handle,
                                            int                         ldb,
                                            hipblasStride               strideB,
                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasZtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      (cuDoubleComplex*)alpha,
+                                                      (cuDoubleComplex*)(A + b * strideA),
+                                                      lda,
+                                                      (cuDoubleComplex*)(B + b * strideB),
+                                                      ldb,
+                                                      (cuDoubleComplex*)(B + b * strideB),
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrmmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            float* const       B[],
+                                            int                ldb,
+                                            int                batchCount)
+try
+{
+    // batched trmm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasStrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A[b],
+                                                      lda,
+                                                      B[b],
+                                                      ldb,
+                                                      B[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrmmBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasFillMode_t   uplo,
+                                            hipblasOperation_t  transA,
+                                            hipblasDiagType_t   diag,
+                                            int                 m,
+                                            int                 n,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       B[],
+                                            int                 ldb,
+                                            int                 batchCount)
+try
+{
+    // batched trmm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasDtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      alpha,
+                                                      A[b],
+                                                      lda,
+                                                      B[b],
+                                                      ldb,
+                                                      B[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrmmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            hipblasComplex* const       B[],
+                                            int                         ldb,
+                                            int                         batchCount)
+try
+{
+    // batched trmm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasCtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      (cuComplex*)alpha,
+                                                      (cuComplex*)A[b],
+                                                      lda,
+                                                      (cuComplex*)B[b],
+                                                      ldb,
+                                                      (cuComplex*)B[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrmmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasSideMode_t                 side,
+                                            hipblasFillMode_t                 uplo,
+                                            hipblasOperation_t                transA,
+                                            hipblasDiagType_t                 diag,
+                                            int                               m,
+                                            int                               n,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            hipblasDoubleComplex* const       B[],
+                                            int                               ldb,
+                                            int                               batchCount)
+try
+{
+    // batched trmm is emulated here, so the instances are issued straight from the host arrays
+    if(batchCount > 0 && (!A || !B))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasZtrmm((cublasHandle_t)handle,
+                                                      hipSideToCudaSide(side),
+                                                      hipFillToCudaFill(uplo),
+                                                      hipOperationToCudaOperation(transA),
+                                                      hipDiagonalToCudaDiagonal(diag),
+                                                      m,
+                                                      n,
+                                                      (cuDoubleComplex*)alpha,
+                                                      (cuDoubleComplex*)A[b],
+                                                      lda,
+                                                      (cuDoubleComplex*)B[b],
+                                                      ldb,
+                                                      (cuDoubleComplex*)B[b],
+                                                      ldb));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // trsm
@@ -9614,8 +15087,26 @@ hipblasStatus_t hipblasStrsmStridedBatched(hipblasHandle_t    handle,
                                            int                ldb,
                                            hipblasStride      strideB,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasStrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
@@ -9633,8 +15124,26 @@ hipblasStatus_t hipblasDtrsmStridedBatched(hipblasHandle_t    handle,
                                            int                ldb,
                                            hipblasStride      strideB,
                                            int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDtrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
@@ -9652,27 +15161,211 @@ hipblasStatus_t hipblasCtrsmStridedBatched(hipblasHandle_t       handle,
                                            int                   ldb,
                                            hipblasStride         strideB,
                                            int                   batch_count)
+try
+{
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCtrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
+                                           hipblasSideMode_t           side,
+                                           hipblasFillMode_t           uplo,
+                                           hipblasOperation_t          transA,
+                                           hipblasDiagType_t           diag,
+                                           int                         m,
+                                           int                         n,
+                                           const hipblasDoubleComplex* alpha,
+                                           hipblasDoubleComplex*       A,
+                                           int                         lda,
+                                           hipblasStride               strideA,
+                                           hipblasDoubleComplex*       B,
+                                           int                         ldb,
+                                           hipblasStride               strideB,
+                                           int                         batch_count)
+try
+{
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZtrsm(handle,
+                            side,
+                            uplo,
+                            transA,
+                            diag,
+                            m,
+                            n,
+                            alpha,
+                            A + b * strideA,
+                            lda,
+                            B + b * strideB,
+                            ldb);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasStrsmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const float*       alpha,
+                                            float* const       A[],
+                                            int                lda,
+                                            float*             B[],
+                                            int                ldb,
+                                            int                batchCount)
+try
+{
+    // strided batched trsm is emulated here, so even uniform arrays go to cublas batched
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasStrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (float* const*)arrays,
+                               lda,
+                               (float**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDtrsmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasSideMode_t  side,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            int                n,
+                                            const double*      alpha,
+                                            double* const      A[],
+                                            int                lda,
+                                            double*            B[],
+                                            int                ldb,
+                                            int                batchCount)
+try
+{
+    // strided batched trsm is emulated here, so even uniform arrays go to cublas batched
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasDtrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (double* const*)arrays,
+                               lda,
+                               (double**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCtrsmBatchedHostPtrs(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            hipblasComplex* const A[],
+                                            int                   lda,
+                                            hipblasComplex*       B[],
+                                            int                   ldb,
+                                            int                   batchCount)
+try
+{
+    // strided batched trsm is emulated here, so even uniform arrays go to cublas batched
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasCtrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (hipblasComplex* const*)arrays,
+                               lda,
+                               (hipblasComplex**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZtrsmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            hipblasDoubleComplex* const A[],
+                                            int                         lda,
+                                            hipblasDoubleComplex*       B[],
+                                            int                         ldb,
+                                            int                         batchCount)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    // strided batched trsm is emulated here, so even uniform arrays go to cublas batched
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B});
+    return hipblasZtrsmBatched(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               (hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               (hipblasDoubleComplex**)(arrays + batchCount),
+                               ldb,
+                               batchCount);
 }
-
-hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t             handle,
-                                           hipblasSideMode_t           side,
-                                           hipblasFillMode_t           uplo,
-                                           hipblasOperation_t          transA,
-                                           hipblasDiagType_t           diag,
-                                           int                         m,
-                                           int                         n,
-                                           const hipblasDoubleComplex* alpha,
-                                           hipblasDoubleComplex*       A,
-                                           int                         lda,
-                                           hipblasStride               strideA,
-                                           hipblasDoubleComplex*       B,
-                                           int                         ldb,
-                                           hipblasStride               strideB,
-                                           int                         batch_count)
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
 // trtri
@@ -9947,8 +15640,18 @@ hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
                                     float* const       C[],
                                     int                ldc,
                                     int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto C_batch = batched_emulation::pointers(handle, C, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasSdgmm(handle, side, m, n, A_batch[b], lda, x_batch[b], incx, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
@@ -9962,8 +15665,18 @@ hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
                                     double* const       C[],
                                     int                 ldc,
                                     int                 batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto C_batch = batched_emulation::pointers(handle, C, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDdgmm(handle, side, m, n, A_batch[b], lda, x_batch[b], incx, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
@@ -9977,8 +15690,18 @@ hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
                                     hipblasComplex* const       C[],
                                     int                         ldc,
                                     int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto C_batch = batched_emulation::pointers(handle, C, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCdgmm(handle, side, m, n, A_batch[b], lda, x_batch[b], incx, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
@@ -9992,8 +15715,18 @@ hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
                                     hipblasDoubleComplex* const       C[],
                                     int                               ldc,
                                     int                               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto A_batch = batched_emulation::pointers(handle, A, batch_count);
+    auto x_batch = batched_emulation::pointers(handle, x, batch_count);
+    auto C_batch = batched_emulation::pointers(handle, C, batch_count);
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZdgmm(handle, side, m, n, A_batch[b], lda, x_batch[b], incx, C_batch[b], ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // dgmm_strided_batched
@@ -10011,8 +15744,24 @@ hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
                                            int               ldc,
                                            hipblasStride     stride_C,
                                            int               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasSdgmm(handle,
+                            side,
+                            m,
+                            n,
+                            A + b * stride_A,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            C + b * stride_C,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
@@ -10029,8 +15778,24 @@ hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
                                            int               ldc,
                                            hipblasStride     stride_C,
                                            int               batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasDdgmm(handle,
+                            side,
+                            m,
+                            n,
+                            A + b * stride_A,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            C + b * stride_C,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
@@ -10047,8 +15812,24 @@ hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
                                            int                   ldc,
                                            hipblasStride         stride_C,
                                            int                   batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasCdgmm(handle,
+                            side,
+                            m,
+                            n,
+                            A + b * stride_A,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            C + b * stride_C,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
@@ -10065,8 +15846,24 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
                                            int                         ldc,
                                            hipblasStride               stride_C,
                                            int                         batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipblasZdgmm(handle,
+                            side,
+                            m,
+                            n,
+                            A + b * stride_A,
+                            lda,
+                            x + b * stride_x,
+                            incx,
+                            C + b * stride_C,
+                            ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 #ifdef __HIP_PLATFORM_SOLVER__
@@ -10074,20 +15871,41 @@ hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
 // getrf
 hipblasStatus_t hipblasSgetrf(
     hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays = batched_emulation::device_pointers(handle, 1, {{A, 0}});
+    return hipCUBLASStatusToHIPStatus(cublasSgetrfBatched(
+        (cublasHandle_t)handle, n, (float**)arrays, lda, ipiv, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgetrf(
     hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays = batched_emulation::device_pointers(handle, 1, {{A, 0}});
+    return hipCUBLASStatusToHIPStatus(cublasDgetrfBatched(
+        (cublasHandle_t)handle, n, (double**)arrays, lda, ipiv, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgetrf(
     hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays = batched_emulation::device_pointers(handle, 1, {{A, 0}});
+    return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
+        (cublasHandle_t)handle, n, (cuComplex**)arrays, lda, ipiv, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
@@ -10096,8 +15914,15 @@ hipblasStatus_t hipblasZgetrf(hipblasHandle_t       handle,
                               const int             lda,
                               int*                  ipiv,
                               int*                  info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays = batched_emulation::device_pointers(handle, 1, {{A, 0}});
+    return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
+        (cublasHandle_t)handle, n, (cuDoubleComplex**)arrays, lda, ipiv, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // getrf_batched
@@ -10110,8 +15935,10 @@ hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(
+            cublasSgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+    });
 }
 catch(...)
 {
@@ -10127,8 +15954,10 @@ hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(
+            cublasDgetrfBatched((cublasHandle_t)handle, n, A, lda, ipiv, info, batch_count));
+    });
 }
 catch(...)
 {
@@ -10144,8 +15973,10 @@ hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
-        (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
+            (cublasHandle_t)handle, n, (cuComplex**)A, lda, ipiv, info, batch_count));
+    });
 }
 catch(...)
 {
@@ -10161,8 +15992,10 @@ hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
-        (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
+            (cublasHandle_t)handle, n, (cuDoubleComplex**)A, lda, ipiv, info, batch_count));
+    });
 }
 catch(...)
 {
@@ -10179,8 +16012,26 @@ hipblasStatus_t hipblasSgetrfStridedBatched(hipblasHandle_t     handle,
                                             const hipblasStride strideP,
                                             int*                info,
                                             const int           batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        auto arrays  = batched_emulation::device_pointers(handle, batch_count, {{A, strideA}});
+        auto A_array = (float**)arrays;
+
+        // the native routine takes the pivots of the instances n apart
+        if(!ipiv || strideP == n)
+            return hipCUBLASStatusToHIPStatus(cublasSgetrfBatched(
+                (cublasHandle_t)handle, n, A_array, lda, ipiv, info, batch_count));
+
+        return batched_emulation::run(handle, batch_count, [&](int b) {
+            return hipCUBLASStatusToHIPStatus(cublasSgetrfBatched(
+                (cublasHandle_t)handle, n, A_array + b, lda, ipiv + b * strideP, info + b, 1));
+        });
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
@@ -10192,8 +16043,26 @@ hipblasStatus_t hipblasDgetrfStridedBatched(hipblasHandle_t     handle,
                                             const hipblasStride strideP,
                                             int*                info,
                                             const int           batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        auto arrays  = batched_emulation::device_pointers(handle, batch_count, {{A, strideA}});
+        auto A_array = (double**)arrays;
+
+        // the native routine takes the pivots of the instances n apart
+        if(!ipiv || strideP == n)
+            return hipCUBLASStatusToHIPStatus(cublasDgetrfBatched(
+                (cublasHandle_t)handle, n, A_array, lda, ipiv, info, batch_count));
+
+        return batched_emulation::run(handle, batch_count, [&](int b) {
+            return hipCUBLASStatusToHIPStatus(cublasDgetrfBatched(
+                (cublasHandle_t)handle, n, A_array + b, lda, ipiv + b * strideP, info + b, 1));
+        });
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
@@ -10205,8 +16074,26 @@ hipblasStatus_t hipblasCgetrfStridedBatched(hipblasHandle_t     handle,
                                             const hipblasStride strideP,
                                             int*                info,
                                             const int           batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        auto arrays  = batched_emulation::device_pointers(handle, batch_count, {{A, strideA}});
+        auto A_array = (cuComplex**)arrays;
+
+        // the native routine takes the pivots of the instances n apart
+        if(!ipiv || strideP == n)
+            return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
+                (cublasHandle_t)handle, n, A_array, lda, ipiv, info, batch_count));
+
+        return batched_emulation::run(handle, batch_count, [&](int b) {
+            return hipCUBLASStatusToHIPStatus(cublasCgetrfBatched(
+                (cublasHandle_t)handle, n, A_array + b, lda, ipiv + b * strideP, info + b, 1));
+        });
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
@@ -10218,8 +16105,26 @@ hipblasStatus_t hipblasZgetrfStridedBatched(hipblasHandle_t       handle,
                                             const hipblasStride   strideP,
                                             int*                  info,
                                             const int             batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        auto arrays  = batched_emulation::device_pointers(handle, batch_count, {{A, strideA}});
+        auto A_array = (cuDoubleComplex**)arrays;
+
+        // the native routine takes the pivots of the instances n apart
+        if(!ipiv || strideP == n)
+            return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
+                (cublasHandle_t)handle, n, A_array, lda, ipiv, info, batch_count));
+
+        return batched_emulation::run(handle, batch_count, [&](int b) {
+            return hipCUBLASStatusToHIPStatus(cublasZgetrfBatched(
+                (cublasHandle_t)handle, n, A_array + b, lda, ipiv + b * strideP, info + b, 1));
+        });
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // getrs
@@ -10233,8 +16138,25 @@ hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
                               float*                   B,
                               const int                ldb,
                               int*                     info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {B, 0}});
+    auto A_array = (float**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
+                                                          hipOperationToCudaOperation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          A_array,
+                                                          lda,
+                                                          ipiv,
+                                                          A_array + 1,
+                                                          ldb,
+                                                          info,
+                                                          1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
@@ -10247,8 +16169,25 @@ hipblasStatus_t hipblasDgetrs(hipblasHandle_t          handle,
                               double*                  B,
                               const int                ldb,
                               int*                     info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {B, 0}});
+    auto A_array = (double**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
+                                                          hipOperationToCudaOperation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          A_array,
+                                                          lda,
+                                                          ipiv,
+                                                          A_array + 1,
+                                                          ldb,
+                                                          info,
+                                                          1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
@@ -10261,8 +16200,25 @@ hipblasStatus_t hipblasCgetrs(hipblasHandle_t          handle,
                               hipblasComplex*          B,
                               const int                ldb,
                               int*                     info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {B, 0}});
+    auto A_array = (cuComplex**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
+                                                          hipOperationToCudaOperation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          A_array,
+                                                          lda,
+                                                          ipiv,
+                                                          A_array + 1,
+                                                          ldb,
+                                                          info,
+                                                          1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
@@ -10275,8 +16231,25 @@ hipblasStatus_t hipblasZgetrs(hipblasHandle_t          handle,
                               hipblasDoubleComplex*    B,
                               const int                ldb,
                               int*                     info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {B, 0}});
+    auto A_array = (cuDoubleComplex**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
+                                                          hipOperationToCudaOperation(trans),
+                                                          n,
+                                                          nrhs,
+                                                          A_array,
+                                                          lda,
+                                                          ipiv,
+                                                          A_array + 1,
+                                                          ldb,
+                                                          info,
+                                                          1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // getrs_batched
@@ -10415,8 +16388,44 @@ hipblasStatus_t hipblasSgetrsStridedBatched(hipblasHandle_t          handle,
                                             const hipblasStride      strideB,
                                             int*                     info,
                                             const int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {B, strideB}});
+    auto A_array = (float**)arrays;
+    auto B_array = A_array + batch_count;
+
+    // the native routine takes the pivots of the instances n apart
+    if(strideP == n)
+        return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array,
+                                                              lda,
+                                                              ipiv,
+                                                              B_array,
+                                                              ldb,
+                                                              info,
+                                                              batch_count));
+
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasSgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array + b,
+                                                              lda,
+                                                              ipiv + b * strideP,
+                                                              B_array + b,
+                                                              ldb,
+                                                              info,
+                                                              1));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
@@ -10433,8 +16442,44 @@ hipblasStatus_t hipblasDgetrsStridedBatched(hipblasHandle_t          handle,
                                             const hipblasStride      strideB,
                                             int*                     info,
                                             const int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {B, strideB}});
+    auto A_array = (double**)arrays;
+    auto B_array = A_array + batch_count;
+
+    // the native routine takes the pivots of the instances n apart
+    if(strideP == n)
+        return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array,
+                                                              lda,
+                                                              ipiv,
+                                                              B_array,
+                                                              ldb,
+                                                              info,
+                                                              batch_count));
+
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasDgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array + b,
+                                                              lda,
+                                                              ipiv + b * strideP,
+                                                              B_array + b,
+                                                              ldb,
+                                                              info,
+                                                              1));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
@@ -10451,8 +16496,44 @@ hipblasStatus_t hipblasCgetrsStridedBatched(hipblasHandle_t          handle,
                                             const hipblasStride      strideB,
                                             int*                     info,
                                             const int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {B, strideB}});
+    auto A_array = (cuComplex**)arrays;
+    auto B_array = A_array + batch_count;
+
+    // the native routine takes the pivots of the instances n apart
+    if(strideP == n)
+        return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array,
+                                                              lda,
+                                                              ipiv,
+                                                              B_array,
+                                                              ldb,
+                                                              info,
+                                                              batch_count));
+
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasCgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array + b,
+                                                              lda,
+                                                              ipiv + b * strideP,
+                                                              B_array + b,
+                                                              ldb,
+                                                              info,
+                                                              1));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
@@ -10469,8 +16550,44 @@ hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t          handle,
                                             const hipblasStride      strideB,
                                             int*                     info,
                                             const int                batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {B, strideB}});
+    auto A_array = (cuDoubleComplex**)arrays;
+    auto B_array = A_array + batch_count;
+
+    // the native routine takes the pivots of the instances n apart
+    if(strideP == n)
+        return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array,
+                                                              lda,
+                                                              ipiv,
+                                                              B_array,
+                                                              ldb,
+                                                              info,
+                                                              batch_count));
+
+    return batched_emulation::run(handle, batch_count, [&](int b) {
+        return hipCUBLASStatusToHIPStatus(cublasZgetrsBatched((cublasHandle_t)handle,
+                                                              hipOperationToCudaOperation(trans),
+                                                              n,
+                                                              nrhs,
+                                                              A_array + b,
+                                                              lda,
+                                                              ipiv + b * strideP,
+                                                              B_array + b,
+                                                              ldb,
+                                                              info,
+                                                              1));
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // getri_batched
@@ -10485,8 +16602,10 @@ hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasSgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasSgetriBatched(
+            (cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
+    });
 }
 catch(...)
 {
@@ -10504,8 +16623,10 @@ hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                      const int       batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(
-        cublasDgetriBatched((cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasDgetriBatched(
+            (cublasHandle_t)handle, n, A, lda, ipiv, C, ldc, info, batch_count));
+    });
 }
 catch(...)
 {
@@ -10523,15 +16644,17 @@ hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                      const int             batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasCgetriBatched((cublasHandle_t)handle,
-                                                          n,
-                                                          (cuComplex**)A,
-                                                          lda,
-                                                          ipiv,
-                                                          (cuComplex**)C,
-                                                          ldc,
-                                                          info,
-                                                          batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasCgetriBatched((cublasHandle_t)handle,
+                                                              n,
+                                                              (cuComplex**)A,
+                                                              lda,
+                                                              ipiv,
+                                                              (cuComplex**)C,
+                                                              ldc,
+                                                              info,
+                                                              batch_count));
+    });
 }
 catch(...)
 {
@@ -10549,15 +16672,17 @@ hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
                                      const int                   batch_count)
 try
 {
-    return hipCUBLASStatusToHIPStatus(cublasZgetriBatched((cublasHandle_t)handle,
-                                                          n,
-                                                          (cuDoubleComplex**)A,
-                                                          lda,
-                                                          ipiv,
-                                                          (cuDoubleComplex**)C,
-                                                          ldc,
-                                                          info,
-                                                          batch_count));
+    return batched_emulation::summarized(handle, info, batch_count, [&] {
+        return hipCUBLASStatusToHIPStatus(cublasZgetriBatched((cublasHandle_t)handle,
+                                                              n,
+                                                              (cuDoubleComplex**)A,
+                                                              lda,
+                                                              ipiv,
+                                                              (cuDoubleComplex**)C,
+                                                              ldc,
+                                                              info,
+                                                              batch_count));
+    });
 }
 catch(...)
 {
@@ -10572,8 +16697,16 @@ hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
                               const int       lda,
                               float*          ipiv,
                               int*            info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {ipiv, 0}});
+    auto A_array = (float**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasSgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + 1, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
@@ -10583,8 +16716,16 @@ hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
                               const int       lda,
                               double*         ipiv,
                               int*            info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {ipiv, 0}});
+    auto A_array = (double**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasDgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + 1, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
@@ -10594,8 +16735,16 @@ hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
                               const int       lda,
                               hipblasComplex* ipiv,
                               int*            info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {ipiv, 0}});
+    auto A_array = (cuComplex**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasCgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + 1, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
@@ -10605,8 +16754,16 @@ hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
                               const int             lda,
                               hipblasDoubleComplex* ipiv,
                               int*                  info)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(handle, 1, {{A, 0}, {ipiv, 0}});
+    auto A_array = (cuDoubleComplex**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasZgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + 1, info, 1));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 // geqrf_batched
@@ -10699,8 +16856,17 @@ hipblasStatus_t hipblasSgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const hipblasStride strideP,
                                             int*                info,
                                             const int           batch_count)
+try
+{
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {ipiv, strideP}});
+    auto A_array = (float**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasSgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + batch_count, info, batch_count));
+}
+catch(...)
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
@@ -10713,8 +16879,17 @@ hipblasStatus_t hipblasDgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const hipblasStride strideP,
                                             int*                info,
                                             const int           batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {ipiv, strideP}});
+    auto A_array = (double**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasDgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + batch_count, info, batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
@@ -10727,8 +16902,17 @@ hipblasStatus_t hipblasCgeqrfStridedBatched(hipblasHandle_t     handle,
                                             const hipblasStride strideP,
                                             int*                info,
                                             const int           batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {ipiv, strideP}});
+    auto A_array = (cuComplex**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasCgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + batch_count, info, batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
@@ -10741,8 +16925,17 @@ hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t       handle,
                                             const hipblasStride   strideP,
                                             int*                  info,
                                             const int             batch_count)
+try
 {
-    return HIPBLAS_STATUS_NOT_SUPPORTED;
+    auto arrays  = batched_emulation::device_pointers(
+        handle, batch_count, {{A, strideA}, {ipiv, strideP}});
+    auto A_array = (cuDoubleComplex**)arrays;
+    return hipCUBLASStatusToHIPStatus(cublasZgeqrfBatched(
+        (cublasHandle_t)handle, m, n, A_array, lda, A_array + batch_count, info, batch_count));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
 }
 
 #endif
@@ -11340,6 +17533,562 @@ catch(...)
     return exception_to_hipblas_status();
 }
 
+hipblasStatus_t hipblasHgemmBatchedHostPtrs(hipblasHandle_t          handle,
+                                            hipblasOperation_t       transa,
+                                            hipblasOperation_t       transb,
+                                            int                      m,
+                                            int                      n,
+                                            int                      k,
+                                            const hipblasHalf*       alpha,
+                                            const hipblasHalf* const A[],
+                                            int                      lda,
+                                            const hipblasHalf* const B[],
+                                            int                      ldb,
+                                            const hipblasHalf*       beta,
+                                            hipblasHalf* const       C[],
+                                            int                      ldc,
+                                            int                      batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasHgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasHgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasHalf* const*)arrays,
+                               lda,
+                               (const hipblasHalf* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasHalf* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSgemmBatchedHostPtrs(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float* const A[],
+                                            int                lda,
+                                            const float* const B[],
+                                            int                ldb,
+                                            const float*       beta,
+                                            float* const       C[],
+                                            int                ldc,
+                                            int                batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasSgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasSgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const float* const*)arrays,
+                               lda,
+                               (const float* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (float* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasDgemmBatchedHostPtrs(hipblasHandle_t     handle,
+                                            hipblasOperation_t  transa,
+                                            hipblasOperation_t  transb,
+                                            int                 m,
+                                            int                 n,
+                                            int                 k,
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            int                 lda,
+                                            const double* const B[],
+                                            int                 ldb,
+                                            const double*       beta,
+                                            double* const       C[],
+                                            int                 ldc,
+                                            int                 batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasDgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasDgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const double* const*)arrays,
+                               lda,
+                               (const double* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (double* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemmBatchedHostPtrs(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
+                                            int                         m,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasComplex*       alpha,
+                                            const hipblasComplex* const A[],
+                                            int                         lda,
+                                            const hipblasComplex* const B[],
+                                            int                         ldb,
+                                            const hipblasComplex*       beta,
+                                            hipblasComplex* const       C[],
+                                            int                         ldc,
+                                            int                         batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasCgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasCgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasComplex* const*)arrays,
+                               lda,
+                               (const hipblasComplex* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemmBatchedHostPtrs(hipblasHandle_t                   handle,
+                                            hipblasOperation_t                transa,
+                                            hipblasOperation_t                transb,
+                                            int                               m,
+                                            int                               n,
+                                            int                               k,
+                                            const hipblasDoubleComplex*       alpha,
+                                            const hipblasDoubleComplex* const A[],
+                                            int                               lda,
+                                            const hipblasDoubleComplex* const B[],
+                                            int                               ldb,
+                                            const hipblasDoubleComplex*       beta,
+                                            hipblasDoubleComplex* const       C[],
+                                            int                               ldc,
+                                            int                               batchCount)
+try
+{
+    hipblasStride strideA, strideB, strideC;
+    if(hipblas_uniform_stride(A, batchCount, &strideA)
+       && hipblas_uniform_stride(B, batchCount, &strideB)
+       && hipblas_uniform_stride(C, batchCount, &strideC))
+        return hipblasZgemmStridedBatched(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A[0],
+                                          lda,
+                                          strideA,
+                                          B[0],
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C[0],
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+
+    auto arrays = batched_emulation::device_pointers(
+        handle, batchCount, {(const void* const*)A, (const void* const*)B, (const void* const*)C});
+    return hipblasZgemmBatched(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               (const hipblasDoubleComplex* const*)arrays,
+                               lda,
+                               (const hipblasDoubleComplex* const*)(arrays + batchCount),
+                               ldb,
+                               beta,
+                               (hipblasDoubleComplex* const*)(arrays + 2 * batchCount),
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// gemm3m
+hipblasStatus_t hipblasCgemm3m(hipblasHandle_t       handle,
+                               hipblasOperation_t    transa,
+                               hipblasOperation_t    transb,
+                               int                   m,
+                               int                   n,
+                               int                   k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int                   lda,
+                               const hipblasComplex* B,
+                               int                   ldb,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int                   ldc)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasCgemm3m((cublasHandle_t)handle,
+                                                    hipOperationToCudaOperation(transa),
+                                                    hipOperationToCudaOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    (cuComplex*)alpha,
+                                                    (cuComplex*)A,
+                                                    lda,
+                                                    (cuComplex*)B,
+                                                    ldb,
+                                                    (cuComplex*)beta,
+                                                    (cuComplex*)C,
+                                                    ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm3mBatched(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transa,
+                                      hipblasOperation_t          transb,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasComplex*       alpha,
+                                      const hipblasComplex* const A[],
+                                      int                         lda,
+                                      const hipblasComplex* const B[],
+                                      int                         ldb,
+                                      const hipblasComplex*       beta,
+                                      hipblasComplex* const       C[],
+                                      int                         ldc,
+                                      int                         batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasCgemm3mBatched((cublasHandle_t)handle,
+                                                           hipOperationToCudaOperation(transa),
+                                                           hipOperationToCudaOperation(transb),
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           (cuComplex*)alpha,
+                                                           (cuComplex* const*)A,
+                                                           lda,
+                                                           (cuComplex* const*)B,
+                                                           ldb,
+                                                           (cuComplex*)beta,
+                                                           (cuComplex* const*)C,
+                                                           ldc,
+                                                           batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasCgemm3mStridedBatched(hipblasHandle_t       handle,
+                                             hipblasOperation_t    transa,
+                                             hipblasOperation_t    transb,
+                                             int                   m,
+                                             int                   n,
+                                             int                   k,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             long long             strideA,
+                                             const hipblasComplex* B,
+                                             int                   ldb,
+                                             long long             strideB,
+                                             const hipblasComplex* beta,
+                                             hipblasComplex*       C,
+                                             int                   ldc,
+                                             long long             strideC,
+                                             int                   batchCount)
+try
+{
+    return hipCUBLASStatusToHIPStatus(
+        cublasCgemm3mStridedBatched((cublasHandle_t)handle,
+                                    hipOperationToCudaOperation(transa),
+                                    hipOperationToCudaOperation(transb),
+                                    m,
+                                    n,
+                                    k,
+                                    (cuComplex*)alpha,
+                                    (cuComplex*)A,
+                                    lda,
+                                    strideA,
+                                    (cuComplex*)B,
+                                    ldb,
+                                    strideB,
+                                    (cuComplex*)beta,
+                                    (cuComplex*)C,
+                                    ldc,
+                                    strideC,
+                                    batchCount));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm3m(hipblasHandle_t             handle,
+                               hipblasOperation_t          transa,
+                               hipblasOperation_t          transb,
+                               int                         m,
+                               int                         n,
+                               int                         k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int                         lda,
+                               const hipblasDoubleComplex* B,
+                               int                         ldb,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int                         ldc)
+try
+{
+    return hipCUBLASStatusToHIPStatus(cublasZgemm3m((cublasHandle_t)handle,
+                                                    hipOperationToCudaOperation(transa),
+                                                    hipOperationToCudaOperation(transb),
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    (cuDoubleComplex*)alpha,
+                                                    (cuDoubleComplex*)A,
+                                                    lda,
+                                                    (cuDoubleComplex*)B,
+                                                    ldb,
+                                                    (cuDoubleComplex*)beta,
+                                                    (cuDoubleComplex*)C,
+                                                    ldc));
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// cuBLAS has 3M batched routines for single precision only
+hipblasStatus_t hipblasZgemm3mBatched(hipblasHandle_t                   handle,
+                                      hipblasOperation_t                transa,
+                                      hipblasOperation_t                transb,
+                                      int                               m,
+                                      int                               n,
+                                      int                               k,
+                                      const hipblasDoubleComplex*       alpha,
+                                      const hipblasDoubleComplex* const A[],
+                                      int                               lda,
+                                      const hipblasDoubleComplex* const B[],
+                                      int                               ldb,
+                                      const hipblasDoubleComplex*       beta,
+                                      hipblasDoubleComplex* const       C[],
+                                      int                               ldc,
+                                      int                               batchCount)
+try
+{
+    auto a_batch = batched_emulation::pointers(handle, A, batchCount);
+    auto b_batch = batched_emulation::pointers(handle, B, batchCount);
+    auto c_batch = batched_emulation::pointers(handle, C, batchCount);
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgemm3m(handle,
+                              transa,
+                              transb,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              a_batch[b],
+                              lda,
+                              b_batch[b],
+                              ldb,
+                              beta,
+                              c_batch[b],
+                              ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasZgemm3mStridedBatched(hipblasHandle_t             handle,
+                                             hipblasOperation_t          transa,
+                                             hipblasOperation_t          transb,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             long long                   strideA,
+                                             const hipblasDoubleComplex* B,
+                                             int                         ldb,
+                                             long long                   strideB,
+                                             const hipblasDoubleComplex* beta,
+                                             hipblasDoubleComplex*       C,
+                                             int                         ldc,
+                                             long long                   strideC,
+                                             int                         batchCount)
+try
+{
+    return batched_emulation::run(handle, batchCount, [&](int b) {
+        return hipblasZgemm3m(handle,
+                              transa,
+                              transb,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              A + b * strideA,
+                              lda,
+                              B + b * strideB,
+                              ldb,
+                              beta,
+                              C + b * strideC,
+                              ldc);
+    });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
 // gemm_ex
 hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasOperation_t transa,
@@ -11553,75 +18302,272 @@ hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
-// // syrk_ex
-// hipblasStatus_t hipblasCsyrkEx(hipblasHandle_t       handle,
-//                                           hipblasFillMode_t     uplo,
-//                                           hipblasOperation_t    trans,
-//                                           int                   n,
-//                                           int                   k,
-//                                           const hipblasComplex* alpha,
-//                                           const void*           A,
-//                                           hipblasDatatype_t     Atype,
-//                                           int                   lda,
-//                                           const hipblasComplex* beta,
-//                                           hipblasComplex*       C,
-//                                           hipblasDatatype_t     Ctype,
-//                                           int                   ldc)
-// try
-//{
-//     return hipCUBLASStatusToHIPStatus(cublasCsyrkEx((cublasHandle_t)handle,
-//                                                     hipFillToCudaFill(uplo),
-//                                                     hipOperationToCudaOperation(trans),
-//                                                     n,
-//                                                     k,
-//                                                     (cuComplex*)alpha,
-//                                                     A,
-//                                                     HIPDatatypeToCudaDatatype(Atype),
-//                                                     lda,
-//                                                     (cuComplex*)beta,
-//                                                     (cuComplex*)C,
-//                                                     HIPDatatypeToCudaDatatype(Ctype),
-//                                                     ldc));
-// }
-// catch(...)
-// {
-//     return exception_to_hipblas_status();
-// }
-
-// // herk_ex
-// hipblasStatus_t hipblasCherkEx(hipblasHandle_t    handle,
-//                                           hipblasFillMode_t  uplo,
-//                                           hipblasOperation_t trans,
-//                                           int                n,
-//                                           int                k,
-//                                           const float*       alpha,
-//                                           const void*        A,
-//                                           hipblasDatatype_t  Atype,
-//                                           int                lda,
-//                                           const float*       beta,
-//                                           hipblasComplex*    C,
-//                                           hipblasDatatype_t  Ctype,
-//                                           int                ldc)
-// try
-// {
-//     return hipCUBLASStatusToHIPStatus(cublasCherkEx((cublasHandle_t)handle,
-//                                                     hipFillToCudaFill(uplo),
-//                                                     hipOperationToCudaOperation(trans),
-//                                                     n,
-//                                                     k,
-//                                                     alpha,
-//                                                     A,
-//                                                     HIPDatatypeToCudaDatatype(Atype),
-//                                                     lda,
-//                                                     beta,
-//                                                     (cuComplex*)C,
-//                                                     HIPDatatypeToCudaDatatype(Ctype),
-//                                                     ldc));
-// }
-// catch(...)
-// {
-//     return exception_to_hipblas_status();
-// }
+// syrk_ex
+// geamBatched is emulated per instance here, so the diagonal blocks are copied back by column
+hipblasStatus_t hipblasSyrkEx(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t trans,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        beta,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        0,
+        beta,
+        C,
+        c_type,
+        ldc,
+        0,
+        1,
+        compute_type,
+        false,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [](int, std::initializer_list<const void* const*>) -> void* const* { return nullptr; });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSyrkBatchedEx(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t trans,
+                                     int                n,
+                                     int                k,
+                                     const void*        alpha,
+                                     const void*        A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        beta,
+                                     void*              C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        beta,
+        C,
+        c_type,
+        ldc,
+        batch_count,
+        compute_type,
+        false,
+        [&](auto array) { return batched_emulation::pointers(handle, array, batch_count); },
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [](int, std::initializer_list<const void* const*>) -> void* const* { return nullptr; });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasSyrkStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t trans,
+                                            int                n,
+                                            int                k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            hipblasStride      stride_C,
+                                            int                batch_count,
+                                            hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        stride_A,
+        beta,
+        C,
+        c_type,
+        ldc,
+        stride_C,
+        batch_count,
+        compute_type,
+        false,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [](int, std::initializer_list<const void* const*>) -> void* const* { return nullptr; });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+// herk_ex
+hipblasStatus_t hipblasHerkEx(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t trans,
+                              int                n,
+                              int                k,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        beta,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        0,
+        beta,
+        C,
+        c_type,
+        ldc,
+        0,
+        1,
+        compute_type,
+        true,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [](int, std::initializer_list<const void* const*>) -> void* const* { return nullptr; });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHerkBatchedEx(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t trans,
+                                     int                n,
+                                     int                k,
+                                     const void*        alpha,
+                                     const void*        A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        beta,
+                                     void*              C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        beta,
+        C,
+        c_type,
+        ldc,
+        batch_count,
+        compute_type,
+        true,
+        [&](auto array) { return batched_emulation::pointers(handle, array, batch_count); },
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [](int, std::initializer_list<const void* const*>) -> void* const* { return nullptr; });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
+
+hipblasStatus_t hipblasHerkStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t trans,
+                                            int                n,
+                                            int                k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            hipblasStride      stride_A,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            hipblasStride      stride_C,
+                                            int                batch_count,
+                                            hipblasDatatype_t  compute_type)
+try
+{
+    return hipblas_syrk_ex_strided_batched(
+        handle,
+        uplo,
+        trans,
+        n,
+        k,
+        alpha,
+        A,
+        a_type,
+        lda,
+        stride_A,
+        beta,
+        C,
+        c_type,
+        ldc,
+        stride_C,
+        batch_count,
+        compute_type,
+        true,
+        [&](size_t bytes) { return batched_emulation::scratch(handle, bytes); },
+        [](int, std::initializer_list<const void* const*>) -> void* const* { return nullptr; });
+}
+catch(...)
+{
+    return exception_to_hipblas_status();
+}
 
 // axpy_ex
 hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
@@ -15,6 +15,7 @@ from fnmatch import fnmatchcase
 from xml.dom import minidom
 import multiprocessing
 import time
+import rtest_shard
 
 args = {}
 OS_info = {}
@@ -40,6 +41,10 @@ def parse_args():
                         help='Installation directory where build or release folders are (optional, default: build)')
     parser.add_argument(      '--fail_test', default=False, required=False, action='store_true',
                         help='Return as if test failed (optional, default: false)')
+    parser.add_argument('-j', '--shards', type=int, required=False, default=0,
+                        help='Run each test set in this many processes with rtest_shard.py (optional, default: 0, single process)')
+    parser.add_argument(      '--devices', type=str, required=False, default="",
+                        help='Devices of the shards, comma separated or "host" (optional, default: all GPUs)')
     # parser.add_argument('-v', '--verbose', required=False, default = False, action='store_true',
     #                     help='Verbose install (optional, default: False)')
     return parser.parse_args()
@@ -199,6 +204,25 @@ def run_cmd(cmd, test = False, time_limit = 0):
         status = 3
     return status
 
+def run_sharded(cmd, time_limit = 0):
+    """Run a gtest command line of rtest.xml sharded over processes and devices"""
+    global args
+    tokens = shlex.split(cmd)
+    exe = tokens[0] if os.path.dirname(tokens[0]) else os.path.join(os.curdir, tokens[0])
+    gtest_filter = '*'
+    extra = []
+    for token in tokens[1:]:
+        if token.startswith('--gtest_filter='):
+            gtest_filter = token.split('=', 1)[1]
+        elif not token.startswith('--gtest_output'):
+            extra.append(token)
+    shard_args = ['--exe', exe, '--filter', gtest_filter, '--shards', str(args.shards),
+                  '--timeout', str(time_limit)]
+    if args.devices:
+        shard_args += ['--devices', args.devices]
+    print(f"{cmd} (sharded {args.shards} ways)")
+    return rtest_shard.run(rtest_shard.parse_args(shard_args + ['--'] + extra))
+
 def batch(script, xml):
     global OS_info
     global args
@@ -251,7 +275,10 @@ def batch(script, xml):
 
                         raw_cmd = run.firstChild.data
                         var_cmd = raw_cmd.format_map(var_subs)
-                        error = run_cmd(var_cmd, True, timeout)
+                        if args.shards > 0:
+                            error = run_sharded(var_cmd, timeout)
+                        else:
+                            error = run_cmd(var_cmd, True, timeout)
                         if (error == 2):
                             print( f'***\n*** Timed out when running: {name}\n***')
         else:
@@ -0,0 +1,269 @@
+#!/usr/bin/python3
+"""Copyright 2021 Advanced Micro Devices, Inc.
+Run hipblas-test sharded over several worker processes.
+
+The test instances selected by the gtest filter are spread over the workers by their duration in
+earlier runs, longest first, each to the least loaded worker. Every worker is bound to one device,
+through the visibility variable the device ids were read from (HIP_VISIBLE_DEVICES by default),
+and to its own set of CPUs, which also sizes the client thread pool of the CPU references. The
+gtest XML of the workers is merged into one file, and the duration of every test is recorded for
+the next schedule. A run with a timed out worker exits with 2, as rtest.py does.
+
+Without devices (--devices host) the workers share the default device; this is how the runner is
+exercised on a host stand-in device."""
+
+import argparse
+import heapq
+import json
+import os
+import re
+import shlex
+import subprocess
+import sys
+import tempfile
+import time
+import xml.etree.ElementTree as ET
+
+DEFAULT_DURATION = 1.0  # seconds, for tests without history and an empty history
+DEVICE_VARS = ('HIP_VISIBLE_DEVICES', 'CUDA_VISIBLE_DEVICES')  # for --devices and rocminfo ids
+TIMEOUT_STATUS = 2  # exit status of a timed out run, as in rtest.py
+
+
+def parse_args(argv=None):
+    """Parse command-line arguments"""
+    parser = argparse.ArgumentParser(description="""
+    Run hipblas-test sharded over several worker processes
+    """)
+    parser.add_argument('-e', '--exe', type=str, default='./hipblas-test',
+                        help='Test executable (optional, default: ./hipblas-test)')
+    parser.add_argument('-f', '--filter', type=str, default='*',
+                        help='gtest filter selecting the tests (optional, default: *)')
+    parser.add_argument('-j', '--shards', type=int, default=0,
+                        help='Number of worker processes (optional, default: one per device)')
+    parser.add_argument('-d', '--devices', type=str, default='',
+                        help='Comma separated device ids, or "host" for no device binding '
+                             '(optional, default: HIP_VISIBLE_DEVICES or all GPUs of rocminfo)')
+    parser.add_argument('-o', '--output', type=str, default='test_detail.xml',
+                        help='Merged gtest XML output (optional, default: test_detail.xml)')
+    parser.add_argument(      '--durations', type=str, default='hipblas_test_durations.json',
+                        help='Test durations of earlier runs, updated after the run '
+                             '(optional, default: hipblas_test_durations.json)')
+    parser.add_argument(      '--timeout', type=float, default=0,
+                        help='Seconds after which the workers are killed (optional, default: none)')
+    parser.add_argument('extra', nargs=argparse.REMAINDER,
+                        help='Further arguments passed to every worker after --')
+    return parser.parse_args(argv)
+
+
+def detect_devices():
+    """Device ids visible to this process, an empty list when there are none, and the variables
+    which select one of them in a worker: the one the ids were read from, if any"""
+    for var in ('HIP_VISIBLE_DEVICES', 'ROCR_VISIBLE_DEVICES', 'CUDA_VISIBLE_DEVICES'):
+        if os.environ.get(var):
+            return [d for d in os.environ[var].split(',') if d], (var,)
+    try:
+        out = subprocess.run(['rocminfo'], stdout=subprocess.PIPE, stderr=subprocess.DEVNULL,
+                             text=True).stdout
+    except OSError:
+        return [], DEVICE_VARS
+    gpus = len(re.findall(r'Device Type:\s*GPU', out))
+    return [str(d) for d in range(gpus)], DEVICE_VARS
+
+
+def list_tests(exe, gtest_filter):
+    """Full names of the test instances selected by the filter, in gtest order"""
+    out = subprocess.run([exe, '--gtest_list_tests', f'--gtest_filter={gtest_filter}'],
+                         stdout=subprocess.PIPE, check=True, text=True).stdout
+    tests = []
+    suite = ''
+    for line in out.splitlines():
+        name = line.split('#')[0].rstrip()
+        if not name or name.startswith('Running main'):
+            continue
+        if not line.startswith(' '):
+            suite = name
+        else:
+            tests.append(suite + name.strip())
+    return tests
+
+
+def load_durations(path):
+    try:
+        with open(path) as f:
+            return json.load(f)
+    except (OSError, ValueError):
+        return {}
+
+
+def schedule(tests, durations, shards):
+    """Longest processing time first: each test, longest first, goes to the least loaded shard"""
+    known = sorted(durations[t] for t in tests if t in durations)
+    default = known[len(known) // 2] if known else DEFAULT_DURATION
+    cost = {t: durations.get(t, default) for t in tests}
+
+    loads = [(0.0, s) for s in range(shards)]
+    assigned = [[] for _ in range(shards)]
+    for test in sorted(tests, key=lambda t: -cost[t]):
+        load, s = heapq.heappop(loads)
+        assigned[s].append(test)
+        heapq.heappush(loads, (load + cost[test], s))
+    return assigned, [load for load, _ in sorted(loads, key=lambda l: l[1])]
+
+
+def split_cpus(shards):
+    """Disjoint CPU sets, one per shard; None where affinity is not supported"""
+    if not hasattr(os, 'sched_getaffinity'):
+        return [None] * shards
+    cpus = sorted(os.sched_getaffinity(0))
+    if len(cpus) < shards:
+        return [None] * shards
+    return [set(cpus[len(cpus) * s // shards:len(cpus) * (s + 1) // shards])
+            for s in range(shards)]
+
+
+def start_worker(args, shard, tests, device, device_vars, cpus, workdir):
+    """Start one worker on its tests; the filter goes through a flag file since it can be long"""
+    flagfile = os.path.join(workdir, f'shard{shard}.flags')
+    with open(flagfile, 'w') as f:
+        f.write('--gtest_filter=' + ':'.join(tests) + '\n')
+    xml = os.path.join(workdir, f'shard{shard}.xml')
+    log = open(os.path.join(workdir, f'shard{shard}.log'), 'w')
+
+    env = dict(os.environ)
+    if device is not None:
+        for var in device_vars:
+            env[var] = device
+    if cpus:
+        env['HIPBLAS_CLIENT_THREADS'] = str(len(cpus))
+
+    extra = [a for a in args.extra if a != '--']
+    cmd = [args.exe, f'--gtest_flagfile={flagfile}', f'--gtest_output=xml:{xml}'] + extra
+    preexec = (lambda: os.sched_setaffinity(0, cpus)) if cpus else None
+    proc = subprocess.Popen(cmd, stdout=log, stderr=subprocess.STDOUT, env=env,
+                            preexec_fn=preexec)
+    return {'shard': shard, 'proc': proc, 'xml': xml, 'log': log, 'tests': tests}
+
+
+def merge_xml(workers, output):
+    """Merge the worker XML into one testsuites document. Tests of a worker which died without
+    reporting them are added as failures. Returns {test: seconds} and the failed tests."""
+    root = ET.Element('testsuites', name='AllTests')
+    suites = {}
+    durations = {}
+    failed = []
+    for w in workers:
+        reported = set()
+        if os.path.isfile(w['xml']):
+            for suite in ET.parse(w['xml']).getroot().iter('testsuite'):
+                merged = suites.get(suite.get('name'))
+                if merged is None:
+                    merged = suites[suite.get('name')] = ET.SubElement(
+                        root, 'testsuite', name=suite.get('name'))
+                for case in suite.iter('testcase'):
+                    merged.append(case)
+                    name = f"{case.get('classname')}.{case.get('name')}"
+                    reported.add(name)
+                    durations[name] = float(case.get('time', 0))
+                    if case.find('failure') is not None:
+                        failed.append(name)
+        for name in w['tests']:
+            if name not in reported:
+                suite_name, _, case_name = name.rpartition('.')
+                merged = suites.get(suite_name)
+                if merged is None:
+                    merged = suites[suite_name] = ET.SubElement(root, 'testsuite', name=suite_name)
+                case = ET.SubElement(merged, 'testcase', name=case_name, classname=suite_name,
+                                     time='0')
+                ET.SubElement(case, 'failure', message=f"shard {w['shard']} exited with "
+                              f"{w['proc'].returncode} before reporting this test")
+                failed.append(name)
+
+    totals = {'tests': 0, 'failures': 0, 'disabled': 0, 'errors': 0}
+    total_time = 0.0
+    for suite in root:
+        cases = list(suite.iter('testcase'))
+        counts = {'tests': len(cases),
+                  'failures': sum(c.find('failure') is not None for c in cases),
+                  'disabled': sum(c.get('status') == 'notrun' for c in cases),
+                  'errors': 0}
+        seconds = sum(float(c.get('time', 0)) for c in cases)
+        for key, value in counts.items():
+            suite.set(key, str(value))
+            totals[key] += value
+        suite.set('time', f'{seconds:.3f}')
+        total_time += seconds
+    for key, value in totals.items():
+        root.set(key, str(value))
+    root.set('time', f'{total_time:.3f}')
+
+    ET.ElementTree(root).write(output, encoding='UTF-8', xml_declaration=True)
+    return durations, failed
+
+
+def run(args):
+    device_vars = DEVICE_VARS
+    if args.devices == 'host':
+        devices = []
+    elif args.devices:
+        devices = args.devices.split(',')
+    else:
+        devices, device_vars = detect_devices()
+    shards = args.shards if args.shards > 0 else max(len(devices), 1)
+
+    tests = list_tests(args.exe, args.filter)
+    if not tests:
+        print('rtest_shard: no tests match the filter')
+        return 0
+
+    history = load_durations(args.durations)
+    assigned, loads = schedule(tests, history, shards)
+    cpus = split_cpus(shards)
+
+    workdir = tempfile.mkdtemp(prefix='hipblas_shards_')
+    workers = []
+    for s in range(shards):
+        if not assigned[s]:
+            continue
+        device = devices[s % len(devices)] if devices else None
+        workers.append(start_worker(args, s, assigned[s], device, device_vars, cpus[s], workdir))
+        print(f"rtest_shard: shard {s}: {len(assigned[s])} tests, ~{loads[s]:.0f} s expected, "
+              f"device {device if device is not None else 'default'}, "
+              f"cpus {len(cpus[s]) if cpus[s] else 'all'}")
+
+    start = time.monotonic()
+    timed_out = False
+    for w in workers:
+        remaining = None
+        if args.timeout > 0:
+            remaining = max(args.timeout - (time.monotonic() - start), 0)
+        try:
+            w['proc'].wait(timeout=remaining)
+        except subprocess.TimeoutExpired:
+            print(f"rtest_shard: shard {w['shard']} timed out, killing it")
+            timed_out = True
+            w['proc'].kill()
+            w['proc'].wait()
+        w['log'].close()
+        print(f"rtest_shard: shard {w['shard']} finished with {w['proc'].returncode} after "
+              f"{time.monotonic() - start:.0f} s, log in {w['log'].name}")
+
+    durations, failed = merge_xml(workers, args.output)
+    history.update(durations)
+    with open(args.durations, 'w') as f:
+        json.dump(history, f, indent=0, sort_keys=True)
+
+    print(f'rtest_shard: {len(tests)} tests in {time.monotonic() - start:.0f} s, '
+          f'{len(failed)} failed, results in {args.output}')
+    for name in failed:
+        print(f'rtest_shard: FAILED {name}')
+    if timed_out:
+        return TIMEOUT_STATUS
+    return 1 if failed or any(w['proc'].returncode for w in workers) else 0
+
+
+def main():
+    sys.exit(run(parse_args()))
+
+
+if __name__ == '__main__':
+    main()